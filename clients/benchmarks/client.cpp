@@ -30,6 +30,8 @@
 #include <rocsparse.h>
 
 #include "rocsparse_bench_app.hpp"
+#include "rocsparse_bench_replay.hpp"
+#include "rocsparse_bench_throughput.hpp"
 
 //
 // REQUIRED ROUTINES:
@@ -68,6 +70,12 @@ rocsparse_status rocsparse_record_output(const std::string& s)
 
 rocsparse_status rocsparse_record_timing(double msec, double gflops, double gbs)
 {
+    auto* s_bench_replay = rocsparse_bench_replay::instance();
+    if(s_bench_replay)
+    {
+        return s_bench_replay->record_timing(msec, gflops, gbs);
+    }
+
     auto* s_bench_app = rocsparse_bench_app::instance();
     if(s_bench_app)
     {
@@ -81,6 +89,11 @@ rocsparse_status rocsparse_record_timing(double msec, double gflops, double gbs)
 
 bool display_timing_info_is_stdout_disabled()
 {
+    if(rocsparse_bench_replay::instance())
+    {
+        return true;
+    }
+
     auto* s_bench_app = rocsparse_bench_app::instance();
     if(s_bench_app)
     {
@@ -94,7 +107,69 @@ bool display_timing_info_is_stdout_disabled()
 
 int main(int argc, char* argv[])
 {
-    if(rocsparse_bench_app::applies(argc, argv))
+    if(rocsparse_bench_replay::applies(argc, argv))
+    {
+        try
+        {
+            auto* s_bench_replay = rocsparse_bench_replay::instance(argc, argv);
+
+            //
+            // RUN UNIQUE CALLS.
+            //
+            rocsparse_status status = s_bench_replay->run();
+            if(status != rocsparse_status_success)
+            {
+                return status;
+            }
+
+            //
+            // REPORT PROJECTED TIME PER ROUTINE.
+            //
+            status = s_bench_replay->report(std::cout);
+            if(status != rocsparse_status_success)
+            {
+                return status;
+            }
+
+            return s_bench_replay->export_file();
+        }
+        catch(const rocsparse_status& status)
+        {
+            return status;
+        }
+    }
+    else if(rocsparse_bench_throughput::applies(argc, argv))
+    {
+        try
+        {
+            auto* s_bench_throughput = rocsparse_bench_throughput::instance(argc, argv);
+
+            //
+            // ISSUE CALLS FROM ALL THREADS AND STREAMS.
+            //
+            rocsparse_status status = s_bench_throughput->run();
+            if(status != rocsparse_status_success)
+            {
+                return status;
+            }
+
+            //
+            // REPORT CALLS PER SECOND AND LATENCY PERCENTILES.
+            //
+            status = s_bench_throughput->report(std::cout);
+            if(status != rocsparse_status_success)
+            {
+                return status;
+            }
+
+            return s_bench_throughput->export_file();
+        }
+        catch(const rocsparse_status& status)
+        {
+            return status;
+        }
+    }
+    else if(rocsparse_bench_app::applies(argc, argv))
     {
         try
         {
@@ -310,13 +310,13 @@ void rocsparse_arguments_config::set_description(options_description& desc)
      value<std::string>(&this->function_name)->default_value("axpyi"),
      "SPARSE function to test. Options:\n"
      "  Level1: axpyi, doti, dotci, gthr, gthrz, roti, sctr\n"
-     "  Level2: bsrmv, bsrxmv, bsrsv, coomv, coomv_aos, csrmv, csrmv_managed, csrsv, csritsv, coosv, ellmv, hybmv, gebsrmv, gemvi\n"
+     "  Level2: bsrmv, bsrxmv, bsrsv, coomv, coomv_aos, csrmv, csrmv_batched, csrmv_managed, csrmv_semiring, csrmv_fused, csrsv, csritsv, coosv, ellmv, hybmv, gebsrmv, gemvi\n"
      "  Level3: bsrmm, bsrsm, gebsrmm, csrmm, csrmm_batched, coomm, coomm_batched, cscmm, cscmm_batched, csrsm, coosm, gemmi, sddmm\n"
-     "  Extra: bsrgeam, bsrgemm, csrgeam, csrgemm, csrgemm_reuse\n"
-     "  Preconditioner: bsric0, bsrilu0, csric0, csrilu0, csritilu0, gtsv, gtsv_no_pivot, gtsv_no_pivot_strided_batch, gtsv_interleaved_batch, gpsv_interleaved_batch\n"
+     "  Extra: bsrgeam, bsrgemm, csrgeam, csrgemm, csrgemm_reuse, csrgemm_masked, csrgemm_semiring, csrrap, spgeam\n"
+     "  Preconditioner: bsrbjac, bsric0, bsrilu0, csrbjac, csric0, csrilu0, csritilu0, gtsv, gtsv_no_pivot, gtsv_no_pivot_strided_batch, gtsv_strided_batch, gtsv_interleaved_batch, gpsv_interleaved_batch\n"
      "  Conversion: csr2coo, csr2csc, gebsr2gebsc, csr2ell, csr2hyb, csr2bsr, csr2gebsr\n"
      "              coo2csr, ell2csr, hyb2csr, dense2csr, dense2coo, prune_dense2csr, prune_dense2csr_by_percentage, dense2csc\n"
-     "              csr2dense, csc2dense, coo2dense, bsr2csr, gebsr2csr, gebsr2gebsr, csr2csr_compress, prune_csr2csr, prune_csr2csr_by_percentage\n"
+     "              csr2dense, csc2dense, coo2dense, bsr2csr, gebsr2csr, gebsr2gebsr, csr2csr_compress, prune_csr2csr, prune_csr2csr_by_percentage, prune_csr2csr_by_strength\n"
      "              sparse_to_dense_coo, sparse_to_dense_csr, sparse_to_dense_csc, dense_to_sparse_coo, dense_to_sparse_csr, dense_to_sparse_csc, sparse_to_sparse\n"
      "  Sorting: cscsort, csrsort, coosort\n"
      "  Misc: identity, inverse_permutation, nnz\n"
@@ -401,7 +401,7 @@ void rocsparse_arguments_config::set_description(options_description& desc)
 
     ("spmv_alg",
       value<rocsparse_int>(&this->b_spmv_alg)->default_value(rocsparse_spmv_alg_default),
-      "Indicates what algorithm to use when running SpMV. Possibly choices are default: 0, COO: 1, CSR adaptive: 2, CSR stream: 3, ELL: 4, COO atomic: 5, BSR: 6, CSR LRB: 7 (default:0)")
+      "Indicates what algorithm to use when running SpMV. Possibly choices are default: 0, COO: 1, CSR adaptive: 2, CSR stream: 3, ELL: 4, COO atomic: 5, BSR: 6, CSR LRB: 7, CSR gather: 8 (default:0)")
 
     ("itilu0_alg",
       value<rocsparse_int>(&this->b_itilu0_alg)->default_value(rocsparse_itilu0_alg_default),
@@ -516,7 +516,8 @@ int rocsparse_arguments_config::parse(int&argc,char**&argv, options_description&
        && this->b_spmv_alg != rocsparse_spmv_alg_ell
        && this->b_spmv_alg != rocsparse_spmv_alg_coo_atomic
        && this->b_spmv_alg != rocsparse_spmv_alg_bsr
-       && this->b_spmv_alg != rocsparse_spmv_alg_csr_lrb)
+       && this->b_spmv_alg != rocsparse_spmv_alg_csr_lrb
+       && this->b_spmv_alg != rocsparse_spmv_alg_csr_gather)
   {
       std::cerr << "Invalid value for --spmv_alg" << std::endl;
       return -1;
@@ -863,7 +864,8 @@ int rocsparse_arguments_config::parse_no_default(int&argc,char**&argv, options_d
        && this->b_spmv_alg != rocsparse_spmv_alg_csr_stream
        && this->b_spmv_alg != rocsparse_spmv_alg_ell
        && this->b_spmv_alg != rocsparse_spmv_alg_coo_atomic
-       && this->b_spmv_alg != rocsparse_spmv_alg_csr_lrb)
+       && this->b_spmv_alg != rocsparse_spmv_alg_csr_lrb
+       && this->b_spmv_alg != rocsparse_spmv_alg_csr_gather)
   {
       std::cerr << "Invalid value for --spmv_alg" << std::endl;
       return -1;
@@ -128,6 +128,11 @@ rocsparse_int rocsparse_bench::get_device_id() const
     return this->config.device_id;
 }
 
+const rocsparse_arguments_config& rocsparse_bench::get_config() const
+{
+    return this->config;
+}
+
 // This is used for backward compatibility.
 void rocsparse_bench::info_devices(std::ostream& out_) const
 {
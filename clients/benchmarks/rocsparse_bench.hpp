@@ -40,6 +40,9 @@ struct gpu_config
     long sharedMemPerBlock_KB;
     long maxThreadsPerBlock;
     long warpSize;
+    long memoryClockRate_MHz;
+    long memoryBusWidth;
+    long multiProcessorCount;
 
     explicit gpu_config(const hipDeviceProp_t& prop)
     {
@@ -52,6 +55,29 @@ struct gpu_config
         this->sharedMemPerBlock_KB = (prop.sharedMemPerBlock >> 10);
         this->maxThreadsPerBlock   = prop.maxThreadsPerBlock;
         this->warpSize             = prop.warpSize;
+        this->memoryClockRate_MHz  = prop.memoryClockRate / 1000;
+        this->memoryBusWidth       = prop.memoryBusWidth;
+        this->multiProcessorCount  = prop.multiProcessorCount;
+    }
+
+    //
+    // @brief Theoretical peak memory bandwidth in GB/s, from the double data rate of the
+    // memory clock and the width of the memory bus.
+    //
+    double peak_bandwidth() const
+    {
+        return 2.0 * this->memoryClockRate_MHz * 1.0e6 * (this->memoryBusWidth / 8) / 1.0e9;
+    }
+
+    //
+    // @brief Theoretical peak compute in GFlop/s, assuming one fused multiply-add per
+    // wavefront lane and clock cycle on each compute unit. Packed and matrix instructions
+    // are not accounted for, the peak should be given explicitly for these.
+    //
+    double peak_gflops() const
+    {
+        return 2.0 * this->multiProcessorCount * this->warpSize * this->clockRate_MHz * 1.0e6
+               / 1.0e9;
     }
 
     void print(std::ostream& out_)
@@ -108,6 +134,8 @@ public:
     rocsparse_status run();
     rocsparse_int    get_device_id() const;
     void             info_devices(std::ostream& out_) const;
+
+    const rocsparse_arguments_config& get_config() const;
 };
 
 std::string rocsparse_get_version();
@@ -33,9 +33,40 @@ rocsparse_bench_app_base::rocsparse_bench_app_base(int argc, char** argv)
     : m_initial_argc(rocsparse_bench_app_base::save_initial_cmdline(argc, argv, &m_initial_argv))
     , m_bench_cmdlines(argc, argv)
     , m_bench_timing(m_bench_cmdlines.get_nsamples(), m_bench_cmdlines.get_nruns())
+    , m_bench_roofline{m_bench_cmdlines.get_peak_bandwidth(), m_bench_cmdlines.get_peak_gflops()}
 
           {};
 
+void rocsparse_bench_app_base::detect_roofline()
+{
+    if(this->m_bench_roofline.peak_bandwidth > 0.0 && this->m_bench_roofline.peak_gflops > 0.0)
+    {
+        return;
+    }
+
+    int             device_id;
+    hipDeviceProp_t prop;
+    if(hipGetDevice(&device_id) != hipSuccess
+       || hipGetDeviceProperties(&prop, device_id) != hipSuccess)
+    {
+        std::cerr << "rocsparse_bench_app warning: cannot detect the peaks of the device, "
+                     "use --bench-peak-bandwidth and --bench-peak-gflops."
+                  << std::endl;
+        return;
+    }
+
+    gpu_config g(prop);
+    if(this->m_bench_roofline.peak_bandwidth <= 0.0)
+    {
+        this->m_bench_roofline.peak_bandwidth = g.peak_bandwidth();
+    }
+
+    if(this->m_bench_roofline.peak_gflops <= 0.0)
+    {
+        this->m_bench_roofline.peak_gflops = g.peak_gflops();
+    }
+}
+
 rocsparse_status rocsparse_bench_app_base::run_case(int isample, int irun, int argc, char** argv)
 {
     rocsparse_bench bench(argc, argv);
@@ -87,7 +118,28 @@ rocsparse_status rocsparse_bench_app_base::run_cases()
                 std::cerr << "run_cases::run_case failed at line " << __LINE__ << std::endl;
                 return status;
             }
-            if(is_stdout_disabled())
+
+            //
+            // The device is set by the case.
+            //
+            if(isample == 0 && irun == 0)
+            {
+                this->detect_roofline();
+            }
+
+            if(!is_stdout_disabled())
+            {
+                const double gflops = this->m_bench_timing[isample].gflops[irun];
+                const double gbs    = this->m_bench_timing[isample].gbs[irun];
+                printf("// roofline: intensity %.3f flop/byte, %.2f%% of the %s roofline "
+                       "(peaks %.2f GB/s, %.2f GFlop/s)\n",
+                       rocsparse_bench_roofline_t::intensity(gflops, gbs),
+                       this->m_bench_roofline.efficiency(gflops, gbs),
+                       this->m_bench_roofline.bound(gflops, gbs),
+                       this->m_bench_roofline.peak_bandwidth,
+                       this->m_bench_roofline.peak_gflops);
+            }
+            else
             {
                 if((isample * nruns + irun) % 10 == 0)
                 {
@@ -156,6 +208,17 @@ void rocsparse_bench_app::export_item(std::ostream& out, rocsparse_bench_timing_
     if(N > 1)
     {
         const double alpha = 0.95;
+
+        //
+        // Efficiency of each run, before the results are sorted independently.
+        //
+        std::vector<double> efficiency(N);
+        for(int i = 0; i < N; ++i)
+        {
+            efficiency[i] = this->m_bench_roofline.efficiency(item.gflops[i], item.gbs[i]);
+        }
+        std::sort(efficiency.begin(), efficiency.end());
+
         std::sort(item.msec.begin(), item.msec.end());
         std::sort(item.gflops.begin(), item.gflops.end());
         std::sort(item.gbs.begin(), item.gbs.end());
@@ -164,12 +227,15 @@ void rocsparse_bench_app::export_item(std::ostream& out, rocsparse_bench_timing_
         double gflops = (N % 2 == 0) ? (item.gflops[N / 2 - 1] + item.gflops[N / 2]) * 0.5
                                      : item.gflops[N / 2];
         double gbs = (N % 2 == 0) ? (item.gbs[N / 2 - 1] + item.gbs[N / 2]) * 0.5 : item.gbs[N / 2];
+        double eff = (N % 2 == 0) ? (efficiency[N / 2 - 1] + efficiency[N / 2]) * 0.5
+                                  : efficiency[N / 2];
 
-        double interval_msec[2], interval_gflops[2], interval_gbs[2];
+        double interval_msec[2], interval_gflops[2], interval_gbs[2], interval_eff[2];
         int    nboots = 200;
         confidence_interval(alpha, 10, nboots, item.msec, interval_msec);
         confidence_interval(alpha, 10, nboots, item.gflops, interval_gflops);
         confidence_interval(alpha, 10, nboots, item.gbs, interval_gbs);
+        confidence_interval(alpha, 10, nboots, efficiency, interval_eff);
 
         out << std::endl
             << "    \"time\": [\"" << msec << "\", \"" << interval_msec[0] << "\", \""
@@ -177,7 +243,12 @@ void rocsparse_bench_app::export_item(std::ostream& out, rocsparse_bench_timing_
         out << "    \"flops\": [\"" << gflops << "\", \"" << interval_gflops[0] << "\", \""
             << interval_gflops[1] << "\"]," << std::endl;
         out << "    \"bandwidth\": [\"" << gbs << "\", \"" << interval_gbs[0] << "\", \""
-            << interval_gbs[1] << "\"]";
+            << interval_gbs[1] << "\"]," << std::endl;
+        out << "    \"intensity\": \"" << rocsparse_bench_roofline_t::intensity(gflops, gbs)
+            << "\"," << std::endl;
+        out << "    \"roofline\": [\"" << eff << "\", \"" << interval_eff[0] << "\", \""
+            << interval_eff[1] << "\"]," << std::endl;
+        out << "    \"bound\": \"" << this->m_bench_roofline.bound(gflops, gbs) << "\"";
 
         if(!no_rawdata())
         {
@@ -195,7 +266,16 @@ void rocsparse_bench_app::export_item(std::ostream& out, rocsparse_bench_timing_
         out << "\"flops\": [\"" << item.gflops[0] << "\", \"" << item.gflops[0] << "\", \""
             << item.gflops[0] << "\"]," << std::endl;
         out << "\"bandwidth\": [\"" << item.gbs[0] << "\", \"" << item.gbs[0] << "\", \""
-            << item.gbs[0] << "\"]";
+            << item.gbs[0] << "\"]," << std::endl;
+
+        const double intensity
+            = rocsparse_bench_roofline_t::intensity(item.gflops[0], item.gbs[0]);
+        const double eff = this->m_bench_roofline.efficiency(item.gflops[0], item.gbs[0]);
+        out << "\"intensity\": \"" << intensity << "\"," << std::endl;
+        out << "\"roofline\": [\"" << eff << "\", \"" << eff << "\", \"" << eff << "\"],"
+            << std::endl;
+        out << "\"bound\": \"" << this->m_bench_roofline.bound(item.gflops[0], item.gbs[0])
+            << "\"";
         if(!no_rawdata())
         {
             out << ",";
@@ -324,6 +404,13 @@ rocsparse_status rocsparse_bench_app::define_results_json(std::ostream& out)
     gpu_config g(prop);
     g.print_json(out);
 
+    out << std::endl
+        << "\"roofline\": {" << std::endl
+        << "  \"peak bandwidth\"     : \"" << this->m_bench_roofline.peak_bandwidth << "\","
+        << std::endl
+        << "  \"peak flops\"         : \"" << this->m_bench_roofline.peak_gflops << "\"},"
+        << std::endl;
+
     out << std::endl << "\"cmdline\": \"" << this->m_initial_argv[0];
 
     for(int i = 1; i < this->m_initial_argc; ++i)
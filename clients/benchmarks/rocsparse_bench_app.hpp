@@ -105,6 +105,52 @@ public:
     }
 };
 
+//
+// Struct placing a measured performance on the roofline of the device.
+//
+struct rocsparse_bench_roofline_t
+{
+    double peak_bandwidth{}; // GB/s
+    double peak_gflops{}; // GFlop/s
+
+    //
+    // @brief Arithmetic intensity in flop/byte.
+    //
+    static double intensity(double gflops, double gbs)
+    {
+        return (gbs > 0.0) ? gflops / gbs : 0.0;
+    }
+
+    //
+    // @brief Is the performance bounded by the memory bandwidth rather than the compute?
+    //
+    bool is_memory_bound(double gflops, double gbs) const
+    {
+        return intensity(gflops, gbs) * this->peak_bandwidth < this->peak_gflops;
+    }
+
+    const char* bound(double gflops, double gbs) const
+    {
+        return this->is_memory_bound(gflops, gbs) ? "memory" : "compute";
+    }
+
+    //
+    // @brief Attained percentage of the roofline, i.e. of the peak bandwidth if memory bound,
+    // of the peak compute otherwise.
+    //
+    double efficiency(double gflops, double gbs) const
+    {
+        if(this->is_memory_bound(gflops, gbs))
+        {
+            return (this->peak_bandwidth > 0.0) ? 100.0 * gbs / this->peak_bandwidth : 0.0;
+        }
+        else
+        {
+            return (this->peak_gflops > 0.0) ? 100.0 * gflops / this->peak_gflops : 0.0;
+        }
+    }
+};
+
 //
 // Struct collecting benchmark timing results.
 //
@@ -216,6 +262,10 @@ protected:
     //
     //
     rocsparse_bench_timing_t m_bench_timing;
+    //
+    // Peaks of the device, from the command line or detected.
+    //
+    rocsparse_bench_roofline_t m_bench_roofline;
 
     bool m_stdout_disabled{true};
 
@@ -238,6 +288,11 @@ protected:
     //
     rocsparse_status run_case(int isample, int irun, int argc, char** argv);
 
+    //
+    // @brief Detect the peaks of the current device that are not given on the command line.
+    //
+    void detect_roofline();
+
     //
     // For internal use, to get the current isample and irun.
     //
@@ -48,6 +48,14 @@ bool rocsparse_bench_cmdlines::no_rawdata() const
 {
     return this->m_cmd.no_rawdata();
 };
+double rocsparse_bench_cmdlines::get_peak_bandwidth() const
+{
+    return this->m_cmd.get_peak_bandwidth();
+};
+double rocsparse_bench_cmdlines::get_peak_gflops() const
+{
+    return this->m_cmd.get_peak_gflops();
+};
 
 //
 // @brief Get the number of runs per sample.
@@ -97,6 +97,8 @@
 // option: --bench-o, output filename.
 // option: --bench-n, number of runs.
 // option: --bench-std, prevent from standard output to be disabled.
+// option: --bench-peak-bandwidth, peak memory bandwidth of the device in GB/s.
+// option: --bench-peak-gflops, peak compute throughput of the device in GFlop/s.
 //
 
 class rocsparse_bench_cmdlines
@@ -205,6 +207,16 @@ private:
             return this->m_no_rawdata;
         }
 
+        double get_peak_bandwidth() const
+        {
+            return this->m_peak_bandwidth;
+        }
+
+        double get_peak_gflops() const
+        {
+            return this->m_peak_gflops;
+        }
+
         //
         // Constructor.
         //
@@ -300,6 +312,16 @@ private:
                 exit(1);
             }
 
+            //
+            // Try to get the options --bench-peak-bandwidth and --bench-peak-gflops.
+            //
+            if(detect_option(argc, argv, "--bench-peak-bandwidth", this->m_peak_bandwidth) == -1
+               || detect_option(argc, argv, "--bench-peak-gflops", this->m_peak_gflops) == -1)
+            {
+                std::cerr << "missing parameter ?" << std::endl;
+                exit(1);
+            }
+
             //
             // Try to get the option --bench-x.
             //
@@ -353,6 +375,11 @@ private:
                     {
                         iarg += 2;
                     }
+                    else if(!strcmp(argv[iarg], "--bench-peak-bandwidth")
+                            || !strcmp(argv[iarg], "--bench-peak-gflops"))
+                    {
+                        iarg += 2;
+                    }
                     else
                     {
                         //
@@ -551,7 +578,7 @@ private:
                     }
                     else
                     {
-                        std::cerr << "missing value for option --bench-n " << std::endl;
+                        std::cerr << "missing value for option " << option_name << std::endl;
                         return -1;
                     }
                 }
@@ -629,6 +656,8 @@ private:
         bool                     m_is_stdout_disabled{true};
         bool                     m_no_rawdata{};
         const char*              m_ofilename{};
+        double                   m_peak_bandwidth{};
+        double                   m_peak_gflops{};
     };
 
 private:
@@ -699,6 +728,27 @@ public:
             << std::endl;
         out << "--bench-no-rawdata                                do not export raw data."
             << std::endl;
+        out << "--bench-peak-bandwidth                            peak memory bandwidth of the "
+               "device in GB/s, (default = detected)"
+            << std::endl;
+        out << "--bench-peak-gflops                               peak compute throughput of the "
+               "device in GFlop/s, (default = detected)"
+            << std::endl;
+        out << "" << std::endl;
+        out << "Throughput options:" << std::endl;
+        out << "--bench-throughput                                issue csrmv or csrsv "
+               "concurrently and report calls/s and latency percentiles"
+            << std::endl;
+        out << "--bench-threads                                   number of host threads, (default "
+               "= 1)"
+            << std::endl;
+        out << "--bench-streams                                   number of streams, each with its "
+               "own handle, per thread, (default = 1)"
+            << std::endl;
+        out << "--bench-duration                                  duration in seconds, (default = "
+               "1)"
+            << std::endl;
+        out << "--bench-throughput-o                              output JSON file" << std::endl;
         out << "" << std::endl;
         out << "Example:" << std::endl;
         out << "rocsparse-bench -f csrmv --bench-x -M 10 20 30 40" << std::endl;
@@ -722,6 +772,12 @@ public:
     bool        is_stdout_disabled() const;
     bool        no_rawdata() const;
 
+    //
+    // @brief Get the peak bandwidth (GB/s) and compute (GFlop/s) of the device, 0 if not given.
+    //
+    double get_peak_bandwidth() const;
+    double get_peak_gflops() const;
+
     //
     // @brief Get the number of runs per sample.
     //
@@ -0,0 +1,259 @@
+/*! \file */
+/* ************************************************************************
+* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+#include "rocsparse_bench_replay.hpp"
+#include "rocsparse_bench.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <string.h>
+
+rocsparse_bench_replay* rocsparse_bench_replay::s_instance = nullptr;
+
+bool rocsparse_bench_replay::applies(int argc, char** argv)
+{
+    for(int i = 1; i < argc; ++i)
+    {
+        if(!strcmp(argv[i], "--bench-replay"))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+rocsparse_bench_replay::rocsparse_bench_replay(int argc, char** argv)
+{
+    for(int i = 1; i < argc; ++i)
+    {
+        if(!strcmp(argv[i], "--bench-replay") && (i + 1 < argc))
+        {
+            this->m_ifilename = argv[++i];
+        }
+        else if(!strcmp(argv[i], "--bench-replay-o") && (i + 1 < argc))
+        {
+            this->m_ofilename = argv[++i];
+        }
+        else
+        {
+            std::cerr << "rocsparse_bench_replay: unexpected argument '" << argv[i] << "'"
+                      << std::endl;
+            throw rocsparse_status_invalid_value;
+        }
+    }
+
+    if(this->m_ifilename.empty())
+    {
+        std::cerr << "rocsparse_bench_replay: missing log filename" << std::endl;
+        throw rocsparse_status_invalid_value;
+    }
+}
+
+//
+// Extract the arguments following the rocsparse-bench executable of each line and
+// gather identical calls.
+//
+rocsparse_status rocsparse_bench_replay::load()
+{
+    std::ifstream in(this->m_ifilename);
+    if(!in.is_open())
+    {
+        std::cerr << "rocsparse_bench_replay: cannot open '" << this->m_ifilename << "'"
+                  << std::endl;
+        return rocsparse_status_invalid_value;
+    }
+
+    std::vector<rocsparse_bench_log_call> calls;
+    rocsparse_status status = rocsparse_bench_log_parse(in, calls, this->m_nlines);
+    if(status != rocsparse_status_success)
+    {
+        std::cerr << "rocsparse_bench_replay: cannot parse '" << this->m_ifilename << "'"
+                  << std::endl;
+        return status;
+    }
+
+    this->m_calls.resize(calls.size());
+    for(size_t i = 0; i < calls.size(); ++i)
+    {
+        static_cast<rocsparse_bench_log_call&>(this->m_calls[i]) = calls[i];
+    }
+
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse_bench_replay::run()
+{
+    rocsparse_status status = this->load();
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+
+    std::cout << "// replaying " << this->m_calls.size() << " unique calls out of "
+              << this->m_nlines << " recorded calls" << std::endl;
+
+    for(this->m_icall = 0; this->m_icall < this->m_calls.size(); ++this->m_icall)
+    {
+        call_t& call = this->m_calls[this->m_icall];
+
+        //
+        // Build a mutable command line, the parser might modify it.
+        //
+        std::vector<std::string> args(call.args);
+        std::vector<char*>       argv;
+        std::string              exe("rocsparse-bench");
+        argv.push_back(&exe[0]);
+        for(auto& a : args)
+        {
+            argv.push_back(&a[0]);
+        }
+
+        int    argc  = argv.size();
+        char** pargv = argv.data();
+
+        rocsparse_bench bench(argc, pargv);
+        status = bench.run();
+        if(status != rocsparse_status_success)
+        {
+            std::cerr << "rocsparse_bench_replay: call " << this->m_icall << " (" << call.routine
+                      << ") failed" << std::endl;
+            return status;
+        }
+    }
+
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse_bench_replay::record_timing(double msec, double gflops, double gbs)
+{
+    if(this->m_icall >= this->m_calls.size())
+    {
+        return rocsparse_status_internal_error;
+    }
+
+    call_t& call = this->m_calls[this->m_icall];
+    call.msec    = msec;
+    call.gflops  = gflops;
+    call.gbs     = gbs;
+    return rocsparse_status_success;
+}
+
+std::vector<rocsparse_bench_replay::routine_t> rocsparse_bench_replay::projection() const
+{
+    std::map<std::string, routine_t> routines;
+    for(const auto& call : this->m_calls)
+    {
+        routine_t& r = routines[call.routine];
+        r.routine    = call.routine;
+        r.count += call.count;
+        r.ncalls += 1;
+        r.msec += call.count * call.msec;
+    }
+
+    std::vector<routine_t> result;
+    for(const auto& it : routines)
+    {
+        result.push_back(it.second);
+    }
+
+    std::sort(result.begin(), result.end(), [](const routine_t& a, const routine_t& b) {
+        return a.msec > b.msec;
+    });
+    return result;
+}
+
+rocsparse_status rocsparse_bench_replay::report(std::ostream& out) const
+{
+    const std::vector<routine_t> routines = this->projection();
+
+    double total = 0.0;
+    for(const auto& r : routines)
+    {
+        total += r.msec;
+    }
+
+    out << std::endl
+        << std::setw(24) << std::left << "routine" << std::right << std::setw(12) << "calls"
+        << std::setw(12) << "unique" << std::setw(16) << "msec" << std::setw(10) << "%"
+        << std::endl;
+    for(const auto& r : routines)
+    {
+        out << std::setw(24) << std::left << r.routine << std::right << std::setw(12) << r.count
+            << std::setw(12) << r.ncalls << std::setw(16) << r.msec << std::setw(10)
+            << ((total > 0.0) ? 100.0 * r.msec / total : 0.0) << std::endl;
+    }
+    out << std::setw(24) << std::left << "total" << std::right << std::setw(12) << this->m_nlines
+        << std::setw(12) << this->m_calls.size() << std::setw(16) << total << std::endl;
+
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse_bench_replay::export_file() const
+{
+    if(this->m_ofilename.empty())
+    {
+        return rocsparse_status_success;
+    }
+
+    std::ofstream out(this->m_ofilename);
+    if(!out.is_open())
+    {
+        std::cerr << "rocsparse_bench_replay: cannot open '" << this->m_ofilename << "'"
+                  << std::endl;
+        return rocsparse_status_invalid_value;
+    }
+
+    out << "{" << std::endl;
+    out << "\"rocSPARSE version\": \"" << rocsparse_get_version() << "\"," << std::endl;
+    out << "\"log\": \"" << this->m_ifilename << "\"," << std::endl;
+    out << "\"calls\": [";
+    for(size_t i = 0; i < this->m_calls.size(); ++i)
+    {
+        const call_t& call = this->m_calls[i];
+        out << ((i > 0) ? "," : "") << std::endl << "{ \"cmdline\": \"";
+        for(size_t j = 0; j < call.args.size(); ++j)
+        {
+            out << ((j > 0) ? " " : "") << call.args[j];
+        }
+        out << "\", \"routine\": \"" << call.routine << "\", \"count\": " << call.count
+            << ", \"time\": " << call.msec << ", \"flops\": " << call.gflops
+            << ", \"bandwidth\": " << call.gbs << " }";
+    }
+    out << std::endl << "]," << std::endl;
+
+    const std::vector<routine_t> routines = this->projection();
+    out << "\"routines\": [";
+    for(size_t i = 0; i < routines.size(); ++i)
+    {
+        const routine_t& r = routines[i];
+        out << ((i > 0) ? "," : "") << std::endl
+            << "{ \"routine\": \"" << r.routine << "\", \"count\": " << r.count
+            << ", \"unique\": " << r.ncalls << ", \"time\": " << r.msec << " }";
+    }
+    out << std::endl << "]" << std::endl;
+    out << "}" << std::endl;
+    return rocsparse_status_success;
+}
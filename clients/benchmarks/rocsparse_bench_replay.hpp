@@ -0,0 +1,112 @@
+/*! \file */
+/* ************************************************************************
+* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+#pragma once
+
+#include "rocsparse-types.h"
+#include "rocsparse_bench_log.hpp"
+#include <iostream>
+#include <string>
+#include <vector>
+
+//
+// Replay of a captured bench log.
+//
+// Each line of the log holding a rocsparse-bench command line is a recorded call.
+// Identical calls are run once and weighted by their number of occurrences, such
+// that the projected time per routine reflects the recorded workload.
+//
+// Usage: rocsparse-bench --bench-replay <logfile> [--bench-replay-o <report.json>]
+//
+class rocsparse_bench_replay
+{
+private:
+    static rocsparse_bench_replay* s_instance;
+
+    //
+    // Unique call of the log and its timing.
+    //
+    struct call_t : rocsparse_bench_log_call
+    {
+        double msec{};
+        double gflops{};
+        double gbs{};
+    };
+
+    //
+    // Projected time of a routine.
+    //
+    struct routine_t
+    {
+        std::string routine{};
+        int64_t     count{};
+        int64_t     ncalls{};
+        double      msec{};
+    };
+
+    std::string         m_ifilename{};
+    std::string         m_ofilename{};
+    std::vector<call_t> m_calls{};
+    int64_t             m_nlines{};
+    size_t              m_icall{};
+
+    rocsparse_bench_replay(int argc, char** argv);
+
+    rocsparse_status       load();
+    std::vector<routine_t> projection() const;
+
+public:
+    static bool applies(int argc, char** argv);
+
+    static rocsparse_bench_replay* instance(int argc, char** argv)
+    {
+        s_instance = new rocsparse_bench_replay(argc, argv);
+        return s_instance;
+    }
+
+    static rocsparse_bench_replay* instance()
+    {
+        return s_instance;
+    }
+
+    rocsparse_bench_replay(const rocsparse_bench_replay&) = delete;
+    rocsparse_bench_replay& operator=(const rocsparse_bench_replay&) = delete;
+
+    //
+    // @brief Run the unique calls of the log.
+    //
+    rocsparse_status run();
+
+    //
+    // @brief Report the projected time per routine.
+    //
+    rocsparse_status report(std::ostream& out) const;
+
+    //
+    // @brief Export the calls and the projected time per routine.
+    //
+    rocsparse_status export_file() const;
+
+    rocsparse_status record_timing(double msec, double gflops, double gbs);
+};
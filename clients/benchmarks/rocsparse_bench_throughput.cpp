@@ -0,0 +1,580 @@
+/*! \file */
+/* ************************************************************************
+* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+#include "rocsparse_bench_throughput.hpp"
+#include "rocsparse_bench.hpp"
+#include "testing.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <string.h>
+#include <thread>
+
+rocsparse_bench_throughput* rocsparse_bench_throughput::s_instance = nullptr;
+
+namespace
+{
+    //
+    // A handle bound to its own stream, issuing the routine on its own output.
+    //
+    template <typename T>
+    class throughput_lane
+    {
+    private:
+        const rocsparse_arguments_config& m_arg;
+        const device_csr_matrix<T>&       m_A;
+        const device_dense_matrix<T>&     m_x;
+        device_dense_matrix<T>            m_y;
+        T                                 m_alpha{};
+        T                                 m_beta{};
+        bool                              m_csrsv{};
+
+        rocsparse_handle    m_handle{};
+        hipStream_t         m_stream{};
+        hipEvent_t          m_event{};
+        rocsparse_mat_descr m_descr{};
+        rocsparse_mat_info  m_info{};
+        void*               m_buffer{};
+
+    public:
+        throughput_lane(const rocsparse_arguments_config& arg,
+                        const device_csr_matrix<T>&       A,
+                        const device_dense_matrix<T>&     x,
+                        const host_dense_matrix<T>&       y)
+            : m_arg(arg)
+            , m_A(A)
+            , m_x(x)
+            , m_y(y)
+            , m_alpha(arg.get_alpha<T>())
+            , m_beta(arg.get_beta<T>())
+            , m_csrsv(arg.function_name == "csrsv")
+        {
+            CHECK_ROCSPARSE_THROW_ERROR(rocsparse_create_handle(&this->m_handle));
+            CHECK_HIP_THROW_ERROR(hipStreamCreateWithFlags(&this->m_stream, hipStreamNonBlocking));
+            CHECK_HIP_THROW_ERROR(hipEventCreateWithFlags(&this->m_event, hipEventDisableTiming));
+            CHECK_ROCSPARSE_THROW_ERROR(rocsparse_set_stream(this->m_handle, this->m_stream));
+            CHECK_ROCSPARSE_THROW_ERROR(
+                rocsparse_set_pointer_mode(this->m_handle, rocsparse_pointer_mode_host));
+
+            CHECK_ROCSPARSE_THROW_ERROR(rocsparse_create_mat_descr(&this->m_descr));
+            CHECK_ROCSPARSE_THROW_ERROR(rocsparse_create_mat_info(&this->m_info));
+            CHECK_ROCSPARSE_THROW_ERROR(rocsparse_set_mat_index_base(this->m_descr, arg.baseA));
+            CHECK_ROCSPARSE_THROW_ERROR(rocsparse_set_mat_fill_mode(this->m_descr, arg.uplo));
+
+            if(this->m_csrsv)
+            {
+                CHECK_ROCSPARSE_THROW_ERROR(rocsparse_set_mat_diag_type(this->m_descr, arg.diag));
+
+                size_t buffer_size;
+                CHECK_ROCSPARSE_THROW_ERROR(rocsparse_csrsv_buffer_size<T>(this->m_handle,
+                                                                           arg.transA,
+                                                                           A.m,
+                                                                           A.nnz,
+                                                                           this->m_descr,
+                                                                           A.val,
+                                                                           A.ptr,
+                                                                           A.ind,
+                                                                           this->m_info,
+                                                                           &buffer_size));
+                CHECK_HIP_THROW_ERROR(rocsparse_hipMalloc(&this->m_buffer, buffer_size));
+                CHECK_ROCSPARSE_THROW_ERROR(rocsparse_csrsv_analysis<T>(this->m_handle,
+                                                                        arg.transA,
+                                                                        A.m,
+                                                                        A.nnz,
+                                                                        this->m_descr,
+                                                                        A.val,
+                                                                        A.ptr,
+                                                                        A.ind,
+                                                                        this->m_info,
+                                                                        arg.apol,
+                                                                        arg.spol,
+                                                                        this->m_buffer));
+            }
+            else
+            {
+                CHECK_ROCSPARSE_THROW_ERROR(rocsparse_set_mat_type(this->m_descr, arg.matrix_type));
+                if(arg.spmv_alg == rocsparse_spmv_alg_csr_adaptive)
+                {
+                    CHECK_ROCSPARSE_THROW_ERROR(rocsparse_csrmv_analysis<T>(this->m_handle,
+                                                                            arg.transA,
+                                                                            A.m,
+                                                                            A.n,
+                                                                            A.nnz,
+                                                                            this->m_descr,
+                                                                            A.val,
+                                                                            A.ptr,
+                                                                            A.ind,
+                                                                            this->m_info));
+                }
+            }
+
+            //
+            // Warm up.
+            //
+            CHECK_ROCSPARSE_THROW_ERROR(this->issue());
+            CHECK_HIP_THROW_ERROR(hipEventSynchronize(this->m_event));
+        }
+
+        ~throughput_lane()
+        {
+            if(this->m_csrsv)
+            {
+                rocsparse_csrsv_clear(this->m_handle, this->m_descr, this->m_info);
+            }
+            else if(this->m_arg.spmv_alg == rocsparse_spmv_alg_csr_adaptive)
+            {
+                rocsparse_csrmv_clear(this->m_handle, this->m_info);
+            }
+
+            rocsparse_hipFree(this->m_buffer);
+            rocsparse_destroy_mat_info(this->m_info);
+            rocsparse_destroy_mat_descr(this->m_descr);
+            rocsparse_destroy_handle(this->m_handle);
+            hipEventDestroy(this->m_event);
+            hipStreamDestroy(this->m_stream);
+        }
+
+        throughput_lane(const throughput_lane&) = delete;
+        throughput_lane& operator=(const throughput_lane&) = delete;
+
+        //
+        // @brief Issue the routine and record the completion event on the stream.
+        //
+        rocsparse_status issue()
+        {
+            rocsparse_status status;
+            if(this->m_csrsv)
+            {
+                status = rocsparse_csrsv_solve<T>(this->m_handle,
+                                                  this->m_arg.transA,
+                                                  this->m_A.m,
+                                                  this->m_A.nnz,
+                                                  &this->m_alpha,
+                                                  this->m_descr,
+                                                  this->m_A.val,
+                                                  this->m_A.ptr,
+                                                  this->m_A.ind,
+                                                  this->m_info,
+                                                  this->m_x,
+                                                  this->m_y,
+                                                  this->m_arg.spol,
+                                                  this->m_buffer);
+            }
+            else
+            {
+                status = rocsparse_csrmv<T>(
+                    this->m_handle,
+                    this->m_arg.transA,
+                    this->m_A.m,
+                    this->m_A.n,
+                    this->m_A.nnz,
+                    &this->m_alpha,
+                    this->m_descr,
+                    this->m_A.val,
+                    this->m_A.ptr,
+                    this->m_A.ind,
+                    (this->m_arg.spmv_alg == rocsparse_spmv_alg_csr_adaptive) ? this->m_info
+                                                                              : nullptr,
+                    this->m_x,
+                    &this->m_beta,
+                    this->m_y);
+            }
+
+            if(status != rocsparse_status_success)
+            {
+                return status;
+            }
+
+            return (hipEventRecord(this->m_event, this->m_stream) == hipSuccess)
+                       ? rocsparse_status_success
+                       : rocsparse_status_internal_error;
+        }
+
+        //
+        // @brief Query the completion of the last call issued, without blocking.
+        //
+        rocsparse_status query(bool* completed)
+        {
+            const hipError_t error = hipEventQuery(this->m_event);
+            *completed             = (error == hipSuccess);
+            return (error == hipSuccess || error == hipErrorNotReady)
+                       ? rocsparse_status_success
+                       : rocsparse_status_internal_error;
+        }
+    };
+}
+
+bool rocsparse_bench_throughput::applies(int argc, char** argv)
+{
+    for(int i = 1; i < argc; ++i)
+    {
+        if(!strcmp(argv[i], "--bench-throughput"))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+rocsparse_bench_throughput::rocsparse_bench_throughput(int argc, char** argv)
+{
+    for(int i = 1; i < argc; ++i)
+    {
+        if(!strcmp(argv[i], "--bench-throughput"))
+        {
+            continue;
+        }
+        else if(!strcmp(argv[i], "--bench-threads") && (i + 1 < argc))
+        {
+            this->m_nthreads = atoi(argv[++i]);
+        }
+        else if(!strcmp(argv[i], "--bench-streams") && (i + 1 < argc))
+        {
+            this->m_nstreams = atoi(argv[++i]);
+        }
+        else if(!strcmp(argv[i], "--bench-duration") && (i + 1 < argc))
+        {
+            this->m_duration = atof(argv[++i]);
+        }
+        else if(!strcmp(argv[i], "--bench-throughput-o") && (i + 1 < argc))
+        {
+            this->m_ofilename = argv[++i];
+        }
+        else
+        {
+            //
+            // Options of the routine.
+            //
+            this->m_args.push_back(argv[i]);
+        }
+    }
+
+    if(this->m_nthreads <= 0 || this->m_nstreams <= 0 || this->m_duration <= 0.0)
+    {
+        std::cerr << "rocsparse_bench_throughput: the number of threads, the number of streams "
+                     "and the duration must be positive"
+                  << std::endl;
+        throw rocsparse_status_invalid_value;
+    }
+}
+
+rocsparse_status rocsparse_bench_throughput::run()
+{
+    //
+    // Build a mutable command line, the parser might modify it.
+    //
+    std::vector<std::string> args(this->m_args);
+    std::vector<char*>       argv;
+    std::string              exe("rocsparse-bench");
+    argv.push_back(&exe[0]);
+    for(auto& a : args)
+    {
+        argv.push_back(&a[0]);
+    }
+
+    int    argc  = argv.size();
+    char** pargv = argv.data();
+
+    rocsparse_bench                   bench(argc, pargv);
+    const rocsparse_arguments_config& config = bench.get_config();
+
+    this->m_routine = config.function_name;
+    if(this->m_routine != "csrmv" && this->m_routine != "csrsv")
+    {
+        std::cerr << "rocsparse_bench_throughput: routine '" << this->m_routine
+                  << "' is not supported, supported routines are csrmv and csrsv" << std::endl;
+        return rocsparse_status_not_implemented;
+    }
+
+    if(config.indextype != 's')
+    {
+        std::cerr << "rocsparse_bench_throughput: only 32 bit indices are supported" << std::endl;
+        return rocsparse_status_not_implemented;
+    }
+
+    try
+    {
+        switch(config.precision)
+        {
+        case 's':
+        {
+            return this->run_template<float>(config);
+        }
+        case 'd':
+        {
+            return this->run_template<double>(config);
+        }
+        case 'c':
+        {
+            return this->run_template<rocsparse_float_complex>(config);
+        }
+        case 'z':
+        {
+            return this->run_template<rocsparse_double_complex>(config);
+        }
+        }
+    }
+    catch(const hipError_t& error)
+    {
+        std::cerr << "rocsparse_bench_throughput: " << hipGetErrorString(error) << std::endl;
+        return rocsparse_status_internal_error;
+    }
+
+    std::cerr << "rocsparse_bench_throughput: unknown precision '" << config.precision << "'"
+              << std::endl;
+    return rocsparse_status_invalid_value;
+}
+
+template <typename T>
+rocsparse_status rocsparse_bench_throughput::run_template(const rocsparse_arguments_config& config)
+{
+    typedef std::chrono::steady_clock clock;
+
+    const bool    csrsv = (this->m_routine == "csrsv");
+    rocsparse_int M     = config.M;
+    rocsparse_int N     = config.N;
+
+    //
+    // The matrix and the input vector are shared by all the handles.
+    //
+    host_csr_matrix<T> hA;
+    {
+        static constexpr bool       to_int = false;
+        rocsparse_matrix_factory<T> matrix_factory(config, to_int, csrsv);
+        matrix_factory.init_csr(hA, M, N);
+    }
+
+    if(csrsv && M != N)
+    {
+        std::cerr << "rocsparse_bench_throughput: csrsv requires a square matrix" << std::endl;
+        return rocsparse_status_invalid_size;
+    }
+
+    const bool           transposed = (config.transA != rocsparse_operation_none);
+    host_dense_matrix<T> hx(transposed ? M : N, 1);
+    host_dense_matrix<T> hy(transposed ? N : M, 1);
+    rocsparse_matrix_utils::init(hx);
+    rocsparse_matrix_utils::init(hy);
+
+    device_csr_matrix<T>   dA(hA);
+    device_dense_matrix<T> dx(hx);
+
+    const int nthreads = this->m_nthreads;
+    const int nstreams = this->m_nstreams;
+
+    std::vector<std::unique_ptr<throughput_lane<T>>> lanes(nthreads * nstreams);
+    for(auto& lane : lanes)
+    {
+        lane.reset(new throughput_lane<T>(config, dA, dx, hy));
+    }
+
+    //
+    // Devices are selected per thread.
+    //
+    int device_id;
+    CHECK_HIP_THROW_ERROR(hipGetDevice(&device_id));
+
+    std::atomic<bool>                start{false};
+    std::atomic<int>                 nfailures{0};
+    clock::time_point                deadline;
+    std::vector<std::vector<double>> latencies(nthreads);
+    std::vector<std::thread>         threads;
+
+    for(int t = 0; t < nthreads; ++t)
+    {
+        threads.emplace_back([&, t]() {
+            if(hipSetDevice(device_id) != hipSuccess)
+            {
+                ++nfailures;
+                return;
+            }
+
+            std::vector<clock::time_point> issued(nstreams);
+            std::vector<bool>              pending(nstreams);
+            std::vector<double>&           latency = latencies[t];
+
+            while(!start.load())
+            {
+                std::this_thread::yield();
+            }
+
+            while(clock::now() < deadline && nfailures.load() == 0)
+            {
+                for(int s = 0; s < nstreams; ++s)
+                {
+                    issued[s] = clock::now();
+                    if(lanes[t * nstreams + s]->issue() != rocsparse_status_success)
+                    {
+                        ++nfailures;
+                        return;
+                    }
+                }
+
+                //
+                // Poll all the lanes, such that the latency of a lane ends when it completes
+                // and not once the lanes issued before it have completed.
+                //
+                std::fill(pending.begin(), pending.end(), true);
+                int npending = nstreams;
+                while(npending > 0)
+                {
+                    bool any_completed = false;
+                    for(int s = 0; s < nstreams; ++s)
+                    {
+                        if(pending[s] == false)
+                        {
+                            continue;
+                        }
+
+                        bool completed;
+                        if(lanes[t * nstreams + s]->query(&completed) != rocsparse_status_success)
+                        {
+                            ++nfailures;
+                            return;
+                        }
+
+                        if(completed)
+                        {
+                            latency.push_back(
+                                std::chrono::duration<double, std::micro>(clock::now() - issued[s])
+                                    .count());
+                            pending[s]    = false;
+                            any_completed = true;
+                            --npending;
+                        }
+                    }
+
+                    if(any_completed == false)
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+        });
+    }
+
+    const clock::time_point begin = clock::now();
+    deadline                      = begin
+                                   + std::chrono::duration_cast<clock::duration>(
+                                       std::chrono::duration<double>(this->m_duration));
+    start.store(true);
+
+    for(auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    this->m_elapsed = std::chrono::duration<double>(clock::now() - begin).count();
+
+    if(nfailures.load() > 0)
+    {
+        std::cerr << "rocsparse_bench_throughput: " << nfailures.load() << " threads failed"
+                  << std::endl;
+        return rocsparse_status_internal_error;
+    }
+
+    this->m_latencies.clear();
+    for(const auto& latency : latencies)
+    {
+        this->m_latencies.insert(this->m_latencies.end(), latency.begin(), latency.end());
+    }
+    std::sort(this->m_latencies.begin(), this->m_latencies.end());
+
+    return rocsparse_status_success;
+}
+
+double rocsparse_bench_throughput::percentile(double p) const
+{
+    if(this->m_latencies.empty())
+    {
+        return 0.0;
+    }
+
+    const size_t n = this->m_latencies.size();
+    const size_t i = static_cast<size_t>(std::ceil(p / 100.0 * n));
+    return this->m_latencies[std::min(std::max(i, static_cast<size_t>(1)), n) - 1];
+}
+
+rocsparse_status rocsparse_bench_throughput::report(std::ostream& out) const
+{
+    const size_t ncalls = this->m_latencies.size();
+    const double rate   = (this->m_elapsed > 0.0) ? ncalls / this->m_elapsed : 0.0;
+
+    out << std::endl
+        << std::setw(12) << std::left << "routine" << std::right << std::setw(10) << "threads"
+        << std::setw(10) << "streams" << std::setw(12) << "calls" << std::setw(14) << "calls/s"
+        << std::setw(12) << "p50 usec" << std::setw(12) << "p90 usec" << std::setw(12)
+        << "p99 usec" << std::setw(12) << "max usec" << std::endl;
+    out << std::setw(12) << std::left << this->m_routine << std::right << std::setw(10)
+        << this->m_nthreads << std::setw(10) << this->m_nstreams << std::setw(12) << ncalls
+        << std::setw(14) << rate << std::setw(12) << this->percentile(50.0) << std::setw(12)
+        << this->percentile(90.0) << std::setw(12) << this->percentile(99.0) << std::setw(12)
+        << this->percentile(100.0) << std::endl;
+
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse_bench_throughput::export_file() const
+{
+    if(this->m_ofilename.empty())
+    {
+        return rocsparse_status_success;
+    }
+
+    std::ofstream out(this->m_ofilename);
+    if(!out.is_open())
+    {
+        std::cerr << "rocsparse_bench_throughput: cannot open '" << this->m_ofilename << "'"
+                  << std::endl;
+        return rocsparse_status_invalid_value;
+    }
+
+    const size_t ncalls = this->m_latencies.size();
+
+    out << "{" << std::endl;
+    out << "\"rocSPARSE version\": \"" << rocsparse_get_version() << "\"," << std::endl;
+    out << "\"cmdline\": \"";
+    for(size_t j = 0; j < this->m_args.size(); ++j)
+    {
+        out << ((j > 0) ? " " : "") << this->m_args[j];
+    }
+    out << "\"," << std::endl;
+    out << "\"routine\": \"" << this->m_routine << "\"," << std::endl;
+    out << "\"threads\": " << this->m_nthreads << "," << std::endl;
+    out << "\"streams\": " << this->m_nstreams << "," << std::endl;
+    out << "\"duration\": " << this->m_elapsed << "," << std::endl;
+    out << "\"calls\": " << ncalls << "," << std::endl;
+    out << "\"calls per second\": " << ((this->m_elapsed > 0.0) ? ncalls / this->m_elapsed : 0.0)
+        << "," << std::endl;
+    out << "\"latency\": { \"p50\": " << this->percentile(50.0)
+        << ", \"p90\": " << this->percentile(90.0) << ", \"p99\": " << this->percentile(99.0)
+        << ", \"max\": " << this->percentile(100.0) << " }" << std::endl;
+    out << "}" << std::endl;
+    return rocsparse_status_success;
+}
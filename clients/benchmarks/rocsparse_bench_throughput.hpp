@@ -0,0 +1,103 @@
+/*! \file */
+/* ************************************************************************
+* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+#pragma once
+
+#include "rocsparse-types.h"
+#include <iostream>
+#include <string>
+#include <vector>
+
+struct rocsparse_arguments_config;
+
+//
+// Throughput of a routine issued concurrently.
+//
+// Each of the host threads owns as many handles as streams, every handle being bound to
+// its own stream and output. The threads issue the routine on all their handles, then
+// poll all the calls until they have completed, until the duration has elapsed. The
+// aggregate number of calls per second and the percentiles of the latency of a call, from
+// its issue to its completion as observed by the host, are reported.
+//
+// Usage: rocsparse-bench --bench-throughput [--bench-threads <N>] [--bench-streams <M>]
+//                        [--bench-duration <seconds>] [--bench-throughput-o <report.json>]
+//                        -f csrmv|csrsv <options of the routine>
+//
+class rocsparse_bench_throughput
+{
+private:
+    static rocsparse_bench_throughput* s_instance;
+
+    int                      m_nthreads{1};
+    int                      m_nstreams{1};
+    double                   m_duration{1.0};
+    std::string              m_ofilename{};
+    std::vector<std::string> m_args{};
+
+    //
+    // Results.
+    //
+    std::string         m_routine{};
+    double              m_elapsed{};
+    std::vector<double> m_latencies{};
+
+    rocsparse_bench_throughput(int argc, char** argv);
+
+    template <typename T>
+    rocsparse_status run_template(const rocsparse_arguments_config& config);
+
+    double percentile(double p) const;
+
+public:
+    static bool applies(int argc, char** argv);
+
+    static rocsparse_bench_throughput* instance(int argc, char** argv)
+    {
+        s_instance = new rocsparse_bench_throughput(argc, argv);
+        return s_instance;
+    }
+
+    static rocsparse_bench_throughput* instance()
+    {
+        return s_instance;
+    }
+
+    rocsparse_bench_throughput(const rocsparse_bench_throughput&) = delete;
+    rocsparse_bench_throughput& operator=(const rocsparse_bench_throughput&) = delete;
+
+    //
+    // @brief Issue the routine from all threads and streams for the duration.
+    //
+    rocsparse_status run();
+
+    //
+    // @brief Report the calls per second and the latency percentiles.
+    //
+    rocsparse_status report(std::ostream& out) const;
+
+    //
+    // @brief Export the configuration and the results.
+    //
+    rocsparse_status export_file() const;
+};
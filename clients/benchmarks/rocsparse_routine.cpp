@@ -215,12 +215,15 @@ constexpr const char* rocsparse_routine::to_string() const
 #include "testing_gemvi.hpp"
 #include "testing_hybmv.hpp"
 #include "testing_spitsv_csr.hpp"
+#include "testing_spmv_batched_csr.hpp"
 #include "testing_spmv_bsr.hpp"
 #include "testing_spmv_coo.hpp"
 #include "testing_spmv_coo_aos.hpp"
 #include "testing_spmv_csc.hpp"
 #include "testing_spmv_csr.hpp"
 #include "testing_spmv_ell.hpp"
+#include "testing_spmv_fused.hpp"
+#include "testing_spmv_semiring.hpp"
 #include "testing_spsv_coo.hpp"
 #include "testing_spsv_csr.hpp"
 
@@ -249,12 +252,18 @@ constexpr const char* rocsparse_routine::to_string() const
 #include "testing_csrgeam.hpp"
 #include "testing_csrgemm.hpp"
 #include "testing_csrgemm_reuse.hpp"
+#include "testing_csrrap.hpp"
+#include "testing_spgeam.hpp"
 #include "testing_spgemm_bsr.hpp"
 #include "testing_spgemm_csr.hpp"
+#include "testing_spgemm_masked.hpp"
+#include "testing_spgemm_semiring.hpp"
 
 // Preconditioner
+#include "testing_bsrbjac.hpp"
 #include "testing_bsric0.hpp"
 #include "testing_bsrilu0.hpp"
+#include "testing_csrbjac.hpp"
 #include "testing_csric0.hpp"
 #include "testing_csrilu0.hpp"
 #include "testing_csritilu0.hpp"
@@ -263,6 +272,7 @@ constexpr const char* rocsparse_routine::to_string() const
 #include "testing_gtsv_interleaved_batch.hpp"
 #include "testing_gtsv_no_pivot.hpp"
 #include "testing_gtsv_no_pivot_strided_batch.hpp"
+#include "testing_gtsv_strided_batch.hpp"
 
 // Conversion
 #include "testing_bsr2csr.hpp"
@@ -296,6 +306,7 @@ constexpr const char* rocsparse_routine::to_string() const
 #include "testing_nnz.hpp"
 #include "testing_prune_csr2csr.hpp"
 #include "testing_prune_csr2csr_by_percentage.hpp"
+#include "testing_prune_csr2csr_by_strength.hpp"
 #include "testing_prune_dense2csr.hpp"
 #include "testing_prune_dense2csr_by_percentage.hpp"
 #include "testing_sparse_to_dense_coo.hpp"
@@ -304,6 +315,7 @@ constexpr const char* rocsparse_routine::to_string() const
 #include "testing_sparse_to_sparse.hpp"
 
 // Reordering
+#include "testing_csraggregate.hpp"
 #include "testing_csrcolor.hpp"
 
 // Util
@@ -418,6 +430,27 @@ rocsparse_status rocsparse_routine::dispatch_call(const Arguments& arg)
         }                                            \
     }
 
+#define DEFINE_CASE_IJT_REAL_ONLY_X(value, testingf) \
+    case value:                                      \
+    {                                                \
+        if(IS_T_REAL)                                \
+        {                                            \
+            try                                      \
+            {                                        \
+                testingf<I, J, T>(arg);              \
+                return rocsparse_status_success;     \
+            }                                        \
+            catch(const rocsparse_status& status)    \
+            {                                        \
+                return status;                       \
+            }                                        \
+        }                                            \
+        else                                         \
+        {                                            \
+            return rocsparse_status_not_implemented; \
+        }                                            \
+    }
+
 #define DEFINE_CASE_T_FLOAT_ONLY(value)              \
     case value:                                      \
     {                                                \
@@ -485,6 +518,7 @@ rocsparse_status rocsparse_routine::dispatch_call(const Arguments& arg)
         DEFINE_CASE_IT_X(bellmm, testing_spmm_bell);
         DEFINE_CASE_IT_X(bellmm_batched, testing_spmm_batched_bell);
         DEFINE_CASE_T(bsrgeam);
+        DEFINE_CASE_T(bsrbjac);
         DEFINE_CASE_T(bsric0);
         DEFINE_CASE_T(bsrilu0);
         DEFINE_CASE_T(bsrmm);
@@ -510,7 +544,9 @@ rocsparse_status rocsparse_routine::dispatch_call(const Arguments& arg)
         DEFINE_CASE_T(coo2dense);
         DEFINE_CASE_T_FLOAT_ONLY(cscsort);
         DEFINE_CASE_T(csc2dense);
+        DEFINE_CASE_T_FLOAT_ONLY(csraggregate);
         DEFINE_CASE_T(csrcolor);
+        DEFINE_CASE_T(csrbjac);
         DEFINE_CASE_T(csric0);
         DEFINE_CASE_T(csrilu0);
         DEFINE_CASE_T(csritilu0);
@@ -518,8 +554,15 @@ rocsparse_status rocsparse_routine::dispatch_call(const Arguments& arg)
         DEFINE_CASE_IJT_X(bsrgemm, testing_spgemm_bsr);
         DEFINE_CASE_IJT_X(csrgemm, testing_spgemm_csr);
         DEFINE_CASE_T(csrgemm_reuse);
+        DEFINE_CASE_IJT_X(csrgemm_masked, testing_spgemm_masked);
+        DEFINE_CASE_IJT_REAL_ONLY_X(csrgemm_semiring, testing_spgemm_semiring);
+        DEFINE_CASE_IJT(spgeam);
+        DEFINE_CASE_T(csrrap);
         DEFINE_CASE_IJAXYT_X(bsrmv, testing_spmv_bsr);
         DEFINE_CASE_IJAXYT_X(csrmv, testing_spmv_csr);
+        DEFINE_CASE_IJT_REAL_ONLY_X(csrmv_semiring, testing_spmv_semiring);
+        DEFINE_CASE_IJT_X(csrmv_fused, testing_spmv_fused);
+        DEFINE_CASE_IJT_X(csrmv_batched, testing_spmv_batched_csr);
         DEFINE_CASE_T(csrmv_managed);
         DEFINE_CASE_IJAXYT_X(cscmv, testing_spmv_csc);
         DEFINE_CASE_IJT_X(csrmm, testing_spmm_csr);
@@ -561,6 +604,7 @@ rocsparse_status rocsparse_routine::dispatch_call(const Arguments& arg)
         DEFINE_CASE_T(gtsv);
         DEFINE_CASE_T(gtsv_no_pivot);
         DEFINE_CASE_T(gtsv_no_pivot_strided_batch);
+        DEFINE_CASE_T(gtsv_strided_batch);
         DEFINE_CASE_T(gtsv_interleaved_batch);
         DEFINE_CASE_T(gpsv_interleaved_batch);
         DEFINE_CASE_T(hybmv);
@@ -570,6 +614,7 @@ rocsparse_status rocsparse_routine::dispatch_call(const Arguments& arg)
         DEFINE_CASE_T(nnz);
         DEFINE_CASE_T_REAL_ONLY(prune_csr2csr);
         DEFINE_CASE_T_REAL_ONLY(prune_csr2csr_by_percentage);
+        DEFINE_CASE_T_REAL_ONLY(prune_csr2csr_by_strength);
         DEFINE_CASE_T_REAL_ONLY(prune_dense2csr);
         DEFINE_CASE_T_REAL_ONLY(prune_dense2csr_by_percentage);
         DEFINE_CASE_T_REAL_ONLY(roti);
@@ -584,6 +629,7 @@ rocsparse_status rocsparse_routine::dispatch_call(const Arguments& arg)
 #undef DEFINE_CASE_IT_X
 #undef DEFINE_CASE_IJT_X
 #undef DEFINE_CASE_T_REAL_ONLY
+#undef DEFINE_CASE_IJT_REAL_ONLY_X
 #undef DEFINE_CASE_T_FLOAT_ONLY
 #undef DEFINE_CASE_T_X
 #undef DEFINE_CASE_T
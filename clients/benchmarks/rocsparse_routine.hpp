@@ -30,6 +30,7 @@ ROCSPARSE_DO_ROUTINE(axpyi)						\
 ROCSPARSE_DO_ROUTINE(bellmm)						\
 ROCSPARSE_DO_ROUTINE(bellmm_batched)					\
 ROCSPARSE_DO_ROUTINE(bsrgeam)					\
+ROCSPARSE_DO_ROUTINE(bsrbjac)					\
 ROCSPARSE_DO_ROUTINE(bsric0)					\
 ROCSPARSE_DO_ROUTINE(bsrilu0)					\
 ROCSPARSE_DO_ROUTINE(bsrgemm)					\
@@ -53,18 +54,27 @@ ROCSPARSE_DO_ROUTINE(coosort)					\
 ROCSPARSE_DO_ROUTINE(coosv)					\
 ROCSPARSE_DO_ROUTINE(coomv_aos)					\
 ROCSPARSE_DO_ROUTINE(coosm)					\
+ROCSPARSE_DO_ROUTINE(csraggregate)				\
 ROCSPARSE_DO_ROUTINE(coo2csr)					\
 ROCSPARSE_DO_ROUTINE(coo2dense)					\
 ROCSPARSE_DO_ROUTINE(cscsort)					\
 ROCSPARSE_DO_ROUTINE(csc2dense)					\
 ROCSPARSE_DO_ROUTINE(csrcolor)					\
+ROCSPARSE_DO_ROUTINE(csrbjac)					\
 ROCSPARSE_DO_ROUTINE(csric0)					\
 ROCSPARSE_DO_ROUTINE(csrilu0)					\
 ROCSPARSE_DO_ROUTINE(csritilu0)					\
 ROCSPARSE_DO_ROUTINE(csrgeam)					\
 ROCSPARSE_DO_ROUTINE(csrgemm)					\
 ROCSPARSE_DO_ROUTINE(csrgemm_reuse)				\
+ROCSPARSE_DO_ROUTINE(csrgemm_masked)				\
+ROCSPARSE_DO_ROUTINE(csrgemm_semiring)				\
+ROCSPARSE_DO_ROUTINE(spgeam)					\
+ROCSPARSE_DO_ROUTINE(csrrap)					\
 ROCSPARSE_DO_ROUTINE(csrmv)					\
+ROCSPARSE_DO_ROUTINE(csrmv_semiring)				\
+ROCSPARSE_DO_ROUTINE(csrmv_fused)				\
+ROCSPARSE_DO_ROUTINE(csrmv_batched)				\
 ROCSPARSE_DO_ROUTINE(csrmv_managed)				\
 ROCSPARSE_DO_ROUTINE(cscmv)					\
 ROCSPARSE_DO_ROUTINE(csrmm)					\
@@ -107,6 +117,7 @@ ROCSPARSE_DO_ROUTINE(gpsv_interleaved_batch) \
 ROCSPARSE_DO_ROUTINE(gtsv)					\
 ROCSPARSE_DO_ROUTINE(gtsv_no_pivot)				\
 ROCSPARSE_DO_ROUTINE(gtsv_no_pivot_strided_batch)		\
+ROCSPARSE_DO_ROUTINE(gtsv_strided_batch)			\
 ROCSPARSE_DO_ROUTINE(gtsv_interleaved_batch)		\
 ROCSPARSE_DO_ROUTINE(hybmv)					\
 ROCSPARSE_DO_ROUTINE(hyb2csr)					\
@@ -115,6 +126,7 @@ ROCSPARSE_DO_ROUTINE(inverse_permutation)			\
 ROCSPARSE_DO_ROUTINE(nnz)					\
 ROCSPARSE_DO_ROUTINE(prune_csr2csr)				\
 ROCSPARSE_DO_ROUTINE(prune_csr2csr_by_percentage)		\
+ROCSPARSE_DO_ROUTINE(prune_csr2csr_by_strength)			\
 ROCSPARSE_DO_ROUTINE(prune_dense2csr)				\
 ROCSPARSE_DO_ROUTINE(prune_dense2csr_by_percentage)		\
 ROCSPARSE_DO_ROUTINE(roti)					\
@@ -0,0 +1,109 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_bench_log.hpp"
+
+#include <map>
+#include <sstream>
+
+rocsparse_status rocsparse_bench_log_parse(std::istream&                          in,
+                                           std::vector<rocsparse_bench_log_call>& calls,
+                                           int64_t&                               nlines)
+{
+    calls.clear();
+    nlines = 0;
+
+    std::map<std::string, size_t> indices;
+    std::string                   line;
+    int64_t                       iline = 0;
+    while(std::getline(in, line))
+    {
+        ++iline;
+
+        std::istringstream       iss(line);
+        std::vector<std::string> tokens;
+        std::string              token;
+        bool                     found = false;
+        while(iss >> token)
+        {
+            if(found)
+            {
+                tokens.push_back(token);
+            }
+            else
+            {
+                const std::string exe("rocsparse-bench");
+                found = (token.size() >= exe.size()
+                         && token.compare(token.size() - exe.size(), exe.size(), exe) == 0);
+            }
+        }
+
+        if(!found)
+        {
+            continue;
+        }
+
+        ++nlines;
+
+        std::string key;
+        for(const auto& t : tokens)
+        {
+            key += " " + t;
+        }
+
+        auto it = indices.find(key);
+        if(it != indices.end())
+        {
+            ++calls[it->second].count;
+            continue;
+        }
+
+        rocsparse_bench_log_call call;
+        call.args  = tokens;
+        call.count = 1;
+        for(size_t j = 0; j < tokens.size(); ++j)
+        {
+            if((tokens[j] == "-f" || tokens[j] == "--function") && (j + 1 < tokens.size()))
+            {
+                call.routine = tokens[j + 1];
+            }
+            else if(tokens[j].compare(0, 11, "--function=") == 0)
+            {
+                call.routine = tokens[j].substr(11);
+            }
+        }
+
+        // The default function of rocsparse-bench is not a recorded routine
+        if(call.routine.empty())
+        {
+            std::cerr << "rocsparse_bench_log_parse: line " << iline
+                      << " has no function (-f, --function)" << std::endl;
+            return rocsparse_status_invalid_value;
+        }
+
+        indices[key] = calls.size();
+        calls.push_back(call);
+    }
+
+    return rocsparse_status_success;
+}
@@ -0,0 +1,235 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CHUNKED_FORMAT_HPP
+#define ROCSPARSE_CHUNKED_FORMAT_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <rocsparse.h>
+
+//
+// Chunked compressed csx file:
+//   - the magic line ROCSPARSE_CHUNKED_MAGIC,
+//   - a rocsparse_chunked_header,
+//   - the block index, i.e. nchunks rocsparse_chunked_block,
+//   - the payloads of the chunks, located by the offsets of the block index.
+//
+// Each chunk covers chunk_size consecutive rows (columns for csc) and is encoded independently,
+// such that chunks can be decoded in parallel or individually:
+//   - the lengths of the rows as LEB128 varints,
+//   - the indices of each row as zigzag varints of their difference with the previous index,
+//   - the values as a sequence of runs of a repeated value and literal sequences.
+//
+#define ROCSPARSE_CHUNKED_MAGIC "#rocSPARSE chunked csx file"
+
+static constexpr int64_t rocsparse_chunked_version    = 1;
+static constexpr int64_t rocsparse_chunked_chunk_size = 16384;
+
+typedef enum rocsparse_chunked_type_
+{
+    rocsparse_chunked_type_float32   = 0,
+    rocsparse_chunked_type_float64   = 1,
+    rocsparse_chunked_type_complex32 = 2,
+    rocsparse_chunked_type_complex64 = 3
+} rocsparse_chunked_type;
+
+struct rocsparse_chunked_header
+{
+    int64_t version;
+    int64_t dir;
+    int64_t m;
+    int64_t n;
+    int64_t nnz;
+    int64_t base;
+    int64_t val_type;
+    int64_t chunk_size;
+    int64_t nchunks;
+};
+
+struct rocsparse_chunked_block
+{
+    int64_t  nnz_begin;
+    uint64_t offset;
+    uint64_t ptr_bytes;
+    uint64_t ind_bytes;
+    uint64_t val_bytes;
+};
+
+template <typename T>
+inline rocsparse_chunked_type rocsparse_chunked_type_convert();
+
+template <>
+inline rocsparse_chunked_type rocsparse_chunked_type_convert<float>()
+{
+    return rocsparse_chunked_type_float32;
+}
+
+template <>
+inline rocsparse_chunked_type rocsparse_chunked_type_convert<double>()
+{
+    return rocsparse_chunked_type_float64;
+}
+
+template <>
+inline rocsparse_chunked_type rocsparse_chunked_type_convert<rocsparse_float_complex>()
+{
+    return rocsparse_chunked_type_complex32;
+}
+
+template <>
+inline rocsparse_chunked_type rocsparse_chunked_type_convert<rocsparse_double_complex>()
+{
+    return rocsparse_chunked_type_complex64;
+}
+
+inline uint64_t rocsparse_chunked_zigzag(int64_t x)
+{
+    return (static_cast<uint64_t>(x) << 1) ^ static_cast<uint64_t>(x >> 63);
+}
+
+inline int64_t rocsparse_chunked_unzigzag(uint64_t x)
+{
+    return static_cast<int64_t>(x >> 1) ^ -static_cast<int64_t>(x & 1);
+}
+
+inline void rocsparse_chunked_put_varint(std::vector<char>& out, uint64_t x)
+{
+    while(x >= 0x80)
+    {
+        out.push_back(static_cast<char>((x & 0x7f) | 0x80));
+        x >>= 7;
+    }
+    out.push_back(static_cast<char>(x));
+}
+
+inline bool rocsparse_chunked_get_varint(const char*& p, const char* end, uint64_t& x)
+{
+    x = 0;
+    for(int shift = 0; shift < 64; shift += 7)
+    {
+        if(p == end)
+        {
+            return false;
+        }
+        const uint64_t byte = static_cast<unsigned char>(*p++);
+        x |= (byte & 0x7f) << shift;
+        if((byte & 0x80) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+//
+// Values are stored as a sequence of (header, data), the lowest bit of the header flags a run of
+// (header >> 1) copies of a single value, otherwise (header >> 1) values follow verbatim.
+//
+template <typename T>
+inline void rocsparse_chunked_put_values(std::vector<char>& out, size_t size, const T* val)
+{
+    const char* bytes = reinterpret_cast<const char*>(val);
+    size_t      i     = 0;
+    while(i < size)
+    {
+        size_t run = 1;
+        while(i + run < size && !memcmp(&val[i + run], &val[i], sizeof(T)))
+        {
+            ++run;
+        }
+
+        if(run > 1)
+        {
+            rocsparse_chunked_put_varint(out, (run << 1) | 1);
+            out.insert(out.end(), bytes + i * sizeof(T), bytes + (i + 1) * sizeof(T));
+            i += run;
+        }
+        else
+        {
+            // Extend the literal sequence up to the start of the next run.
+            size_t len = 1;
+            while(i + len < size
+                  && (i + len + 1 == size || memcmp(&val[i + len], &val[i + len + 1], sizeof(T))))
+            {
+                ++len;
+            }
+            rocsparse_chunked_put_varint(out, len << 1);
+            out.insert(out.end(), bytes + i * sizeof(T), bytes + (i + len) * sizeof(T));
+            i += len;
+        }
+    }
+}
+
+template <typename T>
+inline bool rocsparse_chunked_get_values(const char*& p, const char* end, size_t size, T* val)
+{
+    size_t i = 0;
+    while(i < size)
+    {
+        uint64_t header;
+        if(!rocsparse_chunked_get_varint(p, end, header))
+        {
+            return false;
+        }
+
+        const uint64_t len = header >> 1;
+        if(len == 0 || len > size - i)
+        {
+            return false;
+        }
+
+        if(header & 1)
+        {
+            if(static_cast<size_t>(end - p) < sizeof(T))
+            {
+                return false;
+            }
+            T v;
+            memcpy(&v, p, sizeof(T));
+            p += sizeof(T);
+            for(uint64_t k = 0; k < len; ++k)
+            {
+                val[i + k] = v;
+            }
+        }
+        else
+        {
+            if(static_cast<size_t>(end - p) / sizeof(T) < len)
+            {
+                return false;
+            }
+            memcpy(&val[i], p, len * sizeof(T));
+            p += len * sizeof(T);
+        }
+        i += len;
+    }
+    return true;
+}
+
+#endif // HEADER
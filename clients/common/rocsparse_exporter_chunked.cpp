@@ -0,0 +1,257 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_exporter_chunked.hpp"
+
+rocsparse_exporter_chunked::~rocsparse_exporter_chunked()
+{
+    const char* env = getenv("GTEST_LISTENER");
+    if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
+    {
+        std::cout << "Export done." << std::endl;
+    }
+}
+
+rocsparse_exporter_chunked::rocsparse_exporter_chunked(const std::string& filename_,
+                                                       int64_t            chunk_size_)
+    : m_filename(filename_)
+    , m_chunk_size(chunk_size_)
+{
+    const char* env = getenv("GTEST_LISTENER");
+    if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
+    {
+        std::cout << "Opening file '" << this->m_filename << "' ... " << std::endl;
+    }
+
+    if(this->m_chunk_size <= 0)
+    {
+        throw rocsparse_status_invalid_value;
+    }
+}
+
+template <typename T, typename I, typename J>
+rocsparse_status rocsparse_exporter_chunked::write_sparse_csx(rocsparse_direction dir_,
+                                                              J                   m_,
+                                                              J                   n_,
+                                                              I                   nnz_,
+                                                              const I* __restrict__ ptr_,
+                                                              const J* __restrict__ ind_,
+                                                              const T* __restrict__ val_,
+                                                              rocsparse_index_base base_)
+{
+    if(m_ < 0 || n_ < 0 || nnz_ < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    rocsparse_chunked_header header{};
+    header.version    = rocsparse_chunked_version;
+    header.dir        = static_cast<int64_t>(dir_);
+    header.m          = static_cast<int64_t>(m_);
+    header.n          = static_cast<int64_t>(n_);
+    header.nnz        = static_cast<int64_t>(nnz_);
+    header.base       = static_cast<int64_t>(base_);
+    header.val_type   = static_cast<int64_t>(rocsparse_chunked_type_convert<T>());
+    header.chunk_size = this->m_chunk_size;
+
+    const int64_t lines = (dir_ == rocsparse_direction_row) ? header.m : header.n;
+    header.nchunks      = (lines + header.chunk_size - 1) / header.chunk_size;
+
+    //
+    // Encode the chunks independently.
+    //
+    std::vector<rocsparse_chunked_block> blocks(header.nchunks);
+    std::vector<std::vector<char>>       payloads(header.nchunks);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for(int64_t c = 0; c < header.nchunks; ++c)
+    {
+        const int64_t row_begin = c * header.chunk_size;
+        const int64_t row_end   = std::min(row_begin + header.chunk_size, lines);
+        const int64_t nnz_begin = static_cast<int64_t>(ptr_[row_begin]) - header.base;
+        const int64_t nnz_end   = static_cast<int64_t>(ptr_[row_end]) - header.base;
+
+        std::vector<char>&       payload = payloads[c];
+        rocsparse_chunked_block& block   = blocks[c];
+
+        block.nnz_begin = nnz_begin;
+
+        for(int64_t i = row_begin; i < row_end; ++i)
+        {
+            rocsparse_chunked_put_varint(payload, static_cast<uint64_t>(ptr_[i + 1] - ptr_[i]));
+        }
+        block.ptr_bytes = payload.size();
+
+        for(int64_t i = row_begin; i < row_end; ++i)
+        {
+            int64_t prev = 0;
+            for(int64_t k = ptr_[i] - header.base; k < ptr_[i + 1] - header.base; ++k)
+            {
+                const int64_t col = static_cast<int64_t>(ind_[k]);
+                rocsparse_chunked_put_varint(payload, rocsparse_chunked_zigzag(col - prev));
+                prev = col;
+            }
+        }
+        block.ind_bytes = payload.size() - block.ptr_bytes;
+
+        rocsparse_chunked_put_values(payload, nnz_end - nnz_begin, val_ + nnz_begin);
+        block.val_bytes = payload.size() - block.ptr_bytes - block.ind_bytes;
+    }
+
+    uint64_t offset = 0;
+    for(int64_t c = 0; c < header.nchunks; ++c)
+    {
+        blocks[c].offset = offset;
+        offset += payloads[c].size();
+    }
+
+    //
+    // Write the header, the block index and the payloads.
+    //
+    std::ofstream out(this->m_filename, std::ios::out | std::ios::binary);
+    if(!out.is_open())
+    {
+        return rocsparse_status_internal_error;
+    }
+
+    out << ROCSPARSE_CHUNKED_MAGIC << std::endl;
+    out.write((const char*)&header, sizeof(rocsparse_chunked_header));
+    out.write((const char*)blocks.data(), sizeof(rocsparse_chunked_block) * header.nchunks);
+    for(int64_t c = 0; c < header.nchunks; ++c)
+    {
+        out.write(payloads[c].data(), payloads[c].size());
+    }
+    out.close();
+
+    return out.fail() ? rocsparse_status_internal_error : rocsparse_status_success;
+}
+
+template <typename T, typename I, typename J>
+rocsparse_status rocsparse_exporter_chunked::write_sparse_gebsx(rocsparse_direction dir_,
+                                                                rocsparse_direction dirb_,
+                                                                J                   mb_,
+                                                                J                   nb_,
+                                                                I                   nnzb_,
+                                                                J block_dim_row_,
+                                                                J block_dim_column_,
+                                                                const I* __restrict__ ptr_,
+                                                                const J* __restrict__ ind_,
+                                                                const T* __restrict__ val_,
+                                                                rocsparse_index_base base_)
+{
+    return rocsparse_status_not_implemented;
+}
+
+template <typename T, typename I>
+rocsparse_status
+    rocsparse_exporter_chunked::write_dense_vector(I nmemb_, const T* __restrict__ x_, I incx_)
+{
+    return rocsparse_status_not_implemented;
+}
+
+template <typename T, typename I>
+rocsparse_status rocsparse_exporter_chunked::write_dense_matrix(
+    rocsparse_order order_, I m_, I n_, const T* __restrict__ x_, I ld_)
+{
+    return rocsparse_status_not_implemented;
+}
+
+template <typename T, typename I>
+rocsparse_status rocsparse_exporter_chunked::write_sparse_coo(I m_,
+                                                              I n_,
+                                                              I nnz_,
+                                                              const I* __restrict__ row_ind_,
+                                                              const I* __restrict__ col_ind_,
+                                                              const T* __restrict__ val_,
+                                                              rocsparse_index_base base_)
+{
+    return rocsparse_status_not_implemented;
+}
+
+#define INSTANTIATE_TIJ(T, I, J)                                              \
+    template rocsparse_status rocsparse_exporter_chunked::write_sparse_csx(   \
+        rocsparse_direction,                                                  \
+        J,                                                                    \
+        J,                                                                    \
+        I,                                                                    \
+        const I* __restrict__,                                                \
+        const J* __restrict__,                                                \
+        const T* __restrict__,                                                \
+        rocsparse_index_base);                                                \
+    template rocsparse_status rocsparse_exporter_chunked::write_sparse_gebsx( \
+        rocsparse_direction,                                                  \
+        rocsparse_direction,                                                  \
+        J,                                                                    \
+        J,                                                                    \
+        I,                                                                    \
+        J,                                                                    \
+        J,                                                                    \
+        const I* __restrict__,                                                \
+        const J* __restrict__,                                                \
+        const T* __restrict__,                                                \
+        rocsparse_index_base)
+
+#define INSTANTIATE_TI(T, I)                                                  \
+    template rocsparse_status rocsparse_exporter_chunked::write_dense_vector( \
+        I, const T* __restrict__, I);                                         \
+    template rocsparse_status rocsparse_exporter_chunked::write_dense_matrix( \
+        rocsparse_order, I, I, const T* __restrict__, I);                     \
+    template rocsparse_status rocsparse_exporter_chunked::write_sparse_coo(   \
+        I,                                                                    \
+        I,                                                                    \
+        I,                                                                    \
+        const I* __restrict__,                                                \
+        const I* __restrict__,                                                \
+        const T* __restrict__,                                                \
+        rocsparse_index_base)
+
+INSTANTIATE_TIJ(float, int32_t, int32_t);
+INSTANTIATE_TIJ(float, int64_t, int32_t);
+INSTANTIATE_TIJ(float, int64_t, int64_t);
+
+INSTANTIATE_TIJ(double, int32_t, int32_t);
+INSTANTIATE_TIJ(double, int64_t, int32_t);
+INSTANTIATE_TIJ(double, int64_t, int64_t);
+
+INSTANTIATE_TIJ(rocsparse_float_complex, int32_t, int32_t);
+INSTANTIATE_TIJ(rocsparse_float_complex, int64_t, int32_t);
+INSTANTIATE_TIJ(rocsparse_float_complex, int64_t, int64_t);
+
+INSTANTIATE_TIJ(rocsparse_double_complex, int32_t, int32_t);
+INSTANTIATE_TIJ(rocsparse_double_complex, int64_t, int32_t);
+INSTANTIATE_TIJ(rocsparse_double_complex, int64_t, int64_t);
+
+INSTANTIATE_TI(float, int32_t);
+INSTANTIATE_TI(float, int64_t);
+
+INSTANTIATE_TI(double, int32_t);
+INSTANTIATE_TI(double, int64_t);
+
+INSTANTIATE_TI(rocsparse_float_complex, int32_t);
+INSTANTIATE_TI(rocsparse_float_complex, int64_t);
+
+INSTANTIATE_TI(rocsparse_double_complex, int32_t);
+INSTANTIATE_TI(rocsparse_double_complex, int64_t);
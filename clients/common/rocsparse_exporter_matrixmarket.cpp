@@ -23,9 +23,22 @@
  * ************************************************************************ */
 
 #include "rocsparse_exporter_matrixmarket.hpp"
+#include "rocsparse_exporter_parallel.hpp"
 template <typename X, typename Y>
 rocsparse_status rocsparse_type_conversion(const X& x, Y& y);
 
+template <typename T>
+static std::string rocsparse_exporter_matrixmarket_header(const char* layout)
+{
+    std::string header = std::string("%%MatrixMarket matrix ") + layout;
+    if(std::is_same<T, rocsparse_float_complex>() || std::is_same<T, rocsparse_double_complex>())
+        header.append(" complex");
+    else
+        header.append(" real");
+    header.append(" general\n");
+    return header;
+}
+
 rocsparse_exporter_matrixmarket::~rocsparse_exporter_matrixmarket()
 {
     const char* env = getenv("GTEST_LISTENER");
@@ -55,81 +68,49 @@ rocsparse_status rocsparse_exporter_matrixmarket::write_sparse_csx(rocsparse_dir
                                                                    const T* __restrict__ val_,
                                                                    rocsparse_index_base base_)
 {
-    std::ofstream out(this->m_filename);
-    if(!out.is_open())
-    {
-        return rocsparse_status_internal_error;
-    }
-    if(std::is_same<T, double>() || std::is_same<T, rocsparse_double_complex>())
+    if(dir_ != rocsparse_direction_row && dir_ != rocsparse_direction_column)
     {
-        out.precision(15);
-        out.setf(std::ios::scientific);
-    }
-    else
-    {
-        out.precision(7);
-        out.setf(std::ios::scientific);
+        return rocsparse_status_invalid_value;
     }
 
-    out << "%%MatrixMarket matrix coordinate ";
-    if(std::is_same<T, rocsparse_float_complex>() || std::is_same<T, rocsparse_double_complex>())
-        out << "complex";
-    else
-        out << "real";
-    out << " general" << std::endl;
-    out << m_ << " " << n_ << " " << nnz_ << std::endl;
-    switch(dir_)
-    {
-    case rocsparse_direction_row:
-    {
-        for(J i = 0; i < m_; ++i)
-        {
-            for(I at = ptr_[i] - base_; at < ptr_[i + 1] - base_; ++at)
-            {
-                J j = ind_[at] - base_;
-                T x = val_[at];
-                out << (i + 1) << " " << (j + 1);
-                if(std::is_same<T, rocsparse_float_complex>()
-                   || std::is_same<T, rocsparse_double_complex>())
-                {
-                    out << " " << std::real(x) << " " << std::imag(x);
-                }
-                else
-                {
-                    out << " " << x;
-                }
-                out << std::endl;
-            }
-        }
-        out.close();
-        return rocsparse_status_success;
-    }
-    case rocsparse_direction_column:
-    {
-        for(J j = 0; j < n_; ++j)
-        {
-            for(I at = ptr_[j] - base_; at < ptr_[j + 1] - base_; ++at)
+    std::string header = rocsparse_exporter_matrixmarket_header<T>("coordinate");
+    rocsparse_exporter_append_index(header, m_);
+    header.push_back(' ');
+    rocsparse_exporter_append_index(header, n_);
+    header.push_back(' ');
+    rocsparse_exporter_append_index(header, nnz_);
+    header.push_back('\n');
+
+    const int64_t nnz   = nnz_;
+    const int64_t lines = (dir_ == rocsparse_direction_row) ? m_ : n_;
+    const int64_t nchunks
+        = (nnz + rocsparse_exporter_chunk_entries - 1) / rocsparse_exporter_chunk_entries;
+
+    return rocsparse_exporter_write_chunks(
+        this->m_filename, header, nchunks, [&](int64_t c, std::string& out) {
+            const int64_t k_begin = c * rocsparse_exporter_chunk_entries;
+            const int64_t k_end   = std::min(k_begin + rocsparse_exporter_chunk_entries, nnz);
+
+            // Line of the first entry of the chunk.
+            const I key = static_cast<I>(k_begin + base_);
+            int64_t i   = std::upper_bound(ptr_, ptr_ + lines + 1, key) - ptr_ - 1;
+            for(int64_t k = k_begin; k < k_end; ++k)
             {
-                J i = ind_[at] - base_;
-                T x = val_[at];
-                out << (i + 1) << " " << (j + 1);
-                if(std::is_same<T, rocsparse_float_complex>()
-                   || std::is_same<T, rocsparse_double_complex>())
+                while(ptr_[i + 1] - base_ <= k)
                 {
-                    out << " " << std::real(x) << " " << std::imag(x);
+                    ++i;
                 }
-                else
-                {
-                    out << " " << x;
-                }
-                out << std::endl;
+                const int64_t j   = ind_[k] - base_;
+                const int64_t row = (dir_ == rocsparse_direction_row) ? i : j;
+                const int64_t col = (dir_ == rocsparse_direction_row) ? j : i;
+                rocsparse_exporter_append_index(out, row + 1);
+                out.push_back(' ');
+                rocsparse_exporter_append_index(out, col + 1);
+                out.push_back(' ');
+                rocsparse_exporter_append_value(out, val_[k]);
+                out.push_back('\n');
             }
-        }
-        out.close();
-        return rocsparse_status_success;
-    }
-    }
-    return rocsparse_status_invalid_value;
+        });
 }
 
 template <typename T, typename I, typename J>
@@ -309,43 +290,24 @@ template <typename T, typename I>
 rocsparse_status
     rocsparse_exporter_matrixmarket::write_dense_vector(I nmemb_, const T* __restrict__ x_, I incx_)
 {
-    std::ofstream out(this->m_filename);
-    if(!out.is_open())
-    {
-        return rocsparse_status_internal_error;
-    }
-    if(std::is_same<T, double>() || std::is_same<T, rocsparse_double_complex>())
-    {
-        out.precision(15);
-        out.setf(std::ios::scientific);
-    }
-    else
-    {
-        out.precision(7);
-        out.setf(std::ios::scientific);
-    }
+    std::string header = rocsparse_exporter_matrixmarket_header<T>("array");
+    rocsparse_exporter_append_index(header, nmemb_);
+    header.append(" 1\n");
 
-    out << "%%MatrixMarket matrix array ";
-    if(std::is_same<T, rocsparse_float_complex>() || std::is_same<T, rocsparse_double_complex>())
-        out << "complex";
-    else
-        out << "real";
-    out << " general" << std::endl;
-    out << nmemb_ << " 1" << std::endl;
-    for(I i = 0; i < nmemb_; ++i)
-    {
-        if(std::is_same<T, rocsparse_float_complex>()
-           || std::is_same<T, rocsparse_double_complex>())
-        {
-            out << std::real(x_[i * incx_]) << " " << std::imag(x_[i * incx_]) << std::endl;
-        }
-        else
-        {
-            out << x_[i * incx_] << std::endl;
-        }
-    }
-    out.close();
-    return rocsparse_status_success;
+    const int64_t nmemb = nmemb_;
+    const int64_t nchunks
+        = (nmemb + rocsparse_exporter_chunk_entries - 1) / rocsparse_exporter_chunk_entries;
+
+    return rocsparse_exporter_write_chunks(
+        this->m_filename, header, nchunks, [&](int64_t c, std::string& out) {
+            const int64_t i_begin = c * rocsparse_exporter_chunk_entries;
+            const int64_t i_end   = std::min(i_begin + rocsparse_exporter_chunk_entries, nmemb);
+            for(int64_t i = i_begin; i < i_end; ++i)
+            {
+                rocsparse_exporter_append_value(out, x_[i * incx_]);
+                out.push_back('\n');
+            }
+        });
 }
 
 template <typename T, typename I>
@@ -424,48 +386,32 @@ rocsparse_status rocsparse_exporter_matrixmarket::write_sparse_coo(I m_,
                                                                    const T* __restrict__ val_,
                                                                    rocsparse_index_base base_)
 {
-    std::ofstream out(this->m_filename);
-    if(!out.is_open())
-    {
-        return rocsparse_status_internal_error;
-    }
-
-    if(std::is_same<T, double>() || std::is_same<T, rocsparse_double_complex>())
-    {
-        out.precision(15);
-        out.setf(std::ios::scientific);
-    }
-    else
-    {
-        out.precision(7);
-        out.setf(std::ios::scientific);
-    }
-
-    out << "%%MatrixMarket matrix coordinate ";
-    if(std::is_same<T, rocsparse_float_complex>() || std::is_same<T, rocsparse_double_complex>())
-        out << "complex";
-    else
-        out << "real";
+    std::string header = rocsparse_exporter_matrixmarket_header<T>("coordinate");
+    rocsparse_exporter_append_index(header, m_);
+    header.push_back(' ');
+    rocsparse_exporter_append_index(header, n_);
+    header.push_back(' ');
+    rocsparse_exporter_append_index(header, nnz_);
+    header.push_back('\n');
 
-    out << " general" << std::endl;
-    out << m_ << " " << n_ << " " << nnz_ << std::endl;
+    const int64_t nnz = nnz_;
+    const int64_t nchunks
+        = (nnz + rocsparse_exporter_chunk_entries - 1) / rocsparse_exporter_chunk_entries;
 
-    for(I i = 0; i < nnz_; ++i)
-    {
-        out << ((row_ind_[i] - base_) + 1) << " " << ((col_ind_[i] - base_) + 1);
-        if(std::is_same<T, rocsparse_float_complex>()
-           || std::is_same<T, rocsparse_double_complex>())
-        {
-            out << " " << std::real(val_[i]) << " " << std::imag(val_[i]) << std::endl;
-        }
-        else
-        {
-            out << " " << val_[i] << std::endl;
-        }
-    }
-
-    out.close();
-    return rocsparse_status_success;
+    return rocsparse_exporter_write_chunks(
+        this->m_filename, header, nchunks, [&](int64_t c, std::string& out) {
+            const int64_t k_begin = c * rocsparse_exporter_chunk_entries;
+            const int64_t k_end   = std::min(k_begin + rocsparse_exporter_chunk_entries, nnz);
+            for(int64_t k = k_begin; k < k_end; ++k)
+            {
+                rocsparse_exporter_append_index(out, (row_ind_[k] - base_) + 1);
+                out.push_back(' ');
+                rocsparse_exporter_append_index(out, (col_ind_[k] - base_) + 1);
+                out.push_back(' ');
+                rocsparse_exporter_append_value(out, val_[k]);
+                out.push_back('\n');
+            }
+        });
 }
 
 #define INSTANTIATE_TIJ(T, I, J)                                                   \
@@ -0,0 +1,260 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_EXPORTER_PARALLEL_HPP
+#define ROCSPARSE_EXPORTER_PARALLEL_HPP
+
+#include <algorithm>
+#include <cerrno>
+#if __cplusplus >= 201703L
+#include <charconv>
+#endif
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <rocsparse.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+//
+// Number of entries formatted by a single task of the parallel exporters.
+//
+static constexpr int64_t rocsparse_exporter_chunk_entries = 65536;
+
+//
+// Shortest scientific representation reading back to the same value.
+//
+#ifdef __cpp_lib_to_chars
+template <typename T>
+inline void rocsparse_exporter_append_real(std::string& out, T x)
+{
+    char                       buffer[32];
+    const std::to_chars_result result
+        = std::to_chars(buffer, buffer + sizeof(buffer), x, std::chars_format::scientific);
+    out.append(buffer, result.ptr);
+}
+#else
+//
+// Fallback for C++14 and for standard libraries without floating point std::to_chars:
+// binary search on the precision of a round-tripping snprintf.
+//
+inline double rocsparse_exporter_read_back(const char* buffer, double)
+{
+    return strtod(buffer, nullptr);
+}
+
+inline float rocsparse_exporter_read_back(const char* buffer, float)
+{
+    return strtof(buffer, nullptr);
+}
+
+template <typename T>
+inline void rocsparse_exporter_append_real(std::string& out, T x)
+{
+    char buffer[32];
+    int  lo = 0;
+    int  hi = std::numeric_limits<T>::max_digits10 - 1;
+    while(lo < hi)
+    {
+        const int mid = (lo + hi) / 2;
+        snprintf(buffer, sizeof(buffer), "%.*e", mid, x);
+        if(rocsparse_exporter_read_back(buffer, x) == x)
+        {
+            hi = mid;
+        }
+        else
+        {
+            lo = mid + 1;
+        }
+    }
+    out.append(buffer, snprintf(buffer, sizeof(buffer), "%.*e", lo, x));
+}
+#endif
+
+inline void rocsparse_exporter_append_value(std::string& out, double x)
+{
+    rocsparse_exporter_append_real(out, x);
+}
+
+inline void rocsparse_exporter_append_value(std::string& out, float x)
+{
+    rocsparse_exporter_append_real(out, x);
+}
+
+inline void rocsparse_exporter_append_value(std::string& out, rocsparse_float_complex x)
+{
+    rocsparse_exporter_append_value(out, std::real(x));
+    out.push_back(' ');
+    rocsparse_exporter_append_value(out, std::imag(x));
+}
+
+inline void rocsparse_exporter_append_value(std::string& out, rocsparse_double_complex x)
+{
+    rocsparse_exporter_append_value(out, std::real(x));
+    out.push_back(' ');
+    rocsparse_exporter_append_value(out, std::imag(x));
+}
+
+inline void rocsparse_exporter_append_index(std::string& out, int64_t x)
+{
+    char  buffer[24];
+    char* p = buffer + sizeof(buffer);
+    const uint64_t u = (x < 0) ? (0 - static_cast<uint64_t>(x)) : static_cast<uint64_t>(x);
+    uint64_t       v = u;
+    do
+    {
+        *--p = static_cast<char>('0' + v % 10);
+        v /= 10;
+    } while(v != 0);
+    if(x < 0)
+    {
+        *--p = '-';
+    }
+    out.append(p, buffer + sizeof(buffer) - p);
+}
+
+#ifndef WIN32
+inline bool rocsparse_exporter_pwrite(int fd, const char* data, size_t size, off_t offset)
+{
+    while(size > 0)
+    {
+        const ssize_t count = pwrite(fd, data, size, offset);
+        if(count < 0)
+        {
+            if(errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+        data += count;
+        size -= count;
+        offset += count;
+    }
+    return true;
+}
+#endif
+
+//
+// Write the header followed by the text of nchunks chunks, in order.
+// format_chunk(c, buffer) appends the text of chunk c to buffer. Chunks are formatted in parallel
+// by rounds, each chunk of a round is then written at its precomputed offset with pwrite, such
+// that the memory footprint is bounded by the size of a round.
+//
+template <typename F>
+inline rocsparse_status rocsparse_exporter_write_chunks(const std::string& filename,
+                                                        const std::string& header,
+                                                        int64_t            nchunks,
+                                                        F                  format_chunk)
+{
+#ifdef _OPENMP
+    const int64_t round_size = 2 * omp_get_max_threads();
+#else
+    const int64_t round_size = 1;
+#endif
+
+#ifdef WIN32
+    std::ofstream out(filename, std::ios::out | std::ios::binary);
+    if(!out.is_open())
+    {
+        return rocsparse_status_internal_error;
+    }
+    out.write(header.data(), header.size());
+    bool failed = out.fail();
+#else
+    const int fd = open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if(fd == -1)
+    {
+        return rocsparse_status_internal_error;
+    }
+    bool               failed = !rocsparse_exporter_pwrite(fd, header.data(), header.size(), 0);
+    off_t              offset = header.size();
+    std::vector<off_t> offsets(round_size);
+#endif
+
+    std::vector<std::string> buffers(round_size);
+    for(int64_t first = 0; first < nchunks && !failed; first += round_size)
+    {
+        const int64_t count = std::min(round_size, nchunks - first);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+        for(int64_t c = 0; c < count; ++c)
+        {
+            buffers[c].clear();
+            format_chunk(first + c, buffers[c]);
+        }
+
+#ifdef WIN32
+        for(int64_t c = 0; c < count; ++c)
+        {
+            out.write(buffers[c].data(), buffers[c].size());
+        }
+        failed = out.fail();
+#else
+        for(int64_t c = 0; c < count; ++c)
+        {
+            offsets[c] = offset;
+            offset += buffers[c].size();
+        }
+
+        int64_t nfailed = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1) reduction(+ : nfailed)
+#endif
+        for(int64_t c = 0; c < count; ++c)
+        {
+            if(!rocsparse_exporter_pwrite(fd, buffers[c].data(), buffers[c].size(), offsets[c]))
+            {
+                ++nfailed;
+            }
+        }
+        failed = (nfailed > 0);
+#endif
+    }
+
+#ifdef WIN32
+    out.close();
+#else
+    failed = (close(fd) != 0) || failed;
+#endif
+
+    return failed ? rocsparse_status_internal_error : rocsparse_status_success;
+}
+
+#endif // HEADER
@@ -87,6 +87,9 @@ void convert_array<rocsparse_float_complex>(int nnz, const void* data, void* mem
 {
     rocsparse_double_complex*      pmem  = (rocsparse_double_complex*)mem;
     const rocsparse_float_complex* pdata = (const rocsparse_float_complex*)data;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
     for(int i = 0; i < nnz; ++i)
     {
         pmem[i] = rocsparse_double_complex(std::real(pdata[i]), std::imag(pdata[i]));
@@ -98,6 +101,9 @@ void convert_array<float>(int nnz, const void* data, void* mem)
 {
     double*      pmem  = (double*)mem;
     const float* pdata = (const float*)data;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
     for(int i = 0; i < nnz; ++i)
     {
         pmem[i] = pdata[i];
@@ -179,52 +185,54 @@ rocsparse_status rocsparse_exporter_rocalution::write_sparse_csx(rocsparse_direc
     ind = (ind_same || (base_ == rocsparse_index_base_zero)) ? ((const int*)ind_) : ind_mem;
     val = (val_same) ? ((const double*)val_) : val_mem;
 
+    //
+    // Conversions are independent, run them in parallel.
+    //
+    int64_t nfailed = 0;
     if(ptr_mem != nullptr)
     {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(+ : nfailed)
+#endif
         for(int i = 0; i < m + 1; ++i)
         {
-            status = rocsparse_type_conversion(ptr_[i], ptr_mem[i]);
-            if(status != rocsparse_status_success)
+            if(rocsparse_type_conversion(ptr_[i], ptr_mem[i]) != rocsparse_status_success)
             {
-                break;
+                ++nfailed;
             }
-        }
-
-        if(base_ == rocsparse_index_base_one)
-        {
-            for(int i = 0; i < m + 1; ++i)
+            else if(base_ == rocsparse_index_base_one)
             {
                 ptr_mem[i] = ptr_mem[i] - 1;
             }
         }
 
-        if(status != rocsparse_status_success)
+        if(nfailed > 0)
         {
-            return status;
+            return rocsparse_status_invalid_value;
         }
     }
 
     if(ind_mem != nullptr)
     {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(+ : nfailed)
+#endif
         for(int i = 0; i < nnz; ++i)
         {
-            status = rocsparse_type_conversion(ind_[i], ind_mem[i]);
-            if(status != rocsparse_status_success)
+            if(rocsparse_type_conversion(ind_[i], ind_mem[i]) != rocsparse_status_success)
             {
-                break;
+                ++nfailed;
             }
-        }
-        if(status != rocsparse_status_success)
-        {
-            return status;
-        }
-        if(base_ == rocsparse_index_base_one)
-        {
-            for(int i = 0; i < nnz; ++i)
+            else if(base_ == rocsparse_index_base_one)
             {
                 ind_mem[i] = ind_mem[i] - 1;
             }
         }
+
+        if(nfailed > 0)
+        {
+            return rocsparse_status_invalid_value;
+        }
     }
 
     if(val_mem != nullptr)
@@ -1818,6 +1818,143 @@ void host_csrmv(rocsparse_operation   trans,
     }
 }
 
+// Host counterparts of the device semirings
+template <typename T>
+static T host_semiring_zero(rocsparse_semiring semiring)
+{
+    switch(semiring)
+    {
+    case rocsparse_semiring_min_plus:
+        return std::numeric_limits<T>::infinity();
+    case rocsparse_semiring_max_min:
+        return -std::numeric_limits<T>::infinity();
+    case rocsparse_semiring_plus_times:
+    case rocsparse_semiring_max_times:
+    case rocsparse_semiring_or_and:
+        return static_cast<T>(0);
+    }
+    return static_cast<T>(0);
+}
+
+template <typename T>
+static T host_semiring_add(rocsparse_semiring semiring, T a, T b)
+{
+    switch(semiring)
+    {
+    case rocsparse_semiring_plus_times:
+        return a + b;
+    case rocsparse_semiring_min_plus:
+        return std::min(a, b);
+    case rocsparse_semiring_max_times:
+    case rocsparse_semiring_max_min:
+        return std::max(a, b);
+    case rocsparse_semiring_or_and:
+        return (a != static_cast<T>(0) || b != static_cast<T>(0)) ? static_cast<T>(1)
+                                                                 : static_cast<T>(0);
+    }
+    return a + b;
+}
+
+template <typename T>
+static T host_semiring_mul(rocsparse_semiring semiring, T a, T b)
+{
+    switch(semiring)
+    {
+    case rocsparse_semiring_plus_times:
+    case rocsparse_semiring_max_times:
+        return a * b;
+    case rocsparse_semiring_min_plus:
+        return a + b;
+    case rocsparse_semiring_max_min:
+        return std::min(a, b);
+    case rocsparse_semiring_or_and:
+        return (a != static_cast<T>(0) && b != static_cast<T>(0)) ? static_cast<T>(1)
+                                                                 : static_cast<T>(0);
+    }
+    return a * b;
+}
+
+template <typename T, typename I, typename J>
+void host_csrmv_semiring(rocsparse_semiring   semiring,
+                         J                    M,
+                         J                    N,
+                         I                    nnz,
+                         T                    alpha,
+                         const I*             csr_row_ptr,
+                         const J*             csr_col_ind,
+                         const T*             csr_val,
+                         const T*             x,
+                         T                    beta,
+                         T*                   y,
+                         rocsparse_index_base base)
+{
+    const T zero = host_semiring_zero<T>(semiring);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(J i = 0; i < M; ++i)
+    {
+        T sum = zero;
+
+        for(I j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            const T val  = host_semiring_mul(semiring, alpha, csr_val[j]);
+            const T prod = host_semiring_mul(semiring, val, x[csr_col_ind[j] - base]);
+
+            sum = host_semiring_add(semiring, sum, prod);
+        }
+
+        if(beta != zero)
+        {
+            sum = host_semiring_add(semiring, host_semiring_mul(semiring, beta, y[i]), sum);
+        }
+
+        y[i] = sum;
+    }
+}
+
+template <typename T, typename I, typename J>
+void host_csrmv_fused(rocsparse_spmv_reduction reduction,
+                      J                        M,
+                      J                        N,
+                      I                        nnz,
+                      T                        alpha,
+                      const I*                 csr_row_ptr,
+                      const J*                 csr_col_ind,
+                      const T*                 csr_val,
+                      const T*                 x,
+                      T                        beta,
+                      T*                       y,
+                      T*                       result,
+                      rocsparse_index_base     base)
+{
+    host_csrmv(rocsparse_operation_none,
+               M,
+               N,
+               nnz,
+               alpha,
+               csr_row_ptr,
+               csr_col_ind,
+               csr_val,
+               x,
+               beta,
+               y,
+               base,
+               rocsparse_matrix_type_general,
+               rocsparse_spmv_alg_csr_stream,
+               false);
+
+    T dot = static_cast<T>(0);
+    for(J i = 0; i < M; ++i)
+    {
+        const T xi = (reduction == rocsparse_spmv_reduction_dot_xy) ? x[i] : y[i];
+        dot        = std::fma(rocsparse_conj(xi), y[i], dot);
+    }
+
+    *result = dot;
+}
+
 template <typename T, typename I, typename J, typename A, typename X, typename Y>
 void host_cscmv(rocsparse_operation trans,
                 J                   M,
@@ -5013,6 +5150,409 @@ void host_csrgemm(J                    M,
     }
 }
 
+template <typename T, typename I, typename J>
+void host_csrgemm_masked_nnz(J                     M,
+                             J                     N,
+                             J                     K,
+                             rocsparse_spgemm_mask mask,
+                             const I*              csr_row_ptr_A,
+                             const J*              csr_col_ind_A,
+                             const I*              csr_row_ptr_B,
+                             const J*              csr_col_ind_B,
+                             const I*              csr_row_ptr_M,
+                             const J*              csr_col_ind_M,
+                             I*                    csr_row_ptr_C,
+                             I*                    nnz_C,
+                             rocsparse_index_base  base_A,
+                             rocsparse_index_base  base_B,
+                             rocsparse_index_base  base_M,
+                             rocsparse_index_base  base_C)
+{
+    if(M <= 0)
+    {
+        *nnz_C = 0;
+        return;
+    }
+
+    const bool complement = (mask == rocsparse_spgemm_mask_complement);
+
+    csr_row_ptr_C[0] = base_C;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<J> nnz(N, -1);
+        std::vector<J> in_mask(N, -1);
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1024)
+#endif
+        for(J i = 0; i < M; ++i)
+        {
+            csr_row_ptr_C[i + 1] = 0;
+
+            // Mark the columns of the mask
+            for(I j = csr_row_ptr_M[i] - base_M; j < csr_row_ptr_M[i + 1] - base_M; ++j)
+            {
+                in_mask[csr_col_ind_M[j] - base_M] = i;
+            }
+
+            for(I j = csr_row_ptr_A[i] - base_A; j < csr_row_ptr_A[i + 1] - base_A; ++j)
+            {
+                J col_A = csr_col_ind_A[j] - base_A;
+
+                for(I k = csr_row_ptr_B[col_A] - base_B; k < csr_row_ptr_B[col_A + 1] - base_B;
+                    ++k)
+                {
+                    J col_B = csr_col_ind_B[k] - base_B;
+
+                    // Count each column once, if it is selected by the mask
+                    if(nnz[col_B] != i && (in_mask[col_B] == i) != complement)
+                    {
+                        nnz[col_B] = i;
+                        ++csr_row_ptr_C[i + 1];
+                    }
+                }
+            }
+        }
+    }
+
+    // Scan to obtain row offsets
+    for(J i = 0; i < M; ++i)
+    {
+        csr_row_ptr_C[i + 1] += csr_row_ptr_C[i];
+    }
+
+    *nnz_C = csr_row_ptr_C[M] - base_C;
+}
+
+template <typename T, typename I, typename J>
+void host_csrgemm_masked(J                     M,
+                         J                     N,
+                         J                     K,
+                         rocsparse_spgemm_mask mask,
+                         const T*              alpha,
+                         const I*              csr_row_ptr_A,
+                         const J*              csr_col_ind_A,
+                         const T*              csr_val_A,
+                         const I*              csr_row_ptr_B,
+                         const J*              csr_col_ind_B,
+                         const T*              csr_val_B,
+                         const I*              csr_row_ptr_M,
+                         const J*              csr_col_ind_M,
+                         const I*              csr_row_ptr_C,
+                         J*                    csr_col_ind_C,
+                         T*                    csr_val_C,
+                         rocsparse_index_base  base_A,
+                         rocsparse_index_base  base_B,
+                         rocsparse_index_base  base_M,
+                         rocsparse_index_base  base_C)
+{
+    if(M <= 0 || N <= 0)
+    {
+        return;
+    }
+
+    const bool complement = (mask == rocsparse_spgemm_mask_complement);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<J> nnz(N, -1);
+        std::vector<J> in_mask(N, -1);
+        std::vector<T> acc(N);
+        std::vector<J> cols;
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1024)
+#endif
+        for(J i = 0; i < M; ++i)
+        {
+            cols.clear();
+
+            // Mark the columns of the mask
+            for(I j = csr_row_ptr_M[i] - base_M; j < csr_row_ptr_M[i + 1] - base_M; ++j)
+            {
+                in_mask[csr_col_ind_M[j] - base_M] = i;
+            }
+
+            for(I j = csr_row_ptr_A[i] - base_A; j < csr_row_ptr_A[i + 1] - base_A; ++j)
+            {
+                J col_A = csr_col_ind_A[j] - base_A;
+                T val_A = *alpha * csr_val_A[j];
+
+                for(I k = csr_row_ptr_B[col_A] - base_B; k < csr_row_ptr_B[col_A + 1] - base_B;
+                    ++k)
+                {
+                    J col_B = csr_col_ind_B[k] - base_B;
+
+                    // Skip columns that are not selected by the mask
+                    if((in_mask[col_B] == i) == complement)
+                    {
+                        continue;
+                    }
+
+                    if(nnz[col_B] != i)
+                    {
+                        nnz[col_B] = i;
+                        acc[col_B] = static_cast<T>(0);
+                        cols.push_back(col_B);
+                    }
+
+                    acc[col_B] += val_A * csr_val_B[k];
+                }
+            }
+
+            // Columns of C are sorted
+            std::sort(cols.begin(), cols.end());
+
+            I row_begin_C = csr_row_ptr_C[i] - base_C;
+            for(size_t j = 0; j < cols.size(); ++j)
+            {
+                csr_col_ind_C[row_begin_C + j] = cols[j] + base_C;
+                csr_val_C[row_begin_C + j]     = acc[cols[j]];
+            }
+        }
+    }
+}
+
+// Computes C = alpha * A + beta * B on the compressed (CSR) layout, which also covers CSC
+// and BSR matrices. For BSR matrices, each entry is a block of bs2 values.
+template <typename T, typename I, typename J>
+void host_spgeam_nnz(J                    M,
+                     J                    N,
+                     const I*             ptr_A,
+                     const J*             ind_A,
+                     const I*             ptr_B,
+                     const J*             ind_B,
+                     I*                   ptr_C,
+                     I*                   nnz_C,
+                     rocsparse_index_base base_A,
+                     rocsparse_index_base base_B,
+                     rocsparse_index_base base_C)
+{
+    ptr_C[0] = base_C;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<J> nnz(N, -1);
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1024)
+#endif
+        for(J i = 0; i < M; ++i)
+        {
+            ptr_C[i + 1] = 0;
+
+            for(I j = ptr_A[i] - base_A; j < ptr_A[i + 1] - base_A; ++j)
+            {
+                J col = ind_A[j] - base_A;
+
+                if(nnz[col] != i)
+                {
+                    nnz[col] = i;
+                    ++ptr_C[i + 1];
+                }
+            }
+
+            for(I j = ptr_B[i] - base_B; j < ptr_B[i + 1] - base_B; ++j)
+            {
+                J col = ind_B[j] - base_B;
+
+                if(nnz[col] != i)
+                {
+                    nnz[col] = i;
+                    ++ptr_C[i + 1];
+                }
+            }
+        }
+    }
+
+    // Scan to obtain row offsets
+    for(J i = 0; i < M; ++i)
+    {
+        ptr_C[i + 1] += ptr_C[i];
+    }
+
+    *nnz_C = ptr_C[M] - base_C;
+}
+
+template <typename T, typename I, typename J>
+void host_spgeam(J                    M,
+                 J                    N,
+                 I                    bs2,
+                 T                    alpha,
+                 const I*             ptr_A,
+                 const J*             ind_A,
+                 const T*             val_A,
+                 T                    beta,
+                 const I*             ptr_B,
+                 const J*             ind_B,
+                 const T*             val_B,
+                 const I*             ptr_C,
+                 J*                   ind_C,
+                 T*                   val_C,
+                 rocsparse_index_base base_A,
+                 rocsparse_index_base base_B,
+                 rocsparse_index_base base_C)
+{
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(J i = 0; i < M; ++i)
+    {
+        I idx_C = ptr_C[i] - base_C;
+
+        // Columns of A and B are sorted, merge both rows
+        I j = ptr_A[i] - base_A;
+        I k = ptr_B[i] - base_B;
+
+        I row_end_A = ptr_A[i + 1] - base_A;
+        I row_end_B = ptr_B[i + 1] - base_B;
+
+        while(j < row_end_A || k < row_end_B)
+        {
+            J col_A = (j < row_end_A) ? ind_A[j] - base_A : N;
+            J col_B = (k < row_end_B) ? ind_B[k] - base_B : N;
+            J col   = std::min(col_A, col_B);
+
+            ind_C[idx_C] = col + base_C;
+
+            for(I e = 0; e < bs2; ++e)
+            {
+                T sum = static_cast<T>(0);
+
+                if(col_A == col)
+                {
+                    sum += alpha * val_A[j * bs2 + e];
+                }
+
+                if(col_B == col)
+                {
+                    sum += beta * val_B[k * bs2 + e];
+                }
+
+                val_C[idx_C * bs2 + e] = sum;
+            }
+
+            j += (col_A == col);
+            k += (col_B == col);
+
+            ++idx_C;
+        }
+    }
+}
+
+template <typename T, typename I, typename J>
+void host_csrgemm_semiring(rocsparse_semiring   semiring,
+                           J                    M,
+                           J                    N,
+                           J                    K,
+                           const T*             alpha,
+                           const I*             csr_row_ptr_A,
+                           const J*             csr_col_ind_A,
+                           const T*             csr_val_A,
+                           const I*             csr_row_ptr_B,
+                           const J*             csr_col_ind_B,
+                           const T*             csr_val_B,
+                           const T*             beta,
+                           const I*             csr_row_ptr_D,
+                           const J*             csr_col_ind_D,
+                           const T*             csr_val_D,
+                           const I*             csr_row_ptr_C,
+                           J*                   csr_col_ind_C,
+                           T*                   csr_val_C,
+                           rocsparse_index_base base_A,
+                           rocsparse_index_base base_B,
+                           rocsparse_index_base base_C,
+                           rocsparse_index_base base_D)
+{
+    if(M == 0 || N == 0 || (!alpha && !beta))
+    {
+        return;
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        // Position of each column in the current row of C, the first product of a
+        // column initializes the entry, all others are reduced into it
+        std::vector<I> pos(N, -1);
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1024)
+#endif
+        for(J i = 0; i < M; ++i)
+        {
+            const I row_begin_C = csr_row_ptr_C[i] - base_C;
+            I       row_end_C   = row_begin_C;
+
+            auto insert = [&](J col, T val) {
+                if(pos[col] < row_begin_C)
+                {
+                    pos[col]                 = row_end_C;
+                    csr_col_ind_C[row_end_C] = col;
+                    csr_val_C[row_end_C]     = val;
+                    ++row_end_C;
+                }
+                else
+                {
+                    csr_val_C[pos[col]] = host_semiring_add(semiring, csr_val_C[pos[col]], val);
+                }
+            };
+
+            if(alpha && K > 0)
+            {
+                for(I j = csr_row_ptr_A[i] - base_A; j < csr_row_ptr_A[i + 1] - base_A; ++j)
+                {
+                    const J col_A = csr_col_ind_A[j] - base_A;
+                    const T val_A = host_semiring_mul(semiring, *alpha, csr_val_A[j]);
+
+                    for(I k = csr_row_ptr_B[col_A] - base_B; k < csr_row_ptr_B[col_A + 1] - base_B;
+                        ++k)
+                    {
+                        insert(csr_col_ind_B[k] - base_B,
+                               host_semiring_mul(semiring, val_A, csr_val_B[k]));
+                    }
+                }
+            }
+
+            if(beta)
+            {
+                for(I j = csr_row_ptr_D[i] - base_D; j < csr_row_ptr_D[i + 1] - base_D; ++j)
+                {
+                    insert(csr_col_ind_D[j] - base_D,
+                           host_semiring_mul(semiring, *beta, csr_val_D[j]));
+                }
+            }
+
+            // Sort the row by column index
+            std::vector<std::pair<J, T>> row(row_end_C - row_begin_C);
+            for(I j = row_begin_C; j < row_end_C; ++j)
+            {
+                row[j - row_begin_C] = std::make_pair(csr_col_ind_C[j], csr_val_C[j]);
+            }
+
+            std::sort(row.begin(),
+                      row.end(),
+                      [](const std::pair<J, T>& a, const std::pair<J, T>& b) {
+                          return a.first < b.first;
+                      });
+
+            for(I j = row_begin_C; j < row_end_C; ++j)
+            {
+                csr_col_ind_C[j] = row[j - row_begin_C].first + base_C;
+                csr_val_C[j]     = row[j - row_begin_C].second;
+            }
+        }
+    }
+}
+
 template <typename T, typename I, typename J>
 void rocsparse_host<T, I, J>::cooddmm(rocsparse_operation  transA,
                                       rocsparse_operation  transB,
@@ -6082,22 +6622,269 @@ void host_csrilu0(rocsparse_int                     M,
     }
 }
 
-// Parallel Cyclic reduction based on paper "Fast Tridiagonal Solvers on the GPU" by Yao Zhang
+// Invert the dense block_dim x block_dim block A (row major) by LU factorization with
+// partial pivoting, followed by forward and backward substitution for each column of
+// the identity. Returns false if the block is singular.
 template <typename T>
-void host_gtsv_no_pivot(rocsparse_int         m,
-                        rocsparse_int         n,
-                        const std::vector<T>& dl,
-                        const std::vector<T>& d,
-                        const std::vector<T>& du,
-                        std::vector<T>&       B,
-                        rocsparse_int         ldb)
+static bool host_bjac_invert_block(rocsparse_int block_dim, std::vector<T>& A, std::vector<T>& Ainv)
 {
-    //
-    // Compute BLOCKSIZE as the lowest power of 2 greater or equal than m,
-    // and compute the exponent 'iter' of (BLOCKSIZE / 2).
-    // Note: if m = 1 then the calculation below leads to iter = -1 which is, in this algorithm, as acceptable as log2(m / 2) = -Inf.
-    //
-    rocsparse_int iter;
+    std::vector<rocsparse_int> perm(block_dim);
+
+    for(rocsparse_int k = 0; k < block_dim; ++k)
+    {
+        // Partial pivoting
+        rocsparse_int p = k;
+        for(rocsparse_int i = k + 1; i < block_dim; ++i)
+        {
+            if(std::abs(A[i * block_dim + k]) > std::abs(A[p * block_dim + k]))
+            {
+                p = i;
+            }
+        }
+
+        if(A[p * block_dim + k] == static_cast<T>(0))
+        {
+            return false;
+        }
+
+        perm[k] = p;
+
+        if(p != k)
+        {
+            for(rocsparse_int j = 0; j < block_dim; ++j)
+            {
+                std::swap(A[k * block_dim + j], A[p * block_dim + j]);
+            }
+        }
+
+        for(rocsparse_int i = k + 1; i < block_dim; ++i)
+        {
+            A[i * block_dim + k] /= A[k * block_dim + k];
+
+            for(rocsparse_int j = k + 1; j < block_dim; ++j)
+            {
+                A[i * block_dim + j] -= A[i * block_dim + k] * A[k * block_dim + j];
+            }
+        }
+    }
+
+    for(rocsparse_int c = 0; c < block_dim; ++c)
+    {
+        // Permuted unit vector
+        std::vector<T> b(block_dim, static_cast<T>(0));
+        b[c] = static_cast<T>(1);
+
+        for(rocsparse_int k = 0; k < block_dim; ++k)
+        {
+            std::swap(b[k], b[perm[k]]);
+        }
+
+        // Forward substitution with unit lower triangular L
+        for(rocsparse_int i = 0; i < block_dim; ++i)
+        {
+            for(rocsparse_int j = 0; j < i; ++j)
+            {
+                b[i] -= A[i * block_dim + j] * b[j];
+            }
+        }
+
+        // Backward substitution with upper triangular U
+        for(rocsparse_int i = block_dim - 1; i >= 0; --i)
+        {
+            for(rocsparse_int j = i + 1; j < block_dim; ++j)
+            {
+                b[i] -= A[i * block_dim + j] * b[j];
+            }
+
+            b[i] /= A[i * block_dim + i];
+        }
+
+        for(rocsparse_int i = 0; i < block_dim; ++i)
+        {
+            Ainv[i * block_dim + c] = b[i];
+        }
+    }
+
+    return true;
+}
+
+// Invert all extracted diagonal blocks and store them in the layout given by dir
+template <typename T>
+static void host_bjac_invert(rocsparse_direction  dir,
+                             rocsparse_int        mb,
+                             rocsparse_int        block_dim,
+                             std::vector<T>&      diag_val,
+                             rocsparse_index_base base,
+                             std::vector<T>&      inv_diag_val,
+                             rocsparse_int*       singular_block)
+{
+    *singular_block = -1;
+
+    std::vector<T> A(block_dim * block_dim);
+    std::vector<T> Ainv(block_dim * block_dim);
+
+    for(rocsparse_int i = 0; i < mb; ++i)
+    {
+        size_t offset = size_t(block_dim) * block_dim * i;
+
+        for(rocsparse_int k = 0; k < block_dim * block_dim; ++k)
+        {
+            A[k] = diag_val[offset + k];
+        }
+
+        if(!host_bjac_invert_block(block_dim, A, Ainv))
+        {
+            if(*singular_block == -1)
+            {
+                *singular_block = i + base;
+            }
+
+            continue;
+        }
+
+        for(rocsparse_int r = 0; r < block_dim; ++r)
+        {
+            for(rocsparse_int c = 0; c < block_dim; ++c)
+            {
+                rocsparse_int idx = (dir == rocsparse_direction_row) ? r * block_dim + c
+                                                                     : c * block_dim + r;
+
+                inv_diag_val[offset + idx] = Ainv[r * block_dim + c];
+            }
+        }
+    }
+}
+
+template <typename T>
+void host_bsrbjac_setup(rocsparse_direction               dir,
+                        rocsparse_int                     mb,
+                        const std::vector<rocsparse_int>& bsr_row_ptr,
+                        const std::vector<rocsparse_int>& bsr_col_ind,
+                        const std::vector<T>&             bsr_val,
+                        rocsparse_int                     block_dim,
+                        rocsparse_index_base              base,
+                        std::vector<T>&                   inv_diag_val,
+                        rocsparse_int*                    singular_block)
+{
+    // Extract the diagonal blocks in row major layout, missing blocks remain zero
+    std::vector<T> diag_val(size_t(mb) * block_dim * block_dim, static_cast<T>(0));
+
+    for(rocsparse_int i = 0; i < mb; ++i)
+    {
+        for(rocsparse_int j = bsr_row_ptr[i] - base; j < bsr_row_ptr[i + 1] - base; ++j)
+        {
+            if(bsr_col_ind[j] - base != i)
+            {
+                continue;
+            }
+
+            for(rocsparse_int r = 0; r < block_dim; ++r)
+            {
+                for(rocsparse_int c = 0; c < block_dim; ++c)
+                {
+                    rocsparse_int idx = (dir == rocsparse_direction_row) ? r * block_dim + c
+                                                                         : c * block_dim + r;
+
+                    diag_val[size_t(block_dim) * block_dim * i + r * block_dim + c]
+                        = bsr_val[size_t(block_dim) * block_dim * j + idx];
+                }
+            }
+        }
+    }
+
+    host_bjac_invert(dir, mb, block_dim, diag_val, base, inv_diag_val, singular_block);
+}
+
+template <typename T>
+void host_csrbjac_setup(rocsparse_direction               dir,
+                        rocsparse_int                     m,
+                        const std::vector<rocsparse_int>& csr_row_ptr,
+                        const std::vector<rocsparse_int>& csr_col_ind,
+                        const std::vector<T>&             csr_val,
+                        rocsparse_int                     block_dim,
+                        rocsparse_index_base              base,
+                        std::vector<T>&                   inv_diag_val,
+                        rocsparse_int*                    singular_block)
+{
+    rocsparse_int mb = (m + block_dim - 1) / block_dim;
+
+    // Extract the diagonal blocks in row major layout, pad the last block with the identity
+    std::vector<T> diag_val(size_t(mb) * block_dim * block_dim, static_cast<T>(0));
+
+    for(rocsparse_int row = 0; row < mb * block_dim; ++row)
+    {
+        rocsparse_int i = row / block_dim;
+        rocsparse_int r = row % block_dim;
+
+        T* block = &diag_val[size_t(block_dim) * block_dim * i];
+
+        if(row >= m)
+        {
+            block[r * block_dim + r] = static_cast<T>(1);
+            continue;
+        }
+
+        for(rocsparse_int j = csr_row_ptr[row] - base; j < csr_row_ptr[row + 1] - base; ++j)
+        {
+            rocsparse_int c = csr_col_ind[j] - base - i * block_dim;
+
+            if(c >= 0 && c < block_dim)
+            {
+                block[r * block_dim + c] = csr_val[j];
+            }
+        }
+    }
+
+    host_bjac_invert(dir, mb, block_dim, diag_val, base, inv_diag_val, singular_block);
+}
+
+template <typename T>
+void host_bjac_apply(rocsparse_direction   dir,
+                     rocsparse_int         m,
+                     rocsparse_int         block_dim,
+                     T                     alpha,
+                     const std::vector<T>& inv_diag_val,
+                     const std::vector<T>& x,
+                     T                     beta,
+                     std::vector<T>&       y)
+{
+    for(rocsparse_int row = 0; row < m; ++row)
+    {
+        rocsparse_int i = row / block_dim;
+        rocsparse_int r = row % block_dim;
+
+        const T* block = &inv_diag_val[size_t(block_dim) * block_dim * i];
+
+        T sum = static_cast<T>(0);
+
+        for(rocsparse_int c = 0; c < block_dim && i * block_dim + c < m; ++c)
+        {
+            rocsparse_int idx
+                = (dir == rocsparse_direction_row) ? r * block_dim + c : c * block_dim + r;
+
+            sum += block[idx] * x[i * block_dim + c];
+        }
+
+        y[row] = (beta == static_cast<T>(0)) ? alpha * sum : alpha * sum + beta * y[row];
+    }
+}
+
+// Parallel Cyclic reduction based on paper "Fast Tridiagonal Solvers on the GPU" by Yao Zhang
+template <typename T>
+void host_gtsv_no_pivot(rocsparse_int         m,
+                        rocsparse_int         n,
+                        const std::vector<T>& dl,
+                        const std::vector<T>& d,
+                        const std::vector<T>& du,
+                        std::vector<T>&       B,
+                        rocsparse_int         ldb)
+{
+    //
+    // Compute BLOCKSIZE as the lowest power of 2 greater or equal than m,
+    // and compute the exponent 'iter' of (BLOCKSIZE / 2).
+    // Note: if m = 1 then the calculation below leads to iter = -1 which is, in this algorithm, as acceptable as log2(m / 2) = -Inf.
+    //
+    rocsparse_int iter;
     size_t        BLOCKSIZE;
     for(iter = 0, BLOCKSIZE = 1; BLOCKSIZE < m; BLOCKSIZE <<= 1, ++iter)
         ;
@@ -6302,6 +7089,81 @@ void host_gtsv_no_pivot_strided_batch(rocsparse_int         m,
     }
 }
 
+// LU factorization with partial pivoting, applied to each system of the strided batch
+template <typename T>
+void host_gtsv_strided_batch(rocsparse_int m,
+                             const T*      dl,
+                             const T*      d,
+                             const T*      du,
+                             T*            x,
+                             rocsparse_int batch_count,
+                             rocsparse_int batch_stride)
+{
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for(rocsparse_int j = 0; j < batch_count; j++)
+    {
+        const T* a   = dl + static_cast<size_t>(batch_stride) * j;
+        const T* b   = d + static_cast<size_t>(batch_stride) * j;
+        const T* c   = du + static_cast<size_t>(batch_stride) * j;
+        T*       rhs = x + static_cast<size_t>(batch_stride) * j;
+
+        std::vector<T> u0(m);
+        std::vector<T> u1(m, static_cast<T>(0));
+        std::vector<T> u2(m, static_cast<T>(0));
+
+        T bk = b[0];
+        T ck = c[0];
+
+        for(rocsparse_int k = 0; k < m - 1; k++)
+        {
+            T ak_1 = a[k + 1];
+            T bk_1 = b[k + 1];
+            T ck_1 = (k < m - 2) ? c[k + 1] : static_cast<T>(0);
+
+            if(std::abs(bk) >= std::abs(ak_1))
+            {
+                T lk_1 = ak_1 / bk;
+
+                u0[k] = bk;
+                u1[k] = ck;
+
+                rhs[k + 1] -= lk_1 * rhs[k];
+
+                bk = bk_1 - lk_1 * ck;
+                ck = ck_1;
+            }
+            else
+            {
+                T lk_1 = bk / ak_1;
+
+                u0[k] = ak_1;
+                u1[k] = bk_1;
+                u2[k] = ck_1;
+
+                T rk       = rhs[k];
+                rhs[k]     = rhs[k + 1];
+                rhs[k + 1] = rk - lk_1 * rhs[k + 1];
+
+                bk = ck - lk_1 * bk_1;
+                ck = -lk_1 * ck_1;
+            }
+        }
+
+        u0[m - 1] = bk;
+
+        // Backward substitution
+        rhs[m - 1] = rhs[m - 1] / u0[m - 1];
+        rhs[m - 2] = (rhs[m - 2] - u1[m - 2] * rhs[m - 1]) / u0[m - 2];
+
+        for(rocsparse_int k = m - 3; k >= 0; k--)
+        {
+            rhs[k] = (rhs[k] - u1[k] * rhs[k + 1] - u2[k] * rhs[k + 2]) / u0[k];
+        }
+    }
+}
+
 template <typename T>
 void host_gtsv_interleaved_batch_thomas(rocsparse_int m,
                                         const T*      dl,
@@ -6997,18 +7859,18 @@ void host_prune_dense2csr_by_percentage(rocsparse_int               m,
     pos                 = std::min(pos, nnz_A - 1);
     pos                 = std::max(pos, 0);
 
-    std::vector<T> sorted_A(m * n);
+    std::vector<T> abs_A(m * n);
     for(rocsparse_int i = 0; i < n; i++)
     {
         for(rocsparse_int j = 0; j < m; j++)
         {
-            sorted_A[m * i + j] = std::abs(A[lda * i + j]);
+            abs_A[m * i + j] = std::abs(A[lda * i + j]);
         }
     }
 
-    std::sort(sorted_A.begin(), sorted_A.end());
+    std::nth_element(abs_A.begin(), abs_A.begin() + pos, abs_A.end());
 
-    T threshold = sorted_A[pos];
+    T threshold = abs_A[pos];
     host_prune_dense2csr<T>(m, n, A, lda, base, threshold, nnz, csr_val, csr_row_ptr, csr_col_ind);
 }
 
@@ -7342,6 +8204,74 @@ void host_csr_to_csc(J                    M,
     }
 }
 
+template <typename I, typename J>
+void host_csr_to_csc_analysis(J                    M,
+                              J                    N,
+                              I                    nnz,
+                              const I*             csr_row_ptr,
+                              const J*             csr_col_ind,
+                              std::vector<J>&      csc_row_ind,
+                              std::vector<I>&      csc_col_ptr,
+                              std::vector<I>&      perm,
+                              rocsparse_index_base base)
+{
+    csc_row_ind.resize(nnz);
+    csc_col_ptr.assign(N + 1, 0);
+    perm.resize(nnz);
+
+    // Determine nnz per column
+    for(I i = 0; i < nnz; ++i)
+    {
+        ++csc_col_ptr[csr_col_ind[i] + 1 - base];
+    }
+
+    // Scan
+    for(J i = 0; i < N; ++i)
+    {
+        csc_col_ptr[i + 1] += csc_col_ptr[i];
+    }
+
+    // Fill row indices and record the position of each entry in the CSR matrix
+    for(J i = 0; i < M; ++i)
+    {
+        I row_begin = csr_row_ptr[i] - base;
+        I row_end   = csr_row_ptr[i + 1] - base;
+
+        for(I j = row_begin; j < row_end; ++j)
+        {
+            J col = csr_col_ind[j] - base;
+            I idx = csc_col_ptr[col];
+
+            csc_row_ind[idx] = i + base;
+            perm[idx]        = j;
+
+            ++csc_col_ptr[col];
+        }
+    }
+
+    // Shift column pointer array
+    for(J i = N; i > 0; --i)
+    {
+        csc_col_ptr[i] = csc_col_ptr[i - 1] + base;
+    }
+
+    csc_col_ptr[0] = base;
+}
+
+template <typename I, typename T>
+void host_csr_to_csc_numeric(
+    I nnz, I block_size, const std::vector<I>& perm, const T* csr_val, T* csc_val)
+{
+    // Gather the (block) values of the CSR matrix into CSC order
+    for(I i = 0; i < nnz; ++i)
+    {
+        for(I k = 0; k < block_size; ++k)
+        {
+            csc_val[i * block_size + k] = csr_val[perm[i] * block_size + k];
+        }
+    }
+}
+
 template <typename T>
 void host_bsr_to_csr(rocsparse_direction               direction,
                      rocsparse_int                     mb,
@@ -8099,19 +9029,22 @@ void host_prune_csr_to_csr_by_percentage(rocsparse_int                     M,
     pos               = std::min(pos, nnz_A - 1);
     pos               = std::max(pos, 0);
 
-    std::vector<T> sorted_A(nnz_A);
+    std::vector<T> abs_A(nnz_A);
 
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
 #endif
     for(rocsparse_int i = 0; i < nnz_A; i++)
     {
-        sorted_A[i] = std::abs(csr_val_A[i]);
+        abs_A[i] = std::abs(csr_val_A[i]);
     }
 
-    std::sort(sorted_A.begin(), sorted_A.end());
+    if(nnz_A != 0)
+    {
+        std::nth_element(abs_A.begin(), abs_A.begin() + pos, abs_A.end());
+    }
 
-    T threshold = nnz_A != 0 ? sorted_A[pos] : static_cast<T>(0);
+    T threshold = nnz_A != 0 ? abs_A[pos] : static_cast<T>(0);
 
     host_prune_csr_to_csr<T>(M,
                              N,
@@ -8128,6 +9061,90 @@ void host_prune_csr_to_csr_by_percentage(rocsparse_int                     M,
                              threshold);
 }
 
+template <typename T>
+void host_prune_csr_to_csr_by_strength(rocsparse_int                     M,
+                                       rocsparse_int                     nnz_A,
+                                       const std::vector<rocsparse_int>& csr_row_ptr_A,
+                                       const std::vector<rocsparse_int>& csr_col_ind_A,
+                                       const std::vector<T>&             csr_val_A,
+                                       rocsparse_int&                    nnz_C,
+                                       std::vector<rocsparse_int>&       csr_row_ptr_C,
+                                       std::vector<rocsparse_int>&       csr_col_ind_C,
+                                       std::vector<T>&                   csr_val_C,
+                                       rocsparse_index_base              csr_base_A,
+                                       rocsparse_index_base              csr_base_C,
+                                       T                                 theta)
+{
+    // Magnitude of the diagonal entries, missing diagonal entries are treated as zero
+    std::vector<T> diag(M, static_cast<T>(0));
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(rocsparse_int i = 0; i < M; i++)
+    {
+        for(rocsparse_int j = csr_row_ptr_A[i] - csr_base_A; j < csr_row_ptr_A[i + 1] - csr_base_A;
+            j++)
+        {
+            if(csr_col_ind_A[j] - csr_base_A == i)
+            {
+                diag[i] = std::abs(csr_val_A[j]);
+            }
+        }
+    }
+
+    // Strength of connection |a_ij| >= theta * sqrt(|a_ii| * |a_jj|), the diagonal is kept
+    const T theta2    = theta * theta;
+    auto    is_strong = [&](rocsparse_int i, rocsparse_int j, T val) {
+        const T a = std::abs(val);
+        return (i == j) || (a * a >= theta2 * diag[i] * diag[j]);
+    };
+
+    csr_row_ptr_C.resize(M + 1, 0);
+    csr_row_ptr_C[0] = csr_base_C;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(rocsparse_int i = 0; i < M; i++)
+    {
+        for(rocsparse_int j = csr_row_ptr_A[i] - csr_base_A; j < csr_row_ptr_A[i + 1] - csr_base_A;
+            j++)
+        {
+            if(is_strong(i, csr_col_ind_A[j] - csr_base_A, csr_val_A[j]))
+            {
+                csr_row_ptr_C[i + 1]++;
+            }
+        }
+    }
+
+    for(rocsparse_int i = 1; i <= M; i++)
+    {
+        csr_row_ptr_C[i] += csr_row_ptr_C[i - 1];
+    }
+
+    nnz_C = csr_row_ptr_C[M] - csr_row_ptr_C[0];
+
+    csr_col_ind_C.resize(nnz_C);
+    csr_val_C.resize(nnz_C);
+
+    rocsparse_int index = 0;
+    for(rocsparse_int i = 0; i < M; i++)
+    {
+        for(rocsparse_int j = csr_row_ptr_A[i] - csr_base_A; j < csr_row_ptr_A[i + 1] - csr_base_A;
+            j++)
+        {
+            if(is_strong(i, csr_col_ind_A[j] - csr_base_A, csr_val_A[j]))
+            {
+                csr_col_ind_C[index] = (csr_col_ind_A[j] - csr_base_A) + csr_base_C;
+                csr_val_C[index]     = csr_val_A[j];
+
+                index++;
+            }
+        }
+    }
+}
+
 template <typename T>
 void host_ell_to_csr(rocsparse_int                     M,
                      rocsparse_int                     N,
@@ -8572,6 +9589,32 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
                                      bool                              boost,                     \
                                      floating_data_t<TYPE>             boost_tol,                 \
                                      TYPE                              boost_val);                                             \
+    template void             host_bsrbjac_setup<TYPE>(rocsparse_direction               dir,          \
+                                           rocsparse_int                     mb,                  \
+                                           const std::vector<rocsparse_int>& bsr_row_ptr,         \
+                                           const std::vector<rocsparse_int>& bsr_col_ind,         \
+                                           const std::vector<TYPE>&          bsr_val,             \
+                                           rocsparse_int                     block_dim,           \
+                                           rocsparse_index_base              base,                \
+                                           std::vector<TYPE>&                inv_diag_val,        \
+                                           rocsparse_int*                    singular_block);     \
+    template void             host_csrbjac_setup<TYPE>(rocsparse_direction               dir,          \
+                                           rocsparse_int                     m,                   \
+                                           const std::vector<rocsparse_int>& csr_row_ptr,         \
+                                           const std::vector<rocsparse_int>& csr_col_ind,         \
+                                           const std::vector<TYPE>&          csr_val,             \
+                                           rocsparse_int                     block_dim,           \
+                                           rocsparse_index_base              base,                \
+                                           std::vector<TYPE>&                inv_diag_val,        \
+                                           rocsparse_int*                    singular_block);     \
+    template void             host_bjac_apply<TYPE>(rocsparse_direction      dir,                 \
+                                        rocsparse_int            m,                               \
+                                        rocsparse_int            block_dim,                       \
+                                        TYPE                     alpha,                           \
+                                        const std::vector<TYPE>& inv_diag_val,                    \
+                                        const std::vector<TYPE>& x,                               \
+                                        TYPE                     beta,                            \
+                                        std::vector<TYPE>&       y);                              \
     template void             host_gtsv_no_pivot<TYPE>(rocsparse_int            m,                            \
                                            rocsparse_int            n,                            \
                                            const std::vector<TYPE>& dl,                           \
@@ -8586,6 +9629,13 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
                                                          std::vector<TYPE>&       x,              \
                                                          rocsparse_int            batch_count,    \
                                                          rocsparse_int            batch_stride);             \
+    template void             host_gtsv_strided_batch<TYPE>(rocsparse_int m,                      \
+                                                const TYPE*   dl,                                 \
+                                                const TYPE*   d,                                  \
+                                                const TYPE*   du,                                 \
+                                                TYPE*         x,                                  \
+                                                rocsparse_int batch_count,                        \
+                                                rocsparse_int batch_stride);                      \
     template void             host_gtsv_interleaved_batch<TYPE>(rocsparse_gtsv_interleaved_alg algo,          \
                                                     rocsparse_int                  m,             \
                                                     const TYPE*                    dl,            \
@@ -8777,6 +9827,19 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
         rocsparse_index_base              csr_base_A,                                          \
         rocsparse_index_base              csr_base_C,                                          \
         TYPE                              percentage);                                                                      \
+    template void host_prune_csr_to_csr_by_strength<TYPE>(                                     \
+        rocsparse_int                     M,                                                   \
+        rocsparse_int                     nnz_A,                                               \
+        const std::vector<rocsparse_int>& csr_row_ptr_A,                                       \
+        const std::vector<rocsparse_int>& csr_col_ind_A,                                       \
+        const std::vector<TYPE>&          csr_val_A,                                           \
+        rocsparse_int&                    nnz_C,                                               \
+        std::vector<rocsparse_int>&       csr_row_ptr_C,                                       \
+        std::vector<rocsparse_int>&       csr_col_ind_C,                                       \
+        std::vector<TYPE>&                csr_val_C,                                           \
+        rocsparse_index_base              csr_base_A,                                          \
+        rocsparse_index_base              csr_base_C,                                          \
+        TYPE                              theta);                                              \
     template void host_prune_dense2csr<TYPE>(rocsparse_int               m,                    \
                                              rocsparse_int               n,                    \
                                              const std::vector<TYPE>&    A,                    \
@@ -8800,6 +9863,12 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
         std::vector<rocsparse_int>& csr_col_ind);
 
 #define INSTANTIATE_IT(ITYPE, TTYPE)                                                     \
+    template void host_csr_to_csc_numeric<ITYPE, TTYPE>(                                 \
+        ITYPE                     nnz,                                                   \
+        ITYPE                     block_size,                                            \
+        const std::vector<ITYPE>& perm,                                                  \
+        const TTYPE*              csr_val,                                               \
+        TTYPE*                    csc_val);                                              \
     template void host_gemvi<ITYPE, TTYPE>(ITYPE                M,                       \
                                            ITYPE                N,                       \
                                            TTYPE                alpha,                   \
@@ -8920,6 +9989,17 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
                                           const TTYPE*         s,                        \
                                           rocsparse_index_base base);
 
+#define INSTANTIATE_IJ(ITYPE, JTYPE)                                                       \
+    template void host_csr_to_csc_analysis<ITYPE, JTYPE>(JTYPE                M,           \
+                                                         JTYPE                N,           \
+                                                         ITYPE                nnz,         \
+                                                         const ITYPE*         csr_row_ptr, \
+                                                         const JTYPE*         csr_col_ind, \
+                                                         std::vector<JTYPE>&  csc_row_ind, \
+                                                         std::vector<ITYPE>&  csc_col_ptr, \
+                                                         std::vector<ITYPE>&  perm,        \
+                                                         rocsparse_index_base base);
+
 #define INSTANTIATE_IJT(ITYPE, JTYPE, TTYPE)                                                     \
     template void host_csr_to_csc<ITYPE, JTYPE, TTYPE>(JTYPE                M,                   \
                                                        JTYPE                N,                   \
@@ -9126,7 +10206,124 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
                                                     rocsparse_index_base base_A,                 \
                                                     rocsparse_index_base base_B,                 \
                                                     rocsparse_index_base base_C,                 \
-                                                    rocsparse_index_base base_D);
+                                                    rocsparse_index_base base_D);                \
+    template void host_csrgemm_masked_nnz<TTYPE, ITYPE, JTYPE>(                                  \
+        JTYPE                 M,                                                                 \
+        JTYPE                 N,                                                                 \
+        JTYPE                 K,                                                                 \
+        rocsparse_spgemm_mask mask,                                                              \
+        const ITYPE*          csr_row_ptr_A,                                                     \
+        const JTYPE*          csr_col_ind_A,                                                     \
+        const ITYPE*          csr_row_ptr_B,                                                     \
+        const JTYPE*          csr_col_ind_B,                                                     \
+        const ITYPE*          csr_row_ptr_M,                                                     \
+        const JTYPE*          csr_col_ind_M,                                                     \
+        ITYPE*                csr_row_ptr_C,                                                     \
+        ITYPE*                nnz_C,                                                             \
+        rocsparse_index_base  base_A,                                                            \
+        rocsparse_index_base  base_B,                                                            \
+        rocsparse_index_base  base_M,                                                            \
+        rocsparse_index_base  base_C);                                                           \
+    template void host_csrgemm_masked<TTYPE, ITYPE, JTYPE>(                                      \
+        JTYPE                 M,                                                                 \
+        JTYPE                 N,                                                                 \
+        JTYPE                 K,                                                                 \
+        rocsparse_spgemm_mask mask,                                                              \
+        const TTYPE*          alpha,                                                             \
+        const ITYPE*          csr_row_ptr_A,                                                     \
+        const JTYPE*          csr_col_ind_A,                                                     \
+        const TTYPE*          csr_val_A,                                                         \
+        const ITYPE*          csr_row_ptr_B,                                                     \
+        const JTYPE*          csr_col_ind_B,                                                     \
+        const TTYPE*          csr_val_B,                                                         \
+        const ITYPE*          csr_row_ptr_M,                                                     \
+        const JTYPE*          csr_col_ind_M,                                                     \
+        const ITYPE*          csr_row_ptr_C,                                                     \
+        JTYPE*                csr_col_ind_C,                                                     \
+        TTYPE*                csr_val_C,                                                         \
+        rocsparse_index_base  base_A,                                                            \
+        rocsparse_index_base  base_B,                                                            \
+        rocsparse_index_base  base_M,                                                            \
+        rocsparse_index_base  base_C);                                                           \
+    template void host_csrmv_fused<TTYPE, ITYPE, JTYPE>(rocsparse_spmv_reduction reduction,        \
+                                                        JTYPE                    M,                \
+                                                        JTYPE                    N,                \
+                                                        ITYPE                    nnz,              \
+                                                        TTYPE                    alpha,            \
+                                                        const ITYPE*             csr_row_ptr,      \
+                                                        const JTYPE*             csr_col_ind,      \
+                                                        const TTYPE*             csr_val,          \
+                                                        const TTYPE*             x,                \
+                                                        TTYPE                    beta,             \
+                                                        TTYPE*                   y,                \
+                                                        TTYPE*                   result,           \
+                                                        rocsparse_index_base     base);            \
+    template void host_spgeam_nnz<TTYPE, ITYPE, JTYPE>(JTYPE                M,                     \
+                                                       JTYPE                N,                     \
+                                                       const ITYPE*         ptr_A,                 \
+                                                       const JTYPE*         ind_A,                 \
+                                                       const ITYPE*         ptr_B,                 \
+                                                       const JTYPE*         ind_B,                 \
+                                                       ITYPE*               ptr_C,                 \
+                                                       ITYPE*               nnz_C,                 \
+                                                       rocsparse_index_base base_A,                \
+                                                       rocsparse_index_base base_B,                \
+                                                       rocsparse_index_base base_C);               \
+    template void host_spgeam<TTYPE, ITYPE, JTYPE>(JTYPE                M,                         \
+                                                   JTYPE                N,                         \
+                                                   ITYPE                bs2,                       \
+                                                   TTYPE                alpha,                     \
+                                                   const ITYPE*         ptr_A,                     \
+                                                   const JTYPE*         ind_A,                     \
+                                                   const TTYPE*         val_A,                     \
+                                                   TTYPE                beta,                      \
+                                                   const ITYPE*         ptr_B,                     \
+                                                   const JTYPE*         ind_B,                     \
+                                                   const TTYPE*         val_B,                     \
+                                                   const ITYPE*         ptr_C,                     \
+                                                   JTYPE*               ind_C,                     \
+                                                   TTYPE*               val_C,                     \
+                                                   rocsparse_index_base base_A,                    \
+                                                   rocsparse_index_base base_B,                    \
+                                                   rocsparse_index_base base_C);
+
+#define INSTANTIATE_IJT_REAL_ONLY(ITYPE, JTYPE, TTYPE)                                          \
+    template void host_csrmv_semiring<TTYPE, ITYPE, JTYPE>(                                     \
+        rocsparse_semiring   semiring,                                                          \
+        JTYPE                M,                                                                 \
+        JTYPE                N,                                                                 \
+        ITYPE                nnz,                                                               \
+        TTYPE                alpha,                                                             \
+        const ITYPE*         csr_row_ptr,                                                       \
+        const JTYPE*         csr_col_ind,                                                       \
+        const TTYPE*         csr_val,                                                           \
+        const TTYPE*         x,                                                                 \
+        TTYPE                beta,                                                              \
+        TTYPE*               y,                                                                 \
+        rocsparse_index_base base);                                                             \
+    template void host_csrgemm_semiring<TTYPE, ITYPE, JTYPE>(                                   \
+        rocsparse_semiring   semiring,                                                          \
+        JTYPE                M,                                                                 \
+        JTYPE                N,                                                                 \
+        JTYPE                K,                                                                 \
+        const TTYPE*         alpha,                                                             \
+        const ITYPE*         csr_row_ptr_A,                                                     \
+        const JTYPE*         csr_col_ind_A,                                                     \
+        const TTYPE*         csr_val_A,                                                         \
+        const ITYPE*         csr_row_ptr_B,                                                     \
+        const JTYPE*         csr_col_ind_B,                                                     \
+        const TTYPE*         csr_val_B,                                                         \
+        const TTYPE*         beta,                                                              \
+        const ITYPE*         csr_row_ptr_D,                                                     \
+        const JTYPE*         csr_col_ind_D,                                                     \
+        const TTYPE*         csr_val_D,                                                         \
+        const ITYPE*         csr_row_ptr_C,                                                     \
+        JTYPE*               csr_col_ind_C,                                                     \
+        TTYPE*               csr_val_C,                                                         \
+        rocsparse_index_base base_A,                                                            \
+        rocsparse_index_base base_B,                                                            \
+        rocsparse_index_base base_C,                                                            \
+        rocsparse_index_base base_D)
 
 #define INSTANTIATE_IXYT(ITYPE, XTYPE, YTYPE, TTYPE)                                  \
     template void host_doti<ITYPE, XTYPE, YTYPE, TTYPE>(ITYPE                nnz,     \
@@ -9287,6 +10484,10 @@ INSTANTIATE_IT(int64_t, double);
 INSTANTIATE_IT(int64_t, rocsparse_float_complex);
 INSTANTIATE_IT(int64_t, rocsparse_double_complex);
 
+INSTANTIATE_IJ(int32_t, int32_t);
+INSTANTIATE_IJ(int64_t, int32_t);
+INSTANTIATE_IJ(int64_t, int64_t);
+
 INSTANTIATE_IJT(int32_t, int32_t, float);
 INSTANTIATE_IJT(int32_t, int32_t, double);
 INSTANTIATE_IJT(int32_t, int32_t, rocsparse_float_complex);
@@ -9300,6 +10501,13 @@ INSTANTIATE_IJT(int64_t, int64_t, double);
 INSTANTIATE_IJT(int64_t, int64_t, rocsparse_float_complex);
 INSTANTIATE_IJT(int64_t, int64_t, rocsparse_double_complex);
 
+INSTANTIATE_IJT_REAL_ONLY(int32_t, int32_t, float);
+INSTANTIATE_IJT_REAL_ONLY(int32_t, int32_t, double);
+INSTANTIATE_IJT_REAL_ONLY(int64_t, int32_t, float);
+INSTANTIATE_IJT_REAL_ONLY(int64_t, int32_t, double);
+INSTANTIATE_IJT_REAL_ONLY(int64_t, int64_t, float);
+INSTANTIATE_IJT_REAL_ONLY(int64_t, int64_t, double);
+
 INSTANTIATE_DIR_IJT(rocsparse_direction_row, int32_t, int32_t, float);
 INSTANTIATE_DIR_IJT(rocsparse_direction_row, int32_t, int32_t, double);
 INSTANTIATE_DIR_IJT(rocsparse_direction_row, int32_t, int32_t, rocsparse_float_complex);
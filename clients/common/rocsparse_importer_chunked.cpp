@@ -0,0 +1,615 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_importer_chunked.hpp"
+
+template <typename T, typename V>
+static rocsparse_status
+    rocsparse_chunked_copy_values(size_t nnz, T* val, const V* tmp, std::true_type convertible)
+{
+    rocsparse_importer_copy_mixed_arrays(nnz, val, tmp);
+    return rocsparse_status_success;
+}
+
+template <typename T, typename V>
+static rocsparse_status
+    rocsparse_chunked_copy_values(size_t nnz, T* val, const V* tmp, std::false_type convertible)
+{
+    // Values are not converted between real and complex types.
+    return rocsparse_status_not_implemented;
+}
+
+//
+// The payload buffer starts with the chunk c_begin, the decoded lines and entries are stored
+// relative to the first line and the first entry of that chunk.
+//
+struct rocsparse_chunked_range
+{
+    const char* payload;
+    int64_t     c_begin;
+    int64_t     c_end;
+    int64_t     line_begin;
+    int64_t     line_end;
+    int64_t     nnz_begin;
+    int64_t     nnz_end;
+};
+
+inline rocsparse_chunked_range
+    rocsparse_chunked_make_range(const rocsparse_chunked_header&             header,
+                                 const std::vector<rocsparse_chunked_block>& blocks,
+                                 const char*                                 payload,
+                                 int64_t                                     c_begin,
+                                 int64_t                                     c_end)
+{
+    const int64_t lines = (header.dir == rocsparse_direction_row) ? header.m : header.n;
+
+    rocsparse_chunked_range range;
+    range.payload    = payload;
+    range.c_begin    = c_begin;
+    range.c_end      = c_end;
+    range.line_begin = c_begin * header.chunk_size;
+    range.line_end   = std::min(c_end * header.chunk_size, lines);
+    range.nnz_begin  = (c_begin < header.nchunks) ? blocks[c_begin].nnz_begin : header.nnz;
+    range.nnz_end    = (c_end < header.nchunks) ? blocks[c_end].nnz_begin : header.nnz;
+    return range;
+}
+
+//
+// Row lengths of the chunk c, the last entry of the chunk belongs to the next chunk.
+//
+template <typename I>
+static bool rocsparse_chunked_decode_chunk_ptr(const rocsparse_chunked_header&             header,
+                                               const std::vector<rocsparse_chunked_block>& blocks,
+                                               const rocsparse_chunked_range&              range,
+                                               int64_t                                     c,
+                                               I*                                          ptr)
+{
+    const int64_t lines     = (header.dir == rocsparse_direction_row) ? header.m : header.n;
+    const int64_t row_begin = c * header.chunk_size;
+    const int64_t row_end   = std::min(row_begin + header.chunk_size, lines);
+
+    const rocsparse_chunked_block& block     = blocks[c];
+    const int64_t                  nnz_begin = block.nnz_begin;
+    const int64_t nnz_end = (c + 1 < header.nchunks) ? blocks[c + 1].nnz_begin : header.nnz;
+    if(nnz_begin < range.nnz_begin || nnz_end < nnz_begin || nnz_end > range.nnz_end)
+    {
+        return false;
+    }
+
+    const char* p   = range.payload + (block.offset - blocks[range.c_begin].offset);
+    const char* end = p + block.ptr_bytes;
+    int64_t     pos = nnz_begin;
+    for(int64_t i = row_begin; i < row_end; ++i)
+    {
+        uint64_t len;
+        if(!rocsparse_chunked_get_varint(p, end, len) || len > static_cast<uint64_t>(nnz_end - pos))
+        {
+            return false;
+        }
+        ptr[i - range.line_begin] = static_cast<I>(pos - range.nnz_begin + header.base);
+        pos += len;
+    }
+
+    return p == end && pos == nnz_end;
+}
+
+template <typename V, typename I, typename J>
+static bool rocsparse_chunked_decode_chunk(const rocsparse_chunked_header&             header,
+                                           const std::vector<rocsparse_chunked_block>& blocks,
+                                           const rocsparse_chunked_range&              range,
+                                           int64_t                                     c,
+                                           I*                                          ptr,
+                                           J*                                          ind,
+                                           V*                                          val)
+{
+    if(!rocsparse_chunked_decode_chunk_ptr(header, blocks, range, c, ptr))
+    {
+        return false;
+    }
+
+    const int64_t lines     = (header.dir == rocsparse_direction_row) ? header.m : header.n;
+    const int64_t row_begin = c * header.chunk_size;
+    const int64_t row_end   = std::min(row_begin + header.chunk_size, lines);
+
+    const rocsparse_chunked_block& block     = blocks[c];
+    const int64_t                  nnz_begin = block.nnz_begin - range.nnz_begin;
+    const int64_t                  nnz_end
+        = ((c + 1 < header.nchunks) ? blocks[c + 1].nnz_begin : header.nnz) - range.nnz_begin;
+
+    //
+    // Indices.
+    //
+    const char* p
+        = range.payload + (block.offset - blocks[range.c_begin].offset) + block.ptr_bytes;
+    const char* end = p + block.ind_bytes;
+    for(int64_t i = row_begin; i < row_end; ++i)
+    {
+        const int64_t k_begin = ptr[i - range.line_begin] - header.base;
+        const int64_t k_end
+            = (i + 1 < row_end) ? (ptr[i + 1 - range.line_begin] - header.base) : nnz_end;
+
+        int64_t prev = 0;
+        for(int64_t k = k_begin; k < k_end; ++k)
+        {
+            uint64_t delta;
+            if(!rocsparse_chunked_get_varint(p, end, delta))
+            {
+                return false;
+            }
+            prev += rocsparse_chunked_unzigzag(delta);
+            ind[k] = static_cast<J>(prev);
+        }
+    }
+
+    if(p != end)
+    {
+        return false;
+    }
+
+    //
+    // Values.
+    //
+    end = p + block.val_bytes;
+    return rocsparse_chunked_get_values(p, end, nnz_end - nnz_begin, val + nnz_begin) && p == end;
+}
+
+template <typename V, typename T, typename I, typename J>
+static rocsparse_status rocsparse_chunked_decode(const rocsparse_chunked_header&             header,
+                                                 const std::vector<rocsparse_chunked_block>& blocks,
+                                                 const rocsparse_chunked_range&              range,
+                                                 I*                                          ptr,
+                                                 J*                                          ind,
+                                                 T*                                          val)
+{
+    const bool same_val_type = std::is_same<T, V>();
+
+    host_dense_vector<V> tmp_valv;
+    V*                   tmp_val = (V*)val;
+    if(!same_val_type)
+    {
+        tmp_valv.resize(range.nnz_end - range.nnz_begin);
+        tmp_val = tmp_valv;
+    }
+
+    //
+    // Chunks are independent, decode them in parallel.
+    //
+    int64_t failed = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1) reduction(+ : failed)
+#endif
+    for(int64_t c = range.c_begin; c < range.c_end; ++c)
+    {
+        if(!rocsparse_chunked_decode_chunk(header, blocks, range, c, ptr, ind, tmp_val))
+        {
+            ++failed;
+        }
+    }
+
+    if(failed > 0)
+    {
+        std::cerr << "corrupted chunked file, " << failed << " chunk(s) cannot be decoded."
+                  << std::endl;
+        return rocsparse_status_internal_error;
+    }
+
+    ptr[range.line_end - range.line_begin]
+        = static_cast<I>(range.nnz_end - range.nnz_begin + header.base);
+
+    if(!same_val_type)
+    {
+        return rocsparse_chunked_copy_values(
+            range.nnz_end - range.nnz_begin,
+            val,
+            (const V*)tmp_val,
+            std::integral_constant<bool,
+                                   std::is_arithmetic<T>::value
+                                       == std::is_arithmetic<V>::value>());
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T, typename I, typename J>
+static rocsparse_status
+    rocsparse_chunked_decode_dispatch(const rocsparse_chunked_header&             header,
+                                      const std::vector<rocsparse_chunked_block>& blocks,
+                                      const rocsparse_chunked_range&              range,
+                                      I*                                          ptr,
+                                      J*                                          ind,
+                                      T*                                          val)
+{
+    switch(header.val_type)
+    {
+    case rocsparse_chunked_type_float32:
+    {
+        return rocsparse_chunked_decode<float>(header, blocks, range, ptr, ind, val);
+    }
+    case rocsparse_chunked_type_float64:
+    {
+        return rocsparse_chunked_decode<double>(header, blocks, range, ptr, ind, val);
+    }
+    case rocsparse_chunked_type_complex32:
+    {
+        return rocsparse_chunked_decode<rocsparse_float_complex>(
+            header, blocks, range, ptr, ind, val);
+    }
+    case rocsparse_chunked_type_complex64:
+    {
+        return rocsparse_chunked_decode<rocsparse_double_complex>(
+            header, blocks, range, ptr, ind, val);
+    }
+    }
+
+    return rocsparse_status_internal_error;
+}
+
+rocsparse_importer_chunked::rocsparse_importer_chunked(const std::string& filename_)
+    : m_filename(filename_)
+{
+}
+
+template <typename I, typename J>
+rocsparse_status rocsparse_importer_chunked::import_sparse_gebsx(rocsparse_direction* dir,
+                                                                 rocsparse_direction* dirb,
+                                                                 J*                   mb,
+                                                                 J*                   nb,
+                                                                 I*                   nnzb,
+                                                                 J*                   block_dim_row,
+                                                                 J* block_dim_column,
+                                                                 rocsparse_index_base* base)
+{
+    return rocsparse_status_not_implemented;
+}
+
+template <typename T, typename I, typename J>
+rocsparse_status rocsparse_importer_chunked::import_sparse_gebsx(I* ptr, J* ind, T* val)
+{
+    return rocsparse_status_not_implemented;
+}
+
+template <typename I>
+rocsparse_status rocsparse_importer_chunked::import_sparse_coo(I*                    m,
+                                                               I*                    n,
+                                                               int64_t*              nnz,
+                                                               rocsparse_index_base* base)
+{
+    return rocsparse_status_not_implemented;
+}
+
+template <typename T, typename I>
+rocsparse_status rocsparse_importer_chunked::import_sparse_coo(I* row_ind, I* col_ind, T* val)
+{
+    return rocsparse_status_not_implemented;
+}
+
+template <typename I, typename J>
+rocsparse_status rocsparse_importer_chunked::import_sparse_csx(
+    rocsparse_direction* dir, J* m, J* n, I* nnz, rocsparse_index_base* base)
+{
+    const char* env = getenv("GTEST_LISTENER");
+    if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
+    {
+        std::cout << "Opening file '" << this->m_filename << "' ... " << std::endl;
+    }
+
+    std::ifstream& in = this->m_info_csx.in;
+    in.open(this->m_filename, std::ios::in | std::ios::binary);
+    if(!in.is_open())
+    {
+        missing_file_error_message(this->m_filename.c_str());
+        return rocsparse_status_internal_error;
+    }
+
+    std::string magic;
+    std::getline(in, magic);
+    if(magic != ROCSPARSE_CHUNKED_MAGIC)
+    {
+        return rocsparse_status_internal_error;
+    }
+
+    //
+    // Read the header and the block index.
+    //
+    rocsparse_chunked_header& header = this->m_info_csx.header;
+    in.read((char*)&header, sizeof(rocsparse_chunked_header));
+    if(!in || header.version != rocsparse_chunked_version || header.m < 0 || header.n < 0
+       || header.nnz < 0 || header.chunk_size <= 0
+       || (header.dir != rocsparse_direction_row && header.dir != rocsparse_direction_column)
+       || (header.base != rocsparse_index_base_zero && header.base != rocsparse_index_base_one))
+    {
+        return rocsparse_status_internal_error;
+    }
+
+    const int64_t lines = (header.dir == rocsparse_direction_row) ? header.m : header.n;
+    if(header.nchunks != (lines + header.chunk_size - 1) / header.chunk_size)
+    {
+        return rocsparse_status_internal_error;
+    }
+
+    std::vector<rocsparse_chunked_block>& blocks = this->m_info_csx.blocks;
+    blocks.resize(header.nchunks);
+    in.read((char*)blocks.data(), sizeof(rocsparse_chunked_block) * header.nchunks);
+    if(!in)
+    {
+        return rocsparse_status_internal_error;
+    }
+
+    this->m_info_csx.payload_pos = in.tellg();
+
+    //
+    // The payloads are contiguous and the chunks cover the entries in order, such that any
+    // range of chunks can be located from the block index alone.
+    //
+    if(header.nchunks == 0 && header.nnz != 0)
+    {
+        return rocsparse_status_internal_error;
+    }
+
+    uint64_t payload_bytes = 0;
+    int64_t  nnz_begin     = 0;
+    for(const rocsparse_chunked_block& block : blocks)
+    {
+        const uint64_t block_bytes = block.ptr_bytes + block.ind_bytes + block.val_bytes;
+        if(block.offset != payload_bytes
+           || (&block == blocks.data() ? block.nnz_begin != 0 : block.nnz_begin < nnz_begin)
+           || block.nnz_begin > header.nnz)
+        {
+            return rocsparse_status_internal_error;
+        }
+        payload_bytes += block_bytes;
+        nnz_begin = block.nnz_begin;
+    }
+    this->m_info_csx.payload_bytes = payload_bytes;
+
+    rocsparse_status status;
+    status = rocsparse_type_conversion(header.m, m[0]);
+    if(status != rocsparse_status_success)
+        return status;
+
+    status = rocsparse_type_conversion(header.n, n[0]);
+    if(status != rocsparse_status_success)
+        return status;
+
+    status = rocsparse_type_conversion(header.nnz, nnz[0]);
+    if(status != rocsparse_status_success)
+        return status;
+
+    dir[0]  = static_cast<rocsparse_direction>(header.dir);
+    base[0] = static_cast<rocsparse_index_base>(header.base);
+
+    return rocsparse_status_success;
+}
+
+template <typename T, typename I, typename J>
+rocsparse_status rocsparse_importer_chunked::import_sparse_csx(I* ptr, J* ind, T* val)
+{
+    const rocsparse_chunked_header&             header = this->m_info_csx.header;
+    const std::vector<rocsparse_chunked_block>& blocks = this->m_info_csx.blocks;
+
+    //
+    // Read all payloads at once, they are decoded from memory.
+    //
+    std::vector<char> payload(this->m_info_csx.payload_bytes);
+    this->m_info_csx.in.seekg(this->m_info_csx.payload_pos);
+    this->m_info_csx.in.read(payload.data(), payload.size());
+    const bool read_failed = !this->m_info_csx.in;
+    this->m_info_csx.in.close();
+    if(read_failed)
+    {
+        return rocsparse_status_internal_error;
+    }
+
+    const rocsparse_status status = rocsparse_chunked_decode_dispatch(
+        header,
+        blocks,
+        rocsparse_chunked_make_range(header, blocks, payload.data(), 0, header.nchunks),
+        ptr,
+        ind,
+        val);
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+
+    const char* env = getenv("GTEST_LISTENER");
+    if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
+    {
+        std::cout << "Import done." << std::endl;
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J>
+rocsparse_status
+    rocsparse_importer_chunked::select_sparse_csx_lines(J line_begin_, J line_end_, I* nnz)
+{
+    const rocsparse_chunked_header&             header = this->m_info_csx.header;
+    const std::vector<rocsparse_chunked_block>& blocks = this->m_info_csx.blocks;
+
+    const int64_t lines      = (header.dir == rocsparse_direction_row) ? header.m : header.n;
+    const int64_t line_begin = static_cast<int64_t>(line_begin_);
+    const int64_t line_end   = static_cast<int64_t>(line_end_);
+    if(!this->m_info_csx.in.is_open() || line_begin < 0 || line_end < line_begin
+       || line_end > lines)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    //
+    // Read the payloads of the chunks covering the lines only.
+    //
+    const int64_t c_begin = line_begin / header.chunk_size;
+    const int64_t c_end
+        = std::max(c_begin, (line_end + header.chunk_size - 1) / header.chunk_size);
+
+    const uint64_t payload_begin
+        = (c_begin < header.nchunks) ? blocks[c_begin].offset : this->m_info_csx.payload_bytes;
+    const uint64_t payload_end
+        = (c_end < header.nchunks) ? blocks[c_end].offset : this->m_info_csx.payload_bytes;
+
+    std::vector<char>& payload = this->m_info_csx.range_payload;
+    payload.resize(payload_end - payload_begin);
+    this->m_info_csx.in.seekg(this->m_info_csx.payload_pos
+                              + static_cast<std::streamoff>(payload_begin));
+    this->m_info_csx.in.read(payload.data(), payload.size());
+    if(!this->m_info_csx.in)
+    {
+        return rocsparse_status_internal_error;
+    }
+
+    //
+    // The row lengths give the number of entries of the lines.
+    //
+    const rocsparse_chunked_range range
+        = rocsparse_chunked_make_range(header, blocks, payload.data(), c_begin, c_end);
+
+    std::vector<int64_t> range_ptr(range.line_end - range.line_begin + 1);
+    for(int64_t c = c_begin; c < c_end; ++c)
+    {
+        if(!rocsparse_chunked_decode_chunk_ptr(header, blocks, range, c, range_ptr.data()))
+        {
+            std::cerr << "corrupted chunked file, chunk " << c << " cannot be decoded."
+                      << std::endl;
+            return rocsparse_status_internal_error;
+        }
+    }
+    range_ptr[range.line_end - range.line_begin] = range.nnz_end - range.nnz_begin + header.base;
+
+    this->m_info_csx.range_c_begin    = c_begin;
+    this->m_info_csx.range_c_end      = c_end;
+    this->m_info_csx.range_line_begin = line_begin;
+    this->m_info_csx.range_line_end   = line_end;
+
+    return rocsparse_type_conversion(range_ptr[line_end - range.line_begin]
+                                         - range_ptr[line_begin - range.line_begin],
+                                     nnz[0]);
+}
+
+template <typename T, typename I, typename J>
+rocsparse_status rocsparse_importer_chunked::import_sparse_csx_lines(I* ptr, J* ind, T* val)
+{
+    const rocsparse_chunked_header&             header = this->m_info_csx.header;
+    const std::vector<rocsparse_chunked_block>& blocks = this->m_info_csx.blocks;
+
+    const rocsparse_chunked_range range
+        = rocsparse_chunked_make_range(header,
+                                       blocks,
+                                       this->m_info_csx.range_payload.data(),
+                                       this->m_info_csx.range_c_begin,
+                                       this->m_info_csx.range_c_end);
+
+    //
+    // Decode the chunks covering the lines, and extract the lines.
+    //
+    std::vector<I> tmp_ptr(range.line_end - range.line_begin + 1);
+    std::vector<J> tmp_ind(range.nnz_end - range.nnz_begin);
+    std::vector<T> tmp_val(range.nnz_end - range.nnz_begin);
+
+    const rocsparse_status status = rocsparse_chunked_decode_dispatch(
+        header, blocks, range, tmp_ptr.data(), tmp_ind.data(), tmp_val.data());
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+
+    const int64_t first  = this->m_info_csx.range_line_begin - range.line_begin;
+    const int64_t nlines = this->m_info_csx.range_line_end - this->m_info_csx.range_line_begin;
+    const int64_t shift  = static_cast<int64_t>(tmp_ptr[first]) - header.base;
+    const int64_t nnz    = static_cast<int64_t>(tmp_ptr[first + nlines]) - tmp_ptr[first];
+
+    for(int64_t i = 0; i <= nlines; ++i)
+    {
+        ptr[i] = static_cast<I>(tmp_ptr[first + i] - shift);
+    }
+
+    std::copy(tmp_ind.begin() + shift, tmp_ind.begin() + shift + nnz, ind);
+    std::copy(tmp_val.begin() + shift, tmp_val.begin() + shift + nnz, val);
+
+    return rocsparse_status_success;
+}
+
+#define INSTANTIATE_TIJ(T, I, J)                                                               \
+    template rocsparse_status rocsparse_importer_chunked::import_sparse_csx(I*, J*, T*);       \
+    template rocsparse_status rocsparse_importer_chunked::import_sparse_csx_lines(I*, J*, T*); \
+    template rocsparse_status rocsparse_importer_chunked::import_sparse_gebsx(I*, J*, T*)
+
+#define INSTANTIATE_TI(T, I)                                                 \
+    template rocsparse_status rocsparse_importer_chunked::import_sparse_coo( \
+        I* row_ind, I* col_ind, T* val)
+
+#define INSTANTIATE_I(I)                                                     \
+    template rocsparse_status rocsparse_importer_chunked::import_sparse_coo( \
+        I* m, I* n, int64_t* nnz, rocsparse_index_base* base)
+
+#define INSTANTIATE_IJ(I, J)                                                       \
+    template rocsparse_status rocsparse_importer_chunked::import_sparse_csx(       \
+        rocsparse_direction*, J*, J*, I*, rocsparse_index_base*);                  \
+    template rocsparse_status rocsparse_importer_chunked::select_sparse_csx_lines( \
+        J, J, I*);                                                                 \
+    template rocsparse_status rocsparse_importer_chunked::import_sparse_gebsx( \
+        rocsparse_direction*, rocsparse_direction*, J*, J*, I*, J*, J*, rocsparse_index_base*)
+
+INSTANTIATE_I(int32_t);
+INSTANTIATE_I(int64_t);
+
+INSTANTIATE_IJ(int32_t, int32_t);
+INSTANTIATE_IJ(int64_t, int32_t);
+INSTANTIATE_IJ(int64_t, int64_t);
+
+INSTANTIATE_TIJ(int8_t, int32_t, int32_t);
+INSTANTIATE_TIJ(int8_t, int64_t, int32_t);
+INSTANTIATE_TIJ(int8_t, int64_t, int64_t);
+
+INSTANTIATE_TIJ(float, int32_t, int32_t);
+INSTANTIATE_TIJ(float, int64_t, int32_t);
+INSTANTIATE_TIJ(float, int64_t, int64_t);
+
+INSTANTIATE_TIJ(double, int32_t, int32_t);
+INSTANTIATE_TIJ(double, int64_t, int32_t);
+INSTANTIATE_TIJ(double, int64_t, int64_t);
+
+INSTANTIATE_TIJ(rocsparse_float_complex, int32_t, int32_t);
+INSTANTIATE_TIJ(rocsparse_float_complex, int64_t, int32_t);
+INSTANTIATE_TIJ(rocsparse_float_complex, int64_t, int64_t);
+
+INSTANTIATE_TIJ(rocsparse_double_complex, int32_t, int32_t);
+INSTANTIATE_TIJ(rocsparse_double_complex, int64_t, int32_t);
+INSTANTIATE_TIJ(rocsparse_double_complex, int64_t, int64_t);
+
+INSTANTIATE_TI(int8_t, int32_t);
+INSTANTIATE_TI(int8_t, int64_t);
+
+INSTANTIATE_TI(float, int32_t);
+INSTANTIATE_TI(float, int64_t);
+
+INSTANTIATE_TI(double, int32_t);
+INSTANTIATE_TI(double, int64_t);
+
+INSTANTIATE_TI(rocsparse_float_complex, int32_t);
+INSTANTIATE_TI(rocsparse_float_complex, int64_t);
+
+INSTANTIATE_TI(rocsparse_double_complex, int32_t);
+INSTANTIATE_TI(rocsparse_double_complex, int64_t);
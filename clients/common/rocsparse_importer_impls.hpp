@@ -23,6 +23,7 @@
  * ************************************************************************ */
 #pragma once
 
+#include "rocsparse_importer_chunked.hpp"
 #include "rocsparse_importer_matrixmarket.hpp"
 #include "rocsparse_importer_mlbsr.hpp"
 #include "rocsparse_importer_mlcsr.hpp"
@@ -29,6 +29,7 @@
 #include "utility.hpp"
 
 #include <chrono>
+#include <cstdio>
 #include <cstdlib>
 
 #ifdef WIN32
@@ -44,6 +45,7 @@ namespace fs = std::experimental::filesystem;
 
 #else
 #include <fcntl.h>
+#include <unistd.h>
 #endif
 
 /* ============================================================================================ */
@@ -127,6 +129,43 @@ std::string rocsparse_datapath()
     return rocsparse_exepath();
 }
 
+/* ============================================================================================ */
+// Create an empty temporary file and return its name
+std::string rocsparse_tmpname()
+{
+#ifdef WIN32
+    return std::string(std::tmpnam(nullptr));
+#else
+    char      tmp[] = "/tmp/rocsparse-XXXXXX";
+    const int fd    = mkstemp(tmp);
+    if(fd == -1)
+    {
+        perror("Cannot open temporary file");
+        exit(EXIT_FAILURE);
+    }
+    close(fd);
+    return tmp;
+#endif
+}
+
+/* ============================================================================================ */
+// Set an environment variable, or remove it if value is nullptr
+void rocsparse_setenv(const char* name, const char* value)
+{
+#ifdef WIN32
+    _putenv_s(name, (value != nullptr) ? value : "");
+#else
+    if(value != nullptr)
+    {
+        setenv(name, value, 1);
+    }
+    else
+    {
+        unsetenv(name);
+    }
+#endif
+}
+
 /* ============================================================================================ */
 /*  timing:*/
 
@@ -292,3 +292,33 @@ inline rocsparse_status auto_testing_bad_arg_get_status(rocsparse_spgemm_stage&
 {
     return rocsparse_status_invalid_value;
 }
+
+template <>
+inline rocsparse_status auto_testing_bad_arg_get_status(rocsparse_spgemm_mask& p)
+{
+    return rocsparse_status_invalid_value;
+}
+
+template <>
+inline rocsparse_status auto_testing_bad_arg_get_status(rocsparse_spgeam_alg& p)
+{
+    return rocsparse_status_invalid_value;
+}
+
+template <>
+inline rocsparse_status auto_testing_bad_arg_get_status(rocsparse_spgeam_stage& p)
+{
+    return rocsparse_status_invalid_value;
+}
+
+template <>
+inline rocsparse_status auto_testing_bad_arg_get_status(rocsparse_semiring& p)
+{
+    return rocsparse_status_invalid_value;
+}
+
+template <>
+inline rocsparse_status auto_testing_bad_arg_get_status(rocsparse_spmv_reduction& p)
+{
+    return rocsparse_status_invalid_value;
+}
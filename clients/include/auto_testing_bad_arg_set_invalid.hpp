@@ -285,3 +285,33 @@ inline void auto_testing_bad_arg_set_invalid(rocsparse_spgemm_stage& p)
 {
     p = (rocsparse_spgemm_stage)-1;
 }
+
+template <>
+inline void auto_testing_bad_arg_set_invalid(rocsparse_spgemm_mask& p)
+{
+    p = (rocsparse_spgemm_mask)-1;
+}
+
+template <>
+inline void auto_testing_bad_arg_set_invalid(rocsparse_spgeam_alg& p)
+{
+    p = (rocsparse_spgeam_alg)-1;
+}
+
+template <>
+inline void auto_testing_bad_arg_set_invalid(rocsparse_spgeam_stage& p)
+{
+    p = (rocsparse_spgeam_stage)-1;
+}
+
+template <>
+inline void auto_testing_bad_arg_set_invalid(rocsparse_semiring& p)
+{
+    p = (rocsparse_semiring)-1;
+}
+
+template <>
+inline void auto_testing_bad_arg_set_invalid(rocsparse_spmv_reduction& p)
+{
+    p = (rocsparse_spmv_reduction)-1;
+}
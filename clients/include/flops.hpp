@@ -346,4 +346,47 @@ constexpr double csrgemm_gflop_count(J                    M,
     return flops / 1e9;
 }
 
+template <typename T, typename I = rocsparse_int, typename J = rocsparse_int>
+constexpr double csrrap_gflop_count(J                    M,
+                                    const I*             csr_row_ptr_R,
+                                    const J*             csr_col_ind_R,
+                                    const I*             csr_row_ptr_A,
+                                    const J*             csr_col_ind_A,
+                                    const I*             csr_row_ptr_P,
+                                    rocsparse_index_base baseR,
+                                    rocsparse_index_base baseA)
+{
+    // Flop counter
+    double flops = 0.0;
+
+    // Loop over rows of R
+    for(J i = 0; i < M; ++i)
+    {
+        I row_begin_R = csr_row_ptr_R[i] - baseR;
+        I row_end_R   = csr_row_ptr_R[i + 1] - baseR;
+
+        // Loop over columns of R
+        for(I j = row_begin_R; j < row_end_R; ++j)
+        {
+            // Current column of R
+            J col_R = csr_col_ind_R[j] - baseR;
+
+            I row_begin_A = csr_row_ptr_A[col_R] - baseA;
+            I row_end_A   = csr_row_ptr_A[col_R + 1] - baseA;
+
+            // Loop over columns of A in row col_R
+            for(I k = row_begin_A; k < row_end_A; ++k)
+            {
+                // Current column of A
+                J col_A = csr_col_ind_A[k] - baseA;
+
+                // Count flops generated by r_ij * a_jk * P
+                flops += 2.0 * (csr_row_ptr_P[col_A + 1] - csr_row_ptr_P[col_A]) + 1.0;
+            }
+        }
+    }
+
+    return flops / 1e9;
+}
+
 #endif // FLOPS_HPP
@@ -122,6 +122,28 @@ constexpr double csrmv_gbyte_count(J M, J N, I nnz, bool beta = false)
     return csrmv_gbyte_count<T, T, T>(M, N, nnz, beta);
 }
 
+template <typename T, typename I, typename J>
+constexpr double csrmv_batched_gbyte_count(J    M,
+                                           J    N,
+                                           I    nnz,
+                                           J    batch_count_A,
+                                           J    batch_count_x,
+                                           J    batch_count_y,
+                                           bool beta = false)
+{
+    // read A matrix, the row offsets are shared by all batches
+    size_t readA = (M + 1) * sizeof(I) + batch_count_A * (nnz * sizeof(J) + nnz * sizeof(T));
+
+    // read x vector
+    size_t readx = batch_count_x * N * sizeof(T);
+
+    // read and write y vector
+    size_t ready  = batch_count_y * (beta ? M : 0) * sizeof(T);
+    size_t writey = batch_count_y * M * sizeof(T);
+
+    return (readA + readx + ready + writey) / 1e9;
+}
+
 template <typename A, typename X, typename Y, typename I, typename J>
 constexpr double cscmv_gbyte_count(J M, J N, I nnz, bool beta = false)
 {
@@ -452,6 +474,17 @@ constexpr double csrgemm_gbyte_count(
     return (size_A + size_B + size_C + size_D) / 1e9;
 }
 
+template <typename T, typename I = rocsparse_int, typename J = rocsparse_int>
+constexpr double csrrap_gbyte_count(J M, J N, J K, I nnz_R, I nnz_A, I nnz_P, I nnz_C)
+{
+    double size_R = (M + 1.0) * sizeof(I) + nnz_R * sizeof(J) + nnz_R * sizeof(T);
+    double size_A = (N + 1.0) * sizeof(I) + nnz_A * sizeof(J) + nnz_A * sizeof(T);
+    double size_P = (N + 1.0) * sizeof(I) + nnz_P * sizeof(J) + nnz_P * sizeof(T);
+    double size_C = (M + 1.0) * sizeof(I) + nnz_C * sizeof(J) + nnz_C * sizeof(T);
+
+    return (size_R + size_A + size_P + size_C) / 1e9;
+}
+
 template <typename T, typename I = rocsparse_int, typename J = rocsparse_int>
 constexpr double bsrgemm_gbyte_count(J        Mb,
                                      J        Nb,
@@ -484,6 +517,14 @@ constexpr double bsrgemm_gbyte_count(J        Mb,
  *    precond SPARSE
  * ===========================================================================
  */
+template <typename T>
+constexpr double bjac_apply_gbyte_count(rocsparse_int M, rocsparse_int block_dim, bool beta)
+{
+    rocsparse_int Mb = (M - 1) / block_dim + 1;
+
+    return ((double(block_dim) * block_dim * Mb + (beta ? 3.0 : 2.0) * M) * sizeof(T)) / 1e9;
+}
+
 template <typename T>
 constexpr double bsric0_gbyte_count(rocsparse_int Mb, rocsparse_int block_dim, rocsparse_int nnzb)
 {
@@ -795,6 +836,19 @@ constexpr double
     return (reads + writes) / 1e9;
 }
 
+template <typename T>
+constexpr double
+    prune_csr2csr_by_strength_gbyte_count(rocsparse_int M, rocsparse_int nnz_A, rocsparse_int nnz_C)
+{
+    // reads, including the diagonal entries gathered for each column
+    size_t reads = (M + 1 + nnz_A) * sizeof(rocsparse_int) + (M + 2 * nnz_A) * sizeof(T);
+
+    // writes
+    size_t writes = (M + 1 + nnz_C) * sizeof(rocsparse_int) + (M + nnz_C) * sizeof(T);
+
+    return (reads + writes) / 1e9;
+}
+
 template <typename T>
 constexpr double prune_csr2csr_by_percentage_gbyte_count(rocsparse_int M,
                                                          rocsparse_int nnz_A,
@@ -1020,12 +1020,76 @@ REAL_COMPLEX_TEMPLATE(csrgemm_numeric,
                       const rocsparse_mat_info  info_C,
                       void*                     temp_buffer);
 
+// csrrap
+REAL_COMPLEX_TEMPLATE(csrrap,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             n,
+                      rocsparse_int             k,
+                      const rocsparse_mat_descr descr_R,
+                      rocsparse_int             nnz_R,
+                      const T*                  csr_val_R,
+                      const rocsparse_int*      csr_row_ptr_R,
+                      const rocsparse_int*      csr_col_ind_R,
+                      const rocsparse_mat_descr descr_A,
+                      rocsparse_int             nnz_A,
+                      const T*                  csr_val_A,
+                      const rocsparse_int*      csr_row_ptr_A,
+                      const rocsparse_int*      csr_col_ind_A,
+                      const rocsparse_mat_descr descr_P,
+                      rocsparse_int             nnz_P,
+                      const T*                  csr_val_P,
+                      const rocsparse_int*      csr_row_ptr_P,
+                      const rocsparse_int*      csr_col_ind_P,
+                      const rocsparse_mat_descr descr_C,
+                      T*                        csr_val_C,
+                      const rocsparse_int*      csr_row_ptr_C,
+                      rocsparse_int*            csr_col_ind_C);
+
 /*
  * ===========================================================================
  *    precond SPARSE
  * ===========================================================================
  */
 
+// bjac
+REAL_COMPLEX_TEMPLATE(bsrbjac_setup,
+                      rocsparse_handle          handle,
+                      rocsparse_direction       dir,
+                      rocsparse_int             mb,
+                      rocsparse_int             nnzb,
+                      const rocsparse_mat_descr descr,
+                      const T*                  bsr_val,
+                      const rocsparse_int*      bsr_row_ptr,
+                      const rocsparse_int*      bsr_col_ind,
+                      rocsparse_int             block_dim,
+                      T*                        inv_diag_val,
+                      rocsparse_int*            singular_block);
+
+REAL_COMPLEX_TEMPLATE(csrbjac_setup,
+                      rocsparse_handle          handle,
+                      rocsparse_direction       dir,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const rocsparse_mat_descr descr,
+                      const T*                  csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      rocsparse_int             block_dim,
+                      T*                        inv_diag_val,
+                      rocsparse_int*            singular_block);
+
+REAL_COMPLEX_TEMPLATE(bjac_apply,
+                      rocsparse_handle    handle,
+                      rocsparse_direction dir,
+                      rocsparse_int       m,
+                      rocsparse_int       block_dim,
+                      const T*            alpha,
+                      const T*            inv_diag_val,
+                      const T*            x,
+                      const T*            beta,
+                      T*                  y);
+
 // bsric0
 REAL_COMPLEX_TEMPLATE(bsric0_buffer_size,
                       rocsparse_handle          handle,
@@ -1156,6 +1220,22 @@ REAL_COMPLEX_TEMPLATE(csric0,
                       rocsparse_solve_policy    policy,
                       void*                     temp_buffer);
 
+REAL_COMPLEX_TEMPLATE(csric0_refactorize,
+                      rocsparse_handle          handle,
+                      const rocsparse_mat_descr descr,
+                      T*                        csr_val,
+                      rocsparse_mat_info        info,
+                      void*                     temp_buffer);
+
+REAL_COMPLEX_TEMPLATE(csric0_refactorize_batched,
+                      rocsparse_handle          handle,
+                      const rocsparse_mat_descr descr,
+                      rocsparse_int             batch_count,
+                      T*                        csr_val,
+                      rocsparse_int             batch_stride,
+                      rocsparse_mat_info        info,
+                      void*                     temp_buffer);
+
 // csritilu0_compute
 REAL_COMPLEX_TEMPLATE(csritilu0_compute,
                       rocsparse_handle     handle,
@@ -1226,6 +1306,22 @@ REAL_COMPLEX_TEMPLATE(csrilu0,
                       rocsparse_solve_policy    policy,
                       void*                     temp_buffer);
 
+REAL_COMPLEX_TEMPLATE(csrilu0_refactorize,
+                      rocsparse_handle          handle,
+                      const rocsparse_mat_descr descr,
+                      T*                        csr_val,
+                      rocsparse_mat_info        info,
+                      void*                     temp_buffer);
+
+REAL_COMPLEX_TEMPLATE(csrilu0_refactorize_batched,
+                      rocsparse_handle          handle,
+                      const rocsparse_mat_descr descr,
+                      rocsparse_int             batch_count,
+                      T*                        csr_val,
+                      rocsparse_int             batch_stride,
+                      rocsparse_mat_info        info,
+                      void*                     temp_buffer);
+
 REAL_COMPLEX_TEMPLATE(gtsv_buffer_size,
                       rocsparse_handle handle,
                       rocsparse_int    m,
@@ -1294,6 +1390,29 @@ REAL_COMPLEX_TEMPLATE(gtsv_no_pivot_strided_batch,
                       rocsparse_int    batch_stride,
                       void*            temp_buffer);
 
+// gtsv_strided_batch
+REAL_COMPLEX_TEMPLATE(gtsv_strided_batch_buffer_size,
+                      rocsparse_handle handle,
+                      rocsparse_int    m,
+                      const T*         dl,
+                      const T*         d,
+                      const T*         du,
+                      const T*         x,
+                      rocsparse_int    batch_count,
+                      rocsparse_int    batch_stride,
+                      size_t*          buffer_size);
+
+REAL_COMPLEX_TEMPLATE(gtsv_strided_batch,
+                      rocsparse_handle handle,
+                      rocsparse_int    m,
+                      const T*         dl,
+                      const T*         d,
+                      const T*         du,
+                      T*               x,
+                      rocsparse_int    batch_count,
+                      rocsparse_int    batch_stride,
+                      void*            temp_buffer);
+
 // gtsv_interleaved_batch
 REAL_COMPLEX_TEMPLATE(gtsv_interleaved_batch_buffer_size,
                       rocsparse_handle               handle,
@@ -1553,6 +1672,15 @@ REAL_COMPLEX_TEMPLATE(csr2csc,
                       rocsparse_action     copy_values,
                       rocsparse_index_base idx_base,
                       void*                temp_buffer);
+
+REAL_COMPLEX_TEMPLATE(csr2csc_numeric,
+                      rocsparse_handle   handle,
+                      rocsparse_int      m,
+                      rocsparse_int      n,
+                      rocsparse_int      nnz,
+                      const T*           csr_val,
+                      T*                 csc_val,
+                      rocsparse_mat_info info);
 // gebsr2gebsc
 REAL_COMPLEX_TEMPLATE(gebsr2gebsc_buffer_size,
                       rocsparse_handle     handle,
@@ -1583,6 +1711,17 @@ REAL_COMPLEX_TEMPLATE(gebsr2gebsc,
                       rocsparse_index_base idx_base,
                       void*                temp_buffer);
 
+REAL_COMPLEX_TEMPLATE(gebsr2gebsc_numeric,
+                      rocsparse_handle   handle,
+                      rocsparse_int      mb,
+                      rocsparse_int      nb,
+                      rocsparse_int      nnzb,
+                      const T*           bsr_val,
+                      rocsparse_int      row_block_dim,
+                      rocsparse_int      col_block_dim,
+                      T*                 bsc_val,
+                      rocsparse_mat_info info);
+
 // csr2ell
 REAL_COMPLEX_TEMPLATE(csr2ell,
                       rocsparse_handle          handle,
@@ -1883,6 +2022,50 @@ REAL_TEMPLATE(prune_csr2csr_by_percentage,
               rocsparse_mat_info        info,
               void*                     buffer);
 
+// prune_csr2csr_by_strength_buffer_size
+REAL_TEMPLATE(prune_csr2csr_by_strength_buffer_size,
+              rocsparse_handle          handle,
+              rocsparse_int             m,
+              rocsparse_int             nnz_A,
+              const rocsparse_mat_descr csr_descr_A,
+              const T*                  csr_val_A,
+              const rocsparse_int*      csr_row_ptr_A,
+              const rocsparse_int*      csr_col_ind_A,
+              const T*                  theta,
+              const rocsparse_mat_descr csr_descr_C,
+              size_t*                   buffer_size);
+
+// prune_csr2csr_by_strength_nnz
+REAL_TEMPLATE(prune_csr2csr_by_strength_nnz,
+              rocsparse_handle          handle,
+              rocsparse_int             m,
+              rocsparse_int             nnz_A,
+              const rocsparse_mat_descr csr_descr_A,
+              const T*                  csr_val_A,
+              const rocsparse_int*      csr_row_ptr_A,
+              const rocsparse_int*      csr_col_ind_A,
+              const T*                  theta,
+              const rocsparse_mat_descr csr_descr_C,
+              rocsparse_int*            csr_row_ptr_C,
+              rocsparse_int*            nnz_total_dev_host_ptr,
+              void*                     temp_buffer);
+
+// prune_csr2csr_by_strength
+REAL_TEMPLATE(prune_csr2csr_by_strength,
+              rocsparse_handle          handle,
+              rocsparse_int             m,
+              rocsparse_int             nnz_A,
+              const rocsparse_mat_descr csr_descr_A,
+              const T*                  csr_val_A,
+              const rocsparse_int*      csr_row_ptr_A,
+              const rocsparse_int*      csr_col_ind_A,
+              const T*                  theta,
+              const rocsparse_mat_descr csr_descr_C,
+              T*                        csr_val_C,
+              const rocsparse_int*      csr_row_ptr_C,
+              rocsparse_int*            csr_col_ind_C,
+              void*                     temp_buffer);
+
 /*
  * ===========================================================================
  *    reordering SPARSE
@@ -0,0 +1,57 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocsparse-types.h"
+#include <iostream>
+#include <string>
+#include <vector>
+
+//
+// Unique call of a bench log, as written by the layer mode rocsparse_layer_mode_log_bench.
+//
+struct rocsparse_bench_log_call
+{
+    std::vector<std::string> args{};
+    std::string              routine{};
+    int64_t                  count{};
+};
+
+//
+// @brief Parse a bench log.
+//
+// @details
+// Each line holding a rocsparse-bench command line is a recorded call, other lines are
+// skipped. The arguments following the executable are kept and identical calls are
+// gathered, in order of their first occurrence. A recorded call without function
+// (-f, --function) is rejected.
+//
+// @param[in]  in     stream of the log.
+// @param[out] calls  unique calls of the log.
+// @param[out] nlines number of recorded calls.
+//
+rocsparse_status rocsparse_bench_log_parse(std::istream&                          in,
+                                           std::vector<rocsparse_bench_log_call>& calls,
+                                           int64_t&                               nlines);
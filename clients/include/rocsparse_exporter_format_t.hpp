@@ -33,7 +33,8 @@ struct rocsparse_exporter_format_t
     FORMAT(matrixmarket)      \
     FORMAT(rocalution)        \
     FORMAT(ascii)             \
-    FORMAT(rocsparseio)
+    FORMAT(rocsparseio)       \
+    FORMAT(chunked)
 
     typedef enum _
     {
@@ -61,6 +62,8 @@ public:
             return ".csr";
         case rocsparseio:
             return ".bin";
+        case chunked:
+            return ".zbin";
         case ascii:
             return ".txt";
         case unknown:
@@ -178,6 +178,9 @@ namespace testing
     TESTING_COMPUTE_TEMPLATE(csrgemm)
     TESTING_TEMPLATE(csrgemm_symbolic)
     TESTING_COMPUTE_TEMPLATE(csrgemm_numeric)
+    TESTING_TEMPLATE(csrrap_buffer_size)
+    TESTING_TEMPLATE(csrrap_nnz)
+    TESTING_COMPUTE_TEMPLATE(csrrap)
 
     /*
     * ===========================================================================
@@ -185,6 +188,9 @@ namespace testing
     * ===========================================================================
     */
 
+    TESTING_COMPUTE_TEMPLATE(bsrbjac_setup)
+    TESTING_COMPUTE_TEMPLATE(csrbjac_setup)
+    TESTING_COMPUTE_TEMPLATE(bjac_apply)
     TESTING_TEMPLATE(bsric0_zero_pivot)
     TESTING_COMPUTE_TEMPLATE(bsric0_buffer_size)
     TESTING_COMPUTE_TEMPLATE(bsric0_analysis)
@@ -204,6 +210,9 @@ namespace testing
     TESTING_COMPUTE_TEMPLATE(csric0_analysis)
     TESTING_TEMPLATE(csric0_clear)
     TESTING_COMPUTE_TEMPLATE(csric0)
+    TESTING_COMPUTE_TEMPLATE(csric0_refactorize)
+    TESTING_TEMPLATE(csric0_refactorize_batched_buffer_size)
+    TESTING_COMPUTE_TEMPLATE(csric0_refactorize_batched)
     TESTING_TEMPLATE(csrilu0_zero_pivot)
     TESTING_TEMPLATE(csrilu0_singular_pivot)
     TESTING_COMPUTE_TEMPLATE(csrilu0_numeric_boost)
@@ -213,12 +222,17 @@ namespace testing
     TESTING_COMPUTE_TEMPLATE(csrilu0_analysis)
     TESTING_TEMPLATE(csrilu0_clear)
     TESTING_COMPUTE_TEMPLATE(csrilu0)
+    TESTING_COMPUTE_TEMPLATE(csrilu0_refactorize)
+    TESTING_TEMPLATE(csrilu0_refactorize_batched_buffer_size)
+    TESTING_COMPUTE_TEMPLATE(csrilu0_refactorize_batched)
     TESTING_COMPUTE_TEMPLATE(gtsv_buffer_size)
     TESTING_COMPUTE_TEMPLATE(gtsv)
     TESTING_COMPUTE_TEMPLATE(gtsv_no_pivot_buffer_size)
     TESTING_COMPUTE_TEMPLATE(gtsv_no_pivot)
     TESTING_COMPUTE_TEMPLATE(gtsv_no_pivot_strided_batch_buffer_size)
     TESTING_COMPUTE_TEMPLATE(gtsv_no_pivot_strided_batch)
+    TESTING_COMPUTE_TEMPLATE(gtsv_strided_batch_buffer_size)
+    TESTING_COMPUTE_TEMPLATE(gtsv_strided_batch)
     TESTING_COMPUTE_TEMPLATE(gtsv_interleaved_batch_buffer_size)
     TESTING_COMPUTE_TEMPLATE(gtsv_interleaved_batch)
     TESTING_COMPUTE_TEMPLATE(gpsv_interleaved_batch_buffer_size)
@@ -247,8 +261,10 @@ namespace testing
     TESTING_TEMPLATE(csr2coo)
     TESTING_TEMPLATE(csr2csc_buffer_size)
     TESTING_COMPUTE_TEMPLATE(csr2csc)
+    TESTING_COMPUTE_TEMPLATE(csr2csc_numeric)
     TESTING_COMPUTE_TEMPLATE(gebsr2gebsc_buffer_size)
     TESTING_COMPUTE_TEMPLATE(gebsr2gebsc)
+    TESTING_COMPUTE_TEMPLATE(gebsr2gebsc_numeric)
     TESTING_TEMPLATE(csr2ell_width)
     TESTING_COMPUTE_TEMPLATE(csr2ell)
     TESTING_COMPUTE_TEMPLATE(csr2hyb)
@@ -265,6 +281,9 @@ namespace testing
     TESTING_COMPUTE_TEMPLATE(prune_csr2csr_by_percentage_buffer_size)
     TESTING_COMPUTE_TEMPLATE(prune_csr2csr_nnz_by_percentage)
     TESTING_COMPUTE_TEMPLATE(prune_csr2csr_by_percentage)
+    TESTING_COMPUTE_TEMPLATE(prune_csr2csr_by_strength_buffer_size)
+    TESTING_COMPUTE_TEMPLATE(prune_csr2csr_by_strength_nnz)
+    TESTING_COMPUTE_TEMPLATE(prune_csr2csr_by_strength)
     TESTING_TEMPLATE(coo2csr)
     TESTING_TEMPLATE(ell2csr_nnz)
     TESTING_COMPUTE_TEMPLATE(ell2csr)
@@ -299,10 +318,15 @@ namespace testing
     TESTING_TEMPLATE(dense_to_sparse)
     TESTING_TEMPLATE(spvv)
     TESTING_TEMPLATE(spmv)
+    TESTING_TEMPLATE(spmv_semiring)
+    TESTING_TEMPLATE(spmv_fused)
     TESTING_TEMPLATE(spsv)
     TESTING_TEMPLATE(spsm)
     TESTING_TEMPLATE(spmm)
+    TESTING_TEMPLATE(spgeam)
     TESTING_TEMPLATE(spgemm)
+    TESTING_TEMPLATE(spgemm_masked)
+    TESTING_TEMPLATE(spgemm_semiring)
     TESTING_TEMPLATE(sddmm)
     TESTING_TEMPLATE(sddmm_buffer_size)
     TESTING_TEMPLATE(sddmm_preprocess)
@@ -312,6 +336,7 @@ namespace testing
     *    reordering SPARSE
     * ===========================================================================
     */
+    TESTING_TEMPLATE(csraggregate)
     TESTING_COMPUTE_TEMPLATE(csrcolor)
 }
 
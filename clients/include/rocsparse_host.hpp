@@ -293,6 +293,35 @@ void host_csrmv(rocsparse_operation   trans,
                 rocsparse_spmv_alg    algo,
                 bool                  force_conj);
 
+template <typename T, typename I, typename J>
+void host_csrmv_semiring(rocsparse_semiring   semiring,
+                         J                    M,
+                         J                    N,
+                         I                    nnz,
+                         T                    alpha,
+                         const I*             csr_row_ptr,
+                         const J*             csr_col_ind,
+                         const T*             csr_val,
+                         const T*             x,
+                         T                    beta,
+                         T*                   y,
+                         rocsparse_index_base base);
+
+template <typename T, typename I, typename J>
+void host_csrmv_fused(rocsparse_spmv_reduction reduction,
+                      J                        M,
+                      J                        N,
+                      I                        nnz,
+                      T                        alpha,
+                      const I*                 csr_row_ptr,
+                      const J*                 csr_col_ind,
+                      const T*                 csr_val,
+                      const T*                 x,
+                      T                        beta,
+                      T*                       y,
+                      T*                       result,
+                      rocsparse_index_base     base);
+
 template <typename T, typename I, typename J, typename A, typename X, typename Y>
 void host_cscmv(rocsparse_operation trans,
                 J                   M,
@@ -826,6 +855,102 @@ void host_csrgemm(J                    M,
                   rocsparse_index_base base_C,
                   rocsparse_index_base base_D);
 
+template <typename T, typename I = rocsparse_int, typename J = rocsparse_int>
+void host_csrgemm_masked_nnz(J                     M,
+                             J                     N,
+                             J                     K,
+                             rocsparse_spgemm_mask mask,
+                             const I*              csr_row_ptr_A,
+                             const J*              csr_col_ind_A,
+                             const I*              csr_row_ptr_B,
+                             const J*              csr_col_ind_B,
+                             const I*              csr_row_ptr_M,
+                             const J*              csr_col_ind_M,
+                             I*                    csr_row_ptr_C,
+                             I*                    nnz_C,
+                             rocsparse_index_base  base_A,
+                             rocsparse_index_base  base_B,
+                             rocsparse_index_base  base_M,
+                             rocsparse_index_base  base_C);
+
+template <typename T, typename I = rocsparse_int, typename J = rocsparse_int>
+void host_csrgemm_masked(J                     M,
+                         J                     N,
+                         J                     K,
+                         rocsparse_spgemm_mask mask,
+                         const T*              alpha,
+                         const I*              csr_row_ptr_A,
+                         const J*              csr_col_ind_A,
+                         const T*              csr_val_A,
+                         const I*              csr_row_ptr_B,
+                         const J*              csr_col_ind_B,
+                         const T*              csr_val_B,
+                         const I*              csr_row_ptr_M,
+                         const J*              csr_col_ind_M,
+                         const I*              csr_row_ptr_C,
+                         J*                    csr_col_ind_C,
+                         T*                    csr_val_C,
+                         rocsparse_index_base  base_A,
+                         rocsparse_index_base  base_B,
+                         rocsparse_index_base  base_M,
+                         rocsparse_index_base  base_C);
+
+template <typename T, typename I = rocsparse_int, typename J = rocsparse_int>
+void host_spgeam_nnz(J                    M,
+                     J                    N,
+                     const I*             ptr_A,
+                     const J*             ind_A,
+                     const I*             ptr_B,
+                     const J*             ind_B,
+                     I*                   ptr_C,
+                     I*                   nnz_C,
+                     rocsparse_index_base base_A,
+                     rocsparse_index_base base_B,
+                     rocsparse_index_base base_C);
+
+template <typename T, typename I = rocsparse_int, typename J = rocsparse_int>
+void host_spgeam(J                    M,
+                 J                    N,
+                 I                    bs2,
+                 T                    alpha,
+                 const I*             ptr_A,
+                 const J*             ind_A,
+                 const T*             val_A,
+                 T                    beta,
+                 const I*             ptr_B,
+                 const J*             ind_B,
+                 const T*             val_B,
+                 const I*             ptr_C,
+                 J*                   ind_C,
+                 T*                   val_C,
+                 rocsparse_index_base base_A,
+                 rocsparse_index_base base_B,
+                 rocsparse_index_base base_C);
+
+template <typename T, typename I = rocsparse_int, typename J = rocsparse_int>
+void host_csrgemm_semiring(rocsparse_semiring   semiring,
+                           J                    M,
+                           J                    N,
+                           J                    K,
+                           const T*             alpha,
+                           const I*             csr_row_ptr_A,
+                           const J*             csr_col_ind_A,
+                           const T*             csr_val_A,
+                           const I*             csr_row_ptr_B,
+                           const J*             csr_col_ind_B,
+                           const T*             csr_val_B,
+                           const T*             beta,
+                           const I*             csr_row_ptr_D,
+                           const J*             csr_col_ind_D,
+                           const T*             csr_val_D,
+                           const I*             csr_row_ptr_C,
+                           J*                   csr_col_ind_C,
+                           T*                   csr_val_C,
+                           rocsparse_index_base base_A,
+                           rocsparse_index_base base_B,
+                           rocsparse_index_base base_C,
+                           rocsparse_index_base base_D);
+
 /*
  * ===========================================================================
  *    precond SPARSE
@@ -881,6 +1006,38 @@ void host_csrilu0(rocsparse_int                     M,
                   U                                 boost_tol,
                   T                                 boost_val);
 
+template <typename T>
+void host_bsrbjac_setup(rocsparse_direction               dir,
+                        rocsparse_int                     mb,
+                        const std::vector<rocsparse_int>& bsr_row_ptr,
+                        const std::vector<rocsparse_int>& bsr_col_ind,
+                        const std::vector<T>&             bsr_val,
+                        rocsparse_int                     block_dim,
+                        rocsparse_index_base              base,
+                        std::vector<T>&                   inv_diag_val,
+                        rocsparse_int*                    singular_block);
+
+template <typename T>
+void host_csrbjac_setup(rocsparse_direction               dir,
+                        rocsparse_int                     m,
+                        const std::vector<rocsparse_int>& csr_row_ptr,
+                        const std::vector<rocsparse_int>& csr_col_ind,
+                        const std::vector<T>&             csr_val,
+                        rocsparse_int                     block_dim,
+                        rocsparse_index_base              base,
+                        std::vector<T>&                   inv_diag_val,
+                        rocsparse_int*                    singular_block);
+
+template <typename T>
+void host_bjac_apply(rocsparse_direction   dir,
+                     rocsparse_int         m,
+                     rocsparse_int         block_dim,
+                     T                     alpha,
+                     const std::vector<T>& inv_diag_val,
+                     const std::vector<T>& x,
+                     T                     beta,
+                     std::vector<T>&       y);
+
 template <typename T>
 void host_gtsv_no_pivot(rocsparse_int         m,
                         rocsparse_int         n,
@@ -899,6 +1056,15 @@ void host_gtsv_no_pivot_strided_batch(rocsparse_int         m,
                                       rocsparse_int         batch_count,
                                       rocsparse_int         batch_stride);
 
+template <typename T>
+void host_gtsv_strided_batch(rocsparse_int m,
+                             const T*      dl,
+                             const T*      d,
+                             const T*      du,
+                             T*            x,
+                             rocsparse_int batch_count,
+                             rocsparse_int batch_stride);
+
 template <typename T>
 void host_gtsv_interleaved_batch(rocsparse_gtsv_interleaved_alg algo,
                                  rocsparse_int                  m,
@@ -1034,6 +1200,21 @@ void host_csr_to_csc(J                    M,
                      rocsparse_action     action,
                      rocsparse_index_base base);
 
+template <typename I, typename J>
+void host_csr_to_csc_analysis(J                    M,
+                              J                    N,
+                              I                    nnz,
+                              const I*             csr_row_ptr,
+                              const J*             csr_col_ind,
+                              std::vector<J>&      csc_row_ind,
+                              std::vector<I>&      csc_col_ptr,
+                              std::vector<I>&      perm,
+                              rocsparse_index_base base);
+
+template <typename I, typename T>
+void host_csr_to_csc_numeric(
+    I nnz, I block_size, const std::vector<I>& perm, const T* csr_val, T* csc_val);
+
 template <typename T>
 void host_bsr_to_csr(rocsparse_direction               direction,
                      rocsparse_int                     mb,
@@ -1224,6 +1405,20 @@ void host_prune_csr_to_csr_by_percentage(rocsparse_int                     M,
                                          rocsparse_index_base              csr_base_C,
                                          T                                 percentage);
 
+template <typename T>
+void host_prune_csr_to_csr_by_strength(rocsparse_int                     M,
+                                       rocsparse_int                     nnz_A,
+                                       const std::vector<rocsparse_int>& csr_row_ptr_A,
+                                       const std::vector<rocsparse_int>& csr_col_ind_A,
+                                       const std::vector<T>&             csr_val_A,
+                                       rocsparse_int&                    nnz_C,
+                                       std::vector<rocsparse_int>&       csr_row_ptr_C,
+                                       std::vector<rocsparse_int>&       csr_col_ind_C,
+                                       std::vector<T>&                   csr_val_C,
+                                       rocsparse_index_base              csr_base_A,
+                                       rocsparse_index_base              csr_base_C,
+                                       T                                 theta);
+
 template <typename I, typename J>
 void host_coo_to_csr(J M, I nnz, const J* coo_row_ind, I* csr_row_ptr, rocsparse_index_base base);
 
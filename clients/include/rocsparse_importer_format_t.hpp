@@ -34,7 +34,8 @@ struct rocsparse_importer_format_t
     FORMAT(mlcsr)             \
     FORMAT(mlbsr)             \
     FORMAT(rocalution)        \
-    FORMAT(rocsparseio)
+    FORMAT(rocsparseio)       \
+    FORMAT(chunked)
 
     typedef enum _
     {
@@ -66,6 +67,8 @@ public:
             return ".csr";
         case rocsparseio:
             return ".bin";
+        case chunked:
+            return ".zbin";
         case unknown:
             return "";
         }
@@ -26,6 +26,7 @@
 #ifndef ROCSPARSE_LOAD_HPP
 #define ROCSPARSE_LOAD_HPP
 
+#include "rocsparse_importer_chunked.hpp"
 #include "rocsparse_importer_format_t.hpp"
 #include "rocsparse_importer_matrixmarket.hpp"
 #include "rocsparse_importer_mlbsr.hpp"
@@ -48,6 +49,12 @@ struct rocsparse_importer_format_traits_t<rocsparse_importer_format_t::rocsparse
     using importer_t = rocsparse_importer_rocsparseio;
 };
 
+template <>
+struct rocsparse_importer_format_traits_t<rocsparse_importer_format_t::chunked>
+{
+    using importer_t = rocsparse_importer_chunked;
+};
+
 template <>
 struct rocsparse_importer_format_traits_t<rocsparse_importer_format_t::matrixmarket>
 {
@@ -121,6 +128,11 @@ rocsparse_status rocsparse_load(const char* basename, const char* suffix, T& obj
         return rocsparse_load_template<rocsparse_importer_format_t::rocsparseio, T, P...>(
             basename, suffix, obj, params...);
     }
+    case rocsparse_importer_format_t::chunked:
+    {
+        return rocsparse_load_template<rocsparse_importer_format_t::chunked, T, P...>(
+            basename, suffix, obj, params...);
+    }
     case rocsparse_importer_format_t::rocalution:
     {
         return rocsparse_load_template<rocsparse_importer_format_t::rocalution, T, P...>(
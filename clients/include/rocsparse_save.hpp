@@ -27,6 +27,7 @@
 #define ROCSPARSE_SAVE_HPP
 
 #include "rocsparse_exporter_ascii.hpp"
+#include "rocsparse_exporter_chunked.hpp"
 #include "rocsparse_exporter_format_t.hpp"
 #include "rocsparse_exporter_matrixmarket.hpp"
 #include "rocsparse_exporter_rocalution.hpp"
@@ -47,6 +48,12 @@ struct rocsparse_exporter_format_traits_t<rocsparse_exporter_format_t::rocsparse
     using exporter_t = rocsparse_exporter_rocsparseio;
 };
 
+template <>
+struct rocsparse_exporter_format_traits_t<rocsparse_exporter_format_t::chunked>
+{
+    using exporter_t = rocsparse_exporter_chunked;
+};
+
 template <>
 struct rocsparse_exporter_format_traits_t<rocsparse_exporter_format_t::ascii>
 {
@@ -114,6 +121,11 @@ rocsparse_status rocsparse_save(const char* basename, const char* suffix, T obj,
         return rocsparse_save_template<rocsparse_exporter_format_t::rocsparseio, T, P...>(
             basename, suffix, obj, params...);
     }
+    case rocsparse_exporter_format_t::chunked:
+    {
+        return rocsparse_save_template<rocsparse_exporter_format_t::chunked, T, P...>(
+            basename, suffix, obj, params...);
+    }
     case rocsparse_exporter_format_t::rocalution:
     {
         return rocsparse_save_template<rocsparse_exporter_format_t::rocalution, T, P...>(
@@ -299,6 +299,27 @@ public:
                                                         &buffer_size,
                                                         dbuffer));
             CHECK_ROCSPARSE_DATA_ERROR(data_status);
+
+            // Check with the data status in device memory
+            rocsparse_data_status* ddata_status;
+            CHECK_HIP_ERROR(rocsparse_hipMalloc(&ddata_status, sizeof(rocsparse_data_status)));
+
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_data_status_mode(handle, rocsparse_data_status_mode_device));
+            CHECK_ROCSPARSE_ERROR(rocsparse_check_spmat(handle,
+                                                        A,
+                                                        ddata_status,
+                                                        rocsparse_check_spmat_stage_compute,
+                                                        &buffer_size,
+                                                        dbuffer));
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_data_status_mode(handle, rocsparse_data_status_mode_host));
+
+            CHECK_HIP_ERROR(hipMemcpy(
+                &data_status, ddata_status, sizeof(rocsparse_data_status), hipMemcpyDeviceToHost));
+            CHECK_ROCSPARSE_DATA_ERROR(data_status);
+
+            CHECK_HIP_ERROR(rocsparse_hipFree(ddata_status));
         }
 
         if(arg.timing)
@@ -850,4 +850,10 @@ std::string rocsparse_exepath();
 /*! \brief Return path where the test data file (rocsparse_test.data) is located */
 std::string rocsparse_datapath();
 
+/*! \brief Create an empty temporary file and return its name */
+std::string rocsparse_tmpname();
+
+/*! \brief Set an environment variable, or remove it if value is nullptr */
+void rocsparse_setenv(const char* name, const char* value);
+
 #endif // UTILITY_HPP
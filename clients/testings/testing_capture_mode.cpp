@@ -0,0 +1,370 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+//
+// Capture the work enqueued on the handle, on a dedicated stream.
+//
+static void testing_capture_mode_begin(rocsparse_handle handle,
+                                       hipStream_t*     graph_stream,
+                                       hipStream_t*     old_stream)
+{
+    CHECK_HIP_ERROR(hipStreamCreate(graph_stream));
+    CHECK_ROCSPARSE_ERROR(rocsparse_get_stream(handle, old_stream));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_stream(handle, *graph_stream));
+    CHECK_HIP_ERROR(hipStreamBeginCapture(*graph_stream, hipStreamCaptureModeGlobal));
+}
+
+//
+// End the capture, replay the graph if it is not empty and return its number of nodes.
+//
+static void testing_capture_mode_end(rocsparse_handle handle,
+                                     hipStream_t      graph_stream,
+                                     hipStream_t      old_stream,
+                                     size_t*          num_nodes)
+{
+    hipGraph_t graph;
+    CHECK_HIP_ERROR(hipStreamEndCapture(graph_stream, &graph));
+    CHECK_HIP_ERROR(hipGraphGetNodes(graph, nullptr, num_nodes));
+
+    if(*num_nodes > 0)
+    {
+        hipGraphExec_t instance;
+        CHECK_HIP_ERROR(hipGraphInstantiate(&instance, graph, nullptr, nullptr, 0));
+        CHECK_HIP_ERROR(hipGraphLaunch(instance, graph_stream));
+        CHECK_HIP_ERROR(hipStreamSynchronize(graph_stream));
+        CHECK_HIP_ERROR(hipGraphExecDestroy(instance));
+    }
+
+    CHECK_HIP_ERROR(hipGraphDestroy(graph));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_stream(handle, old_stream));
+    CHECK_HIP_ERROR(hipStreamDestroy(graph_stream));
+}
+
+template <typename T>
+void testing_capture_mode_bad_arg(const Arguments& arg)
+{
+    rocsparse_local_handle local_handle;
+    rocsparse_handle       handle = local_handle;
+    rocsparse_capture_mode mode;
+
+    EXPECT_ROCSPARSE_STATUS(rocsparse_set_capture_mode(nullptr, rocsparse_capture_mode_safe),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_set_capture_mode(handle, (rocsparse_capture_mode)-1),
+                            rocsparse_status_invalid_value);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_get_capture_mode(nullptr, &mode),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_get_capture_mode(handle, nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    // The default mode does not reject anything
+    CHECK_ROCSPARSE_ERROR(rocsparse_get_capture_mode(handle, &mode));
+    unit_check_scalar<int>(mode, rocsparse_capture_mode_default);
+}
+
+template <typename T>
+void testing_capture_mode(const Arguments& arg)
+{
+    rocsparse_int M = arg.M;
+    rocsparse_int N = arg.N;
+    rocsparse_int K = arg.K;
+
+    rocsparse_local_handle handle(arg);
+    rocsparse_datatype     ttype = get_datatype<T>();
+
+    host_scalar<T> h_alpha(arg.get_alpha<T>());
+    host_scalar<T> h_beta(arg.get_beta<T>());
+
+    // Sample matrix, with a full rank for the triangular solve
+    host_csr_matrix<T> hA;
+    {
+        static constexpr bool       to_int    = false;
+        static constexpr bool       full_rank = true;
+        rocsparse_matrix_factory<T> matrix_factory(arg, to_int, full_rank);
+        matrix_factory.init_csr(hA, M, N);
+    }
+
+    // Non-squared matrices are not supported by the triangular solve
+    if(M != N)
+    {
+        return;
+    }
+
+    device_csr_matrix<T> dA(hA);
+
+    host_dense_matrix<T> hx(M, 1);
+    rocsparse_matrix_utils::init_exact(hx);
+    device_dense_matrix<T> dx(hx);
+
+    host_dense_matrix<T> hy(M, 1);
+    rocsparse_matrix_utils::init_exact(hy);
+    device_dense_matrix<T> dy_gold(hy), dy(hy);
+
+    host_dense_matrix<T> hB(M, K);
+    rocsparse_matrix_utils::init_exact(hB);
+    device_dense_matrix<T> dB(hB);
+
+    host_dense_matrix<T> hC(M, K);
+    rocsparse_matrix_utils::init_exact(hC);
+    device_dense_matrix<T> dC_gold(hC), dC(hC);
+
+    rocsparse_local_spmat A(dA);
+    rocsparse_local_dnvec x(dx);
+    rocsparse_local_dnvec y_gold(dy_gold);
+    rocsparse_local_dnvec y(dy);
+    rocsparse_local_dnmat B(dB);
+    rocsparse_local_dnmat C_gold(dC_gold);
+    rocsparse_local_dnmat C(dC);
+
+    const rocsparse_fill_mode uplo = rocsparse_fill_mode_lower;
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_spmat_set_attribute(A, rocsparse_spmat_fill_mode, &uplo, sizeof(uplo)));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+    const rocsparse_operation trans    = rocsparse_operation_none;
+    const rocsparse_spmv_alg  spmv_alg = rocsparse_spmv_alg_csr_adaptive;
+    const rocsparse_spsv_alg  spsv_alg = rocsparse_spsv_alg_default;
+    const rocsparse_spmm_alg  spmm_alg = rocsparse_spmm_alg_csr;
+
+#define PARAMS_SPMV(stage_, y_, size_, buffer_) \
+    handle, trans, h_alpha, A, x, h_beta, y_, ttype, spmv_alg, stage_, size_, buffer_
+#define PARAMS_SPSV(A_, stage_, y_, size_, buffer_) \
+    handle, trans, h_alpha, A_, x, y_, ttype, spsv_alg, stage_, size_, buffer_
+#define PARAMS_SPMM(stage_, C_, size_, buffer_) \
+    handle, trans, trans, h_alpha, A, B, h_beta, C_, ttype, spmm_alg, stage_, size_, buffer_
+
+    //
+    // The buffer sizes and the analyses are read back on the host, they are not captured.
+    //
+    size_t spmv_buffer_size;
+    size_t spsv_buffer_size;
+    size_t spmm_buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmv(
+        PARAMS_SPMV(rocsparse_spmv_stage_buffer_size, y, &spmv_buffer_size, nullptr)));
+    CHECK_ROCSPARSE_ERROR(rocsparse_spsv(
+        PARAMS_SPSV(A, rocsparse_spsv_stage_buffer_size, y, &spsv_buffer_size, nullptr)));
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmm(
+        PARAMS_SPMM(rocsparse_spmm_stage_buffer_size, C, &spmm_buffer_size, nullptr)));
+
+    void* spmv_buffer;
+    void* spsv_buffer;
+    void* spmm_buffer;
+    CHECK_HIP_ERROR(rocsparse_hipMalloc(&spmv_buffer, spmv_buffer_size));
+    CHECK_HIP_ERROR(rocsparse_hipMalloc(&spsv_buffer, spsv_buffer_size));
+    CHECK_HIP_ERROR(rocsparse_hipMalloc(&spmm_buffer, spmm_buffer_size));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmv(
+        PARAMS_SPMV(rocsparse_spmv_stage_preprocess, y, &spmv_buffer_size, spmv_buffer)));
+    CHECK_ROCSPARSE_ERROR(rocsparse_spsv(
+        PARAMS_SPSV(A, rocsparse_spsv_stage_preprocess, y, &spsv_buffer_size, spsv_buffer)));
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmm(
+        PARAMS_SPMM(rocsparse_spmm_stage_preprocess, C, &spmm_buffer_size, spmm_buffer)));
+
+    //
+    // Reference results, computed without capture.
+    //
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmv(
+        PARAMS_SPMV(rocsparse_spmv_stage_compute, y_gold, &spmv_buffer_size, spmv_buffer)));
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmm(
+        PARAMS_SPMM(rocsparse_spmm_stage_compute, C_gold, &spmm_buffer_size, spmm_buffer)));
+
+    host_dense_matrix<T> hy_spmv(dy_gold);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_spsv(
+        PARAMS_SPSV(A, rocsparse_spsv_stage_compute, y_gold, &spsv_buffer_size, spsv_buffer)));
+
+    host_dense_matrix<T> hy_spsv(dy_gold);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_capture_mode(handle, rocsparse_capture_mode_safe));
+
+    hipStream_t graph_stream;
+    hipStream_t old_stream;
+    size_t      num_nodes;
+
+    //
+    // The compute stages are captured, the replay of the graph matches the reference.
+    //
+    testing_capture_mode_begin(handle, &graph_stream, &old_stream);
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmv(
+        PARAMS_SPMV(rocsparse_spmv_stage_compute, y, &spmv_buffer_size, spmv_buffer)));
+    testing_capture_mode_end(handle, graph_stream, old_stream, &num_nodes);
+    hy_spmv.near_check(dy);
+
+    testing_capture_mode_begin(handle, &graph_stream, &old_stream);
+    CHECK_ROCSPARSE_ERROR(rocsparse_spsv(
+        PARAMS_SPSV(A, rocsparse_spsv_stage_compute, y, &spsv_buffer_size, spsv_buffer)));
+    testing_capture_mode_end(handle, graph_stream, old_stream, &num_nodes);
+    hy_spsv.near_check(dy);
+
+    testing_capture_mode_begin(handle, &graph_stream, &old_stream);
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmm(
+        PARAMS_SPMM(rocsparse_spmm_stage_compute, C, &spmm_buffer_size, spmm_buffer)));
+    testing_capture_mode_end(handle, graph_stream, old_stream, &num_nodes);
+    dC_gold.near_check(dC);
+
+    //
+    // The row groups of the SpGEMM product are gathered by the nnz and symbolic stages, the
+    // compute and numeric stages are captured.
+    //
+    const rocsparse_spgemm_alg spgemm_alg = rocsparse_spgemm_alg_default;
+
+    device_csr_matrix<T> dC_spgemm;
+    dC_spgemm.define(M, N, 0, hA.base);
+    rocsparse_local_spmat C_spgemm(dC_spgemm);
+
+#define PARAMS_SPGEMM(stage_, size_, buffer_)                                                   \
+    handle, trans, trans, h_alpha, A, A, h_beta, A, C_spgemm, ttype, spgemm_alg, stage_, size_, \
+        buffer_
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_capture_mode(handle, rocsparse_capture_mode_default));
+
+    size_t spgemm_buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_spgemm(
+        PARAMS_SPGEMM(rocsparse_spgemm_stage_buffer_size, &spgemm_buffer_size, nullptr)));
+
+    void* spgemm_buffer;
+    CHECK_HIP_ERROR(rocsparse_hipMalloc(&spgemm_buffer, spgemm_buffer_size));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_spgemm(
+        PARAMS_SPGEMM(rocsparse_spgemm_stage_nnz, &spgemm_buffer_size, spgemm_buffer)));
+
+    {
+        int64_t C_m, C_n, C_nnz;
+        CHECK_ROCSPARSE_ERROR(rocsparse_spmat_get_size(C_spgemm, &C_m, &C_n, &C_nnz));
+        dC_spgemm.define(dC_spgemm.m, dC_spgemm.n, C_nnz, dC_spgemm.base);
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_csr_set_pointers(C_spgemm, dC_spgemm.ptr, dC_spgemm.ind, dC_spgemm.val));
+    }
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_spgemm(
+        PARAMS_SPGEMM(rocsparse_spgemm_stage_compute, &spgemm_buffer_size, spgemm_buffer)));
+
+    host_csr_matrix<T> hC_spgemm(dC_spgemm);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_capture_mode(handle, rocsparse_capture_mode_safe));
+
+    CHECK_HIP_ERROR(hipMemset(dC_spgemm.ind, 0, sizeof(rocsparse_int) * dC_spgemm.nnz));
+    CHECK_HIP_ERROR(hipMemset(dC_spgemm.val, 0, sizeof(T) * dC_spgemm.nnz));
+
+    testing_capture_mode_begin(handle, &graph_stream, &old_stream);
+    CHECK_ROCSPARSE_ERROR(rocsparse_spgemm(
+        PARAMS_SPGEMM(rocsparse_spgemm_stage_compute, &spgemm_buffer_size, spgemm_buffer)));
+    testing_capture_mode_end(handle, graph_stream, old_stream, &num_nodes);
+    hC_spgemm.near_check(dC_spgemm);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_capture_mode(handle, rocsparse_capture_mode_default));
+    CHECK_ROCSPARSE_ERROR(rocsparse_spgemm(
+        PARAMS_SPGEMM(rocsparse_spgemm_stage_symbolic, &spgemm_buffer_size, spgemm_buffer)));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_capture_mode(handle, rocsparse_capture_mode_safe));
+
+    CHECK_HIP_ERROR(hipMemset(dC_spgemm.val, 0, sizeof(T) * dC_spgemm.nnz));
+
+    testing_capture_mode_begin(handle, &graph_stream, &old_stream);
+    CHECK_ROCSPARSE_ERROR(rocsparse_spgemm(
+        PARAMS_SPGEMM(rocsparse_spgemm_stage_numeric, &spgemm_buffer_size, spgemm_buffer)));
+    testing_capture_mode_end(handle, graph_stream, old_stream, &num_nodes);
+    hC_spgemm.near_check(dC_spgemm);
+
+    //
+    // The number of blocks is written to device memory in device pointer mode, it is captured.
+    //
+    const rocsparse_direction dir       = rocsparse_direction_row;
+    const rocsparse_int       block_dim = 2;
+    const rocsparse_int       mb        = (M + block_dim - 1) / block_dim;
+
+    rocsparse_local_mat_descr descr_A;
+    rocsparse_local_mat_descr descr_B;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr_A, hA.base));
+
+#define PARAMS_CSR2BSR_NNZ(ptr_, nnz_) \
+    handle, dir, M, N, descr_A, dA.ptr, dA.ind, block_dim, descr_B, ptr_, nnz_
+
+    device_vector<rocsparse_int> dbsr_row_ptr_gold(mb + 1);
+    device_vector<rocsparse_int> dbsr_row_ptr(mb + 1);
+    host_scalar<rocsparse_int>   h_nnzb;
+    device_scalar<rocsparse_int> d_nnzb;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_capture_mode(handle, rocsparse_capture_mode_default));
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_csr2bsr_nnz(PARAMS_CSR2BSR_NNZ(dbsr_row_ptr_gold, (rocsparse_int*)h_nnzb)));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_capture_mode(handle, rocsparse_capture_mode_safe));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+    testing_capture_mode_begin(handle, &graph_stream, &old_stream);
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_csr2bsr_nnz(PARAMS_CSR2BSR_NNZ(dbsr_row_ptr, (rocsparse_int*)d_nnzb)));
+    testing_capture_mode_end(handle, graph_stream, old_stream, &num_nodes);
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+    dbsr_row_ptr_gold.unit_check(dbsr_row_ptr);
+    h_nnzb.unit_check(d_nnzb);
+
+    //
+    // Routines that read back on the host are rejected before they enqueue anything.
+    //
+    testing_capture_mode_begin(handle, &graph_stream, &old_stream);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2bsr_nnz(PARAMS_CSR2BSR_NNZ(dbsr_row_ptr, (rocsparse_int*)h_nnzb)),
+        rocsparse_status_not_capture_safe);
+    testing_capture_mode_end(handle, graph_stream, old_stream, &num_nodes);
+    unit_check_scalar<size_t>(num_nodes, 0);
+
+    // A matrix that has not been analysed yet
+    device_csr_matrix<T>  dA_copy(dA);
+    rocsparse_local_spmat A_copy(dA_copy);
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_spmat_set_attribute(A_copy, rocsparse_spmat_fill_mode, &uplo, sizeof(uplo)));
+
+    testing_capture_mode_begin(handle, &graph_stream, &old_stream);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spsv(PARAMS_SPSV(
+            A_copy, rocsparse_spsv_stage_preprocess, y, &spsv_buffer_size, spsv_buffer)),
+        rocsparse_status_not_capture_safe);
+    testing_capture_mode_end(handle, graph_stream, old_stream, &num_nodes);
+    unit_check_scalar<size_t>(num_nodes, 0);
+
+#undef PARAMS_CSR2BSR_NNZ
+#undef PARAMS_SPGEMM
+#undef PARAMS_SPMM
+#undef PARAMS_SPSV
+#undef PARAMS_SPMV
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_capture_mode(handle, rocsparse_capture_mode_default));
+
+    CHECK_HIP_ERROR(rocsparse_hipFree(spmv_buffer));
+    CHECK_HIP_ERROR(rocsparse_hipFree(spsv_buffer));
+    CHECK_HIP_ERROR(rocsparse_hipFree(spmm_buffer));
+    CHECK_HIP_ERROR(rocsparse_hipFree(spgemm_buffer));
+}
+
+#define INSTANTIATE(TYPE)                                                   \
+    template void testing_capture_mode_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_capture_mode<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+void testing_capture_mode_extra(const Arguments& arg) {}
@@ -129,6 +129,36 @@ void testing_check_matrix_coo(const Arguments& arg)
                                                         dbuffer));
     CHECK_ROCSPARSE_DATA_ERROR(data_status);
 
+    // Check with the data status in device memory
+    {
+        rocsparse_data_status* ddata_status;
+        CHECK_HIP_ERROR(rocsparse_hipMalloc(&ddata_status, sizeof(rocsparse_data_status)));
+
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_set_data_status_mode(handle, rocsparse_data_status_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_check_matrix_coo<T>(handle,
+                                                            m,
+                                                            n,
+                                                            nnz,
+                                                            dcoo_val,
+                                                            dcoo_row_ind,
+                                                            dcoo_col_ind,
+                                                            base,
+                                                            matrix_type,
+                                                            uplo,
+                                                            storage,
+                                                            ddata_status,
+                                                            dbuffer));
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_set_data_status_mode(handle, rocsparse_data_status_mode_host));
+
+        CHECK_HIP_ERROR(hipMemcpy(
+            &data_status, ddata_status, sizeof(rocsparse_data_status), hipMemcpyDeviceToHost));
+        CHECK_ROCSPARSE_DATA_ERROR(data_status);
+
+        CHECK_HIP_ERROR(rocsparse_hipFree(ddata_status));
+    }
+
     if(nnz > 1 && n > 1)
     {
         rocsparse_int temp;
@@ -159,6 +189,36 @@ void testing_check_matrix_coo(const Arguments& arg)
                                                             dbuffer));
         EXPECT_ROCSPARSE_DATA_STATUS(data_status, rocsparse_data_status_invalid_index);
 
+        // Check with the data status in device memory
+        {
+            rocsparse_data_status* ddata_status;
+            CHECK_HIP_ERROR(rocsparse_hipMalloc(&ddata_status, sizeof(rocsparse_data_status)));
+
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_data_status_mode(handle, rocsparse_data_status_mode_device));
+            CHECK_ROCSPARSE_ERROR(rocsparse_check_matrix_coo<T>(handle,
+                                                                m,
+                                                                n,
+                                                                nnz,
+                                                                dcoo_val,
+                                                                dcoo_row_ind,
+                                                                dcoo_col_ind,
+                                                                base,
+                                                                matrix_type,
+                                                                uplo,
+                                                                storage,
+                                                                ddata_status,
+                                                                dbuffer));
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_data_status_mode(handle, rocsparse_data_status_mode_host));
+
+            CHECK_HIP_ERROR(hipMemcpy(
+                &data_status, ddata_status, sizeof(rocsparse_data_status), hipMemcpyDeviceToHost));
+            EXPECT_ROCSPARSE_DATA_STATUS(data_status, rocsparse_data_status_invalid_index);
+
+            CHECK_HIP_ERROR(rocsparse_hipFree(ddata_status));
+        }
+
         // Restore row indices
         hcoo_row_ind[rng] = temp;
         dcoo_row_ind.transfer_from(hcoo_row_ind);
@@ -62,6 +62,23 @@ void testing_check_matrix_csr_bad_arg(const Arguments& arg)
         rocsparse_check_matrix_csr<T>, nargs_to_exclude, args_to_exclude, PARAMS);
 #undef PARAMS_BUFFER_SIZE
 #undef PARAMS
+
+    // Data status mode
+    rocsparse_data_status_mode data_status_mode;
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_set_data_status_mode(nullptr, rocsparse_data_status_mode_device),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_set_data_status_mode(handle, (rocsparse_data_status_mode)-1),
+        rocsparse_status_invalid_value);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_get_data_status_mode(nullptr, &data_status_mode),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_get_data_status_mode(handle, nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    // The default data status mode is host
+    CHECK_ROCSPARSE_ERROR(rocsparse_get_data_status_mode(handle, &data_status_mode));
+    unit_check_scalar<int32_t>(rocsparse_data_status_mode_host, data_status_mode);
 }
 
 template <typename T>
@@ -127,6 +144,55 @@ void testing_check_matrix_csr(const Arguments& arg)
 
     CHECK_ROCSPARSE_DATA_ERROR(data_status);
 
+    // Check with the data status in device memory
+    {
+        rocsparse_data_status* ddata_status;
+        CHECK_HIP_ERROR(rocsparse_hipMalloc(&ddata_status, sizeof(rocsparse_data_status)));
+
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_set_data_status_mode(handle, rocsparse_data_status_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_check_matrix_csr<T>(handle,
+                                                            m,
+                                                            n,
+                                                            nnz,
+                                                            dcsr_val,
+                                                            dcsr_row_ptr,
+                                                            dcsr_col_ind,
+                                                            base,
+                                                            matrix_type,
+                                                            uplo,
+                                                            storage,
+                                                            ddata_status,
+                                                            dbuffer));
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_set_data_status_mode(handle, rocsparse_data_status_mode_host));
+
+        CHECK_HIP_ERROR(hipMemcpy(
+            &data_status, ddata_status, sizeof(rocsparse_data_status), hipMemcpyDeviceToHost));
+        CHECK_ROCSPARSE_DATA_ERROR(data_status);
+
+        CHECK_HIP_ERROR(rocsparse_hipFree(ddata_status));
+    }
+
+    // Device pointer mode alone keeps the data status in host memory
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+    data_status = rocsparse_data_status_nan;
+    CHECK_ROCSPARSE_ERROR(rocsparse_check_matrix_csr<T>(handle,
+                                                        m,
+                                                        n,
+                                                        nnz,
+                                                        dcsr_val,
+                                                        dcsr_row_ptr,
+                                                        dcsr_col_ind,
+                                                        base,
+                                                        matrix_type,
+                                                        uplo,
+                                                        storage,
+                                                        &data_status,
+                                                        dbuffer));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_DATA_ERROR(data_status);
+
     // Check passing shifting ptr array by large number
     host_vector<rocsparse_int> hcsr_row_ptr_shifted(hcsr_row_ptr);
     for(size_t i = 0; i < hcsr_row_ptr_shifted.size(); i++)
@@ -181,6 +247,36 @@ void testing_check_matrix_csr(const Arguments& arg)
                                                             dbuffer));
         EXPECT_ROCSPARSE_DATA_STATUS(data_status, rocsparse_data_status_invalid_offset_ptr);
 
+        // Check with the data status in device memory
+        {
+            rocsparse_data_status* ddata_status;
+            CHECK_HIP_ERROR(rocsparse_hipMalloc(&ddata_status, sizeof(rocsparse_data_status)));
+
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_data_status_mode(handle, rocsparse_data_status_mode_device));
+            CHECK_ROCSPARSE_ERROR(rocsparse_check_matrix_csr<T>(handle,
+                                                                m,
+                                                                n,
+                                                                nnz,
+                                                                dcsr_val,
+                                                                dcsr_row_ptr,
+                                                                dcsr_col_ind,
+                                                                base,
+                                                                matrix_type,
+                                                                uplo,
+                                                                storage,
+                                                                ddata_status,
+                                                                dbuffer));
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_data_status_mode(handle, rocsparse_data_status_mode_host));
+
+            CHECK_HIP_ERROR(hipMemcpy(
+                &data_status, ddata_status, sizeof(rocsparse_data_status), hipMemcpyDeviceToHost));
+            EXPECT_ROCSPARSE_DATA_STATUS(data_status, rocsparse_data_status_invalid_offset_ptr);
+
+            CHECK_HIP_ERROR(rocsparse_hipFree(ddata_status));
+        }
+
         // Restore offset pointer
         hcsr_row_ptr[rng] = temp;
         dcsr_row_ptr.transfer_from(hcsr_row_ptr);
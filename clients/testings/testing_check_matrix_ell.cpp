@@ -106,6 +106,35 @@ void testing_check_matrix_ell(const Arguments& arg)
 
     CHECK_ROCSPARSE_DATA_ERROR(data_status);
 
+    // Check with the data status in device memory
+    {
+        rocsparse_data_status* ddata_status;
+        CHECK_HIP_ERROR(rocsparse_hipMalloc(&ddata_status, sizeof(rocsparse_data_status)));
+
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_set_data_status_mode(handle, rocsparse_data_status_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_check_matrix_ell<T>(handle,
+                                                            m,
+                                                            n,
+                                                            dA.width,
+                                                            dA.val,
+                                                            dA.ind,
+                                                            base,
+                                                            matrix_type,
+                                                            uplo,
+                                                            storage,
+                                                            ddata_status,
+                                                            dbuffer));
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_set_data_status_mode(handle, rocsparse_data_status_mode_host));
+
+        CHECK_HIP_ERROR(hipMemcpy(
+            &data_status, ddata_status, sizeof(rocsparse_data_status), hipMemcpyDeviceToHost));
+        CHECK_ROCSPARSE_DATA_ERROR(data_status);
+
+        CHECK_HIP_ERROR(rocsparse_hipFree(ddata_status));
+    }
+
     if(m > 1 && n > 1 && hA.width > 2)
     {
         rocsparse_int temp1;
@@ -138,6 +167,35 @@ void testing_check_matrix_ell(const Arguments& arg)
                                                             dbuffer));
         EXPECT_ROCSPARSE_DATA_STATUS(data_status, rocsparse_data_status_inf);
 
+        // Check with the data status in device memory
+        {
+            rocsparse_data_status* ddata_status;
+            CHECK_HIP_ERROR(rocsparse_hipMalloc(&ddata_status, sizeof(rocsparse_data_status)));
+
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_data_status_mode(handle, rocsparse_data_status_mode_device));
+            CHECK_ROCSPARSE_ERROR(rocsparse_check_matrix_ell<T>(handle,
+                                                                m,
+                                                                n,
+                                                                dA.width,
+                                                                dA.val,
+                                                                dA.ind,
+                                                                base,
+                                                                matrix_type,
+                                                                uplo,
+                                                                storage,
+                                                                ddata_status,
+                                                                dbuffer));
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_data_status_mode(handle, rocsparse_data_status_mode_host));
+
+            CHECK_HIP_ERROR(hipMemcpy(
+                &data_status, ddata_status, sizeof(rocsparse_data_status), hipMemcpyDeviceToHost));
+            EXPECT_ROCSPARSE_DATA_STATUS(data_status, rocsparse_data_status_inf);
+
+            CHECK_HIP_ERROR(rocsparse_hipFree(ddata_status));
+        }
+
         // Check matrix with column index not -1 but val being nan
         hA.ind[row] = random_generator_exact<rocsparse_int>(0, n - 1) + base;
         hA.val[row] = rocsparse_nan<T>();
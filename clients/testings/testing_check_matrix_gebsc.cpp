@@ -173,6 +173,39 @@ void testing_check_matrix_gebsc(const Arguments& arg)
                                                           dbuffer));
     CHECK_ROCSPARSE_DATA_ERROR(data_status);
 
+    // Check with the data status in device memory
+    {
+        rocsparse_data_status* ddata_status;
+        CHECK_HIP_ERROR(rocsparse_hipMalloc(&ddata_status, sizeof(rocsparse_data_status)));
+
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_set_data_status_mode(handle, rocsparse_data_status_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_check_matrix_gebsc<T>(handle,
+                                                              direction,
+                                                              mb,
+                                                              nb,
+                                                              nnzb,
+                                                              row_block_dim,
+                                                              col_block_dim,
+                                                              dbsc_val,
+                                                              dbsc_col_ptr,
+                                                              dbsc_row_ind,
+                                                              base,
+                                                              matrix_type,
+                                                              uplo,
+                                                              storage,
+                                                              ddata_status,
+                                                              dbuffer));
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_set_data_status_mode(handle, rocsparse_data_status_mode_host));
+
+        CHECK_HIP_ERROR(hipMemcpy(
+            &data_status, ddata_status, sizeof(rocsparse_data_status), hipMemcpyDeviceToHost));
+        CHECK_ROCSPARSE_DATA_ERROR(data_status);
+
+        CHECK_HIP_ERROR(rocsparse_hipFree(ddata_status));
+    }
+
     // Check passing shifting ptr array by large number
     host_vector<rocsparse_int> hbsc_col_ptr_shifted(hbsc_col_ptr);
     for(size_t i = 0; i < hbsc_col_ptr_shifted.size(); i++)
@@ -232,6 +265,39 @@ void testing_check_matrix_gebsc(const Arguments& arg)
                                                               dbuffer));
         EXPECT_ROCSPARSE_DATA_STATUS(data_status, rocsparse_data_status_invalid_offset_ptr);
 
+        // Check with the data status in device memory
+        {
+            rocsparse_data_status* ddata_status;
+            CHECK_HIP_ERROR(rocsparse_hipMalloc(&ddata_status, sizeof(rocsparse_data_status)));
+
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_data_status_mode(handle, rocsparse_data_status_mode_device));
+            CHECK_ROCSPARSE_ERROR(rocsparse_check_matrix_gebsc<T>(handle,
+                                                                  direction,
+                                                                  mb,
+                                                                  nb,
+                                                                  nnzb,
+                                                                  row_block_dim,
+                                                                  col_block_dim,
+                                                                  dbsc_val,
+                                                                  dbsc_col_ptr,
+                                                                  dbsc_row_ind,
+                                                                  base,
+                                                                  matrix_type,
+                                                                  uplo,
+                                                                  storage,
+                                                                  ddata_status,
+                                                                  dbuffer));
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_data_status_mode(handle, rocsparse_data_status_mode_host));
+
+            CHECK_HIP_ERROR(hipMemcpy(
+                &data_status, ddata_status, sizeof(rocsparse_data_status), hipMemcpyDeviceToHost));
+            EXPECT_ROCSPARSE_DATA_STATUS(data_status, rocsparse_data_status_invalid_offset_ptr);
+
+            CHECK_HIP_ERROR(rocsparse_hipFree(ddata_status));
+        }
+
         // Restore offset pointer
         hbsc_col_ptr[rng] = temp;
         dbsc_col_ptr.transfer_from(hbsc_col_ptr);
@@ -108,6 +108,66 @@ void testing_check_matrix_hyb(const Arguments& arg)
 
     CHECK_ROCSPARSE_DATA_ERROR(data_status);
 
+    // Check with the data status in device memory
+    {
+        rocsparse_data_status* ddata_status;
+        CHECK_HIP_ERROR(rocsparse_hipMalloc(&ddata_status, sizeof(rocsparse_data_status)));
+
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_set_data_status_mode(handle, rocsparse_data_status_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_check_matrix_hyb(
+            handle, hyb, base, matrix_type, uplo, storage, ddata_status, dbuffer));
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_set_data_status_mode(handle, rocsparse_data_status_mode_host));
+
+        CHECK_HIP_ERROR(hipMemcpy(
+            &data_status, ddata_status, sizeof(rocsparse_data_status), hipMemcpyDeviceToHost));
+        CHECK_ROCSPARSE_DATA_ERROR(data_status);
+
+        CHECK_HIP_ERROR(rocsparse_hipFree(ddata_status));
+    }
+
+    // Check passing matrix with an inf value in the COO part, which has to be reported
+    // even though the ELL part is valid
+    rocsparse_hyb_mat hyb_ptr = hyb;
+    test_hyb*         dhyb_A  = reinterpret_cast<test_hyb*>(hyb_ptr);
+    if(dhyb_A->coo_nnz > 0)
+    {
+        T* dcoo_val = reinterpret_cast<T*>(dhyb_A->coo_val);
+
+        T temp_val;
+        CHECK_HIP_ERROR(hipMemcpy(&temp_val, dcoo_val, sizeof(T), hipMemcpyDeviceToHost));
+
+        const T inf_val = rocsparse_inf<T>();
+        CHECK_HIP_ERROR(hipMemcpy(dcoo_val, &inf_val, sizeof(T), hipMemcpyHostToDevice));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_check_matrix_hyb(
+            handle, hyb, base, matrix_type, uplo, storage, &data_status, dbuffer));
+        EXPECT_ROCSPARSE_DATA_STATUS(data_status, rocsparse_data_status_inf);
+
+        // Check with the data status in device memory
+        {
+            rocsparse_data_status* ddata_status;
+            CHECK_HIP_ERROR(rocsparse_hipMalloc(&ddata_status, sizeof(rocsparse_data_status)));
+
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_data_status_mode(handle, rocsparse_data_status_mode_device));
+            CHECK_ROCSPARSE_ERROR(rocsparse_check_matrix_hyb(
+                handle, hyb, base, matrix_type, uplo, storage, ddata_status, dbuffer));
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_data_status_mode(handle, rocsparse_data_status_mode_host));
+
+            CHECK_HIP_ERROR(hipMemcpy(
+                &data_status, ddata_status, sizeof(rocsparse_data_status), hipMemcpyDeviceToHost));
+            EXPECT_ROCSPARSE_DATA_STATUS(data_status, rocsparse_data_status_inf);
+
+            CHECK_HIP_ERROR(rocsparse_hipFree(ddata_status));
+        }
+
+        // Restore coo values
+        CHECK_HIP_ERROR(hipMemcpy(dcoo_val, &temp_val, sizeof(T), hipMemcpyHostToDevice));
+    }
+
     if(arg.timing)
     {
         int number_cold_calls = 2;
@@ -0,0 +1,382 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "rocsparse_exporter_chunked.hpp"
+#include "rocsparse_importer_chunked.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+
+#ifndef WIN32
+#include <unistd.h>
+#endif
+
+static std::string testing_chunked_format_filename()
+{
+#ifdef WIN32
+    return std::string(std::tmpnam(nullptr)) + ".zbin";
+#else
+    char      tmp[] = "/tmp/rocsparse-zbin-XXXXXX";
+    const int fd    = mkstemp(tmp);
+    if(fd == -1)
+    {
+        perror("Cannot open temporary file");
+        exit(EXIT_FAILURE);
+    }
+    close(fd);
+    return tmp;
+#endif
+}
+
+static std::vector<char> testing_chunked_format_read(const std::string& filename)
+{
+    std::ifstream in(filename, std::ios::in | std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+static void testing_chunked_format_write(const std::string&       filename,
+                                         const std::vector<char>& bytes,
+                                         size_t                   size)
+{
+    std::ofstream out(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+    out.write(bytes.data(), size);
+}
+
+template <rocsparse_direction DIRECTION, typename T, typename I, typename J>
+static rocsparse_status testing_chunked_format_import(const std::string&                   filename,
+                                                      host_csx_matrix<DIRECTION, T, I, J>& A)
+{
+    rocsparse_importer_chunked importer(filename);
+    return importer.import(A);
+}
+
+//
+// Export and import a matrix, with chunks much smaller than the matrix.
+//
+template <rocsparse_direction DIRECTION, typename T, typename I, typename J>
+static void testing_chunked_format_round_trip(const host_csx_matrix<DIRECTION, T, I, J>& hA,
+                                              int64_t chunk_size)
+{
+    const std::string filename = testing_chunked_format_filename();
+
+    {
+        rocsparse_exporter_chunked exporter(filename, chunk_size);
+        CHECK_ROCSPARSE_ERROR(exporter.write(hA));
+    }
+
+    host_csx_matrix<DIRECTION, T, I, J> hB;
+    CHECK_ROCSPARSE_ERROR(testing_chunked_format_import(filename, hB));
+    hA.unit_check(hB);
+
+    std::remove(filename.c_str());
+}
+
+//
+// Import ranges of lines through the block index, aligned or not with the chunks.
+//
+template <typename T, typename I, typename J>
+static void testing_chunked_format_lines(const host_csr_matrix<T, I, J>& hA, int64_t chunk_size)
+{
+    const std::string filename = testing_chunked_format_filename();
+
+    {
+        rocsparse_exporter_chunked exporter(filename, chunk_size);
+        CHECK_ROCSPARSE_ERROR(exporter.write(hA));
+    }
+
+    const J m = hA.m;
+    const J c = static_cast<J>(chunk_size);
+
+    const std::vector<std::pair<J, J>> ranges = {{0, m},
+                                                 {0, 0},
+                                                 {m, m},
+                                                 {0, std::min(c, m)},
+                                                 {std::min(c, m), std::min(2 * c, m)},
+                                                 {std::min(c / 2, m), std::min(c / 2 + 2 * c, m)},
+                                                 {m / 3, (2 * m) / 3},
+                                                 {std::max(m - 1, J(0)), m}};
+
+    for(const std::pair<J, J>& range : ranges)
+    {
+        const J line_begin = range.first;
+        const J line_end   = range.second;
+
+        rocsparse_importer_chunked importer(filename);
+
+        rocsparse_direction  dir;
+        J                    M;
+        J                    N;
+        I                    nnz_A;
+        rocsparse_index_base base;
+        CHECK_ROCSPARSE_ERROR(importer.import_sparse_csx(&dir, &M, &N, &nnz_A, &base));
+
+        I nnz;
+        CHECK_ROCSPARSE_ERROR(importer.select_sparse_csx_lines(line_begin, line_end, &nnz));
+
+        const I nnz_begin = hA.ptr[line_begin] - hA.base;
+        unit_check_scalar<I>(hA.ptr[line_end] - hA.ptr[line_begin], nnz);
+
+        host_dense_vector<I> ptr(line_end - line_begin + 1);
+        host_dense_vector<J> ind(nnz);
+        host_dense_vector<T> val(nnz);
+        CHECK_ROCSPARSE_ERROR(importer.import_sparse_csx_lines(ptr.data(), ind.data(), val.data()));
+
+        host_dense_vector<I> gold_ptr(line_end - line_begin + 1);
+        for(J i = line_begin; i <= line_end; ++i)
+        {
+            gold_ptr[i - line_begin] = hA.ptr[i] - nnz_begin;
+        }
+
+        unit_check_segments<I>(gold_ptr.size(), gold_ptr.data(), ptr.data());
+        unit_check_segments<J>(nnz, hA.ind.data() + nnz_begin, ind.data());
+        unit_check_segments<T>(nnz, hA.val.data() + nnz_begin, val.data());
+    }
+
+    // Lines out of range
+    {
+        rocsparse_importer_chunked importer(filename);
+
+        rocsparse_direction  dir;
+        J                    M;
+        J                    N;
+        I                    nnz_A;
+        rocsparse_index_base base;
+        CHECK_ROCSPARSE_ERROR(importer.import_sparse_csx(&dir, &M, &N, &nnz_A, &base));
+
+        I nnz;
+        EXPECT_ROCSPARSE_STATUS(importer.select_sparse_csx_lines(J(-1), m, &nnz),
+                                rocsparse_status_invalid_size);
+        EXPECT_ROCSPARSE_STATUS(importer.select_sparse_csx_lines(J(0), J(m + 1), &nnz),
+                                rocsparse_status_invalid_size);
+        if(m > 0)
+        {
+            EXPECT_ROCSPARSE_STATUS(importer.select_sparse_csx_lines(m, J(m - 1), &nnz),
+                                    rocsparse_status_invalid_size);
+        }
+    }
+
+    std::remove(filename.c_str());
+}
+
+template <typename T, typename I, typename J>
+static void testing_chunked_format_expect_corrupted(const std::string&       filename,
+                                                    const std::vector<char>& bytes,
+                                                    size_t                   size)
+{
+    testing_chunked_format_write(filename, bytes, size);
+
+    host_csr_matrix<T, I, J> hB;
+    EXPECT_ROCSPARSE_STATUS(testing_chunked_format_import(filename, hB),
+                            rocsparse_status_internal_error);
+}
+
+//
+// Truncated or corrupted files must be rejected rather than decoded into garbage.
+//
+template <typename T, typename I, typename J>
+static void testing_chunked_format_corrupted(const host_csr_matrix<T, I, J>& hA,
+                                             int64_t                         chunk_size)
+{
+    const std::string filename = testing_chunked_format_filename();
+
+    {
+        rocsparse_exporter_chunked exporter(filename, chunk_size);
+        CHECK_ROCSPARSE_ERROR(exporter.write(hA));
+    }
+
+    const std::vector<char> bytes = testing_chunked_format_read(filename);
+
+    const int64_t nchunks     = (hA.m + chunk_size - 1) / chunk_size;
+    const size_t  header_pos  = strlen(ROCSPARSE_CHUNKED_MAGIC) + 1;
+    const size_t  blocks_pos  = header_pos + sizeof(rocsparse_chunked_header);
+    const size_t  payload_pos = blocks_pos + sizeof(rocsparse_chunked_block) * nchunks;
+
+    // Truncated files
+    for(size_t size : {size_t(0),
+                       header_pos / 2,
+                       header_pos + sizeof(rocsparse_chunked_header) / 2,
+                       payload_pos - 3,
+                       payload_pos + (bytes.size() - payload_pos) / 2,
+                       bytes.size() - 1})
+    {
+        testing_chunked_format_expect_corrupted<T, I, J>(filename, bytes, size);
+    }
+
+    // Corrupted magic line
+    {
+        std::vector<char> corrupted(bytes);
+        corrupted[1] ^= 1;
+        testing_chunked_format_expect_corrupted<T, I, J>(filename, corrupted, corrupted.size());
+    }
+
+    // Corrupted header
+    rocsparse_chunked_header header;
+    memcpy(&header, bytes.data() + header_pos, sizeof(header));
+
+    for(int field = 0; field < 4; ++field)
+    {
+        rocsparse_chunked_header corrupted_header = header;
+        switch(field)
+        {
+        case 0:
+        {
+            corrupted_header.version = rocsparse_chunked_version + 1;
+            break;
+        }
+        case 1:
+        {
+            corrupted_header.val_type = 17;
+            break;
+        }
+        case 2:
+        {
+            corrupted_header.chunk_size = 0;
+            break;
+        }
+        case 3:
+        {
+            corrupted_header.nchunks = nchunks + 1;
+            break;
+        }
+        }
+
+        std::vector<char> corrupted(bytes);
+        memcpy(corrupted.data() + header_pos, &corrupted_header, sizeof(corrupted_header));
+        testing_chunked_format_expect_corrupted<T, I, J>(filename, corrupted, corrupted.size());
+    }
+
+    // Corrupted block index, the first or the last block
+    for(int field = 0; field < 4; ++field)
+    {
+        const int64_t c   = (field == 1 || field == 2) ? nchunks - 1 : 0;
+        const size_t  pos = blocks_pos + sizeof(rocsparse_chunked_block) * c;
+
+        rocsparse_chunked_block block;
+        memcpy(&block, bytes.data() + pos, sizeof(block));
+        switch(field)
+        {
+        case 0:
+        {
+            block.nnz_begin = 1;
+            break;
+        }
+        case 1:
+        {
+            block.nnz_begin = hA.nnz + 1;
+            break;
+        }
+        case 2:
+        {
+            block.offset += 1;
+            break;
+        }
+        case 3:
+        {
+            // The row lengths of the chunk end in the middle of a varint.
+            block.ptr_bytes -= 1;
+            block.ind_bytes += 1;
+            break;
+        }
+        }
+
+        std::vector<char> corrupted(bytes);
+        memcpy(corrupted.data() + pos, &block, sizeof(block));
+        testing_chunked_format_expect_corrupted<T, I, J>(filename, corrupted, corrupted.size());
+    }
+
+    std::remove(filename.c_str());
+}
+
+template <typename I, typename J, typename T>
+void testing_chunked_format_bad_arg(const Arguments& arg)
+{
+    // Chunks must not be empty
+    {
+        rocsparse_status status = rocsparse_status_success;
+        try
+        {
+            rocsparse_exporter_chunked exporter("unused.zbin", 0);
+        }
+        catch(const rocsparse_status& exception)
+        {
+            status = exception;
+        }
+        EXPECT_ROCSPARSE_STATUS(status, rocsparse_status_invalid_value);
+    }
+
+    // Missing file
+    host_csr_matrix<T, I, J> hA;
+    EXPECT_ROCSPARSE_STATUS(
+        testing_chunked_format_import(testing_chunked_format_filename() + ".missing", hA),
+        rocsparse_status_internal_error);
+}
+
+template <typename I, typename J, typename T>
+void testing_chunked_format(const Arguments& arg)
+{
+    J                    M    = arg.M;
+    J                    N    = arg.N;
+    rocsparse_index_base base = arg.baseA;
+
+    rocsparse_matrix_factory<T, I, J> matrix_factory(arg);
+
+    host_csr_matrix<T, I, J> hA;
+    matrix_factory.init_csr(hA, M, N, base);
+
+    host_csc_matrix<T, I, J> hB;
+    matrix_factory.init_csc(hB, M, N, base);
+
+    // Chunks of a single line, of a few lines and of the default size
+    for(int64_t chunk_size : {int64_t(1), int64_t(7), rocsparse_chunked_chunk_size})
+    {
+        testing_chunked_format_round_trip(hA, chunk_size);
+        testing_chunked_format_round_trip(hB, chunk_size);
+        testing_chunked_format_lines(hA, chunk_size);
+    }
+
+    if(hA.m > 0)
+    {
+        testing_chunked_format_corrupted(hA, 7);
+    }
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                                     \
+    template void testing_chunked_format_bad_arg<ITYPE, JTYPE, TTYPE>(const Arguments& arg); \
+    template void testing_chunked_format<ITYPE, JTYPE, TTYPE>(const Arguments& arg)
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int32_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int64_t, int64_t, double);
+INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
+void testing_chunked_format_extra(const Arguments& arg) {}
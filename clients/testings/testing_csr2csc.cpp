@@ -55,6 +55,27 @@ void testing_csr2csc_bad_arg(const Arguments& arg)
     bad_arg_analysis(rocsparse_csr2csc<T>, PARAMS);
 #undef PARAMS
 #undef PARAMS_BUFFER_SIZE
+
+    rocsparse_local_mat_info local_info;
+    rocsparse_mat_info       info = local_info;
+
+#define PARAMS_ANALYSIS                                                                    \
+    handle, m, n, nnz, csr_row_ptr, csr_col_ind, csc_row_ind, csc_col_ptr, idx_base, info, \
+        temp_buffer
+#define PARAMS_NUMERIC handle, m, n, nnz, csr_val, csc_val, info
+    bad_arg_analysis(rocsparse_csr2csc_analysis, PARAMS_ANALYSIS);
+    bad_arg_analysis(rocsparse_csr2csc_numeric<T>, PARAMS_NUMERIC);
+
+    // Numeric conversion requires a prior analysis
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csc_numeric<T>(PARAMS_NUMERIC),
+                            rocsparse_status_invalid_pointer);
+#undef PARAMS_NUMERIC
+#undef PARAMS_ANALYSIS
+
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csc_clear(nullptr, info),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csc_clear(handle, nullptr),
+                            rocsparse_status_invalid_pointer);
 }
 
 template <typename T>
@@ -123,6 +144,42 @@ void testing_csr2csc(const Arguments& arg)
         if(action == rocsparse_action_numeric)
         {
             hC_gold.val.unit_check(hC.val);
+
+            // Transpose plan, symbolic pass once and values-only conversion afterwards
+            rocsparse_local_mat_info info;
+            device_csc_matrix<T>     dD(M, N, nnz, base);
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2csc_analysis(
+                handle, M, N, nnz, dA.ptr, dA.ind, dD.ind, dD.ptr, base, info, dbuffer));
+            CHECK_ROCSPARSE_ERROR(
+                testing::rocsparse_csr2csc_numeric<T>(handle, M, N, nnz, dA.val, dD.val, info));
+
+            host_csc_matrix<T> hD(M, N, nnz, base);
+            hD.transfer_from(dD);
+
+            host_vector<rocsparse_int> hD_gold_ind;
+            host_vector<rocsparse_int> hD_gold_ptr;
+            host_vector<rocsparse_int> hperm;
+            host_csr_to_csc_analysis(M,
+                                     N,
+                                     nnz,
+                                     hA.ptr.data(),
+                                     hA.ind.data(),
+                                     hD_gold_ind,
+                                     hD_gold_ptr,
+                                     hperm,
+                                     base);
+
+            host_vector<T> hD_gold_val(nnz);
+            host_csr_to_csc_numeric<rocsparse_int, T>(
+                nnz, 1, hperm, hA.val.data(), hD_gold_val.data());
+
+            hD_gold_ptr.unit_check(hD.ptr);
+            hD_gold_ind.unit_check(hD.ind);
+            hD_gold_val.unit_check(hD.val);
+            hC_gold.val.unit_check(hD.val);
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2csc_clear(handle, info));
         }
     }
 
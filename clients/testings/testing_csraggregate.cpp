@@ -0,0 +1,252 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "rocsparse_enum.hpp"
+
+template <typename T>
+void testing_csraggregate_bad_arg(const Arguments& arg)
+{
+    rocsparse_local_handle    local_handle;
+    rocsparse_local_mat_descr local_descr;
+
+    rocsparse_handle          handle      = local_handle;
+    rocsparse_int             m           = 4;
+    rocsparse_int             nnz         = 4;
+    const rocsparse_mat_descr descr       = local_descr;
+    const rocsparse_int*      csr_row_ptr = (const rocsparse_int*)0x4;
+    const rocsparse_int*      csr_col_ind = (const rocsparse_int*)0x4;
+    rocsparse_int*            naggregates = (rocsparse_int*)0x4;
+    rocsparse_int*            aggregates  = (rocsparse_int*)0x4;
+
+#define PARAMS handle, m, nnz, descr, csr_row_ptr, csr_col_ind, naggregates, aggregates
+
+    bad_arg_analysis(rocsparse_csraggregate, PARAMS);
+
+    //
+    // Not implemented cases.
+    //
+    for(auto val : rocsparse_matrix_type_t::values)
+    {
+        if(val != rocsparse_matrix_type_general)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, val));
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csraggregate(PARAMS),
+                                    rocsparse_status_not_implemented);
+        }
+    }
+
+#undef PARAMS
+}
+
+template <typename T>
+void testing_csraggregate(const Arguments& arg)
+{
+    //
+    // Create the matrix factory.
+    //
+    rocsparse_matrix_factory<T> matrix_factory(arg);
+
+    //
+    // Get dimensions.
+    //
+    rocsparse_int        M        = arg.M;
+    rocsparse_index_base csr_base = arg.baseA;
+
+    //
+    // Local variables.
+    //
+    rocsparse_local_handle    handle;
+    rocsparse_local_mat_descr csr_descr;
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(csr_descr, csr_base));
+
+    rocsparse_int naggregates;
+
+    //
+    // Argument sanity check before allocating invalid memory
+    //
+    if(M == 0)
+    {
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csraggregate(handle,
+                                                       0,
+                                                       7,
+                                                       csr_descr,
+                                                       nullptr,
+                                                       nullptr,
+                                                       &naggregates,
+                                                       nullptr),
+                                rocsparse_status_success);
+        unit_check_scalar<rocsparse_int>(0, naggregates);
+        return;
+    }
+
+    //
+    // Init a CSR symmetric matrix.
+    //
+    host_csr_matrix<T> hA;
+    {
+        host_csr_matrix<T> nonsymA;
+        matrix_factory.init_csr(nonsymA, M, M, csr_base);
+        CHECK_ROCSPARSE_ERROR(rocsparse_matrix_utils::host_csrsym(nonsymA, hA));
+    }
+
+    //
+    // Allocate device memory and transfer data from host.
+    //
+    device_csr_matrix<T>               dA(hA);
+    device_dense_vector<rocsparse_int> daggregates(hA.m);
+
+    if(arg.unit_check)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_csraggregate(
+            handle, dA.m, dA.nnz, csr_descr, dA.ptr, dA.ind, &naggregates, daggregates));
+
+        host_dense_vector<rocsparse_int> haggregates(daggregates);
+
+        //
+        // CHECK CONSISTENCY: EACH VERTEX BELONGS TO A VALID AGGREGATE.
+        //
+        EXPECT_ROCSPARSE_STATUS((naggregates > 0 && naggregates <= M)
+                                    ? rocsparse_status_success
+                                    : rocsparse_status_internal_error,
+                                rocsparse_status_success);
+
+        host_dense_vector<rocsparse_int> aggregate_size(std::max(naggregates, 0));
+        for(rocsparse_int i = 0; i < naggregates; ++i)
+        {
+            aggregate_size[i] = 0;
+        }
+
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            EXPECT_ROCSPARSE_STATUS((haggregates[i] >= 0 && haggregates[i] < naggregates)
+                                        ? rocsparse_status_success
+                                        : rocsparse_status_internal_error,
+                                    rocsparse_status_success);
+
+            ++aggregate_size[haggregates[i]];
+        }
+
+        //
+        // CHECK CONSISTENCY: AGGREGATES ARE CONTIGUOUSLY NUMBERED AND NOT EMPTY.
+        //
+        for(rocsparse_int i = 0; i < naggregates; ++i)
+        {
+            EXPECT_ROCSPARSE_STATUS((aggregate_size[i] > 0) ? rocsparse_status_success
+                                                            : rocsparse_status_internal_error,
+                                    rocsparse_status_success);
+        }
+
+        //
+        // CHECK CONSISTENCY: A VERTEX THAT SHARES ITS AGGREGATE IS WITHIN DISTANCE TWO OF ANOTHER
+        // MEMBER OF THAT AGGREGATE.
+        //
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            if(aggregate_size[haggregates[i]] == 1)
+            {
+                continue;
+            }
+
+            bool found = false;
+            for(rocsparse_int at = hA.ptr[i] - hA.base; at < hA.ptr[i + 1] - hA.base && !found;
+                ++at)
+            {
+                const rocsparse_int j = hA.ind[at] - hA.base;
+                if(j != i && haggregates[j] == haggregates[i])
+                {
+                    found = true;
+                }
+
+                for(rocsparse_int bt = hA.ptr[j] - hA.base; bt < hA.ptr[j + 1] - hA.base && !found;
+                    ++bt)
+                {
+                    const rocsparse_int k = hA.ind[bt] - hA.base;
+                    if(k != i && haggregates[k] == haggregates[i])
+                    {
+                        found = true;
+                    }
+                }
+            }
+
+            EXPECT_ROCSPARSE_STATUS(found ? rocsparse_status_success
+                                          : rocsparse_status_internal_error,
+                                    rocsparse_status_success);
+        }
+
+        //
+        // The aggregation is deterministic.
+        //
+        rocsparse_int                      naggregates_2;
+        device_dense_vector<rocsparse_int> daggregates_2(hA.m);
+        CHECK_ROCSPARSE_ERROR(rocsparse_csraggregate(
+            handle, dA.m, dA.nnz, csr_descr, dA.ptr, dA.ind, &naggregates_2, daggregates_2));
+
+        unit_check_scalar(naggregates, naggregates_2);
+        haggregates.unit_check(daggregates_2);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csraggregate(
+                handle, dA.m, dA.nnz, csr_descr, dA.ptr, dA.ind, &naggregates, daggregates));
+        }
+
+        double gpu_time_used = get_time_us();
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csraggregate(
+                handle, dA.m, dA.nnz, csr_descr, dA.ptr, dA.ind, &naggregates, daggregates));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        display_timing_info(display_key_t::M,
+                            dA.m,
+                            display_key_t::nnz,
+                            dA.nnz,
+                            "naggregates",
+                            naggregates,
+                            display_key_t::time_ms,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+}
+
+#define INSTANTIATE(TYPE)                                                   \
+    template void testing_csraggregate_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csraggregate<TYPE>(const Arguments& arg)
+
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+void testing_csraggregate_extra(const Arguments& arg) {}
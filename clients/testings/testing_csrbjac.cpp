@@ -0,0 +1,343 @@
+/*! \file */
+/* ************************************************************************
+* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+
+#include "testing.hpp"
+
+template <typename T>
+void testing_csrbjac_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr local_descr;
+
+    rocsparse_handle          handle         = local_handle;
+    rocsparse_direction       dir            = rocsparse_direction_row;
+    rocsparse_int             m              = safe_size;
+    rocsparse_int             nnz            = safe_size;
+    const rocsparse_mat_descr descr          = local_descr;
+    const T*                  csr_val        = (const T*)0x4;
+    const rocsparse_int*      csr_row_ptr    = (const rocsparse_int*)0x4;
+    const rocsparse_int*      csr_col_ind    = (const rocsparse_int*)0x4;
+    rocsparse_int             block_dim      = 4;
+    T*                        inv_diag_val   = (T*)0x4;
+    rocsparse_int*            singular_block = (rocsparse_int*)0x4;
+    const T*                  alpha          = (const T*)0x4;
+    const T*                  x              = (const T*)0x4;
+    const T*                  beta           = (const T*)0x4;
+    T*                        y              = (T*)0x4;
+
+#define PARAMS_SETUP                                                                           \
+    handle, dir, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, block_dim, inv_diag_val, \
+        singular_block
+
+#define PARAMS_APPLY handle, dir, m, block_dim, alpha, (const T*)inv_diag_val, x, beta, y
+
+    bad_arg_analysis(rocsparse_csrbjac_setup<T>, PARAMS_SETUP);
+    bad_arg_analysis(rocsparse_bjac_apply<T>, PARAMS_APPLY);
+
+    // block_dim == 0
+    block_dim = 0;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrbjac_setup<T>(PARAMS_SETUP),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bjac_apply<T>(PARAMS_APPLY), rocsparse_status_invalid_size);
+
+    // block_dim > 32
+    block_dim = 33;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrbjac_setup<T>(PARAMS_SETUP),
+                            rocsparse_status_not_implemented);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bjac_apply<T>(PARAMS_APPLY),
+                            rocsparse_status_not_implemented);
+    block_dim = 4;
+
+    // Only general matrices are supported
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, rocsparse_matrix_type_symmetric));
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrbjac_setup<T>(PARAMS_SETUP),
+                            rocsparse_status_not_implemented);
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, rocsparse_matrix_type_general));
+
+#undef PARAMS_SETUP
+#undef PARAMS_APPLY
+}
+
+template <typename T>
+void testing_csrbjac(const Arguments& arg)
+{
+    rocsparse_matrix_factory<T> matrix_factory(arg);
+
+    rocsparse_int        M         = arg.M;
+    rocsparse_int        N         = arg.N;
+    rocsparse_int        block_dim = arg.block_dim;
+    rocsparse_index_base base      = arg.baseA;
+    rocsparse_direction  direction = arg.direction;
+
+    T halpha = arg.get_alpha<T>();
+    T hbeta  = arg.get_beta<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle(arg);
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Non-squared matrices are not supported
+    if(M != N)
+    {
+        return;
+    }
+
+    // Allocate host memory for matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    // Generate CSR matrix on host (or read from file)
+    rocsparse_int nnz;
+    matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind, hcsr_val, M, N, nnz, base);
+
+    // Number of diagonal blocks, the last one may be partial
+    rocsparse_int Mb       = (M + block_dim - 1) / block_dim;
+    size_t        size_inv = size_t(Mb) * block_dim * block_dim;
+
+    // Allocate host memory for vectors
+    host_vector<T> hinv_1(size_inv);
+    host_vector<T> hinv_2(size_inv);
+    host_vector<T> hinv_gold(size_inv);
+    host_vector<T> hx(M);
+    host_vector<T> hy_1(M);
+    host_vector<T> hy_2(M);
+    host_vector<T> hy_gold(M);
+
+    // Initialize data on CPU
+    rocsparse_init<T>(hx, M, 1, 1);
+    rocsparse_init<T>(hy_1, M, 1, 1);
+
+    hy_2    = hy_1;
+    hy_gold = hy_1;
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(hcsr_row_ptr);
+    device_vector<rocsparse_int> dcsr_col_ind(hcsr_col_ind);
+    device_vector<T>             dcsr_val(hcsr_val);
+    device_vector<T>             dinv_1(size_inv);
+    device_vector<T>             dinv_2(size_inv);
+    device_vector<T>             dx(hx);
+    device_vector<T>             dy_1(hy_1);
+    device_vector<T>             dy_2(hy_2);
+    device_vector<T>             dalpha(1);
+    device_vector<T>             dbeta(1);
+    device_vector<rocsparse_int> dsingular_2(1);
+
+    CHECK_HIP_ERROR(hipMemcpy(dalpha, &halpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dbeta, &hbeta, sizeof(T), hipMemcpyHostToDevice));
+
+    if(arg.unit_check)
+    {
+        host_vector<rocsparse_int> hsingular_1(1);
+        host_vector<rocsparse_int> hsingular_2(1);
+        host_vector<rocsparse_int> hsingular_gold(1);
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrbjac_setup<T>(handle,
+                                                         direction,
+                                                         M,
+                                                         nnz,
+                                                         descr,
+                                                         dcsr_val,
+                                                         dcsr_row_ptr,
+                                                         dcsr_col_ind,
+                                                         block_dim,
+                                                         dinv_1,
+                                                         hsingular_1));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(testing::rocsparse_csrbjac_setup<T>(handle,
+                                                                  direction,
+                                                                  M,
+                                                                  nnz,
+                                                                  descr,
+                                                                  dcsr_val,
+                                                                  dcsr_row_ptr,
+                                                                  dcsr_col_ind,
+                                                                  block_dim,
+                                                                  dinv_2,
+                                                                  dsingular_2));
+
+        hsingular_2.transfer_from(dsingular_2);
+
+        // CPU csrbjac setup
+        host_csrbjac_setup<T>(direction,
+                              M,
+                              hcsr_row_ptr,
+                              hcsr_col_ind,
+                              hcsr_val,
+                              block_dim,
+                              base,
+                              hinv_gold,
+                              hsingular_gold);
+
+        hsingular_gold.unit_check(hsingular_1);
+        hsingular_gold.unit_check(hsingular_2);
+
+        // Inverses of singular blocks are undefined
+        if(hsingular_gold[0] == -1)
+        {
+            hinv_1.transfer_from(dinv_1);
+            hinv_2.transfer_from(dinv_2);
+
+            hinv_gold.near_check(hinv_1);
+            hinv_gold.near_check(hinv_2);
+
+            // Pointer mode host
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            CHECK_ROCSPARSE_ERROR(testing::rocsparse_bjac_apply<T>(
+                handle, direction, M, block_dim, &halpha, dinv_1, dx, &hbeta, dy_1));
+
+            // Pointer mode device
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+            CHECK_ROCSPARSE_ERROR(testing::rocsparse_bjac_apply<T>(
+                handle, direction, M, block_dim, dalpha, dinv_2, dx, dbeta, dy_2));
+
+            hy_1.transfer_from(dy_1);
+            hy_2.transfer_from(dy_2);
+
+            // CPU bjac apply
+            host_bjac_apply<T>(direction, M, block_dim, halpha, hinv_gold, hx, hbeta, hy_gold);
+
+            hy_gold.near_check(hy_1);
+            hy_gold.near_check(hy_2);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrbjac_setup<T>(handle,
+                                                             direction,
+                                                             M,
+                                                             nnz,
+                                                             descr,
+                                                             dcsr_val,
+                                                             dcsr_row_ptr,
+                                                             dcsr_col_ind,
+                                                             block_dim,
+                                                             dinv_1,
+                                                             dsingular_2));
+        }
+
+        double gpu_setup_time_used = get_time_us();
+
+        // Setup run
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrbjac_setup<T>(handle,
+                                                         direction,
+                                                         M,
+                                                         nnz,
+                                                         descr,
+                                                         dcsr_val,
+                                                         dcsr_row_ptr,
+                                                         dcsr_col_ind,
+                                                         block_dim,
+                                                         dinv_1,
+                                                         dsingular_2));
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+        gpu_setup_time_used = get_time_us() - gpu_setup_time_used;
+
+        rocsparse_int singular;
+        CHECK_HIP_ERROR(
+            hipMemcpy(&singular, dsingular_2, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_bjac_apply<T>(
+                handle, direction, M, block_dim, &halpha, dinv_1, dx, &hbeta, dy_1));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_bjac_apply<T>(
+                handle, direction, M, block_dim, &halpha, dinv_1, dx, &hbeta, dy_1));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gbyte_count
+            = bjac_apply_gbyte_count<T>(M, block_dim, hbeta != static_cast<T>(0));
+        double gpu_gbyte = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info(display_key_t::M,
+                            M,
+                            display_key_t::nnz,
+                            nnz,
+                            display_key_t::bdim,
+                            block_dim,
+                            display_key_t::bdir,
+                            rocsparse_direction2string(direction),
+                            display_key_t::pivot,
+                            singular,
+                            display_key_t::alpha,
+                            halpha,
+                            display_key_t::beta,
+                            hbeta,
+                            display_key_t::analysis_time_ms,
+                            get_gpu_time_msec(gpu_setup_time_used),
+                            display_key_t::bandwidth,
+                            gpu_gbyte,
+                            display_key_t::time_ms,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+}
+
+#define INSTANTIATE(TYPE)                                              \
+    template void testing_csrbjac_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csrbjac<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+void testing_csrbjac_extra(const Arguments& arg) {}
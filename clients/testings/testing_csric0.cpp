@@ -186,6 +186,48 @@ static void test_csric0_matrix(rocsparse_local_handle&    handle,
 
         CHECK_HIP_ERROR(hipMemcpy(
             h_singular_pivot_2, d_singular_pivot_2, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // Refactorize from the original values, reusing the analysis meta data. The
+        // batched refactorization gets distinct values per batch, the second batch is
+        // scaled, and a batch stride larger than nnz whose padding must stay untouched.
+        const rocsparse_int batch_count  = 2;
+        const rocsparse_int batch_stride = nnz + 3;
+        const T             batch_pad    = static_cast<T>(-7);
+
+        host_vector<T> hcsr_val_batch_orig(batch_count * batch_stride, batch_pad);
+        for(rocsparse_int b = 0; b < batch_count; ++b)
+        {
+            for(rocsparse_int i = 0; i < nnz; ++i)
+            {
+                hcsr_val_batch_orig[b * batch_stride + i] = hcsr_val[i] * static_cast<T>(b + 1);
+            }
+        }
+
+        device_vector<T> dcsr_val_3(nnz);
+        device_vector<T> dcsr_val_batch(batch_count * batch_stride);
+        CHECK_HIP_ERROR(hipMemcpy(dcsr_val_3, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+        dcsr_val_batch.transfer_from(hcsr_val_batch_orig);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(
+            testing::rocsparse_csric0_refactorize<T>(handle, descr, dcsr_val_3, info, dbuffer));
+
+        size_t buffer_size_batched = 0;
+        CHECK_ROCSPARSE_ERROR(rocsparse_csric0_refactorize_batched_buffer_size(
+            handle, info, batch_count, &buffer_size_batched));
+
+        void* dbuffer_batched = nullptr;
+        CHECK_HIP_ERROR(rocsparse_hipMalloc(&dbuffer_batched, buffer_size_batched));
+        CHECK_ROCSPARSE_ERROR(testing::rocsparse_csric0_refactorize_batched<T>(
+            handle, descr, batch_count, dcsr_val_batch, batch_stride, info, dbuffer_batched));
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+        CHECK_HIP_ERROR(rocsparse_hipFree(dbuffer_batched));
+
+        host_vector<T> hcsr_val_3(nnz);
+        host_vector<T> hcsr_val_batch(batch_count * batch_stride);
+        hcsr_val_3.transfer_from(dcsr_val_3);
+        hcsr_val_batch.transfer_from(dcsr_val_batch);
+
         // CPU csric0
         {
             double tol = 0;
@@ -216,6 +258,40 @@ static void test_csric0_matrix(rocsparse_local_handle&    handle,
         {
             hcsr_val_gold.near_check(hcsr_val_1);
             hcsr_val_gold.near_check(hcsr_val_2);
+            hcsr_val_gold.near_check(hcsr_val_3);
+
+            // Every batch is factorized on its own, the padding is left untouched
+            host_vector<T> hcsr_val_batch_gold(hcsr_val_batch_orig);
+            for(rocsparse_int b = 0; b < batch_count; ++b)
+            {
+                host_vector<T>             hcsr_val_b(nnz);
+                host_vector<rocsparse_int> h_analysis_pivot_b(1);
+                host_vector<rocsparse_int> h_solve_pivot_b(1);
+                host_vector<rocsparse_int> h_singular_pivot_b(1);
+                for(rocsparse_int i = 0; i < nnz; ++i)
+                {
+                    hcsr_val_b[i] = hcsr_val_batch_orig[b * batch_stride + i];
+                }
+
+                double tol = 0;
+                CHECK_ROCSPARSE_ERROR(rocsparse_csric0_get_tolerance(handle, info, &tol));
+
+                host_csric0<T>(M,
+                               hcsr_row_ptr,
+                               hcsr_col_ind,
+                               hcsr_val_b,
+                               base,
+                               h_analysis_pivot_b,
+                               h_solve_pivot_b,
+                               h_singular_pivot_b,
+                               tol);
+
+                for(rocsparse_int i = 0; i < nnz; ++i)
+                {
+                    hcsr_val_batch_gold[b * batch_stride + i] = hcsr_val_b[i];
+                }
+            }
+            hcsr_val_batch_gold.near_check(hcsr_val_batch);
         }
     }
 
@@ -424,6 +500,46 @@ void testing_csric0_bad_arg(const Arguments& arg)
 #undef PARAMS_ANALYSIS
 #undef PARAMS
 
+    // Test rocsparse_csric0_refactorize()
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csric0_refactorize<T>(nullptr, descr, csr_val, info, temp_buffer),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csric0_refactorize<T>(handle, nullptr, csr_val, info, temp_buffer),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csric0_refactorize<T>(handle, descr, csr_val, nullptr, temp_buffer),
+        rocsparse_status_invalid_pointer);
+    // No analysis meta data available
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csric0_refactorize<T>(handle, descr, csr_val, info, temp_buffer),
+        rocsparse_status_invalid_pointer);
+
+    // Test rocsparse_csric0_refactorize_batched_buffer_size()
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csric0_refactorize_batched_buffer_size(nullptr, info, 1, buffer_size),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csric0_refactorize_batched_buffer_size(handle, nullptr, 1, buffer_size),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csric0_refactorize_batched_buffer_size(handle, info, 1, buffer_size),
+        rocsparse_status_invalid_pointer);
+
+    // Test rocsparse_csric0_refactorize_batched()
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csric0_refactorize_batched<T>(nullptr, descr, 1, csr_val, nnz, info, temp_buffer),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csric0_refactorize_batched<T>(
+                                handle, nullptr, 1, csr_val, nnz, info, temp_buffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csric0_refactorize_batched<T>(handle, descr, -1, csr_val, nnz, info, temp_buffer),
+        rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csric0_refactorize_batched<T>(
+                                handle, descr, 1, csr_val, nnz, nullptr, temp_buffer),
+                            rocsparse_status_invalid_pointer);
+
     // Test rocsparse_csric0_zero_pivot()
     rocsparse_int position = -1;
     EXPECT_ROCSPARSE_STATUS(rocsparse_csric0_zero_pivot(nullptr, info, &position),
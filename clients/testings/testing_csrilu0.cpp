@@ -94,6 +94,9 @@ static void test_csrilu0_matrix(rocsparse_local_handle&    handle,
 
     if(arg.unit_check)
     {
+        // Keep the original values for the refactorization
+        host_vector<T> hcsr_val_orig(hcsr_val_gold);
+
         CHECK_HIP_ERROR(hipMemcpy(d_boost_tol, &h_boost_tol, sizeof(T), hipMemcpyHostToDevice));
         CHECK_HIP_ERROR(hipMemcpy(d_boost_val, &h_boost_val, sizeof(T), hipMemcpyHostToDevice));
 
@@ -195,6 +198,51 @@ static void test_csrilu0_matrix(rocsparse_local_handle&    handle,
         CHECK_HIP_ERROR(hipMemcpy(
             h_singular_pivot_2, d_singular_pivot_2, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
 
+        // Refactorize from the original values, reusing the analysis meta data. The
+        // batched refactorization gets distinct values per batch, the second batch is
+        // scaled, and a batch stride larger than nnz whose padding must stay untouched.
+        const rocsparse_int batch_count  = 2;
+        const rocsparse_int batch_stride = nnz + 3;
+        const T             batch_pad    = static_cast<T>(-7);
+
+        host_vector<T> hcsr_val_batch_orig(batch_count * batch_stride, batch_pad);
+        for(rocsparse_int b = 0; b < batch_count; ++b)
+        {
+            for(rocsparse_int i = 0; i < nnz; ++i)
+            {
+                hcsr_val_batch_orig[b * batch_stride + i]
+                    = hcsr_val_orig[i] * static_cast<T>(b + 1);
+            }
+        }
+
+        device_vector<T> dcsr_val_3(nnz);
+        device_vector<T> dcsr_val_batch(batch_count * batch_stride);
+        CHECK_HIP_ERROR(
+            hipMemcpy(dcsr_val_3, hcsr_val_orig, sizeof(T) * nnz, hipMemcpyHostToDevice));
+        dcsr_val_batch.transfer_from(hcsr_val_batch_orig);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_numeric_boost<T>(
+            handle, info, boost, get_boost_tol(&h_boost_tol), &h_boost_val));
+        CHECK_ROCSPARSE_ERROR(
+            testing::rocsparse_csrilu0_refactorize<T>(handle, descr, dcsr_val_3, info, dbuffer));
+
+        size_t buffer_size_batched = 0;
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_refactorize_batched_buffer_size(
+            handle, info, batch_count, &buffer_size_batched));
+
+        void* dbuffer_batched = nullptr;
+        CHECK_HIP_ERROR(rocsparse_hipMalloc(&dbuffer_batched, buffer_size_batched));
+        CHECK_ROCSPARSE_ERROR(testing::rocsparse_csrilu0_refactorize_batched<T>(
+            handle, descr, batch_count, dcsr_val_batch, batch_stride, info, dbuffer_batched));
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+        CHECK_HIP_ERROR(rocsparse_hipFree(dbuffer_batched));
+
+        host_vector<T> hcsr_val_3(nnz);
+        host_vector<T> hcsr_val_batch(batch_count * batch_stride);
+        hcsr_val_3.transfer_from(dcsr_val_3);
+        hcsr_val_batch.transfer_from(dcsr_val_batch);
+
         // CPU csrilu0
         {
             double tol = 0;
@@ -228,6 +276,43 @@ static void test_csrilu0_matrix(rocsparse_local_handle&    handle,
         {
             hcsr_val_gold.near_check(hcsr_val_1);
             hcsr_val_gold.near_check(hcsr_val_2);
+            hcsr_val_gold.near_check(hcsr_val_3);
+
+            // Every batch is factorized on its own, the padding is left untouched
+            host_vector<T> hcsr_val_batch_gold(hcsr_val_batch_orig);
+            for(rocsparse_int b = 0; b < batch_count; ++b)
+            {
+                host_vector<T>             hcsr_val_b(nnz);
+                host_vector<rocsparse_int> h_analysis_pivot_b(1);
+                host_vector<rocsparse_int> h_solve_pivot_b(1);
+                host_vector<rocsparse_int> h_singular_pivot_b(1);
+                for(rocsparse_int i = 0; i < nnz; ++i)
+                {
+                    hcsr_val_b[i] = hcsr_val_batch_orig[b * batch_stride + i];
+                }
+
+                double tol = 0;
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_get_tolerance(handle, info, &tol));
+
+                host_csrilu0<T>(M,
+                                hcsr_row_ptr,
+                                hcsr_col_ind,
+                                hcsr_val_b,
+                                base,
+                                h_analysis_pivot_b,
+                                h_solve_pivot_b,
+                                h_singular_pivot_b,
+                                tol,
+                                boost,
+                                *get_boost_tol(&h_boost_tol),
+                                h_boost_val);
+
+                for(rocsparse_int i = 0; i < nnz; ++i)
+                {
+                    hcsr_val_batch_gold[b * batch_stride + i] = hcsr_val_b[i];
+                }
+            }
+            hcsr_val_batch_gold.near_check(hcsr_val_batch);
         }
     }
 
@@ -427,6 +512,46 @@ void testing_csrilu0_bad_arg(const Arguments& arg)
         rocsparse_csrilu0_numeric_boost<T>(handle, info, 1, get_boost_tol(boost_tol), nullptr),
         rocsparse_status_invalid_pointer);
 
+    // Test rocsparse_csrilu0_refactorize()
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrilu0_refactorize<T>(nullptr, descr, csr_val, info, temp_buffer),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrilu0_refactorize<T>(handle, nullptr, csr_val, info, temp_buffer),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrilu0_refactorize<T>(handle, descr, csr_val, nullptr, temp_buffer),
+        rocsparse_status_invalid_pointer);
+    // No analysis meta data available
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrilu0_refactorize<T>(handle, descr, csr_val, info, temp_buffer),
+        rocsparse_status_invalid_pointer);
+
+    // Test rocsparse_csrilu0_refactorize_batched_buffer_size()
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrilu0_refactorize_batched_buffer_size(nullptr, info, 1, buffer_size),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrilu0_refactorize_batched_buffer_size(handle, nullptr, 1, buffer_size),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrilu0_refactorize_batched_buffer_size(handle, info, 1, buffer_size),
+        rocsparse_status_invalid_pointer);
+
+    // Test rocsparse_csrilu0_refactorize_batched()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrilu0_refactorize_batched<T>(
+                                nullptr, descr, 1, csr_val, nnz, info, temp_buffer),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrilu0_refactorize_batched<T>(
+                                handle, nullptr, 1, csr_val, nnz, info, temp_buffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrilu0_refactorize_batched<T>(
+                                handle, descr, -1, csr_val, nnz, info, temp_buffer),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrilu0_refactorize_batched<T>(
+                                handle, descr, 1, csr_val, nnz, nullptr, temp_buffer),
+                            rocsparse_status_invalid_pointer);
+
     // Test rocsparse_csrilu0_zero_pivot()
     rocsparse_int position;
     EXPECT_ROCSPARSE_STATUS(rocsparse_csrilu0_zero_pivot(nullptr, info, &position),
@@ -22,9 +22,35 @@
  *
  * ************************************************************************ */
 
+#include "rocsparse_bench_log.hpp"
 #include "rocsparse_enum.hpp"
 #include "testing.hpp"
 
+#include <fstream>
+#include <sstream>
+
+// Kernel launch callback counting the reported launches in user_data
+static void testing_csrmv_count_launches(const rocsparse_kernel_launch_info* info, void* user_data)
+{
+    ++*static_cast<int64_t*>(user_data);
+}
+
+// Kernel launch reported to the callback, with copies of its strings
+struct testing_csrmv_launch
+{
+    rocsparse_kernel_launch_info info;
+    std::string                  routine;
+    std::string                  kernel;
+};
+
+// Kernel launch callback recording the reported launches in user_data
+static void testing_csrmv_record_launches(const rocsparse_kernel_launch_info* info,
+                                          void*                               user_data)
+{
+    static_cast<std::vector<testing_csrmv_launch>*>(user_data)->push_back(
+        {*info, info->routine, info->kernel});
+}
+
 template <typename T>
 void testing_csrmv_bad_arg(const Arguments& arg)
 {
@@ -212,6 +238,155 @@ void testing_csrmv(const Arguments& arg)
         CHECK_ROCSPARSE_ERROR(testing::rocsparse_csrmv<T>(PARAMS(d_alpha, dA, dx, d_beta, dy)));
 
         hy.near_check(dy, tol);
+
+        //
+        // KERNEL INSTRUMENTATION
+        //
+        // Timed launches block the host, they are not captured into a graph
+        std::vector<testing_csrmv_launch> launches;
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_set_kernel_instrumentation(handle,
+                                                 rocsparse_instrumentation_mode_timed,
+                                                 testing_csrmv_record_launches,
+                                                 &launches));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv<T>(PARAMS(d_alpha, dA, dx, d_beta, dy)));
+
+        const rocsparse_int ysize = (trans == rocsparse_operation_none) ? M : N;
+        if(ysize > 0)
+        {
+            unit_check_scalar<int32_t>(1, launches.empty() ? 0 : 1);
+        }
+
+        const std::string routine = std::string("rocsparse_")
+                                    + (std::is_same<T, float>{}                     ? "s"
+                                       : std::is_same<T, double>{}                  ? "d"
+                                       : std::is_same<T, rocsparse_float_complex>{} ? "c"
+                                                                                    : "z")
+                                    + "csrmv";
+
+        hipStream_t stream;
+        CHECK_ROCSPARSE_ERROR(rocsparse_get_stream(handle, &stream));
+
+        bool csrmv_kernel = false;
+        for(const testing_csrmv_launch& launch : launches)
+        {
+            const rocsparse_kernel_launch_info& l = launch.info;
+
+            unit_check_scalar<int32_t>(1, (launch.routine == routine) ? 1 : 0);
+            unit_check_scalar<int32_t>(1, (l.stream == stream) ? 1 : 0);
+            unit_check_scalar<int32_t>(
+                1, (l.grid[0] > 0 && l.grid[1] > 0 && l.grid[2] > 0) ? 1 : 0);
+            unit_check_scalar<int32_t>(
+                1, (l.block[0] > 0 && l.block[1] > 0 && l.block[2] > 0) ? 1 : 0);
+            unit_check_scalar<int32_t>(1, (l.block[0] * l.block[1] * l.block[2] <= 1024) ? 1 : 0);
+
+            // Timed, since the stream is not captured
+            unit_check_scalar<int32_t>(1, (l.duration_ms >= 0.0f) ? 1 : 0);
+
+            // The estimate of the product is attached to its launches
+            if(M > 0 && N > 0 && dA.nnz > 0)
+            {
+                unit_check_scalar<int32_t>(1, (l.bytes > 0.0) ? 1 : 0);
+                unit_check_scalar<double>(2.0 * dA.nnz + 2.0 * ysize, l.flops);
+            }
+
+            csrmv_kernel |= (launch.kernel.find("csrmv") != std::string::npos);
+        }
+
+        if(M > 0 && N > 0 && dA.nnz > 0)
+        {
+            unit_check_scalar<int32_t>(1, csrmv_kernel ? 1 : 0);
+        }
+
+        // The launches of a handle without instrumentation are not reported, even though
+        // this thread called the instrumented handle before
+        {
+            rocsparse_local_handle other_handle;
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_pointer_mode(other_handle, rocsparse_pointer_mode_device));
+
+            const size_t instrumented_launches = launches.size();
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmv<T>(other_handle,
+                                                     trans,
+                                                     dA.m,
+                                                     dA.n,
+                                                     dA.nnz,
+                                                     d_alpha,
+                                                     descr,
+                                                     dA.val,
+                                                     dA.ptr,
+                                                     dA.ind,
+                                                     info,
+                                                     dx,
+                                                     d_beta,
+                                                     dy));
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+            unit_check_scalar<size_t>(instrumented_launches, launches.size());
+
+            // The instrumented handle still reports its launches
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmv<T>(PARAMS(d_alpha, dA, dx, d_beta, dy)));
+            if(ysize > 0)
+            {
+                unit_check_scalar<int32_t>(
+                    1, (launches.size() > instrumented_launches) ? 1 : 0);
+            }
+        }
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_kernel_instrumentation(
+            handle, rocsparse_instrumentation_mode_none, nullptr, nullptr));
+
+        // A handle destroyed while instrumented does not receive the launches of a handle
+        // created after it, possibly at the same address
+        {
+            int64_t destroyed_launches = 0;
+            {
+                rocsparse_local_handle destroyed_handle;
+                CHECK_ROCSPARSE_ERROR(rocsparse_set_kernel_instrumentation(
+                    destroyed_handle,
+                    rocsparse_instrumentation_mode_launch,
+                    testing_csrmv_count_launches,
+                    &destroyed_launches));
+                CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(destroyed_handle,
+                                                                 rocsparse_pointer_mode_device));
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrmv<T>(destroyed_handle,
+                                                         trans,
+                                                         dA.m,
+                                                         dA.n,
+                                                         dA.nnz,
+                                                         d_alpha,
+                                                         descr,
+                                                         dA.val,
+                                                         dA.ptr,
+                                                         dA.ind,
+                                                         info,
+                                                         dx,
+                                                         d_beta,
+                                                         dy));
+                CHECK_HIP_ERROR(hipDeviceSynchronize());
+            }
+
+            const int64_t reported_launches = destroyed_launches;
+
+            rocsparse_local_handle new_handle;
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_pointer_mode(new_handle, rocsparse_pointer_mode_device));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmv<T>(new_handle,
+                                                     trans,
+                                                     dA.m,
+                                                     dA.n,
+                                                     dA.nnz,
+                                                     d_alpha,
+                                                     descr,
+                                                     dA.val,
+                                                     dA.ptr,
+                                                     dA.ind,
+                                                     info,
+                                                     dx,
+                                                     d_beta,
+                                                     dy));
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+            unit_check_scalar<int64_t>(reported_launches, destroyed_launches);
+        }
     }
 
     if(arg.timing)
@@ -277,4 +452,394 @@ INSTANTIATE(float);
 INSTANTIATE(double);
 INSTANTIATE(rocsparse_float_complex);
 INSTANTIATE(rocsparse_double_complex);
-void testing_csrmv_extra(const Arguments& arg) {}
+
+//
+// The adaptive row blocks are computed in concurrent chunks of at least 65536 rows that
+// are stitched together afterwards. Check the adaptive SpMV against a host reference on
+// matrices that span several chunks and mix empty, short, long and very long rows, such
+// that chunk boundaries fall into every kind of row block.
+//
+template <typename I, typename J>
+static void testing_csrmv_extra_adaptive(J m)
+{
+    const J n = m;
+
+    host_vector<I> hcsr_row_ptr(m + 1);
+
+    hcsr_row_ptr[0] = 0;
+    for(J i = 0; i < m; ++i)
+    {
+        const J r = static_cast<J>((static_cast<uint64_t>(i) * 2654435761ULL) % 10000);
+
+        I row_length;
+        if(r < 1000)
+        {
+            row_length = 0;
+        }
+        else if(r < 9700)
+        {
+            row_length = r % 9;
+        }
+        else if(r < 9990)
+        {
+            row_length = 129 + r % 200;
+        }
+        else if(r < 9998)
+        {
+            row_length = 3072 + r % 997;
+        }
+        else
+        {
+            row_length = 20000 + r;
+        }
+
+        // Runs of identical rows filling row blocks exactly.
+        if((i / 4096) % 7 == 3)
+        {
+            row_length = 32;
+        }
+
+        hcsr_row_ptr[i + 1] = hcsr_row_ptr[i] + row_length;
+    }
+
+    const I nnz = hcsr_row_ptr[m];
+
+    // Sorted column indices, small integer values such that the results are exact
+    host_vector<J>     hcsr_col_ind(nnz);
+    host_vector<float> hcsr_val(nnz);
+    host_vector<float> hx(n);
+    host_vector<float> hy(m);
+    host_vector<float> hy_gold(m);
+
+    for(J j = 0; j < n; ++j)
+    {
+        hx[j] = static_cast<float>(1 + j % 2);
+    }
+
+    for(J i = 0; i < m; ++i)
+    {
+        const I row_begin = hcsr_row_ptr[i];
+        const I row_end   = hcsr_row_ptr[i + 1];
+        const J start
+            = static_cast<J>((static_cast<int64_t>(i) * 31) % (n - (row_end - row_begin) + 1));
+
+        int64_t sum = 0;
+        for(I k = row_begin; k < row_end; ++k)
+        {
+            hcsr_col_ind[k] = start + static_cast<J>(k - row_begin);
+            hcsr_val[k]     = static_cast<float>(1 + k % 3);
+            sum += static_cast<int64_t>(hcsr_val[k]) * static_cast<int64_t>(hx[hcsr_col_ind[k]]);
+        }
+
+        hy[i]      = 1.0f;
+        hy_gold[i] = static_cast<float>(2 * sum + 1);
+    }
+
+    device_vector<I>     dcsr_row_ptr(hcsr_row_ptr);
+    device_vector<J>     dcsr_col_ind(hcsr_col_ind);
+    device_vector<float> dcsr_val(hcsr_val);
+    device_vector<float> dx(hx);
+    device_vector<float> dy(hy);
+
+    rocsparse_local_handle handle;
+    rocsparse_local_spmat  A(m,
+                             n,
+                             nnz,
+                             dcsr_row_ptr,
+                             dcsr_col_ind,
+                             dcsr_val,
+                             get_indextype<I>(),
+                             get_indextype<J>(),
+                             rocsparse_index_base_zero,
+                             rocsparse_datatype_f32_r,
+                             rocsparse_format_csr);
+    rocsparse_local_dnvec  x(n, dx, rocsparse_datatype_f32_r);
+    rocsparse_local_dnvec  y(m, dy, rocsparse_datatype_f32_r);
+
+    const float alpha = 2.0f;
+    const float beta  = 1.0f;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmv(handle,
+                                         rocsparse_operation_none,
+                                         &alpha,
+                                         A,
+                                         x,
+                                         &beta,
+                                         y,
+                                         rocsparse_datatype_f32_r,
+                                         rocsparse_spmv_alg_csr_adaptive,
+                                         rocsparse_spmv_stage_buffer_size,
+                                         &buffer_size,
+                                         nullptr));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(rocsparse_hipMalloc(&dbuffer, buffer_size));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmv(handle,
+                                         rocsparse_operation_none,
+                                         &alpha,
+                                         A,
+                                         x,
+                                         &beta,
+                                         y,
+                                         rocsparse_datatype_f32_r,
+                                         rocsparse_spmv_alg_csr_adaptive,
+                                         rocsparse_spmv_stage_preprocess,
+                                         &buffer_size,
+                                         dbuffer));
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmv(handle,
+                                         rocsparse_operation_none,
+                                         &alpha,
+                                         A,
+                                         x,
+                                         &beta,
+                                         y,
+                                         rocsparse_datatype_f32_r,
+                                         rocsparse_spmv_alg_csr_adaptive,
+                                         rocsparse_spmv_stage_compute,
+                                         &buffer_size,
+                                         dbuffer));
+
+    hy.transfer_from(dy);
+    hy_gold.unit_check(hy);
+
+    CHECK_HIP_ERROR(rocsparse_hipFree(dbuffer));
+}
+
+template <typename T>
+static void testing_csrmv_extra_bench_log_calls(rocsparse_handle handle, T alpha, int num_calls)
+{
+    const host_vector<rocsparse_int> hcsr_row_ptr = {0, 2, 3, 4};
+    const host_vector<rocsparse_int> hcsr_col_ind = {0, 2, 1, 2};
+    const host_vector<T>             hcsr_val     = {1, 2, 3, 4};
+    const host_vector<T>             hx           = {1, 1, 1};
+
+    device_vector<rocsparse_int> dcsr_row_ptr(hcsr_row_ptr);
+    device_vector<rocsparse_int> dcsr_col_ind(hcsr_col_ind);
+    device_vector<T>             dcsr_val(hcsr_val);
+    device_vector<T>             dx(hx);
+    device_vector<T>             dy(3);
+
+    rocsparse_local_mat_descr descr;
+
+    const T beta = static_cast<T>(0);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    for(int i = 0; i < num_calls; ++i)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv<T>(handle,
+                                                 rocsparse_operation_none,
+                                                 3,
+                                                 3,
+                                                 4,
+                                                 &alpha,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 nullptr,
+                                                 dx,
+                                                 &beta,
+                                                 dy));
+    }
+}
+
+//
+// The bench log written by csrmv is parsed back into its unique calls, in order of their
+// first occurrence and weighted by their number of occurrences.
+//
+static void testing_csrmv_extra_bench_log()
+{
+    const std::string filename = rocsparse_tmpname();
+
+    const char*       env_layer = getenv("ROCSPARSE_LAYER");
+    const char*       env_path  = getenv("ROCSPARSE_LOG_BENCH_PATH");
+    const std::string saved_layer((env_layer != nullptr) ? env_layer : "");
+    const std::string saved_path((env_path != nullptr) ? env_path : "");
+
+    rocsparse_setenv("ROCSPARSE_LAYER", "2");
+    rocsparse_setenv("ROCSPARSE_LOG_BENCH_PATH", filename.c_str());
+
+    {
+        // The log is closed once the handle is destroyed
+        rocsparse_local_handle handle;
+
+        testing_csrmv_extra_bench_log_calls<float>(handle, 2.0f, 3);
+        testing_csrmv_extra_bench_log_calls<double>(handle, 0.5, 1);
+        testing_csrmv_extra_bench_log_calls<float>(handle, 1.0f, 2);
+        testing_csrmv_extra_bench_log_calls<float>(handle, 2.0f, 1);
+    }
+
+    rocsparse_setenv("ROCSPARSE_LAYER", (env_layer != nullptr) ? saved_layer.c_str() : nullptr);
+    rocsparse_setenv("ROCSPARSE_LOG_BENCH_PATH",
+                     (env_path != nullptr) ? saved_path.c_str() : nullptr);
+
+    std::vector<rocsparse_bench_log_call> calls;
+    int64_t                               nlines;
+    {
+        std::ifstream in(filename);
+        CHECK_ROCSPARSE_ERROR(rocsparse_bench_log_parse(in, calls, nlines));
+    }
+    std::remove(filename.c_str());
+
+    unit_check_scalar<int64_t>(7, nlines);
+    unit_check_scalar<size_t>(3, calls.size());
+
+    const int64_t     counts[]     = {4, 1, 2};
+    const char* const precisions[] = {"s", "d", "s"};
+    const char* const alphas[]     = {"2", "0.5", "1"};
+    for(size_t i = 0; i < calls.size(); ++i)
+    {
+        const std::vector<std::string> args = {"-f",
+                                               "csrmv",
+                                               "-r",
+                                               precisions[i],
+                                               "--indextype",
+                                               (sizeof(rocsparse_int) == 8) ? "d" : "s",
+                                               "-m",
+                                               "3",
+                                               "-n",
+                                               "3",
+                                               "-z",
+                                               "4",
+                                               "--alpha",
+                                               alphas[i],
+                                               "--beta",
+                                               "0",
+                                               "--transposeA",
+                                               "N",
+                                               "--indexbaseA",
+                                               "0",
+                                               "--matrix_type",
+                                               "0",
+                                               "--uplo",
+                                               "L",
+                                               "--spmv_alg",
+                                               std::to_string(rocsparse_spmv_alg_csr_stream)};
+
+        unit_check_scalar<int64_t>(counts[i], calls[i].count);
+        unit_check_scalar<int32_t>(1, (calls[i].routine == "csrmv") ? 1 : 0);
+        unit_check_scalar<int32_t>(1, (calls[i].args == args) ? 1 : 0);
+    }
+
+    // Lines which are not rocsparse-bench command lines are skipped, recorded calls
+    // without function are rejected
+    {
+        std::istringstream in("rocsparse info: unrelated line\n"
+                              "./rocsparse-bench -f csrmv -r s -m 3\n");
+        CHECK_ROCSPARSE_ERROR(rocsparse_bench_log_parse(in, calls, nlines));
+        unit_check_scalar<int64_t>(1, nlines);
+        unit_check_scalar<size_t>(1, calls.size());
+    }
+    {
+        std::istringstream in("./rocsparse-bench -f csrmv -r s -m 3\n"
+                              "./rocsparse-bench -r s -m 3\n");
+        EXPECT_ROCSPARSE_STATUS(rocsparse_bench_log_parse(in, calls, nlines),
+                                rocsparse_status_invalid_value);
+    }
+    {
+        std::istringstream in("./rocsparse-bench -r s -f\n");
+        EXPECT_ROCSPARSE_STATUS(rocsparse_bench_log_parse(in, calls, nlines),
+                                rocsparse_status_invalid_value);
+    }
+}
+
+//
+// With trace logging, the kernels launched by a call are summarized in the trace log once
+// the next call of the handle begins.
+//
+static void testing_csrmv_extra_instrumentation_trace()
+{
+    const std::string filename = rocsparse_tmpname();
+
+    const char*       env_layer = getenv("ROCSPARSE_LAYER");
+    const char*       env_path  = getenv("ROCSPARSE_LOG_TRACE_PATH");
+    const std::string saved_layer((env_layer != nullptr) ? env_layer : "");
+    const std::string saved_path((env_path != nullptr) ? env_path : "");
+
+    rocsparse_setenv("ROCSPARSE_LAYER", "1");
+    rocsparse_setenv("ROCSPARSE_LOG_TRACE_PATH", filename.c_str());
+
+    std::vector<testing_csrmv_launch> launches;
+    {
+        // The log is closed once the handle is destroyed
+        rocsparse_local_handle handle;
+
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_set_kernel_instrumentation(handle,
+                                                 rocsparse_instrumentation_mode_timed,
+                                                 testing_csrmv_record_launches,
+                                                 &launches));
+        testing_csrmv_extra_bench_log_calls<float>(handle, 2.0f, 1);
+
+        // Writes the summary of the product
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_kernel_instrumentation(
+            handle, rocsparse_instrumentation_mode_none, nullptr, nullptr));
+    }
+
+    rocsparse_setenv("ROCSPARSE_LAYER", (env_layer != nullptr) ? saved_layer.c_str() : nullptr);
+    rocsparse_setenv("ROCSPARSE_LOG_TRACE_PATH",
+                     (env_path != nullptr) ? saved_path.c_str() : nullptr);
+
+    unit_check_scalar<int32_t>(1, launches.empty() ? 0 : 1);
+
+    // kernel_summary,function,kernel,launches,duration
+    // call_summary,function,launches,duration,bytes,flops
+    int64_t                  kernel_launches = 0;
+    std::vector<std::string> call_summary;
+    {
+        std::ifstream in(filename);
+        std::string   line;
+        while(std::getline(in, line))
+        {
+            if(line.compare(0, 15, "kernel_summary,") == 0)
+            {
+                unit_check_scalar<int32_t>(
+                    1, (line.compare(15, 17, "rocsparse_scsrmv,") == 0) ? 1 : 0);
+
+                // The kernel may hold commas, the launches and duration are the last fields
+                const size_t comma = line.rfind(',');
+                const size_t begin = line.rfind(',', comma - 1) + 1;
+                kernel_launches += std::stoll(line.substr(begin, comma - begin));
+                unit_check_scalar<int32_t>(1, (std::stod(line.substr(comma + 1)) >= 0.0) ? 1 : 0);
+            }
+            else if(line.compare(0, 13, "call_summary,") == 0)
+            {
+                unit_check_scalar<size_t>(0, call_summary.size());
+
+                std::istringstream fields(line);
+                std::string        field;
+                while(std::getline(fields, field, ','))
+                {
+                    call_summary.push_back(field);
+                }
+            }
+        }
+    }
+    std::remove(filename.c_str());
+
+    unit_check_scalar<int64_t>(launches.size(), kernel_launches);
+
+    unit_check_scalar<size_t>(6, call_summary.size());
+    unit_check_scalar<int32_t>(1, (call_summary[1] == "rocsparse_scsrmv") ? 1 : 0);
+    unit_check_scalar<int64_t>(launches.size(), std::stoll(call_summary[2]));
+    unit_check_scalar<int32_t>(1, (std::stod(call_summary[3]) >= 0.0) ? 1 : 0);
+    unit_check_scalar<int32_t>(1, (std::stod(call_summary[4]) > 0.0) ? 1 : 0);
+
+    // Two flops per non-zero entry and per entry of y
+    unit_check_scalar<double>(2.0 * 4 + 2.0 * 3, std::stod(call_summary[5]));
+}
+
+void testing_csrmv_extra(const Arguments& arg)
+{
+    testing_csrmv_extra_bench_log();
+    testing_csrmv_extra_instrumentation_trace();
+
+    // More than two chunks of rows.
+    testing_csrmv_extra_adaptive<int32_t, int32_t>(2 * 65536 + 1);
+    testing_csrmv_extra_adaptive<int64_t, int32_t>(3 * 65536 + 4711);
+    testing_csrmv_extra_adaptive<int64_t, int64_t>(5 * 65536 - 1);
+}
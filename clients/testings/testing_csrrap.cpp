@@ -0,0 +1,422 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+template <typename T>
+void testing_csrrap_bad_arg(const Arguments& arg)
+{
+    static const size_t              safe_size = 1;
+    host_dense_vector<rocsparse_int> hcsr_row_ptr_C(safe_size + 1);
+    hcsr_row_ptr_C[0] = 0;
+    hcsr_row_ptr_C[1] = 1;
+    device_dense_vector<rocsparse_int> dcsr_row_ptr_C(hcsr_row_ptr_C);
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    // Create matrix descriptors
+    rocsparse_local_mat_descr local_descr_R;
+    rocsparse_local_mat_descr local_descr_A;
+    rocsparse_local_mat_descr local_descr_P;
+    rocsparse_local_mat_descr local_descr_C;
+
+    rocsparse_handle          handle        = local_handle;
+    rocsparse_int             m             = safe_size;
+    rocsparse_int             n             = safe_size;
+    rocsparse_int             k             = safe_size;
+    const rocsparse_mat_descr descr_R       = local_descr_R;
+    rocsparse_int             nnz_R         = safe_size;
+    const T*                  csr_val_R     = (const T*)0x4;
+    const rocsparse_int*      csr_row_ptr_R = (const rocsparse_int*)0x4;
+    const rocsparse_int*      csr_col_ind_R = (const rocsparse_int*)0x4;
+    const rocsparse_mat_descr descr_A       = local_descr_A;
+    rocsparse_int             nnz_A         = safe_size;
+    const T*                  csr_val_A     = (const T*)0x4;
+    const rocsparse_int*      csr_row_ptr_A = (const rocsparse_int*)0x4;
+    const rocsparse_int*      csr_col_ind_A = (const rocsparse_int*)0x4;
+    const rocsparse_mat_descr descr_P       = local_descr_P;
+    rocsparse_int             nnz_P         = safe_size;
+    const T*                  csr_val_P     = (const T*)0x4;
+    const rocsparse_int*      csr_row_ptr_P = (const rocsparse_int*)0x4;
+    const rocsparse_int*      csr_col_ind_P = (const rocsparse_int*)0x4;
+    const rocsparse_mat_descr descr_C       = local_descr_C;
+    T*                        csr_val_C     = (T*)0x4;
+    rocsparse_int*            csr_row_ptr_C = (rocsparse_int*)dcsr_row_ptr_C;
+    rocsparse_int*            csr_col_ind_C = (rocsparse_int*)0x4;
+    rocsparse_int*            nnz_C         = (rocsparse_int*)0x4;
+    size_t*                   buffer_size   = (size_t*)0x4;
+    void*                     temp_buffer   = (void*)0x4;
+
+#define PARAMS_BUFFER_SIZE                                                                 \
+    handle, m, n, k, descr_R, nnz_R, csr_row_ptr_R, csr_col_ind_R, descr_A, nnz_A,         \
+        csr_row_ptr_A, csr_col_ind_A, descr_P, nnz_P, csr_row_ptr_P, csr_col_ind_P, buffer_size
+#define PARAMS_NNZ                                                                           \
+    handle, m, n, k, descr_R, nnz_R, csr_row_ptr_R, csr_col_ind_R, descr_A, nnz_A,           \
+        csr_row_ptr_A, csr_col_ind_A, descr_P, nnz_P, csr_row_ptr_P, csr_col_ind_P, descr_C, \
+        csr_row_ptr_C, nnz_C, temp_buffer
+#define PARAMS                                                                                \
+    handle, m, n, k, descr_R, nnz_R, csr_val_R, csr_row_ptr_R, csr_col_ind_R, descr_A, nnz_A, \
+        csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_P, nnz_P, csr_val_P, csr_row_ptr_P,    \
+        csr_col_ind_P, descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C
+
+    bad_arg_analysis(rocsparse_csrrap_buffer_size, PARAMS_BUFFER_SIZE);
+    bad_arg_analysis(rocsparse_csrrap_nnz, PARAMS_NNZ);
+    bad_arg_analysis(rocsparse_csrrap<T>, PARAMS);
+
+    // Not implemented cases
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr_A, rocsparse_matrix_type_symmetric));
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_buffer_size(PARAMS_BUFFER_SIZE),
+                            rocsparse_status_not_implemented);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(PARAMS_NNZ), rocsparse_status_not_implemented);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(PARAMS), rocsparse_status_not_implemented);
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr_A, rocsparse_matrix_type_general));
+
+#undef PARAMS
+#undef PARAMS_NNZ
+#undef PARAMS_BUFFER_SIZE
+}
+
+template <typename T>
+void testing_csrrap(const Arguments& arg)
+{
+    rocsparse_int        M     = arg.M;
+    rocsparse_int        N     = arg.N;
+    rocsparse_int        K     = arg.K;
+    rocsparse_index_base baseA = arg.baseA;
+    rocsparse_index_base baseR = arg.baseB;
+    rocsparse_index_base baseP = arg.baseB;
+    rocsparse_index_base baseC = arg.baseC;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle(arg);
+
+    // Create matrix descriptors
+    rocsparse_local_mat_descr descr_R;
+    rocsparse_local_mat_descr descr_A;
+    rocsparse_local_mat_descr descr_P;
+    rocsparse_local_mat_descr descr_C;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr_R, baseR));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr_A, baseA));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr_P, baseP));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr_C, baseC));
+
+#define PARAMS_BUFFER_SIZE(R_, A_, P_, out_buffer_size_)                                         \
+    handle, R_.m, A_.m, P_.n, descr_R, R_.nnz, R_.ptr, R_.ind, descr_A, A_.nnz, A_.ptr, A_.ind, \
+        descr_P, P_.nnz, P_.ptr, P_.ind, &out_buffer_size_
+#define PARAMS_NNZ(R_, A_, P_, C_, out_nnz_)                                                     \
+    handle, R_.m, A_.m, P_.n, descr_R, R_.nnz, R_.ptr, R_.ind, descr_A, A_.nnz, A_.ptr, A_.ind, \
+        descr_P, P_.nnz, P_.ptr, P_.ind, descr_C, C_.ptr, out_nnz_, dbuffer
+#define PARAMS(R_, A_, P_, C_)                                                                  \
+    handle, R_.m, A_.m, P_.n, descr_R, R_.nnz, R_.val, R_.ptr, R_.ind, descr_A, A_.nnz, A_.val, \
+        A_.ptr, A_.ind, descr_P, P_.nnz, P_.val, P_.ptr, P_.ind, descr_C, C_.val, C_.ptr, C_.ind
+
+    void* dbuffer = nullptr;
+
+    //
+    // Argument sanity check before allocating invalid memory
+    //
+    if(M <= 0 || N <= 0 || K <= 0)
+    {
+        device_csr_matrix<T> d_R, d_A, d_P, d_C;
+        d_R.define(M, N, 0, baseR);
+        d_A.define(N, N, 0, baseA);
+        d_P.define(N, K, 0, baseP);
+        d_C.define(M, K, 0, baseC);
+
+        size_t out_buffer_size;
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_csrrap_buffer_size(PARAMS_BUFFER_SIZE(d_R, d_A, d_P, out_buffer_size)),
+            (M < 0 || N < 0 || K < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+
+        rocsparse_int out_nnz;
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_csrrap_nnz(PARAMS_NNZ(d_R, d_A, d_P, d_C, &out_nnz)),
+            (M < 0 || N < 0 || K < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_csrrap<T>(PARAMS(d_R, d_A, d_P, d_C)),
+            (M < 0 || N < 0 || K < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        return;
+    }
+
+    //
+    // Declare host objects.
+    //
+    host_csr_matrix<T> h_R, h_A, h_P, h_AP, h_C;
+
+    //
+    // Initialize matrices, the operator A is initialized first since its size can be set by
+    // the matrix file.
+    //
+    {
+        rocsparse_matrix_factory<T> matrix_factory(arg, arg.timing ? false : true);
+        matrix_factory.init_csr(h_A, N, N, baseA);
+
+        rocsparse_matrix_factory_random<T> rf(false);
+
+        h_R.base = baseR;
+        h_R.m    = M;
+        h_R.n    = N;
+        rf.init_csr(h_R.ptr,
+                    h_R.ind,
+                    h_R.val,
+                    h_R.m,
+                    h_R.n,
+                    h_R.nnz,
+                    h_R.base,
+                    rocsparse_matrix_type_general,
+                    rocsparse_fill_mode_lower,
+                    rocsparse_storage_mode_sorted);
+
+        h_P.base = baseP;
+        h_P.m    = N;
+        h_P.n    = K;
+        rf.init_csr(h_P.ptr,
+                    h_P.ind,
+                    h_P.val,
+                    h_P.m,
+                    h_P.n,
+                    h_P.nnz,
+                    h_P.base,
+                    rocsparse_matrix_type_general,
+                    rocsparse_fill_mode_lower,
+                    rocsparse_storage_mode_sorted);
+
+        h_C.define(M, K, 0, baseC);
+    }
+
+    //
+    // Declare device objects.
+    //
+    device_csr_matrix<T> d_R(h_R), d_A(h_A), d_P(h_P), d_C(h_C);
+
+    // Obtain required buffer size
+    size_t out_buffer_size;
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_csrrap_buffer_size(PARAMS_BUFFER_SIZE(d_R, d_A, d_P, out_buffer_size)));
+
+    CHECK_HIP_ERROR(rocsparse_hipMalloc(&dbuffer, out_buffer_size));
+
+    if(arg.unit_check)
+    {
+        //
+        // Host calculation, C = R * (A * P).
+        //
+        {
+            host_scalar<T> h_one(static_cast<T>(1));
+            rocsparse_int  out_nnz;
+
+            h_AP.define(N, K, 0, rocsparse_index_base_zero);
+
+            host_csrgemm_nnz<T, rocsparse_int, rocsparse_int>(h_A.m,
+                                                              h_P.n,
+                                                              h_A.n,
+                                                              h_one,
+                                                              h_A.ptr,
+                                                              h_A.ind,
+                                                              h_P.ptr,
+                                                              h_P.ind,
+                                                              nullptr,
+                                                              nullptr,
+                                                              nullptr,
+                                                              h_AP.ptr,
+                                                              &out_nnz,
+                                                              h_A.base,
+                                                              h_P.base,
+                                                              h_AP.base,
+                                                              rocsparse_index_base_zero);
+
+            h_AP.define(h_AP.m, h_AP.n, out_nnz, h_AP.base);
+
+            host_csrgemm<T, rocsparse_int, rocsparse_int>(h_A.m,
+                                                          h_P.n,
+                                                          h_A.n,
+                                                          h_one,
+                                                          h_A.ptr,
+                                                          h_A.ind,
+                                                          h_A.val,
+                                                          h_P.ptr,
+                                                          h_P.ind,
+                                                          h_P.val,
+                                                          nullptr,
+                                                          nullptr,
+                                                          nullptr,
+                                                          nullptr,
+                                                          h_AP.ptr,
+                                                          h_AP.ind,
+                                                          h_AP.val,
+                                                          h_A.base,
+                                                          h_P.base,
+                                                          h_AP.base,
+                                                          rocsparse_index_base_zero);
+
+            host_csrgemm_nnz<T, rocsparse_int, rocsparse_int>(h_R.m,
+                                                              h_AP.n,
+                                                              h_R.n,
+                                                              h_one,
+                                                              h_R.ptr,
+                                                              h_R.ind,
+                                                              h_AP.ptr,
+                                                              h_AP.ind,
+                                                              nullptr,
+                                                              nullptr,
+                                                              nullptr,
+                                                              h_C.ptr,
+                                                              &out_nnz,
+                                                              h_R.base,
+                                                              h_AP.base,
+                                                              h_C.base,
+                                                              rocsparse_index_base_zero);
+
+            h_C.define(h_C.m, h_C.n, out_nnz, h_C.base);
+
+            host_csrgemm<T, rocsparse_int, rocsparse_int>(h_R.m,
+                                                          h_AP.n,
+                                                          h_R.n,
+                                                          h_one,
+                                                          h_R.ptr,
+                                                          h_R.ind,
+                                                          h_R.val,
+                                                          h_AP.ptr,
+                                                          h_AP.ind,
+                                                          h_AP.val,
+                                                          nullptr,
+                                                          nullptr,
+                                                          nullptr,
+                                                          nullptr,
+                                                          h_C.ptr,
+                                                          h_C.ind,
+                                                          h_C.val,
+                                                          h_R.base,
+                                                          h_AP.base,
+                                                          h_C.base,
+                                                          rocsparse_index_base_zero);
+        }
+
+        {
+            //
+            // GPU with pointer mode host
+            //
+            host_scalar<rocsparse_int> h_out_nnz;
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_csrrap_nnz(PARAMS_NNZ(d_R, d_A, d_P, d_C, h_out_nnz)));
+            d_C.define(d_C.m, d_C.n, *h_out_nnz, d_C.base);
+            CHECK_ROCSPARSE_ERROR(testing::rocsparse_csrrap<T>(PARAMS(d_R, d_A, d_P, d_C)));
+            h_C.near_check(d_C);
+        }
+
+        {
+            //
+            // GPU with pointer mode device
+            //
+            device_scalar<rocsparse_int> d_out_nnz;
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_csrrap_nnz(PARAMS_NNZ(d_R, d_A, d_P, d_C, d_out_nnz)));
+            host_scalar<rocsparse_int> h_out_nnz(d_out_nnz);
+            d_C.define(d_C.m, d_C.n, 0, d_C.base);
+            d_C.define(d_C.m, d_C.n, *h_out_nnz, d_C.base);
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrrap<T>(PARAMS(d_R, d_A, d_P, d_C)));
+            h_C.near_check(d_C);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        rocsparse_int out_nnz;
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrrap_nnz(PARAMS_NNZ(d_R, d_A, d_P, d_C, &out_nnz)));
+        d_C.define(d_C.m, d_C.n, out_nnz, d_C.base);
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrrap<T>(PARAMS(d_R, d_A, d_P, d_C)));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrrap<T>(PARAMS(d_R, d_A, d_P, d_C)));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gflop_count = csrrap_gflop_count<T, rocsparse_int, rocsparse_int>(
+            M, h_R.ptr, h_R.ind, h_A.ptr, h_A.ind, h_P.ptr, h_R.base, h_A.base);
+        double gbyte_count = csrrap_gbyte_count<T, rocsparse_int, rocsparse_int>(
+            M, N, K, d_R.nnz, d_A.nnz, d_P.nnz, d_C.nnz);
+
+        double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
+        double gpu_gbyte  = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info(display_key_t::M,
+                            M,
+                            display_key_t::N,
+                            N,
+                            display_key_t::K,
+                            K,
+                            "nnz_R",
+                            d_R.nnz,
+                            display_key_t::nnz_A,
+                            d_A.nnz,
+                            "nnz_P",
+                            d_P.nnz,
+                            display_key_t::nnz_C,
+                            d_C.nnz,
+                            display_key_t::gflops,
+                            gpu_gflops,
+                            display_key_t::bandwidth,
+                            gpu_gbyte,
+                            display_key_t::time_ms,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+
+#undef PARAMS
+#undef PARAMS_NNZ
+#undef PARAMS_BUFFER_SIZE
+
+    // Free buffer
+    CHECK_HIP_ERROR(rocsparse_hipFree(dbuffer));
+}
+
+#define INSTANTIATE(TYPE)                                             \
+    template void testing_csrrap_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csrrap<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+void testing_csrrap_extra(const Arguments& arg) {}
@@ -24,6 +24,18 @@
 #include "rocsparse_enum.hpp"
 #include "testing.hpp"
 
+#include <cstring>
+
+// Count the kernels launched besides the fingerprint computed by the analysis cache
+static void testing_csrsv_count_analysis_launches(const rocsparse_kernel_launch_info* info,
+                                                  void*                               user_data)
+{
+    if(strstr(info->kernel, "analysis_fingerprint_kernel") == nullptr)
+    {
+        ++*static_cast<int64_t*>(user_data);
+    }
+}
+
 template <typename T>
 void testing_csrsv_bad_arg(const Arguments& arg)
 {
@@ -344,6 +356,152 @@ void testing_csrsv(const Arguments& arg)
             hy.near_check(dy, tol);
         }
 
+        //
+        // ANALYSIS CACHE, THE SECOND ANALYSIS MUST BE SERVED FROM THE CACHE.
+        //
+        {
+            size_t budget, used_miss, used_hit, used_changed;
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_analysis_cache(handle, size_t(1) << 30));
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+            int64_t analysis_launches = 0;
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_kernel_instrumentation(handle,
+                                                     rocsparse_instrumentation_mode_launch,
+                                                     testing_csrsv_count_analysis_launches,
+                                                     &analysis_launches));
+
+            info.reset();
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(PARAMS_ANALYSIS(dA)));
+            CHECK_ROCSPARSE_ERROR(rocsparse_get_analysis_cache(handle, &budget, &used_miss));
+            const int64_t miss_launches = analysis_launches;
+
+            // A hit only computes the fingerprint of the sparsity pattern
+            info.reset();
+            analysis_launches = 0;
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(PARAMS_ANALYSIS(dA)));
+            CHECK_ROCSPARSE_ERROR(rocsparse_get_analysis_cache(handle, &budget, &used_hit));
+            unit_check_scalar(used_miss, used_hit);
+            unit_check_scalar<int64_t>(0, analysis_launches);
+            if(dA.m > 0)
+            {
+                unit_check_scalar<int64_t>(1, std::min<int64_t>(miss_launches, 1));
+            }
+
+            host_scalar<rocsparse_int> analysis_pivot;
+            EXPECT_ROCSPARSE_STATUS(
+                rocsparse_csrsv_zero_pivot(handle, descr, info, analysis_pivot),
+                (*h_analysis_pivot != -1) ? rocsparse_status_zero_pivot : rocsparse_status_success);
+            h_analysis_pivot.unit_check(analysis_pivot);
+
+            CHECK_ROCSPARSE_ERROR(
+                testing::rocsparse_csrsv_solve<T>(PARAMS_SOLVE(h_alpha, dA, dx, dy)));
+
+            //
+            // A CHANGED SPARSITY PATTERN OF THE SAME SIZE MUST NOT BE SERVED FROM THE CACHE.
+            //
+            host_csr_matrix<T> hB(hA);
+            bool               changed = false;
+            for(rocsparse_int i = 0; i < hB.m && !changed; ++i)
+            {
+                for(rocsparse_int k = hB.ptr[i] - base; k < hB.ptr[i + 1] - base; ++k)
+                {
+                    // Move an off-diagonal entry one column to the left, if that column is free
+                    const rocsparse_int col  = hB.ind[k] - base;
+                    const rocsparse_int left = (k > hB.ptr[i] - base) ? hB.ind[k - 1] - base : -1;
+                    if(col != i && col - 1 > left)
+                    {
+                        hB.ind[k] -= 1;
+                        changed = true;
+                        break;
+                    }
+                }
+            }
+
+            if(changed)
+            {
+                host_dense_matrix<T>       hz(M, 1);
+                host_scalar<rocsparse_int> h_changed_analysis_pivot, h_changed_solve_pivot;
+                host_csrsv<rocsparse_int, rocsparse_int, T>(trans,
+                                                            hB.m,
+                                                            hB.nnz,
+                                                            *h_alpha,
+                                                            hB.ptr,
+                                                            hB.ind,
+                                                            hB.val,
+                                                            hx,
+                                                            (int64_t)1,
+                                                            hz,
+                                                            diag,
+                                                            uplo,
+                                                            base,
+                                                            h_changed_analysis_pivot,
+                                                            h_changed_solve_pivot);
+
+                device_csr_matrix<T> dB(hB);
+
+                info.reset();
+                analysis_launches = 0;
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(PARAMS_ANALYSIS(dB)));
+                CHECK_ROCSPARSE_ERROR(
+                    rocsparse_get_analysis_cache(handle, &budget, &used_changed));
+                unit_check_scalar<int64_t>(1, std::min<int64_t>(analysis_launches, 1));
+                unit_check_scalar<int32_t>(1, (used_changed > used_hit) ? 1 : 0);
+
+                EXPECT_ROCSPARSE_STATUS(
+                    rocsparse_csrsv_zero_pivot(handle, descr, info, analysis_pivot),
+                    (*h_changed_analysis_pivot != -1) ? rocsparse_status_zero_pivot
+                                                      : rocsparse_status_success);
+                h_changed_analysis_pivot.unit_check(analysis_pivot);
+
+                device_dense_matrix<T> dz(M, 1);
+                CHECK_ROCSPARSE_ERROR(
+                    testing::rocsparse_csrsv_solve<T>(PARAMS_SOLVE(h_alpha, dB, dx, dz)));
+                if(*h_changed_analysis_pivot == -1 && *h_changed_solve_pivot == -1)
+                {
+                    hz.near_check(dz, tol);
+                }
+
+                // The analysis of the original pattern is still cached
+                info.reset();
+                analysis_launches = 0;
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(PARAMS_ANALYSIS(dA)));
+                unit_check_scalar<int64_t>(0, analysis_launches);
+                CHECK_ROCSPARSE_ERROR(
+                    testing::rocsparse_csrsv_solve<T>(PARAMS_SOLVE(h_alpha, dA, dx, dy)));
+            }
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_kernel_instrumentation(
+                handle, rocsparse_instrumentation_mode_none, nullptr, nullptr));
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_analysis_cache(handle, 0));
+        }
+
+        //
+        // CAPTURE-SAFE MODE, READING THE ZERO PIVOT TO THE HOST IS REJECTED, THE SOLVE IS NOT.
+        //
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_capture_mode(handle, rocsparse_capture_mode_safe));
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+            if(dA.nnz > 0)
+            {
+                host_scalar<rocsparse_int> analysis_pivot;
+                EXPECT_ROCSPARSE_STATUS(
+                    rocsparse_csrsv_zero_pivot(handle, descr, info, analysis_pivot),
+                    rocsparse_status_not_capture_safe);
+            }
+
+            CHECK_ROCSPARSE_ERROR(
+                testing::rocsparse_csrsv_solve<T>(PARAMS_SOLVE(h_alpha, dA, dx, dy)));
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_capture_mode(handle, rocsparse_capture_mode_default));
+        }
+
+        if(*h_analysis_pivot == -1 && *h_solve_pivot == -1)
+        {
+            hy.near_check(dy, tol);
+        }
+
         //
         // A BIT MORE FOR CODE COVERAGE, WE ONLY DO ANALYSIS FOR INFO ASSIGNMENT.
         //
@@ -122,6 +122,43 @@ void testing_gebsr2gebsc_bad_arg(const Arguments& arg)
                                                      rocsparse_index_base_zero,
                                                      temp_buffer),
                             rocsparse_status_invalid_pointer);
+
+    rocsparse_local_mat_info local_info;
+    rocsparse_mat_info       info = local_info;
+
+#define PARAMS_ANALYSIS                                                                        \
+    handle, mb, nb, nnzb, bsr_row_ptr, bsr_col_ind, row_block_dim, col_block_dim, bsc_row_ind, \
+        bsc_col_ptr, idx_base, info, temp_buffer
+#define PARAMS_NUMERIC handle, mb, nb, nnzb, bsr_val, row_block_dim, col_block_dim, bsc_val, info
+    bad_arg_analysis(rocsparse_gebsr2gebsc_analysis, PARAMS_ANALYSIS);
+    bad_arg_analysis(rocsparse_gebsr2gebsc_numeric<T>, PARAMS_NUMERIC);
+
+    // Numeric conversion requires a prior analysis
+    EXPECT_ROCSPARSE_STATUS(rocsparse_gebsr2gebsc_numeric<T>(PARAMS_NUMERIC),
+                            rocsparse_status_invalid_pointer);
+
+    // Check row_block_dim == 0
+    row_block_dim = 0;
+    col_block_dim = safe_size;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_gebsr2gebsc_analysis(PARAMS_ANALYSIS),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_gebsr2gebsc_numeric<T>(PARAMS_NUMERIC),
+                            rocsparse_status_invalid_size);
+
+    // Check col_block_dim == 0
+    row_block_dim = safe_size;
+    col_block_dim = 0;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_gebsr2gebsc_analysis(PARAMS_ANALYSIS),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_gebsr2gebsc_numeric<T>(PARAMS_NUMERIC),
+                            rocsparse_status_invalid_size);
+#undef PARAMS_NUMERIC
+#undef PARAMS_ANALYSIS
+
+    EXPECT_ROCSPARSE_STATUS(rocsparse_gebsr2gebsc_clear(nullptr, info),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_gebsr2gebsc_clear(handle, nullptr),
+                            rocsparse_status_invalid_pointer);
 }
 
 template <typename T>
@@ -231,6 +268,78 @@ void testing_gebsr2gebsc(const Arguments& arg)
                                hbsr.base);
 
         hbsc.unit_check(hbsc_from_device, action == rocsparse_action_numeric);
+
+        if(action == rocsparse_action_numeric)
+        {
+            //
+            // Transpose plan, symbolic pass once and values-only conversion afterwards.
+            //
+            rocsparse_local_mat_info info;
+            device_gebsc_matrix<T>   dbsc_plan(dbsr.block_direction,
+                                             dbsr.mb,
+                                             dbsr.nb,
+                                             dbsr.nnzb,
+                                             dbsr.row_block_dim,
+                                             dbsr.col_block_dim,
+                                             dbsr.base);
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_gebsr2gebsc_analysis(handle,
+                                                                 dbsr.mb,
+                                                                 dbsr.nb,
+                                                                 dbsr.nnzb,
+                                                                 dbsr.ptr,
+                                                                 dbsr.ind,
+                                                                 dbsr.row_block_dim,
+                                                                 dbsr.col_block_dim,
+                                                                 dbsc_plan.ind,
+                                                                 dbsc_plan.ptr,
+                                                                 dbsr.base,
+                                                                 info,
+                                                                 dbuffer));
+            CHECK_ROCSPARSE_ERROR(testing::rocsparse_gebsr2gebsc_numeric<T>(handle,
+                                                                            dbsr.mb,
+                                                                            dbsr.nb,
+                                                                            dbsr.nnzb,
+                                                                            dbsr.val,
+                                                                            dbsr.row_block_dim,
+                                                                            dbsr.col_block_dim,
+                                                                            dbsc_plan.val,
+                                                                            info));
+
+            host_gebsc_matrix<T> hbsc_plan_from_device(dbsc_plan);
+
+            //
+            // The host reference follows the same two steps.
+            //
+            host_gebsc_matrix<T> hbsc_plan(hbsr.block_direction,
+                                           hbsr.mb,
+                                           hbsr.nb,
+                                           hbsr.nnzb,
+                                           hbsr.row_block_dim,
+                                           hbsr.col_block_dim,
+                                           hbsr.base);
+
+            host_vector<rocsparse_int> hperm;
+            host_csr_to_csc_analysis(hbsr.mb,
+                                     hbsr.nb,
+                                     hbsr.nnzb,
+                                     hbsr.ptr.data(),
+                                     hbsr.ind.data(),
+                                     hbsc_plan.ind,
+                                     hbsc_plan.ptr,
+                                     hperm,
+                                     hbsr.base);
+            host_csr_to_csc_numeric<rocsparse_int, T>(hbsr.nnzb,
+                                                      hbsr.row_block_dim * hbsr.col_block_dim,
+                                                      hperm,
+                                                      hbsr.val.data(),
+                                                      hbsc_plan.val.data());
+
+            hbsc_plan.unit_check(hbsc_plan_from_device, true);
+            hbsc.unit_check(hbsc_plan_from_device, true);
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_gebsr2gebsc_clear(handle, info));
+        }
     }
 
     if(arg.timing)
@@ -0,0 +1,210 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "rocsparse_exporter_matrixmarket.hpp"
+#include "rocsparse_importer_matrixmarket.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <tuple>
+
+//
+// Matrix with every third line empty, including the first one, and a second line holding an
+// entry in every column (row for CSC), such that the chunks of the parallel writer start in
+// the middle of a line and after empty lines.
+//
+template <rocsparse_direction DIRECTION, typename T, typename I, typename J>
+static void testing_matrixmarket_format_init(host_csx_matrix<DIRECTION, T, I, J>& hA,
+                                             J                                    m,
+                                             J                                    n,
+                                             rocsparse_index_base                 base)
+{
+    const J lines = (DIRECTION == rocsparse_direction_row) ? m : n;
+    const J width = (DIRECTION == rocsparse_direction_row) ? n : m;
+
+    host_dense_vector<I> ptr(lines + 1);
+    ptr[0] = base;
+    for(J i = 0; i < lines; ++i)
+    {
+        const J count = (i % 3 == 0) ? 0 : ((i == 1) ? width : std::min(width, J(3)));
+        ptr[i + 1]    = ptr[i] + count;
+    }
+
+    const I nnz = ptr[lines] - base;
+    hA.define(m, n, nnz, base);
+    for(J i = 0; i <= lines; ++i)
+    {
+        hA.ptr[i] = ptr[i];
+    }
+
+    for(J i = 0; i < lines; ++i)
+    {
+        const I begin = ptr[i] - base;
+        const J count = static_cast<J>(ptr[i + 1] - ptr[i]);
+        for(J k = 0; k < count; ++k)
+        {
+            // Sorted column (row for CSC) indices spread over the line
+            hA.ind[begin + k]
+                = ((count == width) ? k : (k * (width / 3) + (i / 3) % (width / 3))) + base;
+
+            // Values without a short decimal representation, and of both signs
+            const T x         = random_generator<T>();
+            hA.val[begin + k] = ((begin + k) % 2 == 0) ? x : -x;
+        }
+    }
+}
+
+//
+// Export a matrix with the parallel MatrixMarket writer, import it back and compare the
+// entries with the matrix sorted by rows then columns.
+//
+template <rocsparse_direction DIRECTION, typename T, typename I, typename J>
+static void testing_matrixmarket_format_round_trip(const host_csx_matrix<DIRECTION, T, I, J>& hA)
+{
+    const std::string filename = rocsparse_tmpname();
+
+    {
+        rocsparse_exporter_matrixmarket exporter(filename);
+        CHECK_ROCSPARSE_ERROR(exporter.write(hA));
+    }
+
+    rocsparse_importer_matrixmarket importer(filename);
+
+    I                    M;
+    I                    N;
+    int64_t              nnz;
+    rocsparse_index_base base;
+    CHECK_ROCSPARSE_ERROR(importer.import_sparse_coo(&M, &N, &nnz, &base));
+
+    unit_check_scalar<I>(hA.m, M);
+    unit_check_scalar<I>(hA.n, N);
+    unit_check_scalar<int64_t>(hA.nnz, nnz);
+
+    host_dense_vector<I> row_ind(nnz);
+    host_dense_vector<I> col_ind(nnz);
+    host_dense_vector<T> val(nnz);
+    CHECK_ROCSPARSE_ERROR(
+        importer.import_sparse_coo<T, I>(row_ind.data(), col_ind.data(), val.data()));
+
+    // Entries of hA, one based and sorted by rows then columns
+    const J lines = (DIRECTION == rocsparse_direction_row) ? hA.m : hA.n;
+
+    std::vector<std::tuple<I, I, int64_t>> entries(nnz);
+    for(J i = 0; i < lines; ++i)
+    {
+        for(I k = hA.ptr[i] - hA.base; k < hA.ptr[i + 1] - hA.base; ++k)
+        {
+            const I j   = hA.ind[k] - hA.base;
+            const I row = (DIRECTION == rocsparse_direction_row) ? i : j;
+            const I col = (DIRECTION == rocsparse_direction_row) ? j : i;
+            entries[k]  = std::make_tuple(row + 1, col + 1, static_cast<int64_t>(k));
+        }
+    }
+    std::sort(entries.begin(), entries.end());
+
+    host_dense_vector<I> gold_row_ind(nnz);
+    host_dense_vector<I> gold_col_ind(nnz);
+    host_dense_vector<T> gold_val(nnz);
+    for(int64_t k = 0; k < nnz; ++k)
+    {
+        gold_row_ind[k] = std::get<0>(entries[k]);
+        gold_col_ind[k] = std::get<1>(entries[k]);
+        gold_val[k]     = hA.val[std::get<2>(entries[k])];
+    }
+
+    // The values are written with a representation that reads back exactly
+    unit_check_segments<I>(nnz, gold_row_ind.data(), row_ind.data());
+    unit_check_segments<I>(nnz, gold_col_ind.data(), col_ind.data());
+    unit_check_segments<T>(nnz, gold_val.data(), val.data());
+
+    std::remove(filename.c_str());
+}
+
+template <typename I, typename J, typename T>
+void testing_matrixmarket_format_bad_arg(const Arguments& arg)
+{
+    const std::string filename = rocsparse_tmpname();
+    const I           ptr[2]   = {0, 0};
+
+    // Invalid direction
+    rocsparse_exporter_matrixmarket exporter(filename);
+    EXPECT_ROCSPARSE_STATUS(exporter.write_sparse_csx<T, I, J>((rocsparse_direction)-1,
+                                                               J(1),
+                                                               J(1),
+                                                               I(0),
+                                                               ptr,
+                                                               nullptr,
+                                                               nullptr,
+                                                               rocsparse_index_base_zero),
+                            rocsparse_status_invalid_value);
+
+    std::remove(filename.c_str());
+}
+
+template <typename I, typename J, typename T>
+void testing_matrixmarket_format(const Arguments& arg)
+{
+    J                    M    = arg.M;
+    J                    N    = arg.N;
+    rocsparse_index_base base = arg.baseA;
+
+    rocsparse_matrix_factory<T, I, J> matrix_factory(arg);
+
+    host_csr_matrix<T, I, J> hA;
+    matrix_factory.init_csr(hA, M, N, base);
+
+    host_csc_matrix<T, I, J> hB;
+    matrix_factory.init_csc(hB, M, N, base);
+
+    testing_matrixmarket_format_round_trip(hA);
+    testing_matrixmarket_format_round_trip(hB);
+
+    // Empty lines and lines split over several chunks, in both directions
+    host_csr_matrix<T, I, J> hC;
+    testing_matrixmarket_format_init(hC, M, N, base);
+    testing_matrixmarket_format_round_trip(hC);
+
+    host_csc_matrix<T, I, J> hD;
+    testing_matrixmarket_format_init(hD, M, N, base);
+    testing_matrixmarket_format_round_trip(hD);
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                                          \
+    template void testing_matrixmarket_format_bad_arg<ITYPE, JTYPE, TTYPE>(const Arguments& arg); \
+    template void testing_matrixmarket_format<ITYPE, JTYPE, TTYPE>(const Arguments& arg)
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int32_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int64_t, int64_t, double);
+INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
+void testing_matrixmarket_format_extra(const Arguments& arg) {}
@@ -0,0 +1,715 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+//
+// All formats are stored in a host_gebsr_matrix: CSR and CSC matrices are BSR matrices with
+// block dimension one, a CSC matrix of size M x N is stored as the compressed rows of its
+// N x M transpose.
+//
+template <typename T, typename I, typename J>
+static void testing_spgeam_create_descr(rocsparse_spmat_descr*        descr,
+                                        rocsparse_format              format,
+                                        device_gebsr_matrix<T, I, J>& d)
+{
+    const rocsparse_indextype itype = get_indextype<I>();
+    const rocsparse_indextype jtype = get_indextype<J>();
+    const rocsparse_datatype  ttype = get_datatype<T>();
+
+    switch(format)
+    {
+    case rocsparse_format_csr:
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_create_csr_descr(
+            descr, d.mb, d.nb, d.nnzb, d.ptr, d.ind, d.val, itype, jtype, d.base, ttype));
+        return;
+    }
+    case rocsparse_format_csc:
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_create_csc_descr(
+            descr, d.nb, d.mb, d.nnzb, d.ptr, d.ind, d.val, itype, jtype, d.base, ttype));
+        return;
+    }
+    case rocsparse_format_bsr:
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_create_bsr_descr(descr,
+                                                         d.mb,
+                                                         d.nb,
+                                                         d.nnzb,
+                                                         d.block_direction,
+                                                         d.row_block_dim,
+                                                         d.ptr,
+                                                         d.ind,
+                                                         d.val,
+                                                         itype,
+                                                         jtype,
+                                                         d.base,
+                                                         ttype));
+        return;
+    }
+    case rocsparse_format_coo:
+    case rocsparse_format_coo_aos:
+    case rocsparse_format_ell:
+    case rocsparse_format_bell:
+    {
+        std::cerr << "rocsparse_status_not_implemented" << std::endl;
+        exit(1);
+    }
+    }
+}
+
+template <typename T, typename I, typename J>
+static void testing_spgeam_set_pointers(rocsparse_spmat_descr         descr,
+                                        rocsparse_format              format,
+                                        device_gebsr_matrix<T, I, J>& d)
+{
+    switch(format)
+    {
+    case rocsparse_format_csr:
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr_set_pointers(descr, d.ptr, d.ind, d.val));
+        return;
+    }
+    case rocsparse_format_csc:
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_csc_set_pointers(descr, d.ptr, d.ind, d.val));
+        return;
+    }
+    case rocsparse_format_bsr:
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_bsr_set_pointers(descr, d.ptr, d.ind, d.val));
+        return;
+    }
+    case rocsparse_format_coo:
+    case rocsparse_format_coo_aos:
+    case rocsparse_format_ell:
+    case rocsparse_format_bell:
+    {
+        std::cerr << "rocsparse_status_not_implemented" << std::endl;
+        exit(1);
+    }
+    }
+}
+
+template <typename T, typename I, typename J>
+static void testing_spgeam_host(T                                 alpha,
+                                const host_gebsr_matrix<T, I, J>& hA,
+                                T                                 beta,
+                                const host_gebsr_matrix<T, I, J>& hB,
+                                host_gebsr_matrix<T, I, J>&       hC)
+{
+    I nnz_C = 0;
+    hC.define(hA.block_direction,
+              hA.mb,
+              hA.nb,
+              nnz_C,
+              hA.row_block_dim,
+              hA.col_block_dim,
+              hC.base);
+    host_spgeam_nnz<T, I, J>(
+        hA.mb, hA.nb, hA.ptr, hA.ind, hB.ptr, hB.ind, hC.ptr, &nnz_C, hA.base, hB.base, hC.base);
+    hC.define(hC.block_direction,
+              hC.mb,
+              hC.nb,
+              nnz_C,
+              hC.row_block_dim,
+              hC.col_block_dim,
+              hC.base);
+    host_spgeam<T, I, J>(hA.mb,
+                         hA.nb,
+                         static_cast<I>(hA.row_block_dim * hA.col_block_dim),
+                         alpha,
+                         hA.ptr,
+                         hA.ind,
+                         hA.val,
+                         beta,
+                         hB.ptr,
+                         hB.ind,
+                         hB.val,
+                         hC.ptr,
+                         hC.ind,
+                         hC.val,
+                         hA.base,
+                         hB.base,
+                         hC.base);
+}
+
+template <typename I, typename J, typename T>
+void testing_spgeam_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    rocsparse_handle handle = local_handle;
+    J                m      = safe_size;
+    J                n      = safe_size;
+    I                nnz_A  = safe_size;
+    I                nnz_B  = safe_size;
+    I                nnz_C  = safe_size;
+
+    void* csr_row_ptr_A = (void*)0x4;
+    void* csr_col_ind_A = (void*)0x4;
+    void* csr_val_A     = (void*)0x4;
+    void* csr_row_ptr_B = (void*)0x4;
+    void* csr_col_ind_B = (void*)0x4;
+    void* csr_val_B     = (void*)0x4;
+    void* csr_row_ptr_C = (void*)0x4;
+    void* csr_col_ind_C = (void*)0x4;
+    void* csr_val_C     = (void*)0x4;
+
+    rocsparse_operation    trans_A = rocsparse_operation_none;
+    rocsparse_operation    trans_B = rocsparse_operation_none;
+    rocsparse_index_base   base    = rocsparse_index_base_zero;
+    rocsparse_spgeam_alg   alg     = rocsparse_spgeam_alg_default;
+    rocsparse_spgeam_stage stage   = rocsparse_spgeam_stage_compute;
+
+    // Index and data type
+    rocsparse_indextype itype        = get_indextype<I>();
+    rocsparse_indextype jtype        = get_indextype<J>();
+    rocsparse_datatype  compute_type = get_datatype<T>();
+
+    // SpGEAM structures
+    rocsparse_local_spmat local_A(m,
+                                  n,
+                                  nnz_A,
+                                  csr_row_ptr_A,
+                                  csr_col_ind_A,
+                                  csr_val_A,
+                                  itype,
+                                  jtype,
+                                  base,
+                                  compute_type,
+                                  rocsparse_format_csr);
+    rocsparse_local_spmat local_B(m,
+                                  n,
+                                  nnz_B,
+                                  csr_row_ptr_B,
+                                  csr_col_ind_B,
+                                  csr_val_B,
+                                  itype,
+                                  jtype,
+                                  base,
+                                  compute_type,
+                                  rocsparse_format_csr);
+    rocsparse_local_spmat local_C(m,
+                                  n,
+                                  nnz_C,
+                                  csr_row_ptr_C,
+                                  csr_col_ind_C,
+                                  csr_val_C,
+                                  itype,
+                                  jtype,
+                                  base,
+                                  compute_type,
+                                  rocsparse_format_csr);
+
+    rocsparse_spmat_descr A = local_A;
+    rocsparse_spmat_descr B = local_B;
+    rocsparse_spmat_descr C = local_C;
+
+    int       nargs_to_exclude   = 4;
+    const int args_to_exclude[4] = {3, 5, 11, 12};
+
+#define PARAMS                                                                             \
+    handle, trans_A, trans_B, alpha, A, beta, B, C, compute_type, alg, stage, buffer_size, \
+        temp_buffer
+    {
+        const T* alpha       = (const T*)0x4;
+        const T* beta        = (const T*)0x4;
+        size_t*  buffer_size = (size_t*)0x4;
+        void*    temp_buffer = (void*)0x4;
+        select_bad_arg_analysis(rocsparse_spgeam, nargs_to_exclude, args_to_exclude, PARAMS);
+
+        buffer_size = nullptr;
+        temp_buffer = nullptr;
+        select_bad_arg_analysis(rocsparse_spgeam, nargs_to_exclude, args_to_exclude, PARAMS);
+    }
+#undef PARAMS
+
+    const T* alpha = (const T*)0x4;
+    const T* beta  = (const T*)0x4;
+
+    // Alpha and beta are required by the compute and numeric stages
+    for(auto s : {rocsparse_spgeam_stage_compute, rocsparse_spgeam_stage_numeric})
+    {
+        EXPECT_ROCSPARSE_STATUS(rocsparse_spgeam(handle,
+                                                 trans_A,
+                                                 trans_B,
+                                                 nullptr,
+                                                 A,
+                                                 beta,
+                                                 B,
+                                                 C,
+                                                 compute_type,
+                                                 alg,
+                                                 s,
+                                                 nullptr,
+                                                 nullptr),
+                                rocsparse_status_invalid_pointer);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_spgeam(handle,
+                                                 trans_A,
+                                                 trans_B,
+                                                 alpha,
+                                                 A,
+                                                 nullptr,
+                                                 B,
+                                                 C,
+                                                 compute_type,
+                                                 alg,
+                                                 s,
+                                                 nullptr,
+                                                 nullptr),
+                                rocsparse_status_invalid_pointer);
+    }
+
+    // Buffer size is required by the buffer size stage
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spgeam(handle,
+                                             trans_A,
+                                             trans_B,
+                                             alpha,
+                                             A,
+                                             beta,
+                                             B,
+                                             C,
+                                             compute_type,
+                                             alg,
+                                             rocsparse_spgeam_stage_buffer_size,
+                                             nullptr,
+                                             nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    // Temporary buffer is required by the nnz stage
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spgeam(handle,
+                                             trans_A,
+                                             trans_B,
+                                             alpha,
+                                             A,
+                                             beta,
+                                             B,
+                                             C,
+                                             compute_type,
+                                             alg,
+                                             rocsparse_spgeam_stage_nnz,
+                                             nullptr,
+                                             nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    // B must have the dimensions of A
+    rocsparse_local_spmat local_B_wrong(m + 1,
+                                        n,
+                                        nnz_B,
+                                        csr_row_ptr_B,
+                                        csr_col_ind_B,
+                                        csr_val_B,
+                                        itype,
+                                        jtype,
+                                        base,
+                                        compute_type,
+                                        rocsparse_format_csr);
+    size_t buffer_size;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spgeam(handle,
+                                             trans_A,
+                                             trans_B,
+                                             alpha,
+                                             A,
+                                             beta,
+                                             local_B_wrong,
+                                             C,
+                                             compute_type,
+                                             alg,
+                                             rocsparse_spgeam_stage_buffer_size,
+                                             &buffer_size,
+                                             nullptr),
+                            rocsparse_status_invalid_size);
+
+    // Transposed matrices are not supported
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spgeam(handle,
+                                             rocsparse_operation_transpose,
+                                             trans_B,
+                                             alpha,
+                                             A,
+                                             beta,
+                                             B,
+                                             C,
+                                             compute_type,
+                                             alg,
+                                             rocsparse_spgeam_stage_buffer_size,
+                                             &buffer_size,
+                                             nullptr),
+                            rocsparse_status_not_implemented);
+}
+
+template <typename I, typename J, typename T>
+void testing_spgeam(const Arguments& arg)
+{
+    J                    M       = arg.M;
+    J                    N       = arg.N;
+    rocsparse_operation  trans_A = arg.transA;
+    rocsparse_operation  trans_B = arg.transB;
+    rocsparse_index_base base_A  = arg.baseA;
+    rocsparse_index_base base_B  = arg.baseB;
+    rocsparse_index_base base_C  = arg.baseC;
+    rocsparse_format     format  = arg.formatA;
+    rocsparse_direction  dir     = arg.direction;
+    rocsparse_spgeam_alg alg     = rocsparse_spgeam_alg_default;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    // Index and data type
+    rocsparse_datatype ttype = get_datatype<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+    using host_mat   = host_gebsr_matrix<T, I, J>;
+    using device_mat = device_gebsr_matrix<T, I, J>;
+
+#define PARAMS(alpha_, beta_, stage_, buffer_) \
+    handle, trans_A, trans_B, alpha_, A, beta_, B, C, ttype, alg, stage_, &buffer_size, buffer_
+
+    // CSR and CSC matrices have block dimension one
+    const bool csc       = (format == rocsparse_format_csc);
+    J          block_dim = (format == rocsparse_format_bsr) ? arg.block_dim : 1;
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0)
+    {
+        static const size_t safe_size = 1;
+
+        J mb = std::max((csc ? N : M) / block_dim, static_cast<J>(0));
+        J nb = std::max((csc ? M : N) / block_dim, static_cast<J>(0));
+
+        device_mat dA(dir, mb, nb, static_cast<I>(0), block_dim, block_dim, base_A);
+        device_mat dB(dir, mb, nb, static_cast<I>(0), block_dim, block_dim, base_B);
+        device_mat dC(dir, mb, nb, static_cast<I>(0), block_dim, block_dim, base_C);
+
+        rocsparse_spmat_descr A, B, C;
+        testing_spgeam_create_descr(&A, format, dA);
+        testing_spgeam_create_descr(&B, format, dB);
+        testing_spgeam_create_descr(&C, format, dC);
+
+        // Pointer mode
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Query SpGEAM buffer
+        size_t buffer_size;
+        void*  dbuffer = nullptr;
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_spgeam(
+                PARAMS(&h_alpha, &h_beta, rocsparse_spgeam_stage_buffer_size, dbuffer)),
+            rocsparse_status_success);
+
+        CHECK_HIP_ERROR(rocsparse_hipMalloc(&dbuffer, safe_size));
+
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_spgeam(PARAMS(&h_alpha, &h_beta, rocsparse_spgeam_stage_nnz, dbuffer)),
+            rocsparse_status_success);
+
+        // Verify that nnz_C is equal to zero
+        {
+            int64_t                  rows_C;
+            int64_t                  cols_C;
+            int64_t                  nnz_C;
+            static constexpr int64_t zero = 0;
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmat_get_size(C, &rows_C, &cols_C, &nnz_C));
+
+            unit_check_scalar(zero, nnz_C);
+        }
+
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_spgeam(PARAMS(&h_alpha, &h_beta, rocsparse_spgeam_stage_compute, dbuffer)),
+            rocsparse_status_success);
+
+        CHECK_HIP_ERROR(rocsparse_hipFree(dbuffer));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_destroy_spmat_descr(A));
+        CHECK_ROCSPARSE_ERROR(rocsparse_destroy_spmat_descr(B));
+        CHECK_ROCSPARSE_ERROR(rocsparse_destroy_spmat_descr(C));
+        return;
+    }
+
+    //
+    // Declare host matrices.
+    //
+    host_mat hA, hB;
+
+    const bool            to_int    = arg.timing ? false : true;
+    static constexpr bool full_rank = false;
+
+    J mb = ((csc ? N : M) + block_dim - 1) / block_dim;
+    J nb = ((csc ? M : N) + block_dim - 1) / block_dim;
+
+    //
+    // Init matrix A from the input rocsparse_matrix_init
+    //
+    {
+        rocsparse_matrix_factory<T, I, J> matrix_factory(arg, to_int, full_rank);
+        hA.block_direction = dir;
+        matrix_factory.init_gebsr(hA, mb, nb, block_dim, block_dim, base_A);
+    }
+
+    //
+    // Init matrix B from rocsparse_matrix_init random, with the dimensions of A.
+    //
+    {
+        static constexpr bool             noseed = true;
+        rocsparse_matrix_factory<T, I, J> matrix_factory(
+            arg, rocsparse_matrix_random, to_int, full_rank, noseed);
+        hB.block_direction = dir;
+        matrix_factory.init_gebsr(hB, mb, nb, block_dim, block_dim, base_B);
+    }
+
+    //
+    // Declare device matrices.
+    //
+    device_mat dA(hA);
+    device_mat dB(hB);
+
+    rocsparse_spmat_descr A, B;
+    testing_spgeam_create_descr(&A, format, dA);
+    testing_spgeam_create_descr(&B, format, dB);
+
+    if(arg.unit_check)
+    {
+        device_vector<T> d_alpha(1);
+        device_vector<T> d_beta(1);
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+        //
+        // Compute C on host.
+        //
+        host_mat hC;
+        hC.base = base_C;
+        testing_spgeam_host(h_alpha, hA, h_beta, hB, hC);
+
+        //
+        // Compute C on device, with pointer mode host and pointer mode device.
+        //
+        for(auto pointer_mode : {rocsparse_pointer_mode_host, rocsparse_pointer_mode_device})
+        {
+            const T* alpha_ptr = (pointer_mode == rocsparse_pointer_mode_host)
+                                     ? &h_alpha
+                                     : static_cast<const T*>(d_alpha);
+            const T* beta_ptr  = (pointer_mode == rocsparse_pointer_mode_host)
+                                     ? &h_beta
+                                     : static_cast<const T*>(d_beta);
+
+            device_mat dC(dir, hA.mb, hA.nb, static_cast<I>(0), block_dim, block_dim, base_C);
+
+            rocsparse_spmat_descr C;
+            testing_spgeam_create_descr(&C, format, dC);
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, pointer_mode));
+
+            size_t buffer_size;
+            void*  dbuffer = nullptr;
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_spgeam(
+                PARAMS(alpha_ptr, beta_ptr, rocsparse_spgeam_stage_buffer_size, dbuffer)));
+            CHECK_HIP_ERROR(rocsparse_hipMalloc(&dbuffer, buffer_size));
+
+            //
+            // Compute the sparsity pattern of C.
+            //
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_spgeam(PARAMS(alpha_ptr, beta_ptr, rocsparse_spgeam_stage_nnz, dbuffer)));
+
+            //
+            // Update memory.
+            //
+            {
+                int64_t C_m, C_n, C_nnz;
+                CHECK_ROCSPARSE_ERROR(rocsparse_spmat_get_size(C, &C_m, &C_n, &C_nnz));
+                dC.define(dir, dC.mb, dC.nb, C_nnz, block_dim, block_dim, base_C);
+                testing_spgeam_set_pointers(C, format, dC);
+            }
+
+            //
+            // Compute the column indices and values of C.
+            //
+            CHECK_ROCSPARSE_ERROR(rocsparse_spgeam(
+                PARAMS(alpha_ptr, beta_ptr, rocsparse_spgeam_stage_compute, dbuffer)));
+
+            //
+            // Check
+            //
+            hC.near_check(dC);
+
+            //
+            // Update the values of A and B, the numeric stage is sufficient to recompute C.
+            //
+            host_mat hA_update(hA), hB_update(hB);
+            for(size_t i = 0; i < hA_update.val.size(); ++i)
+            {
+                hA_update.val[i] *= static_cast<T>(2);
+            }
+            for(size_t i = 0; i < hB_update.val.size(); ++i)
+            {
+                hB_update.val[i] *= static_cast<T>(-1);
+            }
+
+            dA.transfer_from(hA_update);
+            dB.transfer_from(hB_update);
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_spgeam(
+                PARAMS(alpha_ptr, beta_ptr, rocsparse_spgeam_stage_numeric, dbuffer)));
+
+            host_mat hC_update;
+            hC_update.base = base_C;
+            testing_spgeam_host(h_alpha, hA_update, h_beta, hB_update, hC_update);
+            hC_update.near_check(dC);
+
+            dA.transfer_from(hA);
+            dB.transfer_from(hB);
+
+            CHECK_HIP_ERROR(rocsparse_hipFree(dbuffer));
+            CHECK_ROCSPARSE_ERROR(rocsparse_destroy_spmat_descr(C));
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        double gpu_analysis_time_used, gpu_solve_time_used;
+
+        int64_t C_nnz;
+
+        device_mat dC(dir, hA.mb, hA.nb, static_cast<I>(0), block_dim, block_dim, base_C);
+
+        rocsparse_spmat_descr C;
+        testing_spgeam_create_descr(&C, format, dC);
+
+        gpu_analysis_time_used = get_time_us();
+
+        size_t buffer_size;
+        void*  dbuffer = nullptr;
+        CHECK_ROCSPARSE_ERROR(rocsparse_spgeam(
+            PARAMS(&h_alpha, &h_beta, rocsparse_spgeam_stage_buffer_size, dbuffer)));
+        CHECK_HIP_ERROR(rocsparse_hipMalloc(&dbuffer, buffer_size));
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_spgeam(PARAMS(&h_alpha, &h_beta, rocsparse_spgeam_stage_nnz, dbuffer)));
+
+        {
+            int64_t C_m, C_n;
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmat_get_size(C, &C_m, &C_n, &C_nnz));
+            dC.define(dir, dC.mb, dC.nb, C_nnz, block_dim, block_dim, base_C);
+            testing_spgeam_set_pointers(C, format, dC);
+        }
+
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_spgeam(PARAMS(&h_alpha, &h_beta, rocsparse_spgeam_stage_symbolic, dbuffer)));
+
+        gpu_analysis_time_used = get_time_us() - gpu_analysis_time_used;
+
+        //
+        // Warm up
+        //
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spgeam(
+                PARAMS(&h_alpha, &h_beta, rocsparse_spgeam_stage_numeric, dbuffer)));
+        }
+
+        gpu_solve_time_used = get_time_us();
+
+        //
+        // Performance run, only the values of C are recomputed
+        //
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spgeam(
+                PARAMS(&h_alpha, &h_beta, rocsparse_spgeam_stage_numeric, dbuffer)));
+        }
+
+        gpu_solve_time_used = (get_time_us() - gpu_solve_time_used) / number_hot_calls;
+        CHECK_HIP_ERROR(rocsparse_hipFree(dbuffer));
+
+        double gflop_count
+            = bsrgeam_gflop_count<T>(block_dim, dA.nnzb, dB.nnzb, C_nnz, &h_alpha, &h_beta);
+        double gbyte_count = bsrgeam_gbyte_count<T>(
+            dA.mb, block_dim, dA.nnzb, dB.nnzb, C_nnz, &h_alpha, &h_beta);
+
+        double gpu_gbyte  = get_gpu_gbyte(gpu_solve_time_used, gbyte_count);
+        double gpu_gflops = get_gpu_gflops(gpu_solve_time_used, gflop_count);
+
+        display_timing_info(display_key_t::format,
+                            rocsparse_format2string(format),
+                            display_key_t::M,
+                            M,
+                            display_key_t::N,
+                            N,
+                            display_key_t::bdim,
+                            block_dim,
+                            display_key_t::nnz_A,
+                            dA.nnzb,
+                            display_key_t::nnz_B,
+                            dB.nnzb,
+                            display_key_t::nnz_C,
+                            C_nnz,
+                            display_key_t::alpha,
+                            h_alpha,
+                            display_key_t::beta,
+                            h_beta,
+                            display_key_t::gflops,
+                            gpu_gflops,
+                            display_key_t::bandwidth,
+                            gpu_gbyte,
+                            display_key_t::analysis_ms,
+                            get_gpu_time_msec(gpu_analysis_time_used),
+                            display_key_t::time_ms,
+                            get_gpu_time_msec(gpu_solve_time_used));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_destroy_spmat_descr(C));
+    }
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_destroy_spmat_descr(A));
+    CHECK_ROCSPARSE_ERROR(rocsparse_destroy_spmat_descr(B));
+
+#undef PARAMS
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                             \
+    template void testing_spgeam_bad_arg<ITYPE, JTYPE, TTYPE>(const Arguments& arg); \
+    template void testing_spgeam<ITYPE, JTYPE, TTYPE>(const Arguments& arg)
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int32_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int64_t, int64_t, double);
+INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
+void testing_spgeam_extra(const Arguments& arg) {}
@@ -0,0 +1,484 @@
+/* ************************************************************************
+* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+
+#include "testing.hpp"
+
+template <typename I, typename J, typename T>
+void testing_spmv_batched_csr_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    rocsparse_handle     handle      = local_handle;
+    J                    m           = safe_size;
+    J                    n           = safe_size;
+    I                    nnz         = safe_size;
+    void*                csr_val     = (void*)0x4;
+    void*                csr_row_ptr = (void*)0x4;
+    void*                csr_col_ind = (void*)0x4;
+    void*                x_val       = (void*)0x4;
+    void*                y_val       = (void*)0x4;
+    size_t*              buffer_size = (size_t*)0x4;
+    void*                temp_buffer = (void*)0x4;
+    rocsparse_operation  trans       = rocsparse_operation_none;
+    rocsparse_index_base base        = rocsparse_index_base_zero;
+    rocsparse_spmv_alg   alg         = rocsparse_spmv_alg_csr_stream;
+    rocsparse_spmv_stage stage       = rocsparse_spmv_stage_compute;
+
+    rocsparse_indextype itype = get_indextype<I>();
+    rocsparse_indextype jtype = get_indextype<J>();
+    rocsparse_datatype  ttype = get_datatype<T>();
+
+    T alpha = static_cast<T>(1.0);
+    T beta  = static_cast<T>(0.0);
+
+    // SpMV structures
+    rocsparse_local_spmat local_mat(m,
+                                    n,
+                                    nnz,
+                                    csr_row_ptr,
+                                    csr_col_ind,
+                                    csr_val,
+                                    itype,
+                                    jtype,
+                                    base,
+                                    ttype,
+                                    rocsparse_format_csr);
+    rocsparse_local_dnvec local_x(n, x_val, ttype);
+    rocsparse_local_dnvec local_y(m, y_val, ttype);
+
+    rocsparse_spmat_descr mat = local_mat;
+    rocsparse_dnvec_descr x   = local_x;
+    rocsparse_dnvec_descr y   = local_y;
+
+    // Invalid batch count and batch stride
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnvec_set_strided_batch(nullptr, 2, n),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnvec_set_strided_batch(x, 0, n),
+                            rocsparse_status_invalid_value);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnvec_set_strided_batch(x, 2, -1),
+                            rocsparse_status_invalid_value);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnvec_set_strided_batch(x, 2, n - 1),
+                            rocsparse_status_invalid_value);
+
+    int     batch_count;
+    int64_t batch_stride;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnvec_get_strided_batch(nullptr, &batch_count, &batch_stride),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnvec_get_strided_batch(x, nullptr, &batch_stride),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnvec_get_strided_batch(x, &batch_count, nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr_set_columns_batch_stride(nullptr, 0),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr_set_columns_batch_stride(mat, -1),
+                            rocsparse_status_invalid_value);
+
+#define PARAMS handle, trans, &alpha, mat, x, &beta, y, ttype, alg, stage, buffer_size, temp_buffer
+
+    // y_i = A_i * x_i with mismatching batch counts
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr_set_strided_batch(mat, 10, 0, nnz),
+                            rocsparse_status_success);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnvec_set_strided_batch(x, 10, n), rocsparse_status_success);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnvec_set_strided_batch(y, 5, m), rocsparse_status_success);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(PARAMS), rocsparse_status_invalid_value);
+
+    // y_i = A * x_i with mismatching batch counts
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr_set_strided_batch(mat, 1, 0, 0),
+                            rocsparse_status_success);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(PARAMS), rocsparse_status_invalid_value);
+
+    // Batched computation is not supported for transposed matrices
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dnvec_set_strided_batch(y, 10, m), rocsparse_status_success);
+    trans = rocsparse_operation_transpose;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(PARAMS), rocsparse_status_not_implemented);
+#undef PARAMS
+}
+
+template <typename I, typename J, typename T>
+void testing_spmv_batched_csr(const Arguments& arg)
+{
+    J                    M    = arg.M;
+    J                    N    = arg.N;
+    rocsparse_index_base base = arg.baseA;
+    rocsparse_spmv_alg   alg  = arg.spmv_alg;
+
+    J batch_count_A = arg.batch_count_A;
+    J batch_count_x = arg.batch_count_B;
+    J batch_count_y = arg.batch_count_C;
+
+    T halpha = arg.get_alpha<T>();
+    T hbeta  = arg.get_beta<T>();
+
+    // Index and data type
+    rocsparse_indextype itype = get_indextype<I>();
+    rocsparse_indextype jtype = get_indextype<J>();
+    rocsparse_datatype  ttype = get_datatype<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle(arg);
+
+    bool yi_A_xi  = (batch_count_A == 1 && batch_count_x == batch_count_y);
+    bool yi_Ai_x  = (batch_count_x == 1 && batch_count_A == batch_count_y);
+    bool yi_Ai_xi = (batch_count_A == batch_count_y && batch_count_x == batch_count_y);
+
+    if(!yi_A_xi && !yi_Ai_x && !yi_Ai_xi)
+    {
+        return;
+    }
+
+    // Allocate host memory for matrix
+    rocsparse_matrix_factory<T, I, J> matrix_factory(arg);
+
+    // Generate the sparsity pattern and the values of the first batch
+    host_vector<I> hcsr_row_ptr;
+    host_vector<J> hcsr_col_ind_temp;
+    host_vector<T> hcsr_val_temp;
+
+    I nnz_A;
+    matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind_temp, hcsr_val_temp, M, N, nnz_A, base);
+
+    // All batches of A share the row offsets, column indices and values are strided
+    int64_t offsets_batch_stride_A        = 0;
+    int64_t columns_values_batch_stride_A = (batch_count_A > 1) ? nnz_A : 0;
+    int64_t batch_stride_x                = (batch_count_x > 1) ? N : 0;
+    int64_t batch_stride_y                = (batch_count_y > 1) ? M : 0;
+
+    host_vector<J> hcsr_col_ind(batch_count_A * nnz_A);
+    host_vector<T> hcsr_val(batch_count_A * nnz_A);
+
+    for(J i = 0; i < batch_count_A; i++)
+    {
+        for(I j = 0; j < nnz_A; j++)
+        {
+            hcsr_col_ind[nnz_A * i + j] = hcsr_col_ind_temp[j];
+            hcsr_val[nnz_A * i + j]     = hcsr_val_temp[j] * static_cast<T>(i + 1.0);
+        }
+    }
+
+    // Allocate host memory for vectors
+    host_vector<T> hx(batch_count_x * N);
+    host_vector<T> hy_1(batch_count_y * M);
+    host_vector<T> hy_2(batch_count_y * M);
+    host_vector<T> hy_3(batch_count_y * M);
+    host_vector<T> hy_gold(batch_count_y * M);
+
+    // Initialize data on CPU
+    rocsparse_init<T>(hx, batch_count_x * N, 1, 1);
+    rocsparse_init<T>(hy_1, batch_count_y * M, 1, 1);
+
+    hy_2    = hy_1;
+    hy_3    = hy_1;
+    hy_gold = hy_1;
+
+    // Allocate device memory
+    device_vector<I> dcsr_row_ptr(hcsr_row_ptr);
+    device_vector<J> dcsr_col_ind(hcsr_col_ind);
+    device_vector<T> dcsr_val(hcsr_val);
+    device_vector<T> dx(hx);
+    device_vector<T> dy_1(hy_1);
+    device_vector<T> dy_2(hy_2);
+    device_vector<T> dy_3(hy_3);
+    device_vector<T> dalpha(1);
+    device_vector<T> dbeta(1);
+
+    CHECK_HIP_ERROR(hipMemcpy(dalpha, &halpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dbeta, &hbeta, sizeof(T), hipMemcpyHostToDevice));
+
+    // Create descriptors
+    rocsparse_local_spmat A(M,
+                            N,
+                            nnz_A,
+                            dcsr_row_ptr,
+                            dcsr_col_ind,
+                            dcsr_val,
+                            itype,
+                            jtype,
+                            base,
+                            ttype,
+                            rocsparse_format_csr);
+
+    rocsparse_local_dnvec x(N, dx, ttype);
+    rocsparse_local_dnvec y1(M, dy_1, ttype);
+    rocsparse_local_dnvec y2(M, dy_2, ttype);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csr_set_strided_batch(
+        A, batch_count_A, offsets_batch_stride_A, columns_values_batch_stride_A));
+    CHECK_ROCSPARSE_ERROR(rocsparse_dnvec_set_strided_batch(x, batch_count_x, batch_stride_x));
+    CHECK_ROCSPARSE_ERROR(rocsparse_dnvec_set_strided_batch(y1, batch_count_y, batch_stride_y));
+    CHECK_ROCSPARSE_ERROR(rocsparse_dnvec_set_strided_batch(y2, batch_count_y, batch_stride_y));
+
+    // Query SpMV buffer
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmv(handle,
+                                         rocsparse_operation_none,
+                                         &halpha,
+                                         A,
+                                         x,
+                                         &hbeta,
+                                         y1,
+                                         ttype,
+                                         alg,
+                                         rocsparse_spmv_stage_buffer_size,
+                                         &buffer_size,
+                                         nullptr));
+
+    // Allocate buffer
+    void* dbuffer;
+    CHECK_HIP_ERROR(rocsparse_hipMalloc(&dbuffer, buffer_size));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmv(handle,
+                                         rocsparse_operation_none,
+                                         &halpha,
+                                         A,
+                                         x,
+                                         &hbeta,
+                                         y1,
+                                         ttype,
+                                         alg,
+                                         rocsparse_spmv_stage_preprocess,
+                                         &buffer_size,
+                                         dbuffer));
+
+    if(arg.unit_check)
+    {
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(testing::rocsparse_spmv(handle,
+                                                      rocsparse_operation_none,
+                                                      &halpha,
+                                                      A,
+                                                      x,
+                                                      &hbeta,
+                                                      y1,
+                                                      ttype,
+                                                      alg,
+                                                      rocsparse_spmv_stage_compute,
+                                                      &buffer_size,
+                                                      dbuffer));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(testing::rocsparse_spmv(handle,
+                                                      rocsparse_operation_none,
+                                                      dalpha,
+                                                      A,
+                                                      x,
+                                                      dbeta,
+                                                      y2,
+                                                      ttype,
+                                                      alg,
+                                                      rocsparse_spmv_stage_compute,
+                                                      &buffer_size,
+                                                      dbuffer));
+
+        // Copy output to host
+        hy_1.transfer_from(dy_1);
+        hy_2.transfer_from(dy_2);
+
+        // CPU csrmv for each batch
+        for(J i = 0; i < batch_count_y; i++)
+        {
+            host_csrmv<T, I, J, T, T, T>(rocsparse_operation_none,
+                                         M,
+                                         N,
+                                         nnz_A,
+                                         halpha,
+                                         hcsr_row_ptr.data() + offsets_batch_stride_A * i,
+                                         hcsr_col_ind.data() + columns_values_batch_stride_A * i,
+                                         hcsr_val.data() + columns_values_batch_stride_A * i,
+                                         hx.data() + batch_stride_x * i,
+                                         hbeta,
+                                         hy_gold.data() + batch_stride_y * i,
+                                         base,
+                                         rocsparse_matrix_type_general,
+                                         rocsparse_spmv_alg_csr_stream,
+                                         false);
+        }
+
+        hy_gold.near_check(hy_1);
+        hy_gold.near_check(hy_2);
+
+        // Only the values differ between the batches, which all use the column indices of
+        // the first batch
+        if(batch_count_A > 1)
+        {
+            device_vector<J> dcsr_col_ind_shared(hcsr_col_ind_temp);
+
+            rocsparse_local_spmat A_shared(M,
+                                           N,
+                                           nnz_A,
+                                           dcsr_row_ptr,
+                                           dcsr_col_ind_shared,
+                                           dcsr_val,
+                                           itype,
+                                           jtype,
+                                           base,
+                                           ttype,
+                                           rocsparse_format_csr);
+            rocsparse_local_dnvec y3(M, dy_3, ttype);
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr_set_strided_batch(
+                A_shared, batch_count_A, offsets_batch_stride_A, columns_values_batch_stride_A));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr_set_columns_batch_stride(A_shared, 0));
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_dnvec_set_strided_batch(y3, batch_count_y, batch_stride_y));
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv(handle,
+                                                 rocsparse_operation_none,
+                                                 &halpha,
+                                                 A_shared,
+                                                 x,
+                                                 &hbeta,
+                                                 y3,
+                                                 ttype,
+                                                 alg,
+                                                 rocsparse_spmv_stage_preprocess,
+                                                 &buffer_size,
+                                                 dbuffer));
+            CHECK_ROCSPARSE_ERROR(testing::rocsparse_spmv(handle,
+                                                          rocsparse_operation_none,
+                                                          &halpha,
+                                                          A_shared,
+                                                          x,
+                                                          &hbeta,
+                                                          y3,
+                                                          ttype,
+                                                          alg,
+                                                          rocsparse_spmv_stage_compute,
+                                                          &buffer_size,
+                                                          dbuffer));
+
+            hy_3.transfer_from(dy_3);
+            hy_gold.near_check(hy_3);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv(handle,
+                                                 rocsparse_operation_none,
+                                                 &halpha,
+                                                 A,
+                                                 x,
+                                                 &hbeta,
+                                                 y1,
+                                                 ttype,
+                                                 alg,
+                                                 rocsparse_spmv_stage_compute,
+                                                 &buffer_size,
+                                                 dbuffer));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv(handle,
+                                                 rocsparse_operation_none,
+                                                 &halpha,
+                                                 A,
+                                                 x,
+                                                 &hbeta,
+                                                 y1,
+                                                 ttype,
+                                                 alg,
+                                                 rocsparse_spmv_stage_compute,
+                                                 &buffer_size,
+                                                 dbuffer));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gflop_count
+            = batch_count_y * spmv_gflop_count(M, nnz_A, hbeta != static_cast<T>(0));
+        double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
+
+        double gbyte_count = csrmv_batched_gbyte_count<T>(M,
+                                                          N,
+                                                          nnz_A,
+                                                          batch_count_A,
+                                                          batch_count_x,
+                                                          batch_count_y,
+                                                          hbeta != static_cast<T>(0));
+        double gpu_gbyte   = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info(display_key_t::M,
+                            M,
+                            display_key_t::N,
+                            N,
+                            display_key_t::nnz_A,
+                            nnz_A,
+                            display_key_t::batch_count_A,
+                            batch_count_A,
+                            display_key_t::batch_count_B,
+                            batch_count_x,
+                            display_key_t::batch_count_C,
+                            batch_count_y,
+                            display_key_t::alpha,
+                            halpha,
+                            display_key_t::beta,
+                            hbeta,
+                            display_key_t::algorithm,
+                            rocsparse_spmvalg2string(alg),
+                            display_key_t::gflops,
+                            gpu_gflops,
+                            display_key_t::bandwidth,
+                            gpu_gbyte,
+                            display_key_t::time_ms,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+
+    CHECK_HIP_ERROR(rocsparse_hipFree(dbuffer));
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                                       \
+    template void testing_spmv_batched_csr_bad_arg<ITYPE, JTYPE, TTYPE>(const Arguments& arg); \
+    template void testing_spmv_batched_csr<ITYPE, JTYPE, TTYPE>(const Arguments& arg)
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int32_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int64_t, int64_t, double);
+INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
@@ -24,6 +24,15 @@
 #include "testing.hpp"
 #include "testing_spmv.hpp"
 
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <set>
+#include <thread>
+
 template <typename I, typename J, typename A, typename X, typename Y, typename T>
 void testing_spmv_csr_bad_arg(const Arguments& arg)
 {
@@ -127,4 +136,298 @@ INSTANTIATE_MIXED(int64_t,
                   rocsparse_double_complex,
                   rocsparse_double_complex);
 
-void testing_spmv_csr_extra(const Arguments& arg) {}
+typedef std::map<std::string, std::string> testing_spmv_csr_trace_event;
+
+//
+// Minimal JSON parser for the Chrome trace written by the profile logging. The scalar
+// members of the elements of "traceEvents" are collected as text, everything else is
+// only validated.
+//
+struct testing_spmv_csr_trace_parser
+{
+    const char* pos;
+    const char* end;
+
+    void skip()
+    {
+        while(pos < end && std::isspace(static_cast<unsigned char>(*pos)))
+        {
+            ++pos;
+        }
+    }
+
+    bool expect(char c)
+    {
+        skip();
+        if(pos < end && *pos == c)
+        {
+            ++pos;
+            return true;
+        }
+        return false;
+    }
+
+    bool parse_string(std::string& str)
+    {
+        if(expect('"') == false)
+        {
+            return false;
+        }
+
+        str.clear();
+        while(pos < end && *pos != '"')
+        {
+            if(*pos == '\\' && ++pos == end)
+            {
+                return false;
+            }
+            str.push_back(*pos++);
+        }
+
+        return (pos++ < end);
+    }
+
+    bool parse_value(std::string*                               scalar,
+                     testing_spmv_csr_trace_event*              members,
+                     std::vector<testing_spmv_csr_trace_event>* events)
+    {
+        skip();
+        if(pos == end)
+        {
+            return false;
+        }
+
+        if(*pos == '"')
+        {
+            std::string str;
+            if(parse_string(str) == false)
+            {
+                return false;
+            }
+            if(scalar != nullptr)
+            {
+                *scalar = str;
+            }
+            return true;
+        }
+
+        if(*pos == '{')
+        {
+            ++pos;
+            if(expect('}'))
+            {
+                return true;
+            }
+
+            do
+            {
+                std::string key;
+                std::string value;
+                if(parse_string(key) == false || expect(':') == false
+                   || parse_value(&value, nullptr, (key == "traceEvents") ? events : nullptr)
+                          == false)
+                {
+                    return false;
+                }
+
+                if(members != nullptr)
+                {
+                    (*members)[key] = value;
+                }
+            } while(expect(','));
+
+            return expect('}');
+        }
+
+        if(*pos == '[')
+        {
+            ++pos;
+            if(expect(']'))
+            {
+                return true;
+            }
+
+            do
+            {
+                testing_spmv_csr_trace_event event;
+                if(parse_value(nullptr, &event, nullptr) == false)
+                {
+                    return false;
+                }
+
+                if(events != nullptr)
+                {
+                    events->push_back(event);
+                }
+            } while(expect(','));
+
+            return expect(']');
+        }
+
+        // Numbers and literals
+        const char* begin = pos;
+        while(pos < end
+              && (std::isalnum(static_cast<unsigned char>(*pos)) || *pos == '-' || *pos == '+'
+                  || *pos == '.'))
+        {
+            ++pos;
+        }
+
+        const std::string token(begin, pos);
+        if(token != "true" && token != "false" && token != "null")
+        {
+            char* number_end;
+            std::strtod(token.c_str(), &number_end);
+            if(token.empty() || *number_end != '\0')
+            {
+                return false;
+            }
+        }
+
+        if(scalar != nullptr)
+        {
+            *scalar = token;
+        }
+        return true;
+    }
+
+    bool parse(std::vector<testing_spmv_csr_trace_event>& events)
+    {
+        if(parse_value(nullptr, nullptr, &events) == false)
+        {
+            return false;
+        }
+
+        skip();
+        return pos == end;
+    }
+};
+
+//
+// Each thread profiles its own handle and exits before the records are exported.
+//
+static void testing_spmv_csr_trace_thread(int num_calls)
+{
+    rocsparse_local_handle handle;
+
+    const host_vector<int32_t> hcsr_row_ptr = {0, 1, 2};
+    const host_vector<int32_t> hcsr_col_ind = {0, 1};
+    const host_vector<float>   hcsr_val     = {1.0f, 2.0f};
+    const host_vector<float>   hx           = {1.0f, 1.0f};
+
+    device_vector<int32_t> dcsr_row_ptr(hcsr_row_ptr);
+    device_vector<int32_t> dcsr_col_ind(hcsr_col_ind);
+    device_vector<float>   dcsr_val(hcsr_val);
+    device_vector<float>   dx(hx);
+    device_vector<float>   dy(2);
+
+    rocsparse_local_spmat A(2,
+                            2,
+                            2,
+                            dcsr_row_ptr,
+                            dcsr_col_ind,
+                            dcsr_val,
+                            rocsparse_indextype_i32,
+                            rocsparse_indextype_i32,
+                            rocsparse_index_base_zero,
+                            rocsparse_datatype_f32_r,
+                            rocsparse_format_csr);
+    rocsparse_local_dnvec x(2, dx, rocsparse_datatype_f32_r);
+    rocsparse_local_dnvec y(2, dy, rocsparse_datatype_f32_r);
+
+    const float alpha = 1.0f;
+    const float beta  = 0.0f;
+    size_t      buffer_size;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    for(int i = 0; i < num_calls; ++i)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_spmv(handle,
+                                             rocsparse_operation_none,
+                                             &alpha,
+                                             A,
+                                             x,
+                                             &beta,
+                                             y,
+                                             rocsparse_datatype_f32_r,
+                                             rocsparse_spmv_alg_csr_stream,
+                                             rocsparse_spmv_stage_buffer_size,
+                                             &buffer_size,
+                                             nullptr));
+    }
+}
+
+//
+// The Chrome trace of a profiling session contains the records of the threads that
+// exited before the export, and nothing of the previous sessions.
+//
+void testing_spmv_csr_extra(const Arguments& arg)
+{
+    static constexpr int num_calls = 5;
+
+    const std::string filename = rocsparse_tmpname();
+
+    const char*       env_layer = getenv("ROCSPARSE_LAYER");
+    const char*       env_path  = getenv("ROCSPARSE_LOG_PROFILE_PATH");
+    const std::string saved_layer((env_layer != nullptr) ? env_layer : "");
+    const std::string saved_path((env_path != nullptr) ? env_path : "");
+
+    rocsparse_setenv("ROCSPARSE_LAYER", "8");
+    rocsparse_setenv("ROCSPARSE_LOG_PROFILE_PATH", filename.c_str());
+
+    for(int num_threads = 2; num_threads <= 3; ++num_threads)
+    {
+        {
+            // The records are exported once this handle, the last profiled one, is
+            // destroyed
+            rocsparse_local_handle handle;
+
+            std::vector<std::thread> threads;
+            for(int i = 0; i < num_threads; ++i)
+            {
+                threads.emplace_back(testing_spmv_csr_trace_thread, num_calls);
+            }
+
+            for(auto& thread : threads)
+            {
+                thread.join();
+            }
+        }
+
+        std::ifstream     in(filename);
+        const std::string text((std::istreambuf_iterator<char>(in)),
+                               std::istreambuf_iterator<char>());
+
+        std::vector<testing_spmv_csr_trace_event> events;
+        testing_spmv_csr_trace_parser             parser{text.c_str(), text.c_str() + text.size()};
+
+        unit_check_scalar<int32_t>(1, parser.parse(events) ? 1 : 0);
+
+        int64_t           num_spmv = 0;
+        std::set<int64_t> tids;
+        for(auto& event : events)
+        {
+            if(event["cat"] != "rocsparse" || event["name"] != "rocsparse_spmv")
+            {
+                continue;
+            }
+
+            // Complete events with non-negative timestamp and duration
+            const double ts  = std::strtod(event["ts"].c_str(), nullptr);
+            const double dur = std::strtod(event["dur"].c_str(), nullptr);
+            unit_check_scalar<int32_t>(1, (event["ph"] == "X" && ts >= 0.0 && dur >= 0.0) ? 1 : 0);
+
+            tids.insert(std::strtoll(event["tid"].c_str(), nullptr, 10));
+            ++num_spmv;
+        }
+
+        unit_check_scalar<int64_t>(num_threads * num_calls, num_spmv);
+        unit_check_scalar<int64_t>(num_threads, static_cast<int64_t>(tids.size()));
+    }
+
+    rocsparse_setenv("ROCSPARSE_LAYER", (env_layer != nullptr) ? saved_layer.c_str() : nullptr);
+    rocsparse_setenv("ROCSPARSE_LOG_PROFILE_PATH",
+                     (env_path != nullptr) ? saved_path.c_str() : nullptr);
+
+    std::remove(filename.c_str());
+}
@@ -0,0 +1,273 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the Software), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+template <typename I, typename J, typename T>
+void testing_spmv_fused_bad_arg(const Arguments& arg)
+{
+    const T local_alpha = static_cast<T>(6);
+    const T local_beta  = static_cast<T>(2);
+
+    rocsparse_local_handle local_handle;
+
+    rocsparse_handle         handle       = local_handle;
+    rocsparse_operation      trans        = rocsparse_operation_none;
+    const void*              alpha        = (const void*)&local_alpha;
+    const void*              beta         = (const void*)&local_beta;
+    rocsparse_spmv_alg       alg          = rocsparse_spmv_alg_default;
+    rocsparse_spmv_reduction reduction    = rocsparse_spmv_reduction_dot_yy;
+    rocsparse_datatype       compute_type = get_datatype<T>();
+    T                        local_result;
+    void*                    result = (void*)&local_result;
+
+#define PARAMS handle, trans, alpha, mat, x, beta, y, compute_type, alg, reduction, result
+
+    {
+        device_dense_matrix<T>     dx;
+        device_dense_matrix<T>     dy;
+        device_csr_matrix<T, I, J> dA;
+        rocsparse_local_spmat      local_mat(dA);
+        rocsparse_local_dnvec      local_x(dx);
+        rocsparse_local_dnvec      local_y(dy);
+
+        rocsparse_spmat_descr mat = local_mat;
+        rocsparse_dnvec_descr x   = local_x;
+        rocsparse_dnvec_descr y   = local_y;
+
+        bad_arg_analysis(rocsparse_spmv_fused, PARAMS);
+    }
+
+    {
+        // x^H * y requires a square matrix
+        device_dense_matrix<T>     dx(2, 1);
+        device_dense_matrix<T>     dy(3, 1);
+        device_csr_matrix<T, I, J> dA(3, 2, 0, rocsparse_index_base_zero);
+        rocsparse_local_spmat      local_mat(dA);
+        rocsparse_local_dnvec      local_x(dx);
+        rocsparse_local_dnvec      local_y(dy);
+
+        rocsparse_spmat_descr mat = local_mat;
+        rocsparse_dnvec_descr x   = local_x;
+        rocsparse_dnvec_descr y   = local_y;
+
+        reduction = rocsparse_spmv_reduction_dot_xy;
+        EXPECT_ROCSPARSE_STATUS(rocsparse_spmv_fused(PARAMS), rocsparse_status_invalid_size);
+    }
+
+#undef PARAMS
+}
+
+template <typename I, typename J, typename T>
+void testing_spmv_fused(const Arguments& arg)
+{
+    J                    M     = arg.M;
+    J                    N     = arg.N;
+    rocsparse_operation  trans = arg.transA;
+    rocsparse_index_base base  = arg.baseA;
+    rocsparse_spmv_alg   alg   = arg.spmv_alg;
+    rocsparse_datatype   ttype = get_datatype<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle(arg);
+
+    // Grab stream used by handle
+    hipStream_t stream = handle.get_stream();
+
+    host_scalar<T> h_alpha(arg.get_alpha<T>());
+    host_scalar<T> h_beta(arg.get_beta<T>());
+
+    device_scalar<T> d_alpha(h_alpha);
+    device_scalar<T> d_beta(h_beta);
+
+#define PARAMS(alpha_, A_, x_, beta_, y_, reduction_, result_) \
+    handle, trans, alpha_, A_, x_, beta_, y_, ttype, alg, reduction_, result_
+
+    static const rocsparse_spmv_reduction reductions[]
+        = {rocsparse_spmv_reduction_dot_xy, rocsparse_spmv_reduction_dot_yy};
+
+    //
+    // Initialize the sparse matrix.
+    //
+    host_csr_matrix<T, I, J> hA;
+    {
+        static constexpr bool             full_rank = false;
+        rocsparse_matrix_factory<T, I, J> matrix_factory(arg, arg.unit_check, full_rank);
+        matrix_factory.init_csr(hA, M, N, base);
+    }
+
+    // The matrix factory may change the dimensions when reading from a file
+    M = hA.m;
+    N = hA.n;
+
+    device_csr_matrix<T, I, J> dA(hA);
+
+    host_dense_matrix<T> hx(N, 1);
+    rocsparse_matrix_utils::init_exact(hx);
+    device_dense_matrix<T> dx(hx);
+
+    host_dense_matrix<T> hy(M, 1);
+    rocsparse_matrix_utils::init_exact(hy);
+    device_dense_matrix<T> dy(hy);
+
+    rocsparse_local_spmat matA(dA);
+    rocsparse_local_dnvec x(dx);
+    rocsparse_local_dnvec y(dy);
+
+    host_scalar<T>   h_result;
+    device_scalar<T> d_result;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+    if(arg.unit_check)
+    {
+        for(auto reduction : reductions)
+        {
+            // x^H * y is only defined for square matrices
+            if(reduction == rocsparse_spmv_reduction_dot_xy && M != N)
+            {
+                continue;
+            }
+
+            host_dense_matrix<T> hy_gold(hy);
+            host_scalar<T>       h_result_gold;
+            host_csrmv_fused<T, I, J>(reduction,
+                                      hA.m,
+                                      hA.n,
+                                      hA.nnz,
+                                      *h_alpha,
+                                      hA.ptr,
+                                      hA.ind,
+                                      hA.val,
+                                      hx,
+                                      *h_beta,
+                                      hy_gold,
+                                      h_result_gold,
+                                      hA.base);
+
+            // Pointer mode host
+            dy.transfer_from(hy);
+            CHECK_ROCSPARSE_ERROR(testing::rocsparse_spmv_fused(
+                PARAMS(h_alpha, matA, x, h_beta, y, reduction, (T*)h_result)));
+            CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+            hy_gold.near_check(dy);
+            h_result_gold.near_check(h_result);
+
+            // Pointer mode device
+            dy.transfer_from(hy);
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+            CHECK_ROCSPARSE_ERROR(testing::rocsparse_spmv_fused(
+                PARAMS(d_alpha, matA, x, d_beta, y, reduction, (T*)d_result)));
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            hy_gold.near_check(dy);
+            h_result_gold.near_check(d_result);
+        }
+    }
+
+    if(arg.timing)
+    {
+        // Timing is done with the residual norm, as in r := r - alpha * A * p
+        const rocsparse_spmv_reduction reduction = rocsparse_spmv_reduction_dot_yy;
+
+        const int number_cold_calls = 2;
+        const int number_hot_calls  = arg.iters;
+
+        // The result stays on the device, as in a Krylov solver loop
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv_fused(
+                PARAMS(d_alpha, matA, x, d_beta, y, reduction, (T*)d_result)));
+        }
+
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv_fused(
+                PARAMS(d_alpha, matA, x, d_beta, y, reduction, (T*)d_result)));
+        }
+
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // The dot product adds 2 * M flops and no memory traffic
+        const bool   nonzero_beta = *h_beta != static_cast<T>(0);
+        const double gflop_count  = spmv_gflop_count(M, dA.nnz, nonzero_beta) + 2.0 * M / 1e9;
+        const double gbyte_count  = csrmv_gbyte_count<T>(M, N, dA.nnz, nonzero_beta);
+
+        const double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
+        const double gpu_gbyte  = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info(display_key_t::trans_A,
+                            rocsparse_operation2string(trans),
+                            display_key_t::M,
+                            M,
+                            display_key_t::N,
+                            N,
+                            display_key_t::nnz_A,
+                            dA.nnz,
+                            display_key_t::alpha,
+                            *h_alpha,
+                            display_key_t::beta,
+                            *h_beta,
+                            display_key_t::algorithm,
+                            rocsparse_spmvalg2string(alg),
+                            display_key_t::gflops,
+                            gpu_gflops,
+                            display_key_t::bandwidth,
+                            gpu_gbyte,
+                            display_key_t::time_ms,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+
+#undef PARAMS
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                                 \
+    template void testing_spmv_fused_bad_arg<ITYPE, JTYPE, TTYPE>(const Arguments& arg); \
+    template void testing_spmv_fused<ITYPE, JTYPE, TTYPE>(const Arguments& arg)
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int32_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int64_t, int64_t, double);
+INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
+void testing_spmv_fused_extra(const Arguments& arg) {}
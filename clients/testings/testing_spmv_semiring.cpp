@@ -0,0 +1,259 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the Software), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+template <typename I, typename J, typename T>
+void testing_spmv_semiring_bad_arg(const Arguments& arg)
+{
+    const T local_alpha = static_cast<T>(6);
+    const T local_beta  = static_cast<T>(2);
+
+    rocsparse_local_handle local_handle;
+
+    rocsparse_handle     handle   = local_handle;
+    rocsparse_operation  trans    = rocsparse_operation_none;
+    const void*          alpha    = (const void*)&local_alpha;
+    const void*          beta     = (const void*)&local_beta;
+    rocsparse_spmv_alg   alg      = rocsparse_spmv_alg_default;
+    rocsparse_semiring   semiring = rocsparse_semiring_min_plus;
+    rocsparse_spmv_stage stage    = rocsparse_spmv_stage_compute;
+    size_t               local_buffer_size;
+    size_t*              buffer_size  = &local_buffer_size;
+    void*                temp_buffer  = (void*)0x4;
+    rocsparse_datatype   compute_type = get_datatype<T>();
+
+#define PARAMS                                                                              \
+    handle, trans, alpha, mat, x, beta, y, compute_type, alg, semiring, stage, buffer_size, \
+        temp_buffer
+
+    {
+        device_dense_matrix<T>     dx;
+        device_dense_matrix<T>     dy;
+        device_csr_matrix<T, I, J> dA;
+        rocsparse_local_spmat      local_mat(dA);
+        rocsparse_local_dnvec      local_x(dx);
+        rocsparse_local_dnvec      local_y(dy);
+
+        rocsparse_spmat_descr mat = local_mat;
+        rocsparse_dnvec_descr x   = local_x;
+        rocsparse_dnvec_descr y   = local_y;
+
+        // The buffer is not used by the compute stage
+        static const int nex   = 2;
+        static const int ex[2] = {11, 12};
+        select_bad_arg_analysis(rocsparse_spmv_semiring, nex, ex, PARAMS);
+
+        // Buffer size is required by the buffer size stage
+        stage       = rocsparse_spmv_stage_buffer_size;
+        buffer_size = nullptr;
+        temp_buffer = nullptr;
+        EXPECT_ROCSPARSE_STATUS(rocsparse_spmv_semiring(PARAMS), rocsparse_status_invalid_pointer);
+    }
+
+#undef PARAMS
+}
+
+template <typename I, typename J, typename T>
+void testing_spmv_semiring(const Arguments& arg)
+{
+    J                    M     = arg.M;
+    J                    N     = arg.N;
+    rocsparse_operation  trans = arg.transA;
+    rocsparse_index_base base  = arg.baseA;
+    rocsparse_spmv_alg   alg   = arg.spmv_alg;
+    rocsparse_datatype   ttype = get_datatype<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle(arg);
+
+    host_scalar<T> h_alpha(arg.get_alpha<T>());
+    host_scalar<T> h_beta(arg.get_beta<T>());
+
+    device_scalar<T> d_alpha(h_alpha);
+    device_scalar<T> d_beta(h_beta);
+
+#define PARAMS(alpha_, A_, x_, beta_, y_, semiring_, stage_)                               \
+    handle, trans, alpha_, A_, x_, beta_, y_, ttype, alg, semiring_, stage_, &buffer_size, \
+        dbuffer
+
+    static const rocsparse_semiring semirings[] = {rocsparse_semiring_plus_times,
+                                                   rocsparse_semiring_min_plus,
+                                                   rocsparse_semiring_max_times,
+                                                   rocsparse_semiring_max_min,
+                                                   rocsparse_semiring_or_and};
+
+    //
+    // Initialize the sparse matrix, integer values make min / max / or results exact.
+    //
+    host_csr_matrix<T, I, J> hA;
+    {
+        static constexpr bool             full_rank = false;
+        rocsparse_matrix_factory<T, I, J> matrix_factory(arg, arg.unit_check, full_rank);
+        matrix_factory.init_csr(hA, M, N, base);
+    }
+
+    device_csr_matrix<T, I, J> dA(hA);
+
+    host_dense_matrix<T> hx(N, 1);
+    rocsparse_matrix_utils::init_exact(hx);
+    device_dense_matrix<T> dx(hx);
+
+    host_dense_matrix<T> hy(M, 1);
+    rocsparse_matrix_utils::init_exact(hy);
+    device_dense_matrix<T> dy(hy);
+
+    rocsparse_local_spmat matA(dA);
+    rocsparse_local_dnvec x(dx);
+    rocsparse_local_dnvec y(dy);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+    // Run buffer size
+    void*  dbuffer     = nullptr;
+    size_t buffer_size = 0;
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmv_semiring(PARAMS(h_alpha,
+                                                         matA,
+                                                         x,
+                                                         h_beta,
+                                                         y,
+                                                         rocsparse_semiring_plus_times,
+                                                         rocsparse_spmv_stage_buffer_size)));
+    CHECK_HIP_ERROR(rocsparse_hipMalloc(&dbuffer, buffer_size));
+
+    // Run preprocess, the analysis does not depend on the semiring
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmv_semiring(PARAMS(h_alpha,
+                                                         matA,
+                                                         x,
+                                                         h_beta,
+                                                         y,
+                                                         rocsparse_semiring_plus_times,
+                                                         rocsparse_spmv_stage_preprocess)));
+
+    if(arg.unit_check)
+    {
+        for(auto semiring : semirings)
+        {
+            host_dense_matrix<T> hy_gold(hy);
+            host_csrmv_semiring<T, I, J>(semiring,
+                                         hA.m,
+                                         hA.n,
+                                         hA.nnz,
+                                         *h_alpha,
+                                         hA.ptr,
+                                         hA.ind,
+                                         hA.val,
+                                         hx,
+                                         *h_beta,
+                                         hy_gold,
+                                         hA.base);
+
+            // Pointer mode host
+            dy.transfer_from(hy);
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv_semiring(
+                PARAMS(h_alpha, matA, x, h_beta, y, semiring, rocsparse_spmv_stage_compute)));
+            hy_gold.near_check(dy);
+
+            // Pointer mode device
+            dy.transfer_from(hy);
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv_semiring(
+                PARAMS(d_alpha, matA, x, d_beta, y, semiring, rocsparse_spmv_stage_compute)));
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            hy_gold.near_check(dy);
+        }
+    }
+
+    if(arg.timing)
+    {
+        // Timing is done with the tropical (min, +) semiring
+        const rocsparse_semiring semiring = rocsparse_semiring_min_plus;
+
+        const int number_cold_calls = 2;
+        const int number_hot_calls  = arg.iters;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv_semiring(
+                PARAMS(h_alpha, matA, x, h_beta, y, semiring, rocsparse_spmv_stage_compute)));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv_semiring(
+                PARAMS(h_alpha, matA, x, h_beta, y, semiring, rocsparse_spmv_stage_compute)));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        const bool   nonzero_beta = *h_beta != static_cast<T>(0);
+        const double gflop_count  = spmv_gflop_count(M, dA.nnz, nonzero_beta);
+        const double gbyte_count  = csrmv_gbyte_count<T>(M, N, dA.nnz, nonzero_beta);
+
+        const double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
+        const double gpu_gbyte  = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info(display_key_t::trans_A,
+                            rocsparse_operation2string(trans),
+                            display_key_t::M,
+                            M,
+                            display_key_t::N,
+                            N,
+                            display_key_t::nnz_A,
+                            dA.nnz,
+                            display_key_t::alpha,
+                            *h_alpha,
+                            display_key_t::beta,
+                            *h_beta,
+                            display_key_t::algorithm,
+                            rocsparse_spmvalg2string(alg),
+                            display_key_t::gflops,
+                            gpu_gflops,
+                            display_key_t::bandwidth,
+                            gpu_gbyte,
+                            display_key_t::time_ms,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+
+    CHECK_HIP_ERROR(rocsparse_hipFree(dbuffer));
+
+#undef PARAMS
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                                    \
+    template void testing_spmv_semiring_bad_arg<ITYPE, JTYPE, TTYPE>(const Arguments& arg); \
+    template void testing_spmv_semiring<ITYPE, JTYPE, TTYPE>(const Arguments& arg)
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int64_t, int64_t, double);
+void testing_spmv_semiring_extra(const Arguments& arg) {}
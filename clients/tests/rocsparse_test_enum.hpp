@@ -36,6 +36,7 @@ static constexpr std::size_t countof2(T (&)[N])
   TRANSFORM_ROCSPARSE_TEST_ENUM(bsr2csr)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(bsrgeam)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(bsrgemm)			    \
+  TRANSFORM_ROCSPARSE_TEST_ENUM(bsrbjac)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(bsric0)					\
   TRANSFORM_ROCSPARSE_TEST_ENUM(bsrilu0)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(bsrmm)					\
@@ -44,6 +45,7 @@ static constexpr std::size_t countof2(T (&)[N])
   TRANSFORM_ROCSPARSE_TEST_ENUM(bsrsm)					\
   TRANSFORM_ROCSPARSE_TEST_ENUM(bsrsv)					\
   TRANSFORM_ROCSPARSE_TEST_ENUM(bsrxmv)					\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(capture_mode)		\
   TRANSFORM_ROCSPARSE_TEST_ENUM(check_matrix_coo)		\
   TRANSFORM_ROCSPARSE_TEST_ENUM(check_matrix_csc)	    \
   TRANSFORM_ROCSPARSE_TEST_ENUM(check_matrix_csr)	    \
@@ -52,6 +54,7 @@ static constexpr std::size_t countof2(T (&)[N])
   TRANSFORM_ROCSPARSE_TEST_ENUM(check_matrix_gebsr)		\
   TRANSFORM_ROCSPARSE_TEST_ENUM(check_matrix_hyb)	    \
   TRANSFORM_ROCSPARSE_TEST_ENUM(check_spmat)	        \
+  TRANSFORM_ROCSPARSE_TEST_ENUM(chunked_format)	    \
   TRANSFORM_ROCSPARSE_TEST_ENUM(const_dnmat_descr)      \
   TRANSFORM_ROCSPARSE_TEST_ENUM(const_dnvec_descr)      \
   TRANSFORM_ROCSPARSE_TEST_ENUM(const_spmat_descr)      \
@@ -71,10 +74,13 @@ static constexpr std::size_t countof2(T (&)[N])
   TRANSFORM_ROCSPARSE_TEST_ENUM(csr2ell)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(csr2gebsr)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(csr2hyb)				\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(csraggregate)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(csrcolor)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(csrgeam)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(csrgemm)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(csrgemm_reuse)			\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(csrrap)				\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(csrbjac)			\
   TRANSFORM_ROCSPARSE_TEST_ENUM(csric0)					\
   TRANSFORM_ROCSPARSE_TEST_ENUM(csricsv)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(csritilu0)				\
@@ -114,13 +120,16 @@ static constexpr std::size_t countof2(T (&)[N])
   TRANSFORM_ROCSPARSE_TEST_ENUM(gtsv)					\
   TRANSFORM_ROCSPARSE_TEST_ENUM(gtsv_no_pivot)			\
   TRANSFORM_ROCSPARSE_TEST_ENUM(gtsv_no_pivot_strided_batch) \
+  TRANSFORM_ROCSPARSE_TEST_ENUM(gtsv_strided_batch) 		\
   TRANSFORM_ROCSPARSE_TEST_ENUM(gtsv_interleaved_batch)	\
   TRANSFORM_ROCSPARSE_TEST_ENUM(hyb2csr)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(hybmv)					\
   TRANSFORM_ROCSPARSE_TEST_ENUM(identity)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(inverse_permutation)			\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(matrixmarket_format)		\
   TRANSFORM_ROCSPARSE_TEST_ENUM(nnz)					\
   TRANSFORM_ROCSPARSE_TEST_ENUM(prune_csr2csr_by_percentage)		\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(prune_csr2csr_by_strength)		\
   TRANSFORM_ROCSPARSE_TEST_ENUM(prune_csr2csr)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(prune_dense2csr_by_percentage)		\
   TRANSFORM_ROCSPARSE_TEST_ENUM(prune_dense2csr)			\
@@ -133,8 +142,11 @@ static constexpr std::size_t countof2(T (&)[N])
   TRANSFORM_ROCSPARSE_TEST_ENUM(sparse_to_dense_csc)			\
   TRANSFORM_ROCSPARSE_TEST_ENUM(sparse_to_dense_csr)			\
   TRANSFORM_ROCSPARSE_TEST_ENUM(sparse_to_sparse)			\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(spgeam)					\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spgemm_bsr)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spgemm_csr)				\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(spgemm_masked)			\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(spgemm_semiring)			\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spmat_descr)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spmm_bell)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spmm_coo)				\
@@ -148,8 +160,11 @@ static constexpr std::size_t countof2(T (&)[N])
   TRANSFORM_ROCSPARSE_TEST_ENUM(spmv_coo_aos)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spmv_coo)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spmv_csr)				\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(spmv_batched_csr)			\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spmv_csc)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spmv_ell)				\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(spmv_fused)				\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(spmv_semiring)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spsm_coo)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spsm_csr)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(spsv_coo)				\
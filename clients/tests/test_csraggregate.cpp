@@ -1,6 +1,6 @@
 /*! \file */
 /* ************************************************************************
-* Copyright (C) 2020-2024 Advanced Micro Devices, Inc. All rights Reserved.
+* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
 *
 * Permission is hereby granted, free of charge, to any person obtaining a copy
 * of this software and associated documentation files (the "Software"), to deal
@@ -21,24 +21,10 @@
 * THE SOFTWARE.
 *
 * ************************************************************************ */
-#pragma once
 
-#include "common.h"
-#include "handle.h"
+#include "test.hpp"
 
-namespace rocsparse
-{
-    template <rocsparse_int BLOCK_SIZE, typename T>
-    ROCSPARSE_KERNEL(BLOCK_SIZE)
-    void abs_kernel(rocsparse_int nnz_A, const T* csr_val_A, T* output)
-    {
-        rocsparse_int thread_id = hipThreadIdx_x + hipBlockIdx_x * BLOCK_SIZE;
+#include "testing_csraggregate.hpp"
 
-        if(thread_id >= nnz_A)
-        {
-            return;
-        }
-
-        output[thread_id] = rocsparse::abs(csr_val_A[thread_id]);
-    }
-}
+TEST_ROUTINE_WITH_CONFIG(
+    csraggregate, reordering, rocsparse_test_config_real_only, arg.M, arg.baseA, arg.matrix);
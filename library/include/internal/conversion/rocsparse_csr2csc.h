@@ -267,6 +267,175 @@ rocsparse_status rocsparse_zcsr2csc(rocsparse_handle                handle,
                                     rocsparse_index_base            idx_base,
                                     void*                           temp_buffer);
 /**@}*/
+
+/*! \ingroup conv_module
+*  \brief Symbolic CSR to CSC conversion that records a reusable transpose plan
+*
+*  \details
+*  \p rocsparse_csr2csc_analysis computes the CSC row indices \p csc_row_ind and column
+*  pointers \p csc_col_ptr of a CSR matrix, and stores the permutation that maps the CSR
+*  values onto the CSC values in \p info. Subsequent calls to rocsparse_scsr2csc_numeric(),
+*  rocsparse_dcsr2csc_numeric(), rocsparse_ccsr2csc_numeric() and
+*  rocsparse_zcsr2csc_numeric() then only gather the values, such that matrices with fixed
+*  sparsity pattern and changing values can be transposed repeatedly without sorting.
+*
+*  \p rocsparse_csr2csc_analysis requires extra temporary storage buffer that has to be
+*  allocated by the user. Storage buffer size can be determined by
+*  rocsparse_csr2csc_buffer_size() using \ref rocsparse_action_numeric. The plan
+*  stored in \p info can be released by rocsparse_csr2csc_clear() and is also released
+*  when \p info is destroyed.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  n           number of columns of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[out]
+*  csc_row_ind array of \p nnz elements containing the row indices of the sparse CSC
+*              matrix.
+*  @param[out]
+*  csc_col_ptr array of \p n+1 elements that point to the start of every column of the
+*              sparse CSC matrix.
+*  @param[in]
+*  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+*  @param[out]
+*  info        structure that holds the transpose plan.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user, size is returned by
+*              rocsparse_csr2csc_buffer_size().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p csr_row_ptr, \p csr_col_ind,
+*              \p csc_row_ind, \p csc_col_ptr, \p info or \p temp_buffer pointer is
+*              invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr2csc_analysis(rocsparse_handle     handle,
+                                            rocsparse_int        m,
+                                            rocsparse_int        n,
+                                            rocsparse_int        nnz,
+                                            const rocsparse_int* csr_row_ptr,
+                                            const rocsparse_int* csr_col_ind,
+                                            rocsparse_int*       csc_row_ind,
+                                            rocsparse_int*       csc_col_ptr,
+                                            rocsparse_index_base idx_base,
+                                            rocsparse_mat_info   info,
+                                            void*                temp_buffer);
+
+/*! \ingroup conv_module
+*  \brief Numeric CSR to CSC conversion using a transpose plan
+*
+*  \details
+*  \p rocsparse_csr2csc_numeric transposes the values of a CSR matrix into \p csc_val,
+*  using the plan that has been recorded by rocsparse_csr2csc_analysis(). The sparsity
+*  pattern of the CSR matrix must not have changed since the analysis. Only a single
+*  gather kernel is launched.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  \note
+*  This routine supports execution in a hipGraph context.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  n           number of columns of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[out]
+*  csc_val     array of \p nnz elements of the sparse CSC matrix.
+*  @param[in]
+*  info        structure that holds the transpose plan.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid or does
+*              not match the analysis.
+*  \retval     rocsparse_status_invalid_pointer \p csr_val, \p csc_val or \p info
+*              pointer is invalid, or no analysis has been performed.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2csc_numeric(rocsparse_handle   handle,
+                                            rocsparse_int      m,
+                                            rocsparse_int      n,
+                                            rocsparse_int      nnz,
+                                            const float*       csr_val,
+                                            float*             csc_val,
+                                            rocsparse_mat_info info);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2csc_numeric(rocsparse_handle   handle,
+                                            rocsparse_int      m,
+                                            rocsparse_int      n,
+                                            rocsparse_int      nnz,
+                                            const double*      csr_val,
+                                            double*            csc_val,
+                                            rocsparse_mat_info info);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsr2csc_numeric(rocsparse_handle               handle,
+                                            rocsparse_int                  m,
+                                            rocsparse_int                  n,
+                                            rocsparse_int                  nnz,
+                                            const rocsparse_float_complex* csr_val,
+                                            rocsparse_float_complex*       csc_val,
+                                            rocsparse_mat_info             info);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsr2csc_numeric(rocsparse_handle                handle,
+                                            rocsparse_int                   m,
+                                            rocsparse_int                   n,
+                                            rocsparse_int                   nnz,
+                                            const rocsparse_double_complex* csr_val,
+                                            rocsparse_double_complex*       csc_val,
+                                            rocsparse_mat_info              info);
+/**@}*/
+
+/*! \ingroup conv_module
+*  \brief Release the transpose plan of rocsparse_csr2csc_analysis()
+*
+*  \details
+*  \p rocsparse_csr2csc_clear deallocates all memory that was allocated by
+*  rocsparse_csr2csc_analysis(). Calling \p rocsparse_csr2csc_clear is optional, the
+*  plan is also released when \p info is destroyed.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[inout]
+*  info        structure that holds the transpose plan.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+*  \retval     rocsparse_status_memory_error the buffer for the plan could not be
+*              deallocated.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr2csc_clear(rocsparse_handle handle, rocsparse_mat_info info);
+
 #ifdef __cplusplus
 }
 #endif
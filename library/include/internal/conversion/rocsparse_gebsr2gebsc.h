@@ -330,6 +330,199 @@ rocsparse_status rocsparse_zgebsr2gebsc(rocsparse_handle                handle,
                                         void*                           temp_buffer);
 
 /**@}*/
+
+/*! \ingroup conv_module
+*  \brief Symbolic GEneral BSR to GEneral BSC conversion that records a reusable transpose
+*  plan
+*
+*  \details
+*  \p rocsparse_gebsr2gebsc_analysis computes the BSC row indices \p bsc_row_ind and
+*  column pointers \p bsc_col_ptr of a GEneral BSR matrix, and stores the block
+*  permutation that maps the BSR blocks onto the BSC blocks in \p info. Subsequent calls
+*  to rocsparse_sgebsr2gebsc_numeric(), rocsparse_dgebsr2gebsc_numeric(),
+*  rocsparse_cgebsr2gebsc_numeric() and rocsparse_zgebsr2gebsc_numeric() then only gather
+*  the block values.
+*
+*  \p rocsparse_gebsr2gebsc_analysis requires extra temporary storage buffer that has to
+*  be allocated by the user. Storage buffer size can be determined by
+*  rocsparse_sgebsr2gebsc_buffer_size(), rocsparse_dgebsr2gebsc_buffer_size(),
+*  rocsparse_cgebsr2gebsc_buffer_size() or rocsparse_zgebsr2gebsc_buffer_size(). The
+*  plan stored in \p info can be released by rocsparse_gebsr2gebsc_clear() and is also
+*  released when \p info is destroyed.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle        handle to the rocsparse library context queue.
+*  @param[in]
+*  mb            number of rows of the sparse GEneral BSR matrix.
+*  @param[in]
+*  nb            number of columns of the sparse GEneral BSR matrix.
+*  @param[in]
+*  nnzb          number of non-zero entries of the sparse GEneral BSR matrix.
+*  @param[in]
+*  bsr_row_ptr   array of \p mb+1 elements that point to the start of every row of the
+*                sparse GEneral BSR matrix.
+*  @param[in]
+*  bsr_col_ind   array of \p nnzb elements containing the column indices of the sparse
+*                GEneral BSR matrix.
+*  @param[in]
+*  row_block_dim row size of the blocks in the sparse general BSR matrix.
+*  @param[in]
+*  col_block_dim col size of the blocks in the sparse general BSR matrix.
+*  @param[out]
+*  bsc_row_ind   array of \p nnzb elements containing the row indices of the sparse BSC
+*                matrix.
+*  @param[out]
+*  bsc_col_ptr   array of \p nb+1 elements that point to the start of every column of
+*                the sparse BSC matrix.
+*  @param[in]
+*  idx_base      \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+*  @param[out]
+*  info          structure that holds the transpose plan.
+*  @param[in]
+*  temp_buffer   temporary storage buffer allocated by the user, size is returned by
+*                rocsparse_sgebsr2gebsc_buffer_size(), rocsparse_dgebsr2gebsc_buffer_size(),
+*                rocsparse_cgebsr2gebsc_buffer_size() or
+*                rocsparse_zgebsr2gebsc_buffer_size().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p mb, \p nb, \p nnzb, \p row_block_dim or
+*              \p col_block_dim is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p bsr_row_ptr, \p bsr_col_ind,
+*              \p bsc_row_ind, \p bsc_col_ptr, \p info or \p temp_buffer pointer is
+*              invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_gebsr2gebsc_analysis(rocsparse_handle     handle,
+                                                rocsparse_int        mb,
+                                                rocsparse_int        nb,
+                                                rocsparse_int        nnzb,
+                                                const rocsparse_int* bsr_row_ptr,
+                                                const rocsparse_int* bsr_col_ind,
+                                                rocsparse_int        row_block_dim,
+                                                rocsparse_int        col_block_dim,
+                                                rocsparse_int*       bsc_row_ind,
+                                                rocsparse_int*       bsc_col_ptr,
+                                                rocsparse_index_base idx_base,
+                                                rocsparse_mat_info   info,
+                                                void*                temp_buffer);
+
+/*! \ingroup conv_module
+*  \brief Numeric GEneral BSR to GEneral BSC conversion using a transpose plan
+*
+*  \details
+*  \p rocsparse_gebsr2gebsc_numeric moves the blocks of a GEneral BSR matrix into
+*  \p bsc_val, using the plan that has been recorded by rocsparse_gebsr2gebsc_analysis().
+*  As in rocsparse_sgebsr2gebsc(), the blocks themselves are copied as is. The sparsity
+*  pattern and block dimensions must not have changed since the analysis.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  \note
+*  This routine supports execution in a hipGraph context.
+*
+*  @param[in]
+*  handle        handle to the rocsparse library context queue.
+*  @param[in]
+*  mb            number of rows of the sparse GEneral BSR matrix.
+*  @param[in]
+*  nb            number of columns of the sparse GEneral BSR matrix.
+*  @param[in]
+*  nnzb          number of non-zero entries of the sparse GEneral BSR matrix.
+*  @param[in]
+*  bsr_val       array of \p nnzb*row_block_dim*col_block_dim elements of the sparse
+*                GEneral BSR matrix.
+*  @param[in]
+*  row_block_dim row size of the blocks in the sparse general BSR matrix.
+*  @param[in]
+*  col_block_dim col size of the blocks in the sparse general BSR matrix.
+*  @param[out]
+*  bsc_val       array of \p nnzb*row_block_dim*col_block_dim elements of the sparse
+*                BSC matrix.
+*  @param[in]
+*  info          structure that holds the transpose plan.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p mb, \p nb, \p nnzb, \p row_block_dim or
+*              \p col_block_dim is invalid or does not match the analysis.
+*  \retval     rocsparse_status_invalid_pointer \p bsr_val, \p bsc_val or \p info
+*              pointer is invalid, or no analysis has been performed.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sgebsr2gebsc_numeric(rocsparse_handle   handle,
+                                                rocsparse_int      mb,
+                                                rocsparse_int      nb,
+                                                rocsparse_int      nnzb,
+                                                const float*       bsr_val,
+                                                rocsparse_int      row_block_dim,
+                                                rocsparse_int      col_block_dim,
+                                                float*             bsc_val,
+                                                rocsparse_mat_info info);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dgebsr2gebsc_numeric(rocsparse_handle   handle,
+                                                rocsparse_int      mb,
+                                                rocsparse_int      nb,
+                                                rocsparse_int      nnzb,
+                                                const double*      bsr_val,
+                                                rocsparse_int      row_block_dim,
+                                                rocsparse_int      col_block_dim,
+                                                double*            bsc_val,
+                                                rocsparse_mat_info info);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cgebsr2gebsc_numeric(rocsparse_handle               handle,
+                                                rocsparse_int                  mb,
+                                                rocsparse_int                  nb,
+                                                rocsparse_int                  nnzb,
+                                                const rocsparse_float_complex* bsr_val,
+                                                rocsparse_int                  row_block_dim,
+                                                rocsparse_int                  col_block_dim,
+                                                rocsparse_float_complex*       bsc_val,
+                                                rocsparse_mat_info             info);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zgebsr2gebsc_numeric(rocsparse_handle                handle,
+                                                rocsparse_int                   mb,
+                                                rocsparse_int                   nb,
+                                                rocsparse_int                   nnzb,
+                                                const rocsparse_double_complex* bsr_val,
+                                                rocsparse_int                   row_block_dim,
+                                                rocsparse_int                   col_block_dim,
+                                                rocsparse_double_complex*       bsc_val,
+                                                rocsparse_mat_info              info);
+/**@}*/
+
+/*! \ingroup conv_module
+*  \brief Release the transpose plan of rocsparse_gebsr2gebsc_analysis()
+*
+*  \details
+*  \p rocsparse_gebsr2gebsc_clear deallocates all memory that was allocated by
+*  rocsparse_gebsr2gebsc_analysis(). Calling \p rocsparse_gebsr2gebsc_clear is optional,
+*  the plan is also released when \p info is destroyed.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[inout]
+*  info        structure that holds the transpose plan.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+*  \retval     rocsparse_status_memory_error the buffer for the plan could not be
+*              deallocated.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_gebsr2gebsc_clear(rocsparse_handle handle, rocsparse_mat_info info);
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,321 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the Software), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCSPARSE_PRUNE_CSR2CSR_BY_STRENGTH_H
+#define ROCSPARSE_PRUNE_CSR2CSR_BY_STRENGTH_H
+
+#include "../../rocsparse-types.h"
+#include "rocsparse/rocsparse-export.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! \ingroup conv_module
+ *  \brief Extract the strength of connection matrix of a sparse CSR matrix
+ *
+ *  \details
+ *  \p rocsparse_prune_csr2csr_by_strength_buffer_size returns the size of the temporary buffer
+ *  that is required by \p rocsparse_sprune_csr2csr_by_strength_nnz,
+ *  \p rocsparse_dprune_csr2csr_by_strength_nnz, \p rocsparse_sprune_csr2csr_by_strength, and
+ *  \p rocsparse_dprune_csr2csr_by_strength. The temporary storage buffer must be allocated by
+ *  the user.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  \note
+ *  This routine supports execution in a hipGraph context.
+ *
+ *  @param[in]
+ *  handle        handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m             number of rows and columns in the square sparse CSR matrix.
+ *  @param[in]
+ *  nnz_A         number of non-zeros in the sparse CSR matrix A.
+ *  @param[in]
+ *  csr_descr_A   descriptor of the sparse CSR matrix A. Currently, only
+ *                \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val_A     array of \p nnz_A elements containing the values of the sparse CSR matrix A.
+ *  @param[in]
+ *  csr_row_ptr_A array of \p m+1 elements that point to the start of every row of the
+ *                sparse CSR matrix A.
+ *  @param[in]
+ *  csr_col_ind_A array of \p nnz_A elements containing the column indices of the sparse CSR matrix A.
+ *  @param[in]
+ *  theta         pointer to the non-negative strength threshold which can exist in either host or device memory.
+ *  @param[in]
+ *  csr_descr_C   descriptor of the sparse CSR matrix C. Currently, only
+ *                \ref rocsparse_matrix_type_general is supported.
+ *  @param[out]
+ *  buffer_size   number of bytes of the temporary storage buffer required by
+ *                \p rocsparse_sprune_csr2csr_by_strength_nnz, \p rocsparse_dprune_csr2csr_by_strength_nnz,
+ *                \p rocsparse_sprune_csr2csr_by_strength, and \p rocsparse_dprune_csr2csr_by_strength.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz_A is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status
+    rocsparse_sprune_csr2csr_by_strength_buffer_size(rocsparse_handle          handle,
+                                                     rocsparse_int             m,
+                                                     rocsparse_int             nnz_A,
+                                                     const rocsparse_mat_descr csr_descr_A,
+                                                     const float*              csr_val_A,
+                                                     const rocsparse_int*      csr_row_ptr_A,
+                                                     const rocsparse_int*      csr_col_ind_A,
+                                                     const float*              theta,
+                                                     const rocsparse_mat_descr csr_descr_C,
+                                                     size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status
+    rocsparse_dprune_csr2csr_by_strength_buffer_size(rocsparse_handle          handle,
+                                                     rocsparse_int             m,
+                                                     rocsparse_int             nnz_A,
+                                                     const rocsparse_mat_descr csr_descr_A,
+                                                     const double*             csr_val_A,
+                                                     const rocsparse_int*      csr_row_ptr_A,
+                                                     const rocsparse_int*      csr_col_ind_A,
+                                                     const double*             theta,
+                                                     const rocsparse_mat_descr csr_descr_C,
+                                                     size_t*                   buffer_size);
+/**@}*/
+
+/*! \ingroup conv_module
+ *  \brief Extract the strength of connection matrix of a sparse CSR matrix
+ *
+ *  \details
+ *  \p rocsparse_prune_csr2csr_by_strength_nnz computes the number of nonzero elements per row
+ *  and the total number of nonzero elements of the strength of connection matrix C of the square
+ *  sparse CSR matrix A. An off-diagonal entry \f$a_{ij}\f$ is kept if
+ *  \f[
+ *    |a_{ij}| \geq \theta \sqrt{|a_{ii}| |a_{jj}|},
+ *  \f]
+ *  and pruned otherwise. Diagonal entries are always kept. Missing diagonal entries are treated
+ *  as zero. The diagonal magnitudes are stored in the temporary buffer and reused by
+ *  \p rocsparse_sprune_csr2csr_by_strength and \p rocsparse_dprune_csr2csr_by_strength.
+ *
+ *  \note The routine does support asynchronous execution if the pointer mode is set to device.
+ *
+ *  \note
+ *  This routine does not support execution in a hipGraph context.
+ *
+ *  @param[in]
+ *  handle        handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m             number of rows and columns in the square sparse CSR matrix.
+ *  @param[in]
+ *  nnz_A         number of non-zeros in the sparse CSR matrix A.
+ *  @param[in]
+ *  csr_descr_A   descriptor of the sparse CSR matrix A. Currently, only
+ *                \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val_A     array of \p nnz_A elements containing the values of the sparse CSR matrix A.
+ *  @param[in]
+ *  csr_row_ptr_A array of \p m+1 elements that point to the start of every row of the
+ *                sparse CSR matrix A.
+ *  @param[in]
+ *  csr_col_ind_A array of \p nnz_A elements containing the column indices of the sparse CSR matrix A.
+ *  @param[in]
+ *  theta         pointer to the non-negative strength threshold which can exist in either host or device memory.
+ *  @param[in]
+ *  csr_descr_C   descriptor of the sparse CSR matrix C. Currently, only
+ *                \ref rocsparse_matrix_type_general is supported.
+ *  @param[out]
+ *  csr_row_ptr_C array of \p m+1 elements that point to the start of every row of the
+ *                sparse CSR matrix C.
+ *  @param[out]
+ *  nnz_total_dev_host_ptr total number of nonzero elements in device or host memory.
+ *  @param[out]
+ *  temp_buffer   buffer allocated by the user whose size is determined by calling
+ *                \p rocsparse_xprune_csr2csr_by_strength_buffer_size().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz_A is invalid.
+ *  \retval     rocsparse_status_invalid_value \p theta is negative.
+ *  \retval     rocsparse_status_invalid_pointer \p csr_descr_A, \p csr_val_A, \p csr_row_ptr_A,
+ *              \p csr_col_ind_A, \p theta, \p csr_descr_C, \p csr_row_ptr_C,
+ *              \p nnz_total_dev_host_ptr or \p temp_buffer pointer is invalid.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sprune_csr2csr_by_strength_nnz(rocsparse_handle          handle,
+                                                          rocsparse_int             m,
+                                                          rocsparse_int             nnz_A,
+                                                          const rocsparse_mat_descr csr_descr_A,
+                                                          const float*              csr_val_A,
+                                                          const rocsparse_int*      csr_row_ptr_A,
+                                                          const rocsparse_int*      csr_col_ind_A,
+                                                          const float*              theta,
+                                                          const rocsparse_mat_descr csr_descr_C,
+                                                          rocsparse_int*            csr_row_ptr_C,
+                                                          rocsparse_int* nnz_total_dev_host_ptr,
+                                                          void*          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dprune_csr2csr_by_strength_nnz(rocsparse_handle          handle,
+                                                          rocsparse_int             m,
+                                                          rocsparse_int             nnz_A,
+                                                          const rocsparse_mat_descr csr_descr_A,
+                                                          const double*             csr_val_A,
+                                                          const rocsparse_int*      csr_row_ptr_A,
+                                                          const rocsparse_int*      csr_col_ind_A,
+                                                          const double*             theta,
+                                                          const rocsparse_mat_descr csr_descr_C,
+                                                          rocsparse_int*            csr_row_ptr_C,
+                                                          rocsparse_int* nnz_total_dev_host_ptr,
+                                                          void*          temp_buffer);
+/**@}*/
+
+/*! \ingroup conv_module
+ *  \brief Extract the strength of connection matrix of a sparse CSR matrix
+ *
+ *  \details
+ *  \p rocsparse_prune_csr2csr_by_strength fills the column indices and values of the strength of
+ *  connection matrix C, as determined by \p rocsparse_prune_csr2csr_by_strength_nnz. The column
+ *  ordering of each row of A is preserved. The temporary buffer must be the one that has been
+ *  passed to \p rocsparse_prune_csr2csr_by_strength_nnz.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  \note
+ *  This routine supports execution in a hipGraph context.
+ *
+ *  @param[in]
+ *  handle        handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m             number of rows and columns in the square sparse CSR matrix.
+ *  @param[in]
+ *  nnz_A         number of non-zeros in the sparse CSR matrix A.
+ *  @param[in]
+ *  csr_descr_A   descriptor of the sparse CSR matrix A. Currently, only
+ *                \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val_A     array of \p nnz_A elements containing the values of the sparse CSR matrix A.
+ *  @param[in]
+ *  csr_row_ptr_A array of \p m+1 elements that point to the start of every row of the
+ *                sparse CSR matrix A.
+ *  @param[in]
+ *  csr_col_ind_A array of \p nnz_A elements containing the column indices of the sparse CSR matrix A.
+ *  @param[in]
+ *  theta         pointer to the non-negative strength threshold which can exist in either host or device memory.
+ *  @param[in]
+ *  csr_descr_C   descriptor of the sparse CSR matrix C. Currently, only
+ *                \ref rocsparse_matrix_type_general is supported.
+ *  @param[out]
+ *  csr_val_C     array of \p nnz_C elements containing the values of the sparse CSR matrix C.
+ *  @param[in]
+ *  csr_row_ptr_C array of \p m+1 elements that point to the start of every row of the
+ *                sparse CSR matrix C.
+ *  @param[out]
+ *  csr_col_ind_C array of \p nnz_C elements containing the column indices of the sparse CSR matrix C.
+ *  @param[in]
+ *  temp_buffer   buffer allocated by the user whose size is determined by calling
+ *                \p rocsparse_xprune_csr2csr_by_strength_buffer_size().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz_A is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p csr_descr_A, \p csr_val_A, \p csr_row_ptr_A,
+ *              \p csr_col_ind_A, \p theta, \p csr_descr_C, \p csr_val_C, \p csr_row_ptr_C,
+ *              \p csr_col_ind_C or \p temp_buffer pointer is invalid.
+ *
+ *  \par Example
+ *  \code{.c}
+ *      // Strength of connection matrix of A with theta = 0.25
+ *      float theta = 0.25f;
+ *
+ *      size_t buffer_size;
+ *      rocsparse_sprune_csr2csr_by_strength_buffer_size(handle, m, nnz_A, descr_A, csr_val_A,
+ *                                                       csr_row_ptr_A, csr_col_ind_A, &theta,
+ *                                                       descr_C, &buffer_size);
+ *
+ *      void* temp_buffer;
+ *      hipMalloc(&temp_buffer, buffer_size);
+ *
+ *      rocsparse_int* csr_row_ptr_C;
+ *      hipMalloc((void**)&csr_row_ptr_C, sizeof(rocsparse_int) * (m + 1));
+ *
+ *      rocsparse_int nnz_C;
+ *      rocsparse_sprune_csr2csr_by_strength_nnz(handle, m, nnz_A, descr_A, csr_val_A,
+ *                                               csr_row_ptr_A, csr_col_ind_A, &theta, descr_C,
+ *                                               csr_row_ptr_C, &nnz_C, temp_buffer);
+ *
+ *      float*         csr_val_C;
+ *      rocsparse_int* csr_col_ind_C;
+ *      hipMalloc((void**)&csr_val_C, sizeof(float) * nnz_C);
+ *      hipMalloc((void**)&csr_col_ind_C, sizeof(rocsparse_int) * nnz_C);
+ *
+ *      rocsparse_sprune_csr2csr_by_strength(handle, m, nnz_A, descr_A, csr_val_A, csr_row_ptr_A,
+ *                                           csr_col_ind_A, &theta, descr_C, csr_val_C,
+ *                                           csr_row_ptr_C, csr_col_ind_C, temp_buffer);
+ *  \endcode
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sprune_csr2csr_by_strength(rocsparse_handle          handle,
+                                                      rocsparse_int             m,
+                                                      rocsparse_int             nnz_A,
+                                                      const rocsparse_mat_descr csr_descr_A,
+                                                      const float*              csr_val_A,
+                                                      const rocsparse_int*      csr_row_ptr_A,
+                                                      const rocsparse_int*      csr_col_ind_A,
+                                                      const float*              theta,
+                                                      const rocsparse_mat_descr csr_descr_C,
+                                                      float*                    csr_val_C,
+                                                      const rocsparse_int*      csr_row_ptr_C,
+                                                      rocsparse_int*            csr_col_ind_C,
+                                                      void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dprune_csr2csr_by_strength(rocsparse_handle          handle,
+                                                      rocsparse_int             m,
+                                                      rocsparse_int             nnz_A,
+                                                      const rocsparse_mat_descr csr_descr_A,
+                                                      const double*             csr_val_A,
+                                                      const rocsparse_int*      csr_row_ptr_A,
+                                                      const rocsparse_int*      csr_col_ind_A,
+                                                      const double*             theta,
+                                                      const rocsparse_mat_descr csr_descr_C,
+                                                      double*                   csr_val_C,
+                                                      const rocsparse_int*      csr_row_ptr_C,
+                                                      rocsparse_int*            csr_col_ind_C,
+                                                      void*                     temp_buffer);
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ROCSPARSE_PRUNE_CSR2CSR_BY_STRENGTH_H */
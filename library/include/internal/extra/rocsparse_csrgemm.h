@@ -248,14 +248,16 @@ rocsparse_status rocsparse_zcsrgemm_buffer_size(rocsparse_handle
 *  products per row. If this number is exceeded, \ref rocsparse_status_requires_sorted_storage
 *  will be returned.
 *  \note
-*  This function is blocking with respect to the host.
+*  This function is blocking with respect to the host, unless the pointer mode is
+*  \ref rocsparse_pointer_mode_device and matrices B and D are sorted.
 *  \note
 *  Currently, only \p trans_A == \p trans_B == \ref rocsparse_operation_none is
 *  supported.
 *  \note
 *  Currently, only \ref rocsparse_matrix_type_general is supported.
 *  \note
-*  This routine does not support execution in a hipGraph context.
+*  This routine supports execution in a hipGraph context only if it is non-blocking with
+*  respect to the host, see above.
 *
 *  @param[in]
 *  handle          handle to the rocsparse library context queue.
@@ -0,0 +1,485 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the Software), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCSPARSE_CSRRAP_H
+#define ROCSPARSE_CSRRAP_H
+
+#include "../../rocsparse-types.h"
+#include "rocsparse/rocsparse-export.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! \ingroup extra_module
+*  \brief Sparse matrix triple product using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrrap_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_csrrap_nnz(). The temporary storage buffer must be
+*  allocated by the user.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  \note
+*  This routine supports execution in a hipGraph context.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix \f$R\f$ and \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix \f$R\f$ and number of rows
+*                  and columns of the sparse CSR matrix \f$A\f$ and number of rows of the
+*                  sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  k               number of columns of the sparse CSR matrix \f$P\f$ and \f$C\f$.
+*  @param[in]
+*  descr_R         descriptor of the sparse CSR matrix \f$R\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_R           number of non-zero entries of the sparse CSR matrix \f$R\f$.
+*  @param[in]
+*  csr_row_ptr_R   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$R\f$.
+*  @param[in]
+*  csr_col_ind_R   array of \p nnz_R elements containing the column indices of the
+*                  sparse CSR matrix \f$R\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr_A   array of \p n+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr_P         descriptor of the sparse CSR matrix \f$P\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_P           number of non-zero entries of the sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  csr_row_ptr_P   array of \p n+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  csr_col_ind_P   array of \p nnz_P elements containing the column indices of the
+*                  sparse CSR matrix \f$P\f$.
+*  @param[out]
+*  buffer_size     number of bytes of the temporary storage buffer required by
+*                  rocsparse_csrrap_nnz().
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz_R, \p nnz_A or
+*          \p nnz_P is invalid.
+*  \retval rocsparse_status_invalid_pointer \p descr_R, \p csr_row_ptr_R,
+*          \p csr_col_ind_R, \p descr_A, \p csr_row_ptr_A, \p csr_col_ind_A,
+*          \p descr_P, \p csr_row_ptr_P, \p csr_col_ind_P or \p buffer_size is invalid.
+*  \retval rocsparse_status_not_implemented
+*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrrap_buffer_size(rocsparse_handle          handle,
+                                              rocsparse_int             m,
+                                              rocsparse_int             n,
+                                              rocsparse_int             k,
+                                              const rocsparse_mat_descr descr_R,
+                                              rocsparse_int             nnz_R,
+                                              const rocsparse_int*      csr_row_ptr_R,
+                                              const rocsparse_int*      csr_col_ind_R,
+                                              const rocsparse_mat_descr descr_A,
+                                              rocsparse_int             nnz_A,
+                                              const rocsparse_int*      csr_row_ptr_A,
+                                              const rocsparse_int*      csr_col_ind_A,
+                                              const rocsparse_mat_descr descr_P,
+                                              rocsparse_int             nnz_P,
+                                              const rocsparse_int*      csr_row_ptr_P,
+                                              const rocsparse_int*      csr_col_ind_P,
+                                              size_t*                   buffer_size);
+
+/*! \ingroup extra_module
+*  \brief Sparse matrix triple product using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrrap_nnz computes the total CSR non-zero elements and the CSR row
+*  offsets, that point to the start of every row of the sparse CSR matrix, of the
+*  resulting triple product \f$C = R \cdot A \cdot P\f$. It is assumed that
+*  \p csr_row_ptr_C has been allocated with size \p m+1. The intermediate product
+*  \f$A \cdot P\f$ is never formed, rows of \f$C\f$ are computed directly from the
+*  rows of \f$R\f$, \f$A\f$ and \f$P\f$.
+*
+*  \note
+*  This function supports unsorted column indices of \f$R\f$ and \f$A\f$, while the
+*  column indices of \f$P\f$ must be sorted.
+*  \note
+*  Currently, only \ref rocsparse_matrix_type_general is supported.
+*  \note
+*  This function is blocking with respect to the host if the pointer mode is set to host.
+*  \note
+*  This routine does not support execution in a hipGraph context.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix \f$R\f$ and \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix \f$R\f$ and number of rows
+*                  and columns of the sparse CSR matrix \f$A\f$ and number of rows of the
+*                  sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  k               number of columns of the sparse CSR matrix \f$P\f$ and \f$C\f$.
+*  @param[in]
+*  descr_R         descriptor of the sparse CSR matrix \f$R\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_R           number of non-zero entries of the sparse CSR matrix \f$R\f$.
+*  @param[in]
+*  csr_row_ptr_R   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$R\f$.
+*  @param[in]
+*  csr_col_ind_R   array of \p nnz_R elements containing the column indices of the
+*                  sparse CSR matrix \f$R\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr_A   array of \p n+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr_P         descriptor of the sparse CSR matrix \f$P\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_P           number of non-zero entries of the sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  csr_row_ptr_P   array of \p n+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  csr_col_ind_P   array of \p nnz_P elements containing the column indices of the
+*                  sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  descr_C         descriptor of the sparse CSR matrix \f$C\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[out]
+*  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$C\f$.
+*  @param[out]
+*  nnz_C           pointer to the number of non-zero entries of the sparse CSR
+*                  matrix \f$C\f$, in host or device memory.
+*  @param[in]
+*  temp_buffer     temporary storage buffer allocated by the user, size is returned
+*                  by rocsparse_csrrap_buffer_size().
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz_R, \p nnz_A or
+*          \p nnz_P is invalid.
+*  \retval rocsparse_status_invalid_pointer \p descr_R, \p csr_row_ptr_R,
+*          \p csr_col_ind_R, \p descr_A, \p csr_row_ptr_A, \p csr_col_ind_A,
+*          \p descr_P, \p csr_row_ptr_P, \p csr_col_ind_P, \p descr_C,
+*          \p csr_row_ptr_C, \p nnz_C or \p temp_buffer is invalid.
+*  \retval rocsparse_status_not_implemented
+*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrrap_nnz(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      rocsparse_int             k,
+                                      const rocsparse_mat_descr descr_R,
+                                      rocsparse_int             nnz_R,
+                                      const rocsparse_int*      csr_row_ptr_R,
+                                      const rocsparse_int*      csr_col_ind_R,
+                                      const rocsparse_mat_descr descr_A,
+                                      rocsparse_int             nnz_A,
+                                      const rocsparse_int*      csr_row_ptr_A,
+                                      const rocsparse_int*      csr_col_ind_A,
+                                      const rocsparse_mat_descr descr_P,
+                                      rocsparse_int             nnz_P,
+                                      const rocsparse_int*      csr_row_ptr_P,
+                                      const rocsparse_int*      csr_col_ind_P,
+                                      const rocsparse_mat_descr descr_C,
+                                      rocsparse_int*            csr_row_ptr_C,
+                                      rocsparse_int*            nnz_C,
+                                      void*                     temp_buffer);
+
+/*! \ingroup extra_module
+*  \brief Sparse matrix triple product using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrrap computes the Galerkin type triple product of the sparse
+*  \f$m \times n\f$ matrix \f$R\f$, the sparse \f$n \times n\f$ matrix \f$A\f$
+*  and the sparse \f$n \times k\f$ matrix \f$P\f$, defined in CSR storage format,
+*  such that
+*  \f[
+*    C := R \cdot A \cdot P,
+*  \f]
+*  where \f$C\f$ is the sparse \f$m \times k\f$ matrix, e.g. the coarse grid operator
+*  of an algebraic multigrid hierarchy with restriction \f$R = P^T\f$. The intermediate
+*  product \f$A \cdot P\f$ is never formed, instead each row of \f$C\f$ is accumulated
+*  directly from the rows of \f$R\f$, \f$A\f$ and \f$P\f$ in on-chip memory.
+*
+*  It is assumed that \p csr_row_ptr_C has already been filled and that \p csr_val_C and
+*  \p csr_col_ind_C are allocated by the user. \p csr_row_ptr_C and allocation size of
+*  \p csr_col_ind_C and \p csr_val_C is defined by the number of non-zero elements of
+*  the sparse CSR matrix C. Both can be obtained by rocsparse_csrrap_nnz(). The
+*  column indices of each row of \f$C\f$ are sorted.
+*
+*  \note
+*  The column indices of \f$P\f$ must be sorted.
+*  \note
+*  Currently, only \ref rocsparse_matrix_type_general is supported.
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*  \note
+*  This routine supports execution in a hipGraph context.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix \f$R\f$ and \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix \f$R\f$ and number of rows
+*                  and columns of the sparse CSR matrix \f$A\f$ and number of rows of the
+*                  sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  k               number of columns of the sparse CSR matrix \f$P\f$ and \f$C\f$.
+*  @param[in]
+*  descr_R         descriptor of the sparse CSR matrix \f$R\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_R           number of non-zero entries of the sparse CSR matrix \f$R\f$.
+*  @param[in]
+*  csr_val_R       array of \p nnz_R elements of the sparse CSR matrix \f$R\f$.
+*  @param[in]
+*  csr_row_ptr_R   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$R\f$.
+*  @param[in]
+*  csr_col_ind_R   array of \p nnz_R elements containing the column indices of the
+*                  sparse CSR matrix \f$R\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_val_A       array of \p nnz_A elements of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr_A   array of \p n+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr_P         descriptor of the sparse CSR matrix \f$P\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_P           number of non-zero entries of the sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  csr_val_P       array of \p nnz_P elements of the sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  csr_row_ptr_P   array of \p n+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  csr_col_ind_P   array of \p nnz_P elements containing the column indices of the
+*                  sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  descr_C         descriptor of the sparse CSR matrix \f$C\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[out]
+*  csr_val_C       array of \p nnz_C elements of the sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$C\f$.
+*  @param[out]
+*  csr_col_ind_C   array of \p nnz_C elements containing the column indices of the
+*                  sparse CSR matrix \f$C\f$.
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz_R, \p nnz_A or
+*          \p nnz_P is invalid.
+*  \retval rocsparse_status_invalid_pointer \p descr_R, \p csr_val_R, \p csr_row_ptr_R,
+*          \p csr_col_ind_R, \p descr_A, \p csr_val_A, \p csr_row_ptr_A, \p csr_col_ind_A,
+*          \p descr_P, \p csr_val_P, \p csr_row_ptr_P, \p csr_col_ind_P, \p descr_C,
+*          \p csr_val_C, \p csr_row_ptr_C or \p csr_col_ind_C is invalid.
+*  \retval rocsparse_status_not_implemented
+*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*
+*  \par Example
+*  Compute the coarse grid operator \f$A_c = P^T A P\f$.
+*  \code{.c}
+*      // Obtain the temporary buffer size
+*      size_t buffer_size;
+*      rocsparse_csrrap_buffer_size(handle, nc, n, nc,
+*                                   descr_R, nnz_R, csr_row_ptr_R, csr_col_ind_R,
+*                                   descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A,
+*                                   descr_P, nnz_P, csr_row_ptr_P, csr_col_ind_P,
+*                                   &buffer_size);
+*
+*      void* temp_buffer;
+*      hipMalloc(&temp_buffer, buffer_size);
+*
+*      // Obtain the row pointers and number of non-zero entries of A_c
+*      rocsparse_int* csr_row_ptr_C;
+*      hipMalloc((void**)&csr_row_ptr_C, sizeof(rocsparse_int) * (nc + 1));
+*
+*      rocsparse_int nnz_C;
+*      rocsparse_csrrap_nnz(handle, nc, n, nc,
+*                           descr_R, nnz_R, csr_row_ptr_R, csr_col_ind_R,
+*                           descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A,
+*                           descr_P, nnz_P, csr_row_ptr_P, csr_col_ind_P,
+*                           descr_C, csr_row_ptr_C, &nnz_C, temp_buffer);
+*
+*      rocsparse_int* csr_col_ind_C;
+*      float*         csr_val_C;
+*      hipMalloc((void**)&csr_col_ind_C, sizeof(rocsparse_int) * nnz_C);
+*      hipMalloc((void**)&csr_val_C, sizeof(float) * nnz_C);
+*
+*      // Compute A_c, the values can be recomputed for new values of A without
+*      // repeating the steps above
+*      rocsparse_scsrrap(handle, nc, n, nc,
+*                        descr_R, nnz_R, csr_val_R, csr_row_ptr_R, csr_col_ind_R,
+*                        descr_A, nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A,
+*                        descr_P, nnz_P, csr_val_P, csr_row_ptr_P, csr_col_ind_P,
+*                        descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C);
+*  \endcode
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrrap(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             n,
+                                   rocsparse_int             k,
+                                   const rocsparse_mat_descr descr_R,
+                                   rocsparse_int             nnz_R,
+                                   const float*              csr_val_R,
+                                   const rocsparse_int*      csr_row_ptr_R,
+                                   const rocsparse_int*      csr_col_ind_R,
+                                   const rocsparse_mat_descr descr_A,
+                                   rocsparse_int             nnz_A,
+                                   const float*              csr_val_A,
+                                   const rocsparse_int*      csr_row_ptr_A,
+                                   const rocsparse_int*      csr_col_ind_A,
+                                   const rocsparse_mat_descr descr_P,
+                                   rocsparse_int             nnz_P,
+                                   const float*              csr_val_P,
+                                   const rocsparse_int*      csr_row_ptr_P,
+                                   const rocsparse_int*      csr_col_ind_P,
+                                   const rocsparse_mat_descr descr_C,
+                                   float*                    csr_val_C,
+                                   const rocsparse_int*      csr_row_ptr_C,
+                                   rocsparse_int*            csr_col_ind_C);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrrap(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             n,
+                                   rocsparse_int             k,
+                                   const rocsparse_mat_descr descr_R,
+                                   rocsparse_int             nnz_R,
+                                   const double*             csr_val_R,
+                                   const rocsparse_int*      csr_row_ptr_R,
+                                   const rocsparse_int*      csr_col_ind_R,
+                                   const rocsparse_mat_descr descr_A,
+                                   rocsparse_int             nnz_A,
+                                   const double*             csr_val_A,
+                                   const rocsparse_int*      csr_row_ptr_A,
+                                   const rocsparse_int*      csr_col_ind_A,
+                                   const rocsparse_mat_descr descr_P,
+                                   rocsparse_int             nnz_P,
+                                   const double*             csr_val_P,
+                                   const rocsparse_int*      csr_row_ptr_P,
+                                   const rocsparse_int*      csr_col_ind_P,
+                                   const rocsparse_mat_descr descr_C,
+                                   double*                   csr_val_C,
+                                   const rocsparse_int*      csr_row_ptr_C,
+                                   rocsparse_int*            csr_col_ind_C);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrrap(rocsparse_handle               handle,
+                                   rocsparse_int                  m,
+                                   rocsparse_int                  n,
+                                   rocsparse_int                  k,
+                                   const rocsparse_mat_descr      descr_R,
+                                   rocsparse_int                  nnz_R,
+                                   const rocsparse_float_complex* csr_val_R,
+                                   const rocsparse_int*           csr_row_ptr_R,
+                                   const rocsparse_int*           csr_col_ind_R,
+                                   const rocsparse_mat_descr      descr_A,
+                                   rocsparse_int                  nnz_A,
+                                   const rocsparse_float_complex* csr_val_A,
+                                   const rocsparse_int*           csr_row_ptr_A,
+                                   const rocsparse_int*           csr_col_ind_A,
+                                   const rocsparse_mat_descr      descr_P,
+                                   rocsparse_int                  nnz_P,
+                                   const rocsparse_float_complex* csr_val_P,
+                                   const rocsparse_int*           csr_row_ptr_P,
+                                   const rocsparse_int*           csr_col_ind_P,
+                                   const rocsparse_mat_descr      descr_C,
+                                   rocsparse_float_complex*       csr_val_C,
+                                   const rocsparse_int*           csr_row_ptr_C,
+                                   rocsparse_int*                 csr_col_ind_C);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrrap(rocsparse_handle                handle,
+                                   rocsparse_int                   m,
+                                   rocsparse_int                   n,
+                                   rocsparse_int                   k,
+                                   const rocsparse_mat_descr       descr_R,
+                                   rocsparse_int                   nnz_R,
+                                   const rocsparse_double_complex* csr_val_R,
+                                   const rocsparse_int*            csr_row_ptr_R,
+                                   const rocsparse_int*            csr_col_ind_R,
+                                   const rocsparse_mat_descr       descr_A,
+                                   rocsparse_int                   nnz_A,
+                                   const rocsparse_double_complex* csr_val_A,
+                                   const rocsparse_int*            csr_row_ptr_A,
+                                   const rocsparse_int*            csr_col_ind_A,
+                                   const rocsparse_mat_descr       descr_P,
+                                   rocsparse_int                   nnz_P,
+                                   const rocsparse_double_complex* csr_val_P,
+                                   const rocsparse_int*            csr_row_ptr_P,
+                                   const rocsparse_int*            csr_col_ind_P,
+                                   const rocsparse_mat_descr       descr_C,
+                                   rocsparse_double_complex*       csr_val_C,
+                                   const rocsparse_int*            csr_row_ptr_C,
+                                   rocsparse_int*                  csr_col_ind_C);
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ROCSPARSE_CSRRAP_H */
@@ -60,7 +60,9 @@ extern "C" {
 *  @param[in]
 *  mat         matrix descriptor.
 *  @param[out]
-*  data_status modified to indicate the status of the data
+*  data_status modified to indicate the status of the data. In device data status mode,
+*              see \ref rocsparse_set_data_status_mode, \p data_status is a device
+*              pointer and the host is not blocked. Otherwise, it is a host pointer.
 *  @param[in]
 *  stage       check_matrix stage for the matrix computation.
 *  @param[out]
@@ -0,0 +1,184 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the Software), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCSPARSE_SPGEAM_H
+#define ROCSPARSE_SPGEAM_H
+
+#include "../../rocsparse-types.h"
+#include "rocsparse/rocsparse-export.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! \ingroup generic_module
+*  \brief Sparse matrix sparse matrix addition
+*
+*  \details
+*  \ref rocsparse_spgeam multiplies the scalar \f$\alpha\f$ with the sparse
+*  \f$m \times n\f$ matrix \f$A\f$ and adds it to the sparse \f$m \times n\f$ matrix \f$B\f$
+*  that is multiplied by \f$\beta\f$. The final result is stored in the sparse
+*  \f$m \times n\f$ matrix \f$C\f$, such that
+*  \f[
+*    C := \alpha \cdot op(A) + \beta \cdot op(B),
+*  \f]
+*  with
+*  \f[
+*    op(A) = \left\{
+*    \begin{array}{ll}
+*        A,   & \text{if trans_A == rocsparse_operation_none} \\
+*        A^T, & \text{if trans_A == rocsparse_operation_transpose} \\
+*        A^H, & \text{if trans_A == rocsparse_operation_conjugate_transpose}
+*    \end{array}
+*    \right.
+*  \f]
+*  and
+*  \f[
+*    op(B) = \left\{
+*    \begin{array}{ll}
+*        B,   & \text{if trans_B == rocsparse_operation_none} \\
+*        B^T, & \text{if trans_B == rocsparse_operation_transpose} \\
+*        B^H, & \text{if trans_B == rocsparse_operation_conjugate_transpose}
+*    \end{array}
+*    \right.
+*  \f]
+*
+*  \note SpGEAM requires three stages to complete. The first stage
+*  \ref rocsparse_spgeam_stage_buffer_size will return the size of the temporary storage buffer
+*  that is required for subsequent calls to \ref rocsparse_spgeam. The second stage
+*  \ref rocsparse_spgeam_stage_nnz will determine the row (column for CSC) pointer array and
+*  the number of non-zero elements of the resulting \f$C\f$ matrix. In the final stage
+*  \ref rocsparse_spgeam_stage_compute, the column indices and values of \f$C\f$ are computed.
+*  \note The final stage can be split into \ref rocsparse_spgeam_stage_symbolic, which
+*  computes the column indices of \f$C\f$ only, and \ref rocsparse_spgeam_stage_numeric, which
+*  computes the values of \f$C\f$ only. When the addition is repeated with new values of
+*  \f$A\f$ and \f$B\f$ but the same sparsity patterns, only the numeric stage needs to be
+*  repeated.
+*  \note CSR, CSC and BSR formats are supported. All matrices must have the same format,
+*  index types and, for BSR, the same block dimension and block direction.
+*  \note \f$A\f$, \f$B\f$ and \f$C\f$ must have sorted column (row for CSC) indices.
+*  \note The number of non-zero entries of \f$C\f$ is copied to the host during the
+*  \ref rocsparse_spgeam_stage_nnz stage.
+*  \note Currently, only \p trans_A == \ref rocsparse_operation_none is supported.
+*  \note Currently, only \p trans_B == \ref rocsparse_operation_none is supported.
+*  \note This function is non blocking and executed asynchronously with respect to the
+*        host, except for the \ref rocsparse_spgeam_stage_nnz stage.
+*
+*  \note
+*  This routine does not support execution in a hipGraph context.
+*
+*  @param[in]
+*  handle       handle to the rocsparse library context queue.
+*  @param[in]
+*  trans_A      sparse matrix \f$A\f$ operation type.
+*  @param[in]
+*  trans_B      sparse matrix \f$B\f$ operation type.
+*  @param[in]
+*  alpha        scalar \f$\alpha\f$.
+*  @param[in]
+*  A            sparse matrix \f$A\f$ descriptor.
+*  @param[in]
+*  beta         scalar \f$\beta\f$.
+*  @param[in]
+*  B            sparse matrix \f$B\f$ descriptor.
+*  @param[out]
+*  C            sparse matrix \f$C\f$ descriptor.
+*  @param[in]
+*  compute_type floating point precision for the SpGEAM computation.
+*  @param[in]
+*  alg          SpGEAM algorithm for the SpGEAM computation.
+*  @param[in]
+*  stage        SpGEAM stage for the SpGEAM computation.
+*  @param[out]
+*  buffer_size  number of bytes of the temporary storage buffer. buffer_size is set when
+*               \p stage is \ref rocsparse_spgeam_stage_buffer_size.
+*  @param[in]
+*  temp_buffer  temporary storage buffer allocated by the user, used by the
+*               \ref rocsparse_spgeam_stage_nnz stage.
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_pointer \p alpha, \p beta, \p A, \p B, \p C,
+*          \p buffer_size or \p temp_buffer pointer is invalid.
+*  \retval rocsparse_status_invalid_size the dimensions of \f$A\f$, \f$B\f$ and \f$C\f$
+*          do not match.
+*  \retval rocsparse_status_not_implemented
+*          \p trans_A != \ref rocsparse_operation_none,
+*          \p trans_B != \ref rocsparse_operation_none, the matrix format is not supported
+*          or the block dimensions of \f$A\f$, \f$B\f$ and \f$C\f$ differ.
+*
+*  \par Example
+*  \code{.c}
+*   // Sparsity pattern of C
+*   rocsparse_spgeam(handle, trans_A, trans_B, &alpha, matA, &beta, matB, matC, ttype,
+*                    rocsparse_spgeam_alg_default, rocsparse_spgeam_stage_buffer_size,
+*                    &buffer_size, nullptr);
+*   hipMalloc(&temp_buffer, buffer_size);
+*   rocsparse_spgeam(handle, trans_A, trans_B, &alpha, matA, &beta, matB, matC, ttype,
+*                    rocsparse_spgeam_alg_default, rocsparse_spgeam_stage_nnz,
+*                    &buffer_size, temp_buffer);
+*
+*   // Allocate the column indices and values of C
+*   int64_t rows_C, cols_C, nnz_C;
+*   rocsparse_spmat_get_size(matC, &rows_C, &cols_C, &nnz_C);
+*   hipMalloc(&dcsr_col_ind_C, sizeof(int) * nnz_C);
+*   hipMalloc(&dcsr_val_C, sizeof(float) * nnz_C);
+*   rocsparse_csr_set_pointers(matC, dcsr_row_ptr_C, dcsr_col_ind_C, dcsr_val_C);
+*
+*   // Column indices of C, computed once
+*   rocsparse_spgeam(handle, trans_A, trans_B, &alpha, matA, &beta, matB, matC, ttype,
+*                    rocsparse_spgeam_alg_default, rocsparse_spgeam_stage_symbolic,
+*                    &buffer_size, temp_buffer);
+*
+*   for(int iter = 0; iter < 10; ++iter)
+*   {
+*       // Update the values of A and B ...
+*
+*       // Values of C
+*       rocsparse_spgeam(handle, trans_A, trans_B, &alpha, matA, &beta, matB, matC, ttype,
+*                        rocsparse_spgeam_alg_default, rocsparse_spgeam_stage_numeric,
+*                        &buffer_size, temp_buffer);
+*   }
+*  \endcode
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_spgeam(rocsparse_handle            handle,
+                                  rocsparse_operation         trans_A,
+                                  rocsparse_operation         trans_B,
+                                  const void*                 alpha,
+                                  rocsparse_const_spmat_descr A,
+                                  const void*                 beta,
+                                  rocsparse_const_spmat_descr B,
+                                  rocsparse_spmat_descr       C,
+                                  rocsparse_datatype          compute_type,
+                                  rocsparse_spgeam_alg        alg,
+                                  rocsparse_spgeam_stage      stage,
+                                  size_t*                     buffer_size,
+                                  void*                       temp_buffer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ROCSPARSE_SPGEAM_H
@@ -339,6 +339,204 @@ rocsparse_status rocsparse_spgemm(rocsparse_handle            handle,
                                   size_t*                     buffer_size,
                                   void*                       temp_buffer);
 
+/*! \ingroup generic_module
+*  \brief Masked sparse matrix sparse matrix multiplication
+*
+*  \details
+*  \ref rocsparse_spgemm_masked multiplies the scalar \f$\alpha\f$ with the sparse
+*  \f$m \times k\f$ matrix \f$A\f$ and the sparse \f$k \times n\f$ matrix \f$B\f$ and keeps
+*  only the entries selected by the sparsity pattern of the sparse \f$m \times n\f$ mask
+*  matrix \f$M\f$. The result is stored in the sparse \f$m \times n\f$ matrix \f$C\f$, such that
+*  \f[
+*    C := \left(\alpha \cdot op(A) \cdot op(B)\right) \circ S,
+*  \f]
+*  where \f$s_{ij} = 1\f$ if \f$(i, j)\f$ is part of the sparsity pattern of \f$M\f$ and
+*  \f$s_{ij} = 0\f$ otherwise. If \p mask is \ref rocsparse_spgemm_mask_complement, then
+*  \f$S\f$ is replaced by its complement \f$1 - S\f$.
+*
+*  Intermediate products outside of the selected entries are never accumulated, and with
+*  \ref rocsparse_spgemm_mask_structure, columns beyond the last mask entry of a row are not
+*  visited. This is significantly cheaper than computing the full product with
+*  \ref rocsparse_spgemm and pruning it afterwards, e.g. for triangle counting, k-truss or
+*  Jaccard similarity, where the mask is \f$A\f$ or its lower triangular part.
+*
+*  \note
+*  The values of \f$M\f$ are not accessed.
+*  \note
+*  This function does not produce deterministic results.
+*  \note Masked SpGEMM requires three stages to complete. The first stage
+*  \ref rocsparse_spgemm_stage_buffer_size will return the size of the temporary storage buffer
+*  that is required for subsequent calls to \ref rocsparse_spgemm_masked. The second stage
+*  \ref rocsparse_spgemm_stage_nnz will determine the number of non-zero elements and the row
+*  pointers of the resulting \f$C\f$ matrix. In the final stage
+*  \ref rocsparse_spgemm_stage_compute, the column indices and values of \f$C\f$ are computed.
+*  \note The \ref rocsparse_spgemm_stage_symbolic and \ref rocsparse_spgemm_stage_numeric
+*  stages are not supported.
+*  \note Currently only the CSR format is supported.
+*  \note Currently, only \p trans_A == \p trans_B == \ref rocsparse_operation_none is
+*  supported.
+*  \note The columns of \f$B\f$ and \f$M\f$ need to be sorted. The columns of \f$C\f$ are
+*  sorted.
+*  \note The \ref rocsparse_spgemm_stage_nnz stage is blocking with respect to the host. The
+*  other stages are non blocking and executed asynchronously with respect to the host.
+*
+*  \note
+*  This routine does not support execution in a hipGraph context.
+*
+*  @param[in]
+*  handle       handle to the rocsparse library context queue.
+*  @param[in]
+*  trans_A      sparse matrix \f$A\f$ operation type.
+*  @param[in]
+*  trans_B      sparse matrix \f$B\f$ operation type.
+*  @param[in]
+*  alpha        scalar \f$\alpha\f$.
+*  @param[in]
+*  A            sparse matrix \f$A\f$ descriptor.
+*  @param[in]
+*  B            sparse matrix \f$B\f$ descriptor.
+*  @param[in]
+*  M            sparse mask matrix \f$M\f$ descriptor.
+*  @param[in]
+*  mask         \ref rocsparse_spgemm_mask_structure or
+*               \ref rocsparse_spgemm_mask_complement.
+*  @param[out]
+*  C            sparse matrix \f$C\f$ descriptor.
+*  @param[in]
+*  compute_type floating point precision for the SpGEMM computation.
+*  @param[in]
+*  alg          SpGEMM algorithm for the SpGEMM computation.
+*  @param[in]
+*  stage        SpGEMM stage for the SpGEMM computation.
+*  @param[out]
+*  buffer_size  number of bytes of the temporary storage buffer. buffer_size is set when
+*               \p stage is \ref rocsparse_spgemm_stage_buffer_size.
+*  @param[in]
+*  temp_buffer  temporary storage buffer allocated by the user.
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_pointer \p alpha, \p A, \p B, \p M, \p C or
+*          \p buffer_size pointer is invalid.
+*  \retval rocsparse_status_invalid_size the sizes of \p A, \p B and \p M do not match.
+*  \retval rocsparse_status_invalid_value \p mask, \p stage or \p alg is invalid.
+*  \retval rocsparse_status_requires_sorted_storage \p B or \p M is unsorted.
+*  \retval rocsparse_status_not_implemented
+*          \p trans_A != \ref rocsparse_operation_none,
+*          \p trans_B != \ref rocsparse_operation_none or the format is not CSR.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_spgemm_masked(rocsparse_handle            handle,
+                                         rocsparse_operation         trans_A,
+                                         rocsparse_operation         trans_B,
+                                         const void*                 alpha,
+                                         rocsparse_const_spmat_descr A,
+                                         rocsparse_const_spmat_descr B,
+                                         rocsparse_const_spmat_descr M,
+                                         rocsparse_spgemm_mask       mask,
+                                         rocsparse_spmat_descr       C,
+                                         rocsparse_datatype          compute_type,
+                                         rocsparse_spgemm_alg        alg,
+                                         rocsparse_spgemm_stage      stage,
+                                         size_t*                     buffer_size,
+                                         void*                       temp_buffer);
+
+/*! \ingroup generic_module
+*  \brief Sparse matrix sparse matrix multiplication over a semiring
+*
+*  \details
+*  \ref rocsparse_spgemm_semiring multiplies the scalar \f$\alpha\f$ with the sparse
+*  \f$m \times k\f$ matrix \f$A\f$ and the sparse \f$k \times n\f$ matrix \f$B\f$ and combines
+*  the result with the sparse \f$m \times n\f$ matrix \f$D\f$ that is multiplied by the
+*  scalar \f$\beta\f$, where addition and multiplication are replaced by the reduction
+*  \f$\oplus\f$ and the product \f$\otimes\f$ of \p semiring, such that
+*  \f[
+*    c_{ij} := \alpha \otimes \left(\bigoplus_{l} a_{il} \otimes b_{lj}\right) \oplus
+*              \left(\beta \otimes d_{ij}\right).
+*  \f]
+*  Only the explicitly stored entries of \f$A\f$, \f$B\f$ and \f$D\f$ take part in the
+*  reduction and the sparsity pattern of \f$C\f$ is the same as for \ref rocsparse_spgemm.
+*  If \p alpha is nullptr, the product term is omitted and if \p beta is nullptr, the
+*  \f$D\f$ term is omitted.
+*
+*  \note SpGEMM over a semiring requires three stages to complete. The first stage
+*  \ref rocsparse_spgemm_stage_buffer_size will return the size of the temporary storage
+*  buffer that is required for subsequent calls to \ref rocsparse_spgemm_semiring. The
+*  second stage \ref rocsparse_spgemm_stage_nnz will determine the number of non-zero
+*  elements and the row pointers of the resulting \f$C\f$ matrix. In the final stage
+*  \ref rocsparse_spgemm_stage_compute, the column indices and values of \f$C\f$ are
+*  computed.
+*  \note The \ref rocsparse_spgemm_stage_symbolic and \ref rocsparse_spgemm_stage_numeric
+*  stages are not supported.
+*  \note Currently, only the CSR format, \p trans_A == \p trans_B ==
+*  \ref rocsparse_operation_none, general matrices and real precisions are supported.
+*  \note The \ref rocsparse_spgemm_stage_nnz and \ref rocsparse_spgemm_stage_compute stages
+*  are blocking with respect to the host.
+*  \note
+*  This function does not produce deterministic results.
+*  \note
+*  This routine does not support execution in a hipGraph context.
+*
+*  @param[in]
+*  handle       handle to the rocsparse library context queue.
+*  @param[in]
+*  trans_A      sparse matrix \f$A\f$ operation type.
+*  @param[in]
+*  trans_B      sparse matrix \f$B\f$ operation type.
+*  @param[in]
+*  alpha        scalar \f$\alpha\f$.
+*  @param[in]
+*  A            sparse matrix \f$A\f$ descriptor.
+*  @param[in]
+*  B            sparse matrix \f$B\f$ descriptor.
+*  @param[in]
+*  beta         scalar \f$\beta\f$.
+*  @param[in]
+*  D            sparse matrix \f$D\f$ descriptor.
+*  @param[out]
+*  C            sparse matrix \f$C\f$ descriptor.
+*  @param[in]
+*  compute_type floating point precision for the SpGEMM computation.
+*  @param[in]
+*  alg          SpGEMM algorithm for the SpGEMM computation.
+*  @param[in]
+*  semiring     semiring that defines \f$\oplus\f$ and \f$\otimes\f$.
+*  @param[in]
+*  stage        SpGEMM stage for the SpGEMM computation.
+*  @param[out]
+*  buffer_size  number of bytes of the temporary storage buffer. buffer_size is set when
+*               \p stage is \ref rocsparse_spgemm_stage_buffer_size.
+*  @param[in]
+*  temp_buffer  temporary storage buffer allocated by the user.
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_pointer \p A, \p B, \p D, \p C or \p buffer_size
+*          pointer is invalid.
+*  \retval rocsparse_status_invalid_size the sizes of \p A, \p B and \p D do not match.
+*  \retval rocsparse_status_invalid_value \p semiring, \p stage or \p alg is invalid.
+*  \retval rocsparse_status_not_implemented
+*          \p trans_A != \ref rocsparse_operation_none,
+*          \p trans_B != \ref rocsparse_operation_none, \p compute_type or the format is
+*          currently not supported.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_spgemm_semiring(rocsparse_handle            handle,
+                                           rocsparse_operation         trans_A,
+                                           rocsparse_operation         trans_B,
+                                           const void*                 alpha,
+                                           rocsparse_const_spmat_descr A,
+                                           rocsparse_const_spmat_descr B,
+                                           const void*                 beta,
+                                           rocsparse_const_spmat_descr D,
+                                           rocsparse_spmat_descr       C,
+                                           rocsparse_datatype          compute_type,
+                                           rocsparse_spgemm_alg        alg,
+                                           rocsparse_semiring          semiring,
+                                           rocsparse_spgemm_stage      stage,
+                                           size_t*                     buffer_size,
+                                           void*                       temp_buffer);
+
 #ifdef __cplusplus
 }
 #endif
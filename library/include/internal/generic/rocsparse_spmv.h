@@ -64,6 +64,7 @@ extern "C" {
 *  <tr><td>rocsparse_spmv_alg_csr_stream</td>   <td>Yes</td>       <td>No</td>        <td>Is best suited for matrices with all rows having a similar number of non-zeros. Can out perform adaptive and LRB algirthms in certain sparsity patterns. Will perform very poorly if some rows have few non-zeros and some rows have many non-zeros.</td>
 *  <tr><td>rocsparse_spmv_alg_csr_adaptive</td> <td>No</td>        <td>Yes</td>       <td>Generally the fastest algorithm across all matrix sparsity patterns. This includes matrices that have some rows with many non-zeros and some rows with few non-zeros. Requires a lengthy preprocessing that needs to be amortized over many subsequent sparse vector products.</td>
 *  <tr><td>rocsparse_spmv_alg_csr_lrb</td>      <td>No</td>        <td>Yes</td>       <td>Like adaptive algorithm, generally performs well accross all matrix sparsity patterns. Generally not as fast as adaptive algorithm, however uses a much faster pre-processing step. Good for when only a few number of sparse vector products will be performed.</td>
+*  <tr><td>rocsparse_spmv_alg_csr_gather</td>   <td>No</td>        <td>Yes</td>       <td>For transposed and conjugate transposed products of general and triangular CSR matrices (and non-transposed products of CSC matrices), the preprocessing builds the sparsity pattern of the transposed matrix, at the cost of additional device memory of the size of the sparsity pattern. The products are then computed row by row without atomics, which is deterministic. Otherwise identical to the adaptive algorithm.</td>
 *  </table>
 *
 *  <table>
@@ -128,6 +129,23 @@ extern "C" {
 *  <tr><td>rocsparse_datatype_f64_r <td>rocsparse_datatype_f64_c
 *  </table>
 *
+*  \details
+*  \ref rocsparse_spmv also supports batched computation for non-transposed CSR matrices,
+*  where many (typically small) matrices of the same dimensions are multiplied in a single
+*  call. The batch is described by the batch counts and strides of the descriptors, see
+*  rocsparse_csr_set_strided_batch() and rocsparse_dnvec_set_strided_batch(). Three batch
+*  modes are supported:
+*      y_i = A * x_i
+*      y_i = A_i * x
+*      y_i = A_i * x_i
+*  Matrices sharing the same sparsity pattern can pass an offsets batch stride of zero, such
+*  that all batches use the same row offsets array, and a column indices batch stride of
+*  zero with rocsparse_csr_set_columns_batch_stride(), such that all batches use the same
+*  column indices array while their values are strided. The batched computation does not require
+*  any preprocessing and the CSR algorithm passed in \p alg is ignored. Rows of several
+*  matrices are processed by the same thread block, which makes it well suited for large
+*  batches of small matrices.
+*
 *  \note
 *  This function writes the required allocation size (in bytes) to \p buffer_size and
 *  returns without performing the SpMV operation, when a nullptr is passed for
@@ -377,6 +395,7 @@ ROCSPARSE_EXPORT rocsparse_status rocsparse_spmv(rocsparse_handle            han
 *  <tr><td>rocsparse_spmv_alg_csr_stream</td>   <td>Yes</td>       <td>No</td>        <td>Is best suited for matrices with all rows having a similar number of non-zeros. Can out perform adaptive and LRB algirthms in certain sparsity patterns. Will perform very poorly if some rows have few non-zeros and some rows have many non-zeros.</td>
 *  <tr><td>rocsparse_spmv_alg_csr_adaptive</td> <td>No</td>        <td>Yes</td>       <td>Generally the fastest algorithm across all matrix sparsity patterns. This includes matrices that have some rows with many non-zeros and some rows with few non-zeros. Requires a lengthy preprocessing that needs to be amortized over many subsequent sparse vector products.</td>
 *  <tr><td>rocsparse_spmv_alg_csr_lrb</td>      <td>No</td>        <td>Yes</td>       <td>Like adaptive algorithm, generally performs well accross all matrix sparsity patterns. Generally not as fast as adaptive algorithm, however uses a much faster pre-processing step. Good for when only a few number of sparse vector products will be performed.</td>
+*  <tr><td>rocsparse_spmv_alg_csr_gather</td>   <td>No</td>        <td>Yes</td>       <td>For transposed and conjugate transposed products of general and triangular CSR matrices (and non-transposed products of CSC matrices), the preprocessing builds the sparsity pattern of the transposed matrix, at the cost of additional device memory of the size of the sparsity pattern. The products are then computed row by row without atomics, which is deterministic. Otherwise identical to the adaptive algorithm.</td>
 *  </table>
 *
 *  <table>
@@ -515,6 +534,181 @@ __attribute__((deprecated("This function is deprecated and will be removed in a
                       rocsparse_spmv_stage        stage,
                       size_t*                     buffer_size,
                       void*                       temp_buffer);
+
+/*! \ingroup generic_module
+*  \brief Sparse matrix vector multiplication over a semiring
+*
+*  \details
+*  \ref rocsparse_spmv_semiring multiplies the scalar \f$\alpha\f$ with a sparse
+*  \f$m \times n\f$ matrix and the dense vector \f$x\f$ and combines the result with the
+*  dense vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$, where addition and
+*  multiplication are replaced by the reduction \f$\oplus\f$ and the product \f$\otimes\f$
+*  of \p semiring, such that
+*  \f[
+*    y_i := \alpha \otimes \left(\bigoplus_{j} a_{ij} \otimes x_j\right) \oplus
+*           \left(\beta \otimes y_i\right).
+*  \f]
+*  Only the explicitly stored entries of \f$A\f$ take part in the reduction. If \f$\beta\f$
+*  equals the identity of \f$\oplus\f$, \f$y\f$ is not read.
+*
+*  The min-plus semiring computes one relaxation step of a single source shortest path
+*  search, the or-and semiring one step of a breadth first search, such that graph
+*  algorithms can use the tuned CSR kernels of \ref rocsparse_spmv directly.
+*
+*  \note SpMV over a semiring requires three stages to complete. The first stage
+*  \ref rocsparse_spmv_stage_buffer_size will return the size of the temporary storage
+*  buffer that is required for subsequent calls to \ref rocsparse_spmv_semiring. The second
+*  stage \ref rocsparse_spmv_stage_preprocess will analyse the sparsity pattern of
+*  \f$A\f$. In the final stage \ref rocsparse_spmv_stage_compute, the actual computation
+*  is performed.
+*  \note
+*  The \ref rocsparse_spmv_stage_preprocess stage is blocking with respect to the host.
+*  The other stages are non blocking and executed asynchronously with respect to the host.
+*  \note
+*  Currently, only the CSR format with \ref rocsparse_spmv_alg_csr_adaptive or
+*  \ref rocsparse_spmv_alg_csr_lrb, \p trans == \ref rocsparse_operation_none, general or
+*  triangular matrices and real precisions with \p compute_type equal to the data type of
+*  \f$A\f$, \f$x\f$ and \f$y\f$ are supported.
+*  \note
+*  This function does not produce deterministic results.
+*
+*  @param[in]
+*  handle       handle to the rocsparse library context queue.
+*  @param[in]
+*  trans        matrix operation type.
+*  @param[in]
+*  alpha        scalar \f$\alpha\f$.
+*  @param[in]
+*  mat          matrix descriptor.
+*  @param[in]
+*  x            vector descriptor.
+*  @param[in]
+*  beta         scalar \f$\beta\f$.
+*  @param[inout]
+*  y            vector descriptor.
+*  @param[in]
+*  compute_type floating point precision for the SpMV computation.
+*  @param[in]
+*  alg          SpMV algorithm for the SpMV computation.
+*  @param[in]
+*  semiring     semiring that defines \f$\oplus\f$ and \f$\otimes\f$.
+*  @param[in]
+*  stage        SpMV stage for the SpMV computation.
+*  @param[out]
+*  buffer_size  number of bytes of the temporary storage buffer. buffer_size is set when
+*               \p stage is \ref rocsparse_spmv_stage_buffer_size.
+*  @param[in]
+*  temp_buffer  temporary storage buffer allocated by the user.
+*
+*  \retval      rocsparse_status_success the operation completed successfully.
+*  \retval      rocsparse_status_invalid_handle the library context \p handle was not initialized.
+*  \retval      rocsparse_status_invalid_pointer \p alpha, \p mat, \p x, \p beta, \p y or
+*               \p buffer_size pointer is invalid.
+*  \retval      rocsparse_status_invalid_size the sizes of \p mat, \p x and \p y do not match.
+*  \retval      rocsparse_status_invalid_value the value of \p trans, \p compute_type, \p alg,
+*               \p semiring or \p stage is incorrect.
+*  \retval      rocsparse_status_not_implemented \p trans, \p compute_type, \p alg, the
+*               matrix type or the format is currently not supported.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_spmv_semiring(rocsparse_handle            handle,
+                                         rocsparse_operation         trans,
+                                         const void*                 alpha,
+                                         rocsparse_const_spmat_descr mat,
+                                         rocsparse_const_dnvec_descr x,
+                                         const void*                 beta,
+                                         const rocsparse_dnvec_descr y,
+                                         rocsparse_datatype          compute_type,
+                                         rocsparse_spmv_alg          alg,
+                                         rocsparse_semiring          semiring,
+                                         rocsparse_spmv_stage        stage,
+                                         size_t*                     buffer_size,
+                                         void*                       temp_buffer);
+
+/*! \ingroup generic_module
+*  \brief Sparse matrix vector multiplication fused with a dot product
+*
+*  \details
+*  \ref rocsparse_spmv_fused multiplies the scalar \f$\alpha\f$ with a sparse
+*  \f$m \times n\f$ matrix and the dense vector \f$x\f$ and adds the result to the dense
+*  vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$, such that
+*  \f[
+*    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
+*  \f]
+*  and computes, in the same pass over the matrix, the dot product
+*  \f[
+*    result := \left\{
+*    \begin{array}{ll}
+*        x^H \cdot y, & \text{if reduction == rocsparse_spmv_reduction_dot_xy} \\
+*        y^H \cdot y, & \text{if reduction == rocsparse_spmv_reduction_dot_yy}
+*    \end{array}
+*    \right.
+*  \f]
+*  of the updated vector \f$y\f$.
+*
+*  Krylov solvers such as CG or BiCGStab follow each SpMV by a dot product of its output,
+*  e.g. \f$p^H A p\f$ or \f$||r||^2\f$ after \f$r := r - \alpha A p\f$. Fusing both
+*  saves a full read of \f$y\f$ and, with \ref rocsparse_pointer_mode_device, keeps
+*  \p result on the device such that the solver loop does not synchronize with the host.
+*
+*  \note
+*  \p result is a host or device pointer, depending on the pointer mode of \p handle. If
+*  \p result is a host pointer, this function is blocking with respect to the host.
+*  Otherwise, it is non blocking and executed asynchronously with respect to the host.
+*  \note
+*  Currently, only the CSR format with \ref rocsparse_spmv_alg_default or
+*  \ref rocsparse_spmv_alg_csr_stream, \p trans == \ref rocsparse_operation_none and
+*  \p compute_type equal to the data type of \f$A\f$, \f$x\f$ and \f$y\f$ are supported.
+*  \ref rocsparse_spmv_reduction_dot_xy requires \f$m = n\f$.
+*  \note
+*  This function does not require a temporary storage buffer.
+*
+*  @param[in]
+*  handle       handle to the rocsparse library context queue.
+*  @param[in]
+*  trans        matrix operation type.
+*  @param[in]
+*  alpha        scalar \f$\alpha\f$.
+*  @param[in]
+*  mat          matrix descriptor.
+*  @param[in]
+*  x            vector descriptor.
+*  @param[in]
+*  beta         scalar \f$\beta\f$.
+*  @param[inout]
+*  y            vector descriptor.
+*  @param[in]
+*  compute_type floating point precision for the SpMV computation.
+*  @param[in]
+*  alg          SpMV algorithm for the SpMV computation.
+*  @param[in]
+*  reduction    dot product that is computed from the updated vector \f$y\f$.
+*  @param[out]
+*  result       pointer to the dot product, can be in host or device memory.
+*
+*  \retval      rocsparse_status_success the operation completed successfully.
+*  \retval      rocsparse_status_invalid_handle the library context \p handle was not initialized.
+*  \retval      rocsparse_status_invalid_pointer \p alpha, \p mat, \p x, \p beta, \p y or
+*               \p result pointer is invalid.
+*  \retval      rocsparse_status_invalid_size the sizes of \p mat, \p x and \p y do not match.
+*  \retval      rocsparse_status_invalid_value the value of \p trans, \p compute_type, \p alg
+*               or \p reduction is incorrect.
+*  \retval      rocsparse_status_not_implemented \p trans, \p compute_type, \p alg, the
+*               matrix type or the format is currently not supported.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_spmv_fused(rocsparse_handle            handle,
+                                      rocsparse_operation         trans,
+                                      const void*                 alpha,
+                                      rocsparse_const_spmat_descr mat,
+                                      rocsparse_const_dnvec_descr x,
+                                      const void*                 beta,
+                                      const rocsparse_dnvec_descr y,
+                                      rocsparse_datatype          compute_type,
+                                      rocsparse_spmv_alg          alg,
+                                      rocsparse_spmv_reduction    reduction,
+                                      void*                       result);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,374 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCSPARSE_BJAC_H
+#define ROCSPARSE_BJAC_H
+
+#include "../../rocsparse-types.h"
+#include "rocsparse/rocsparse-export.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! \ingroup precond_module
+*  \brief Block-Jacobi preconditioner setup using BSR storage format
+*
+*  \details
+*  \p rocsparse_bsrbjac_setup extracts the \p mb diagonal blocks \f$D_i\f$ of the sparse
+*  \f$m \times m\f$ matrix \f$A\f$, stored in BSR storage format with \f$m = mb \cdot
+*  block\_dim\f$, and computes their inverses \f$D_i^{-1}\f$ by Gauss-Jordan elimination
+*  with partial pivoting. The inverted blocks are stored consecutively in \p inv_diag_val,
+*  each one of them in the layout given by \p dir, and can be applied with
+*  rocsparse_sbjac_apply(), rocsparse_dbjac_apply(), rocsparse_cbjac_apply() or
+*  rocsparse_zbjac_apply().
+*
+*  \p singular_block is set to the index of the first singular diagonal block
+*  (\ref rocsparse_index_base of \p descr) or to -1 if all diagonal blocks could be inverted.
+*  A missing diagonal block is treated as singular. The content of \p inv_diag_val is
+*  undefined for singular blocks. \p singular_block can be in host or device memory,
+*  depending on the \ref rocsparse_pointer_mode of the handle.
+*
+*  \note
+*  Only block dimensions up to 32 are supported.
+*
+*  \note
+*  This function is blocking with respect to the host if \p singular_block is in host memory.
+*
+*  \note
+*  This routine supports execution in a hipGraph context only when \ref
+*  rocsparse_pointer_mode_device is used.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  dir             direction that specifies whether the blocks of the BSR matrix and of
+*                  \p inv_diag_val are stored by \ref rocsparse_direction_row or by
+*                  \ref rocsparse_direction_column.
+*  @param[in]
+*  mb              number of block rows and block columns of the sparse BSR matrix.
+*  @param[in]
+*  nnzb            number of non-zero blocks of the sparse BSR matrix.
+*  @param[in]
+*  descr           descriptor of the sparse BSR matrix. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  bsr_val         array of \p nnzb*block_dim*block_dim elements of the sparse BSR matrix.
+*  @param[in]
+*  bsr_row_ptr     array of \p mb+1 elements that point to the start of every block row of
+*                  the sparse BSR matrix.
+*  @param[in]
+*  bsr_col_ind     array of \p nnzb elements containing the block column indices of the
+*                  sparse BSR matrix.
+*  @param[in]
+*  block_dim       block dimension of the sparse BSR matrix (between 1 and 32).
+*  @param[out]
+*  inv_diag_val    array of \p mb*block_dim*block_dim elements containing the inverted
+*                  diagonal blocks.
+*  @param[out]
+*  singular_block  index of the first singular diagonal block or -1.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p mb, \p nnzb or \p block_dim is invalid.
+*  \retval     rocsparse_status_invalid_value \p dir is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p bsr_val, \p bsr_row_ptr,
+*              \p bsr_col_ind, \p inv_diag_val or \p singular_block pointer is invalid.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general or
+*              \p block_dim is larger than 32.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sbsrbjac_setup(rocsparse_handle          handle,
+                                          rocsparse_direction       dir,
+                                          rocsparse_int             mb,
+                                          rocsparse_int             nnzb,
+                                          const rocsparse_mat_descr descr,
+                                          const float*              bsr_val,
+                                          const rocsparse_int*      bsr_row_ptr,
+                                          const rocsparse_int*      bsr_col_ind,
+                                          rocsparse_int             block_dim,
+                                          float*                    inv_diag_val,
+                                          rocsparse_int*            singular_block);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dbsrbjac_setup(rocsparse_handle          handle,
+                                          rocsparse_direction       dir,
+                                          rocsparse_int             mb,
+                                          rocsparse_int             nnzb,
+                                          const rocsparse_mat_descr descr,
+                                          const double*             bsr_val,
+                                          const rocsparse_int*      bsr_row_ptr,
+                                          const rocsparse_int*      bsr_col_ind,
+                                          rocsparse_int             block_dim,
+                                          double*                   inv_diag_val,
+                                          rocsparse_int*            singular_block);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cbsrbjac_setup(rocsparse_handle               handle,
+                                          rocsparse_direction            dir,
+                                          rocsparse_int                  mb,
+                                          rocsparse_int                  nnzb,
+                                          const rocsparse_mat_descr      descr,
+                                          const rocsparse_float_complex* bsr_val,
+                                          const rocsparse_int*           bsr_row_ptr,
+                                          const rocsparse_int*           bsr_col_ind,
+                                          rocsparse_int                  block_dim,
+                                          rocsparse_float_complex*       inv_diag_val,
+                                          rocsparse_int*                 singular_block);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zbsrbjac_setup(rocsparse_handle                handle,
+                                          rocsparse_direction             dir,
+                                          rocsparse_int                   mb,
+                                          rocsparse_int                   nnzb,
+                                          const rocsparse_mat_descr       descr,
+                                          const rocsparse_double_complex* bsr_val,
+                                          const rocsparse_int*            bsr_row_ptr,
+                                          const rocsparse_int*            bsr_col_ind,
+                                          rocsparse_int                   block_dim,
+                                          rocsparse_double_complex*       inv_diag_val,
+                                          rocsparse_int*                  singular_block);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Block-Jacobi preconditioner setup using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrbjac_setup extracts the \f$mb = \lceil m / block\_dim \rceil\f$
+*  diagonal blocks \f$D_i\f$ of size \p block_dim of the sparse \f$m \times m\f$ matrix
+*  \f$A\f$, stored in CSR storage format, and computes their inverses \f$D_i^{-1}\f$ by
+*  Gauss-Jordan elimination with partial pivoting. If \p m is not a multiple of
+*  \p block_dim, the last diagonal block is padded with the identity. The inverted blocks
+*  are stored consecutively in \p inv_diag_val, each one of them in the layout given by
+*  \p dir, and can be applied with rocsparse_sbjac_apply(), rocsparse_dbjac_apply(),
+*  rocsparse_cbjac_apply() or rocsparse_zbjac_apply().
+*
+*  \p singular_block is set to the index of the first singular diagonal block
+*  (\ref rocsparse_index_base of \p descr) or to -1 if all diagonal blocks could be inverted.
+*  The content of \p inv_diag_val is undefined for singular blocks. \p singular_block can be
+*  in host or device memory, depending on the \ref rocsparse_pointer_mode of the handle.
+*
+*  \note
+*  Only block dimensions up to 32 are supported.
+*
+*  \note
+*  This function is blocking with respect to the host if \p singular_block is in host memory.
+*
+*  \note
+*  This routine supports execution in a hipGraph context only when \ref
+*  rocsparse_pointer_mode_device is used.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  dir             direction that specifies whether the blocks of \p inv_diag_val are stored
+*                  by \ref rocsparse_direction_row or by \ref rocsparse_direction_column.
+*  @param[in]
+*  m               number of rows and columns of the sparse CSR matrix.
+*  @param[in]
+*  nnz             number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr           descriptor of the sparse CSR matrix. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  csr_val         array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind     array of \p nnz elements containing the column indices of the sparse
+*                  CSR matrix.
+*  @param[in]
+*  block_dim       dimension of the diagonal blocks (between 1 and 32).
+*  @param[out]
+*  inv_diag_val    array of \p mb*block_dim*block_dim elements containing the inverted
+*                  diagonal blocks.
+*  @param[out]
+*  singular_block  index of the first singular diagonal block or -1.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p block_dim is invalid.
+*  \retval     rocsparse_status_invalid_value \p dir is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p inv_diag_val or \p singular_block pointer is invalid.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general or
+*              \p block_dim is larger than 32.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrbjac_setup(rocsparse_handle          handle,
+                                          rocsparse_direction       dir,
+                                          rocsparse_int             m,
+                                          rocsparse_int             nnz,
+                                          const rocsparse_mat_descr descr,
+                                          const float*              csr_val,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          const rocsparse_int*      csr_col_ind,
+                                          rocsparse_int             block_dim,
+                                          float*                    inv_diag_val,
+                                          rocsparse_int*            singular_block);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrbjac_setup(rocsparse_handle          handle,
+                                          rocsparse_direction       dir,
+                                          rocsparse_int             m,
+                                          rocsparse_int             nnz,
+                                          const rocsparse_mat_descr descr,
+                                          const double*             csr_val,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          const rocsparse_int*      csr_col_ind,
+                                          rocsparse_int             block_dim,
+                                          double*                   inv_diag_val,
+                                          rocsparse_int*            singular_block);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrbjac_setup(rocsparse_handle               handle,
+                                          rocsparse_direction            dir,
+                                          rocsparse_int                  m,
+                                          rocsparse_int                  nnz,
+                                          const rocsparse_mat_descr      descr,
+                                          const rocsparse_float_complex* csr_val,
+                                          const rocsparse_int*           csr_row_ptr,
+                                          const rocsparse_int*           csr_col_ind,
+                                          rocsparse_int                  block_dim,
+                                          rocsparse_float_complex*       inv_diag_val,
+                                          rocsparse_int*                 singular_block);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrbjac_setup(rocsparse_handle                handle,
+                                          rocsparse_direction             dir,
+                                          rocsparse_int                   m,
+                                          rocsparse_int                   nnz,
+                                          const rocsparse_mat_descr       descr,
+                                          const rocsparse_double_complex* csr_val,
+                                          const rocsparse_int*            csr_row_ptr,
+                                          const rocsparse_int*            csr_col_ind,
+                                          rocsparse_int                   block_dim,
+                                          rocsparse_double_complex*       inv_diag_val,
+                                          rocsparse_int*                  singular_block);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Block-Jacobi preconditioner application
+*
+*  \details
+*  \p rocsparse_bjac_apply applies the inverted diagonal blocks computed by
+*  rocsparse_sbsrbjac_setup(), rocsparse_scsrbjac_setup() or their double and complex
+*  counterparts, such that
+*  \f[
+*    y := \alpha \cdot D^{-1} \cdot x + \beta \cdot y,
+*  \f]
+*  with \f$D = \mathrm{diag}(D_0, \ldots, D_{mb-1})\f$. All block products are computed by
+*  a single fused kernel.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  \note
+*  This routine supports execution in a hipGraph context.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  dir             storage layout of the blocks in \p inv_diag_val, either
+*                  \ref rocsparse_direction_row or \ref rocsparse_direction_column.
+*  @param[in]
+*  m               number of rows of the preconditioner, i.e. size of \p x and \p y.
+*  @param[in]
+*  block_dim       dimension of the diagonal blocks (between 1 and 32).
+*  @param[in]
+*  alpha           scalar \f$\alpha\f$.
+*  @param[in]
+*  inv_diag_val    array of \f$\lceil m / block\_dim \rceil\f$*block_dim*block_dim elements
+*                  containing the inverted diagonal blocks.
+*  @param[in]
+*  x               array of \p m elements (\f$x\f$).
+*  @param[in]
+*  beta            scalar \f$\beta\f$.
+*  @param[inout]
+*  y               array of \p m elements (\f$y\f$).
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p block_dim is invalid.
+*  \retval     rocsparse_status_invalid_value \p dir is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p alpha, \p inv_diag_val, \p x,
+*              \p beta or \p y pointer is invalid.
+*  \retval     rocsparse_status_not_implemented \p block_dim is larger than 32.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sbjac_apply(rocsparse_handle    handle,
+                                       rocsparse_direction dir,
+                                       rocsparse_int       m,
+                                       rocsparse_int       block_dim,
+                                       const float*        alpha,
+                                       const float*        inv_diag_val,
+                                       const float*        x,
+                                       const float*        beta,
+                                       float*              y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dbjac_apply(rocsparse_handle    handle,
+                                       rocsparse_direction dir,
+                                       rocsparse_int       m,
+                                       rocsparse_int       block_dim,
+                                       const double*       alpha,
+                                       const double*       inv_diag_val,
+                                       const double*       x,
+                                       const double*       beta,
+                                       double*             y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cbjac_apply(rocsparse_handle               handle,
+                                       rocsparse_direction            dir,
+                                       rocsparse_int                  m,
+                                       rocsparse_int                  block_dim,
+                                       const rocsparse_float_complex* alpha,
+                                       const rocsparse_float_complex* inv_diag_val,
+                                       const rocsparse_float_complex* x,
+                                       const rocsparse_float_complex* beta,
+                                       rocsparse_float_complex*       y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zbjac_apply(rocsparse_handle                handle,
+                                       rocsparse_direction             dir,
+                                       rocsparse_int                   m,
+                                       rocsparse_int                   block_dim,
+                                       const rocsparse_double_complex* alpha,
+                                       const rocsparse_double_complex* inv_diag_val,
+                                       const rocsparse_double_complex* x,
+                                       const rocsparse_double_complex* beta,
+                                       rocsparse_double_complex*       y);
+/**@}*/
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ROCSPARSE_BJAC_H */
@@ -814,6 +814,216 @@ rocsparse_status rocsparse_zcsrilu0(rocsparse_handle          handle,
                                     void*                     temp_buffer);
 /**@}*/
 
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csrilu0_refactorize_batched_buffer_size returns the size of the temporary
+*  storage buffer that is required by rocsparse_scsrilu0_refactorize_batched(),
+*  rocsparse_dcsrilu0_refactorize_batched(), rocsparse_ccsrilu0_refactorize_batched() and
+*  rocsparse_zcsrilu0_refactorize_batched(). The size depends on the analysis meta data
+*  stored in \p info and on \p batch_count.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  \note
+*  This routine supports execution in a hipGraph context.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[in]
+*  batch_count number of matrices that are refactorized.
+*  @param[out]
+*  buffer_size number of bytes of the temporary storage buffer.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p batch_count is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p info or \p buffer_size pointer is
+*              invalid, or no analysis meta data is available in \p info.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrilu0_refactorize_batched_buffer_size(rocsparse_handle   handle,
+                                                                   rocsparse_mat_info info,
+                                                                   rocsparse_int      batch_count,
+                                                                   size_t*            buffer_size);
+
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csrilu0_refactorize computes the incomplete LU factorization with 0
+*  fill-ins and no pivoting of a sparse \f$m \times m\f$ CSR matrix \f$A\f$, whose
+*  sparsity pattern has already been processed by rocsparse_scsrilu0_analysis(). Only the
+*  new matrix values are passed. The sparsity pattern, the level schedule and the
+*  diagonal positions are all taken from \p info. The arrays \p csr_row_ptr and
+*  \p csr_col_ind that were passed to the analysis must therefore remain valid and
+*  unchanged. Meta data that the analysis has shared with a transposed triangular solve
+*  only holds the transposed sparsity pattern and cannot be refactorized.
+*
+*  This is intended for repeated factorizations of matrices with a fixed sparsity
+*  pattern, e.g. in transient simulations. Numeric boost settings, if any, are applied
+*  as configured during the last call to rocsparse_scsrilu0_numeric_boost().
+*  The zero pivot status can be obtained by calling rocsparse_csrilu0_zero_pivot().
+*
+*  \p rocsparse_csrilu0_refactorize uses the same temporary buffer as
+*  rocsparse_scsrilu0().
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  \note
+*  This routine supports execution in a hipGraph context.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[inout]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p info or
+*              \p temp_buffer pointer is invalid, or no analysis meta data is available.
+*  \retval     rocsparse_status_arch_mismatch the device is not supported.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general, or the
+*              meta data has been shared with a transposed triangular solve.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilu0_refactorize(rocsparse_handle          handle,
+                                                const rocsparse_mat_descr descr,
+                                                float*                    csr_val,
+                                                rocsparse_mat_info        info,
+                                                void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilu0_refactorize(rocsparse_handle          handle,
+                                                const rocsparse_mat_descr descr,
+                                                double*                   csr_val,
+                                                rocsparse_mat_info        info,
+                                                void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrilu0_refactorize(rocsparse_handle          handle,
+                                                const rocsparse_mat_descr descr,
+                                                rocsparse_float_complex*  csr_val,
+                                                rocsparse_mat_info        info,
+                                                void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrilu0_refactorize(rocsparse_handle          handle,
+                                                const rocsparse_mat_descr descr,
+                                                rocsparse_double_complex* csr_val,
+                                                rocsparse_mat_info        info,
+                                                void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csrilu0_refactorize_batched computes the incomplete LU factorization with
+*  0 fill-ins and no pivoting of \p batch_count sparse \f$m \times m\f$ CSR matrices that
+*  all share the sparsity pattern processed by rocsparse_scsrilu0_analysis(). The values
+*  of the \f$i\f$-th matrix start at \p csr_val + \f$i \cdot\f$ \p batch_stride. All
+*  matrices are factorized in a single kernel launch, reusing the symbolic data stored in
+*  \p info in the same way as rocsparse_scsrilu0_refactorize().
+*
+*  \p rocsparse_csrilu0_refactorize_batched requires a user allocated temporary buffer.
+*  Its size is returned by rocsparse_csrilu0_refactorize_batched_buffer_size(). If a zero
+*  pivot is found in any of the matrices, the smallest one is reported by
+*  rocsparse_csrilu0_zero_pivot().
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  \note
+*  This routine supports execution in a hipGraph context.
+*
+*  @param[in]
+*  handle       handle to the rocsparse library context queue.
+*  @param[in]
+*  descr        descriptor of the sparse CSR matrices.
+*  @param[in]
+*  batch_count  number of matrices.
+*  @param[inout]
+*  csr_val      array of \p batch_count \f$\times\f$ \p batch_stride elements holding
+*               the values of all sparse CSR matrices.
+*  @param[in]
+*  batch_stride distance between the values of consecutive matrices. Must be at least
+*               \p nnz if \p batch_count > 1.
+*  @param[in]
+*  info         structure that holds the information collected during the analysis step.
+*  @param[in]
+*  temp_buffer  temporary storage buffer allocated by the user.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p batch_count or \p batch_stride is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p info or
+*              \p temp_buffer pointer is invalid, or no analysis meta data is available.
+*  \retval     rocsparse_status_arch_mismatch the device is not supported.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general, or the
+*              meta data has been shared with a transposed triangular solve.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilu0_refactorize_batched(rocsparse_handle          handle,
+                                                        const rocsparse_mat_descr descr,
+                                                        rocsparse_int             batch_count,
+                                                        float*                    csr_val,
+                                                        rocsparse_int             batch_stride,
+                                                        rocsparse_mat_info        info,
+                                                        void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilu0_refactorize_batched(rocsparse_handle          handle,
+                                                        const rocsparse_mat_descr descr,
+                                                        rocsparse_int             batch_count,
+                                                        double*                   csr_val,
+                                                        rocsparse_int             batch_stride,
+                                                        rocsparse_mat_info        info,
+                                                        void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrilu0_refactorize_batched(rocsparse_handle          handle,
+                                                        const rocsparse_mat_descr descr,
+                                                        rocsparse_int             batch_count,
+                                                        rocsparse_float_complex*  csr_val,
+                                                        rocsparse_int             batch_stride,
+                                                        rocsparse_mat_info        info,
+                                                        void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrilu0_refactorize_batched(rocsparse_handle          handle,
+                                                        const rocsparse_mat_descr descr,
+                                                        rocsparse_int             batch_count,
+                                                        rocsparse_double_complex* csr_val,
+                                                        rocsparse_int             batch_stride,
+                                                        rocsparse_mat_info        info,
+                                                        void*                     temp_buffer);
+/**@}*/
+
 #ifdef __cplusplus
 }
 #endif
@@ -559,6 +559,191 @@ rocsparse_status rocsparse_zgtsv_no_pivot_strided_batch(rocsparse_handle
                                                         void*         temp_buffer);
 /**@}*/
 
+/*! \ingroup precond_module
+*  \brief Strided Batch tridiagonal solver
+*
+*  \details
+*  \p rocsparse_gtsv_strided_batch_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_sgtsv_strided_batch(), rocsparse_dgtsv_strided_batch(),
+*  rocsparse_cgtsv_strided_batch() and rocsparse_zgtsv_strided_batch(). The temporary
+*  storage buffer must be allocated by the user.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  \note
+*  This routine supports execution in a hipGraph context.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           size of the tri-diagonal linear system (must be >= 2).
+*  @param[in]
+*  dl          lower diagonal of tri-diagonal system where the ith system lower diagonal starts at \p dl+batch_stride*i.
+*              First entry of each system must be zero.
+*  @param[in]
+*  d           main diagonal of tri-diagonal system where the ith system diagonal starts at \p d+batch_stride*i.
+*  @param[in]
+*  du          upper diagonal of tri-diagonal system where the ith system upper diagonal starts at \p du+batch_stride*i.
+*              Last entry of each system must be zero.
+*  @param[in]
+*  x           Dense array of righthand-sides where the ith righthand-side starts at \p x+batch_stride*i.
+*  @param[in]
+*  batch_count The number of systems to solve.
+*  @param[in]
+*  batch_stride The number of elements that separate each system. Must satisfy \p batch_stride >= m.
+*  @param[out]
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_sgtsv_strided_batch(), rocsparse_dgtsv_strided_batch(), rocsparse_cgtsv_strided_batch()
+*              and rocsparse_zgtsv_strided_batch().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p batch_count or \p batch_stride is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p dl, \p d, \p du,
+*              \p x or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sgtsv_strided_batch_buffer_size(rocsparse_handle handle,
+                                                           rocsparse_int    m,
+                                                           const float*     dl,
+                                                           const float*     d,
+                                                           const float*     du,
+                                                           const float*     x,
+                                                           rocsparse_int    batch_count,
+                                                           rocsparse_int    batch_stride,
+                                                           size_t*          buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dgtsv_strided_batch_buffer_size(rocsparse_handle handle,
+                                                           rocsparse_int    m,
+                                                           const double*    dl,
+                                                           const double*    d,
+                                                           const double*    du,
+                                                           const double*    x,
+                                                           rocsparse_int    batch_count,
+                                                           rocsparse_int    batch_stride,
+                                                           size_t*          buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status
+    rocsparse_cgtsv_strided_batch_buffer_size(rocsparse_handle               handle,
+                                              rocsparse_int                  m,
+                                              const rocsparse_float_complex* dl,
+                                              const rocsparse_float_complex* d,
+                                              const rocsparse_float_complex* du,
+                                              const rocsparse_float_complex* x,
+                                              rocsparse_int                  batch_count,
+                                              rocsparse_int                  batch_stride,
+                                              size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status
+    rocsparse_zgtsv_strided_batch_buffer_size(rocsparse_handle                handle,
+                                              rocsparse_int                   m,
+                                              const rocsparse_double_complex* dl,
+                                              const rocsparse_double_complex* d,
+                                              const rocsparse_double_complex* du,
+                                              const rocsparse_double_complex* x,
+                                              rocsparse_int                   batch_count,
+                                              rocsparse_int                   batch_stride,
+                                              size_t*                         buffer_size);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Strided Batch tridiagonal solver
+*
+*  \details
+*  \p rocsparse_gtsv_strided_batch solves a batched tridiagonal linear system, where the systems are
+*  stored contiguously with a fixed stride. Each system is first tested for diagonal dominance.
+*  Diagonally dominant systems are solved using a combination of cyclic reduction and parallel cyclic
+*  reduction, as in rocsparse_sgtsv_no_pivot_strided_batch(). All remaining systems are solved using
+*  LU factorization with partial pivoting.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  \note
+*  This routine supports execution in a hipGraph context.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           size of the tri-diagonal linear system (must be >= 2).
+*  @param[in]
+*  dl          lower diagonal of tri-diagonal system where the ith system lower diagonal starts at \p dl+batch_stride*i.
+*              First entry of each system must be zero.
+*  @param[in]
+*  d           main diagonal of tri-diagonal system where the ith system diagonal starts at \p d+batch_stride*i.
+*  @param[in]
+*  du          upper diagonal of tri-diagonal system where the ith system upper diagonal starts at \p du+batch_stride*i.
+*              Last entry of each system must be zero.
+*  @param[inout]
+*  x           Dense array of righthand-sides where the ith righthand-side starts at \p x+batch_stride*i.
+*  @param[in]
+*  batch_count The number of systems to solve.
+*  @param[in]
+*  batch_stride The number of elements that separate each system. Must satisfy \p batch_stride >= m.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p batch_count or \p batch_stride is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p dl, \p d,
+*              \p du, \p x or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sgtsv_strided_batch(rocsparse_handle handle,
+                                               rocsparse_int    m,
+                                               const float*     dl,
+                                               const float*     d,
+                                               const float*     du,
+                                               float*           x,
+                                               rocsparse_int    batch_count,
+                                               rocsparse_int    batch_stride,
+                                               void*            temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dgtsv_strided_batch(rocsparse_handle handle,
+                                               rocsparse_int    m,
+                                               const double*    dl,
+                                               const double*    d,
+                                               const double*    du,
+                                               double*          x,
+                                               rocsparse_int    batch_count,
+                                               rocsparse_int    batch_stride,
+                                               void*            temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cgtsv_strided_batch(rocsparse_handle               handle,
+                                               rocsparse_int                  m,
+                                               const rocsparse_float_complex* dl,
+                                               const rocsparse_float_complex* d,
+                                               const rocsparse_float_complex* du,
+                                               rocsparse_float_complex*       x,
+                                               rocsparse_int                  batch_count,
+                                               rocsparse_int                  batch_stride,
+                                               void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zgtsv_strided_batch(rocsparse_handle                handle,
+                                               rocsparse_int                   m,
+                                               const rocsparse_double_complex* dl,
+                                               const rocsparse_double_complex* d,
+                                               const rocsparse_double_complex* du,
+                                               rocsparse_double_complex*       x,
+                                               rocsparse_int                   batch_count,
+                                               rocsparse_int                   batch_stride,
+                                               void*                           temp_buffer);
+/**@}*/
+
 /*! \ingroup precond_module
 *  \brief Interleaved Batch tridiagonal solver
 *
@@ -0,0 +1,98 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the Software), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCSPARSE_CSRAGGREGATE_H
+#define ROCSPARSE_CSRAGGREGATE_H
+
+#include "../../rocsparse-types.h"
+#include "rocsparse/rocsparse-export.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! \ingroup reordering_module
+*  \brief Aggregation of the adjacency graph of the matrix \f$A\f$ stored in the CSR format.
+*
+*  \details
+*  \p rocsparse_csraggregate partitions the undirected graph represented by the (symmetric) sparsity
+*  pattern of the matrix \f$A\f$ stored in CSR format into aggregates, as required by the setup phase
+*  of smoothed and unsmoothed aggregation algebraic multigrid methods. The aggregate roots form a
+*  distance-2 maximal independent set (MIS-2) of the graph, which is computed by a randomized
+*  parallel algorithm. Each remaining vertex joins the aggregate of a root within distance one or,
+*  if there is none, within distance two. The matrix \f$A\f$ is usually the strength of connection
+*  matrix, obtained by \ref rocsparse_sprune_csr2csr_by_strength "rocsparse_Xprune_csr2csr_by_strength()".
+*  The matrix \f$A\f$ must have a symmetric sparsity pattern, and if the matrix \f$A\f$ is non-symmetric
+*  then the user is responsible to provide the symmetric part \f$\frac{A+A^T}{2}\f$.
+*
+*  The resulting aggregate indices are zero based, i.e. in the interval [0, \p naggregates - 1],
+*  independently of the index base of \p descr.
+*
+*  \note
+*  This function is blocking with respect to the host.
+*
+*  \note
+*  This routine does not support execution in a hipGraph context.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of sparse matrix \f$A\f$.
+*  @param[in]
+*  nnz         number of non-zero entries of sparse matrix \f$A\f$.
+*  @param[in]
+*  descr       sparse matrix descriptor.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[out]
+*  naggregates resulting number of aggregates, in host memory.
+*  @param[out]
+*  aggregates  array of \p m elements containing the aggregate index of each vertex.
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr, \p csr_col_ind,
+*          \p naggregates or \p aggregates pointer is invalid.
+*  \retval rocsparse_status_not_implemented \p descr is not a general matrix.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csraggregate(rocsparse_handle          handle,
+                                        rocsparse_int             m,
+                                        rocsparse_int             nnz,
+                                        const rocsparse_mat_descr descr,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        rocsparse_int*            naggregates,
+                                        rocsparse_int*            aggregates);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ROCSPARSE_CSRAGGREGATE_H */
@@ -58,6 +58,7 @@
 #include "conversion/rocsparse_nnz_compress.h"
 #include "conversion/rocsparse_prune_csr2csr.h"
 #include "conversion/rocsparse_prune_csr2csr_by_percentage.h"
+#include "conversion/rocsparse_prune_csr2csr_by_strength.h"
 #include "conversion/rocsparse_prune_dense2csr.h"
 #include "conversion/rocsparse_prune_dense2csr_by_percentage.h"
 
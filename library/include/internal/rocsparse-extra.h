@@ -33,5 +33,6 @@
 #include "extra/rocsparse_bsrgemm.h"
 #include "extra/rocsparse_csrgeam.h"
 #include "extra/rocsparse_csrgemm.h"
+#include "extra/rocsparse_csrrap.h"
 
 #endif // ROCSPARSE_EXTRA_H
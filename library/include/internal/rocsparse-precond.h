@@ -29,6 +29,7 @@
 #ifndef ROCSPARSE_PRECOND_H
 #define ROCSPARSE_PRECOND_H
 
+#include "precond/rocsparse_bjac.h"
 #include "precond/rocsparse_bsric0.h"
 #include "precond/rocsparse_bsrilu0.h"
 #include "precond/rocsparse_csric0.h"
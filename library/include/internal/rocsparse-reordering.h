@@ -29,6 +29,7 @@
 #ifndef ROCSPARSE_REORDERING_H
 #define ROCSPARSE_REORDERING_H
 
+#include "reordering/rocsparse_csraggregate.h"
 #include "reordering/rocsparse_csrcolor.h"
 
 #endif // ROCSPARSE_REORDERING_H
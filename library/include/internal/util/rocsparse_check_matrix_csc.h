@@ -172,7 +172,11 @@ rocsparse_status rocsparse_zcheck_matrix_csc_buffer_size(rocsparse_handle
 *  @param[in]
 *  storage     \ref rocsparse_storage_mode_sorted or \ref rocsparse_storage_mode_sorted.
 *  @param[out]
-*  data_status modified to indicate the status of the data
+*  data_status modified to indicate the status of the data. In device data status mode,
+*              see \ref rocsparse_set_data_status_mode, \p data_status is a device
+*              pointer and the host is not blocked. Otherwise, it is a host pointer. In
+*              device data status mode, a column pointer array that does not match
+*              \p nnz is reported as \ref rocsparse_data_status_invalid_offset_ptr.
 *  @param[in]
 *  temp_buffer temporary storage buffer allocated by the user.
 *
@@ -200,6 +200,196 @@ ROCSPARSE_EXPORT
 rocsparse_status rocsparse_get_pointer_mode(rocsparse_handle        handle,
                                             rocsparse_pointer_mode* pointer_mode);
 
+/*! \ingroup aux_module
+ *  \brief Specify capture mode
+ *
+ *  \details
+ *  \p rocsparse_set_capture_mode specifies whether the rocSPARSE library context may
+ *  synchronize its stream with the host. By default, functions block the host where they
+ *  need to, e.g. to read back the number of non-zero entries of an output matrix. In
+ *  \ref rocsparse_capture_mode_safe, a function that would block the host returns
+ *  \ref rocsparse_status_not_capture_safe instead. Work that was enqueued before is not
+ *  reverted, hence a stream capture that encounters this status should be discarded.
+ *
+ *  The compute stages of \ref rocsparse_spmv, \ref rocsparse_spsv, \ref rocsparse_spsm
+ *  and \ref rocsparse_spmm, and the compute and numeric stages of \ref rocsparse_spgemm
+ *  once the nnz or symbolic stage has run, never block the host. Their buffer sizes, analyses and
+ *  sparsity patterns must be computed beforehand in \ref rocsparse_capture_mode_default,
+ *  such that the remaining calls can be recorded into a HIP graph and replayed.
+ *
+ *  @param[in]
+ *  handle          the handle to the rocSPARSE library context.
+ *  @param[in]
+ *  capture_mode    the capture mode to be used by the rocSPARSE library context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_value \p capture_mode is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_set_capture_mode(rocsparse_handle       handle,
+                                            rocsparse_capture_mode capture_mode);
+
+/*! \ingroup aux_module
+ *  \brief Get current capture mode from library context
+ *
+ *  \details
+ *  \p rocsparse_get_capture_mode gets the rocSPARSE library context capture mode which
+ *  is currently used for all subsequent function calls.
+ *
+ *  @param[in]
+ *  handle          the handle to the rocSPARSE library context.
+ *  @param[out]
+ *  capture_mode    the capture mode that is currently used by the rocSPARSE library
+ *                  context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p capture_mode pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_get_capture_mode(rocsparse_handle        handle,
+                                            rocsparse_capture_mode* capture_mode);
+
+/*! \ingroup aux_module
+ *  \brief Specify data status mode
+ *
+ *  \details
+ *  \p rocsparse_set_data_status_mode specifies whether the \p data_status argument of the
+ *  rocsparse_check_matrix_* functions and \ref rocsparse_check_spmat is a host or a
+ *  device pointer. By default, it is a host pointer and the functions block the host to
+ *  read back the status. In \ref rocsparse_data_status_mode_device, the status is written
+ *  to device memory on the stream of the handle and the host is never blocked, such that
+ *  matrices can be validated in production code and within a stream capture.
+ *
+ *  @param[in]
+ *  handle              the handle to the rocSPARSE library context.
+ *  @param[in]
+ *  data_status_mode    the data status mode to be used by the rocSPARSE library context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_value \p data_status_mode is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_set_data_status_mode(rocsparse_handle           handle,
+                                                rocsparse_data_status_mode data_status_mode);
+
+/*! \ingroup aux_module
+ *  \brief Get current data status mode from library context
+ *
+ *  \details
+ *  \p rocsparse_get_data_status_mode gets the rocSPARSE library context data status mode
+ *  which is currently used for all subsequent function calls.
+ *
+ *  @param[in]
+ *  handle              the handle to the rocSPARSE library context.
+ *  @param[out]
+ *  data_status_mode    the data status mode that is currently used by the rocSPARSE
+ *                      library context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p data_status_mode pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_get_data_status_mode(rocsparse_handle            handle,
+                                                rocsparse_data_status_mode* data_status_mode);
+
+/*! \ingroup aux_module
+ *  \brief Report the kernels launched by the library context
+ *
+ *  \details
+ *  \p rocsparse_set_kernel_instrumentation reports every kernel launched by subsequent
+ *  function calls of the rocSPARSE library context to \p callback, with the name and
+ *  template arguments of the kernel as written at the launch, its grid and block
+ *  dimensions and the bytes and flops estimated for the function, if available. In
+ *  \ref rocsparse_instrumentation_mode_timed, each kernel is timed with HIP events and
+ *  reported once it has completed, which blocks the host after every kernel launch.
+ *  Kernels are not timed in \ref rocsparse_capture_mode_safe.
+ *
+ *  If trace logging is enabled, a summary of the kernels launched by each function call,
+ *  with their number of launches and accumulated duration, is written to the trace log
+ *  once the next function call of the library context begins.
+ *
+ *  By default, kernel launches are not reported.
+ *
+ *  @param[in]
+ *  handle          the handle to the rocSPARSE library context.
+ *  @param[in]
+ *  mode            the instrumentation mode, \ref rocsparse_instrumentation_mode_none
+ *                  stops reporting kernel launches.
+ *  @param[in]
+ *  callback        function called for each kernel launch, can be nullptr if only the
+ *                  trace log summary is needed.
+ *  @param[in]
+ *  user_data       pointer passed to \p callback.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_value \p mode is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_set_kernel_instrumentation(rocsparse_handle                 handle,
+                                                      rocsparse_instrumentation_mode   mode,
+                                                      rocsparse_kernel_launch_callback callback,
+                                                      void*                            user_data);
+
+/*! \ingroup aux_module
+ *  \brief Enable or disable the analysis cache of the library context
+ *
+ *  \details
+ *  \p rocsparse_set_analysis_cache enables a cache for the meta data gathered by
+ *  rocsparse_Xcsrmv_analysis(), rocsparse_Xcsrsv_analysis(), rocsparse_Xcsrsm_analysis(),
+ *  rocsparse_Xcsrilu0_analysis(), rocsparse_Xcsric0_analysis(), their BSR counterparts
+ *  and the preprocessing stages of \ref rocsparse_spmv, \ref rocsparse_spsv and
+ *  \ref rocsparse_spsm. Each analysis computes a fingerprint of the sparsity pattern
+ *  on the device. If a previous analysis with the same parameters ran on a pattern with
+ *  the same fingerprint, its meta data is copied instead of being computed again, even if
+ *  the matrix descriptor, the \ref rocsparse_mat_info structure or the arrays differ.
+ *  Cached entries are released in least recently used order once their total size
+ *  exceeds \p budget.
+ *
+ *  By default, the analysis cache is disabled.
+ *
+ *  \note
+ *  The fingerprint requires an additional pass over the sparsity pattern and blocks the
+ *  host until it is available.
+ *
+ *  @param[in]
+ *  handle          the handle to the rocSPARSE library context.
+ *  @param[in]
+ *  budget          maximum number of bytes of device memory held by the cache. A budget of
+ *                  0 disables the cache and releases all entries.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_set_analysis_cache(rocsparse_handle handle, size_t budget);
+
+/*! \ingroup aux_module
+ *  \brief Get the analysis cache budget and usage of the library context
+ *
+ *  \details
+ *  \p rocsparse_get_analysis_cache gets the memory budget of the analysis cache set with
+ *  \ref rocsparse_set_analysis_cache and the number of bytes currently held by it.
+ *
+ *  @param[in]
+ *  handle          the handle to the rocSPARSE library context.
+ *  @param[out]
+ *  budget          maximum number of bytes held by the cache, 0 if the cache is disabled.
+ *  @param[out]
+ *  used            number of bytes currently held by the cache.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p budget or \p used pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status
+    rocsparse_get_analysis_cache(rocsparse_handle handle, size_t* budget, size_t* used);
+
 /*! \ingroup aux_module
  *  \brief Get rocSPARSE version
  *
@@ -1889,6 +2079,31 @@ rocsparse_status rocsparse_csr_set_strided_batch(rocsparse_spmat_descr descr,
                                                  int64_t               offsets_batch_stride,
                                                  int64_t               columns_values_batch_stride);
 
+/*! \ingroup aux_module
+ *  \brief Set the column indices batch stride in the sparse CSR matrix descriptor
+ *
+ *  \details
+ *  rocsparse_csr_set_strided_batch() sets the same batch stride for the column indices
+ *  and the values. \p rocsparse_csr_set_columns_batch_stride sets a different batch stride
+ *  for the column indices, such as zero for a batch of matrices sharing one sparsity
+ *  pattern, with an offsets batch stride of zero, and only differing in their values. It
+ *  must be called after rocsparse_csr_set_strided_batch(). Only rocsparse_spmv() supports
+ *  different column indices and values batch strides.
+ *
+ *  @param[inout]
+ *  descr                the pointer to the sparse CSR matrix descriptor.
+ *  @param[in]
+ *  columns_batch_stride column indices batch stride of the sparse CSR matrix.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer if \p descr is invalid.
+ *  \retval rocsparse_status_invalid_value if \p descr is not a CSR matrix or
+ *          \p columns_batch_stride is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr_set_columns_batch_stride(rocsparse_spmat_descr descr,
+                                                        int64_t               columns_batch_stride);
+
 /*! \ingroup aux_module
  *  \brief Set the batch count, column offset batch stride and the row indices batch stride in the sparse CSC matrix descriptor
  *
@@ -2078,6 +2293,51 @@ rocsparse_status rocsparse_const_dnvec_get_values(rocsparse_const_dnvec_descr de
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_dnvec_set_values(rocsparse_dnvec_descr descr, void* values);
 
+/*! \ingroup aux_module
+ *  \brief Get the batch count and batch stride from the dense vector descriptor
+ *
+ *  @param[in]
+ *  descr        the pointer to the dense vector descriptor.
+ *  @param[out]
+ *  batch_count  the batch count in the dense vector.
+ *  @param[out]
+ *  batch_stride the batch stride in the dense vector.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer if \p descr, \p batch_count or \p batch_stride
+ *          is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dnvec_get_strided_batch(rocsparse_const_dnvec_descr descr,
+                                                   int*                        batch_count,
+                                                   int64_t*                    batch_stride);
+
+/*! \ingroup aux_module
+ *  \brief Set the batch count and batch stride in the dense vector descriptor
+ *
+ *  \details
+ *  A batched dense vector consists of \p batch_count vectors of length \p size, where
+ *  the \f$i\f$-th vector starts at \p values \f$+ i \cdot\f$ \p batch_stride. Batched
+ *  dense vectors are used by rocsparse_spmv() to multiply a batch of sparse matrices
+ *  with a batch of dense vectors.
+ *
+ *  @param[inout]
+ *  descr        the pointer to the dense vector descriptor.
+ *  @param[in]
+ *  batch_count  the batch count in the dense vector.
+ *  @param[in]
+ *  batch_stride the batch stride in the dense vector. Must be at least \p size if
+ *               \p batch_count is greater than one.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer if \p descr is invalid.
+ *  \retval rocsparse_status_invalid_value if \p batch_count or \p batch_stride is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dnvec_set_strided_batch(rocsparse_dnvec_descr descr,
+                                                   int                   batch_count,
+                                                   int64_t               batch_stride);
+
 /*! \ingroup aux_module
  *  \brief Create a dense matrix descriptor
  *  \details
@@ -385,6 +385,87 @@ typedef enum rocsparse_pointer_mode_
     rocsparse_pointer_mode_device = 1 /**< scalar pointers are in device memory. */
 } rocsparse_pointer_mode;
 
+/*! \ingroup types_module
+ *  \brief Indicates if the library context may block the host.
+ *
+ *  \details
+ *  The \ref rocsparse_capture_mode indicates whether rocSPARSE functions may synchronize
+ *  the stream with the host, e.g. to read back the size of an output array. In
+ *  \ref rocsparse_capture_mode_safe, such functions return
+ *  \ref rocsparse_status_not_capture_safe instead, such that the remaining calls can be
+ *  recorded into a HIP graph. The \ref rocsparse_capture_mode can be changed by
+ *  rocsparse_set_capture_mode(). The currently used capture mode can be obtained by
+ *  rocsparse_get_capture_mode().
+ */
+typedef enum rocsparse_capture_mode_
+{
+    rocsparse_capture_mode_default = 0, /**< functions may synchronize with the host. */
+    rocsparse_capture_mode_safe    = 1 /**< functions never synchronize with the host. */
+} rocsparse_capture_mode;
+
+/*! \ingroup types_module
+ *  \brief Indicates where the data status of matrix checks is stored.
+ *
+ *  \details
+ *  The \ref rocsparse_data_status_mode indicates whether the \p data_status argument of the
+ *  rocsparse_check_matrix_* functions and rocsparse_check_spmat() is a host or a device
+ *  pointer. With \ref rocsparse_data_status_mode_device, the matrix is validated without
+ *  blocking the host. The \ref rocsparse_data_status_mode can be changed by
+ *  rocsparse_set_data_status_mode(). The currently used data status mode can be obtained
+ *  by rocsparse_get_data_status_mode().
+ */
+typedef enum rocsparse_data_status_mode_
+{
+    rocsparse_data_status_mode_host   = 0, /**< data status pointers are in host memory. */
+    rocsparse_data_status_mode_device = 1 /**< data status pointers are in device memory. */
+} rocsparse_data_status_mode;
+
+/*! \ingroup types_module
+ *  \brief Indicates if and how kernel launches are reported.
+ *
+ *  \details
+ *  The \ref rocsparse_instrumentation_mode indicates whether the kernels launched by
+ *  rocSPARSE functions are reported to the \ref rocsparse_kernel_launch_callback of the
+ *  library context. The \ref rocsparse_instrumentation_mode can be changed by
+ *  rocsparse_set_kernel_instrumentation().
+ */
+typedef enum rocsparse_instrumentation_mode_
+{
+    rocsparse_instrumentation_mode_none   = 0, /**< kernel launches are not reported. */
+    rocsparse_instrumentation_mode_launch = 1, /**< kernel launches are reported when enqueued. */
+    rocsparse_instrumentation_mode_timed  = 2 /**< kernel launches are reported when completed. */
+} rocsparse_instrumentation_mode;
+
+/*! \ingroup types_module
+ *  \brief Description of a kernel launch.
+ *
+ *  \details
+ *  The \ref rocsparse_kernel_launch_info describes a kernel launched by a rocSPARSE
+ *  function. Its strings are only valid during the callback.
+ */
+typedef struct rocsparse_kernel_launch_info_
+{
+    const char*  routine; /**< rocSPARSE function that launched the kernel. */
+    const char*  kernel; /**< kernel and template arguments as written at the launch. */
+    unsigned int grid[3]; /**< number of blocks in each dimension. */
+    unsigned int block[3]; /**< number of threads per block in each dimension. */
+    size_t       shared_memory; /**< dynamic shared memory per block in bytes. */
+    hipStream_t  stream; /**< stream the kernel is launched on. */
+    double       bytes; /**< estimated bytes moved by the function, 0 if unknown. */
+    double       flops; /**< estimated flops of the function, 0 if unknown. */
+    float        duration_ms; /**< kernel duration in milliseconds, negative if not timed. */
+} rocsparse_kernel_launch_info;
+
+/*! \ingroup types_module
+ *  \brief Callback reporting a kernel launch.
+ *
+ *  \details
+ *  The \ref rocsparse_kernel_launch_callback is called by the host thread that launched
+ *  the kernel, with the user data given to rocsparse_set_kernel_instrumentation().
+ */
+typedef void (*rocsparse_kernel_launch_callback)(const rocsparse_kernel_launch_info* info,
+                                                 void*                               user_data);
+
 /*! \ingroup types_module
  *  \brief Indicates if layer is active with bitmask.
  *
@@ -393,10 +474,11 @@ typedef enum rocsparse_pointer_mode_
  */
 typedef enum rocsparse_layer_mode
 {
-    rocsparse_layer_mode_none      = 0x0, /**< layer is not active. */
-    rocsparse_layer_mode_log_trace = 0x1, /**< layer is in logging mode. */
-    rocsparse_layer_mode_log_bench = 0x2, /**< layer is in benchmarking mode (deprecated) */
-    rocsparse_layer_mode_log_debug = 0x4 /**< layer is in debug mode. */
+    rocsparse_layer_mode_none        = 0x0, /**< layer is not active. */
+    rocsparse_layer_mode_log_trace   = 0x1, /**< layer is in logging mode. */
+    rocsparse_layer_mode_log_bench   = 0x2, /**< layer is in benchmarking mode (deprecated) */
+    rocsparse_layer_mode_log_debug   = 0x4, /**< layer is in debug mode. */
+    rocsparse_layer_mode_log_profile = 0x8 /**< layer records binary traces with timings. */
 } rocsparse_layer_mode;
 
 /*! \ingroup types_module
@@ -422,7 +504,8 @@ typedef enum rocsparse_status_
     rocsparse_status_type_mismatch           = 11, /**< index types do not match. */
     rocsparse_status_requires_sorted_storage = 12, /**< sorted storage required. */
     rocsparse_status_thrown_exception        = 13, /**< exception being thrown. */
-    rocsparse_status_continue                = 14 /**< Nothing preventing function to proceed */
+    rocsparse_status_continue                = 14, /**< Nothing preventing function to proceed */
+    rocsparse_status_not_capture_safe        = 15 /**< function would block the host. */
 } rocsparse_status;
 
 /*! \ingroup types_module
@@ -642,7 +725,8 @@ typedef enum rocsparse_spmv_alg_
     rocsparse_spmv_alg_ell          = 4, /**< ELL SpMV algorithm for ELL matrices. */
     rocsparse_spmv_alg_coo_atomic   = 5, /**< COO SpMV algorithm 2 (atomic) for COO matrices. */
     rocsparse_spmv_alg_bsr          = 6, /**< BSR SpMV algorithm 1 for BSR matrices. */
-    rocsparse_spmv_alg_csr_lrb      = 7 /**< CSR SpMV algorithm 3 (LRB) for CSR matrices. */
+    rocsparse_spmv_alg_csr_lrb      = 7, /**< CSR SpMV algorithm 3 (LRB) for CSR matrices. */
+    rocsparse_spmv_alg_csr_gather   = 8 /**< CSR SpMV algorithm 4 (gather) for CSR matrices. */
 } rocsparse_spmv_alg;
 
 /*! \ingroup types_module
@@ -824,6 +908,80 @@ typedef enum rocsparse_spgemm_alg_
     rocsparse_spgemm_alg_default = 0 /**< Default SpGEMM algorithm for the given format. */
 } rocsparse_spgemm_alg;
 
+/*! \ingroup types_module
+ *  \brief List of SpGEMM mask types.
+ *
+ *  \details
+ *  This is a list of supported \ref rocsparse_spgemm_mask types that are used by the masked
+ *  sparse matrix sparse matrix product \ref rocsparse_spgemm_masked.
+ */
+typedef enum rocsparse_spgemm_mask_
+{
+    rocsparse_spgemm_mask_structure  = 0, /**< Keep entries inside the pattern of the mask. */
+    rocsparse_spgemm_mask_complement = 1 /**< Keep entries outside the pattern of the mask. */
+} rocsparse_spgemm_mask;
+
+/*! \ingroup types_module
+ *  \brief List of SpGEAM stages.
+ *
+ *  \details
+ *  This is a list of possible stages during SpGEAM computation. Typical order is
+ *  rocsparse_spgeam_buffer_size, rocsparse_spgeam_nnz, rocsparse_spgeam_compute. When the
+ *  addition is repeated with new values, rocsparse_spgeam_symbolic can be run once after
+ *  rocsparse_spgeam_nnz and rocsparse_spgeam_numeric for each new set of values.
+ */
+typedef enum rocsparse_spgeam_stage_
+{
+    rocsparse_spgeam_stage_buffer_size = 1, /**< Returns the required buffer size. */
+    rocsparse_spgeam_stage_nnz         = 2, /**< Computes number of non-zero entries. */
+    rocsparse_spgeam_stage_compute     = 3, /**< Performs the actual SpGEAM computation. */
+    rocsparse_spgeam_stage_symbolic    = 4, /**< Performs the actual SpGEAM symbolic computation. */
+    rocsparse_spgeam_stage_numeric     = 5 /**< Performs the actual SpGEAM numeric computation. */
+} rocsparse_spgeam_stage;
+
+/*! \ingroup types_module
+ *  \brief List of SpGEAM algorithms.
+ *
+ *  \details
+ *  This is a list of supported \ref rocsparse_spgeam_alg types that are used to perform
+ *  sparse matrix sparse matrix addition.
+ */
+typedef enum rocsparse_spgeam_alg_
+{
+    rocsparse_spgeam_alg_default = 0 /**< Default SpGEAM algorithm for the given format. */
+} rocsparse_spgeam_alg;
+
+/*! \ingroup types_module
+ *  \brief List of semirings.
+ *
+ *  \details
+ *  This is a list of supported \ref rocsparse_semiring types that are used by
+ *  \ref rocsparse_spmv_semiring and \ref rocsparse_spgemm_semiring. Each semiring defines
+ *  the reduction \f$\oplus\f$, the product \f$\otimes\f$ and the identity of
+ *  \f$\oplus\f$ that replace the conventional \f$+\f$, \f$\cdot\f$ and \f$0\f$.
+ */
+typedef enum rocsparse_semiring_
+{
+    rocsparse_semiring_plus_times = 0, /**< \f$(+, \cdot)\f$ with identity \f$0\f$. */
+    rocsparse_semiring_min_plus   = 1, /**< \f$(\min, +)\f$ with identity \f$+\infty\f$. */
+    rocsparse_semiring_max_times  = 2, /**< \f$(\max, \cdot)\f$ with identity \f$0\f$. */
+    rocsparse_semiring_max_min    = 3, /**< \f$(\max, \min)\f$ with identity \f$-\infty\f$. */
+    rocsparse_semiring_or_and     = 4 /**< \f$(\lor, \land)\f$ with identity \f$0\f$. */
+} rocsparse_semiring;
+
+/*! \ingroup types_module
+ *  \brief List of SpMV reductions.
+ *
+ *  \details
+ *  This is a list of the dot products that \ref rocsparse_spmv_fused computes from the
+ *  updated vector \f$y\f$ in the same pass as the sparse matrix vector product.
+ */
+typedef enum rocsparse_spmv_reduction_
+{
+    rocsparse_spmv_reduction_dot_xy = 0, /**< Computes \f$x^H \cdot y\f$. */
+    rocsparse_spmv_reduction_dot_yy = 1 /**< Computes \f$y^H \cdot y\f$. */
+} rocsparse_spmv_reduction;
+
 /*! \ingroup types_module
  *  \brief List of gpsv algorithms.
  *
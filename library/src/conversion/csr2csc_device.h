@@ -48,4 +48,21 @@ namespace rocsparse
         out1[gid] = in1[idx];
         out2[gid] = in2[idx];
     }
+
+    template <unsigned int BLOCKSIZE, typename I, typename T>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void csr2csc_gather_kernel(I nnz,
+                               const I* __restrict__ map,
+                               const T* __restrict__ in,
+                               T* __restrict__ out)
+    {
+        I gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+        if(gid >= nnz)
+        {
+            return;
+        }
+
+        out[gid] = in[map[gid]];
+    }
 }
@@ -54,4 +54,26 @@ namespace rocsparse
             out2[gid * linsize_block + i] = in2[idx * linsize_block + i];
         }
     }
+
+    // One thread per block entry, such that the block values are read and written coalesced
+    template <unsigned int BLOCKSIZE, typename T>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void gebsr2gebsc_gather_kernel(rocsparse_int        nnzb,
+                                   rocsparse_int        linsize_block,
+                                   const rocsparse_int* map,
+                                   const T*             in,
+                                   T*                   out)
+    {
+        int64_t gid = static_cast<int64_t>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
+
+        if(gid >= static_cast<int64_t>(nnzb) * linsize_block)
+        {
+            return;
+        }
+
+        int64_t block = gid / linsize_block;
+        int64_t entry = gid % linsize_block;
+
+        out[gid] = in[static_cast<int64_t>(map[block]) * linsize_block + entry];
+    }
 }
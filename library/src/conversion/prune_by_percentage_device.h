@@ -0,0 +1,185 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+
+#include "common.h"
+
+namespace rocsparse
+{
+    // Maps the absolute value of a floating point number onto an unsigned integer
+    // key with the same ordering. For non-negative IEEE values (including +inf and
+    // NaN) this is the raw bit pattern.
+    template <typename T>
+    struct prune_select_traits;
+
+    template <>
+    struct prune_select_traits<float>
+    {
+        typedef uint32_t key_type;
+
+        ROCSPARSE_DEVICE_ILF key_type to_key(float x)
+        {
+            return __float_as_uint(x);
+        }
+
+        ROCSPARSE_DEVICE_ILF float from_key(key_type k)
+        {
+            return __uint_as_float(k);
+        }
+    };
+
+    template <>
+    struct prune_select_traits<double>
+    {
+        typedef uint64_t key_type;
+
+        ROCSPARSE_DEVICE_ILF key_type to_key(double x)
+        {
+            return static_cast<key_type>(__double_as_longlong(x));
+        }
+
+        ROCSPARSE_DEVICE_ILF double from_key(key_type k)
+        {
+            return __longlong_as_double(static_cast<long long>(k));
+        }
+    };
+
+    // Histogram of the digit starting at bit shift over all |A| whose key matches
+    // the digits that have been selected by the previous passes.
+    template <uint32_t BLOCKSIZE, uint32_t RADIX_BITS, typename T>
+    ROCSPARSE_DEVICE_ILF void
+        prune_select_histogram_device(rocsparse_int m,
+                                      rocsparse_int n,
+                                      const T* __restrict__ A,
+                                      int64_t  lda,
+                                      uint32_t shift,
+                                      const typename prune_select_traits<T>::key_type* prefix,
+                                      rocsparse_int* __restrict__ hist)
+    {
+        typedef typename prune_select_traits<T>::key_type K;
+
+        static constexpr uint32_t RADIX = 1 << RADIX_BITS;
+        static constexpr uint32_t BITS  = 8 * sizeof(K);
+
+        __shared__ rocsparse_int shist[RADIX];
+
+        for(uint32_t i = hipThreadIdx_x; i < RADIX; i += BLOCKSIZE)
+        {
+            shist[i] = 0;
+        }
+
+        __syncthreads();
+
+        // Bits above the current digit, fixed by the previous passes
+        const K mask = (shift + RADIX_BITS < BITS) ? (~static_cast<K>(0) << (shift + RADIX_BITS))
+                                                   : static_cast<K>(0);
+        const K pre  = (mask != 0) ? *prefix : static_cast<K>(0);
+
+        const int64_t size = static_cast<int64_t>(m) * n;
+
+        for(int64_t idx = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x; idx < size;
+            idx += hipGridDim_x * BLOCKSIZE)
+        {
+            const int64_t row = idx % m;
+            const int64_t col = idx / m;
+
+            const K key = prune_select_traits<T>::to_key(rocsparse::abs(A[lda * col + row]));
+
+            if((key & mask) == pre)
+            {
+                rocsparse::atomic_add(&shist[(key >> shift) & (RADIX - 1)],
+                                      static_cast<rocsparse_int>(1));
+            }
+        }
+
+        __syncthreads();
+
+        for(uint32_t i = hipThreadIdx_x; i < RADIX; i += BLOCKSIZE)
+        {
+            if(shist[i] != 0)
+            {
+                rocsparse::atomic_add(&hist[i], shist[i]);
+            }
+        }
+    }
+
+    // Picks the digit that contains the element of the requested rank and clears
+    // the histogram for the next pass. After the last digit, prefix holds the key of
+    // the selected element, which is written to threshold.
+    template <uint32_t RADIX_BITS, typename T>
+    ROCSPARSE_DEVICE_ILF void
+        prune_select_digit_device(uint32_t      shift,
+                                  rocsparse_int pos,
+                                  typename prune_select_traits<T>::key_type* __restrict__ prefix,
+                                  rocsparse_int* __restrict__ rank,
+                                  rocsparse_int* __restrict__ hist,
+                                  T* __restrict__ threshold)
+    {
+        typedef typename prune_select_traits<T>::key_type K;
+
+        static constexpr uint32_t RADIX = 1 << RADIX_BITS;
+        static constexpr uint32_t BITS  = 8 * sizeof(K);
+
+        __shared__ rocsparse_int shist[RADIX];
+
+        const uint32_t tid = hipThreadIdx_x;
+
+        shist[tid] = hist[tid];
+        hist[tid]  = 0;
+
+        __syncthreads();
+
+        if(tid == 0)
+        {
+            // The first pass starts from the requested position
+            const bool first = (shift + RADIX_BITS >= BITS);
+
+            rocsparse_int k   = first ? pos : *rank;
+            K             pre = first ? static_cast<K>(0) : *prefix;
+
+            uint32_t digit = 0;
+            for(; digit < RADIX - 1; ++digit)
+            {
+                if(k < shist[digit])
+                {
+                    break;
+                }
+
+                k -= shist[digit];
+            }
+
+            pre |= static_cast<K>(digit) << shift;
+
+            *prefix = pre;
+            *rank   = k;
+
+            if(shift == 0)
+            {
+                *threshold = prune_select_traits<T>::from_key(pre);
+            }
+        }
+    }
+}
@@ -0,0 +1,184 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "common.h"
+
+namespace rocsparse
+{
+    // Extract the magnitude of the diagonal entries, each row is processed by a (sub)wavefront
+    template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void prune_csr2csr_by_strength_diag_kernel(rocsparse_int m,
+                                               const T* __restrict__ csr_val,
+                                               const rocsparse_int* __restrict__ csr_row_ptr,
+                                               const rocsparse_int* __restrict__ csr_col_ind,
+                                               rocsparse_index_base idx_base,
+                                               T* __restrict__ diag)
+    {
+        const rocsparse_int lid = hipThreadIdx_x & (WFSIZE - 1);
+        const rocsparse_int row = (BLOCKSIZE / WFSIZE) * hipBlockIdx_x + hipThreadIdx_x / WFSIZE;
+
+        if(row >= m)
+        {
+            return;
+        }
+
+        const rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+        const rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        // Missing diagonal entries are treated as zero
+        T d = static_cast<T>(0);
+        for(rocsparse_int j = row_begin + lid; j < row_end; j += WFSIZE)
+        {
+            if(csr_col_ind[j] - idx_base == row)
+            {
+                d = rocsparse::abs(csr_val[j]);
+            }
+        }
+
+        rocsparse::wfreduce_max<WFSIZE>(&d);
+
+        if(lid == WFSIZE - 1)
+        {
+            diag[row] = d;
+        }
+    }
+
+    // Strength of connection test |a_ij| >= theta * sqrt(|a_ii| * |a_jj|), squared to avoid
+    // the square root. Diagonal entries are always kept.
+    template <typename T>
+    ROCSPARSE_DEVICE_ILF bool prune_csr2csr_by_strength_is_strong(
+        rocsparse_int row, rocsparse_int col, T val, T theta2, const T* __restrict__ diag)
+    {
+        const T a = rocsparse::abs(val);
+        return (row == col) || (a * a >= theta2 * diag[row] * diag[col]);
+    }
+
+    // Count the strong connections of each row, each row is processed by a (sub)wavefront.
+    // The result is written to csr_nnz_C[row], which is expected to point to csr_row_ptr_C + 1.
+    template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T, typename U>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void prune_csr2csr_by_strength_nnz_kernel(rocsparse_int m,
+                                              const T* __restrict__ csr_val_A,
+                                              const rocsparse_int* __restrict__ csr_row_ptr_A,
+                                              const rocsparse_int* __restrict__ csr_col_ind_A,
+                                              rocsparse_index_base idx_base_A,
+                                              const T* __restrict__ diag,
+                                              U theta_device_host,
+                                              rocsparse_int* __restrict__ csr_nnz_C)
+    {
+        const rocsparse_int lid = hipThreadIdx_x & (WFSIZE - 1);
+        const rocsparse_int row = (BLOCKSIZE / WFSIZE) * hipBlockIdx_x + hipThreadIdx_x / WFSIZE;
+
+        if(row >= m)
+        {
+            return;
+        }
+
+        const T theta  = rocsparse::load_scalar_device_host(theta_device_host);
+        const T theta2 = theta * theta;
+
+        const rocsparse_int row_begin = csr_row_ptr_A[row] - idx_base_A;
+        const rocsparse_int row_end   = csr_row_ptr_A[row + 1] - idx_base_A;
+
+        rocsparse_int nnz = 0;
+        for(rocsparse_int j = row_begin + lid; j < row_end; j += WFSIZE)
+        {
+            nnz += prune_csr2csr_by_strength_is_strong(
+                       row, csr_col_ind_A[j] - idx_base_A, csr_val_A[j], theta2, diag)
+                       ? 1
+                       : 0;
+        }
+
+        nnz = rocsparse::wfreduce_sum<WFSIZE>(nnz);
+
+        if(lid == WFSIZE - 1)
+        {
+            csr_nnz_C[row] = nnz;
+        }
+    }
+
+    // Copy the strong connections of each row into C, each row is processed by a (sub)wavefront.
+    // Entries are compacted using ballot, such that the column ordering of A is preserved.
+    template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T, typename U>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void prune_csr2csr_by_strength_kernel(rocsparse_int m,
+                                          const T* __restrict__ csr_val_A,
+                                          const rocsparse_int* __restrict__ csr_row_ptr_A,
+                                          const rocsparse_int* __restrict__ csr_col_ind_A,
+                                          rocsparse_index_base idx_base_A,
+                                          const T* __restrict__ diag,
+                                          U theta_device_host,
+                                          T* __restrict__ csr_val_C,
+                                          const rocsparse_int* __restrict__ csr_row_ptr_C,
+                                          rocsparse_int* __restrict__ csr_col_ind_C,
+                                          rocsparse_index_base idx_base_C)
+    {
+        const rocsparse_int lid = hipThreadIdx_x & (WFSIZE - 1);
+        const rocsparse_int row = (BLOCKSIZE / WFSIZE) * hipBlockIdx_x + hipThreadIdx_x / WFSIZE;
+
+        if(row >= m)
+        {
+            return;
+        }
+
+        const T theta  = rocsparse::load_scalar_device_host(theta_device_host);
+        const T theta2 = theta * theta;
+
+        // Mask of all lanes below the current lane, including the current lane
+        const uint64_t filter = 0xffffffffffffffff >> (63 - lid);
+
+        const rocsparse_int row_begin = csr_row_ptr_A[row] - idx_base_A;
+        const rocsparse_int row_end   = csr_row_ptr_A[row + 1] - idx_base_A;
+
+        rocsparse_int idx = csr_row_ptr_C[row] - idx_base_C;
+
+        for(rocsparse_int j = row_begin + lid; j < row_end + lid; j += WFSIZE)
+        {
+            bool          predicate = false;
+            rocsparse_int col       = 0;
+            T             val       = static_cast<T>(0);
+
+            if(j < row_end)
+            {
+                col       = csr_col_ind_A[j] - idx_base_A;
+                val       = csr_val_A[j];
+                predicate = prune_csr2csr_by_strength_is_strong(row, col, val, theta2, diag);
+            }
+
+            const uint64_t mask  = __ballot(predicate);
+            const uint64_t count = __popcll(mask & filter);
+
+            if(predicate)
+            {
+                csr_col_ind_C[idx + count - 1] = col + idx_base_C;
+                csr_val_C[idx + count - 1]     = val;
+            }
+
+            idx += __popcll(mask);
+        }
+    }
+}
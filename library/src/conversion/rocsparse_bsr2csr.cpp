@@ -347,6 +347,8 @@ namespace rocsparse
 
         if(csr_val == nullptr || csr_col_ind == nullptr)
         {
+            RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
             I start = 0;
             I end   = 0;
             RETURN_IF_HIP_ERROR(hipMemcpyAsync(
@@ -554,6 +554,9 @@ rocsparse_status rocsparse::convert_array(rocsparse_handle    handle_,
     }
     else
     {
+        // The count of out of range values is read back on the host
+        RETURN_IF_CAPTURE_SAFE_MODE(handle_);
+
         size_t                 count_out_of_bounds_conversion = 0;
         const rocsparse_status status
             = rocsparse::convert_indexing_array_compute(target_indextype_,
@@ -626,6 +629,8 @@ rocsparse_status rocsparse::convert_array(rocsparse_handle   handle_,
         //
         // Treating arrays with different data types.
         //
+        RETURN_IF_CAPTURE_SAFE_MODE(handle_);
+
         double conversion_error_max;
         RETURN_IF_ROCSPARSE_ERROR(rocsparse::convert_data_array_compute(target_datatype_,
                                                                         source_datatype_,
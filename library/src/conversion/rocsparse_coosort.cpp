@@ -219,6 +219,9 @@ rocsparse_status rocsparse::coosort_by_row_template(rocsparse_handle handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // The number of row segments is read back on the host
+    RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
     // Stream
     hipStream_t stream = handle->stream;
 
@@ -319,6 +319,9 @@ rocsparse_status rocsparse::csr2bsr_quickreturn(rocsparse_handle          handle
         return rocsparse_status_success;
     }
 
+    // The number of blocks is read back on the host
+    RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
     const int64_t mb    = (m + block_dim - 1) / block_dim;
     I             start = 0;
     I             end   = 0;
@@ -404,7 +407,7 @@ namespace rocsparse
         {
             int64_t nnz;
             RETURN_IF_ROCSPARSE_ERROR(rocsparse::calculate_nnz(
-                m, rocsparse::get_indextype<I>(), csr_row_ptr, &nnz, handle->stream));
+                handle, m, rocsparse::get_indextype<I>(), csr_row_ptr, &nnz));
 
             ROCSPARSE_CHECKARG_ARRAY(5, nnz, csr_val);
             ROCSPARSE_CHECKARG_ARRAY(7, nnz, csr_col_ind);
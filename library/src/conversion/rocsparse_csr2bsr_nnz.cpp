@@ -177,6 +177,8 @@ namespace rocsparse
 
         if(csr_col_ind == nullptr)
         {
+            RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
             I start = 0;
             I end   = 0;
 
@@ -261,8 +263,16 @@ rocsparse_status rocsparse::csr2bsr_nnz_core(rocsparse_handle          handle,
     ROCSPARSE_CHECKARG_ARRAY(9, mb, bsr_row_ptr);
     ROCSPARSE_CHECKARG_POINTER(10, bsr_nnz);
 
+    // The number of blocks is only read back on the host in host pointer mode
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+    }
+
     if(csr_col_ind == nullptr)
     {
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
         I start = 0;
         I end   = 0;
 
@@ -0,0 +1,416 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "internal/conversion/rocsparse_csr2csc.h"
+#include "common.h"
+#include "control.h"
+#include "rocsparse_csr2csc_analysis.hpp"
+#include "utility.h"
+
+#include "csr2csc_device.h"
+#include "rocsparse_coo2csr.hpp"
+#include "rocsparse_csr2coo.hpp"
+#include "rocsparse_identity.hpp"
+#include <rocprim/rocprim.hpp>
+
+template <typename I, typename J>
+rocsparse_status rocsparse::csr2csc_permutation_core(rocsparse_handle     handle,
+                                                     J                    m,
+                                                     J                    n,
+                                                     I                    nnz,
+                                                     const I*             csr_row_ptr,
+                                                     const J*             csr_col_ind,
+                                                     J*                   csc_row_ind,
+                                                     I*                   csc_col_ptr,
+                                                     I*                   perm,
+                                                     rocsparse_index_base idx_base,
+                                                     void*                temp_buffer)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    unsigned int startbit = 0;
+    unsigned int endbit   = rocsparse::clz(n);
+
+    // Temporary buffer entry points
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // work1 buffer
+    J* tmp_work1 = reinterpret_cast<J*>(ptr);
+    ptr += ((sizeof(J) * nnz - 1) / 256 + 1) * 256;
+
+    // work2 buffer
+    I* tmp_work2 = reinterpret_cast<I*>(ptr);
+    ptr += ((sizeof(I) * nnz - 1) / 256 + 1) * 256;
+
+    // perm buffer
+    I* tmp_perm = reinterpret_cast<I*>(ptr);
+    ptr += ((sizeof(I) * nnz - 1) / 256 + 1) * 256;
+
+    // rocprim buffer
+    void* tmp_rocprim = reinterpret_cast<void*>(ptr);
+
+    // Load CSR column indices into work1 buffer
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(tmp_work1, csr_col_ind, sizeof(J) * nnz, hipMemcpyDeviceToDevice, stream));
+
+    // Create identitiy permutation
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::create_identity_permutation_core(handle, nnz, tmp_perm));
+
+    // Stable sort COO by columns
+    rocprim::double_buffer<J> keys(tmp_work1, csc_row_ind);
+    rocprim::double_buffer<I> vals(tmp_perm, tmp_work2);
+
+    size_t size = 0;
+
+    RETURN_IF_HIP_ERROR(
+        rocprim::radix_sort_pairs(nullptr, size, keys, vals, nnz, startbit, endbit, stream));
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+        tmp_rocprim, size, keys, vals, nnz, startbit, endbit, stream));
+
+    // Create column pointers
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse::coo2csr_core(handle, keys.current(), nnz, n, csc_col_ptr, idx_base));
+
+    // Store the permutation, it is all that is required to transpose the values later on
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(perm, vals.current(), sizeof(I) * nnz, hipMemcpyDeviceToDevice, stream));
+
+    // Create row indices
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::csr2coo_core(
+        handle, csr_row_ptr, csr_row_ptr + 1, nnz, m, tmp_work1, idx_base));
+
+    // Permute row indices
+    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::csr2csc_gather_kernel<512>),
+                                       dim3((nnz - 1) / 512 + 1),
+                                       dim3(512),
+                                       0,
+                                       stream,
+                                       nnz,
+                                       perm,
+                                       tmp_work1,
+                                       csc_row_ind);
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J>
+rocsparse_status rocsparse::csr2csc_analysis_core(rocsparse_handle     handle,
+                                                  J                    m,
+                                                  J                    n,
+                                                  I                    nnz,
+                                                  const I*             csr_row_ptr,
+                                                  const J*             csr_col_ind,
+                                                  J*                   csc_row_ind,
+                                                  I*                   csc_col_ptr,
+                                                  rocsparse_index_base idx_base,
+                                                  rocsparse_mat_info   info,
+                                                  void*                temp_buffer)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Create csr2csc info, if not yet available
+    if(info->csr2csc_info == nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::create_csr2csc_info(&info->csr2csc_info));
+    }
+
+    rocsparse_csr2csc_info csr2csc_info = info->csr2csc_info;
+
+    // Permutation of a previous analysis can only be re-used if it is of the same size
+    if(csr2csc_info->perm != nullptr
+       && (csr2csc_info->nnz != nnz
+           || csr2csc_info->index_type_I != rocsparse::get_indextype<I>()))
+    {
+        RETURN_IF_HIP_ERROR(rocsparse_hipFreeAsync(csr2csc_info->perm, stream));
+        csr2csc_info->perm = nullptr;
+    }
+
+    if(csr2csc_info->perm == nullptr)
+    {
+        RETURN_IF_HIP_ERROR(rocsparse_hipMallocAsync(&csr2csc_info->perm, sizeof(I) * nnz, stream));
+    }
+
+    csr2csc_info->m             = m;
+    csr2csc_info->n             = n;
+    csr2csc_info->nnz           = nnz;
+    csr2csc_info->row_block_dim = 1;
+    csr2csc_info->col_block_dim = 1;
+    csr2csc_info->index_type_I  = rocsparse::get_indextype<I>();
+
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse::csr2csc_permutation_core(handle,
+                                            m,
+                                            n,
+                                            nnz,
+                                            csr_row_ptr,
+                                            csr_col_ind,
+                                            csc_row_ind,
+                                            csc_col_ptr,
+                                            reinterpret_cast<I*>(csr2csc_info->perm),
+                                            idx_base,
+                                            temp_buffer));
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J>
+rocsparse_status rocsparse::csr2csc_analysis_impl(rocsparse_handle     handle, //0
+                                                  J                    m, //1
+                                                  J                    n, //2
+                                                  I                    nnz, //3
+                                                  const I*             csr_row_ptr, //4
+                                                  const J*             csr_col_ind, //5
+                                                  J*                   csc_row_ind, //6
+                                                  I*                   csc_col_ptr, //7
+                                                  rocsparse_index_base idx_base, //8
+                                                  rocsparse_mat_info   info, //9
+                                                  void*                temp_buffer) //10
+{
+    // Logging
+    rocsparse::log_trace(handle,
+                         "rocsparse_csr2csc_analysis",
+                         m,
+                         n,
+                         nnz,
+                         (const void*&)csr_row_ptr,
+                         (const void*&)csr_col_ind,
+                         (const void*&)csc_row_ind,
+                         (const void*&)csc_col_ptr,
+                         idx_base,
+                         (const void*&)info,
+                         (const void*&)temp_buffer);
+
+    ROCSPARSE_CHECKARG_HANDLE(0, handle);
+    ROCSPARSE_CHECKARG_SIZE(1, m);
+    ROCSPARSE_CHECKARG_SIZE(2, n);
+    ROCSPARSE_CHECKARG_SIZE(3, nnz);
+    ROCSPARSE_CHECKARG_ARRAY(4, m, csr_row_ptr);
+    ROCSPARSE_CHECKARG_ARRAY(5, nnz, csr_col_ind);
+    ROCSPARSE_CHECKARG_ARRAY(6, nnz, csc_row_ind);
+    ROCSPARSE_CHECKARG_ARRAY(7, n, csc_col_ptr);
+    ROCSPARSE_CHECKARG_ENUM(8, idx_base);
+    ROCSPARSE_CHECKARG_POINTER(9, info);
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        if(nnz == 0 && csc_col_ptr != nullptr)
+        {
+            RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::set_array_to_value<256>),
+                                               dim3(n / 256 + 1),
+                                               dim3(256),
+                                               0,
+                                               handle->stream,
+                                               (n + 1),
+                                               csc_col_ptr,
+                                               static_cast<I>(idx_base));
+        }
+        return rocsparse_status_success;
+    }
+
+    ROCSPARSE_CHECKARG_POINTER(10, temp_buffer);
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::csr2csc_analysis_core(handle,
+                                                               m,
+                                                               n,
+                                                               nnz,
+                                                               csr_row_ptr,
+                                                               csr_col_ind,
+                                                               csc_row_ind,
+                                                               csc_col_ptr,
+                                                               idx_base,
+                                                               info,
+                                                               temp_buffer));
+    return rocsparse_status_success;
+}
+
+template <typename I, typename T>
+rocsparse_status rocsparse::csr2csc_numeric_core(rocsparse_handle   handle,
+                                                 I                  nnz,
+                                                 const T*           csr_val,
+                                                 T*                 csc_val,
+                                                 rocsparse_mat_info info)
+{
+    // Apply the permutation of the analysis to the values
+    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::csr2csc_gather_kernel<512>),
+                                       dim3((nnz - 1) / 512 + 1),
+                                       dim3(512),
+                                       0,
+                                       handle->stream,
+                                       nnz,
+                                       reinterpret_cast<const I*>(info->csr2csc_info->perm),
+                                       csr_val,
+                                       csc_val);
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse::csr2csc_numeric_impl(rocsparse_handle   handle, //0
+                                                 J                  m, //1
+                                                 J                  n, //2
+                                                 I                  nnz, //3
+                                                 const T*           csr_val, //4
+                                                 T*                 csc_val, //5
+                                                 rocsparse_mat_info info) //6
+{
+    // Logging
+    rocsparse::log_trace(handle,
+                         rocsparse::replaceX<T>("rocsparse_Xcsr2csc_numeric"),
+                         m,
+                         n,
+                         nnz,
+                         (const void*&)csr_val,
+                         (const void*&)csc_val,
+                         (const void*&)info);
+
+    ROCSPARSE_CHECKARG_HANDLE(0, handle);
+    ROCSPARSE_CHECKARG_SIZE(1, m);
+    ROCSPARSE_CHECKARG_SIZE(2, n);
+    ROCSPARSE_CHECKARG_SIZE(3, nnz);
+    ROCSPARSE_CHECKARG_ARRAY(4, nnz, csr_val);
+    ROCSPARSE_CHECKARG_ARRAY(5, nnz, csc_val);
+    ROCSPARSE_CHECKARG_POINTER(6, info);
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Analysis must have been performed on a matrix of the same dimensions
+    ROCSPARSE_CHECKARG(6, info, (info->csr2csc_info == nullptr), rocsparse_status_invalid_pointer);
+    ROCSPARSE_CHECKARG(1, m, (info->csr2csc_info->m != m), rocsparse_status_invalid_size);
+    ROCSPARSE_CHECKARG(2, n, (info->csr2csc_info->n != n), rocsparse_status_invalid_size);
+    ROCSPARSE_CHECKARG(3,
+                       nnz,
+                       (info->csr2csc_info->nnz != nnz
+                        || info->csr2csc_info->index_type_I != rocsparse::get_indextype<I>()),
+                       rocsparse_status_invalid_size);
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::csr2csc_numeric_core(handle, nnz, csr_val, csc_val, info));
+    return rocsparse_status_success;
+}
+
+#define INSTANTIATE(ITYPE, JTYPE)                                                \
+    template rocsparse_status rocsparse::csr2csc_permutation_core<ITYPE, JTYPE>( \
+        rocsparse_handle     handle,                                             \
+        JTYPE                m,                                                  \
+        JTYPE                n,                                                  \
+        ITYPE                nnz,                                                \
+        const ITYPE*         csr_row_ptr,                                        \
+        const JTYPE*         csr_col_ind,                                        \
+        JTYPE*               csc_row_ind,                                        \
+        ITYPE*               csc_col_ptr,                                        \
+        ITYPE*               perm,                                               \
+        rocsparse_index_base idx_base,                                           \
+        void*                temp_buffer);
+
+INSTANTIATE(int32_t, int32_t);
+INSTANTIATE(int64_t, int32_t);
+INSTANTIATE(int64_t, int64_t);
+#undef INSTANTIATE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+extern "C" rocsparse_status rocsparse_csr2csc_analysis(rocsparse_handle     handle,
+                                                       rocsparse_int        m,
+                                                       rocsparse_int        n,
+                                                       rocsparse_int        nnz,
+                                                       const rocsparse_int* csr_row_ptr,
+                                                       const rocsparse_int* csr_col_ind,
+                                                       rocsparse_int*       csc_row_ind,
+                                                       rocsparse_int*       csc_col_ptr,
+                                                       rocsparse_index_base idx_base,
+                                                       rocsparse_mat_info   info,
+                                                       void*                temp_buffer)
+try
+{
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::csr2csc_analysis_impl(handle,
+                                                               m,
+                                                               n,
+                                                               nnz,
+                                                               csr_row_ptr,
+                                                               csr_col_ind,
+                                                               csc_row_ind,
+                                                               csc_col_ptr,
+                                                               idx_base,
+                                                               info,
+                                                               temp_buffer));
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
+
+#define CIMPL(NAME, T)                                                                   \
+    extern "C" rocsparse_status NAME(rocsparse_handle   handle,                          \
+                                     rocsparse_int      m,                               \
+                                     rocsparse_int      n,                               \
+                                     rocsparse_int      nnz,                             \
+                                     const T*           csr_val,                         \
+                                     T*                 csc_val,                         \
+                                     rocsparse_mat_info info)                            \
+    try                                                                                  \
+    {                                                                                    \
+        RETURN_IF_ROCSPARSE_ERROR(                                                       \
+            rocsparse::csr2csc_numeric_impl(handle, m, n, nnz, csr_val, csc_val, info)); \
+        return rocsparse_status_success;                                                 \
+    }                                                                                    \
+    catch(...)                                                                           \
+    {                                                                                    \
+        RETURN_ROCSPARSE_EXCEPTION();                                                    \
+    }
+
+CIMPL(rocsparse_scsr2csc_numeric, float);
+CIMPL(rocsparse_ccsr2csc_numeric, rocsparse_float_complex);
+CIMPL(rocsparse_dcsr2csc_numeric, double);
+CIMPL(rocsparse_zcsr2csc_numeric, rocsparse_double_complex);
+#undef CIMPL
+
+extern "C" rocsparse_status rocsparse_csr2csc_clear(rocsparse_handle   handle,
+                                                    rocsparse_mat_info info)
+try
+{
+    ROCSPARSE_CHECKARG_HANDLE(0, handle);
+    ROCSPARSE_CHECKARG_POINTER(1, info);
+
+    // Logging
+    rocsparse::log_trace(handle, "rocsparse_csr2csc_clear", (const void*&)info);
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::destroy_csr2csc_info(info->csr2csc_info));
+    info->csr2csc_info = nullptr;
+
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
@@ -0,0 +1,85 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.h"
+
+namespace rocsparse
+{
+    template <typename I, typename J>
+    rocsparse_status csr2csc_permutation_core(rocsparse_handle     handle,
+                                              J                    m,
+                                              J                    n,
+                                              I                    nnz,
+                                              const I*             csr_row_ptr,
+                                              const J*             csr_col_ind,
+                                              J*                   csc_row_ind,
+                                              I*                   csc_col_ptr,
+                                              I*                   perm,
+                                              rocsparse_index_base idx_base,
+                                              void*                temp_buffer);
+
+    template <typename I, typename J>
+    rocsparse_status csr2csc_analysis_core(rocsparse_handle     handle,
+                                           J                    m,
+                                           J                    n,
+                                           I                    nnz,
+                                           const I*             csr_row_ptr,
+                                           const J*             csr_col_ind,
+                                           J*                   csc_row_ind,
+                                           I*                   csc_col_ptr,
+                                           rocsparse_index_base idx_base,
+                                           rocsparse_mat_info   info,
+                                           void*                temp_buffer);
+
+    template <typename I, typename J>
+    rocsparse_status csr2csc_analysis_impl(rocsparse_handle     handle,
+                                           J                    m,
+                                           J                    n,
+                                           I                    nnz,
+                                           const I*             csr_row_ptr,
+                                           const J*             csr_col_ind,
+                                           J*                   csc_row_ind,
+                                           I*                   csc_col_ptr,
+                                           rocsparse_index_base idx_base,
+                                           rocsparse_mat_info   info,
+                                           void*                temp_buffer);
+
+    template <typename I, typename T>
+    rocsparse_status csr2csc_numeric_core(rocsparse_handle   handle,
+                                          I                  nnz,
+                                          const T*           csr_val,
+                                          T*                 csc_val,
+                                          rocsparse_mat_info info);
+
+    template <typename I, typename J, typename T>
+    rocsparse_status csr2csc_numeric_impl(rocsparse_handle   handle,
+                                          J                  m,
+                                          J                  n,
+                                          I                  nnz,
+                                          const T*           csr_val,
+                                          T*                 csc_val,
+                                          rocsparse_mat_info info);
+}
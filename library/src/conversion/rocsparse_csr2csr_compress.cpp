@@ -84,6 +84,12 @@ rocsparse_status rocsparse::csr2csr_compress_template(rocsparse_handle
         return rocsparse_status_success;
     }
 
+    // Validating the output arrays against nnz_C reads csr_row_ptr_C back on the host
+    if(csr_val_C == nullptr || csr_col_ind_C == nullptr)
+    {
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+    }
+
     // Stream
     hipStream_t stream = handle->stream;
     // Compute required temporary storage buffer size
@@ -111,6 +111,12 @@ rocsparse_status rocsparse::csr2ell_width_core(rocsparse_handle          handle,
                                                const rocsparse_mat_descr ell_descr,
                                                J*                        ell_width)
 {
+    // The width is only written to host memory in host pointer mode
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+    }
+
     hipStream_t stream = handle->stream;
 
 #define CSR2ELL_DIM 256
@@ -185,6 +185,8 @@ rocsparse_status rocsparse::csr2gebsr_buffer_size_template(rocsparse_handle
     ROCSPARSE_CHECKARG_ARRAY(6, m, csr_row_ptr);
     if(csr_val == nullptr || csr_col_ind == nullptr)
     {
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
         rocsparse_int start = 0;
         rocsparse_int end   = 0;
         if(csr_row_ptr != nullptr)
@@ -273,6 +275,8 @@ rocsparse_status rocsparse::csr2gebsr_template(rocsparse_handle          handle,
     ROCSPARSE_CHECKARG_ARRAY(6, m, csr_row_ptr);
     if(csr_val == nullptr || csr_col_ind == nullptr)
     {
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
         rocsparse_int start = 0;
         rocsparse_int end   = 0;
         if(csr_row_ptr != nullptr)
@@ -313,6 +317,9 @@ rocsparse_status rocsparse::csr2gebsr_template(rocsparse_handle          handle,
         return rocsparse_status_success;
     }
 
+    // The number of blocks is read back on the host
+    RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
     hipStream_t         stream = handle->stream;
     const rocsparse_int mb     = (m + row_block_dim - 1) / row_block_dim;
     const rocsparse_int nb     = (n + col_block_dim - 1) / col_block_dim;
@@ -854,11 +861,19 @@ try
         return rocsparse_status_success;
     }
 
+    // The number of blocks is only read back on the host in host pointer mode
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+    }
+
     //
     // Check pointer arguments
     //
     if(csr_col_ind == nullptr)
     {
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
         rocsparse_int start = 0;
         rocsparse_int end   = 0;
 
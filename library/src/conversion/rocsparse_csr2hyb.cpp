@@ -83,6 +83,9 @@ rocsparse_status rocsparse::csr2hyb_template(rocsparse_handle          handle,
     ROCSPARSE_CHECKARG_POINTER(6, csr_col_ind);
     ROCSPARSE_CHECKARG_ARRAY(5, m, csr_row_ptr);
 
+    // The number of non-zeros and the ELL width are read back on the host
+    RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
     // Stream
     hipStream_t stream = handle->stream;
 
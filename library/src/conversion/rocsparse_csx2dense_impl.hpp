@@ -77,6 +77,8 @@ namespace rocsparse
             ROCSPARSE_CHECKARG_ARRAY(5, m, csr_row_ptr);
             if(csr_val == nullptr || csr_col_ind == nullptr)
             {
+                RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
                 rocsparse_int start = 0;
                 rocsparse_int end   = 0;
                 if(csr_row_ptr != nullptr)
@@ -107,6 +109,8 @@ namespace rocsparse
             ROCSPARSE_CHECKARG_ARRAY(5, n, csc_col_ptr);
             if(csc_val == nullptr || csc_row_ind == nullptr)
             {
+                RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
                 rocsparse_int start = 0;
                 rocsparse_int end   = 0;
                 if(csc_col_ptr != nullptr)
@@ -235,6 +235,14 @@ rocsparse_status rocsparse::csxsldu_compute_template(rocsparse_handle handle_,
                                  : buffer)
               : uptr_;
 
+    //
+    // Transposing a non-empty triangular part synchronizes the stream.
+    //
+    if((udir_ != dir_ && unnz_ != 0) || (ldir_ != dir_ && lnnz_ != 0))
+    {
+        RETURN_IF_CAPTURE_SAFE_MODE(handle_);
+    }
+
     if(dir_ == rocsparse_direction_row)
     {
         //
@@ -217,6 +217,9 @@ rocsparse_status rocsparse::csxsldu_preprocess_template(rocsparse_handle     han
                                  : buffer)
               : uptr_;
 
+    // The number of non-zeros of both triangular parts are read back on the host
+    RETURN_IF_CAPTURE_SAFE_MODE(handle_);
+
     switch(dir_)
     {
     case rocsparse_direction_row:
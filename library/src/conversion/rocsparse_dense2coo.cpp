@@ -98,6 +98,9 @@ rocsparse_status rocsparse::dense2coo_template(rocsparse_handle          handle,
                          (const void*&)coo_row_ind,
                          (const void*&)coo_col_ind);
 
+    // The number of non-zeros is read back on the host
+    RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
     I* row_ptr;
     RETURN_IF_HIP_ERROR(rocsparse_hipMallocAsync(&row_ptr, sizeof(I) * (m + 1), handle->stream));
 
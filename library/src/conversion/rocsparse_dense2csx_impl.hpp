@@ -150,6 +150,14 @@ namespace rocsparse
             return rocsparse_status_success;
         }
 
+        //
+        // Validating missing output arrays reads the number of non-zeros back on the host.
+        //
+        if(csx_col_row_ind_A == nullptr && csx_val_A == nullptr)
+        {
+            RETURN_IF_CAPTURE_SAFE_MODE(handle);
+        }
+
         //
         // Compute csx_row_col_ptr_A with the right index base.
         //
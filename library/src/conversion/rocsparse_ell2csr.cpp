@@ -271,6 +271,12 @@ rocsparse_status rocsparse::ell2csr_nnz_core(rocsparse_handle          handle,
                                              I*                        csr_row_ptr,
                                              I*                        csr_nnz)
 {
+    // The number of non-zeros is only read back on the host in host pointer mode
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+    }
+
     hipStream_t stream = handle->stream;
     // Count nnz per row
 #define ELL2CSR_DIM 256
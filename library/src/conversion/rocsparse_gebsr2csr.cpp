@@ -462,7 +462,7 @@ rocsparse_status rocsparse::gebsr2csr_template(rocsparse_handle          handle,
     {
         int64_t nnzb;
         RETURN_IF_ROCSPARSE_ERROR(rocsparse::calculate_nnz(
-            mb, rocsparse::get_indextype<rocsparse_int>(), bsr_row_ptr, &nnzb, handle->stream));
+            handle, mb, rocsparse::get_indextype<rocsparse_int>(), bsr_row_ptr, &nnzb));
         ROCSPARSE_CHECKARG_ARRAY(5, nnzb * row_block_dim * col_block_dim, bsr_val);
         ROCSPARSE_CHECKARG_ARRAY(7, nnzb, bsr_col_ind);
         ROCSPARSE_CHECKARG_ARRAY(11, nnzb, csr_val);
@@ -0,0 +1,369 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "internal/conversion/rocsparse_gebsr2gebsc.h"
+#include "common.h"
+#include "control.h"
+#include "internal/conversion/rocsparse_coo2csr.h"
+#include "internal/conversion/rocsparse_csr2coo.h"
+#include "internal/conversion/rocsparse_inverse_permutation.h"
+#include "rocsparse_gebsr2gebsc_analysis.hpp"
+#include "utility.h"
+
+#include "gebsr2gebsc_device.h"
+#include <rocprim/rocprim.hpp>
+
+rocsparse_status rocsparse::gebsr2gebsc_analysis_template(rocsparse_handle     handle, //0
+                                                          rocsparse_int        mb, //1
+                                                          rocsparse_int        nb, //2
+                                                          rocsparse_int        nnzb, //3
+                                                          const rocsparse_int* bsr_row_ptr, //4
+                                                          const rocsparse_int* bsr_col_ind, //5
+                                                          rocsparse_int        row_block_dim, //6
+                                                          rocsparse_int        col_block_dim, //7
+                                                          rocsparse_int*       bsc_row_ind, //8
+                                                          rocsparse_int*       bsc_col_ptr, //9
+                                                          rocsparse_index_base idx_base, //10
+                                                          rocsparse_mat_info   info, //11
+                                                          void*                temp_buffer) //12
+{
+    // Logging
+    rocsparse::log_trace(handle,
+                         "rocsparse_gebsr2gebsc_analysis",
+                         mb,
+                         nb,
+                         nnzb,
+                         (const void*&)bsr_row_ptr,
+                         (const void*&)bsr_col_ind,
+                         row_block_dim,
+                         col_block_dim,
+                         (const void*&)bsc_row_ind,
+                         (const void*&)bsc_col_ptr,
+                         idx_base,
+                         (const void*&)info,
+                         (const void*&)temp_buffer);
+
+    ROCSPARSE_CHECKARG_HANDLE(0, handle);
+    ROCSPARSE_CHECKARG_SIZE(1, mb);
+    ROCSPARSE_CHECKARG_SIZE(2, nb);
+    ROCSPARSE_CHECKARG_SIZE(3, nnzb);
+    ROCSPARSE_CHECKARG_SIZE(6, row_block_dim);
+    ROCSPARSE_CHECKARG_SIZE(7, col_block_dim);
+    ROCSPARSE_CHECKARG(6, row_block_dim, (row_block_dim == 0), rocsparse_status_invalid_size);
+    ROCSPARSE_CHECKARG(7, col_block_dim, (col_block_dim == 0), rocsparse_status_invalid_size);
+    ROCSPARSE_CHECKARG_ENUM(10, idx_base);
+    ROCSPARSE_CHECKARG_POINTER(11, info);
+
+    // Quick return if possible
+    if(mb == 0 || nb == 0 || nnzb == 0)
+    {
+        if(bsc_col_ptr != nullptr)
+        {
+            RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::set_array_to_value<256>),
+                                               dim3(nb / 256 + 1),
+                                               dim3(256),
+                                               0,
+                                               handle->stream,
+                                               (nb + 1),
+                                               bsc_col_ptr,
+                                               static_cast<rocsparse_int>(idx_base));
+        }
+
+        return rocsparse_status_success;
+    }
+
+    ROCSPARSE_CHECKARG_ARRAY(4, mb, bsr_row_ptr);
+    ROCSPARSE_CHECKARG_ARRAY(5, nnzb, bsr_col_ind);
+    ROCSPARSE_CHECKARG_ARRAY(8, nnzb, bsc_row_ind);
+    ROCSPARSE_CHECKARG_ARRAY(9, nb, bsc_col_ptr);
+    ROCSPARSE_CHECKARG_ARRAY(12, nnzb, temp_buffer);
+
+    // Stream
+    hipStream_t  stream   = handle->stream;
+    unsigned int startbit = 0;
+    unsigned int endbit   = rocsparse::clz(nb);
+
+    // Create gebsr2gebsc info, if not yet available
+    if(info->gebsr2gebsc_info == nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::create_csr2csc_info(&info->gebsr2gebsc_info));
+    }
+
+    rocsparse_csr2csc_info gebsr2gebsc_info = info->gebsr2gebsc_info;
+
+    // Permutation of a previous analysis can only be re-used if it is of the same size
+    if(gebsr2gebsc_info->perm != nullptr && gebsr2gebsc_info->nnz != nnzb)
+    {
+        RETURN_IF_HIP_ERROR(rocsparse_hipFreeAsync(gebsr2gebsc_info->perm, stream));
+        gebsr2gebsc_info->perm = nullptr;
+    }
+
+    if(gebsr2gebsc_info->perm == nullptr)
+    {
+        RETURN_IF_HIP_ERROR(rocsparse_hipMallocAsync(
+            &gebsr2gebsc_info->perm, sizeof(rocsparse_int) * nnzb, stream));
+    }
+
+    gebsr2gebsc_info->m             = mb;
+    gebsr2gebsc_info->n             = nb;
+    gebsr2gebsc_info->nnz           = nnzb;
+    gebsr2gebsc_info->row_block_dim = row_block_dim;
+    gebsr2gebsc_info->col_block_dim = col_block_dim;
+    gebsr2gebsc_info->index_type_I  = rocsparse::get_indextype<rocsparse_int>();
+
+    rocsparse_int* perm = reinterpret_cast<rocsparse_int*>(gebsr2gebsc_info->perm);
+
+    // Temporary buffer entry points
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // work1 buffer
+    rocsparse_int* tmp_work1 = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += ((sizeof(rocsparse_int) * nnzb - 1) / 256 + 1) * 256;
+
+    // work2 buffer
+    rocsparse_int* tmp_work2 = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += ((sizeof(rocsparse_int) * nnzb - 1) / 256 + 1) * 256;
+
+    // perm buffer
+    rocsparse_int* tmp_perm = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += ((sizeof(rocsparse_int) * nnzb - 1) / 256 + 1) * 256;
+
+    // rocprim buffer
+    void* tmp_rocprim = reinterpret_cast<void*>(ptr);
+
+    // Load BSR column indices into work1 buffer
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        tmp_work1, bsr_col_ind, sizeof(rocsparse_int) * nnzb, hipMemcpyDeviceToDevice, stream));
+
+    // Create identitiy permutation
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_identity_permutation(handle, nnzb, tmp_perm));
+
+    // Stable sort COO by columns
+    rocprim::double_buffer<rocsparse_int> keys(tmp_work1, bsc_row_ind);
+    rocprim::double_buffer<rocsparse_int> vals(tmp_perm, tmp_work2);
+
+    size_t size = 0;
+
+    RETURN_IF_HIP_ERROR(
+        rocprim::radix_sort_pairs(nullptr, size, keys, vals, nnzb, startbit, endbit, stream));
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+        tmp_rocprim, size, keys, vals, nnzb, startbit, endbit, stream));
+
+    // Create column pointers
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_coo2csr(handle, keys.current(), nnzb, nb, bsc_col_ptr, idx_base));
+
+    // Store the block permutation, it is all that is required to transpose the values later on
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        perm, vals.current(), sizeof(rocsparse_int) * nnzb, hipMemcpyDeviceToDevice, stream));
+
+    // Create row indices
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_csr2coo(handle, bsr_row_ptr, nnzb, mb, tmp_work1, idx_base));
+
+    // Permute row indices
+    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::gebsr2gebsc_gather_kernel<512>),
+                                       dim3((nnzb - 1) / 512 + 1),
+                                       dim3(512),
+                                       0,
+                                       stream,
+                                       nnzb,
+                                       1,
+                                       perm,
+                                       tmp_work1,
+                                       bsc_row_ind);
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse::gebsr2gebsc_numeric_template(rocsparse_handle   handle, //0
+                                                         rocsparse_int      mb, //1
+                                                         rocsparse_int      nb, //2
+                                                         rocsparse_int      nnzb, //3
+                                                         const T*           bsr_val, //4
+                                                         rocsparse_int      row_block_dim, //5
+                                                         rocsparse_int      col_block_dim, //6
+                                                         T*                 bsc_val, //7
+                                                         rocsparse_mat_info info) //8
+{
+    // Logging
+    rocsparse::log_trace(handle,
+                         rocsparse::replaceX<T>("rocsparse_Xgebsr2gebsc_numeric"),
+                         mb,
+                         nb,
+                         nnzb,
+                         (const void*&)bsr_val,
+                         row_block_dim,
+                         col_block_dim,
+                         (const void*&)bsc_val,
+                         (const void*&)info);
+
+    ROCSPARSE_CHECKARG_HANDLE(0, handle);
+    ROCSPARSE_CHECKARG_SIZE(1, mb);
+    ROCSPARSE_CHECKARG_SIZE(2, nb);
+    ROCSPARSE_CHECKARG_SIZE(3, nnzb);
+    ROCSPARSE_CHECKARG_SIZE(5, row_block_dim);
+    ROCSPARSE_CHECKARG_SIZE(6, col_block_dim);
+    ROCSPARSE_CHECKARG(5, row_block_dim, (row_block_dim == 0), rocsparse_status_invalid_size);
+    ROCSPARSE_CHECKARG(6, col_block_dim, (col_block_dim == 0), rocsparse_status_invalid_size);
+    ROCSPARSE_CHECKARG_ARRAY(4, nnzb, bsr_val);
+    ROCSPARSE_CHECKARG_ARRAY(7, nnzb, bsc_val);
+    ROCSPARSE_CHECKARG_POINTER(8, info);
+
+    // Quick return if possible
+    if(mb == 0 || nb == 0 || nnzb == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Analysis must have been performed on a matrix of the same dimensions
+    rocsparse_csr2csc_info gebsr2gebsc_info = info->gebsr2gebsc_info;
+
+    ROCSPARSE_CHECKARG(8, info, (gebsr2gebsc_info == nullptr), rocsparse_status_invalid_pointer);
+    ROCSPARSE_CHECKARG(1, mb, (gebsr2gebsc_info->m != mb), rocsparse_status_invalid_size);
+    ROCSPARSE_CHECKARG(2, nb, (gebsr2gebsc_info->n != nb), rocsparse_status_invalid_size);
+    ROCSPARSE_CHECKARG(3, nnzb, (gebsr2gebsc_info->nnz != nnzb), rocsparse_status_invalid_size);
+    ROCSPARSE_CHECKARG(5,
+                       row_block_dim,
+                       (gebsr2gebsc_info->row_block_dim != row_block_dim),
+                       rocsparse_status_invalid_size);
+    ROCSPARSE_CHECKARG(6,
+                       col_block_dim,
+                       (gebsr2gebsc_info->col_block_dim != col_block_dim),
+                       rocsparse_status_invalid_size);
+
+    // Apply the block permutation of the analysis to the values, blocks are copied as is
+    const int64_t linsize_block = static_cast<int64_t>(row_block_dim) * col_block_dim;
+    const int64_t nvalues       = linsize_block * nnzb;
+
+    const rocsparse_int* perm = reinterpret_cast<const rocsparse_int*>(gebsr2gebsc_info->perm);
+
+    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::gebsr2gebsc_gather_kernel<512>),
+                                       dim3((nvalues - 1) / 512 + 1),
+                                       dim3(512),
+                                       0,
+                                       handle->stream,
+                                       nnzb,
+                                       static_cast<rocsparse_int>(linsize_block),
+                                       perm,
+                                       bsr_val,
+                                       bsc_val);
+
+    return rocsparse_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+extern "C" rocsparse_status rocsparse_gebsr2gebsc_analysis(rocsparse_handle     handle,
+                                                           rocsparse_int        mb,
+                                                           rocsparse_int        nb,
+                                                           rocsparse_int        nnzb,
+                                                           const rocsparse_int* bsr_row_ptr,
+                                                           const rocsparse_int* bsr_col_ind,
+                                                           rocsparse_int        row_block_dim,
+                                                           rocsparse_int        col_block_dim,
+                                                           rocsparse_int*       bsc_row_ind,
+                                                           rocsparse_int*       bsc_col_ptr,
+                                                           rocsparse_index_base idx_base,
+                                                           rocsparse_mat_info   info,
+                                                           void*                temp_buffer)
+try
+{
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::gebsr2gebsc_analysis_template(handle,
+                                                                       mb,
+                                                                       nb,
+                                                                       nnzb,
+                                                                       bsr_row_ptr,
+                                                                       bsr_col_ind,
+                                                                       row_block_dim,
+                                                                       col_block_dim,
+                                                                       bsc_row_ind,
+                                                                       bsc_col_ptr,
+                                                                       idx_base,
+                                                                       info,
+                                                                       temp_buffer));
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
+
+#define C_IMPL(NAME, TYPE)                                                               \
+    extern "C" rocsparse_status NAME(rocsparse_handle   handle,                          \
+                                     rocsparse_int      mb,                              \
+                                     rocsparse_int      nb,                              \
+                                     rocsparse_int      nnzb,                            \
+                                     const TYPE*        bsr_val,                         \
+                                     rocsparse_int      row_block_dim,                   \
+                                     rocsparse_int      col_block_dim,                   \
+                                     TYPE*              bsc_val,                         \
+                                     rocsparse_mat_info info)                            \
+    try                                                                                  \
+    {                                                                                    \
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::gebsr2gebsc_numeric_template(handle,        \
+                                                                          mb,            \
+                                                                          nb,            \
+                                                                          nnzb,          \
+                                                                          bsr_val,       \
+                                                                          row_block_dim, \
+                                                                          col_block_dim, \
+                                                                          bsc_val,       \
+                                                                          info));        \
+        return rocsparse_status_success;                                                 \
+    }                                                                                    \
+    catch(...)                                                                           \
+    {                                                                                    \
+        RETURN_ROCSPARSE_EXCEPTION();                                                    \
+    }
+
+C_IMPL(rocsparse_sgebsr2gebsc_numeric, float);
+C_IMPL(rocsparse_dgebsr2gebsc_numeric, double);
+C_IMPL(rocsparse_cgebsr2gebsc_numeric, rocsparse_float_complex);
+C_IMPL(rocsparse_zgebsr2gebsc_numeric, rocsparse_double_complex);
+#undef C_IMPL
+
+extern "C" rocsparse_status rocsparse_gebsr2gebsc_clear(rocsparse_handle   handle,
+                                                        rocsparse_mat_info info)
+try
+{
+    ROCSPARSE_CHECKARG_HANDLE(0, handle);
+    ROCSPARSE_CHECKARG_POINTER(1, info);
+
+    // Logging
+    rocsparse::log_trace(handle, "rocsparse_gebsr2gebsc_clear", (const void*&)info);
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::destroy_csr2csc_info(info->gebsr2gebsc_info));
+    info->gebsr2gebsc_info = nullptr;
+
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
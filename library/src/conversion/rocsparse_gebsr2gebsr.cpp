@@ -317,6 +317,9 @@ rocsparse_status rocsparse::gebsr2gebsr_template(rocsparse_handle          handl
     rocsparse_int nnzb_C = 0;
     if(bsr_row_ptr_C != nullptr)
     {
+        // The number of blocks of C is read back on the host
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
         RETURN_IF_HIP_ERROR(hipMemcpyAsync(&end,
                                            &bsr_row_ptr_C[mb_c],
                                            sizeof(rocsparse_int),
@@ -552,6 +555,8 @@ try
 
     if(bsr_col_ind == nullptr)
     {
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
         rocsparse_int start = 0;
         rocsparse_int end   = 0;
 
@@ -802,6 +807,12 @@ try
         return rocsparse_status_success;
     }
 
+    // The number of blocks is only read back on the host in host pointer mode
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+    }
+
     // Common case where BSR block dimension is small
     if(row_block_dim_C <= 32)
     {
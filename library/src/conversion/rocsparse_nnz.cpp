@@ -247,6 +247,14 @@ rocsparse_status rocsparse::nnz_impl(rocsparse_handle          handle,
         return rocsparse_status_success;
     }
 
+    //
+    // The total number of non-zeros is only read back on the host in host pointer mode.
+    //
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+    }
+
     //
     // Count.
     //
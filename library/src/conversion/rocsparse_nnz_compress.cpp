@@ -106,6 +106,9 @@ rocsparse_status rocsparse::nnz_compress_template(rocsparse_handle          hand
     ROCSPARSE_CHECKARG_POINTER(5, nnz_per_row);
     ROCSPARSE_CHECKARG_POINTER(6, nnz_C);
 
+    // The number of non-zeros of A is read back on the host
+    RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
     // Find number of non-zeros in input CSR matrix on host
     rocsparse_int nnz_A, nnz_A_0;
     RETURN_IF_HIP_ERROR(hipMemcpyAsync(
@@ -0,0 +1,164 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "rocsparse_prune_by_percentage_select.hpp"
+#include "control.h"
+#include "utility.h"
+
+#include "prune_by_percentage_device.h"
+
+#define PRUNE_SELECT_BLOCKSIZE 256
+#define PRUNE_SELECT_MAX_BLOCKS 1024
+#define PRUNE_SELECT_RADIX_BITS 8
+#define PRUNE_SELECT_RADIX (1 << PRUNE_SELECT_RADIX_BITS)
+
+namespace rocsparse
+{
+    template <uint32_t BLOCKSIZE, uint32_t RADIX_BITS, typename T>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void prune_select_histogram_kernel(rocsparse_int m,
+                                       rocsparse_int n,
+                                       const T* __restrict__ A,
+                                       int64_t  lda,
+                                       uint32_t shift,
+                                       const typename prune_select_traits<T>::key_type* prefix,
+                                       rocsparse_int* __restrict__ hist)
+    {
+        rocsparse::prune_select_histogram_device<BLOCKSIZE, RADIX_BITS>(
+            m, n, A, lda, shift, prefix, hist);
+    }
+
+    template <uint32_t RADIX_BITS, typename T>
+    ROCSPARSE_KERNEL(1 << RADIX_BITS)
+    void prune_select_digit_kernel(uint32_t      shift,
+                                   rocsparse_int pos,
+                                   typename prune_select_traits<T>::key_type* __restrict__ prefix,
+                                   rocsparse_int* __restrict__ rank,
+                                   rocsparse_int* __restrict__ hist,
+                                   T* __restrict__ threshold)
+    {
+        rocsparse::prune_select_digit_device<RADIX_BITS>(shift, pos, prefix, rank, hist, threshold);
+    }
+}
+
+template <typename T>
+size_t rocsparse::prune_by_percentage_select_buffer_size()
+{
+    // Threshold, histogram, prefix and rank, each aligned to 256 bytes
+    return 256 + ((sizeof(rocsparse_int) * PRUNE_SELECT_RADIX - 1) / 256 + 1) * 256 + 256 + 256;
+}
+
+template <typename T>
+rocsparse_status rocsparse::prune_by_percentage_select_template(rocsparse_handle handle,
+                                                                rocsparse_int    m,
+                                                                rocsparse_int    n,
+                                                                const T*         A,
+                                                                int64_t          lda,
+                                                                rocsparse_int    pos,
+                                                                void*            temp_buffer)
+{
+    typedef typename rocsparse::prune_select_traits<T>::key_type K;
+
+    hipStream_t stream = handle->stream;
+
+    // Temporary buffer entry points
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    T* threshold = reinterpret_cast<T*>(ptr);
+    ptr += 256;
+
+    rocsparse_int* hist = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += ((sizeof(rocsparse_int) * PRUNE_SELECT_RADIX - 1) / 256 + 1) * 256;
+
+    K* prefix = reinterpret_cast<K*>(ptr);
+    ptr += 256;
+
+    rocsparse_int* rank = reinterpret_cast<rocsparse_int*>(ptr);
+
+    RETURN_IF_HIP_ERROR(
+        hipMemsetAsync(hist, 0, sizeof(rocsparse_int) * PRUNE_SELECT_RADIX, stream));
+
+    const int64_t size = static_cast<int64_t>(m) * n;
+
+    dim3 grid(std::min((size - 1) / PRUNE_SELECT_BLOCKSIZE + 1,
+                       static_cast<int64_t>(PRUNE_SELECT_MAX_BLOCKS)));
+    dim3 threads(PRUNE_SELECT_BLOCKSIZE);
+
+    // One histogram and one digit selection per radix digit, starting with the most
+    // significant one. Each pass only counts the keys that share the digits selected
+    // so far, such that no keys have to be moved.
+    static constexpr uint32_t bits = 8 * sizeof(K);
+
+    for(uint32_t pass = 1; pass * PRUNE_SELECT_RADIX_BITS <= bits; ++pass)
+    {
+        const uint32_t shift = bits - pass * PRUNE_SELECT_RADIX_BITS;
+
+        RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+            (rocsparse::prune_select_histogram_kernel<PRUNE_SELECT_BLOCKSIZE,
+                                                      PRUNE_SELECT_RADIX_BITS,
+                                                      T>),
+            grid,
+            threads,
+            0,
+            stream,
+            m,
+            n,
+            A,
+            lda,
+            shift,
+            prefix,
+            hist);
+
+        RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+            (rocsparse::prune_select_digit_kernel<PRUNE_SELECT_RADIX_BITS, T>),
+            dim3(1),
+            dim3(PRUNE_SELECT_RADIX),
+            0,
+            stream,
+            shift,
+            pos,
+            prefix,
+            rank,
+            hist,
+            threshold);
+    }
+
+    return rocsparse_status_success;
+}
+
+#define INSTANTIATE(TTYPE)                                                                \
+    template size_t           rocsparse::prune_by_percentage_select_buffer_size<TTYPE>(); \
+    template rocsparse_status rocsparse::prune_by_percentage_select_template<TTYPE>(      \
+        rocsparse_handle handle,                                                          \
+        rocsparse_int    m,                                                               \
+        rocsparse_int    n,                                                               \
+        const TTYPE*     A,                                                               \
+        int64_t          lda,                                                             \
+        rocsparse_int    pos,                                                             \
+        void*            temp_buffer);
+
+INSTANTIATE(float);
+INSTANTIATE(double);
+#undef INSTANTIATE
@@ -0,0 +1,48 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+
+#include "handle.h"
+
+namespace rocsparse
+{
+    // Size in bytes of the temporary storage required by
+    // prune_by_percentage_select_template.
+    template <typename T>
+    size_t prune_by_percentage_select_buffer_size();
+
+    // Determines the element of rank pos (starting at zero) among the absolute
+    // values of the m x n column major matrix A, using a most significant digit
+    // radix select. The threshold is written to the first entry of temp_buffer.
+    template <typename T>
+    rocsparse_status prune_by_percentage_select_template(rocsparse_handle handle,
+                                                         rocsparse_int    m,
+                                                         rocsparse_int    n,
+                                                         const T*         A,
+                                                         int64_t          lda,
+                                                         rocsparse_int    pos,
+                                                         void*            temp_buffer);
+}
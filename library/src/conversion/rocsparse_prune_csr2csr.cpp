@@ -298,6 +298,9 @@ rocsparse_status rocsparse::prune_csr2csr_nnz_template(rocsparse_handle
     ROCSPARSE_CHECKARG_POINTER(8, threshold);
     ROCSPARSE_CHECKARG_POINTER(11, nnz_total_dev_host_ptr);
 
+    // The threshold and the number of non-zeros of A are read back on the host
+    RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
     // Copy threshold to host
     T h_threshold;
     if(handle->pointer_mode == rocsparse_pointer_mode_device)
@@ -428,12 +431,8 @@ namespace rocsparse
         if(csr_val_C == nullptr || csr_col_ind_C == nullptr)
         {
             int64_t nnz_C;
-            RETURN_IF_ROCSPARSE_ERROR(
-                rocsparse::calculate_nnz(m,
-                                         rocsparse::get_indextype<rocsparse_int>(),
-                                         csr_row_ptr_C,
-                                         &nnz_C,
-                                         handle->stream));
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse::calculate_nnz(
+                handle, m, rocsparse::get_indextype<rocsparse_int>(), csr_row_ptr_C, &nnz_C));
 
             ROCSPARSE_CHECKARG_ARRAY(10, nnz_C, csr_val_C);
             ROCSPARSE_CHECKARG_ARRAY(12, nnz_C, csr_col_ind_C);
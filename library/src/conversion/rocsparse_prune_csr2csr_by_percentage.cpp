@@ -25,11 +25,11 @@
 #include "internal/conversion/rocsparse_prune_csr2csr_by_percentage.h"
 #include "control.h"
 #include "rocsparse_nnz_compress.hpp"
+#include "rocsparse_prune_by_percentage_select.hpp"
 #include "rocsparse_prune_csr2csr_by_percentage.hpp"
 #include "utility.h"
 
 #include "csr2csr_compress_device.h"
-#include "prune_csr2csr_by_percentage_device.h"
 #include <rocprim/rocprim.hpp>
 
 namespace rocsparse
@@ -218,7 +218,7 @@ namespace rocsparse
         //	ROCSPARSE_CHECKARG_ARRAY(12,nnz_C, csr_col_ind_C);
         //      }
 
-        *buffer_size = std::max(sizeof(T) * 2 * nnz_A, size_t(512));
+        *buffer_size = rocsparse::prune_by_percentage_select_buffer_size<T>();
         return rocsparse_status_success;
     }
 }
@@ -316,37 +316,20 @@ rocsparse_status
     ROCSPARSE_CHECKARG_POINTER(11, nnz_total_dev_host_ptr);
     ROCSPARSE_CHECKARG_POINTER(14, temp_buffer);
 
+    // The threshold and the number of non-zeros of A are read back on the host
+    RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
     rocsparse_int pos = std::ceil(nnz_A * (percentage / 100)) - 1;
     pos               = std::min(pos, nnz_A - 1);
     pos               = std::max(pos, 0);
 
-    T* output = reinterpret_cast<T*>(temp_buffer);
-
-    // Compute absolute value of csr_val_A and store in first half of output array
-    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((abs_kernel<256, T>),
-                                       dim3((nnz_A - 1) / 256 + 1),
-                                       dim3(256),
-                                       0,
-                                       stream,
-                                       nnz_A,
-                                       csr_val_A,
-                                       output);
+    // Select the threshold, it is stored at the first entry of the temporary buffer
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::prune_by_percentage_select_template(
+        handle, nnz_A, 1, csr_val_A, static_cast<int64_t>(nnz_A), pos, temp_buffer));
 
-    // Determine amount of temporary storage needed for rocprim sort and inclusive scan and allocate if necessary
-    size_t temp_storage_size_bytes_sort = 0;
+    // Determine amount of temporary storage needed for rocprim inclusive scan and allocate if necessary
     size_t temp_storage_size_bytes_scan = 0;
 
-    unsigned int startbit = 0;
-    unsigned int endbit   = 8 * sizeof(T);
-    RETURN_IF_HIP_ERROR(rocprim::radix_sort_keys(nullptr,
-                                                 temp_storage_size_bytes_sort,
-                                                 output,
-                                                 (output + nnz_A),
-                                                 nnz_A,
-                                                 startbit,
-                                                 endbit,
-                                                 handle->stream));
-
     RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(nullptr,
                                                 temp_storage_size_bytes_scan,
                                                 csr_row_ptr_C,
@@ -355,8 +338,7 @@ rocsparse_status
                                                 rocprim::plus<rocsparse_int>(),
                                                 handle->stream));
 
-    const size_t temp_storage_size_bytes
-        = std::max(temp_storage_size_bytes_sort, temp_storage_size_bytes_scan);
+    const size_t temp_storage_size_bytes = temp_storage_size_bytes_scan;
 
     // Device buffer should be sufficient for rocprim in most cases
     bool  temp_alloc       = false;
@@ -373,20 +355,13 @@ rocsparse_status
         temp_alloc = true;
     }
 
-    // perform sort on first half of output array and store result in second half of output array
-    rocprim::radix_sort_keys(temp_storage_ptr,
-                             temp_storage_size_bytes_sort,
-                             output,
-                             (output + nnz_A),
-                             nnz_A,
-                             startbit,
-                             endbit,
-                             handle->stream);
-
     // Copy threshold to host
     T h_threshold;
-    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-        &h_threshold, &output[nnz_A + pos], sizeof(T), hipMemcpyDeviceToHost, handle->stream));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(&h_threshold,
+                                       reinterpret_cast<T*>(temp_buffer),
+                                       sizeof(T),
+                                       hipMemcpyDeviceToHost,
+                                       handle->stream));
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
 
     RETURN_IF_ROCSPARSE_ERROR(rocsparse::nnz_compress_template(handle,
@@ -398,10 +373,6 @@ rocsparse_status
                                                                nnz_total_dev_host_ptr,
                                                                h_threshold));
 
-    // Store threshold at first entry in output array
-    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-        output, &output[nnz_A + pos], sizeof(T), hipMemcpyDeviceToDevice, handle->stream));
-
     // Compute csr_row_ptr_C with the right index base.
     RETURN_IF_HIP_ERROR(hipMemcpyAsync(csr_row_ptr_C,
                                        &csr_descr_C->base,
@@ -501,7 +472,7 @@ rocsparse_status
     {
         int64_t nnz_C;
         RETURN_IF_ROCSPARSE_ERROR(rocsparse::calculate_nnz(
-            m, rocsparse::get_indextype<rocsparse_int>(), csr_row_ptr_C, &nnz_C, handle->stream));
+            handle, m, rocsparse::get_indextype<rocsparse_int>(), csr_row_ptr_C, &nnz_C));
 
         ROCSPARSE_CHECKARG_ARRAY(10, nnz_C, csr_val_C);
         ROCSPARSE_CHECKARG_ARRAY(12, nnz_C, csr_col_ind_C);
@@ -516,6 +487,8 @@ rocsparse_status
     }
     else
     {
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
         RETURN_IF_HIP_ERROR(hipMemcpyAsync(&h_threshold,
                                            &(reinterpret_cast<T*>(temp_buffer))[0],
                                            sizeof(T),
@@ -0,0 +1,654 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "internal/conversion/rocsparse_prune_csr2csr_by_strength.h"
+#include "control.h"
+#include "rocsparse_prune_csr2csr_by_strength.hpp"
+#include "utility.h"
+
+#include "prune_csr2csr_by_strength_device.h"
+#include <rocprim/rocprim.hpp>
+
+namespace rocsparse
+{
+    template <unsigned int BLOCKSIZE>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void prune_csr2csr_by_strength_nnz_total_kernel(rocsparse_int m,
+                                                    const rocsparse_int* __restrict__ csr_row_ptr_C,
+                                                    rocsparse_index_base idx_base_C,
+                                                    rocsparse_int* __restrict__ nnz_total)
+    {
+        if(hipThreadIdx_x == 0)
+        {
+            *nnz_total = csr_row_ptr_C[m] - idx_base_C;
+        }
+    }
+
+#define LAUNCH_PRUNE_CSR2CSR_BY_STRENGTH_NNZ(WFSIZE, THETA)                                 \
+    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(                                                     \
+        (rocsparse::prune_csr2csr_by_strength_diag_kernel<BLOCKSIZE, WFSIZE>),              \
+        dim3((m - 1) / (BLOCKSIZE / WFSIZE) + 1),                                           \
+        dim3(BLOCKSIZE),                                                                    \
+        0,                                                                                  \
+        handle->stream,                                                                     \
+        m,                                                                                  \
+        csr_val_A,                                                                          \
+        csr_row_ptr_A,                                                                      \
+        csr_col_ind_A,                                                                      \
+        csr_descr_A->base,                                                                  \
+        diag);                                                                              \
+    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(                                                     \
+        (rocsparse::prune_csr2csr_by_strength_nnz_kernel<BLOCKSIZE, WFSIZE>),               \
+        dim3((m - 1) / (BLOCKSIZE / WFSIZE) + 1),                                           \
+        dim3(BLOCKSIZE),                                                                    \
+        0,                                                                                  \
+        handle->stream,                                                                     \
+        m,                                                                                  \
+        csr_val_A,                                                                          \
+        csr_row_ptr_A,                                                                      \
+        csr_col_ind_A,                                                                      \
+        csr_descr_A->base,                                                                  \
+        diag,                                                                               \
+        THETA,                                                                              \
+        csr_row_ptr_C + 1)
+
+    template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+    static rocsparse_status
+        prune_csr2csr_by_strength_nnz_dispatch(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               const rocsparse_mat_descr csr_descr_A,
+                                               const T*                  csr_val_A,
+                                               const rocsparse_int*      csr_row_ptr_A,
+                                               const rocsparse_int*      csr_col_ind_A,
+                                               const T*                  theta,
+                                               rocsparse_int*            csr_row_ptr_C,
+                                               T*                        diag)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            LAUNCH_PRUNE_CSR2CSR_BY_STRENGTH_NNZ(WFSIZE, theta);
+        }
+        else
+        {
+            LAUNCH_PRUNE_CSR2CSR_BY_STRENGTH_NNZ(WFSIZE, *theta);
+        }
+
+        return rocsparse_status_success;
+    }
+
+#undef LAUNCH_PRUNE_CSR2CSR_BY_STRENGTH_NNZ
+
+    template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T, typename U>
+    static rocsparse_status
+        prune_csr2csr_by_strength_fill_dispatch(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                const rocsparse_mat_descr csr_descr_A,
+                                                const T*                  csr_val_A,
+                                                const rocsparse_int*      csr_row_ptr_A,
+                                                const rocsparse_int*      csr_col_ind_A,
+                                                const T*                  diag,
+                                                U                         theta,
+                                                const rocsparse_mat_descr csr_descr_C,
+                                                T*                        csr_val_C,
+                                                const rocsparse_int*      csr_row_ptr_C,
+                                                rocsparse_int*            csr_col_ind_C)
+    {
+        RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+            (rocsparse::prune_csr2csr_by_strength_kernel<BLOCKSIZE, WFSIZE>),
+            dim3((m - 1) / (BLOCKSIZE / WFSIZE) + 1),
+            dim3(BLOCKSIZE),
+            0,
+            handle->stream,
+            m,
+            csr_val_A,
+            csr_row_ptr_A,
+            csr_col_ind_A,
+            csr_descr_A->base,
+            diag,
+            theta,
+            csr_val_C,
+            csr_row_ptr_C,
+            csr_col_ind_C,
+            csr_descr_C->base);
+
+        return rocsparse_status_success;
+    }
+}
+
+template <typename T>
+rocsparse_status rocsparse::prune_csr2csr_by_strength_buffer_size_template(
+    rocsparse_handle          handle, //0
+    rocsparse_int             m, //1
+    rocsparse_int             nnz_A, //2
+    const rocsparse_mat_descr csr_descr_A, //3
+    const T*                  csr_val_A, //4
+    const rocsparse_int*      csr_row_ptr_A, //5
+    const rocsparse_int*      csr_col_ind_A, //6
+    const T*                  theta, //7
+    const rocsparse_mat_descr csr_descr_C, //8
+    size_t*                   buffer_size) //9
+{
+    rocsparse::log_trace(handle,
+                         rocsparse::replaceX<T>("rocsparse_Xprune_csr2csr_by_strength_buffer_size"),
+                         m,
+                         nnz_A,
+                         csr_descr_A,
+                         (const void*&)csr_val_A,
+                         (const void*&)csr_row_ptr_A,
+                         (const void*&)csr_col_ind_A,
+                         (const void*&)theta,
+                         csr_descr_C,
+                         (const void*&)buffer_size);
+
+    ROCSPARSE_CHECKARG_HANDLE(0, handle);
+    ROCSPARSE_CHECKARG_SIZE(1, m);
+    ROCSPARSE_CHECKARG_SIZE(2, nnz_A);
+    ROCSPARSE_CHECKARG_POINTER(3, csr_descr_A);
+    ROCSPARSE_CHECKARG(3,
+                       csr_descr_A,
+                       (csr_descr_A->storage_mode != rocsparse_storage_mode_sorted),
+                       rocsparse_status_requires_sorted_storage);
+    ROCSPARSE_CHECKARG_ARRAY(4, nnz_A, csr_val_A);
+    ROCSPARSE_CHECKARG_ARRAY(5, m, csr_row_ptr_A);
+    ROCSPARSE_CHECKARG_ARRAY(6, nnz_A, csr_col_ind_A);
+    ROCSPARSE_CHECKARG_POINTER(7, theta);
+    ROCSPARSE_CHECKARG_POINTER(8, csr_descr_C);
+    ROCSPARSE_CHECKARG(8,
+                       csr_descr_C,
+                       (csr_descr_C->storage_mode != rocsparse_storage_mode_sorted),
+                       rocsparse_status_requires_sorted_storage);
+    ROCSPARSE_CHECKARG_POINTER(9, buffer_size);
+
+    // Diagonal magnitudes of A
+    *buffer_size = ((sizeof(T) * m - 1) / 256 + 1) * 256;
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status
+    rocsparse::prune_csr2csr_by_strength_nnz_template(rocsparse_handle          handle, //0
+                                                      rocsparse_int             m, //1
+                                                      rocsparse_int             nnz_A, //2
+                                                      const rocsparse_mat_descr csr_descr_A, //3
+                                                      const T*                  csr_val_A, //4
+                                                      const rocsparse_int*      csr_row_ptr_A, //5
+                                                      const rocsparse_int*      csr_col_ind_A, //6
+                                                      const T*                  theta, //7
+                                                      const rocsparse_mat_descr csr_descr_C, //8
+                                                      rocsparse_int*            csr_row_ptr_C, //9
+                                                      rocsparse_int* nnz_total_dev_host_ptr, //10
+                                                      void*          temp_buffer) //11
+{
+    // Logging
+    rocsparse::log_trace(handle,
+                         rocsparse::replaceX<T>("rocsparse_Xprune_csr2csr_by_strength_nnz"),
+                         m,
+                         nnz_A,
+                         csr_descr_A,
+                         (const void*&)csr_val_A,
+                         (const void*&)csr_row_ptr_A,
+                         (const void*&)csr_col_ind_A,
+                         (const void*&)theta,
+                         csr_descr_C,
+                         (const void*&)csr_row_ptr_C,
+                         (const void*&)nnz_total_dev_host_ptr,
+                         (const void*&)temp_buffer);
+
+    ROCSPARSE_CHECKARG_HANDLE(0, handle);
+    ROCSPARSE_CHECKARG_SIZE(1, m);
+    ROCSPARSE_CHECKARG_SIZE(2, nnz_A);
+    ROCSPARSE_CHECKARG_POINTER(3, csr_descr_A);
+    ROCSPARSE_CHECKARG(3,
+                       csr_descr_A,
+                       (csr_descr_A->storage_mode != rocsparse_storage_mode_sorted),
+                       rocsparse_status_requires_sorted_storage);
+    ROCSPARSE_CHECKARG_ARRAY(4, nnz_A, csr_val_A);
+    ROCSPARSE_CHECKARG_ARRAY(5, m, csr_row_ptr_A);
+    ROCSPARSE_CHECKARG_ARRAY(6, nnz_A, csr_col_ind_A);
+    ROCSPARSE_CHECKARG_POINTER(8, csr_descr_C);
+    ROCSPARSE_CHECKARG(8,
+                       csr_descr_C,
+                       (csr_descr_C->storage_mode != rocsparse_storage_mode_sorted),
+                       rocsparse_status_requires_sorted_storage);
+    ROCSPARSE_CHECKARG_ARRAY(9, m, csr_row_ptr_C);
+    ROCSPARSE_CHECKARG_POINTER(10, nnz_total_dev_host_ptr);
+
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0 || nnz_A == 0)
+    {
+        if(csr_row_ptr_C != nullptr)
+        {
+            RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::set_array_to_value<256>),
+                                               dim3(m / 256 + 1),
+                                               dim3(256),
+                                               0,
+                                               stream,
+                                               (m + 1),
+                                               csr_row_ptr_C,
+                                               static_cast<rocsparse_int>(csr_descr_C->base));
+        }
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(
+                hipMemsetAsync(nnz_total_dev_host_ptr, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *nnz_total_dev_host_ptr = 0;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    ROCSPARSE_CHECKARG_POINTER(7, theta);
+    ROCSPARSE_CHECKARG_POINTER(11, temp_buffer);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        ROCSPARSE_CHECKARG(7, theta, (*theta < static_cast<T>(0)), rocsparse_status_invalid_value);
+
+        // The number of strong connections is read back on the host
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+    }
+
+    T* diag = reinterpret_cast<T*>(temp_buffer);
+
+    static constexpr unsigned int BLOCKSIZE = 256;
+
+    // Each row is processed by a (sub)wavefront, depending on the mean number of entries per row
+    const rocsparse_int mean_nnz_per_row = nnz_A / m;
+
+    if(mean_nnz_per_row < 8)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            (rocsparse::prune_csr2csr_by_strength_nnz_dispatch<BLOCKSIZE, 4>(handle,
+                                                                             m,
+                                                                             csr_descr_A,
+                                                                             csr_val_A,
+                                                                             csr_row_ptr_A,
+                                                                             csr_col_ind_A,
+                                                                             theta,
+                                                                             csr_row_ptr_C,
+                                                                             diag)));
+    }
+    else if(mean_nnz_per_row < 16)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            (rocsparse::prune_csr2csr_by_strength_nnz_dispatch<BLOCKSIZE, 8>(handle,
+                                                                             m,
+                                                                             csr_descr_A,
+                                                                             csr_val_A,
+                                                                             csr_row_ptr_A,
+                                                                             csr_col_ind_A,
+                                                                             theta,
+                                                                             csr_row_ptr_C,
+                                                                             diag)));
+    }
+    else if(mean_nnz_per_row < 32 || handle->wavefront_size == 32)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            (rocsparse::prune_csr2csr_by_strength_nnz_dispatch<BLOCKSIZE, 16>(handle,
+                                                                              m,
+                                                                              csr_descr_A,
+                                                                              csr_val_A,
+                                                                              csr_row_ptr_A,
+                                                                              csr_col_ind_A,
+                                                                              theta,
+                                                                              csr_row_ptr_C,
+                                                                              diag)));
+    }
+    else
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            (rocsparse::prune_csr2csr_by_strength_nnz_dispatch<BLOCKSIZE, 64>(handle,
+                                                                              m,
+                                                                              csr_descr_A,
+                                                                              csr_val_A,
+                                                                              csr_row_ptr_A,
+                                                                              csr_col_ind_A,
+                                                                              theta,
+                                                                              csr_row_ptr_C,
+                                                                              diag)));
+    }
+
+    // Compute csr_row_ptr_C with the right index base.
+    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::set_array_to_value<256>),
+                                       dim3(1),
+                                       dim3(256),
+                                       0,
+                                       stream,
+                                       1,
+                                       csr_row_ptr_C,
+                                       static_cast<rocsparse_int>(csr_descr_C->base));
+
+    // Perform inclusive scan on csr row pointer array
+    auto   op = rocprim::plus<rocsparse_int>();
+    size_t temp_storage_size_bytes;
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        nullptr, temp_storage_size_bytes, csr_row_ptr_C, csr_row_ptr_C, m + 1, op, stream));
+
+    bool  temp_alloc       = false;
+    void* temp_storage_ptr = nullptr;
+    if(handle->buffer_size >= temp_storage_size_bytes)
+    {
+        temp_storage_ptr = handle->buffer;
+        temp_alloc       = false;
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(
+            rocsparse_hipMallocAsync(&temp_storage_ptr, temp_storage_size_bytes, stream));
+        temp_alloc = true;
+    }
+
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(temp_storage_ptr,
+                                                temp_storage_size_bytes,
+                                                csr_row_ptr_C,
+                                                csr_row_ptr_C,
+                                                m + 1,
+                                                op,
+                                                stream));
+
+    if(temp_alloc)
+    {
+        RETURN_IF_HIP_ERROR(rocsparse_hipFreeAsync(temp_storage_ptr, stream));
+    }
+
+    // Total number of strong connections
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+            (rocsparse::prune_csr2csr_by_strength_nnz_total_kernel<1>),
+            dim3(1),
+            dim3(1),
+            0,
+            stream,
+            m,
+            csr_row_ptr_C,
+            csr_descr_C->base,
+            nnz_total_dev_host_ptr);
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(nnz_total_dev_host_ptr,
+                                           csr_row_ptr_C + m,
+                                           sizeof(rocsparse_int),
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        *nnz_total_dev_host_ptr -= csr_descr_C->base;
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status
+    rocsparse::prune_csr2csr_by_strength_template(rocsparse_handle          handle, //0
+                                                  rocsparse_int             m, //1
+                                                  rocsparse_int             nnz_A, //2
+                                                  const rocsparse_mat_descr csr_descr_A, //3
+                                                  const T*                  csr_val_A, //4
+                                                  const rocsparse_int*      csr_row_ptr_A, //5
+                                                  const rocsparse_int*      csr_col_ind_A, //6
+                                                  const T*                  theta, //7
+                                                  const rocsparse_mat_descr csr_descr_C, //8
+                                                  T*                        csr_val_C, //9
+                                                  const rocsparse_int*      csr_row_ptr_C, //10
+                                                  rocsparse_int*            csr_col_ind_C, //11
+                                                  void*                     temp_buffer) //12
+{
+    // Logging
+    rocsparse::log_trace(handle,
+                         rocsparse::replaceX<T>("rocsparse_Xprune_csr2csr_by_strength"),
+                         m,
+                         nnz_A,
+                         csr_descr_A,
+                         (const void*&)csr_val_A,
+                         (const void*&)csr_row_ptr_A,
+                         (const void*&)csr_col_ind_A,
+                         (const void*&)theta,
+                         csr_descr_C,
+                         (const void*&)csr_val_C,
+                         (const void*&)csr_row_ptr_C,
+                         (const void*&)csr_col_ind_C,
+                         (const void*&)temp_buffer);
+
+    ROCSPARSE_CHECKARG_HANDLE(0, handle);
+    ROCSPARSE_CHECKARG_SIZE(1, m);
+    ROCSPARSE_CHECKARG_SIZE(2, nnz_A);
+    ROCSPARSE_CHECKARG_POINTER(3, csr_descr_A);
+    ROCSPARSE_CHECKARG(3,
+                       csr_descr_A,
+                       (csr_descr_A->storage_mode != rocsparse_storage_mode_sorted),
+                       rocsparse_status_requires_sorted_storage);
+    ROCSPARSE_CHECKARG_ARRAY(4, nnz_A, csr_val_A);
+    ROCSPARSE_CHECKARG_ARRAY(5, m, csr_row_ptr_A);
+    ROCSPARSE_CHECKARG_ARRAY(6, nnz_A, csr_col_ind_A);
+    ROCSPARSE_CHECKARG_POINTER(8, csr_descr_C);
+    ROCSPARSE_CHECKARG(8,
+                       csr_descr_C,
+                       (csr_descr_C->storage_mode != rocsparse_storage_mode_sorted),
+                       rocsparse_status_requires_sorted_storage);
+    ROCSPARSE_CHECKARG_ARRAY(10, m, csr_row_ptr_C);
+
+    // Quick return if possible
+    if(m == 0 || nnz_A == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    ROCSPARSE_CHECKARG_POINTER(7, theta);
+    ROCSPARSE_CHECKARG_POINTER(12, temp_buffer);
+
+    // C always contains at least the diagonal entries of A that are present, thus only
+    // check the output arrays when they are not set.
+    if(csr_val_C == nullptr || csr_col_ind_C == nullptr)
+    {
+        int64_t nnz_C;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::calculate_nnz(
+            handle, m, rocsparse::get_indextype<rocsparse_int>(), csr_row_ptr_C, &nnz_C));
+
+        ROCSPARSE_CHECKARG_ARRAY(9, nnz_C, csr_val_C);
+        ROCSPARSE_CHECKARG_ARRAY(11, nnz_C, csr_col_ind_C);
+    }
+
+    // Diagonal magnitudes have been extracted by the nnz stage
+    const T* diag = reinterpret_cast<const T*>(temp_buffer);
+
+    static constexpr unsigned int BLOCKSIZE = 256;
+
+    // Compaction relies on ballot, thus each row is processed by a full wavefront
+#define PRUNE_CSR2CSR_BY_STRENGTH_FILL(WFSIZE, THETA)                                         \
+    RETURN_IF_ROCSPARSE_ERROR((rocsparse::prune_csr2csr_by_strength_fill_dispatch<BLOCKSIZE, \
+                                                                                  WFSIZE>(   \
+        handle,                                                                               \
+        m,                                                                                    \
+        csr_descr_A,                                                                          \
+        csr_val_A,                                                                            \
+        csr_row_ptr_A,                                                                        \
+        csr_col_ind_A,                                                                        \
+        diag,                                                                                 \
+        THETA,                                                                                \
+        csr_descr_C,                                                                          \
+        csr_val_C,                                                                            \
+        csr_row_ptr_C,                                                                        \
+        csr_col_ind_C)))
+
+    if(handle->wavefront_size == 32)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            PRUNE_CSR2CSR_BY_STRENGTH_FILL(32, theta);
+        }
+        else
+        {
+            PRUNE_CSR2CSR_BY_STRENGTH_FILL(32, *theta);
+        }
+    }
+    else if(handle->wavefront_size == 64)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            PRUNE_CSR2CSR_BY_STRENGTH_FILL(64, theta);
+        }
+        else
+        {
+            PRUNE_CSR2CSR_BY_STRENGTH_FILL(64, *theta);
+        }
+    }
+    else
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_arch_mismatch);
+    }
+
+#undef PRUNE_CSR2CSR_BY_STRENGTH_FILL
+
+    return rocsparse_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#define C_IMPL(NAME, T)                                                                   \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,                    \
+                                     rocsparse_int             m,                         \
+                                     rocsparse_int             nnz_A,                     \
+                                     const rocsparse_mat_descr csr_descr_A,               \
+                                     const T*                  csr_val_A,                 \
+                                     const rocsparse_int*      csr_row_ptr_A,             \
+                                     const rocsparse_int*      csr_col_ind_A,             \
+                                     const T*                  theta,                     \
+                                     const rocsparse_mat_descr csr_descr_C,               \
+                                     size_t*                   buffer_size)               \
+    try                                                                                   \
+    {                                                                                     \
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::prune_csr2csr_by_strength_buffer_size_template( \
+            handle,                                                                       \
+            m,                                                                            \
+            nnz_A,                                                                        \
+            csr_descr_A,                                                                  \
+            csr_val_A,                                                                    \
+            csr_row_ptr_A,                                                                \
+            csr_col_ind_A,                                                                \
+            theta,                                                                        \
+            csr_descr_C,                                                                  \
+            buffer_size));                                                                \
+        return rocsparse_status_success;                                                  \
+    }                                                                                     \
+    catch(...)                                                                            \
+    {                                                                                     \
+        RETURN_ROCSPARSE_EXCEPTION();                                                     \
+    }
+
+C_IMPL(rocsparse_sprune_csr2csr_by_strength_buffer_size, float);
+C_IMPL(rocsparse_dprune_csr2csr_by_strength_buffer_size, double);
+#undef C_IMPL
+
+#define C_IMPL(NAME, T)                                                                        \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,                         \
+                                     rocsparse_int             m,                              \
+                                     rocsparse_int             nnz_A,                          \
+                                     const rocsparse_mat_descr csr_descr_A,                    \
+                                     const T*                  csr_val_A,                      \
+                                     const rocsparse_int*      csr_row_ptr_A,                  \
+                                     const rocsparse_int*      csr_col_ind_A,                  \
+                                     const T*                  theta,                          \
+                                     const rocsparse_mat_descr csr_descr_C,                    \
+                                     rocsparse_int*            csr_row_ptr_C,                  \
+                                     rocsparse_int*            nnz_total_dev_host_ptr,         \
+                                     void*                     temp_buffer)                    \
+    try                                                                                        \
+    {                                                                                          \
+        RETURN_IF_ROCSPARSE_ERROR(                                                             \
+            rocsparse::prune_csr2csr_by_strength_nnz_template(handle,                          \
+                                                              m,                               \
+                                                              nnz_A,                           \
+                                                              csr_descr_A,                     \
+                                                              csr_val_A,                       \
+                                                              csr_row_ptr_A,                   \
+                                                              csr_col_ind_A,                   \
+                                                              theta,                           \
+                                                              csr_descr_C,                     \
+                                                              csr_row_ptr_C,                   \
+                                                              nnz_total_dev_host_ptr,          \
+                                                              temp_buffer));                   \
+        return rocsparse_status_success;                                                       \
+    }                                                                                          \
+    catch(...)                                                                                 \
+    {                                                                                          \
+        RETURN_ROCSPARSE_EXCEPTION();                                                          \
+    }
+
+C_IMPL(rocsparse_sprune_csr2csr_by_strength_nnz, float);
+C_IMPL(rocsparse_dprune_csr2csr_by_strength_nnz, double);
+#undef C_IMPL
+
+#define C_IMPL(NAME, T)                                                                      \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,                       \
+                                     rocsparse_int             m,                            \
+                                     rocsparse_int             nnz_A,                        \
+                                     const rocsparse_mat_descr csr_descr_A,                  \
+                                     const T*                  csr_val_A,                    \
+                                     const rocsparse_int*      csr_row_ptr_A,                \
+                                     const rocsparse_int*      csr_col_ind_A,                \
+                                     const T*                  theta,                        \
+                                     const rocsparse_mat_descr csr_descr_C,                  \
+                                     T*                        csr_val_C,                    \
+                                     const rocsparse_int*      csr_row_ptr_C,                \
+                                     rocsparse_int*            csr_col_ind_C,                \
+                                     void*                     temp_buffer)                  \
+    try                                                                                      \
+    {                                                                                        \
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::prune_csr2csr_by_strength_template(handle,     \
+                                                                                m,          \
+                                                                                nnz_A,      \
+                                                                                csr_descr_A, \
+                                                                                csr_val_A,  \
+                                                                                csr_row_ptr_A, \
+                                                                                csr_col_ind_A, \
+                                                                                theta,      \
+                                                                                csr_descr_C, \
+                                                                                csr_val_C,  \
+                                                                                csr_row_ptr_C, \
+                                                                                csr_col_ind_C, \
+                                                                                temp_buffer)); \
+        return rocsparse_status_success;                                                     \
+    }                                                                                        \
+    catch(...)                                                                               \
+    {                                                                                        \
+        RETURN_ROCSPARSE_EXCEPTION();                                                        \
+    }
+
+C_IMPL(rocsparse_sprune_csr2csr_by_strength, float);
+C_IMPL(rocsparse_dprune_csr2csr_by_strength, double);
+#undef C_IMPL
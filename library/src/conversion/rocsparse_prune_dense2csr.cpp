@@ -187,6 +187,12 @@ rocsparse_status rocsparse::prune_dense2csr_nnz_template(rocsparse_handle
     ROCSPARSE_CHECKARG_POINTER(8, nnz_total_dev_host_ptr);
     // ROCSPARSE_CHECKARG_POINTER(9, temp_buffer);
 
+    // The number of non-zeros is only read back on the host in host pointer mode
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+    }
+
     static constexpr int NNZ_DIM_X = 64;
     static constexpr int NNZ_DIM_Y = 16;
     rocsparse_int        blocks    = (m - 1) / (NNZ_DIM_X * 4) + 1;
@@ -226,10 +232,14 @@ rocsparse_status rocsparse::prune_dense2csr_nnz_template(rocsparse_handle
     }
 
     // Compute csr_row_ptr with the right index base.
-    rocsparse_int first_value = descr->base;
-    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-        csr_row_ptr, &first_value, sizeof(rocsparse_int), hipMemcpyHostToDevice, handle->stream));
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
+    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::set_array_to_value<256>),
+                                       dim3(1),
+                                       dim3(256),
+                                       0,
+                                       stream,
+                                       1,
+                                       csr_row_ptr,
+                                       static_cast<rocsparse_int>(descr->base));
 
     // Obtain rocprim buffer size
     size_t temp_storage_bytes = 0;
@@ -352,6 +362,8 @@ rocsparse_status rocsparse::prune_dense2csr_template(rocsparse_handle          h
 
     if(csr_val == nullptr || csr_col_ind == nullptr)
     {
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
         rocsparse_int start = 0;
         rocsparse_int end   = 0;
 
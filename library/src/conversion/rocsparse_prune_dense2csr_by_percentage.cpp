@@ -24,11 +24,11 @@
 
 #include "internal/conversion/rocsparse_prune_dense2csr_by_percentage.h"
 #include "control.h"
+#include "rocsparse_prune_by_percentage_select.hpp"
 #include "rocsparse_prune_dense2csr_by_percentage.hpp"
 #include "utility.h"
 
 #include "csr2csr_compress_device.h"
-#include "prune_dense2csr_by_percentage_device.h"
 #include "prune_dense2csr_device.h"
 #include <rocprim/rocprim.hpp>
 
@@ -120,7 +120,7 @@ rocsparse_status rocsparse::prune_dense2csr_by_percentage_buffer_size_template(
     ROCSPARSE_CHECKARG_POINTER(10, info);
     ROCSPARSE_CHECKARG_POINTER(11, buffer_size);
 
-    *buffer_size = sizeof(T) * 2 * m * n;
+    *buffer_size = rocsparse::prune_by_percentage_select_buffer_size<T>();
     return rocsparse_status_success;
 }
 
@@ -206,29 +206,25 @@ rocsparse_status
     ROCSPARSE_CHECKARG_POINTER(8, nnz_total_dev_host_ptr);
     ROCSPARSE_CHECKARG_POINTER(10, temp_buffer);
 
+    // The threshold and the number of non-zeros are only read back on the host in host
+    // pointer mode
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+    }
+
     const rocsparse_int nnz_A = m * n;
     rocsparse_int       pos   = std::ceil(nnz_A * (percentage / 100)) - 1;
     pos                       = std::min(pos, nnz_A - 1);
     pos                       = std::max(pos, 0);
 
-    T* output = reinterpret_cast<T*>(temp_buffer);
-
-    // Compute absolute value of A and store in first half of output array
-    {
-        dim3 grid((nnz_A - 1) / 256 + 1);
-        dim3 threads(256);
-
-        RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
-            (abs_kernel<256, T>), grid, threads, 0, stream, m, n, A, lda, output);
-    }
+    // Select the threshold, it is stored at the first entry of the temporary buffer
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse::prune_by_percentage_select_template(handle, m, n, A, lda, pos, temp_buffer));
 
-    // Determine amount of temporary storage needed for rocprim sort and inclusive scan and allocate if necessary
-    size_t temp_storage_size_bytes_sort = 0;
+    // Determine amount of temporary storage needed for rocprim inclusive scan and allocate if necessary
     size_t temp_storage_size_bytes_scan = 0;
 
-    RETURN_IF_HIP_ERROR(rocprim::radix_sort_keys(
-        nullptr, temp_storage_size_bytes_sort, output, (output + nnz_A), nnz_A));
-
     RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(nullptr,
                                                 temp_storage_size_bytes_scan,
                                                 csr_row_ptr,
@@ -237,8 +233,7 @@ rocsparse_status
                                                 rocprim::plus<rocsparse_int>(),
                                                 handle->stream));
 
-    size_t temp_storage_size_bytes
-        = std::max(temp_storage_size_bytes_sort, temp_storage_size_bytes_scan);
+    size_t temp_storage_size_bytes = temp_storage_size_bytes_scan;
 
     // Device buffer should be sufficient for rocprim in most cases
     bool  temp_alloc       = false;
@@ -255,11 +250,7 @@ rocsparse_status
         temp_alloc = true;
     }
 
-    // perform sort on first half of output array and store result in second half of output array
-    rocprim::radix_sort_keys(
-        temp_storage_ptr, temp_storage_size_bytes_sort, output, (output + nnz_A), nnz_A);
-
-    const T* d_threshold = &output[nnz_A + pos];
+    const T* d_threshold = reinterpret_cast<const T*>(temp_buffer);
 
     static constexpr int NNZ_DIM_X = 64;
     static constexpr int NNZ_DIM_Y = 16;
@@ -304,15 +295,15 @@ rocsparse_status
                 &csr_row_ptr[1]);
         }
     }
-    // Store threshold at first entry in output array
-    RETURN_IF_HIP_ERROR(
-        hipMemcpyAsync(output, d_threshold, sizeof(T), hipMemcpyDeviceToDevice, handle->stream));
-
     // Compute csr_row_ptr with the right index base.
-    rocsparse_int first_value = descr->base;
-    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-        csr_row_ptr, &first_value, sizeof(rocsparse_int), hipMemcpyHostToDevice, handle->stream));
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
+    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::set_array_to_value<256>),
+                                       dim3(1),
+                                       dim3(256),
+                                       0,
+                                       stream,
+                                       1,
+                                       csr_row_ptr,
+                                       static_cast<rocsparse_int>(descr->base));
 
     // Perform actual inclusive sum
     RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(temp_storage_ptr,
@@ -416,6 +407,8 @@ rocsparse_status
 
     if(csr_val == nullptr || csr_col_ind == nullptr)
     {
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
         rocsparse_int start = 0;
         rocsparse_int end   = 0;
 
@@ -25,6 +25,7 @@
 #pragma once
 
 #include "common.h"
+#include "semiring.h"
 
 namespace rocsparse
 {
@@ -383,7 +384,7 @@ namespace rocsparse
     }
 
     // Hash operation to insert pair into hash table
-    template <unsigned int HASHVAL, unsigned int HASHSIZE, typename I, typename T>
+    template <unsigned int HASHVAL, unsigned int HASHSIZE, typename S, typename I, typename T>
     ROCSPARSE_DEVICE_ILF void
         insert_pair(I key, T val, I* __restrict__ table, T* __restrict__ data, I empty)
     {
@@ -396,7 +397,7 @@ namespace rocsparse
             if(table[hash] == key)
             {
                 // Element already present, add value to exsiting entry
-                rocsparse::atomic_add(&data[hash], val);
+                S::atomic_add(&data[hash], val);
                 break;
             }
             else if(table[hash] == empty)
@@ -405,7 +406,7 @@ namespace rocsparse
                 if(rocsparse::atomic_cas<I>(&table[hash], empty, key) == empty)
                 {
                     // Add value
-                    rocsparse::atomic_add(&data[hash], val);
+                    S::atomic_add(&data[hash], val);
                     break;
                 }
             }
@@ -463,8 +464,9 @@ namespace rocsparse
 
         __threadfence_block();
 
-        // Bounds check
-        if(row >= m)
+        // Bounds check, the group size is read from the group offsets if the
+        // rows have been permuted, since m might only be an upper bound
+        if(row >= m || (perm != nullptr && row >= offset[1] - offset[0]))
         {
             return;
         }
@@ -555,6 +557,12 @@ namespace rocsparse
         // Wavefront id
         int wid = hipThreadIdx_x / WFSIZE;
 
+        // The grid might only be an upper bound of the group size
+        if(hipBlockIdx_x >= offset[1] - offset[0])
+        {
+            return;
+        }
+
         // Each block processes a row (apply permutation)
         J row = perm[hipBlockIdx_x + *offset];
 
@@ -674,6 +682,12 @@ namespace rocsparse
         // Wavefront id
         int wid = hipThreadIdx_x / WFSIZE;
 
+        // The grid might only be an upper bound of the group size
+        if(hipBlockIdx_x >= offset[1] - offset[0])
+        {
+            return;
+        }
+
         // Each block processes a row (apply permutation)
         J row = perm[hipBlockIdx_x + *offset];
 
@@ -858,6 +872,7 @@ namespace rocsparse
               unsigned int WFSIZE,
               unsigned int HASHSIZE,
               unsigned int HASHVAL,
+              typename S,
               typename I,
               typename J,
               typename T>
@@ -906,7 +921,7 @@ namespace rocsparse
         for(unsigned int i = lid; i < HASHSIZE; i += WFSIZE)
         {
             table[i] = nk;
-            data[i]  = static_cast<T>(0);
+            data[i]  = S::template zero<T>();
         }
 
         __threadfence_block();
@@ -933,7 +948,7 @@ namespace rocsparse
                 // Column of A in current row
                 J col_A = csr_col_ind_A[j] - idx_base_A;
                 // Value of A in current row
-                T val_A = alpha * csr_val_A[j];
+                T val_A = S::mul(alpha, csr_val_A[j]);
 
                 // Loop over columns of B in row col_A
                 I row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
@@ -943,8 +958,11 @@ namespace rocsparse
                 for(I k = row_begin_B; k < row_end_B; ++k)
                 {
                     // Insert key value pair into hash table
-                    insert_pair<HASHVAL, HASHSIZE>(
-                        csr_col_ind_B[k] - idx_base_B, val_A * csr_val_B[k], table, data, nk);
+                    insert_pair<HASHVAL, HASHSIZE, S>(csr_col_ind_B[k] - idx_base_B,
+                                                      S::mul(val_A, csr_val_B[k]),
+                                                      table,
+                                                      data,
+                                                      nk);
                 }
             }
         }
@@ -960,8 +978,8 @@ namespace rocsparse
             for(I j = row_begin_D + lid; j < row_end_D; j += WFSIZE)
             {
                 // Insert key value pair into hash table
-                insert_pair<HASHVAL, HASHSIZE>(
-                    csr_col_ind_D[j] - idx_base_D, beta * csr_val_D[j], table, data, nk);
+                insert_pair<HASHVAL, HASHSIZE, S>(
+                    csr_col_ind_D[j] - idx_base_D, S::mul(beta, csr_val_D[j]), table, data, nk);
             }
         }
 
@@ -1015,6 +1033,7 @@ namespace rocsparse
               unsigned int WFSIZE,
               unsigned int HASHSIZE,
               unsigned int HASHVAL,
+              typename S,
               typename I,
               typename J,
               typename T>
@@ -1055,7 +1074,7 @@ namespace rocsparse
         for(unsigned int i = hipThreadIdx_x; i < HASHSIZE; i += BLOCKSIZE)
         {
             table[i] = nk;
-            data[i]  = static_cast<T>(0);
+            data[i]  = S::template zero<T>();
         }
 
         // Wait for all threads to finish initialization
@@ -1077,7 +1096,7 @@ namespace rocsparse
                 // Column of A in current row
                 J col_A = csr_col_ind_A[j] - idx_base_A;
                 // Value of A in current row
-                T val_A = alpha * csr_val_A[j];
+                T val_A = S::mul(alpha, csr_val_A[j]);
 
                 // Loop over columns of B in row col_A
                 I row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
@@ -1086,8 +1105,11 @@ namespace rocsparse
                 for(I k = row_begin_B + lid; k < row_end_B; k += WFSIZE)
                 {
                     // Insert key value pair into hash table
-                    insert_pair<HASHVAL, HASHSIZE>(
-                        csr_col_ind_B[k] - idx_base_B, val_A * csr_val_B[k], table, data, nk);
+                    insert_pair<HASHVAL, HASHSIZE, S>(csr_col_ind_B[k] - idx_base_B,
+                                                      S::mul(val_A, csr_val_B[k]),
+                                                      table,
+                                                      data,
+                                                      nk);
                 }
             }
         }
@@ -1103,8 +1125,8 @@ namespace rocsparse
             for(I j = row_begin_D + hipThreadIdx_x; j < row_end_D; j += BLOCKSIZE)
             {
                 // Insert key value pair into hash table
-                insert_pair<HASHVAL, HASHSIZE>(
-                    csr_col_ind_D[j] - idx_base_D, beta * csr_val_D[j], table, data, nk);
+                insert_pair<HASHVAL, HASHSIZE, S>(
+                    csr_col_ind_D[j] - idx_base_D, S::mul(beta, csr_val_D[j]), table, data, nk);
             }
         }
 
@@ -1225,6 +1247,7 @@ namespace rocsparse
     template <unsigned int BLOCKSIZE,
               unsigned int WFSIZE,
               unsigned int CHUNKSIZE,
+              typename S,
               typename I,
               typename J,
               typename T>
@@ -1289,7 +1312,7 @@ namespace rocsparse
             for(unsigned int i = hipThreadIdx_x; i < CHUNKSIZE; i += BLOCKSIZE)
             {
                 table[i] = 0;
-                data[i]  = static_cast<T>(0);
+                data[i]  = S::template zero<T>();
             }
 
             // Initialize next chunk column index
@@ -1314,7 +1337,7 @@ namespace rocsparse
                     J col_A = csr_col_ind_A[j] - idx_base_A;
 
                     // Value of A in current row
-                    T val_A = alpha * csr_val_A[j];
+                    T val_A = S::mul(alpha, csr_val_A[j]);
 
                     // Loop over columns of B in row col_A
                     I row_begin_B
@@ -1337,7 +1360,8 @@ namespace rocsparse
                             table[col_B - chunk_begin] = 1;
 
                             // Atomically accumulate the intermediate products
-                            rocsparse::atomic_add(&data[col_B - chunk_begin], val_A * csr_val_B[k]);
+                            S::atomic_add(&data[col_B - chunk_begin],
+                                          S::mul(val_A, csr_val_B[k]));
                         }
                         else if(col_B >= chunk_end)
                         {
@@ -1381,7 +1405,7 @@ namespace rocsparse
                         table[col_D - chunk_begin] = 1;
 
                         // Atomically accumulate the entry of D
-                        rocsparse::atomic_add(&data[col_D - chunk_begin], beta * csr_val_D[j]);
+                        S::atomic_add(&data[col_D - chunk_begin], S::mul(beta, csr_val_D[j]));
                     }
                     else if(col_D >= chunk_end)
                     {
@@ -1492,4 +1516,302 @@ namespace rocsparse
             __syncthreads();
         }
     }
+
+    // Compute the masked product C<M> = alpha * A * B, where each row is processed by a single
+    // block. The row is split into chunks such that shared memory can be used to store whether
+    // a column index is populated and, if FILL is set, to accumulate its value. Only columns
+    // that are (or, if COMPLEMENT is set, are not) part of the sparsity pattern of the mask
+    // are populated. Without FILL, the number of non-zero entries of each row is written to
+    // csr_row_ptr_C. Columns of B and M need to be sorted.
+    template <unsigned int BLOCKSIZE,
+              unsigned int WFSIZE,
+              unsigned int CHUNKSIZE,
+              bool         COMPLEMENT,
+              bool         FILL,
+              typename I,
+              typename J,
+              typename T>
+    ROCSPARSE_DEVICE_ILF void
+        csrgemm_masked_block_per_row_multipass_device(J n,
+                                                      T alpha,
+                                                      const I* __restrict__ csr_row_ptr_A,
+                                                      const J* __restrict__ csr_col_ind_A,
+                                                      const T* __restrict__ csr_val_A,
+                                                      const I* __restrict__ csr_row_ptr_B,
+                                                      const J* __restrict__ csr_col_ind_B,
+                                                      const T* __restrict__ csr_val_B,
+                                                      const I* __restrict__ csr_row_ptr_M,
+                                                      const J* __restrict__ csr_col_ind_M,
+                                                      I* __restrict__ csr_row_ptr_C,
+                                                      J* __restrict__ csr_col_ind_C,
+                                                      T* __restrict__ csr_val_C,
+                                                      I* __restrict__ workspace_B,
+                                                      rocsparse_index_base idx_base_A,
+                                                      rocsparse_index_base idx_base_B,
+                                                      rocsparse_index_base idx_base_M,
+                                                      rocsparse_index_base idx_base_C)
+    {
+        // Lane id
+        int lid = hipThreadIdx_x & (WFSIZE - 1);
+        // Wavefront id
+        int wid = hipThreadIdx_x / WFSIZE;
+
+        // Each block processes a row
+        J row = hipBlockIdx_x;
+
+        // Row entry marker, mask marker and value accumulator
+        __shared__ bool table[CHUNKSIZE];
+        __shared__ bool mask[CHUNKSIZE];
+        __shared__ T    data[CHUNKSIZE];
+
+        // Shared memory to determine the beginning of the next chunk
+        __shared__ J next_chunk;
+
+        // Shared memory to determine the first entry of the mask exceeding the current chunk
+        __shared__ I next_M;
+
+        // Shared memory to accumulate the non-zero entries of the row
+        __shared__ I nnz;
+
+        // Get row boundaries of the current row in A and M
+        I row_begin_A = csr_row_ptr_A[row] - idx_base_A;
+        I row_end_A   = csr_row_ptr_A[row + 1] - idx_base_A;
+        I row_begin_M = csr_row_ptr_M[row] - idx_base_M;
+        I row_end_M   = csr_row_ptr_M[row + 1] - idx_base_M;
+
+        // Entry point into columns of C
+        I row_begin_C = (FILL) ? csr_row_ptr_C[row] - idx_base_C : 0;
+
+        // With a non-complemented mask, columns before the first mask entry can be skipped
+        J chunk_begin = 0;
+        if(COMPLEMENT == false)
+        {
+            chunk_begin = (row_begin_M < row_end_M) ? csr_col_ind_M[row_begin_M] - idx_base_M : n;
+        }
+        J chunk_end = chunk_begin + CHUNKSIZE;
+
+        // Columns of B are loaded from the row pointers during the first pass only
+        bool first_pass = true;
+
+        if(hipThreadIdx_x == 0)
+        {
+            nnz = 0;
+        }
+
+        // Loop over the row chunks until the end of the row has been reached
+        while(chunk_begin < n)
+        {
+            // Initialize tables and accumulator
+            for(unsigned int i = hipThreadIdx_x; i < CHUNKSIZE; i += BLOCKSIZE)
+            {
+                table[i] = false;
+                mask[i]  = false;
+
+                if(FILL)
+                {
+                    data[i] = static_cast<T>(0);
+                }
+            }
+
+            if(hipThreadIdx_x == 0)
+            {
+                next_chunk = n;
+                next_M     = row_end_M;
+            }
+
+            // Wait for all threads to finish initialization
+            __syncthreads();
+
+            // Mark the mask entries of the current chunk
+            for(I j = row_begin_M + hipThreadIdx_x; j < row_end_M; j += BLOCKSIZE)
+            {
+                J col_M = csr_col_ind_M[j] - idx_base_M;
+
+                if(col_M >= chunk_end)
+                {
+                    // Store the first mask entry that exceeds the current chunk
+                    rocsparse::atomic_min(&next_M, j);
+                    break;
+                }
+
+                if(col_M >= chunk_begin)
+                {
+                    mask[col_M - chunk_begin] = true;
+                }
+            }
+
+            // Wait for the mask to be complete
+            __syncthreads();
+
+            // Initialize the beginning of the next chunk
+            J min_col = n;
+
+            // Loop over columns of A in current row
+            for(I j = row_begin_A + wid; j < row_end_A; j += BLOCKSIZE / WFSIZE)
+            {
+                // Column of A in current row
+                J col_A = csr_col_ind_A[j] - idx_base_A;
+
+                // Value of A in current row
+                T val_A = (FILL) ? alpha * csr_val_A[j] : static_cast<T>(0);
+
+                // Loop over columns of B in row col_A
+                I row_begin_B
+                    = (first_pass) ? csr_row_ptr_B[col_A] - idx_base_B : workspace_B[j];
+                I row_end_B = csr_row_ptr_B[col_A + 1] - idx_base_B;
+
+                // Keep track of the first k where the column index of B is exceeding
+                // the current chunks end point
+                I next_k = row_end_B;
+
+                for(I k = row_begin_B + lid; k < row_end_B; k += WFSIZE)
+                {
+                    // Column of B in row col_A
+                    J col_B = csr_col_ind_B[k] - idx_base_B;
+
+                    if(col_B >= chunk_end)
+                    {
+                        // Store k as starting point of the columns of B for the next pass
+                        next_k  = k;
+                        min_col = min(min_col, col_B);
+                        break;
+                    }
+
+                    // Columns preceding the chunk have been skipped by the mask
+                    if(col_B >= chunk_begin && mask[col_B - chunk_begin] != COMPLEMENT)
+                    {
+                        // Mark nnz table if entry at col_B
+                        table[col_B - chunk_begin] = true;
+
+                        if(FILL)
+                        {
+                            // Atomically accumulate the intermediate products
+                            rocsparse::atomic_add(&data[col_B - chunk_begin],
+                                                  val_A * csr_val_B[k]);
+                        }
+                    }
+                }
+
+                // Obtain the minimum of all k that exceed the current chunks end point
+                rocsparse::wfreduce_min<WFSIZE>(&next_k);
+
+                // Store the minimum globally for the next chunk
+                if(lid == WFSIZE - 1)
+                {
+                    workspace_B[j] = next_k;
+                }
+            }
+
+            if(COMPLEMENT)
+            {
+                // The next chunk begins at the next column of the product
+                rocsparse::wfreduce_min<WFSIZE>(&min_col);
+
+                if(lid == WFSIZE - 1)
+                {
+                    rocsparse::atomic_min(&next_chunk, min_col);
+                }
+            }
+
+            // Wait for all threads to finish
+            __syncthreads();
+
+            if(FILL)
+            {
+                // We can re-use the shared memory to communicate the scan offsets of each
+                // wavefront
+                int* scan_offsets = reinterpret_cast<int*>(data);
+
+                // Exclusive scan of the table array to obtain the index where each non-zero
+                // has to be copied to
+                for(unsigned int i = hipThreadIdx_x; i < CHUNKSIZE; i += BLOCKSIZE)
+                {
+                    bool has_nnz = table[i];
+                    T    value   = data[i];
+
+                    // Wavefront-wide non-zero offset in C
+                    unsigned long long wf_mask = __ballot(has_nnz == true);
+                    int                wf_nnz  = __popcll(wf_mask);
+                    unsigned long long lanemask_le
+                        = UINT64_MAX >> (sizeof(unsigned long long) * CHAR_BIT - (__lane_id() + 1));
+                    int offset = __popcll(lanemask_le & wf_mask);
+
+                    // Need to sync here to make sure reading from data array has finished
+                    __syncthreads();
+
+                    scan_offsets[hipThreadIdx_x / warpSize] = wf_nnz;
+
+                    // Wait for all wavefronts to finish writing
+                    __syncthreads();
+
+                    for(unsigned int w = 1; w < BLOCKSIZE / warpSize; ++w)
+                    {
+                        if(hipThreadIdx_x >= w * warpSize)
+                        {
+                            offset += scan_offsets[w - 1];
+                        }
+                    }
+
+                    I idx = row_begin_C + offset - 1;
+
+                    if(has_nnz)
+                    {
+                        csr_col_ind_C[idx] = i + chunk_begin + idx_base_C;
+                        csr_val_C[idx]     = value;
+                    }
+
+                    if(hipThreadIdx_x == BLOCKSIZE - 1)
+                    {
+                        scan_offsets[BLOCKSIZE / warpSize - 1] = offset;
+                    }
+
+                    // Wait for last thread in block to finish writing
+                    __syncthreads();
+
+                    row_begin_C += scan_offsets[BLOCKSIZE / warpSize - 1];
+                }
+            }
+            else
+            {
+                // Each thread loads its entry for the current chunk
+                I chunk_nnz = 0;
+                for(unsigned int i = hipThreadIdx_x; i < CHUNKSIZE; i += BLOCKSIZE)
+                {
+                    chunk_nnz += (table[i] == true) ? 1 : 0;
+                }
+
+                // Gather wavefront-wide nnz for the current chunk
+                chunk_nnz = rocsparse::wfreduce_sum<WFSIZE>(chunk_nnz);
+
+                if(lid == WFSIZE - 1)
+                {
+                    rocsparse::atomic_add(&nnz, chunk_nnz);
+                }
+            }
+
+            // With a non-complemented mask, the next chunk begins at the next mask entry
+            if(COMPLEMENT == false && hipThreadIdx_x == 0)
+            {
+                next_chunk = (next_M < row_end_M) ? csr_col_ind_M[next_M] - idx_base_M : n;
+            }
+
+            // Wait for the next chunk to be determined
+            __syncthreads();
+
+            // Each thread loads the new chunk beginning and end point
+            chunk_begin = next_chunk;
+            chunk_end   = chunk_begin + CHUNKSIZE;
+            row_begin_M = next_M;
+            first_pass  = false;
+
+            // Wait for all threads to finish load from shared memory
+            __syncthreads();
+        }
+
+        // Write accumulated total row nnz to global memory
+        if(FILL == false && hipThreadIdx_x == 0)
+        {
+            csr_row_ptr_C[row] = nnz;
+        }
+    }
 }
@@ -0,0 +1,644 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "common.h"
+#include "csrgemm_device.h"
+
+namespace rocsparse
+{
+    // Compute an upper bound of the number of non-zero entries of each row of A * P, which is
+    // the number of intermediate products of the row. Each row is processed by a (sub)wavefront.
+    template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename I, typename J>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void csrrap_ap_bound(J n,
+                         const I* __restrict__ csr_row_ptr_A,
+                         const J* __restrict__ csr_col_ind_A,
+                         const I* __restrict__ csr_row_ptr_P,
+                         rocsparse_index_base idx_base_A,
+                         I* __restrict__ bound_AP)
+    {
+        const int lid = hipThreadIdx_x & (WFSIZE - 1);
+        const J   row = (BLOCKSIZE / WFSIZE) * hipBlockIdx_x + hipThreadIdx_x / WFSIZE;
+
+        if(row >= n)
+        {
+            return;
+        }
+
+        const I row_begin = csr_row_ptr_A[row] - idx_base_A;
+        const I row_end   = csr_row_ptr_A[row + 1] - idx_base_A;
+
+        I sum = 0;
+        for(I j = row_begin + lid; j < row_end; j += WFSIZE)
+        {
+            const J col = csr_col_ind_A[j] - idx_base_A;
+            sum += csr_row_ptr_P[col + 1] - csr_row_ptr_P[col];
+        }
+
+        sum = rocsparse::wfreduce_sum<WFSIZE>(sum);
+
+        if(lid == WFSIZE - 1)
+        {
+            bound_AP[row] = sum;
+        }
+    }
+
+    // Compute an upper bound of the number of non-zero entries of each row of R * A * P, which
+    // is the sum of the bounds of all rows of A * P that contribute to the row, clipped by the
+    // number of columns of P. Each row is processed by a (sub)wavefront.
+    template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename I, typename J>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void csrrap_rap_bound(J m,
+                          J k,
+                          const I* __restrict__ csr_row_ptr_R,
+                          const J* __restrict__ csr_col_ind_R,
+                          rocsparse_index_base idx_base_R,
+                          const I* __restrict__ bound_AP,
+                          I* __restrict__ bound_RAP)
+    {
+        const int lid = hipThreadIdx_x & (WFSIZE - 1);
+        const J   row = (BLOCKSIZE / WFSIZE) * hipBlockIdx_x + hipThreadIdx_x / WFSIZE;
+
+        if(row >= m)
+        {
+            return;
+        }
+
+        const I row_begin = csr_row_ptr_R[row] - idx_base_R;
+        const I row_end   = csr_row_ptr_R[row + 1] - idx_base_R;
+
+        int64_t sum = 0;
+        for(I j = row_begin + lid; j < row_end; j += WFSIZE)
+        {
+            sum += bound_AP[csr_col_ind_R[j] - idx_base_R];
+        }
+
+        sum = rocsparse::wfreduce_sum<WFSIZE>(sum);
+
+        if(lid == WFSIZE - 1)
+        {
+            bound_RAP[row] = static_cast<I>(min(sum, static_cast<int64_t>(k)));
+        }
+    }
+
+    // Compute non-zero entries per row of R * A * P, where each row is processed by a single
+    // (sub)wavefront. Rows that exceed the hash table size are skipped and processed by
+    // csrrap_nnz_block_per_row_multipass.
+    template <unsigned int BLOCKSIZE,
+              unsigned int WFSIZE,
+              unsigned int HASHSIZE,
+              unsigned int HASHVAL,
+              typename I,
+              typename J>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void csrrap_nnz_wf_per_row(J m,
+                               const I* __restrict__ bound_RAP,
+                               const I* __restrict__ csr_row_ptr_R,
+                               const J* __restrict__ csr_col_ind_R,
+                               const I* __restrict__ csr_row_ptr_A,
+                               const J* __restrict__ csr_col_ind_A,
+                               const I* __restrict__ csr_row_ptr_P,
+                               const J* __restrict__ csr_col_ind_P,
+                               I* __restrict__ row_nnz,
+                               rocsparse_index_base idx_base_R,
+                               rocsparse_index_base idx_base_A,
+                               rocsparse_index_base idx_base_P)
+    {
+        // Lane id
+        const int lid = hipThreadIdx_x & (WFSIZE - 1);
+        // Wavefront id
+        const int wid = hipThreadIdx_x / WFSIZE;
+
+        // Each (sub)wavefront processes a row
+        const J row = hipBlockIdx_x * BLOCKSIZE / WFSIZE + wid;
+
+        // Hash table in shared memory
+        __shared__ J stable[BLOCKSIZE / WFSIZE * HASHSIZE];
+
+        // Local hash table
+        J* table = &stable[wid * HASHSIZE];
+
+        // Initialize hash table
+        for(unsigned int i = lid; i < HASHSIZE; i += WFSIZE)
+        {
+            table[i] = -1;
+        }
+
+        __threadfence_block();
+
+        // Bounds check, rows that do not fit into the hash table are skipped
+        if(row >= m || bound_RAP[row] > HASHSIZE)
+        {
+            return;
+        }
+
+        J nnz = 0;
+
+        const I row_begin_R = csr_row_ptr_R[row] - idx_base_R;
+        const I row_end_R   = csr_row_ptr_R[row + 1] - idx_base_R;
+
+        // Loop over columns of R in current row
+        for(I r = row_begin_R; r < row_end_R; ++r)
+        {
+            const J col_R = csr_col_ind_R[r] - idx_base_R;
+
+            const I row_begin_A = csr_row_ptr_A[col_R] - idx_base_A;
+            const I row_end_A   = csr_row_ptr_A[col_R + 1] - idx_base_A;
+
+            // Loop over columns of A in row col_R
+            for(I j = row_begin_A + lid; j < row_end_A; j += WFSIZE)
+            {
+                const J col_A = csr_col_ind_A[j] - idx_base_A;
+
+                const I row_begin_P = csr_row_ptr_P[col_A] - idx_base_P;
+                const I row_end_P   = csr_row_ptr_P[col_A + 1] - idx_base_P;
+
+                // Insert all columns of P into hash table
+                for(I p = row_begin_P; p < row_end_P; ++p)
+                {
+                    nnz += insert_key<HASHVAL, HASHSIZE>(csr_col_ind_P[p] - idx_base_P, table);
+                }
+            }
+        }
+
+        // Accumulate all row nnz within each (sub)wavefront
+        nnz = rocsparse::wfreduce_sum<WFSIZE>(nnz);
+
+        if(lid == WFSIZE - 1)
+        {
+            row_nnz[row] = nnz;
+        }
+    }
+
+    // Compute non-zero entries per row of R * A * P, where each row is processed by a single
+    // block. The row is split into several chunks such that we can use shared memory to store
+    // whether a column index is populated or not. Rows that fit into the hash table of
+    // csrrap_nnz_wf_per_row are skipped.
+    template <unsigned int BLOCKSIZE,
+              unsigned int WFSIZE,
+              unsigned int CHUNKSIZE,
+              unsigned int HASHSIZE,
+              typename I,
+              typename J>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void csrrap_nnz_block_per_row_multipass(J k,
+                                            const I* __restrict__ bound_RAP,
+                                            const I* __restrict__ csr_row_ptr_R,
+                                            const J* __restrict__ csr_col_ind_R,
+                                            const I* __restrict__ csr_row_ptr_A,
+                                            const J* __restrict__ csr_col_ind_A,
+                                            const I* __restrict__ csr_row_ptr_P,
+                                            const J* __restrict__ csr_col_ind_P,
+                                            I* __restrict__ row_nnz,
+                                            rocsparse_index_base idx_base_R,
+                                            rocsparse_index_base idx_base_A,
+                                            rocsparse_index_base idx_base_P)
+    {
+        // Lane id
+        const int lid = hipThreadIdx_x & (WFSIZE - 1);
+
+        // Each block processes a row
+        const J row = hipBlockIdx_x;
+
+        // Rows that fit into the hash table have already been processed
+        if(bound_RAP[row] <= HASHSIZE)
+        {
+            return;
+        }
+
+        // Row nnz marker
+        __shared__ bool table[CHUNKSIZE];
+
+        // Shared memory to accumulate the non-zero entries of the row
+        __shared__ J nnz;
+
+        // Shared memory to determine the minimum of all column indices of P that exceed the
+        // current chunk
+        __shared__ J next_chunk;
+
+        J chunk_begin = 0;
+        J chunk_end   = CHUNKSIZE;
+
+        if(hipThreadIdx_x == 0)
+        {
+            nnz = 0;
+        }
+
+        const I row_begin_R = csr_row_ptr_R[row] - idx_base_R;
+        const I row_end_R   = csr_row_ptr_R[row + 1] - idx_base_R;
+
+        // Loop over the row chunks until the end of the row has been reached
+        while(chunk_begin < k)
+        {
+            for(unsigned int i = hipThreadIdx_x; i < CHUNKSIZE; i += BLOCKSIZE)
+            {
+                table[i] = false;
+            }
+
+            if(hipThreadIdx_x == 0)
+            {
+                next_chunk = k;
+            }
+
+            __syncthreads();
+
+            J min_col = k;
+
+            for(I r = row_begin_R; r < row_end_R; ++r)
+            {
+                const J col_R = csr_col_ind_R[r] - idx_base_R;
+
+                const I row_begin_A = csr_row_ptr_A[col_R] - idx_base_A;
+                const I row_end_A   = csr_row_ptr_A[col_R + 1] - idx_base_A;
+
+                for(I j = row_begin_A + hipThreadIdx_x; j < row_end_A; j += BLOCKSIZE)
+                {
+                    const J col_A = csr_col_ind_A[j] - idx_base_A;
+
+                    const I row_begin_P = csr_row_ptr_P[col_A] - idx_base_P;
+                    const I row_end_P   = csr_row_ptr_P[col_A + 1] - idx_base_P;
+
+                    for(I p = row_begin_P; p < row_end_P; ++p)
+                    {
+                        const J col_P = csr_col_ind_P[p] - idx_base_P;
+
+                        if(col_P >= chunk_end)
+                        {
+                            // Columns of P are sorted, the remainder belongs to later chunks
+                            min_col = min(min_col, col_P);
+                            break;
+                        }
+                        else if(col_P >= chunk_begin)
+                        {
+                            table[col_P - chunk_begin] = true;
+                        }
+                    }
+                }
+            }
+
+            // Determine the beginning of the next non-empty chunk
+            rocsparse::wfreduce_min<WFSIZE>(&min_col);
+
+            if(lid == WFSIZE - 1)
+            {
+                rocsparse::atomic_min(&next_chunk, min_col);
+            }
+
+            __syncthreads();
+
+            J chunk_nnz = 0;
+            for(unsigned int i = hipThreadIdx_x; i < CHUNKSIZE; i += BLOCKSIZE)
+            {
+                chunk_nnz += (table[i] == true) ? 1 : 0;
+            }
+
+            chunk_nnz = rocsparse::wfreduce_sum<WFSIZE>(chunk_nnz);
+
+            if(lid == WFSIZE - 1)
+            {
+                rocsparse::atomic_add(&nnz, chunk_nnz);
+            }
+
+            __syncthreads();
+
+            chunk_begin = next_chunk;
+            chunk_end   = chunk_begin + CHUNKSIZE;
+
+            __syncthreads();
+        }
+
+        if(hipThreadIdx_x == 0)
+        {
+            row_nnz[row] = nnz;
+        }
+    }
+
+    // Compute column entries and accumulate values of R * A * P, where each row is processed
+    // by a single (sub)wavefront. Rows with more non-zero entries than the hash table size
+    // are skipped and processed by csrrap_fill_block_per_row_multipass.
+    template <unsigned int BLOCKSIZE,
+              unsigned int WFSIZE,
+              unsigned int HASHSIZE,
+              unsigned int HASHVAL,
+              typename I,
+              typename J,
+              typename T>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void csrrap_fill_wf_per_row(J m,
+                                J k,
+                                const I* __restrict__ csr_row_ptr_R,
+                                const J* __restrict__ csr_col_ind_R,
+                                const T* __restrict__ csr_val_R,
+                                const I* __restrict__ csr_row_ptr_A,
+                                const J* __restrict__ csr_col_ind_A,
+                                const T* __restrict__ csr_val_A,
+                                const I* __restrict__ csr_row_ptr_P,
+                                const J* __restrict__ csr_col_ind_P,
+                                const T* __restrict__ csr_val_P,
+                                const I* __restrict__ csr_row_ptr_C,
+                                J* __restrict__ csr_col_ind_C,
+                                T* __restrict__ csr_val_C,
+                                rocsparse_index_base idx_base_R,
+                                rocsparse_index_base idx_base_A,
+                                rocsparse_index_base idx_base_P,
+                                rocsparse_index_base idx_base_C)
+    {
+        // Lane id
+        const int lid = hipThreadIdx_x & (WFSIZE - 1);
+        // Wavefront id
+        const int wid = hipThreadIdx_x / WFSIZE;
+
+        // Each (sub)wavefront processes a row
+        const J row = hipBlockIdx_x * BLOCKSIZE / WFSIZE + wid;
+
+        // Hash table in shared memory
+        __shared__ J stable[BLOCKSIZE / WFSIZE * HASHSIZE];
+        __shared__ T sdata[BLOCKSIZE / WFSIZE * HASHSIZE];
+
+        // Local hash table
+        J* table = &stable[wid * HASHSIZE];
+        T* data  = &sdata[wid * HASHSIZE];
+
+        // Initialize hash table
+        for(unsigned int i = lid; i < HASHSIZE; i += WFSIZE)
+        {
+            table[i] = k;
+            data[i]  = static_cast<T>(0);
+        }
+
+        __threadfence_block();
+
+        if(row >= m)
+        {
+            return;
+        }
+
+        // Entry point of current row into C
+        const I row_begin_C = csr_row_ptr_C[row] - idx_base_C;
+        const I row_end_C   = csr_row_ptr_C[row + 1] - idx_base_C;
+
+        // Rows that do not fit into the hash table are skipped
+        if(row_end_C - row_begin_C > HASHSIZE)
+        {
+            return;
+        }
+
+        const I row_begin_R = csr_row_ptr_R[row] - idx_base_R;
+        const I row_end_R   = csr_row_ptr_R[row + 1] - idx_base_R;
+
+        // Loop over columns of R in current row
+        for(I r = row_begin_R; r < row_end_R; ++r)
+        {
+            const J col_R = csr_col_ind_R[r] - idx_base_R;
+            const T val_R = csr_val_R[r];
+
+            const I row_begin_A = csr_row_ptr_A[col_R] - idx_base_A;
+            const I row_end_A   = csr_row_ptr_A[col_R + 1] - idx_base_A;
+
+            // Loop over columns of A in row col_R, the intermediate row of A * P is never
+            // stored and directly accumulated into the current row of C
+            for(I j = row_begin_A + lid; j < row_end_A; j += WFSIZE)
+            {
+                const J col_A  = csr_col_ind_A[j] - idx_base_A;
+                const T val_RA = val_R * csr_val_A[j];
+
+                const I row_begin_P = csr_row_ptr_P[col_A] - idx_base_P;
+                const I row_end_P   = csr_row_ptr_P[col_A + 1] - idx_base_P;
+
+                for(I p = row_begin_P; p < row_end_P; ++p)
+                {
+                    insert_pair<HASHVAL, HASHSIZE, rocsparse::plus_times_semiring>(
+                        csr_col_ind_P[p] - idx_base_P, val_RA * csr_val_P[p], table, data, k);
+                }
+            }
+        }
+
+        __threadfence_block();
+
+        // Loop over hash table
+        for(unsigned int i = lid; i < HASHSIZE; i += WFSIZE)
+        {
+            const J col_C = table[i];
+
+            // Skip hash table entry if not present
+            if(col_C >= k)
+            {
+                continue;
+            }
+
+            // Find the (sorted) index into C for the current column index
+            I idx_C = row_begin_C;
+            for(unsigned int hash_idx = 0; hash_idx < HASHSIZE; ++hash_idx)
+            {
+                if(col_C > table[hash_idx])
+                {
+                    ++idx_C;
+                }
+            }
+
+            csr_col_ind_C[idx_C] = col_C + idx_base_C;
+            csr_val_C[idx_C]     = data[i];
+        }
+    }
+
+    // Compute column entries and accumulate values of R * A * P, where each row is processed
+    // by a single block. The row is split into several chunks of dense accumulators in shared
+    // memory, which directly yields sorted column indices. Rows that fit into the hash table of
+    // csrrap_fill_wf_per_row are skipped.
+    template <unsigned int BLOCKSIZE,
+              unsigned int WFSIZE,
+              unsigned int CHUNKSIZE,
+              unsigned int HASHSIZE,
+              typename I,
+              typename J,
+              typename T>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void csrrap_fill_block_per_row_multipass(J k,
+                                             const I* __restrict__ csr_row_ptr_R,
+                                             const J* __restrict__ csr_col_ind_R,
+                                             const T* __restrict__ csr_val_R,
+                                             const I* __restrict__ csr_row_ptr_A,
+                                             const J* __restrict__ csr_col_ind_A,
+                                             const T* __restrict__ csr_val_A,
+                                             const I* __restrict__ csr_row_ptr_P,
+                                             const J* __restrict__ csr_col_ind_P,
+                                             const T* __restrict__ csr_val_P,
+                                             const I* __restrict__ csr_row_ptr_C,
+                                             J* __restrict__ csr_col_ind_C,
+                                             T* __restrict__ csr_val_C,
+                                             rocsparse_index_base idx_base_R,
+                                             rocsparse_index_base idx_base_A,
+                                             rocsparse_index_base idx_base_P,
+                                             rocsparse_index_base idx_base_C)
+    {
+        // Lane id
+        const int lid = hipThreadIdx_x & (WFSIZE - 1);
+
+        // Each block processes a row
+        const J row = hipBlockIdx_x;
+
+        I row_begin_C = csr_row_ptr_C[row] - idx_base_C;
+
+        // Rows that fit into the hash table have already been processed
+        if(csr_row_ptr_C[row + 1] - idx_base_C - row_begin_C <= HASHSIZE)
+        {
+            return;
+        }
+
+        // Dense accumulator and non-zero marker of the current chunk
+        __shared__ T    data[CHUNKSIZE];
+        __shared__ bool table[CHUNKSIZE];
+
+        // Wavefront-wide non-zero offsets for the compression of the chunk
+        __shared__ J scan_offsets[BLOCKSIZE / WFSIZE + 1];
+
+        // Shared memory to determine the minimum of all column indices of P that exceed the
+        // current chunk
+        __shared__ J next_chunk;
+
+        J chunk_begin = 0;
+        J chunk_end   = CHUNKSIZE;
+
+        const I row_begin_R = csr_row_ptr_R[row] - idx_base_R;
+        const I row_end_R   = csr_row_ptr_R[row + 1] - idx_base_R;
+
+        while(chunk_begin < k)
+        {
+            for(unsigned int i = hipThreadIdx_x; i < CHUNKSIZE; i += BLOCKSIZE)
+            {
+                table[i] = false;
+                data[i]  = static_cast<T>(0);
+            }
+
+            if(hipThreadIdx_x == 0)
+            {
+                next_chunk = k;
+            }
+
+            __syncthreads();
+
+            J min_col = k;
+
+            for(I r = row_begin_R; r < row_end_R; ++r)
+            {
+                const J col_R = csr_col_ind_R[r] - idx_base_R;
+                const T val_R = csr_val_R[r];
+
+                const I row_begin_A = csr_row_ptr_A[col_R] - idx_base_A;
+                const I row_end_A   = csr_row_ptr_A[col_R + 1] - idx_base_A;
+
+                for(I j = row_begin_A + hipThreadIdx_x; j < row_end_A; j += BLOCKSIZE)
+                {
+                    const J col_A  = csr_col_ind_A[j] - idx_base_A;
+                    const T val_RA = val_R * csr_val_A[j];
+
+                    const I row_begin_P = csr_row_ptr_P[col_A] - idx_base_P;
+                    const I row_end_P   = csr_row_ptr_P[col_A + 1] - idx_base_P;
+
+                    for(I p = row_begin_P; p < row_end_P; ++p)
+                    {
+                        const J col_P = csr_col_ind_P[p] - idx_base_P;
+
+                        if(col_P >= chunk_end)
+                        {
+                            min_col = min(min_col, col_P);
+                            break;
+                        }
+                        else if(col_P >= chunk_begin)
+                        {
+                            table[col_P - chunk_begin] = true;
+                            rocsparse::atomic_add(&data[col_P - chunk_begin],
+                                                  val_RA * csr_val_P[p]);
+                        }
+                    }
+                }
+            }
+
+            rocsparse::wfreduce_min<WFSIZE>(&min_col);
+
+            if(lid == WFSIZE - 1)
+            {
+                rocsparse::atomic_min(&next_chunk, min_col);
+            }
+
+            __syncthreads();
+
+            // Compress the chunk into C, the dense accumulator keeps the columns sorted
+            for(unsigned int i = hipThreadIdx_x; i < CHUNKSIZE; i += BLOCKSIZE)
+            {
+                const bool has_nnz = table[i];
+
+                // Wavefront-wide non-zero mask and intra wavefront offset
+                const unsigned long long mask = __ballot(has_nnz);
+                const int                nnz  = __popcll(mask);
+
+                const unsigned long long lanemask_le
+                    = UINT64_MAX >> (sizeof(unsigned long long) * CHAR_BIT - (__lane_id() + 1));
+
+                J offset = __popcll(lanemask_le & mask);
+
+                scan_offsets[hipThreadIdx_x / WFSIZE] = nnz;
+
+                __syncthreads();
+
+                // Accumulate the offsets of all previous wavefronts
+                for(unsigned int j = 1; j < BLOCKSIZE / WFSIZE; ++j)
+                {
+                    if(hipThreadIdx_x >= j * WFSIZE)
+                    {
+                        offset += scan_offsets[j - 1];
+                    }
+                }
+
+                if(has_nnz)
+                {
+                    const I idx_C = row_begin_C + offset - 1;
+
+                    csr_col_ind_C[idx_C] = chunk_begin + i + idx_base_C;
+                    csr_val_C[idx_C]     = data[i];
+                }
+
+                __syncthreads();
+
+                if(hipThreadIdx_x == BLOCKSIZE - 1)
+                {
+                    scan_offsets[BLOCKSIZE / WFSIZE] = offset;
+                }
+
+                __syncthreads();
+
+                row_begin_C += scan_offsets[BLOCKSIZE / WFSIZE];
+
+                __syncthreads();
+            }
+
+            chunk_begin = next_chunk;
+            chunk_end   = chunk_begin + CHUNKSIZE;
+
+            __syncthreads();
+        }
+    }
+}
@@ -715,6 +715,8 @@ namespace rocsparse
             rocsparse_int end   = 0;
             if(bsr_row_ptr_C != nullptr)
             {
+                RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
                 RETURN_IF_HIP_ERROR(hipMemcpyAsync(&end,
                                                    &bsr_row_ptr_C[mb],
                                                    sizeof(rocsparse_int),
@@ -429,6 +429,8 @@ namespace rocsparse
 
                 if(bsr_row_ptr_C != nullptr)
                 {
+                    RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
                     RETURN_IF_HIP_ERROR(hipMemcpyAsync(&end,
                                                        &bsr_row_ptr_C[mb],
                                                        sizeof(I),
@@ -512,6 +514,8 @@ namespace rocsparse
 
                 if(bsr_row_ptr_C != nullptr)
                 {
+                    RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
                     RETURN_IF_HIP_ERROR(hipMemcpyAsync(&end,
                                                        &bsr_row_ptr_C[mb],
                                                        sizeof(I),
@@ -627,6 +631,8 @@ namespace rocsparse
 
                 if(bsr_row_ptr_C != nullptr)
                 {
+                    RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
                     RETURN_IF_HIP_ERROR(hipMemcpyAsync(&end,
                                                        &bsr_row_ptr_C[mb],
                                                        sizeof(I),
@@ -1955,6 +1955,9 @@ rocsparse_status rocsparse::bsrgemm_calc_template_dispatch(rocsparse_handle    h
                                                            const rocsparse_mat_info  info_C,
                                                            void*                     temp_buffer)
 {
+    // The maximum number of non-zeros per row and the group sizes are read back on the host
+    RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
     // Stream
     hipStream_t stream = handle->stream;
 
@@ -542,6 +542,8 @@ namespace rocsparse
             rocsparse_int end   = 0;
             if(csr_row_ptr_C != nullptr)
             {
+                RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
                 RETURN_IF_HIP_ERROR(hipMemcpyAsync(&end,
                                                    &csr_row_ptr_C[m],
                                                    sizeof(rocsparse_int),
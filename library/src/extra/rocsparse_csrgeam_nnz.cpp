@@ -206,6 +206,12 @@ rocsparse_status rocsparse::csrgeam_nnz_core(rocsparse_handle          handle,
                                              rocsparse_int*            csr_row_ptr_C,
                                              rocsparse_int*            nnz_C)
 {
+    // The number of non-zeros is only read back on the host in host pointer mode
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+    }
+
     // Stream
     hipStream_t stream = handle->stream;
 
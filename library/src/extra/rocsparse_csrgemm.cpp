@@ -360,6 +360,8 @@ namespace rocsparse
 
                 if(csr_row_ptr_C != nullptr)
                 {
+                    RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
                     RETURN_IF_HIP_ERROR(hipMemcpyAsync(
                         &end, &csr_row_ptr_C[m], sizeof(I), hipMemcpyDeviceToHost, handle->stream));
                     RETURN_IF_HIP_ERROR(hipMemcpyAsync(&start,
@@ -470,6 +472,8 @@ namespace rocsparse
 
                 if(csr_row_ptr_C != nullptr)
                 {
+                    RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
                     RETURN_IF_HIP_ERROR(hipMemcpyAsync(
                         &end, &csr_row_ptr_C[m], sizeof(I), hipMemcpyDeviceToHost, handle->stream));
                     RETURN_IF_HIP_ERROR(hipMemcpyAsync(&start,
@@ -573,6 +577,8 @@ namespace rocsparse
 
                 if(csr_row_ptr_C != nullptr)
                 {
+                    RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
                     RETURN_IF_HIP_ERROR(hipMemcpyAsync(
                         &end, &csr_row_ptr_C[m], sizeof(I), hipMemcpyDeviceToHost, handle->stream));
                     RETURN_IF_HIP_ERROR(hipMemcpyAsync(&start,
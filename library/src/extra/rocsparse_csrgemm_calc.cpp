@@ -38,6 +38,7 @@ namespace rocsparse
               unsigned int WFSIZE,
               unsigned int HASHSIZE,
               unsigned int HASHVAL,
+              typename S,
               typename I,
               typename J,
               typename T,
@@ -68,7 +69,7 @@ namespace rocsparse
                                  bool                 mul,
                                  bool                 add)
     {
-        rocsparse::csrgemm_fill_wf_per_row_device<BLOCKSIZE, WFSIZE, HASHSIZE, HASHVAL>(
+        rocsparse::csrgemm_fill_wf_per_row_device<BLOCKSIZE, WFSIZE, HASHSIZE, HASHVAL, S>(
             m,
             nk,
             offset,
@@ -101,6 +102,7 @@ namespace rocsparse
               unsigned int WFSIZE,
               unsigned int HASHSIZE,
               unsigned int HASHVAL,
+              typename S,
               typename I,
               typename J,
               typename T,
@@ -130,7 +132,7 @@ namespace rocsparse
                                     bool                 mul,
                                     bool                 add)
     {
-        rocsparse::csrgemm_fill_block_per_row_device<BLOCKSIZE, WFSIZE, HASHSIZE, HASHVAL>(
+        rocsparse::csrgemm_fill_block_per_row_device<BLOCKSIZE, WFSIZE, HASHSIZE, HASHVAL, S>(
             nk,
             offset,
             perm,
@@ -161,6 +163,7 @@ namespace rocsparse
     template <unsigned int BLOCKSIZE,
               unsigned int WFSIZE,
               unsigned int CHUNKSIZE,
+              typename S,
               typename I,
               typename J,
               typename T,
@@ -191,7 +194,7 @@ namespace rocsparse
                                               bool                 mul,
                                               bool                 add)
     {
-        rocsparse::csrgemm_fill_block_per_row_multipass_device<BLOCKSIZE, WFSIZE, CHUNKSIZE>(
+        rocsparse::csrgemm_fill_block_per_row_multipass_device<BLOCKSIZE, WFSIZE, CHUNKSIZE, S>(
             n,
             offset,
             perm,
@@ -222,7 +225,8 @@ namespace rocsparse
 
     // Disable for rocsparse_double_complex, as well as double and rocsparse_float_complex
     // if I == J == int64_t, as required size would exceed available memory
-    template <typename I,
+    template <typename S,
+              typename I,
               typename J,
               typename T,
               typename U,
@@ -265,7 +269,8 @@ namespace rocsparse
         return rocsparse_status_internal_error;
     }
 
-    template <typename I,
+    template <typename S,
+              typename I,
               typename J,
               typename T,
               typename U,
@@ -312,7 +317,8 @@ namespace rocsparse
             (rocsparse::csrgemm_fill_block_per_row<CSRGEMM_DIM,
                                                    CSRGEMM_SUB,
                                                    CSRGEMM_HASHSIZE,
-                                                   CSRGEMM_FLL_HASH>),
+                                                   CSRGEMM_FLL_HASH,
+                                                   S>),
             dim3(group_size),
             dim3(CSRGEMM_DIM),
             0,
@@ -348,7 +354,7 @@ namespace rocsparse
     }
 }
 
-template <typename I, typename J, typename T, typename U>
+template <typename I, typename J, typename T, typename U, typename S>
 rocsparse_status rocsparse::csrgemm_calc_template(rocsparse_handle          handle,
                                                   rocsparse_operation       trans_A,
                                                   rocsparse_operation       trans_B,
@@ -401,150 +407,187 @@ rocsparse_status rocsparse::csrgemm_calc_template(rocsparse_handle          hand
     // Temporary buffer
     char* buffer = reinterpret_cast<char*>(temp_buffer);
 
-    // rocprim buffer
-    size_t rocprim_size;
-    void*  rocprim_buffer;
-
-    // Determine maximum non-zero entries per row of all rows
-    J* workspace = reinterpret_cast<J*>(buffer);
-
-#define CSRGEMM_DIM 256
-    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::csrgemm_max_row_nnz_part1<CSRGEMM_DIM>),
-                                       dim3(CSRGEMM_DIM),
-                                       dim3(CSRGEMM_DIM),
-                                       0,
-                                       stream,
-                                       m,
-                                       csr_row_ptr_C,
-                                       workspace);
-
-    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::csrgemm_max_row_nnz_part2<CSRGEMM_DIM>),
-                                       dim3(1),
-                                       dim3(CSRGEMM_DIM),
-                                       0,
-                                       stream,
-                                       workspace);
-#undef CSRGEMM_DIM
-
-    J nnz_max;
-    RETURN_IF_HIP_ERROR(
-        hipMemcpyAsync(&nnz_max, workspace, sizeof(J), hipMemcpyDeviceToHost, stream));
-
-    // Wait for host transfer to finish
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
-
     // Group offset buffer
     J* d_group_offset = reinterpret_cast<J*>(buffer);
-    buffer += sizeof(J) * 256;
 
     // Group size buffer
     J h_group_size[CSRGEMM_MAXGROUPS];
 
-    // Initialize group sizes with zero
-    memset(&h_group_size[0], 0, sizeof(J) * CSRGEMM_MAXGROUPS);
-
     // Permutation array
     J* d_perm = nullptr;
 
-    // If maximum of row nnz exceeds 16, we process the rows in groups of
-    // similar sized row nnz
-    if(nnz_max > 16)
+    // First group of the rows processed by the multipass kernel
+    int multipass_group = 7;
+
+    if(info_C->csrgemm_info->group_size_cached)
     {
-        // Group size buffer
-        J* d_group_size = reinterpret_cast<J*>(buffer);
-        buffer += sizeof(J) * 256 * CSRGEMM_MAXGROUPS;
+        // Group sizes, group offsets and row permutation have been gathered by the nnz stage
+        for(int i = 0; i < CSRGEMM_MAXGROUPS; ++i)
+        {
+            h_group_size[i] = static_cast<J>(info_C->csrgemm_info->group_size[i]);
+        }
 
-        // Permutation temporary arrays
-        J* tmp_vals = reinterpret_cast<J*>(buffer);
-        buffer += ((sizeof(J) * m - 1) / 256 + 1) * 256;
+        if(info_C->csrgemm_info->group_size[CSRGEMM_MAXGROUPS] > 16)
+        {
+            d_perm = reinterpret_cast<J*>(buffer + sizeof(J) * 256
+                                          + sizeof(J) * 256 * CSRGEMM_MAXGROUPS);
+        }
 
-        J* tmp_perm = reinterpret_cast<J*>(buffer);
-        buffer += ((sizeof(J) * m - 1) / 256 + 1) * 256;
+        // The rows of group 6 exceed the shared memory for these types. They directly
+        // precede the rows of group 7 in the permutation and join them in the multipass
+        // kernel.
+        if(exceeding_smem)
+        {
+            h_group_size[7] += h_group_size[6];
+            h_group_size[6] = 0;
+            multipass_group = 6;
+        }
+    }
+    else
+    {
+        // The maximum number of non-zeros per row and the group sizes are read back on the
+        // host
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
 
-        int* tmp_keys = reinterpret_cast<int*>(buffer);
-        buffer += ((sizeof(int) * m - 1) / 256 + 1) * 256;
+        // rocprim buffer
+        size_t rocprim_size;
+        void*  rocprim_buffer;
 
-        int* tmp_groups = reinterpret_cast<int*>(buffer);
-        buffer += ((sizeof(int) * m - 1) / 256 + 1) * 256;
+        // Determine maximum non-zero entries per row of all rows
+        J* workspace = reinterpret_cast<J*>(buffer);
 
-        // Determine number of rows per group
 #define CSRGEMM_DIM 256
-        RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
-            (rocsparse::csrgemm_group_reduce_part2<CSRGEMM_DIM, CSRGEMM_MAXGROUPS, exceeding_smem>),
-            dim3(CSRGEMM_DIM),
-            dim3(CSRGEMM_DIM),
-            0,
-            stream,
-            m,
-            csr_row_ptr_C,
-            d_group_size,
-            tmp_groups);
+        RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::csrgemm_max_row_nnz_part1<CSRGEMM_DIM>),
+                                           dim3(CSRGEMM_DIM),
+                                           dim3(CSRGEMM_DIM),
+                                           0,
+                                           stream,
+                                           m,
+                                           csr_row_ptr_C,
+                                           workspace);
 
-        RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
-            (rocsparse::csrgemm_group_reduce_part3<CSRGEMM_DIM, CSRGEMM_MAXGROUPS>),
-            dim3(1),
-            dim3(CSRGEMM_DIM),
-            0,
-            stream,
-            d_group_size);
+        RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::csrgemm_max_row_nnz_part2<CSRGEMM_DIM>),
+                                           dim3(1),
+                                           dim3(CSRGEMM_DIM),
+                                           0,
+                                           stream,
+                                           workspace);
 #undef CSRGEMM_DIM
 
-        // Exclusive sum to obtain group offsets
-        RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
-                                                    rocprim_size,
-                                                    d_group_size,
-                                                    d_group_offset,
-                                                    0,
-                                                    CSRGEMM_MAXGROUPS,
-                                                    rocprim::plus<J>(),
-                                                    stream));
-        rocprim_buffer = reinterpret_cast<void*>(buffer);
-        RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(rocprim_buffer,
-                                                    rocprim_size,
-                                                    d_group_size,
-                                                    d_group_offset,
-                                                    0,
-                                                    CSRGEMM_MAXGROUPS,
-                                                    rocprim::plus<J>(),
-                                                    stream));
-
-        // Copy group sizes to host
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(&h_group_size,
-                                           d_group_size,
-                                           sizeof(J) * CSRGEMM_MAXGROUPS,
-                                           hipMemcpyDeviceToHost,
-                                           stream));
+        J nnz_max;
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(&nnz_max, workspace, sizeof(J), hipMemcpyDeviceToHost, stream));
 
         // Wait for host transfer to finish
         RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
-        // Create identity permutation for group access
-        RETURN_IF_ROCSPARSE_ERROR(
-            rocsparse::create_identity_permutation_template(handle, m, tmp_perm));
+        // Group offset buffer
+        buffer += sizeof(J) * 256;
 
-        rocprim::double_buffer<int> d_keys(tmp_groups, tmp_keys);
-        rocprim::double_buffer<J>   d_vals(tmp_perm, tmp_vals);
+        // Initialize group sizes with zero
+        memset(&h_group_size[0], 0, sizeof(J) * CSRGEMM_MAXGROUPS);
 
-        // Sort pairs (by groups)
-        RETURN_IF_HIP_ERROR(
-            rocprim::radix_sort_pairs(nullptr, rocprim_size, d_keys, d_vals, m, 0, 3, stream));
-        rocprim_buffer = reinterpret_cast<void*>(buffer);
-        RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
-            rocprim_buffer, rocprim_size, d_keys, d_vals, m, 0, 3, stream));
+        // If maximum of row nnz exceeds 16, we process the rows in groups of
+        // similar sized row nnz
+        if(nnz_max > 16)
+        {
+            // Group size buffer
+            J* d_group_size = reinterpret_cast<J*>(buffer);
+            buffer += sizeof(J) * 256 * CSRGEMM_MAXGROUPS;
 
-        d_perm = d_vals.current();
+            // Permutation temporary arrays
+            J* tmp_vals = reinterpret_cast<J*>(buffer);
+            buffer += ((sizeof(J) * m - 1) / 256 + 1) * 256;
 
-        // Release tmp_groups buffer
-        // buffer -= ((sizeof(int) * m - 1) / 256 + 1) * 256;
+            J* tmp_perm = reinterpret_cast<J*>(buffer);
+            buffer += ((sizeof(J) * m - 1) / 256 + 1) * 256;
 
-        // Release tmp_keys buffer
-        // buffer -= ((sizeof(int) * m - 1) / 256 + 1) * 256;
-    }
-    else
-    {
-        // First group processes all rows
-        h_group_size[0] = m;
-        RETURN_IF_HIP_ERROR(hipMemsetAsync(d_group_offset, 0, sizeof(J), stream));
+            int* tmp_keys = reinterpret_cast<int*>(buffer);
+            buffer += ((sizeof(int) * m - 1) / 256 + 1) * 256;
+
+            int* tmp_groups = reinterpret_cast<int*>(buffer);
+            buffer += ((sizeof(int) * m - 1) / 256 + 1) * 256;
+
+            // Determine number of rows per group
+#define CSRGEMM_DIM 256
+            RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+                (rocsparse::
+                     csrgemm_group_reduce_part2<CSRGEMM_DIM, CSRGEMM_MAXGROUPS, exceeding_smem>),
+                dim3(CSRGEMM_DIM),
+                dim3(CSRGEMM_DIM),
+                0,
+                stream,
+                m,
+                csr_row_ptr_C,
+                d_group_size,
+                tmp_groups);
+
+            RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+                (rocsparse::csrgemm_group_reduce_part3<CSRGEMM_DIM, CSRGEMM_MAXGROUPS>),
+                dim3(1),
+                dim3(CSRGEMM_DIM),
+                0,
+                stream,
+                d_group_size);
+#undef CSRGEMM_DIM
+
+            // Exclusive sum to obtain group offsets
+            RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
+                                                        rocprim_size,
+                                                        d_group_size,
+                                                        d_group_offset,
+                                                        0,
+                                                        CSRGEMM_MAXGROUPS,
+                                                        rocprim::plus<J>(),
+                                                        stream));
+            rocprim_buffer = reinterpret_cast<void*>(buffer);
+            RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(rocprim_buffer,
+                                                        rocprim_size,
+                                                        d_group_size,
+                                                        d_group_offset,
+                                                        0,
+                                                        CSRGEMM_MAXGROUPS,
+                                                        rocprim::plus<J>(),
+                                                        stream));
+
+            // Copy group sizes to host
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(&h_group_size,
+                                               d_group_size,
+                                               sizeof(J) * CSRGEMM_MAXGROUPS,
+                                               hipMemcpyDeviceToHost,
+                                               stream));
+
+            // Wait for host transfer to finish
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+            // Create identity permutation for group access
+            RETURN_IF_ROCSPARSE_ERROR(
+                rocsparse::create_identity_permutation_template(handle, m, tmp_perm));
+
+            rocprim::double_buffer<int> d_keys(tmp_groups, tmp_keys);
+            rocprim::double_buffer<J>   d_vals(tmp_perm, tmp_vals);
+
+            // Sort pairs (by groups)
+            RETURN_IF_HIP_ERROR(
+                rocprim::radix_sort_pairs(nullptr, rocprim_size, d_keys, d_vals, m, 0, 3, stream));
+            rocprim_buffer = reinterpret_cast<void*>(buffer);
+            RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+                rocprim_buffer, rocprim_size, d_keys, d_vals, m, 0, 3, stream));
+
+            d_perm = d_vals.current();
+
+            // Release tmp_groups buffer
+            // buffer -= ((sizeof(int) * m - 1) / 256 + 1) * 256;
+
+            // Release tmp_keys buffer
+            // buffer -= ((sizeof(int) * m - 1) / 256 + 1) * 256;
+        }
+        else
+        {
+            // First group processes all rows
+            h_group_size[0] = m;
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(d_group_offset, 0, sizeof(J), stream));
+        }
     }
 
     // Compute columns and accumulate values for each group
@@ -558,7 +601,8 @@ rocsparse_status rocsparse::csrgemm_calc_template(rocsparse_handle          hand
             (rocsparse::csrgemm_fill_wf_per_row<CSRGEMM_DIM,
                                                 CSRGEMM_SUB,
                                                 CSRGEMM_HASHSIZE,
-                                                CSRGEMM_FLL_HASH>),
+                                                CSRGEMM_FLL_HASH,
+                                                S>),
             dim3((h_group_size[0] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
             dim3(CSRGEMM_DIM),
             0,
@@ -602,7 +646,8 @@ rocsparse_status rocsparse::csrgemm_calc_template(rocsparse_handle          hand
             (rocsparse::csrgemm_fill_wf_per_row<CSRGEMM_DIM,
                                                 CSRGEMM_SUB,
                                                 CSRGEMM_HASHSIZE,
-                                                CSRGEMM_FLL_HASH>),
+                                                CSRGEMM_FLL_HASH,
+                                                S>),
             dim3((h_group_size[1] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
             dim3(CSRGEMM_DIM),
             0,
@@ -646,7 +691,8 @@ rocsparse_status rocsparse::csrgemm_calc_template(rocsparse_handle          hand
             (rocsparse::csrgemm_fill_block_per_row<CSRGEMM_DIM,
                                                    CSRGEMM_SUB,
                                                    CSRGEMM_HASHSIZE,
-                                                   CSRGEMM_FLL_HASH>),
+                                                   CSRGEMM_FLL_HASH,
+                                                   S>),
             dim3(h_group_size[2]),
             dim3(CSRGEMM_DIM),
             0,
@@ -689,7 +735,8 @@ rocsparse_status rocsparse::csrgemm_calc_template(rocsparse_handle          hand
             (rocsparse::csrgemm_fill_block_per_row<CSRGEMM_DIM,
                                                    CSRGEMM_SUB,
                                                    CSRGEMM_HASHSIZE,
-                                                   CSRGEMM_FLL_HASH>),
+                                                   CSRGEMM_FLL_HASH,
+                                                   S>),
             dim3(h_group_size[3]),
             dim3(CSRGEMM_DIM),
             0,
@@ -732,7 +779,8 @@ rocsparse_status rocsparse::csrgemm_calc_template(rocsparse_handle          hand
             (rocsparse::csrgemm_fill_block_per_row<CSRGEMM_DIM,
                                                    CSRGEMM_SUB,
                                                    CSRGEMM_HASHSIZE,
-                                                   CSRGEMM_FLL_HASH>),
+                                                   CSRGEMM_FLL_HASH,
+                                                   S>),
             dim3(h_group_size[4]),
             dim3(CSRGEMM_DIM),
             0,
@@ -775,7 +823,8 @@ rocsparse_status rocsparse::csrgemm_calc_template(rocsparse_handle          hand
             (rocsparse::csrgemm_fill_block_per_row<CSRGEMM_DIM,
                                                    CSRGEMM_SUB,
                                                    CSRGEMM_HASHSIZE,
-                                                   CSRGEMM_FLL_HASH>),
+                                                   CSRGEMM_FLL_HASH,
+                                                   S>),
             dim3(h_group_size[5]),
             dim3(CSRGEMM_DIM),
             0,
@@ -812,7 +861,7 @@ rocsparse_status rocsparse::csrgemm_calc_template(rocsparse_handle          hand
     // Group 6: 2049 - 4096 non-zeros per row
     if(h_group_size[6] > 0 && !exceeding_smem)
     {
-        RETURN_IF_ROCSPARSE_ERROR(rocsparse::csrgemm_launcher(handle,
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::csrgemm_launcher<S>(handle,
                                                               h_group_size[6],
                                                               &d_group_offset[6],
                                                               d_perm,
@@ -866,14 +915,16 @@ rocsparse_status rocsparse::csrgemm_calc_template(rocsparse_handle          hand
         }
 
         RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
-            (rocsparse::
-                 csrgemm_fill_block_per_row_multipass<CSRGEMM_DIM, CSRGEMM_SUB, CSRGEMM_CHUNKSIZE>),
+            (rocsparse::csrgemm_fill_block_per_row_multipass<CSRGEMM_DIM,
+                                                             CSRGEMM_SUB,
+                                                             CSRGEMM_CHUNKSIZE,
+                                                             S>),
             dim3(h_group_size[7]),
             dim3(CSRGEMM_DIM),
             0,
             stream,
             n,
-            &d_group_offset[7],
+            &d_group_offset[multipass_group],
             d_perm,
             alpha_device_host,
             csr_row_ptr_A,
@@ -971,3 +1022,62 @@ INSTANTIATE(int64_t, int32_t, rocsparse_float_complex, const rocsparse_float_com
 INSTANTIATE(int64_t, int32_t, rocsparse_double_complex, const rocsparse_double_complex*);
 
 #undef INSTANTIATE
+
+#define INSTANTIATE(I, J, T, U, S)                                                                  \
+    template rocsparse_status rocsparse::csrgemm_calc_template<I, J, T, U, S>(                      \
+        rocsparse_handle          handle,                                                           \
+        rocsparse_operation       trans_A,                                                          \
+        rocsparse_operation       trans_B,                                                          \
+        J                         m,                                                                \
+        J                         n,                                                                \
+        J                         k,                                                                \
+        U                         alpha_device_host,                                                \
+        const rocsparse_mat_descr descr_A,                                                          \
+        I                         nnz_A,                                                            \
+        const T*                  csr_val_A,                                                        \
+        const I*                  csr_row_ptr_A,                                                    \
+        const J*                  csr_col_ind_A,                                                    \
+        const rocsparse_mat_descr descr_B,                                                          \
+        I                         nnz_B,                                                            \
+        const T*                  csr_val_B,                                                        \
+        const I*                  csr_row_ptr_B,                                                    \
+        const J*                  csr_col_ind_B,                                                    \
+        U                         beta_device_host,                                                 \
+        const rocsparse_mat_descr descr_D,                                                          \
+        I                         nnz_D,                                                            \
+        const T*                  csr_val_D,                                                        \
+        const I*                  csr_row_ptr_D,                                                    \
+        const J*                  csr_col_ind_D,                                                    \
+        const rocsparse_mat_descr descr_C,                                                          \
+        T*                        csr_val_C,                                                        \
+        const I*                  csr_row_ptr_C,                                                    \
+        J*                        csr_col_ind_C,                                                    \
+        const rocsparse_mat_info  info_C,                                                           \
+        void*                     temp_buffer)
+
+#define INSTANTIATE_SEMIRINGS(I, J, T, U)                   \
+    INSTANTIATE(I, J, T, U, rocsparse::min_plus_semiring);  \
+    INSTANTIATE(I, J, T, U, rocsparse::max_times_semiring); \
+    INSTANTIATE(I, J, T, U, rocsparse::max_min_semiring);   \
+    INSTANTIATE(I, J, T, U, rocsparse::or_and_semiring)
+
+INSTANTIATE_SEMIRINGS(int32_t, int32_t, float, float);
+INSTANTIATE_SEMIRINGS(int32_t, int32_t, double, double);
+
+INSTANTIATE_SEMIRINGS(int64_t, int64_t, float, float);
+INSTANTIATE_SEMIRINGS(int64_t, int64_t, double, double);
+
+INSTANTIATE_SEMIRINGS(int64_t, int32_t, float, float);
+INSTANTIATE_SEMIRINGS(int64_t, int32_t, double, double);
+
+INSTANTIATE_SEMIRINGS(int32_t, int32_t, float, const float*);
+INSTANTIATE_SEMIRINGS(int32_t, int32_t, double, const double*);
+
+INSTANTIATE_SEMIRINGS(int64_t, int64_t, float, const float*);
+INSTANTIATE_SEMIRINGS(int64_t, int64_t, double, const double*);
+
+INSTANTIATE_SEMIRINGS(int64_t, int32_t, float, const float*);
+INSTANTIATE_SEMIRINGS(int64_t, int32_t, double, const double*);
+
+#undef INSTANTIATE_SEMIRINGS
+#undef INSTANTIATE
@@ -28,7 +28,13 @@
 
 namespace rocsparse
 {
-    template <typename I, typename J, typename T, typename U>
+    struct plus_times_semiring;
+
+    template <typename I,
+              typename J,
+              typename T,
+              typename U,
+              typename S = rocsparse::plus_times_semiring>
     rocsparse_status csrgemm_calc_template(rocsparse_handle          handle,
                                            rocsparse_operation       trans_A,
                                            rocsparse_operation       trans_B,
@@ -0,0 +1,632 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_csrgemm_masked.hpp"
+#include "control.h"
+#include "csrgemm_device.h"
+#include "utility.h"
+
+#include <rocprim/rocprim.hpp>
+
+#define CSRGEMM_MASKED_DIM 256
+#define CSRGEMM_MASKED_SUB 16
+#define CSRGEMM_MASKED_CHUNKSIZE 2048
+
+namespace rocsparse
+{
+    template <unsigned int BLOCKSIZE,
+              unsigned int WFSIZE,
+              unsigned int CHUNKSIZE,
+              bool         COMPLEMENT,
+              typename I,
+              typename J,
+              typename T>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void csrgemm_masked_nnz_kernel(J n,
+                                   const I* __restrict__ csr_row_ptr_A,
+                                   const J* __restrict__ csr_col_ind_A,
+                                   const I* __restrict__ csr_row_ptr_B,
+                                   const J* __restrict__ csr_col_ind_B,
+                                   const I* __restrict__ csr_row_ptr_M,
+                                   const J* __restrict__ csr_col_ind_M,
+                                   I* __restrict__ row_nnz,
+                                   I* __restrict__ workspace_B,
+                                   rocsparse_index_base idx_base_A,
+                                   rocsparse_index_base idx_base_B,
+                                   rocsparse_index_base idx_base_M)
+    {
+        rocsparse::csrgemm_masked_block_per_row_multipass_device<BLOCKSIZE,
+                                                                 WFSIZE,
+                                                                 CHUNKSIZE,
+                                                                 COMPLEMENT,
+                                                                 false>(
+            n,
+            static_cast<T>(0),
+            csr_row_ptr_A,
+            csr_col_ind_A,
+            (const T*)nullptr,
+            csr_row_ptr_B,
+            csr_col_ind_B,
+            (const T*)nullptr,
+            csr_row_ptr_M,
+            csr_col_ind_M,
+            row_nnz,
+            (J*)nullptr,
+            (T*)nullptr,
+            workspace_B,
+            idx_base_A,
+            idx_base_B,
+            idx_base_M,
+            rocsparse_index_base_zero);
+    }
+
+    template <unsigned int BLOCKSIZE,
+              unsigned int WFSIZE,
+              unsigned int CHUNKSIZE,
+              bool         COMPLEMENT,
+              typename I,
+              typename J,
+              typename T,
+              typename U>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void csrgemm_masked_fill_kernel(J n,
+                                    U alpha_device_host,
+                                    const I* __restrict__ csr_row_ptr_A,
+                                    const J* __restrict__ csr_col_ind_A,
+                                    const T* __restrict__ csr_val_A,
+                                    const I* __restrict__ csr_row_ptr_B,
+                                    const J* __restrict__ csr_col_ind_B,
+                                    const T* __restrict__ csr_val_B,
+                                    const I* __restrict__ csr_row_ptr_M,
+                                    const J* __restrict__ csr_col_ind_M,
+                                    I* __restrict__ csr_row_ptr_C,
+                                    J* __restrict__ csr_col_ind_C,
+                                    T* __restrict__ csr_val_C,
+                                    I* __restrict__ workspace_B,
+                                    rocsparse_index_base idx_base_A,
+                                    rocsparse_index_base idx_base_B,
+                                    rocsparse_index_base idx_base_M,
+                                    rocsparse_index_base idx_base_C)
+    {
+        auto alpha = rocsparse::load_scalar_device_host(alpha_device_host);
+        rocsparse::csrgemm_masked_block_per_row_multipass_device<BLOCKSIZE,
+                                                                 WFSIZE,
+                                                                 CHUNKSIZE,
+                                                                 COMPLEMENT,
+                                                                 true>(n,
+                                                                       alpha,
+                                                                       csr_row_ptr_A,
+                                                                       csr_col_ind_A,
+                                                                       csr_val_A,
+                                                                       csr_row_ptr_B,
+                                                                       csr_col_ind_B,
+                                                                       csr_val_B,
+                                                                       csr_row_ptr_M,
+                                                                       csr_col_ind_M,
+                                                                       csr_row_ptr_C,
+                                                                       csr_col_ind_C,
+                                                                       csr_val_C,
+                                                                       workspace_B,
+                                                                       idx_base_A,
+                                                                       idx_base_B,
+                                                                       idx_base_M,
+                                                                       idx_base_C);
+    }
+
+    template <typename I, typename J, typename T, typename U>
+    static rocsparse_status
+        csrgemm_masked_fill_dispatch(rocsparse_handle          handle,
+                                     rocsparse_spgemm_mask     mask,
+                                     J                         m,
+                                     J                         n,
+                                     U                         alpha_device_host,
+                                     const rocsparse_mat_descr descr_A,
+                                     const T*                  csr_val_A,
+                                     const I*                  csr_row_ptr_A,
+                                     const J*                  csr_col_ind_A,
+                                     const rocsparse_mat_descr descr_B,
+                                     const T*                  csr_val_B,
+                                     const I*                  csr_row_ptr_B,
+                                     const J*                  csr_col_ind_B,
+                                     const rocsparse_mat_descr descr_M,
+                                     const I*                  csr_row_ptr_M,
+                                     const J*                  csr_col_ind_M,
+                                     const rocsparse_mat_descr descr_C,
+                                     T*                        csr_val_C,
+                                     const I*                  csr_row_ptr_C,
+                                     J*                        csr_col_ind_C,
+                                     I*                        workspace_B)
+    {
+        switch(mask)
+        {
+        case rocsparse_spgemm_mask_structure:
+        {
+            RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+                (rocsparse::csrgemm_masked_fill_kernel<CSRGEMM_MASKED_DIM,
+                                                       CSRGEMM_MASKED_SUB,
+                                                       CSRGEMM_MASKED_CHUNKSIZE,
+                                                       false>),
+                dim3(m),
+                dim3(CSRGEMM_MASKED_DIM),
+                0,
+                handle->stream,
+                n,
+                alpha_device_host,
+                csr_row_ptr_A,
+                csr_col_ind_A,
+                csr_val_A,
+                csr_row_ptr_B,
+                csr_col_ind_B,
+                csr_val_B,
+                csr_row_ptr_M,
+                csr_col_ind_M,
+                const_cast<I*>(csr_row_ptr_C),
+                csr_col_ind_C,
+                csr_val_C,
+                workspace_B,
+                descr_A->base,
+                descr_B->base,
+                descr_M->base,
+                descr_C->base);
+            return rocsparse_status_success;
+        }
+        case rocsparse_spgemm_mask_complement:
+        {
+            RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+                (rocsparse::csrgemm_masked_fill_kernel<CSRGEMM_MASKED_DIM,
+                                                       CSRGEMM_MASKED_SUB,
+                                                       CSRGEMM_MASKED_CHUNKSIZE,
+                                                       true>),
+                dim3(m),
+                dim3(CSRGEMM_MASKED_DIM),
+                0,
+                handle->stream,
+                n,
+                alpha_device_host,
+                csr_row_ptr_A,
+                csr_col_ind_A,
+                csr_val_A,
+                csr_row_ptr_B,
+                csr_col_ind_B,
+                csr_val_B,
+                csr_row_ptr_M,
+                csr_col_ind_M,
+                const_cast<I*>(csr_row_ptr_C),
+                csr_col_ind_C,
+                csr_val_C,
+                workspace_B,
+                descr_A->base,
+                descr_B->base,
+                descr_M->base,
+                descr_C->base);
+            return rocsparse_status_success;
+        }
+        }
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_invalid_value);
+    }
+
+    static rocsparse_status csrgemm_masked_checkstorage(rocsparse_operation       trans_A,
+                                                        rocsparse_operation       trans_B,
+                                                        const rocsparse_mat_descr descr_A,
+                                                        const rocsparse_mat_descr descr_B,
+                                                        const rocsparse_mat_descr descr_M)
+    {
+        if(trans_A != rocsparse_operation_none)
+        {
+            RETURN_WITH_MESSAGE_IF_ROCSPARSE_ERROR(
+                rocsparse_status_not_implemented,
+                " failed on condition (trans_A != rocsparse_operation_none)");
+        }
+
+        if(trans_B != rocsparse_operation_none)
+        {
+            RETURN_WITH_MESSAGE_IF_ROCSPARSE_ERROR(
+                rocsparse_status_not_implemented,
+                " failed on condition (trans_B != rocsparse_operation_none)");
+        }
+
+        if(descr_A->type != rocsparse_matrix_type_general
+           || descr_B->type != rocsparse_matrix_type_general
+           || descr_M->type != rocsparse_matrix_type_general)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_not_implemented);
+        }
+
+        // Columns of B and of the mask are traversed in chunks of increasing column index
+        if(descr_B->storage_mode != rocsparse_storage_mode_sorted
+           || descr_M->storage_mode != rocsparse_storage_mode_sorted)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_requires_sorted_storage);
+        }
+
+        return rocsparse_status_success;
+    }
+}
+
+template <typename I, typename J, typename T>
+rocsparse_status
+    rocsparse::csrgemm_masked_buffer_size_template(rocsparse_handle          handle,
+                                                   rocsparse_operation       trans_A,
+                                                   rocsparse_operation       trans_B,
+                                                   J                         m,
+                                                   J                         n,
+                                                   J                         k,
+                                                   const rocsparse_mat_descr descr_A,
+                                                   I                         nnz_A,
+                                                   const I*                  csr_row_ptr_A,
+                                                   const J*                  csr_col_ind_A,
+                                                   const rocsparse_mat_descr descr_B,
+                                                   I                         nnz_B,
+                                                   const I*                  csr_row_ptr_B,
+                                                   const J*                  csr_col_ind_B,
+                                                   const rocsparse_mat_descr descr_M,
+                                                   I                         nnz_M,
+                                                   const I*                  csr_row_ptr_M,
+                                                   const J*                  csr_col_ind_M,
+                                                   size_t*                   buffer_size)
+{
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse::csrgemm_masked_checkstorage(trans_A, trans_B, descr_A, descr_B, descr_M));
+
+    *buffer_size = 0;
+
+    // Position of the current chunk in each row of B that is referenced by A
+    if(nnz_A > 0)
+    {
+        *buffer_size += ((sizeof(I) * nnz_A - 1) / 256 + 1) * 256;
+    }
+
+    // rocprim buffer to obtain the row pointers of C
+    size_t rocprim_size;
+    I*     ptr = nullptr;
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
+                                                rocprim_size,
+                                                ptr,
+                                                ptr,
+                                                static_cast<I>(0),
+                                                m + 1,
+                                                rocprim::plus<I>(),
+                                                handle->stream));
+    *buffer_size += ((rocprim_size - 1) / 256 + 1) * 256;
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse::csrgemm_masked_nnz_template(rocsparse_handle          handle,
+                                                        rocsparse_operation       trans_A,
+                                                        rocsparse_operation       trans_B,
+                                                        rocsparse_spgemm_mask     mask,
+                                                        J                         m,
+                                                        J                         n,
+                                                        J                         k,
+                                                        const rocsparse_mat_descr descr_A,
+                                                        I                         nnz_A,
+                                                        const I*                  csr_row_ptr_A,
+                                                        const J*                  csr_col_ind_A,
+                                                        const rocsparse_mat_descr descr_B,
+                                                        I                         nnz_B,
+                                                        const I*                  csr_row_ptr_B,
+                                                        const J*                  csr_col_ind_B,
+                                                        const rocsparse_mat_descr descr_M,
+                                                        I                         nnz_M,
+                                                        const I*                  csr_row_ptr_M,
+                                                        const J*                  csr_col_ind_M,
+                                                        const rocsparse_mat_descr descr_C,
+                                                        I*                        csr_row_ptr_C,
+                                                        I*                        nnz_C,
+                                                        void*                     temp_buffer)
+{
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse::csrgemm_masked_checkstorage(trans_A, trans_B, descr_A, descr_B, descr_M));
+
+    // The number of non-zeros of C is read back on the host
+    RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
+    hipStream_t stream = handle->stream;
+
+    // Temporary buffer
+    char* buffer      = reinterpret_cast<char*>(temp_buffer);
+    I*    workspace_B = reinterpret_cast<I*>(buffer);
+    if(nnz_A > 0)
+    {
+        buffer += ((sizeof(I) * nnz_A - 1) / 256 + 1) * 256;
+    }
+
+    // Compute the number of non-zero entries of each row of C
+    if(m > 0)
+    {
+        if(mask == rocsparse_spgemm_mask_complement)
+        {
+            RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+                (rocsparse::csrgemm_masked_nnz_kernel<CSRGEMM_MASKED_DIM,
+                                                      CSRGEMM_MASKED_SUB,
+                                                      CSRGEMM_MASKED_CHUNKSIZE,
+                                                      true,
+                                                      I,
+                                                      J,
+                                                      T>),
+                dim3(m),
+                dim3(CSRGEMM_MASKED_DIM),
+                0,
+                stream,
+                n,
+                csr_row_ptr_A,
+                csr_col_ind_A,
+                csr_row_ptr_B,
+                csr_col_ind_B,
+                csr_row_ptr_M,
+                csr_col_ind_M,
+                csr_row_ptr_C,
+                workspace_B,
+                descr_A->base,
+                descr_B->base,
+                descr_M->base);
+        }
+        else
+        {
+            RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+                (rocsparse::csrgemm_masked_nnz_kernel<CSRGEMM_MASKED_DIM,
+                                                      CSRGEMM_MASKED_SUB,
+                                                      CSRGEMM_MASKED_CHUNKSIZE,
+                                                      false,
+                                                      I,
+                                                      J,
+                                                      T>),
+                dim3(m),
+                dim3(CSRGEMM_MASKED_DIM),
+                0,
+                stream,
+                n,
+                csr_row_ptr_A,
+                csr_col_ind_A,
+                csr_row_ptr_B,
+                csr_col_ind_B,
+                csr_row_ptr_M,
+                csr_col_ind_M,
+                csr_row_ptr_C,
+                workspace_B,
+                descr_A->base,
+                descr_B->base,
+                descr_M->base);
+        }
+    }
+
+    // Exclusive sum to obtain row pointers of C
+    size_t rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
+                                                rocprim_size,
+                                                csr_row_ptr_C,
+                                                csr_row_ptr_C,
+                                                static_cast<I>(descr_C->base),
+                                                m + 1,
+                                                rocprim::plus<I>(),
+                                                stream));
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(buffer,
+                                                rocprim_size,
+                                                csr_row_ptr_C,
+                                                csr_row_ptr_C,
+                                                static_cast<I>(descr_C->base),
+                                                m + 1,
+                                                rocprim::plus<I>(),
+                                                stream));
+
+    // Store nnz of C
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(nnz_C, csr_row_ptr_C + m, sizeof(I), hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // Adjust nnz by index base
+    *nnz_C -= descr_C->base;
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse::csrgemm_masked_template(rocsparse_handle          handle,
+                                                    rocsparse_operation       trans_A,
+                                                    rocsparse_operation       trans_B,
+                                                    rocsparse_spgemm_mask     mask,
+                                                    J                         m,
+                                                    J                         n,
+                                                    J                         k,
+                                                    const T*                  alpha,
+                                                    const rocsparse_mat_descr descr_A,
+                                                    I                         nnz_A,
+                                                    const T*                  csr_val_A,
+                                                    const I*                  csr_row_ptr_A,
+                                                    const J*                  csr_col_ind_A,
+                                                    const rocsparse_mat_descr descr_B,
+                                                    I                         nnz_B,
+                                                    const T*                  csr_val_B,
+                                                    const I*                  csr_row_ptr_B,
+                                                    const J*                  csr_col_ind_B,
+                                                    const rocsparse_mat_descr descr_M,
+                                                    I                         nnz_M,
+                                                    const I*                  csr_row_ptr_M,
+                                                    const J*                  csr_col_ind_M,
+                                                    const rocsparse_mat_descr descr_C,
+                                                    I                         nnz_C,
+                                                    T*                        csr_val_C,
+                                                    const I*                  csr_row_ptr_C,
+                                                    J*                        csr_col_ind_C,
+                                                    void*                     temp_buffer)
+{
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse::csrgemm_masked_checkstorage(trans_A, trans_B, descr_A, descr_B, descr_M));
+
+    // Quick return
+    if(m == 0 || nnz_C == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    I* workspace_B = reinterpret_cast<I*>(temp_buffer);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::csrgemm_masked_fill_dispatch(handle,
+                                                                          mask,
+                                                                          m,
+                                                                          n,
+                                                                          alpha,
+                                                                          descr_A,
+                                                                          csr_val_A,
+                                                                          csr_row_ptr_A,
+                                                                          csr_col_ind_A,
+                                                                          descr_B,
+                                                                          csr_val_B,
+                                                                          csr_row_ptr_B,
+                                                                          csr_col_ind_B,
+                                                                          descr_M,
+                                                                          csr_row_ptr_M,
+                                                                          csr_col_ind_M,
+                                                                          descr_C,
+                                                                          csr_val_C,
+                                                                          csr_row_ptr_C,
+                                                                          csr_col_ind_C,
+                                                                          workspace_B));
+    }
+    else
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::csrgemm_masked_fill_dispatch(handle,
+                                                                          mask,
+                                                                          m,
+                                                                          n,
+                                                                          *alpha,
+                                                                          descr_A,
+                                                                          csr_val_A,
+                                                                          csr_row_ptr_A,
+                                                                          csr_col_ind_A,
+                                                                          descr_B,
+                                                                          csr_val_B,
+                                                                          csr_row_ptr_B,
+                                                                          csr_col_ind_B,
+                                                                          descr_M,
+                                                                          csr_row_ptr_M,
+                                                                          csr_col_ind_M,
+                                                                          descr_C,
+                                                                          csr_val_C,
+                                                                          csr_row_ptr_C,
+                                                                          csr_col_ind_C,
+                                                                          workspace_B));
+    }
+
+    return rocsparse_status_success;
+}
+
+#define INSTANTIATE(I, J, T)                                                           \
+    template rocsparse_status rocsparse::csrgemm_masked_buffer_size_template<I, J, T>( \
+        rocsparse_handle          handle,                                              \
+        rocsparse_operation       trans_A,                                             \
+        rocsparse_operation       trans_B,                                             \
+        J                         m,                                                   \
+        J                         n,                                                   \
+        J                         k,                                                   \
+        const rocsparse_mat_descr descr_A,                                             \
+        I                         nnz_A,                                               \
+        const I*                  csr_row_ptr_A,                                       \
+        const J*                  csr_col_ind_A,                                       \
+        const rocsparse_mat_descr descr_B,                                             \
+        I                         nnz_B,                                               \
+        const I*                  csr_row_ptr_B,                                       \
+        const J*                  csr_col_ind_B,                                       \
+        const rocsparse_mat_descr descr_M,                                             \
+        I                         nnz_M,                                               \
+        const I*                  csr_row_ptr_M,                                       \
+        const J*                  csr_col_ind_M,                                       \
+        size_t*                   buffer_size);                                        \
+                                                                                       \
+    template rocsparse_status rocsparse::csrgemm_masked_nnz_template<I, J, T>(         \
+        rocsparse_handle          handle,                                              \
+        rocsparse_operation       trans_A,                                             \
+        rocsparse_operation       trans_B,                                             \
+        rocsparse_spgemm_mask     mask,                                                \
+        J                         m,                                                   \
+        J                         n,                                                   \
+        J                         k,                                                   \
+        const rocsparse_mat_descr descr_A,                                             \
+        I                         nnz_A,                                               \
+        const I*                  csr_row_ptr_A,                                       \
+        const J*                  csr_col_ind_A,                                       \
+        const rocsparse_mat_descr descr_B,                                             \
+        I                         nnz_B,                                               \
+        const I*                  csr_row_ptr_B,                                       \
+        const J*                  csr_col_ind_B,                                       \
+        const rocsparse_mat_descr descr_M,                                             \
+        I                         nnz_M,                                               \
+        const I*                  csr_row_ptr_M,                                       \
+        const J*                  csr_col_ind_M,                                       \
+        const rocsparse_mat_descr descr_C,                                             \
+        I*                        csr_row_ptr_C,                                       \
+        I*                        nnz_C,                                               \
+        void*                     temp_buffer);                                        \
+                                                                                       \
+    template rocsparse_status rocsparse::csrgemm_masked_template<I, J, T>(             \
+        rocsparse_handle          handle,                                              \
+        rocsparse_operation       trans_A,                                             \
+        rocsparse_operation       trans_B,                                             \
+        rocsparse_spgemm_mask     mask,                                                \
+        J                         m,                                                   \
+        J                         n,                                                   \
+        J                         k,                                                   \
+        const T*                  alpha,                                               \
+        const rocsparse_mat_descr descr_A,                                             \
+        I                         nnz_A,                                               \
+        const T*                  csr_val_A,                                           \
+        const I*                  csr_row_ptr_A,                                       \
+        const J*                  csr_col_ind_A,                                       \
+        const rocsparse_mat_descr descr_B,                                             \
+        I                         nnz_B,                                               \
+        const T*                  csr_val_B,                                           \
+        const I*                  csr_row_ptr_B,                                       \
+        const J*                  csr_col_ind_B,                                       \
+        const rocsparse_mat_descr descr_M,                                             \
+        I                         nnz_M,                                               \
+        const I*                  csr_row_ptr_M,                                       \
+        const J*                  csr_col_ind_M,                                       \
+        const rocsparse_mat_descr descr_C,                                             \
+        I                         nnz_C,                                               \
+        T*                        csr_val_C,                                           \
+        const I*                  csr_row_ptr_C,                                       \
+        J*                        csr_col_ind_C,                                       \
+        void*                     temp_buffer)
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int32_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex);
+
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex);
+
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int64_t, int64_t, double);
+INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
+
+#undef INSTANTIATE
@@ -27,6 +27,7 @@
 #include "control.h"
 #include "csrgemm_device.h"
 #include "rocsparse_csrgemm.hpp"
+#include "rocsparse_csrgemm_symbolic_calc.hpp"
 #include "utility.h"
 
 #include <rocprim/rocprim.hpp>
@@ -56,6 +57,9 @@ rocsparse_status rocsparse::csrgemm_nnz_calc(rocsparse_handle          handle,
                                              const rocsparse_mat_info  info_C,
                                              void*                     temp_buffer)
 {
+    // Group sizes of a previous product are stale
+    info_C->csrgemm_info->group_size_cached = false;
+
     // Stream
     hipStream_t stream = handle->stream;
 
@@ -71,6 +75,21 @@ rocsparse_status rocsparse::csrgemm_nnz_calc(rocsparse_handle          handle,
     bool mul = info_C->csrgemm_info->mul;
     bool add = info_C->csrgemm_info->add;
 
+    // In device pointer mode, all group kernels are launched without copying the group
+    // sizes back to the host. The grids are sized from an upper bound and blocks without
+    // row exit early. This requires sorted B and D, since the multipass kernel for rows
+    // with many intermediate products cannot be excluded beforehand.
+    const bool sync_free
+        = handle->pointer_mode == rocsparse_pointer_mode_device
+          && (mul == false || descr_B->storage_mode == rocsparse_storage_mode_sorted)
+          && (add == false || descr_D->storage_mode == rocsparse_storage_mode_sorted);
+
+    // Otherwise, the intermediate products and the group sizes are read back on the host
+    if(sync_free == false)
+    {
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+    }
+
     // Temporary buffer
     char* buffer = reinterpret_cast<char*>(temp_buffer);
 
@@ -99,30 +118,35 @@ rocsparse_status rocsparse::csrgemm_nnz_calc(rocsparse_handle          handle,
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
 
-    // Determine maximum of all intermediate products
-    RETURN_IF_HIP_ERROR(rocprim::reduce(nullptr,
-                                        rocprim_size,
-                                        csr_row_ptr_C,
-                                        csr_row_ptr_C + m,
-                                        0,
-                                        m,
-                                        rocprim::maximum<I>(),
-                                        stream));
-    rocprim_buffer = reinterpret_cast<void*>(buffer);
-    RETURN_IF_HIP_ERROR(rocprim::reduce(rocprim_buffer,
-                                        rocprim_size,
-                                        csr_row_ptr_C,
-                                        csr_row_ptr_C + m,
-                                        0,
-                                        m,
-                                        rocprim::maximum<I>(),
-                                        stream));
-
-    I int_max;
-    RETURN_IF_HIP_ERROR(
-        hipMemcpyAsync(&int_max, csr_row_ptr_C + m, sizeof(I), hipMemcpyDeviceToHost, stream));
-    // Wait for host transfer to finish
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    // Maximum of all intermediate products
+    I int_max = 0;
+
+    if(sync_free == false)
+    {
+        // Determine maximum of all intermediate products
+        RETURN_IF_HIP_ERROR(rocprim::reduce(nullptr,
+                                            rocprim_size,
+                                            csr_row_ptr_C,
+                                            csr_row_ptr_C + m,
+                                            0,
+                                            m,
+                                            rocprim::maximum<I>(),
+                                            stream));
+        rocprim_buffer = reinterpret_cast<void*>(buffer);
+        RETURN_IF_HIP_ERROR(rocprim::reduce(rocprim_buffer,
+                                            rocprim_size,
+                                            csr_row_ptr_C,
+                                            csr_row_ptr_C + m,
+                                            0,
+                                            m,
+                                            rocprim::maximum<I>(),
+                                            stream));
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            &int_max, csr_row_ptr_C + m, sizeof(I), hipMemcpyDeviceToHost, stream));
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    }
 
     // Group offset buffer
     J* d_group_offset = reinterpret_cast<J*>(buffer);
@@ -137,9 +161,9 @@ rocsparse_status rocsparse::csrgemm_nnz_calc(rocsparse_handle          handle,
     // Permutation array
     J* d_perm = nullptr;
 
-    // If maximum of intermediate products exceeds 32, we process the rows in groups of
-    // similar sized intermediate products
-    if(int_max > 32)
+    // If maximum of intermediate products exceeds 32 (or is unknown), we process the rows
+    // in groups of similar sized intermediate products
+    if(sync_free == true || int_max > 32)
     {
         // Group size buffer
         J* d_group_size = reinterpret_cast<J*>(buffer);
@@ -166,13 +190,16 @@ rocsparse_status rocsparse::csrgemm_nnz_calc(rocsparse_handle          handle,
             d_group_size);
 #undef CSRGEMM_DIM
 
-        // Exclusive sum to obtain group offsets
+        // Exclusive sum to obtain group offsets, the additional trailing offset
+        // allows the kernels to determine the size of each group on the device
+        RETURN_IF_HIP_ERROR(
+            hipMemsetAsync(d_group_size + CSRGEMM_MAXGROUPS, 0, sizeof(J), stream));
         RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
                                                     rocprim_size,
                                                     d_group_size,
                                                     d_group_offset,
                                                     0,
-                                                    CSRGEMM_MAXGROUPS,
+                                                    CSRGEMM_MAXGROUPS + 1,
                                                     rocprim::plus<J>(),
                                                     stream));
         rocprim_buffer = reinterpret_cast<void*>(buffer);
@@ -181,19 +208,36 @@ rocsparse_status rocsparse::csrgemm_nnz_calc(rocsparse_handle          handle,
                                                     d_group_size,
                                                     d_group_offset,
                                                     0,
-                                                    CSRGEMM_MAXGROUPS,
+                                                    CSRGEMM_MAXGROUPS + 1,
                                                     rocprim::plus<J>(),
                                                     stream));
 
-        // Copy group sizes to host
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(&h_group_size,
-                                           d_group_size,
-                                           sizeof(J) * CSRGEMM_MAXGROUPS,
-                                           hipMemcpyDeviceToHost,
-                                           stream));
-
-        // Wait for host transfer to finish
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        if(sync_free == true)
+        {
+            // Minimum number of intermediate products of the rows in each group
+            const int64_t group_min_prod[CSRGEMM_MAXGROUPS]
+                = {0, 33, 65, 513, 1025, 2049, 4097, 8193};
+
+            // A row has at most nnz_B + nnz_D intermediate products, groups beyond this
+            // bound are known to be empty and skipped. Any other group holds at most m rows.
+            const int64_t max_prod = (mul ? int64_t(nnz_B) : 0) + (add ? int64_t(nnz_D) : 0);
+            for(int i = 0; i < CSRGEMM_MAXGROUPS; ++i)
+            {
+                h_group_size[i] = (max_prod >= group_min_prod[i]) ? m : 0;
+            }
+        }
+        else
+        {
+            // Copy group sizes to host
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(&h_group_size,
+                                               d_group_size,
+                                               sizeof(J) * CSRGEMM_MAXGROUPS,
+                                               hipMemcpyDeviceToHost,
+                                               stream));
+
+            // Wait for host transfer to finish
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        }
 
         // Permutation temporary arrays
         J* tmp_vals = reinterpret_cast<J*>(buffer);
@@ -566,6 +610,14 @@ rocsparse_status rocsparse::csrgemm_nnz_calc(rocsparse_handle          handle,
         *nnz_C -= descr_C->base;
     }
 
+    // The host is synchronized anyway, gather the row groups of C such that the compute
+    // stage does not read them back on the host
+    if(sync_free == false)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::csrgemm_symbolic_calc_preprocess_template(
+            handle, m, csr_row_ptr_C, info_C, temp_buffer));
+    }
+
     return rocsparse_status_success;
 }
 
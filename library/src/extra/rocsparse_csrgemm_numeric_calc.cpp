@@ -1146,14 +1146,27 @@ rocsparse_status rocsparse::csrgemm_numeric_calc_template(rocsparse_handle    ha
 
     J h_group_size[CSRGEMM_MAXGROUPS + 1];
 
-    // Copy group sizes to host
-    RETURN_IF_HIP_ERROR(hipMemcpyAsync(h_group_size,
-                                       d_group_size,
-                                       sizeof(J) * (CSRGEMM_MAXGROUPS + 1),
-                                       hipMemcpyDeviceToHost,
-                                       handle->stream));
-    // Wait for host transfer to finish
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
+    if(info_C->csrgemm_info->group_size_cached)
+    {
+        // Group sizes have been gathered by the symbolic stage
+        for(int i = 0; i < CSRGEMM_MAXGROUPS + 1; ++i)
+        {
+            h_group_size[i] = static_cast<J>(info_C->csrgemm_info->group_size[i]);
+        }
+    }
+    else
+    {
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
+        // Copy group sizes to host
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(h_group_size,
+                                           d_group_size,
+                                           sizeof(J) * (CSRGEMM_MAXGROUPS + 1),
+                                           hipMemcpyDeviceToHost,
+                                           handle->stream));
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
+    }
 
     J nnz_max = h_group_size[CSRGEMM_MAXGROUPS];
     if(nnz_max > 16)
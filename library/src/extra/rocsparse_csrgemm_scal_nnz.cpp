@@ -117,11 +117,14 @@ rocsparse_status rocsparse::csrgemm_scal_nnz_core(rocsparse_handle          hand
         // When scaling a matrix, nnz of C will always be equal to nnz of D
         if(handle->pointer_mode == rocsparse_pointer_mode_device)
         {
-            RETURN_IF_HIP_ERROR(
-                hipMemcpyAsync(nnz_C, &nnz_D, sizeof(I), hipMemcpyHostToDevice, stream));
-
-            // Wait for host transfer to finish
-            RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
+            RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::set_array_to_value<256>),
+                                               dim3(1),
+                                               dim3(256),
+                                               0,
+                                               stream,
+                                               1,
+                                               nnz_C,
+                                               nnz_D);
         }
         else
         {
@@ -1083,9 +1083,13 @@ template <typename I, typename J>
 rocsparse_status rocsparse::csrgemm_symbolic_calc_preprocess_template(rocsparse_handle handle,
                                                                       const J          m,
                                                                       const I* csr_row_ptr_C,
+                                                                      rocsparse_mat_info info_C,
                                                                       void*    temp_buffer)
 {
 
+    // The maximum number of non-zeros per row and the group sizes are read back on the host
+    RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
     // Stream
     hipStream_t stream = handle->stream;
 
@@ -1223,9 +1227,23 @@ rocsparse_status rocsparse::csrgemm_symbolic_calc_preprocess_template(rocsparse_
     }
     RETURN_IF_HIP_ERROR(hipMemcpyAsync(
         d_group_size + CSRGEMM_MAXGROUPS, &nnz_max, sizeof(J), hipMemcpyHostToDevice, stream));
+
+    // Keep a host copy of the group sizes for the subsequent stages
+    J h_group_size[CSRGEMM_MAXGROUPS + 1];
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(h_group_size,
+                                       d_group_size,
+                                       sizeof(J) * (CSRGEMM_MAXGROUPS + 1),
+                                       hipMemcpyDeviceToHost,
+                                       stream));
     // Wait for host transfer to finish
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
+    for(int i = 0; i < CSRGEMM_MAXGROUPS + 1; ++i)
+    {
+        info_C->csrgemm_info->group_size[i] = h_group_size[i];
+    }
+    info_C->csrgemm_info->group_size_cached = true;
+
     // Compute columns and accumulate values for each group
     ROCSPARSE_RETURN_STATUS(success);
 }
@@ -1264,14 +1282,27 @@ rocsparse_status rocsparse::csrgemm_symbolic_calc_template(rocsparse_handle
 
     J h_group_size[CSRGEMM_MAXGROUPS + 1];
 
-    // Copy group sizes to host
-    RETURN_IF_HIP_ERROR(hipMemcpyAsync(h_group_size,
-                                       d_group_size,
-                                       sizeof(J) * (CSRGEMM_MAXGROUPS + 1),
-                                       hipMemcpyDeviceToHost,
-                                       handle->stream));
-    // Wait for host transfer to finish
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
+    if(info_C->csrgemm_info->group_size_cached)
+    {
+        // Group sizes have been gathered by the symbolic stage
+        for(int i = 0; i < CSRGEMM_MAXGROUPS + 1; ++i)
+        {
+            h_group_size[i] = static_cast<J>(info_C->csrgemm_info->group_size[i]);
+        }
+    }
+    else
+    {
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
+        // Copy group sizes to host
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(h_group_size,
+                                           d_group_size,
+                                           sizeof(J) * (CSRGEMM_MAXGROUPS + 1),
+                                           hipMemcpyDeviceToHost,
+                                           handle->stream));
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
+    }
     J nnz_max = h_group_size[CSRGEMM_MAXGROUPS];
     if(nnz_max > 16)
     {
@@ -1614,7 +1645,11 @@ rocsparse_status rocsparse::csrgemm_symbolic_calc_template(rocsparse_handle
 
 #define INSTANTIATE(I, J)                                                               \
     template rocsparse_status rocsparse::csrgemm_symbolic_calc_preprocess_template(     \
-        rocsparse_handle handle, const J m, const I* csr_row_ptr_C, void* temp_buffer); \
+        rocsparse_handle   handle,                                                      \
+        const J            m,                                                           \
+        const I*           csr_row_ptr_C,                                               \
+        rocsparse_mat_info info_C,                                                      \
+        void*              temp_buffer);                                                \
                                                                                         \
     template rocsparse_status rocsparse::csrgemm_symbolic_calc_template(                \
         rocsparse_handle          handle,                                               \
@@ -1647,3 +1682,11 @@ INSTANTIATE(int64_t, int32_t);
 INSTANTIATE(int64_t, int64_t);
 
 #undef INSTANTIATE
+
+// The nnz stage gathers the row groups of C for all of its index types
+template rocsparse_status rocsparse::csrgemm_symbolic_calc_preprocess_template(
+    rocsparse_handle   handle,
+    const int64_t      m,
+    const int32_t*     csr_row_ptr_C,
+    rocsparse_mat_info info_C,
+    void*              temp_buffer);
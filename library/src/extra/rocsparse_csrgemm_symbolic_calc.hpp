@@ -29,10 +29,11 @@
 namespace rocsparse
 {
     template <typename I, typename J>
-    rocsparse_status csrgemm_symbolic_calc_preprocess_template(rocsparse_handle handle,
-                                                               const J          m,
-                                                               const I*         csr_row_ptr_C,
-                                                               void*            temp_buffer);
+    rocsparse_status csrgemm_symbolic_calc_preprocess_template(rocsparse_handle   handle,
+                                                               const J            m,
+                                                               const I*           csr_row_ptr_C,
+                                                               rocsparse_mat_info info_C,
+                                                               void*              temp_buffer);
 
     template <typename I, typename J>
     rocsparse_status csrgemm_symbolic_calc_template(rocsparse_handle          handle,
@@ -108,7 +108,7 @@ rocsparse_status rocsparse::csrgemm_symbolic_mult_core(rocsparse_handle
         }
 
         RETURN_IF_ROCSPARSE_ERROR(rocsparse::csrgemm_symbolic_calc_preprocess_template(
-            handle, m, csr_row_ptr_C, temp_buffer));
+            handle, m, csr_row_ptr_C, info_C, temp_buffer));
         RETURN_IF_ROCSPARSE_ERROR(rocsparse::csrgemm_symbolic_calc_template(handle,
                                                                             trans_A,
                                                                             trans_B,
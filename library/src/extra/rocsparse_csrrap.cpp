@@ -0,0 +1,791 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "internal/extra/rocsparse_csrrap.h"
+#include "control.h"
+#include "rocsparse_csrgemm.hpp"
+#include "rocsparse_csrrap.hpp"
+#include "utility.h"
+
+#include "csrrap_device.h"
+#include <rocprim/rocprim.hpp>
+
+#define CSRRAP_DIM 256
+#define CSRRAP_SUB 32
+#define CSRRAP_HASHSIZE 256
+#define CSRRAP_MULTIPASS_DIM 512
+#define CSRRAP_CHUNKSIZE 2048
+
+namespace rocsparse
+{
+    template <unsigned int BLOCKSIZE, typename I>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void csrrap_nnz_total(I m, const I* __restrict__ csr_row_ptr_C, I idx_base_C, I* nnz_C)
+    {
+        if(hipThreadIdx_x == 0)
+        {
+            *nnz_C = csr_row_ptr_C[m] - idx_base_C;
+        }
+    }
+
+    template <typename I, typename J>
+    static rocsparse_status csrrap_checkarg_operands(J                         m,
+                                                     J                         n,
+                                                     J                         k,
+                                                     const rocsparse_mat_descr descr_R,
+                                                     I                         nnz_R,
+                                                     const I*                  csr_row_ptr_R,
+                                                     const J*                  csr_col_ind_R,
+                                                     const rocsparse_mat_descr descr_A,
+                                                     I                         nnz_A,
+                                                     const I*                  csr_row_ptr_A,
+                                                     const J*                  csr_col_ind_A,
+                                                     const rocsparse_mat_descr descr_P,
+                                                     I                         nnz_P,
+                                                     const I*                  csr_row_ptr_P,
+                                                     const J*                  csr_col_ind_P)
+    {
+        ROCSPARSE_CHECKARG_SIZE(1, m);
+        ROCSPARSE_CHECKARG_SIZE(2, n);
+        ROCSPARSE_CHECKARG_SIZE(3, k);
+        ROCSPARSE_CHECKARG_POINTER(4, descr_R);
+        ROCSPARSE_CHECKARG(4,
+                           descr_R,
+                           (descr_R->type != rocsparse_matrix_type_general),
+                           rocsparse_status_not_implemented);
+        ROCSPARSE_CHECKARG_SIZE(5, nnz_R);
+        ROCSPARSE_CHECKARG_ARRAY(6, m, csr_row_ptr_R);
+        ROCSPARSE_CHECKARG_ARRAY(7, nnz_R, csr_col_ind_R);
+        ROCSPARSE_CHECKARG_POINTER(8, descr_A);
+        ROCSPARSE_CHECKARG(8,
+                           descr_A,
+                           (descr_A->type != rocsparse_matrix_type_general),
+                           rocsparse_status_not_implemented);
+        ROCSPARSE_CHECKARG_SIZE(9, nnz_A);
+        ROCSPARSE_CHECKARG_ARRAY(10, n, csr_row_ptr_A);
+        ROCSPARSE_CHECKARG_ARRAY(11, nnz_A, csr_col_ind_A);
+        ROCSPARSE_CHECKARG_POINTER(12, descr_P);
+        ROCSPARSE_CHECKARG(12,
+                           descr_P,
+                           (descr_P->type != rocsparse_matrix_type_general),
+                           rocsparse_status_not_implemented);
+        ROCSPARSE_CHECKARG_SIZE(13, nnz_P);
+        ROCSPARSE_CHECKARG_ARRAY(14, n, csr_row_ptr_P);
+        ROCSPARSE_CHECKARG_ARRAY(15, nnz_P, csr_col_ind_P);
+
+        return rocsparse_status_success;
+    }
+}
+
+template <typename I, typename J>
+rocsparse_status rocsparse::csrrap_buffer_size_template(rocsparse_handle          handle, //0
+                                                        J                         m, //1
+                                                        J                         n, //2
+                                                        J                         k, //3
+                                                        const rocsparse_mat_descr descr_R, //4
+                                                        I                         nnz_R, //5
+                                                        const I* csr_row_ptr_R, //6
+                                                        const J* csr_col_ind_R, //7
+                                                        const rocsparse_mat_descr descr_A, //8
+                                                        I                         nnz_A, //9
+                                                        const I* csr_row_ptr_A, //10
+                                                        const J* csr_col_ind_A, //11
+                                                        const rocsparse_mat_descr descr_P, //12
+                                                        I                         nnz_P, //13
+                                                        const I* csr_row_ptr_P, //14
+                                                        const J* csr_col_ind_P, //15
+                                                        size_t*  buffer_size) //16
+{
+    // Logging
+    rocsparse::log_trace(handle,
+                         "rocsparse_csrrap_buffer_size",
+                         m,
+                         n,
+                         k,
+                         (const void*&)descr_R,
+                         nnz_R,
+                         (const void*&)csr_row_ptr_R,
+                         (const void*&)csr_col_ind_R,
+                         (const void*&)descr_A,
+                         nnz_A,
+                         (const void*&)csr_row_ptr_A,
+                         (const void*&)csr_col_ind_A,
+                         (const void*&)descr_P,
+                         nnz_P,
+                         (const void*&)csr_row_ptr_P,
+                         (const void*&)csr_col_ind_P,
+                         (const void*&)buffer_size);
+
+    ROCSPARSE_CHECKARG_HANDLE(0, handle);
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::csrrap_checkarg_operands(m,
+                                                                  n,
+                                                                  k,
+                                                                  descr_R,
+                                                                  nnz_R,
+                                                                  csr_row_ptr_R,
+                                                                  csr_col_ind_R,
+                                                                  descr_A,
+                                                                  nnz_A,
+                                                                  csr_row_ptr_A,
+                                                                  csr_col_ind_A,
+                                                                  descr_P,
+                                                                  nnz_P,
+                                                                  csr_row_ptr_P,
+                                                                  csr_col_ind_P));
+    ROCSPARSE_CHECKARG_POINTER(16, buffer_size);
+
+    // Upper bounds of the row nnz of A * P and R * A * P
+    *buffer_size = ((sizeof(I) * n - 1) / 256 + 1) * 256 + ((sizeof(I) * m - 1) / 256 + 1) * 256;
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J>
+rocsparse_status rocsparse::csrrap_nnz_template(rocsparse_handle          handle, //0
+                                                J                         m, //1
+                                                J                         n, //2
+                                                J                         k, //3
+                                                const rocsparse_mat_descr descr_R, //4
+                                                I                         nnz_R, //5
+                                                const I*                  csr_row_ptr_R, //6
+                                                const J*                  csr_col_ind_R, //7
+                                                const rocsparse_mat_descr descr_A, //8
+                                                I                         nnz_A, //9
+                                                const I*                  csr_row_ptr_A, //10
+                                                const J*                  csr_col_ind_A, //11
+                                                const rocsparse_mat_descr descr_P, //12
+                                                I                         nnz_P, //13
+                                                const I*                  csr_row_ptr_P, //14
+                                                const J*                  csr_col_ind_P, //15
+                                                const rocsparse_mat_descr descr_C, //16
+                                                I*                        csr_row_ptr_C, //17
+                                                I*                        nnz_C, //18
+                                                void*                     temp_buffer) //19
+{
+    // Logging
+    rocsparse::log_trace(handle,
+                         "rocsparse_csrrap_nnz",
+                         m,
+                         n,
+                         k,
+                         (const void*&)descr_R,
+                         nnz_R,
+                         (const void*&)csr_row_ptr_R,
+                         (const void*&)csr_col_ind_R,
+                         (const void*&)descr_A,
+                         nnz_A,
+                         (const void*&)csr_row_ptr_A,
+                         (const void*&)csr_col_ind_A,
+                         (const void*&)descr_P,
+                         nnz_P,
+                         (const void*&)csr_row_ptr_P,
+                         (const void*&)csr_col_ind_P,
+                         (const void*&)descr_C,
+                         (const void*&)csr_row_ptr_C,
+                         (const void*&)nnz_C,
+                         (const void*&)temp_buffer);
+
+    ROCSPARSE_CHECKARG_HANDLE(0, handle);
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::csrrap_checkarg_operands(m,
+                                                                  n,
+                                                                  k,
+                                                                  descr_R,
+                                                                  nnz_R,
+                                                                  csr_row_ptr_R,
+                                                                  csr_col_ind_R,
+                                                                  descr_A,
+                                                                  nnz_A,
+                                                                  csr_row_ptr_A,
+                                                                  csr_col_ind_A,
+                                                                  descr_P,
+                                                                  nnz_P,
+                                                                  csr_row_ptr_P,
+                                                                  csr_col_ind_P));
+    ROCSPARSE_CHECKARG_POINTER(16, descr_C);
+    ROCSPARSE_CHECKARG(16,
+                       descr_C,
+                       (descr_C->type != rocsparse_matrix_type_general),
+                       rocsparse_status_not_implemented);
+    ROCSPARSE_CHECKARG_ARRAY(17, m, csr_row_ptr_C);
+    ROCSPARSE_CHECKARG_POINTER(18, nnz_C);
+
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible, C is empty
+    if(m == 0 || n == 0 || k == 0 || nnz_R == 0 || nnz_A == 0 || nnz_P == 0)
+    {
+        if(m > 0)
+        {
+            RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::set_array_to_value<256>),
+                                               dim3(m / 256 + 1),
+                                               dim3(256),
+                                               0,
+                                               stream,
+                                               (m + 1),
+                                               csr_row_ptr_C,
+                                               static_cast<I>(descr_C->base));
+        }
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(nnz_C, 0, sizeof(I), stream));
+        }
+        else
+        {
+            *nnz_C = 0;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    ROCSPARSE_CHECKARG_POINTER(19, temp_buffer);
+
+    // The number of non-zeros is only read back on the host in host pointer mode
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+    }
+
+    // Temporary buffer entry points
+    char* ptr      = reinterpret_cast<char*>(temp_buffer);
+    I*    bound_AP = reinterpret_cast<I*>(ptr);
+    ptr += ((sizeof(I) * n - 1) / 256 + 1) * 256;
+    I* bound_RAP = reinterpret_cast<I*>(ptr);
+
+    // Upper bound of the row nnz of A * P
+    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::csrrap_ap_bound<CSRRAP_DIM, 8>),
+                                       dim3((n - 1) / (CSRRAP_DIM / 8) + 1),
+                                       dim3(CSRRAP_DIM),
+                                       0,
+                                       stream,
+                                       n,
+                                       csr_row_ptr_A,
+                                       csr_col_ind_A,
+                                       csr_row_ptr_P,
+                                       descr_A->base,
+                                       bound_AP);
+
+    // Upper bound of the row nnz of R * A * P
+    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::csrrap_rap_bound<CSRRAP_DIM, 8>),
+                                       dim3((m - 1) / (CSRRAP_DIM / 8) + 1),
+                                       dim3(CSRRAP_DIM),
+                                       0,
+                                       stream,
+                                       m,
+                                       k,
+                                       csr_row_ptr_R,
+                                       csr_col_ind_R,
+                                       descr_R->base,
+                                       bound_AP,
+                                       bound_RAP);
+
+    // Both kernels are launched unconditionally, each row is processed by exactly one of
+    // them depending on its upper bound. This avoids any host synchronization to obtain
+    // the row distribution.
+    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+        (rocsparse::
+             csrrap_nnz_wf_per_row<CSRRAP_DIM, CSRRAP_SUB, CSRRAP_HASHSIZE, CSRGEMM_NNZ_HASH>),
+        dim3((m - 1) / (CSRRAP_DIM / CSRRAP_SUB) + 1),
+        dim3(CSRRAP_DIM),
+        0,
+        stream,
+        m,
+        bound_RAP,
+        csr_row_ptr_R,
+        csr_col_ind_R,
+        csr_row_ptr_A,
+        csr_col_ind_A,
+        csr_row_ptr_P,
+        csr_col_ind_P,
+        csr_row_ptr_C + 1,
+        descr_R->base,
+        descr_A->base,
+        descr_P->base);
+
+    if(handle->wavefront_size == 32)
+    {
+        RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+            (rocsparse::csrrap_nnz_block_per_row_multipass<CSRRAP_MULTIPASS_DIM,
+                                                           32,
+                                                           CSRRAP_CHUNKSIZE,
+                                                           CSRRAP_HASHSIZE>),
+            dim3(m),
+            dim3(CSRRAP_MULTIPASS_DIM),
+            0,
+            stream,
+            k,
+            bound_RAP,
+            csr_row_ptr_R,
+            csr_col_ind_R,
+            csr_row_ptr_A,
+            csr_col_ind_A,
+            csr_row_ptr_P,
+            csr_col_ind_P,
+            csr_row_ptr_C + 1,
+            descr_R->base,
+            descr_A->base,
+            descr_P->base);
+    }
+    else
+    {
+        RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+            (rocsparse::csrrap_nnz_block_per_row_multipass<CSRRAP_MULTIPASS_DIM,
+                                                           64,
+                                                           CSRRAP_CHUNKSIZE,
+                                                           CSRRAP_HASHSIZE>),
+            dim3(m),
+            dim3(CSRRAP_MULTIPASS_DIM),
+            0,
+            stream,
+            k,
+            bound_RAP,
+            csr_row_ptr_R,
+            csr_col_ind_R,
+            csr_row_ptr_A,
+            csr_col_ind_A,
+            csr_row_ptr_P,
+            csr_col_ind_P,
+            csr_row_ptr_C + 1,
+            descr_R->base,
+            descr_A->base,
+            descr_P->base);
+    }
+
+    // Compute csr_row_ptr_C with the right index base.
+    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::set_array_to_value<256>),
+                                       dim3(1),
+                                       dim3(256),
+                                       0,
+                                       stream,
+                                       1,
+                                       csr_row_ptr_C,
+                                       static_cast<I>(descr_C->base));
+
+    // Exclusive sum to obtain row pointers of C
+    size_t rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        nullptr, rocprim_size, csr_row_ptr_C, csr_row_ptr_C, m + 1, rocprim::plus<I>(), stream));
+
+    bool  rocprim_alloc;
+    void* rocprim_buffer;
+
+    if(handle->buffer_size >= rocprim_size)
+    {
+        rocprim_buffer = handle->buffer;
+        rocprim_alloc  = false;
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(rocsparse_hipMallocAsync(&rocprim_buffer, rocprim_size, stream));
+        rocprim_alloc = true;
+    }
+
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(rocprim_buffer,
+                                                rocprim_size,
+                                                csr_row_ptr_C,
+                                                csr_row_ptr_C,
+                                                m + 1,
+                                                rocprim::plus<I>(),
+                                                stream));
+
+    if(rocprim_alloc == true)
+    {
+        RETURN_IF_HIP_ERROR(rocsparse_hipFreeAsync(rocprim_buffer, stream));
+    }
+
+    // Extract the number of non-zero elements of C
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::csrrap_nnz_total<1>),
+                                           dim3(1),
+                                           dim3(1),
+                                           0,
+                                           stream,
+                                           static_cast<I>(m),
+                                           csr_row_ptr_C,
+                                           static_cast<I>(descr_C->base),
+                                           nnz_C);
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(nnz_C, csr_row_ptr_C + m, sizeof(I), hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        *nnz_C -= descr_C->base;
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse::csrrap_template(rocsparse_handle          handle, //0
+                                            J                         m, //1
+                                            J                         n, //2
+                                            J                         k, //3
+                                            const rocsparse_mat_descr descr_R, //4
+                                            I                         nnz_R, //5
+                                            const T*                  csr_val_R, //6
+                                            const I*                  csr_row_ptr_R, //7
+                                            const J*                  csr_col_ind_R, //8
+                                            const rocsparse_mat_descr descr_A, //9
+                                            I                         nnz_A, //10
+                                            const T*                  csr_val_A, //11
+                                            const I*                  csr_row_ptr_A, //12
+                                            const J*                  csr_col_ind_A, //13
+                                            const rocsparse_mat_descr descr_P, //14
+                                            I                         nnz_P, //15
+                                            const T*                  csr_val_P, //16
+                                            const I*                  csr_row_ptr_P, //17
+                                            const J*                  csr_col_ind_P, //18
+                                            const rocsparse_mat_descr descr_C, //19
+                                            T*                        csr_val_C, //20
+                                            const I*                  csr_row_ptr_C, //21
+                                            J*                        csr_col_ind_C) //22
+{
+    // Logging
+    rocsparse::log_trace(handle,
+                         rocsparse::replaceX<T>("rocsparse_Xcsrrap"),
+                         m,
+                         n,
+                         k,
+                         (const void*&)descr_R,
+                         nnz_R,
+                         (const void*&)csr_val_R,
+                         (const void*&)csr_row_ptr_R,
+                         (const void*&)csr_col_ind_R,
+                         (const void*&)descr_A,
+                         nnz_A,
+                         (const void*&)csr_val_A,
+                         (const void*&)csr_row_ptr_A,
+                         (const void*&)csr_col_ind_A,
+                         (const void*&)descr_P,
+                         nnz_P,
+                         (const void*&)csr_val_P,
+                         (const void*&)csr_row_ptr_P,
+                         (const void*&)csr_col_ind_P,
+                         (const void*&)descr_C,
+                         (const void*&)csr_val_C,
+                         (const void*&)csr_row_ptr_C,
+                         (const void*&)csr_col_ind_C);
+
+    ROCSPARSE_CHECKARG_HANDLE(0, handle);
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::csrrap_checkarg_operands(m,
+                                                                  n,
+                                                                  k,
+                                                                  descr_R,
+                                                                  nnz_R,
+                                                                  csr_row_ptr_R,
+                                                                  csr_col_ind_R,
+                                                                  descr_A,
+                                                                  nnz_A,
+                                                                  csr_row_ptr_A,
+                                                                  csr_col_ind_A,
+                                                                  descr_P,
+                                                                  nnz_P,
+                                                                  csr_row_ptr_P,
+                                                                  csr_col_ind_P));
+    ROCSPARSE_CHECKARG_ARRAY(6, nnz_R, csr_val_R);
+    ROCSPARSE_CHECKARG_ARRAY(11, nnz_A, csr_val_A);
+    ROCSPARSE_CHECKARG_ARRAY(16, nnz_P, csr_val_P);
+    ROCSPARSE_CHECKARG_POINTER(19, descr_C);
+    ROCSPARSE_CHECKARG(19,
+                       descr_C,
+                       (descr_C->type != rocsparse_matrix_type_general),
+                       rocsparse_status_not_implemented);
+    ROCSPARSE_CHECKARG_ARRAY(21, m, csr_row_ptr_C);
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || k == 0 || nnz_R == 0 || nnz_A == 0 || nnz_P == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    if(csr_val_C == nullptr || csr_col_ind_C == nullptr)
+    {
+        int64_t nnz_C;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::calculate_nnz(
+            handle, m, rocsparse::get_indextype<I>(), csr_row_ptr_C, &nnz_C));
+
+        ROCSPARSE_CHECKARG_ARRAY(20, nnz_C, csr_val_C);
+        ROCSPARSE_CHECKARG_ARRAY(22, nnz_C, csr_col_ind_C);
+    }
+
+    hipStream_t stream = handle->stream;
+
+    // Both kernels are launched unconditionally, each row is processed by exactly one of
+    // them depending on its number of non-zero entries.
+    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+        (rocsparse::
+             csrrap_fill_wf_per_row<CSRRAP_DIM, CSRRAP_SUB, CSRRAP_HASHSIZE, CSRGEMM_FLL_HASH>),
+        dim3((m - 1) / (CSRRAP_DIM / CSRRAP_SUB) + 1),
+        dim3(CSRRAP_DIM),
+        0,
+        stream,
+        m,
+        k,
+        csr_row_ptr_R,
+        csr_col_ind_R,
+        csr_val_R,
+        csr_row_ptr_A,
+        csr_col_ind_A,
+        csr_val_A,
+        csr_row_ptr_P,
+        csr_col_ind_P,
+        csr_val_P,
+        csr_row_ptr_C,
+        csr_col_ind_C,
+        csr_val_C,
+        descr_R->base,
+        descr_A->base,
+        descr_P->base,
+        descr_C->base);
+
+    if(handle->wavefront_size == 32)
+    {
+        RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+            (rocsparse::csrrap_fill_block_per_row_multipass<CSRRAP_MULTIPASS_DIM,
+                                                            32,
+                                                            CSRRAP_CHUNKSIZE,
+                                                            CSRRAP_HASHSIZE>),
+            dim3(m),
+            dim3(CSRRAP_MULTIPASS_DIM),
+            0,
+            stream,
+            k,
+            csr_row_ptr_R,
+            csr_col_ind_R,
+            csr_val_R,
+            csr_row_ptr_A,
+            csr_col_ind_A,
+            csr_val_A,
+            csr_row_ptr_P,
+            csr_col_ind_P,
+            csr_val_P,
+            csr_row_ptr_C,
+            csr_col_ind_C,
+            csr_val_C,
+            descr_R->base,
+            descr_A->base,
+            descr_P->base,
+            descr_C->base);
+    }
+    else
+    {
+        RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+            (rocsparse::csrrap_fill_block_per_row_multipass<CSRRAP_MULTIPASS_DIM,
+                                                            64,
+                                                            CSRRAP_CHUNKSIZE,
+                                                            CSRRAP_HASHSIZE>),
+            dim3(m),
+            dim3(CSRRAP_MULTIPASS_DIM),
+            0,
+            stream,
+            k,
+            csr_row_ptr_R,
+            csr_col_ind_R,
+            csr_val_R,
+            csr_row_ptr_A,
+            csr_col_ind_A,
+            csr_val_A,
+            csr_row_ptr_P,
+            csr_col_ind_P,
+            csr_val_P,
+            csr_row_ptr_C,
+            csr_col_ind_C,
+            csr_val_C,
+            descr_R->base,
+            descr_A->base,
+            descr_P->base,
+            descr_C->base);
+    }
+
+    return rocsparse_status_success;
+}
+
+#undef CSRRAP_CHUNKSIZE
+#undef CSRRAP_MULTIPASS_DIM
+#undef CSRRAP_HASHSIZE
+#undef CSRRAP_SUB
+#undef CSRRAP_DIM
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+extern "C" rocsparse_status rocsparse_csrrap_buffer_size(rocsparse_handle          handle,
+                                                         rocsparse_int             m,
+                                                         rocsparse_int             n,
+                                                         rocsparse_int             k,
+                                                         const rocsparse_mat_descr descr_R,
+                                                         rocsparse_int             nnz_R,
+                                                         const rocsparse_int*      csr_row_ptr_R,
+                                                         const rocsparse_int*      csr_col_ind_R,
+                                                         const rocsparse_mat_descr descr_A,
+                                                         rocsparse_int             nnz_A,
+                                                         const rocsparse_int*      csr_row_ptr_A,
+                                                         const rocsparse_int*      csr_col_ind_A,
+                                                         const rocsparse_mat_descr descr_P,
+                                                         rocsparse_int             nnz_P,
+                                                         const rocsparse_int*      csr_row_ptr_P,
+                                                         const rocsparse_int*      csr_col_ind_P,
+                                                         size_t*                   buffer_size)
+try
+{
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::csrrap_buffer_size_template(handle,
+                                                                     m,
+                                                                     n,
+                                                                     k,
+                                                                     descr_R,
+                                                                     nnz_R,
+                                                                     csr_row_ptr_R,
+                                                                     csr_col_ind_R,
+                                                                     descr_A,
+                                                                     nnz_A,
+                                                                     csr_row_ptr_A,
+                                                                     csr_col_ind_A,
+                                                                     descr_P,
+                                                                     nnz_P,
+                                                                     csr_row_ptr_P,
+                                                                     csr_col_ind_P,
+                                                                     buffer_size));
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
+
+extern "C" rocsparse_status rocsparse_csrrap_nnz(rocsparse_handle          handle,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             n,
+                                                 rocsparse_int             k,
+                                                 const rocsparse_mat_descr descr_R,
+                                                 rocsparse_int             nnz_R,
+                                                 const rocsparse_int*      csr_row_ptr_R,
+                                                 const rocsparse_int*      csr_col_ind_R,
+                                                 const rocsparse_mat_descr descr_A,
+                                                 rocsparse_int             nnz_A,
+                                                 const rocsparse_int*      csr_row_ptr_A,
+                                                 const rocsparse_int*      csr_col_ind_A,
+                                                 const rocsparse_mat_descr descr_P,
+                                                 rocsparse_int             nnz_P,
+                                                 const rocsparse_int*      csr_row_ptr_P,
+                                                 const rocsparse_int*      csr_col_ind_P,
+                                                 const rocsparse_mat_descr descr_C,
+                                                 rocsparse_int*            csr_row_ptr_C,
+                                                 rocsparse_int*            nnz_C,
+                                                 void*                     temp_buffer)
+try
+{
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::csrrap_nnz_template(handle,
+                                                             m,
+                                                             n,
+                                                             k,
+                                                             descr_R,
+                                                             nnz_R,
+                                                             csr_row_ptr_R,
+                                                             csr_col_ind_R,
+                                                             descr_A,
+                                                             nnz_A,
+                                                             csr_row_ptr_A,
+                                                             csr_col_ind_A,
+                                                             descr_P,
+                                                             nnz_P,
+                                                             csr_row_ptr_P,
+                                                             csr_col_ind_P,
+                                                             descr_C,
+                                                             csr_row_ptr_C,
+                                                             nnz_C,
+                                                             temp_buffer));
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
+
+#define C_IMPL(NAME, TYPE)                                                     \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,         \
+                                     rocsparse_int             m,              \
+                                     rocsparse_int             n,              \
+                                     rocsparse_int             k,              \
+                                     const rocsparse_mat_descr descr_R,        \
+                                     rocsparse_int             nnz_R,          \
+                                     const TYPE*               csr_val_R,      \
+                                     const rocsparse_int*      csr_row_ptr_R,  \
+                                     const rocsparse_int*      csr_col_ind_R,  \
+                                     const rocsparse_mat_descr descr_A,        \
+                                     rocsparse_int             nnz_A,          \
+                                     const TYPE*               csr_val_A,      \
+                                     const rocsparse_int*      csr_row_ptr_A,  \
+                                     const rocsparse_int*      csr_col_ind_A,  \
+                                     const rocsparse_mat_descr descr_P,        \
+                                     rocsparse_int             nnz_P,          \
+                                     const TYPE*               csr_val_P,      \
+                                     const rocsparse_int*      csr_row_ptr_P,  \
+                                     const rocsparse_int*      csr_col_ind_P,  \
+                                     const rocsparse_mat_descr descr_C,        \
+                                     TYPE*                     csr_val_C,      \
+                                     const rocsparse_int*      csr_row_ptr_C,  \
+                                     rocsparse_int*            csr_col_ind_C)  \
+    try                                                                        \
+    {                                                                          \
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::csrrap_template(handle,           \
+                                                             m,                \
+                                                             n,                \
+                                                             k,                \
+                                                             descr_R,          \
+                                                             nnz_R,            \
+                                                             csr_val_R,        \
+                                                             csr_row_ptr_R,    \
+                                                             csr_col_ind_R,    \
+                                                             descr_A,          \
+                                                             nnz_A,            \
+                                                             csr_val_A,        \
+                                                             csr_row_ptr_A,    \
+                                                             csr_col_ind_A,    \
+                                                             descr_P,          \
+                                                             nnz_P,            \
+                                                             csr_val_P,        \
+                                                             csr_row_ptr_P,    \
+                                                             csr_col_ind_P,    \
+                                                             descr_C,          \
+                                                             csr_val_C,        \
+                                                             csr_row_ptr_C,    \
+                                                             csr_col_ind_C));  \
+        return rocsparse_status_success;                                       \
+    }                                                                          \
+    catch(...)                                                                 \
+    {                                                                          \
+        RETURN_ROCSPARSE_EXCEPTION();                                          \
+    }
+
+C_IMPL(rocsparse_scsrrap, float);
+C_IMPL(rocsparse_dcsrrap, double);
+C_IMPL(rocsparse_ccsrrap, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrrap, rocsparse_double_complex);
+
+#undef C_IMPL
@@ -0,0 +1,96 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.h"
+
+namespace rocsparse
+{
+    template <typename I, typename J>
+    rocsparse_status csrrap_buffer_size_template(rocsparse_handle          handle,
+                                                 J                         m,
+                                                 J                         n,
+                                                 J                         k,
+                                                 const rocsparse_mat_descr descr_R,
+                                                 I                         nnz_R,
+                                                 const I*                  csr_row_ptr_R,
+                                                 const J*                  csr_col_ind_R,
+                                                 const rocsparse_mat_descr descr_A,
+                                                 I                         nnz_A,
+                                                 const I*                  csr_row_ptr_A,
+                                                 const J*                  csr_col_ind_A,
+                                                 const rocsparse_mat_descr descr_P,
+                                                 I                         nnz_P,
+                                                 const I*                  csr_row_ptr_P,
+                                                 const J*                  csr_col_ind_P,
+                                                 size_t*                   buffer_size);
+
+    template <typename I, typename J>
+    rocsparse_status csrrap_nnz_template(rocsparse_handle          handle,
+                                         J                         m,
+                                         J                         n,
+                                         J                         k,
+                                         const rocsparse_mat_descr descr_R,
+                                         I                         nnz_R,
+                                         const I*                  csr_row_ptr_R,
+                                         const J*                  csr_col_ind_R,
+                                         const rocsparse_mat_descr descr_A,
+                                         I                         nnz_A,
+                                         const I*                  csr_row_ptr_A,
+                                         const J*                  csr_col_ind_A,
+                                         const rocsparse_mat_descr descr_P,
+                                         I                         nnz_P,
+                                         const I*                  csr_row_ptr_P,
+                                         const J*                  csr_col_ind_P,
+                                         const rocsparse_mat_descr descr_C,
+                                         I*                        csr_row_ptr_C,
+                                         I*                        nnz_C,
+                                         void*                     temp_buffer);
+
+    template <typename I, typename J, typename T>
+    rocsparse_status csrrap_template(rocsparse_handle          handle,
+                                     J                         m,
+                                     J                         n,
+                                     J                         k,
+                                     const rocsparse_mat_descr descr_R,
+                                     I                         nnz_R,
+                                     const T*                  csr_val_R,
+                                     const I*                  csr_row_ptr_R,
+                                     const J*                  csr_col_ind_R,
+                                     const rocsparse_mat_descr descr_A,
+                                     I                         nnz_A,
+                                     const T*                  csr_val_A,
+                                     const I*                  csr_row_ptr_A,
+                                     const J*                  csr_col_ind_A,
+                                     const rocsparse_mat_descr descr_P,
+                                     I                         nnz_P,
+                                     const T*                  csr_val_P,
+                                     const I*                  csr_row_ptr_P,
+                                     const J*                  csr_col_ind_P,
+                                     const rocsparse_mat_descr descr_C,
+                                     T*                        csr_val_C,
+                                     const I*                  csr_row_ptr_C,
+                                     J*                        csr_col_ind_C);
+}
@@ -0,0 +1,787 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "control.h"
+#include "internal/generic/rocsparse_spgeam.h"
+#include "utility.h"
+
+#include "spgeam_device.h"
+#include <rocprim/rocprim.hpp>
+
+#define SPGEAM_DIM 256
+
+namespace rocsparse
+{
+    template <unsigned int BLOCKSIZE,
+              unsigned int WFSIZE,
+              typename I,
+              typename J,
+              typename T,
+              typename U>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void spgeam_numeric_kernel(J m,
+                               I bs2,
+                               U alpha_device_host,
+                               const I* __restrict__ ptr_A,
+                               const J* __restrict__ ind_A,
+                               const T* __restrict__ val_A,
+                               U beta_device_host,
+                               const I* __restrict__ ptr_B,
+                               const J* __restrict__ ind_B,
+                               const T* __restrict__ val_B,
+                               const I* __restrict__ ptr_C,
+                               const J* __restrict__ ind_C,
+                               T* __restrict__ val_C,
+                               rocsparse_index_base idx_base_A,
+                               rocsparse_index_base idx_base_B,
+                               rocsparse_index_base idx_base_C)
+    {
+        auto alpha = rocsparse::load_scalar_device_host(alpha_device_host);
+        auto beta  = rocsparse::load_scalar_device_host(beta_device_host);
+        rocsparse::spgeam_numeric_device<BLOCKSIZE, WFSIZE>(m,
+                                                            bs2,
+                                                            alpha,
+                                                            ptr_A,
+                                                            ind_A,
+                                                            val_A,
+                                                            beta,
+                                                            ptr_B,
+                                                            ind_B,
+                                                            val_B,
+                                                            ptr_C,
+                                                            ind_C,
+                                                            val_C,
+                                                            idx_base_A,
+                                                            idx_base_B,
+                                                            idx_base_C);
+    }
+
+    // The compressed dimension of the matrix, i.e. rows for CSR / BSR and columns for CSC,
+    // together with the corresponding pointer and index arrays. This allows all supported
+    // formats to share the CSR kernels.
+    template <typename I, typename J>
+    struct spgeam_compressed
+    {
+        J        m;
+        J        n;
+        const I* ptr;
+        const J* ind;
+    };
+
+    template <typename I, typename J>
+    static spgeam_compressed<I, J> spgeam_get_compressed(rocsparse_const_spmat_descr mat)
+    {
+        const bool csc = (mat->format == rocsparse_format_csc);
+
+        spgeam_compressed<I, J> c;
+        c.m   = (J)(csc ? mat->cols : mat->rows);
+        c.n   = (J)(csc ? mat->rows : mat->cols);
+        c.ptr = (const I*)(csc ? mat->const_col_data : mat->const_row_data);
+        c.ind = (const J*)(csc ? mat->const_row_data : mat->const_col_data);
+
+        return c;
+    }
+
+    template <typename I>
+    static rocsparse_status
+        spgeam_buffer_size_core(rocsparse_handle handle, int64_t m, size_t* buffer_size)
+    {
+        // Temporary storage for the exclusive scan of the row pointers of C
+        size_t rocprim_size;
+        I*     ptr = nullptr;
+        RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
+                                                    rocprim_size,
+                                                    ptr,
+                                                    ptr,
+                                                    static_cast<I>(0),
+                                                    m + 1,
+                                                    rocprim::plus<I>(),
+                                                    handle->stream));
+
+        *buffer_size = ((rocprim_size - 1) / 256 + 1) * 256;
+
+        return rocsparse_status_success;
+    }
+
+    template <typename I, typename J>
+    static rocsparse_status spgeam_nnz_core(rocsparse_handle            handle,
+                                            rocsparse_const_spmat_descr A,
+                                            rocsparse_const_spmat_descr B,
+                                            rocsparse_spmat_descr       C,
+                                            void*                       temp_buffer)
+    {
+        const spgeam_compressed<I, J> cA = rocsparse::spgeam_get_compressed<I, J>(A);
+        const spgeam_compressed<I, J> cB = rocsparse::spgeam_get_compressed<I, J>(B);
+
+        const bool csc   = (C->format == rocsparse_format_csc);
+        I*         ptr_C = (I*)(csc ? C->col_data : C->row_data);
+
+        const J m = cA.m;
+        const J n = cA.n;
+
+        hipStream_t stream = handle->stream;
+
+        // Quick return, C does not have any non-zero entries
+        if(m == 0 || n == 0 || (A->nnz == 0 && B->nnz == 0))
+        {
+            if(ptr_C != nullptr)
+            {
+                RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::set_array_to_value<256>),
+                                                   dim3(m / 256 + 1),
+                                                   dim3(256),
+                                                   0,
+                                                   stream,
+                                                   m + 1,
+                                                   ptr_C,
+                                                   static_cast<I>(C->idx_base));
+            }
+
+            C->nnz = 0;
+
+            return rocsparse_status_success;
+        }
+
+        // The number of non-zeros of C is read back on the host
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
+        // Number of non-zero entries per row of C
+        if(handle->wavefront_size == 32)
+        {
+            RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+                (rocsparse::spgeam_nnz_multipass<SPGEAM_DIM, 32>),
+                dim3((m - 1) / (SPGEAM_DIM / 32) + 1),
+                dim3(SPGEAM_DIM),
+                0,
+                stream,
+                m,
+                n,
+                cA.ptr,
+                cA.ind,
+                cB.ptr,
+                cB.ind,
+                ptr_C,
+                A->idx_base,
+                B->idx_base);
+        }
+        else
+        {
+            RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+                (rocsparse::spgeam_nnz_multipass<SPGEAM_DIM, 64>),
+                dim3((m - 1) / (SPGEAM_DIM / 64) + 1),
+                dim3(SPGEAM_DIM),
+                0,
+                stream,
+                m,
+                n,
+                cA.ptr,
+                cA.ind,
+                cB.ptr,
+                cB.ind,
+                ptr_C,
+                A->idx_base,
+                B->idx_base);
+        }
+
+        // Exclusive sum to obtain the row pointers of C
+        size_t rocprim_size;
+        RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
+                                                    rocprim_size,
+                                                    ptr_C,
+                                                    ptr_C,
+                                                    static_cast<I>(C->idx_base),
+                                                    m + 1,
+                                                    rocprim::plus<I>(),
+                                                    stream));
+        RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(temp_buffer,
+                                                    rocprim_size,
+                                                    ptr_C,
+                                                    ptr_C,
+                                                    static_cast<I>(C->idx_base),
+                                                    m + 1,
+                                                    rocprim::plus<I>(),
+                                                    stream));
+
+        // Extract the number of non-zero entries of C
+        I nnz_C;
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(&nnz_C, ptr_C + m, sizeof(I), hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        C->nnz = nnz_C - C->idx_base;
+
+        return rocsparse_status_success;
+    }
+
+    template <typename I, typename J>
+    static rocsparse_status spgeam_symbolic_core(rocsparse_handle            handle,
+                                                 rocsparse_const_spmat_descr A,
+                                                 rocsparse_const_spmat_descr B,
+                                                 rocsparse_spmat_descr       C)
+    {
+        const spgeam_compressed<I, J> cA = rocsparse::spgeam_get_compressed<I, J>(A);
+        const spgeam_compressed<I, J> cB = rocsparse::spgeam_get_compressed<I, J>(B);
+
+        const bool csc   = (C->format == rocsparse_format_csc);
+        const I*   ptr_C = (const I*)(csc ? C->const_col_data : C->const_row_data);
+        J*         ind_C = (J*)(csc ? C->row_data : C->col_data);
+
+        const J m = cA.m;
+        const J n = cA.n;
+
+        // Quick return
+        if(m == 0 || n == 0 || C->nnz == 0)
+        {
+            return rocsparse_status_success;
+        }
+
+        if(handle->wavefront_size == 32)
+        {
+            RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+                (rocsparse::spgeam_symbolic_multipass<SPGEAM_DIM, 32>),
+                dim3((m - 1) / (SPGEAM_DIM / 32) + 1),
+                dim3(SPGEAM_DIM),
+                0,
+                handle->stream,
+                m,
+                n,
+                cA.ptr,
+                cA.ind,
+                cB.ptr,
+                cB.ind,
+                ptr_C,
+                ind_C,
+                A->idx_base,
+                B->idx_base,
+                C->idx_base);
+        }
+        else
+        {
+            RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+                (rocsparse::spgeam_symbolic_multipass<SPGEAM_DIM, 64>),
+                dim3((m - 1) / (SPGEAM_DIM / 64) + 1),
+                dim3(SPGEAM_DIM),
+                0,
+                handle->stream,
+                m,
+                n,
+                cA.ptr,
+                cA.ind,
+                cB.ptr,
+                cB.ind,
+                ptr_C,
+                ind_C,
+                A->idx_base,
+                B->idx_base,
+                C->idx_base);
+        }
+
+        return rocsparse_status_success;
+    }
+
+    template <unsigned int WFSIZE, typename I, typename J, typename T, typename U>
+    static rocsparse_status spgeam_numeric_launch(rocsparse_handle              handle,
+                                                  const spgeam_compressed<I, J>& cA,
+                                                  const spgeam_compressed<I, J>& cB,
+                                                  I                             bs2,
+                                                  U                             alpha,
+                                                  const T*                      val_A,
+                                                  U                             beta,
+                                                  const T*                      val_B,
+                                                  const I*                      ptr_C,
+                                                  const J*                      ind_C,
+                                                  T*                            val_C,
+                                                  rocsparse_index_base          idx_base_A,
+                                                  rocsparse_index_base          idx_base_B,
+                                                  rocsparse_index_base          idx_base_C)
+    {
+        RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+            (rocsparse::spgeam_numeric_kernel<SPGEAM_DIM, WFSIZE>),
+            dim3((cA.m - 1) / (SPGEAM_DIM / WFSIZE) + 1),
+            dim3(SPGEAM_DIM),
+            0,
+            handle->stream,
+            cA.m,
+            bs2,
+            alpha,
+            cA.ptr,
+            cA.ind,
+            val_A,
+            beta,
+            cB.ptr,
+            cB.ind,
+            val_B,
+            ptr_C,
+            ind_C,
+            val_C,
+            idx_base_A,
+            idx_base_B,
+            idx_base_C);
+
+        return rocsparse_status_success;
+    }
+
+    template <typename I, typename J, typename T, typename U>
+    static rocsparse_status spgeam_numeric_dispatch(rocsparse_handle              handle,
+                                                    const spgeam_compressed<I, J>& cA,
+                                                    const spgeam_compressed<I, J>& cB,
+                                                    I                             bs2,
+                                                    U                             alpha,
+                                                    const T*                      val_A,
+                                                    U                             beta,
+                                                    const T*                      val_B,
+                                                    const I*                      ptr_C,
+                                                    const J*                      ind_C,
+                                                    T*                            val_C,
+                                                    rocsparse_index_base          idx_base_A,
+                                                    rocsparse_index_base          idx_base_B,
+                                                    rocsparse_index_base          idx_base_C)
+    {
+        if(handle->wavefront_size == 32)
+        {
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse::spgeam_numeric_launch<32>(handle,
+                                                                            cA,
+                                                                            cB,
+                                                                            bs2,
+                                                                            alpha,
+                                                                            val_A,
+                                                                            beta,
+                                                                            val_B,
+                                                                            ptr_C,
+                                                                            ind_C,
+                                                                            val_C,
+                                                                            idx_base_A,
+                                                                            idx_base_B,
+                                                                            idx_base_C)));
+        }
+        else
+        {
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse::spgeam_numeric_launch<64>(handle,
+                                                                            cA,
+                                                                            cB,
+                                                                            bs2,
+                                                                            alpha,
+                                                                            val_A,
+                                                                            beta,
+                                                                            val_B,
+                                                                            ptr_C,
+                                                                            ind_C,
+                                                                            val_C,
+                                                                            idx_base_A,
+                                                                            idx_base_B,
+                                                                            idx_base_C)));
+        }
+
+        return rocsparse_status_success;
+    }
+
+    template <typename I, typename J, typename T>
+    static rocsparse_status spgeam_numeric_core(rocsparse_handle            handle,
+                                                const void*                 alpha,
+                                                rocsparse_const_spmat_descr A,
+                                                const void*                 beta,
+                                                rocsparse_const_spmat_descr B,
+                                                rocsparse_spmat_descr       C)
+    {
+        const spgeam_compressed<I, J> cA = rocsparse::spgeam_get_compressed<I, J>(A);
+        const spgeam_compressed<I, J> cB = rocsparse::spgeam_get_compressed<I, J>(B);
+
+        const bool csc   = (C->format == rocsparse_format_csc);
+        const I*   ptr_C = (const I*)(csc ? C->const_col_data : C->const_row_data);
+        const J*   ind_C = (const J*)(csc ? C->const_row_data : C->const_col_data);
+
+        // Each non-zero entry of a BSR matrix is a dense block
+        const I bs2 = (C->format == rocsparse_format_bsr) ? (I)(C->block_dim * C->block_dim) : 1;
+
+        // Quick return
+        if(cA.m == 0 || cA.n == 0 || C->nnz == 0)
+        {
+            return rocsparse_status_success;
+        }
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(
+                rocsparse::spgeam_numeric_dispatch(handle,
+                                                   cA,
+                                                   cB,
+                                                   bs2,
+                                                   (const T*)alpha,
+                                                   (const T*)A->const_val_data,
+                                                   (const T*)beta,
+                                                   (const T*)B->const_val_data,
+                                                   ptr_C,
+                                                   ind_C,
+                                                   (T*)C->val_data,
+                                                   A->idx_base,
+                                                   B->idx_base,
+                                                   C->idx_base));
+        }
+        else
+        {
+            RETURN_IF_ROCSPARSE_ERROR(
+                rocsparse::spgeam_numeric_dispatch(handle,
+                                                   cA,
+                                                   cB,
+                                                   bs2,
+                                                   *(const T*)alpha,
+                                                   (const T*)A->const_val_data,
+                                                   *(const T*)beta,
+                                                   (const T*)B->const_val_data,
+                                                   ptr_C,
+                                                   ind_C,
+                                                   (T*)C->val_data,
+                                                   A->idx_base,
+                                                   B->idx_base,
+                                                   C->idx_base));
+        }
+
+        return rocsparse_status_success;
+    }
+
+    template <typename I, typename J, typename T>
+    static rocsparse_status spgeam_template(rocsparse_handle            handle,
+                                            rocsparse_operation         trans_A,
+                                            rocsparse_operation         trans_B,
+                                            const void*                 alpha,
+                                            rocsparse_const_spmat_descr A,
+                                            const void*                 beta,
+                                            rocsparse_const_spmat_descr B,
+                                            rocsparse_spmat_descr       C,
+                                            rocsparse_spgeam_alg        alg,
+                                            rocsparse_spgeam_stage      stage,
+                                            size_t*                     buffer_size,
+                                            void*                       temp_buffer)
+    {
+        if(trans_A != rocsparse_operation_none || trans_B != rocsparse_operation_none)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_not_implemented);
+        }
+
+        switch(stage)
+        {
+        case rocsparse_spgeam_stage_buffer_size:
+        {
+            const int64_t m = (A->format == rocsparse_format_csc) ? A->cols : A->rows;
+            RETURN_IF_ROCSPARSE_ERROR(
+                rocsparse::spgeam_buffer_size_core<I>(handle, m, buffer_size));
+            return rocsparse_status_success;
+        }
+
+        case rocsparse_spgeam_stage_nnz:
+        {
+            RETURN_IF_ROCSPARSE_ERROR(
+                (rocsparse::spgeam_nnz_core<I, J>(handle, A, B, C, temp_buffer)));
+            return rocsparse_status_success;
+        }
+
+        case rocsparse_spgeam_stage_compute:
+        {
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse::spgeam_symbolic_core<I, J>(handle, A, B, C)));
+            RETURN_IF_ROCSPARSE_ERROR(
+                (rocsparse::spgeam_numeric_core<I, J, T>(handle, alpha, A, beta, B, C)));
+            return rocsparse_status_success;
+        }
+
+        case rocsparse_spgeam_stage_symbolic:
+        {
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse::spgeam_symbolic_core<I, J>(handle, A, B, C)));
+            return rocsparse_status_success;
+        }
+
+        case rocsparse_spgeam_stage_numeric:
+        {
+            RETURN_IF_ROCSPARSE_ERROR(
+                (rocsparse::spgeam_numeric_core<I, J, T>(handle, alpha, A, beta, B, C)));
+            return rocsparse_status_success;
+        }
+        }
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_invalid_value);
+    }
+
+    template <typename... Ts>
+    static rocsparse_status spgeam_template_dispatch(rocsparse_indextype itype,
+                                                     rocsparse_indextype jtype,
+                                                     rocsparse_datatype  ctype,
+                                                     Ts&&... params)
+    {
+#define DISPATCH_COMPUTE_TYPE(ITYPE, JTYPE)                                                      \
+    switch(ctype)                                                                                \
+    {                                                                                            \
+    case rocsparse_datatype_f32_r:                                                               \
+    {                                                                                            \
+        RETURN_IF_ROCSPARSE_ERROR((rocsparse::spgeam_template<ITYPE, JTYPE, float>(params...))); \
+        return rocsparse_status_success;                                                         \
+    }                                                                                            \
+    case rocsparse_datatype_f64_r:                                                               \
+    {                                                                                            \
+        RETURN_IF_ROCSPARSE_ERROR(                                                               \
+            (rocsparse::spgeam_template<ITYPE, JTYPE, double>(params...)));                      \
+        return rocsparse_status_success;                                                         \
+    }                                                                                            \
+    case rocsparse_datatype_f32_c:                                                               \
+    {                                                                                            \
+        RETURN_IF_ROCSPARSE_ERROR(                                                               \
+            (rocsparse::spgeam_template<ITYPE, JTYPE, rocsparse_float_complex>(params...)));     \
+        return rocsparse_status_success;                                                         \
+    }                                                                                            \
+    case rocsparse_datatype_f64_c:                                                               \
+    {                                                                                            \
+        RETURN_IF_ROCSPARSE_ERROR(                                                               \
+            (rocsparse::spgeam_template<ITYPE, JTYPE, rocsparse_double_complex>(params...)));    \
+        return rocsparse_status_success;                                                         \
+    }                                                                                            \
+    case rocsparse_datatype_i8_r:                                                                \
+    case rocsparse_datatype_u8_r:                                                                \
+    case rocsparse_datatype_i32_r:                                                               \
+    case rocsparse_datatype_u32_r:                                                               \
+    {                                                                                            \
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_not_implemented);                             \
+    }                                                                                            \
+    }
+
+        switch(itype)
+        {
+        case rocsparse_indextype_u16:
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_not_implemented);
+        }
+        case rocsparse_indextype_i32:
+        {
+            switch(jtype)
+            {
+            case rocsparse_indextype_i64:
+            case rocsparse_indextype_u16:
+            {
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_not_implemented);
+            }
+            case rocsparse_indextype_i32:
+            {
+                DISPATCH_COMPUTE_TYPE(int32_t, int32_t);
+            }
+            }
+        }
+        case rocsparse_indextype_i64:
+        {
+            switch(jtype)
+            {
+            case rocsparse_indextype_u16:
+            {
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_not_implemented);
+            }
+            case rocsparse_indextype_i32:
+            {
+                DISPATCH_COMPUTE_TYPE(int64_t, int32_t);
+            }
+            case rocsparse_indextype_i64:
+            {
+                DISPATCH_COMPUTE_TYPE(int64_t, int64_t);
+            }
+            }
+        }
+        }
+#undef DISPATCH_COMPUTE_TYPE
+
+        return rocsparse_status_invalid_value;
+    }
+
+    static rocsparse_status spgeam_checkarg(rocsparse_handle            handle, //0
+                                            rocsparse_operation         trans_A, //1
+                                            rocsparse_operation         trans_B, //2
+                                            const void*                 alpha, //3
+                                            rocsparse_const_spmat_descr A, //4
+                                            const void*                 beta, //5
+                                            rocsparse_const_spmat_descr B, //6
+                                            rocsparse_spmat_descr       C, //7
+                                            rocsparse_datatype          compute_type, //8
+                                            rocsparse_spgeam_alg        alg, //9
+                                            rocsparse_spgeam_stage      stage, //10
+                                            size_t*                     buffer_size, //11
+                                            void*                       temp_buffer) //12
+    {
+        ROCSPARSE_CHECKARG_HANDLE(0, handle);
+        ROCSPARSE_CHECKARG_ENUM(1, trans_A);
+        ROCSPARSE_CHECKARG_ENUM(2, trans_B);
+        ROCSPARSE_CHECKARG_POINTER(4, A);
+        ROCSPARSE_CHECKARG_POINTER(6, B);
+        ROCSPARSE_CHECKARG_POINTER(7, C);
+        ROCSPARSE_CHECKARG_ENUM(8, compute_type);
+        ROCSPARSE_CHECKARG_ENUM(9, alg);
+        ROCSPARSE_CHECKARG_ENUM(10, stage);
+
+        switch(stage)
+        {
+        case rocsparse_spgeam_stage_buffer_size:
+        {
+            ROCSPARSE_CHECKARG_POINTER(11, buffer_size);
+            break;
+        }
+        case rocsparse_spgeam_stage_nnz:
+        {
+            ROCSPARSE_CHECKARG_POINTER(12, temp_buffer);
+            break;
+        }
+        case rocsparse_spgeam_stage_compute:
+        case rocsparse_spgeam_stage_numeric:
+        {
+            ROCSPARSE_CHECKARG_POINTER(3, alpha);
+            ROCSPARSE_CHECKARG_POINTER(5, beta);
+            break;
+        }
+        case rocsparse_spgeam_stage_symbolic:
+        {
+            break;
+        }
+        }
+
+        ROCSPARSE_CHECKARG(4, A, (A->init == false), rocsparse_status_not_initialized);
+        ROCSPARSE_CHECKARG(6, B, (B->init == false), rocsparse_status_not_initialized);
+        ROCSPARSE_CHECKARG(7, C, (C->init == false), rocsparse_status_not_initialized);
+
+        ROCSPARSE_CHECKARG(4,
+                           A,
+                           (A->format != rocsparse_format_csr && A->format != rocsparse_format_csc
+                            && A->format != rocsparse_format_bsr),
+                           rocsparse_status_not_implemented);
+        ROCSPARSE_CHECKARG(6, B, (B->format != A->format), rocsparse_status_not_implemented);
+        ROCSPARSE_CHECKARG(7, C, (C->format != A->format), rocsparse_status_not_implemented);
+
+        ROCSPARSE_CHECKARG(4, A, (A->data_type != compute_type), rocsparse_status_not_implemented);
+        ROCSPARSE_CHECKARG(6, B, (B->data_type != compute_type), rocsparse_status_not_implemented);
+        ROCSPARSE_CHECKARG(7, C, (C->data_type != compute_type), rocsparse_status_not_implemented);
+
+        ROCSPARSE_CHECKARG(6, B, (B->row_type != A->row_type), rocsparse_status_type_mismatch);
+        ROCSPARSE_CHECKARG(7, C, (C->row_type != A->row_type), rocsparse_status_type_mismatch);
+        ROCSPARSE_CHECKARG(6, B, (B->col_type != A->col_type), rocsparse_status_type_mismatch);
+        ROCSPARSE_CHECKARG(7, C, (C->col_type != A->col_type), rocsparse_status_type_mismatch);
+
+        ROCSPARSE_CHECKARG(6, B, (B->rows != A->rows), rocsparse_status_invalid_size);
+        ROCSPARSE_CHECKARG(6, B, (B->cols != A->cols), rocsparse_status_invalid_size);
+        ROCSPARSE_CHECKARG(7, C, (C->rows != A->rows), rocsparse_status_invalid_size);
+        ROCSPARSE_CHECKARG(7, C, (C->cols != A->cols), rocsparse_status_invalid_size);
+
+        if(A->format == rocsparse_format_bsr)
+        {
+            ROCSPARSE_CHECKARG(
+                6, B, (B->block_dim != A->block_dim), rocsparse_status_not_implemented);
+            ROCSPARSE_CHECKARG(
+                7, C, (C->block_dim != A->block_dim), rocsparse_status_not_implemented);
+            ROCSPARSE_CHECKARG(
+                6, B, (B->block_dir != A->block_dir), rocsparse_status_not_implemented);
+            ROCSPARSE_CHECKARG(
+                7, C, (C->block_dir != A->block_dir), rocsparse_status_not_implemented);
+        }
+
+        ROCSPARSE_CHECKARG(4,
+                           A,
+                           (A->descr->storage_mode != rocsparse_storage_mode_sorted),
+                           rocsparse_status_requires_sorted_storage);
+        ROCSPARSE_CHECKARG(6,
+                           B,
+                           (B->descr->storage_mode != rocsparse_storage_mode_sorted),
+                           rocsparse_status_requires_sorted_storage);
+
+        return rocsparse_status_continue;
+    }
+}
+
+extern "C" rocsparse_status rocsparse_spgeam(rocsparse_handle            handle,
+                                             rocsparse_operation         trans_A,
+                                             rocsparse_operation         trans_B,
+                                             const void*                 alpha,
+                                             rocsparse_const_spmat_descr A,
+                                             const void*                 beta,
+                                             rocsparse_const_spmat_descr B,
+                                             rocsparse_spmat_descr       C,
+                                             rocsparse_datatype          compute_type,
+                                             rocsparse_spgeam_alg        alg,
+                                             rocsparse_spgeam_stage      stage,
+                                             size_t*                     buffer_size,
+                                             void*                       temp_buffer)
+try
+{
+    // Profiling
+    rocsparse::trace_scope trace(handle);
+
+    rocsparse::log_trace("rocsparse_spgeam",
+                         handle,
+                         trans_A,
+                         trans_B,
+                         alpha,
+                         A,
+                         beta,
+                         B,
+                         C,
+                         compute_type,
+                         alg,
+                         stage,
+                         buffer_size,
+                         temp_buffer);
+
+    const rocsparse_status status = rocsparse::spgeam_checkarg(handle,
+                                                               trans_A,
+                                                               trans_B,
+                                                               alpha,
+                                                               A,
+                                                               beta,
+                                                               B,
+                                                               C,
+                                                               compute_type,
+                                                               alg,
+                                                               stage,
+                                                               buffer_size,
+                                                               temp_buffer);
+    if(status != rocsparse_status_continue)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(status);
+        return rocsparse_status_success;
+    }
+
+    // For CSC matrices, the compressed dimension is given by the columns
+    const bool                csc   = (A->format == rocsparse_format_csc);
+    const rocsparse_indextype itype = csc ? A->col_type : A->row_type;
+    const rocsparse_indextype jtype = csc ? A->row_type : A->col_type;
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::spgeam_template_dispatch(itype,
+                                                                  jtype,
+                                                                  compute_type,
+                                                                  handle,
+                                                                  trans_A,
+                                                                  trans_B,
+                                                                  alpha,
+                                                                  A,
+                                                                  beta,
+                                                                  B,
+                                                                  C,
+                                                                  alg,
+                                                                  stage,
+                                                                  buffer_size,
+                                                                  temp_buffer));
+
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
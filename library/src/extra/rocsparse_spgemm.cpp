@@ -648,6 +648,9 @@ extern "C" rocsparse_status rocsparse_spgemm(rocsparse_handle            handle,
                                              void*                       temp_buffer)
 try
 {
+    // Profiling
+    rocsparse::trace_scope trace(handle);
+
 
     rocsparse::log_trace("rocsparse_spgemm",
                          handle,
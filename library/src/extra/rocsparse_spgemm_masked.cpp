@@ -0,0 +1,471 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "control.h"
+#include "internal/generic/rocsparse_spgemm.h"
+#include "utility.h"
+
+#include "rocsparse_csrgemm_masked.hpp"
+
+namespace rocsparse
+{
+    template <typename I, typename J, typename T>
+    static rocsparse_status spgemm_masked_template(rocsparse_handle            handle,
+                                                   rocsparse_operation         trans_A,
+                                                   rocsparse_operation         trans_B,
+                                                   const void*                 alpha,
+                                                   rocsparse_const_spmat_descr A,
+                                                   rocsparse_const_spmat_descr B,
+                                                   rocsparse_const_spmat_descr M,
+                                                   rocsparse_spgemm_mask       mask,
+                                                   rocsparse_spmat_descr       C,
+                                                   rocsparse_spgemm_alg        alg,
+                                                   rocsparse_spgemm_stage      stage,
+                                                   size_t*                     buffer_size,
+                                                   void*                       temp_buffer)
+    {
+        if(A->format != rocsparse_format_csr)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_not_implemented);
+        }
+
+        switch(stage)
+        {
+        case rocsparse_spgemm_stage_buffer_size:
+        {
+            RETURN_IF_ROCSPARSE_ERROR(
+                (rocsparse::csrgemm_masked_buffer_size_template<I, J, T>(
+                    handle,
+                    trans_A,
+                    trans_B,
+                    (J)A->rows,
+                    (J)B->cols,
+                    (J)A->cols,
+                    A->descr,
+                    (I)A->nnz,
+                    (const I*)A->const_row_data,
+                    (const J*)A->const_col_data,
+                    B->descr,
+                    (I)B->nnz,
+                    (const I*)B->const_row_data,
+                    (const J*)B->const_col_data,
+                    M->descr,
+                    (I)M->nnz,
+                    (const I*)M->const_row_data,
+                    (const J*)M->const_col_data,
+                    buffer_size)));
+            return rocsparse_status_success;
+        }
+
+        case rocsparse_spgemm_stage_nnz:
+        {
+            // non-zeros of C need to be on host
+            I nnz_C;
+            RETURN_IF_ROCSPARSE_ERROR(
+                (rocsparse::csrgemm_masked_nnz_template<I, J, T>(handle,
+                                                                 trans_A,
+                                                                 trans_B,
+                                                                 mask,
+                                                                 (J)A->rows,
+                                                                 (J)B->cols,
+                                                                 (J)A->cols,
+                                                                 A->descr,
+                                                                 (I)A->nnz,
+                                                                 (const I*)A->const_row_data,
+                                                                 (const J*)A->const_col_data,
+                                                                 B->descr,
+                                                                 (I)B->nnz,
+                                                                 (const I*)B->const_row_data,
+                                                                 (const J*)B->const_col_data,
+                                                                 M->descr,
+                                                                 (I)M->nnz,
+                                                                 (const I*)M->const_row_data,
+                                                                 (const J*)M->const_col_data,
+                                                                 C->descr,
+                                                                 (I*)C->row_data,
+                                                                 &nnz_C,
+                                                                 temp_buffer)));
+            C->nnz = nnz_C;
+            return rocsparse_status_success;
+        }
+
+        case rocsparse_spgemm_stage_compute:
+        {
+            RETURN_IF_ROCSPARSE_ERROR(
+                rocsparse::csrgemm_masked_template(handle,
+                                                   trans_A,
+                                                   trans_B,
+                                                   mask,
+                                                   (J)A->rows,
+                                                   (J)B->cols,
+                                                   (J)A->cols,
+                                                   (const T*)alpha,
+                                                   A->descr,
+                                                   (I)A->nnz,
+                                                   (const T*)A->const_val_data,
+                                                   (const I*)A->const_row_data,
+                                                   (const J*)A->const_col_data,
+                                                   B->descr,
+                                                   (I)B->nnz,
+                                                   (const T*)B->const_val_data,
+                                                   (const I*)B->const_row_data,
+                                                   (const J*)B->const_col_data,
+                                                   M->descr,
+                                                   (I)M->nnz,
+                                                   (const I*)M->const_row_data,
+                                                   (const J*)M->const_col_data,
+                                                   C->descr,
+                                                   (I)C->nnz,
+                                                   (T*)C->val_data,
+                                                   (const I*)C->const_row_data,
+                                                   (J*)C->col_data,
+                                                   temp_buffer));
+            return rocsparse_status_success;
+        }
+
+        case rocsparse_spgemm_stage_symbolic:
+        case rocsparse_spgemm_stage_numeric:
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_not_implemented);
+        }
+        }
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_not_implemented);
+    }
+
+    template <typename... Ts>
+    static rocsparse_status spgemm_masked_template_dispatch(rocsparse_indextype itype,
+                                                            rocsparse_indextype jtype,
+                                                            rocsparse_datatype  ctype,
+                                                            Ts&&... params)
+    {
+
+        switch(itype)
+        {
+        case rocsparse_indextype_u16:
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_not_implemented);
+        }
+        case rocsparse_indextype_i32:
+        {
+            switch(jtype)
+            {
+            case rocsparse_indextype_i64:
+            case rocsparse_indextype_u16:
+            {
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_not_implemented);
+            }
+            case rocsparse_indextype_i32:
+            {
+                switch(ctype)
+                {
+                case rocsparse_datatype_f32_r:
+                {
+                    RETURN_IF_ROCSPARSE_ERROR(
+                        (rocsparse::spgemm_masked_template<int32_t, int32_t, float>(params...)));
+                    return rocsparse_status_success;
+                }
+                case rocsparse_datatype_f64_r:
+                {
+                    RETURN_IF_ROCSPARSE_ERROR(
+                        (rocsparse::spgemm_masked_template<int32_t, int32_t, double>(params...)));
+                    return rocsparse_status_success;
+                }
+                case rocsparse_datatype_f32_c:
+                {
+                    RETURN_IF_ROCSPARSE_ERROR(
+                        (rocsparse::spgemm_masked_template<int32_t,
+                                                           int32_t,
+                                                           rocsparse_float_complex>(params...)));
+                    return rocsparse_status_success;
+                }
+                case rocsparse_datatype_f64_c:
+                {
+                    RETURN_IF_ROCSPARSE_ERROR(
+                        (rocsparse::spgemm_masked_template<int32_t,
+                                                           int32_t,
+                                                           rocsparse_double_complex>(params...)));
+                    return rocsparse_status_success;
+                }
+                case rocsparse_datatype_i8_r:
+                case rocsparse_datatype_u8_r:
+                case rocsparse_datatype_i32_r:
+                case rocsparse_datatype_u32_r:
+                {
+                    RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_not_implemented);
+                }
+                }
+            }
+            }
+        }
+        case rocsparse_indextype_i64:
+        {
+            switch(jtype)
+            {
+            case rocsparse_indextype_u16:
+            {
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_not_implemented);
+            }
+            case rocsparse_indextype_i32:
+            {
+                switch(ctype)
+                {
+                case rocsparse_datatype_f32_r:
+                {
+                    RETURN_IF_ROCSPARSE_ERROR(
+                        (rocsparse::spgemm_masked_template<int64_t, int32_t, float>(params...)));
+                    return rocsparse_status_success;
+                }
+                case rocsparse_datatype_f64_r:
+                {
+                    RETURN_IF_ROCSPARSE_ERROR(
+                        (rocsparse::spgemm_masked_template<int64_t, int32_t, double>(params...)));
+                    return rocsparse_status_success;
+                }
+                case rocsparse_datatype_f32_c:
+                {
+                    RETURN_IF_ROCSPARSE_ERROR(
+                        (rocsparse::spgemm_masked_template<int64_t,
+                                                           int32_t,
+                                                           rocsparse_float_complex>(params...)));
+                    return rocsparse_status_success;
+                }
+                case rocsparse_datatype_f64_c:
+                {
+                    RETURN_IF_ROCSPARSE_ERROR(
+                        (rocsparse::spgemm_masked_template<int64_t,
+                                                           int32_t,
+                                                           rocsparse_double_complex>(params...)));
+                    return rocsparse_status_success;
+                }
+                case rocsparse_datatype_i8_r:
+                case rocsparse_datatype_u8_r:
+                case rocsparse_datatype_i32_r:
+                case rocsparse_datatype_u32_r:
+                {
+                    RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_not_implemented);
+                }
+                }
+            }
+            case rocsparse_indextype_i64:
+            {
+                switch(ctype)
+                {
+                case rocsparse_datatype_f32_r:
+                {
+                    RETURN_IF_ROCSPARSE_ERROR(
+                        (rocsparse::spgemm_masked_template<int64_t, int64_t, float>(params...)));
+                    return rocsparse_status_success;
+                }
+                case rocsparse_datatype_f64_r:
+                {
+                    RETURN_IF_ROCSPARSE_ERROR(
+                        (rocsparse::spgemm_masked_template<int64_t, int64_t, double>(params...)));
+                    return rocsparse_status_success;
+                }
+                case rocsparse_datatype_f32_c:
+                {
+                    RETURN_IF_ROCSPARSE_ERROR(
+                        (rocsparse::spgemm_masked_template<int64_t,
+                                                           int64_t,
+                                                           rocsparse_float_complex>(params...)));
+                    return rocsparse_status_success;
+                }
+                case rocsparse_datatype_f64_c:
+                {
+                    RETURN_IF_ROCSPARSE_ERROR(
+                        (rocsparse::spgemm_masked_template<int64_t,
+                                                           int64_t,
+                                                           rocsparse_double_complex>(params...)));
+                    return rocsparse_status_success;
+                }
+                case rocsparse_datatype_i8_r:
+                case rocsparse_datatype_u8_r:
+                case rocsparse_datatype_i32_r:
+                case rocsparse_datatype_u32_r:
+                {
+                    RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_not_implemented);
+                }
+                }
+            }
+            }
+        }
+        }
+        return rocsparse_status_invalid_value;
+    }
+
+    static rocsparse_status spgemm_masked_checkarg(rocsparse_handle            handle, //0
+                                                   rocsparse_operation         trans_A, //1
+                                                   rocsparse_operation         trans_B, //2
+                                                   const void*                 alpha, //3
+                                                   rocsparse_const_spmat_descr A, //4
+                                                   rocsparse_const_spmat_descr B, //5
+                                                   rocsparse_const_spmat_descr M, //6
+                                                   rocsparse_spgemm_mask       mask, //7
+                                                   rocsparse_spmat_descr       C, //8
+                                                   rocsparse_datatype          compute_type, //9
+                                                   rocsparse_spgemm_alg        alg, //10
+                                                   rocsparse_spgemm_stage      stage, //11
+                                                   size_t*                     buffer_size, //12
+                                                   void*                       temp_buffer) //13
+    {
+        ROCSPARSE_CHECKARG_HANDLE(0, handle);
+        ROCSPARSE_CHECKARG_ENUM(1, trans_A);
+        ROCSPARSE_CHECKARG_ENUM(2, trans_B);
+
+        ROCSPARSE_CHECKARG_POINTER(4, A);
+        ROCSPARSE_CHECKARG_POINTER(5, B);
+        ROCSPARSE_CHECKARG_POINTER(6, M);
+        ROCSPARSE_CHECKARG_ENUM(7, mask);
+        ROCSPARSE_CHECKARG_POINTER(8, C);
+        ROCSPARSE_CHECKARG_ENUM(9, compute_type);
+        ROCSPARSE_CHECKARG_ENUM(10, alg);
+        ROCSPARSE_CHECKARG_ENUM(11, stage);
+
+        switch(stage)
+        {
+        case rocsparse_spgemm_stage_buffer_size:
+        {
+            ROCSPARSE_CHECKARG_POINTER(12, buffer_size);
+            break;
+        }
+        case rocsparse_spgemm_stage_compute:
+        {
+            ROCSPARSE_CHECKARG_POINTER(3, alpha);
+            break;
+        }
+        case rocsparse_spgemm_stage_nnz:
+        case rocsparse_spgemm_stage_symbolic:
+        case rocsparse_spgemm_stage_numeric:
+        {
+            break;
+        }
+        }
+
+        ROCSPARSE_CHECKARG(4, A, (A->init == false), rocsparse_status_not_initialized);
+        ROCSPARSE_CHECKARG(5, B, (B->init == false), rocsparse_status_not_initialized);
+        ROCSPARSE_CHECKARG(6, M, (M->init == false), rocsparse_status_not_initialized);
+        ROCSPARSE_CHECKARG(8, C, (C->init == false), rocsparse_status_not_initialized);
+
+        ROCSPARSE_CHECKARG(5, B, (B->format != A->format), rocsparse_status_not_implemented);
+        ROCSPARSE_CHECKARG(6, M, (M->format != A->format), rocsparse_status_not_implemented);
+        ROCSPARSE_CHECKARG(8, C, (C->format != A->format), rocsparse_status_not_implemented);
+
+        ROCSPARSE_CHECKARG(4, A, (A->data_type != compute_type), rocsparse_status_not_implemented);
+        ROCSPARSE_CHECKARG(5, B, (B->data_type != compute_type), rocsparse_status_not_implemented);
+        ROCSPARSE_CHECKARG(8, C, (C->data_type != compute_type), rocsparse_status_not_implemented);
+
+        ROCSPARSE_CHECKARG(5, B, (B->row_type != A->row_type), rocsparse_status_type_mismatch);
+        ROCSPARSE_CHECKARG(6, M, (M->row_type != A->row_type), rocsparse_status_type_mismatch);
+        ROCSPARSE_CHECKARG(8, C, (C->row_type != A->row_type), rocsparse_status_type_mismatch);
+
+        ROCSPARSE_CHECKARG(5, B, (B->col_type != A->col_type), rocsparse_status_type_mismatch);
+        ROCSPARSE_CHECKARG(6, M, (M->col_type != A->col_type), rocsparse_status_type_mismatch);
+        ROCSPARSE_CHECKARG(8, C, (C->col_type != A->col_type), rocsparse_status_type_mismatch);
+
+        ROCSPARSE_CHECKARG(5, B, (B->rows != A->cols), rocsparse_status_invalid_size);
+        ROCSPARSE_CHECKARG(6, M, (M->rows != A->rows), rocsparse_status_invalid_size);
+        ROCSPARSE_CHECKARG(6, M, (M->cols != B->cols), rocsparse_status_invalid_size);
+
+        return rocsparse_status_continue;
+    }
+}
+
+extern "C" rocsparse_status rocsparse_spgemm_masked(rocsparse_handle            handle,
+                                                    rocsparse_operation         trans_A,
+                                                    rocsparse_operation         trans_B,
+                                                    const void*                 alpha,
+                                                    rocsparse_const_spmat_descr A,
+                                                    rocsparse_const_spmat_descr B,
+                                                    rocsparse_const_spmat_descr M,
+                                                    rocsparse_spgemm_mask       mask,
+                                                    rocsparse_spmat_descr       C,
+                                                    rocsparse_datatype          compute_type,
+                                                    rocsparse_spgemm_alg        alg,
+                                                    rocsparse_spgemm_stage      stage,
+                                                    size_t*                     buffer_size,
+                                                    void*                       temp_buffer)
+try
+{
+    // Profiling
+    rocsparse::trace_scope trace(handle);
+
+    rocsparse::log_trace("rocsparse_spgemm_masked",
+                         handle,
+                         trans_A,
+                         trans_B,
+                         alpha,
+                         A,
+                         B,
+                         M,
+                         mask,
+                         C,
+                         compute_type,
+                         alg,
+                         stage,
+                         buffer_size,
+                         temp_buffer);
+
+    const rocsparse_status status = rocsparse::spgemm_masked_checkarg(handle,
+                                                                      trans_A,
+                                                                      trans_B,
+                                                                      alpha,
+                                                                      A,
+                                                                      B,
+                                                                      M,
+                                                                      mask,
+                                                                      C,
+                                                                      compute_type,
+                                                                      alg,
+                                                                      stage,
+                                                                      buffer_size,
+                                                                      temp_buffer);
+    if(status != rocsparse_status_continue)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(status);
+        return rocsparse_status_success;
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::spgemm_masked_template_dispatch(A->row_type,
+                                                                         A->col_type,
+                                                                         compute_type,
+                                                                         handle,
+                                                                         trans_A,
+                                                                         trans_B,
+                                                                         alpha,
+                                                                         A,
+                                                                         B,
+                                                                         M,
+                                                                         mask,
+                                                                         C,
+                                                                         alg,
+                                                                         stage,
+                                                                         buffer_size,
+                                                                         temp_buffer));
+
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
@@ -0,0 +1,327 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "common.h"
+
+namespace rocsparse
+{
+    // Compute non-zero entries per row of C = A + B, where each row is processed by a
+    // wavefront. The row is split into chunks of WFSIZE columns, such that shared memory can
+    // be used to mark whether a column index of the chunk is populated or not.
+    template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename I, typename J>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void spgeam_nnz_multipass(J m,
+                              J n,
+                              const I* __restrict__ ptr_A,
+                              const J* __restrict__ ind_A,
+                              const I* __restrict__ ptr_B,
+                              const J* __restrict__ ind_B,
+                              I* __restrict__ row_nnz_C,
+                              rocsparse_index_base idx_base_A,
+                              rocsparse_index_base idx_base_B)
+    {
+        const J lid = hipThreadIdx_x & (WFSIZE - 1);
+        const J wid = hipThreadIdx_x / WFSIZE;
+        const J row = hipBlockIdx_x * (BLOCKSIZE / WFSIZE) + wid;
+
+        if(row >= m)
+        {
+            return;
+        }
+
+        __shared__ bool stable[BLOCKSIZE];
+        bool*           table = &stable[wid * WFSIZE];
+
+        I row_begin_A = ptr_A[row] - idx_base_A;
+        I row_end_A   = ptr_A[row + 1] - idx_base_A;
+        I row_begin_B = ptr_B[row] - idx_base_B;
+        I row_end_B   = ptr_B[row + 1] - idx_base_B;
+
+        // The first chunk starts at the smallest column of both rows
+        J chunk_begin = min((row_begin_A < row_end_A) ? ind_A[row_begin_A] - idx_base_A : n,
+                            (row_begin_B < row_end_B) ? ind_B[row_begin_B] - idx_base_B : n);
+
+        I nnz = 0;
+
+        row_begin_A += lid;
+        row_begin_B += lid;
+
+        while(chunk_begin < n)
+        {
+            table[lid] = false;
+
+            __threadfence_block();
+
+            // First column that does not fit into the current chunk
+            J min_col = n;
+
+            for(; row_begin_A < row_end_A; row_begin_A += WFSIZE)
+            {
+                const J col = ind_A[row_begin_A] - idx_base_A;
+                const J shf = col - chunk_begin;
+
+                if(shf < WFSIZE)
+                {
+                    table[shf] = true;
+                }
+                else
+                {
+                    min_col = min(min_col, col);
+                    break;
+                }
+            }
+
+            for(; row_begin_B < row_end_B; row_begin_B += WFSIZE)
+            {
+                const J col = ind_B[row_begin_B] - idx_base_B;
+                const J shf = col - chunk_begin;
+
+                if(shf < WFSIZE)
+                {
+                    table[shf] = true;
+                }
+                else
+                {
+                    min_col = min(min_col, col);
+                    break;
+                }
+            }
+
+            __threadfence_block();
+
+            nnz += __popcll(__ballot(table[lid]));
+
+            // Wavefront-wide minimum gives the start of the next chunk
+            for(unsigned int i = WFSIZE >> 1; i > 0; i >>= 1)
+            {
+                min_col = min(min_col, __shfl_xor(min_col, i));
+            }
+
+            chunk_begin = min_col;
+        }
+
+        if(lid == WFSIZE - 1)
+        {
+            row_nnz_C[row] = nnz;
+        }
+    }
+
+    // Fill the column indices of C = A + B with the same chunked traversal as
+    // spgeam_nnz_multipass.
+    template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename I, typename J>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void spgeam_symbolic_multipass(J m,
+                                   J n,
+                                   const I* __restrict__ ptr_A,
+                                   const J* __restrict__ ind_A,
+                                   const I* __restrict__ ptr_B,
+                                   const J* __restrict__ ind_B,
+                                   const I* __restrict__ ptr_C,
+                                   J* __restrict__ ind_C,
+                                   rocsparse_index_base idx_base_A,
+                                   rocsparse_index_base idx_base_B,
+                                   rocsparse_index_base idx_base_C)
+    {
+        const J lid = hipThreadIdx_x & (WFSIZE - 1);
+        const J wid = hipThreadIdx_x / WFSIZE;
+        const J row = hipBlockIdx_x * (BLOCKSIZE / WFSIZE) + wid;
+
+        if(row >= m)
+        {
+            return;
+        }
+
+        __shared__ bool stable[BLOCKSIZE];
+        bool*           table = &stable[wid * WFSIZE];
+
+        I row_begin_A = ptr_A[row] - idx_base_A;
+        I row_end_A   = ptr_A[row + 1] - idx_base_A;
+        I row_begin_B = ptr_B[row] - idx_base_B;
+        I row_end_B   = ptr_B[row + 1] - idx_base_B;
+        I row_begin_C = ptr_C[row] - idx_base_C;
+
+        J chunk_begin = min((row_begin_A < row_end_A) ? ind_A[row_begin_A] - idx_base_A : n,
+                            (row_begin_B < row_end_B) ? ind_B[row_begin_B] - idx_base_B : n);
+
+        row_begin_A += lid;
+        row_begin_B += lid;
+
+        while(chunk_begin < n)
+        {
+            table[lid] = false;
+
+            __threadfence_block();
+
+            J min_col = n;
+
+            for(; row_begin_A < row_end_A; row_begin_A += WFSIZE)
+            {
+                const J col = ind_A[row_begin_A] - idx_base_A;
+                const J shf = col - chunk_begin;
+
+                if(shf < WFSIZE)
+                {
+                    table[shf] = true;
+                }
+                else
+                {
+                    min_col = min(min_col, col);
+                    break;
+                }
+            }
+
+            for(; row_begin_B < row_end_B; row_begin_B += WFSIZE)
+            {
+                const J col = ind_B[row_begin_B] - idx_base_B;
+                const J shf = col - chunk_begin;
+
+                if(shf < WFSIZE)
+                {
+                    table[shf] = true;
+                }
+                else
+                {
+                    min_col = min(min_col, col);
+                    break;
+                }
+            }
+
+            __threadfence_block();
+
+            const bool               has_nnz = table[lid];
+            const unsigned long long mask    = __ballot(has_nnz);
+
+            if(has_nnz)
+            {
+                // Position of this lane among the marked columns of the chunk
+                const I offset = __popcll(mask & (0xffffffffffffffff >> (63 - lid))) - 1;
+
+                ind_C[row_begin_C + offset] = chunk_begin + lid + idx_base_C;
+            }
+
+            row_begin_C += __popcll(mask);
+
+            for(unsigned int i = WFSIZE >> 1; i > 0; i >>= 1)
+            {
+                min_col = min(min_col, __shfl_xor(min_col, i));
+            }
+
+            chunk_begin = min_col;
+        }
+    }
+
+    // Position of column col in the sorted segment [begin, end) of ind, or -1 if the column
+    // is not present.
+    template <typename I, typename J>
+    ROCSPARSE_DEVICE_ILF I spgeam_find(
+        J col, const J* __restrict__ ind, I begin, I end, rocsparse_index_base idx_base)
+    {
+        while(begin < end)
+        {
+            const I mid = begin + (end - begin) / 2;
+            const J val = ind[mid] - idx_base;
+
+            if(val == col)
+            {
+                return mid;
+            }
+
+            if(val < col)
+            {
+                begin = mid + 1;
+            }
+            else
+            {
+                end = mid;
+            }
+        }
+
+        return -1;
+    }
+
+    // Compute the values of C = alpha * A + beta * B for a given sparsity pattern of C.
+    // Each row is processed by a wavefront, each lane computes entries of C independently by
+    // looking up its column in the rows of A and B. For BSR matrices, each non-zero entry
+    // is a block of bs2 = block_dim * block_dim values.
+    template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename I, typename J, typename T>
+    ROCSPARSE_DEVICE_ILF void spgeam_numeric_device(J m,
+                                                    I bs2,
+                                                    T alpha,
+                                                    const I* __restrict__ ptr_A,
+                                                    const J* __restrict__ ind_A,
+                                                    const T* __restrict__ val_A,
+                                                    T beta,
+                                                    const I* __restrict__ ptr_B,
+                                                    const J* __restrict__ ind_B,
+                                                    const T* __restrict__ val_B,
+                                                    const I* __restrict__ ptr_C,
+                                                    const J* __restrict__ ind_C,
+                                                    T* __restrict__ val_C,
+                                                    rocsparse_index_base idx_base_A,
+                                                    rocsparse_index_base idx_base_B,
+                                                    rocsparse_index_base idx_base_C)
+    {
+        const J lid = hipThreadIdx_x & (WFSIZE - 1);
+        const J wid = hipThreadIdx_x / WFSIZE;
+        const J row = hipBlockIdx_x * (BLOCKSIZE / WFSIZE) + wid;
+
+        if(row >= m)
+        {
+            return;
+        }
+
+        const I row_begin_A = ptr_A[row] - idx_base_A;
+        const I row_end_A   = ptr_A[row + 1] - idx_base_A;
+        const I row_begin_B = ptr_B[row] - idx_base_B;
+        const I row_end_B   = ptr_B[row + 1] - idx_base_B;
+        const I row_begin_C = ptr_C[row] - idx_base_C;
+        const I row_end_C   = ptr_C[row + 1] - idx_base_C;
+
+        for(I idx = lid; idx < (row_end_C - row_begin_C) * bs2; idx += WFSIZE)
+        {
+            const I j   = row_begin_C + idx / bs2;
+            const I e   = idx % bs2;
+            const J col = ind_C[j] - idx_base_C;
+
+            const I k_A = rocsparse::spgeam_find(col, ind_A, row_begin_A, row_end_A, idx_base_A);
+            const I k_B = rocsparse::spgeam_find(col, ind_B, row_begin_B, row_end_B, idx_base_B);
+
+            T sum = static_cast<T>(0);
+
+            if(k_A != -1)
+            {
+                sum = alpha * val_A[k_A * bs2 + e];
+            }
+
+            if(k_B != -1)
+            {
+                sum = rocsparse::fma(beta, val_B[k_B * bs2 + e], sum);
+            }
+
+            val_C[j * bs2 + e] = sum;
+        }
+    }
+}
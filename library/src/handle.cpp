@@ -22,10 +22,13 @@
  * ************************************************************************ */
 
 #include "handle.h"
+#include "analysis_cache.h"
 #include "control.h"
 #include "logging.h"
+#include "tracing.h"
 #include "utility.h"
 
+#include <cstring>
 #include <hip/hip_runtime.h>
 
 ROCSPARSE_KERNEL(1) void init_kernel(){};
@@ -139,6 +142,12 @@ _rocsparse_handle::_rocsparse_handle()
     {
         rocsparse::open_log_stream(&log_debug_os, &log_debug_ofs, "ROCSPARSE_LOG_DEBUG_PATH");
     }
+
+    // Register for the export of the binary trace records
+    if(layer_mode & rocsparse_layer_mode_log_profile)
+    {
+        rocsparse::trace_attach();
+    }
 }
 
 /*******************************************************************************
@@ -152,6 +161,12 @@ _rocsparse_handle::~_rocsparse_handle()
     PRINT_IF_HIP_ERROR(rocsparse_hipFree(cone));
     PRINT_IF_HIP_ERROR(rocsparse_hipFree(zone));
 
+    // Release cached analysis meta data
+    delete analysis_cache;
+
+    // Write the kernel summary of the last call
+    rocsparse::instrumentation_disable(this);
+
     // destroy blas handle
     rocsparse_status status = rocsparse::blas_destroy_handle(this->blas_handle);
     if(status != rocsparse_status_success)
@@ -172,6 +187,12 @@ _rocsparse_handle::~_rocsparse_handle()
     {
         log_debug_ofs.close();
     }
+
+    // Export binary trace records, if this is the last profiled handle
+    if(layer_mode & rocsparse_layer_mode_log_profile)
+    {
+        rocsparse::trace_detach();
+    }
 }
 
 /*******************************************************************************
@@ -278,6 +299,10 @@ rocsparse_status rocsparse::copy_csrmv_info(rocsparse_csrmv_info       dest,
     previously_created |= (dest->lrb.rows_bins != nullptr);
     previously_created |= (dest->lrb.n_rows_bins != nullptr);
 
+    previously_created |= (dest->csrmvt_perm != nullptr);
+    previously_created |= (dest->csrmvt_row_ptr != nullptr);
+    previously_created |= (dest->csrmvt_col_ind != nullptr);
+
     previously_created |= (dest->trans != rocsparse_operation_none);
     previously_created |= (dest->m != 0);
     previously_created |= (dest->n != 0);
@@ -295,6 +320,7 @@ rocsparse_status rocsparse::copy_csrmv_info(rocsparse_csrmv_info       dest,
         bool invalid = false;
         invalid |= (dest->adaptive.size != src->adaptive.size);
         invalid |= (dest->lrb.size != src->lrb.size);
+        invalid |= ((dest->csrmvt_perm == nullptr) != (src->csrmvt_perm == nullptr));
         invalid |= (dest->trans != src->trans);
         invalid |= (dest->m != src->m);
         invalid |= (dest->n != src->n);
@@ -434,8 +460,43 @@ rocsparse_status rocsparse::copy_csrmv_info(rocsparse_csrmv_info       dest,
             dest->lrb.n_rows_bins, src->lrb.n_rows_bins, J_size * 32, hipMemcpyDeviceToDevice));
     }
 
+    if(src->csrmvt_perm != nullptr)
+    {
+        if(dest->csrmvt_perm == nullptr)
+        {
+            RETURN_IF_HIP_ERROR(rocsparse_hipMalloc((void**)&dest->csrmvt_perm, I_size * src->nnz));
+        }
+        RETURN_IF_HIP_ERROR(hipMemcpy(
+            dest->csrmvt_perm, src->csrmvt_perm, I_size * src->nnz, hipMemcpyDeviceToDevice));
+    }
+
+    if(src->csrmvt_row_ptr != nullptr)
+    {
+        if(dest->csrmvt_row_ptr == nullptr)
+        {
+            RETURN_IF_HIP_ERROR(
+                rocsparse_hipMalloc((void**)&dest->csrmvt_row_ptr, I_size * (src->n + 1)));
+        }
+        RETURN_IF_HIP_ERROR(hipMemcpy(dest->csrmvt_row_ptr,
+                                      src->csrmvt_row_ptr,
+                                      I_size * (src->n + 1),
+                                      hipMemcpyDeviceToDevice));
+    }
+
+    if(src->csrmvt_col_ind != nullptr)
+    {
+        if(dest->csrmvt_col_ind == nullptr)
+        {
+            RETURN_IF_HIP_ERROR(
+                rocsparse_hipMalloc((void**)&dest->csrmvt_col_ind, J_size * src->nnz));
+        }
+        RETURN_IF_HIP_ERROR(hipMemcpy(
+            dest->csrmvt_col_ind, src->csrmvt_col_ind, J_size * src->nnz, hipMemcpyDeviceToDevice));
+    }
+
     dest->adaptive.size = src->adaptive.size;
     dest->lrb.size      = src->lrb.size;
+    std::memcpy(dest->lrb.nRowsBins, src->lrb.nRowsBins, sizeof(src->lrb.nRowsBins));
     dest->trans         = src->trans;
     dest->m             = src->m;
     dest->n             = src->n;
@@ -483,6 +544,11 @@ rocsparse_status rocsparse::destroy_csrmv_info(rocsparse_csrmv_info info)
 
     RETURN_IF_HIP_ERROR(rocsparse_hipFree(info->lrb.n_rows_bins));
 
+    // Clean up transposed data
+    RETURN_IF_HIP_ERROR(rocsparse_hipFree(info->csrmvt_perm));
+    RETURN_IF_HIP_ERROR(rocsparse_hipFree(info->csrmvt_row_ptr));
+    RETURN_IF_HIP_ERROR(rocsparse_hipFree(info->csrmvt_col_ind));
+
     // Destruct
     try
     {
@@ -818,6 +884,12 @@ rocsparse_status rocsparse::copy_csrgemm_info(rocsparse_csrgemm_info       dest,
     dest->mul = src->mul;
     dest->add = src->add;
 
+    dest->group_size_cached = src->group_size_cached;
+    for(int i = 0; i < CSRGEMM_MAXGROUPS + 1; ++i)
+    {
+        dest->group_size[i] = src->group_size[i];
+    }
+
     return rocsparse_status_success;
 }
 
@@ -915,6 +987,105 @@ rocsparse_status rocsparse::destroy_csritsv_info(rocsparse_csritsv_info info)
     return rocsparse_status_success;
 }
 
+/********************************************************************************
+ * \brief rocsparse_csr2csc_info is a structure holding the rocsparse csr2csc and
+ * gebsr2gebsc info data gathered during the analysis. It must be initialized
+ * using the create_csr2csc_info() routine. It should be destroyed at the
+ * end using destroy_csr2csc_info().
+ *******************************************************************************/
+rocsparse_status rocsparse::create_csr2csc_info(rocsparse_csr2csc_info* info)
+{
+    if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else
+    {
+        // Allocate
+        try
+        {
+            *info = new _rocsparse_csr2csc_info;
+        }
+        catch(const rocsparse_status& status)
+        {
+            return status;
+        }
+        return rocsparse_status_success;
+    }
+}
+
+/********************************************************************************
+ * \brief Copy csr2csc info.
+ *******************************************************************************/
+rocsparse_status rocsparse::copy_csr2csc_info(rocsparse_csr2csc_info       dest,
+                                              const rocsparse_csr2csc_info src)
+{
+    if(dest == nullptr || src == nullptr || dest == src)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // If destination already holds a permutation, it must be of the same size as source
+    if(dest->perm != nullptr)
+    {
+        if(dest->nnz != src->nnz || dest->index_type_I != src->index_type_I)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+    }
+
+    if(src->perm != nullptr)
+    {
+        const size_t I_size
+            = (src->index_type_I == rocsparse_indextype_i64) ? sizeof(int64_t) : sizeof(int32_t);
+
+        if(dest->perm == nullptr)
+        {
+            RETURN_IF_HIP_ERROR(rocsparse_hipMalloc(&dest->perm, I_size * src->nnz));
+        }
+
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(dest->perm, src->perm, I_size * src->nnz, hipMemcpyDeviceToDevice));
+    }
+
+    dest->m             = src->m;
+    dest->n             = src->n;
+    dest->nnz           = src->nnz;
+    dest->row_block_dim = src->row_block_dim;
+    dest->col_block_dim = src->col_block_dim;
+    dest->index_type_I  = src->index_type_I;
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Destroy csr2csc info.
+ *******************************************************************************/
+rocsparse_status rocsparse::destroy_csr2csc_info(rocsparse_csr2csc_info info)
+{
+    if(info == nullptr)
+    {
+        return rocsparse_status_success;
+    }
+
+    if(info->perm != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(rocsparse_hipFree(info->perm));
+        info->perm = nullptr;
+    }
+
+    // Destruct
+    try
+    {
+        delete info;
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+    return rocsparse_status_success;
+}
+
 // Emulate C++17 std::void_t
 template <typename...>
 using void_t = void;
@@ -0,0 +1,133 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.h"
+
+#include <list>
+
+namespace rocsparse
+{
+    /********************************************************************************
+     * \brief Kind of meta data held by an analysis cache entry.
+     *******************************************************************************/
+    typedef enum analysis_kind_
+    {
+        analysis_kind_csrmv = 0,
+        analysis_kind_trm   = 1
+    } analysis_kind;
+
+    /********************************************************************************
+     * \brief Key of an analysis cache entry. Two analyses share an entry if they
+     * run with the same parameters on sparsity patterns with the same fingerprint.
+     *******************************************************************************/
+    struct analysis_key
+    {
+        analysis_kind         kind{};
+        int                   alg{};
+        rocsparse_operation   trans{};
+        int64_t               m{};
+        int64_t               n{};
+        int64_t               nnz{};
+        rocsparse_matrix_type type{};
+        rocsparse_fill_mode   fill_mode{};
+        rocsparse_diag_type   diag_type{};
+        rocsparse_index_base  base{};
+        rocsparse_indextype   index_type_I{};
+        rocsparse_indextype   index_type_J{};
+        unsigned long long    hash[2]{};
+
+        bool operator==(const analysis_key& that) const;
+    };
+
+    /********************************************************************************
+     * \brief analysis_cache holds copies of the meta data gathered by csrmv and
+     * trm analyses, such that repeated analyses of an unchanged sparsity pattern
+     * only cost a fingerprint of the pattern. Entries are evicted in least
+     * recently used order once their total size exceeds the memory budget.
+     *******************************************************************************/
+    class analysis_cache
+    {
+    public:
+        explicit analysis_cache(size_t budget);
+        ~analysis_cache();
+
+        analysis_cache(const analysis_cache&) = delete;
+        analysis_cache& operator=(const analysis_cache&) = delete;
+
+        size_t get_budget() const;
+        size_t get_used() const;
+
+        // Shrink or grow the memory budget, evicting entries as needed
+        rocsparse_status set_budget(size_t budget);
+
+        // Release all entries
+        rocsparse_status clear();
+
+        // Return the cached csrmv info of key, nullptr if none is cached
+        rocsparse_csrmv_info find_csrmv(const analysis_key& key);
+
+        // Return the cached trm info and zero pivot of key, nullptr if none is cached
+        rocsparse_trm_info find_trm(const analysis_key& key, int64_t* zero_pivot);
+
+        // Store a copy of info under key
+        rocsparse_status insert_csrmv(const analysis_key& key, const rocsparse_csrmv_info info);
+        rocsparse_status insert_trm(const analysis_key&      key,
+                                    const rocsparse_trm_info info,
+                                    int64_t                  zero_pivot);
+
+    private:
+        struct entry
+        {
+            analysis_key         key{};
+            rocsparse_csrmv_info csrmv_info{};
+            rocsparse_trm_info   trm_info{};
+            int64_t              zero_pivot{};
+            size_t               bytes{};
+        };
+
+        std::list<entry>::iterator find(const analysis_key& key);
+        rocsparse_status           evict(size_t bytes);
+        rocsparse_status           release(entry& e);
+
+        size_t           budget{};
+        size_t           used{};
+        std::list<entry> entries;
+    };
+
+    /********************************************************************************
+     * \brief Compute the fingerprint of a CSR sparsity pattern on the device.
+     * Every entry of csr_row_ptr and csr_col_ind contributes a mix of its position
+     * and value to two independent 64 bit sums. This function blocks until the
+     * fingerprint is available on the host.
+     *******************************************************************************/
+    template <typename I, typename J>
+    rocsparse_status analysis_fingerprint(rocsparse_handle    handle,
+                                          J                   m,
+                                          I                   nnz,
+                                          const I*            csr_row_ptr,
+                                          const J*            csr_col_ind,
+                                          unsigned long long* hash);
+}
@@ -25,6 +25,7 @@
 #pragma once
 
 #include "argdescr.h"
+#include "instrumentation.h"
 #include "message.h"
 #include <iostream>
 
@@ -208,6 +209,8 @@ inline void dprint(I size_, const T* v, const char* name_ = nullptr, I short_siz
 #define THROW_IF_HIPLAUNCHKERNELGGL_ERROR(...)                                                 \
     do                                                                                         \
     {                                                                                          \
+        const rocsparse::kernel_launch rocsparse_kernel_launch_scope(                          \
+            ROCSPARSE_KERNEL_LAUNCH_ARGS(__VA_ARGS__));                                        \
         if(false == rocsparse_debug_variables.get_debug_kernel_launch())                       \
         {                                                                                      \
             hipLaunchKernelGGL(__VA_ARGS__);                                                   \
@@ -223,6 +226,8 @@ inline void dprint(I size_, const T* v, const char* name_ = nullptr, I short_siz
 #define RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(...)                                                 \
     do                                                                                          \
     {                                                                                           \
+        const rocsparse::kernel_launch rocsparse_kernel_launch_scope(                           \
+            ROCSPARSE_KERNEL_LAUNCH_ARGS(__VA_ARGS__));                                         \
         if(false == rocsparse_debug_variables.get_debug_kernel_launch())                        \
         {                                                                                       \
             hipLaunchKernelGGL(__VA_ARGS__);                                                    \
@@ -245,6 +250,16 @@ inline void dprint(I size_, const T* v, const char* name_ = nullptr, I short_siz
         }                                                             \
     } while(false)
 
+// Code paths that block the host reject handles in capture-safe mode
+#define RETURN_IF_CAPTURE_SAFE_MODE(HANDLE)                      \
+    RETURN_ROCSPARSE_ERROR_IF(rocsparse_status_not_capture_safe, \
+                              (HANDLE)->capture_mode == rocsparse_capture_mode_safe)
+
+#define THROW_IF_CAPTURE_SAFE_MODE(HANDLE)                                           \
+    THROW_IF_ROCSPARSE_ERROR(((HANDLE)->capture_mode == rocsparse_capture_mode_safe) \
+                                 ? rocsparse_status_not_capture_safe                 \
+                                 : rocsparse_status_success)
+
 #define PRINT_IF_HIP_ERROR(INPUT_STATUS_FOR_CHECK)                                    \
     {                                                                                 \
         hipError_t TMP_STATUS_FOR_CHECK = INPUT_STATUS_FOR_CHECK;                     \
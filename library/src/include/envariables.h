@@ -53,7 +53,8 @@ namespace rocsparse
     ENVARIABLE(VERBOSE)                 \
     ENVARIABLE(MEMSTAT)                 \
     ENVARIABLE(MEMSTAT_FORCE_MANAGED)   \
-    ENVARIABLE(MEMSTAT_GUARDS)
+    ENVARIABLE(MEMSTAT_GUARDS)          \
+    ENVARIABLE(LOG_PROFILE_GPU)
 
         //
         // Specification of the enum and the array of all values.
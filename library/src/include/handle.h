@@ -30,12 +30,20 @@
 #include "rocsparse_blas.h"
 #include <fstream>
 #include <hip/hip_runtime_api.h>
+#include <memory>
 
 /*! \brief typedefs to opaque info structs */
 typedef struct _rocsparse_trm_info*     rocsparse_trm_info;
 typedef struct _rocsparse_csrmv_info*   rocsparse_csrmv_info;
 typedef struct _rocsparse_csrgemm_info* rocsparse_csrgemm_info;
 typedef struct _rocsparse_csritsv_info* rocsparse_csritsv_info;
+typedef struct _rocsparse_csr2csc_info* rocsparse_csr2csc_info;
+
+namespace rocsparse
+{
+    class analysis_cache;
+    class instrumentation;
+}
 
 /********************************************************************************
  * \brief rocsparse_handle is a structure holding the rocsparse library context.
@@ -72,6 +80,10 @@ struct _rocsparse_handle
     hipStream_t stream = 0;
     // pointer mode ; default mode is host
     rocsparse_pointer_mode pointer_mode = rocsparse_pointer_mode_host;
+    // capture mode ; default mode may block the host
+    rocsparse_capture_mode capture_mode = rocsparse_capture_mode_default;
+    // data status mode ; default mode is host
+    rocsparse_data_status_mode data_status_mode = rocsparse_data_status_mode_host;
     // logging mode
     rocsparse_layer_mode layer_mode;
     // device buffer
@@ -85,6 +97,10 @@ struct _rocsparse_handle
     rocsparse_double_complex* zone{};
     // blas handle
     rocsparse::blas_handle blas_handle;
+    // analysis cache ; disabled by default
+    rocsparse::analysis_cache* analysis_cache{};
+    // kernel launch instrumentation ; disabled by default
+    std::shared_ptr<rocsparse::instrumentation> instrumentation{};
 
     // logging streams
     std::ofstream log_trace_ofs;
@@ -184,6 +200,8 @@ struct _rocsparse_mat_info
     rocsparse_trm_info     csrsmt_lower_info{};
     rocsparse_csrgemm_info csrgemm_info{};
     rocsparse_csritsv_info csritsv_info{};
+    rocsparse_csr2csc_info csr2csc_info{};
+    rocsparse_csr2csc_info gebsr2gebsc_info{};
 
     // zero pivot for csrsv, csrsm, csrilu0, csric0
     void* zero_pivot{};
@@ -243,6 +261,12 @@ struct _rocsparse_csrmv_info
     rocsparse_adaptive_info adaptive;
     rocsparse_lrb_info      lrb;
 
+    // device pointers to hold transposed data, A^T is stored without values
+    // and the values of A are gathered through the permutation
+    void* csrmvt_perm{};
+    void* csrmvt_row_ptr{};
+    void* csrmvt_col_ind{};
+
     // some data to verify correct execution
     rocsparse_operation         trans = rocsparse_operation_none;
     int64_t                     m{};
@@ -367,6 +391,9 @@ namespace rocsparse
     rocsparse_status destroy_csritsv_info(rocsparse_csritsv_info info);
 }
 
+// Number of row groups of the csrgemm kernels
+#define CSRGEMM_MAXGROUPS 8
+
 /********************************************************************************
  * \brief rocsparse_csrgemm_info is a structure holding the rocsparse csrgemm
  * info data gathered during csrgemm_buffer_size. It must be initialized using
@@ -381,6 +408,10 @@ struct _rocsparse_csrgemm_info
     bool mul{true};
     // Perform beta * D
     bool add{true};
+    // Row group sizes of C and maximum row nnz of C (last entry), gathered by the nnz or
+    // symbolic stage such that the compute and numeric stages do not copy them to the host
+    bool    group_size_cached{};
+    int64_t group_size[CSRGEMM_MAXGROUPS + 1]{};
 };
 
 namespace rocsparse
@@ -405,6 +436,49 @@ namespace rocsparse
     rocsparse_status destroy_csrgemm_info(rocsparse_csrgemm_info info);
 }
 
+/********************************************************************************
+ * \brief rocsparse_csr2csc_info is a structure holding the rocsparse csr2csc and
+ * gebsr2gebsc info data gathered during the analysis. It must be initialized
+ * using the create_csr2csc_info() routine. It should be destroyed at the
+ * end using destroy_csr2csc_info().
+ *******************************************************************************/
+struct _rocsparse_csr2csc_info
+{
+    // device array holding the CSR (BSR) position of each CSC (BSC) entry
+    void* perm{};
+
+    // some data to verify correct execution
+    int64_t m{};
+    int64_t n{};
+    int64_t nnz{};
+    int64_t row_block_dim{};
+    int64_t col_block_dim{};
+
+    rocsparse_indextype index_type_I = rocsparse_indextype_u16;
+};
+
+namespace rocsparse
+{
+    /********************************************************************************
+ * \brief rocsparse_csr2csc_info is a structure holding the rocsparse csr2csc and
+ * gebsr2gebsc info data gathered during the analysis. It must be initialized
+ * using the create_csr2csc_info() routine. It should be destroyed at the
+ * end using destroy_csr2csc_info().
+ *******************************************************************************/
+    rocsparse_status create_csr2csc_info(rocsparse_csr2csc_info* info);
+
+    /********************************************************************************
+ * \brief Copy csr2csc info.
+ *******************************************************************************/
+    rocsparse_status copy_csr2csc_info(rocsparse_csr2csc_info       dest,
+                                       const rocsparse_csr2csc_info src);
+
+    /********************************************************************************
+ * \brief Destroy csr2csc info.
+ *******************************************************************************/
+    rocsparse_status destroy_csr2csc_info(rocsparse_csr2csc_info info);
+}
+
 /********************************************************************************
  * \brief ELL format indexing
  *******************************************************************************/
@@ -470,6 +544,10 @@ struct _rocsparse_spmat_descr
     int64_t batch_stride{};
     int64_t offsets_batch_stride{};
     int64_t columns_values_batch_stride{};
+
+    // Column indices batch stride, equal to columns_values_batch_stride unless the
+    // batches share their column indices while their values are strided
+    int64_t columns_batch_stride{};
 };
 
 struct _rocsparse_dnvec_descr
@@ -480,6 +558,9 @@ struct _rocsparse_dnvec_descr
     void*              values{};
     const void*        const_values{};
     rocsparse_datatype data_type{};
+
+    int64_t batch_count{};
+    int64_t batch_stride{};
 };
 
 struct _rocsparse_dnmat_descr
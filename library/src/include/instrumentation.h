@@ -0,0 +1,148 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocsparse-types.h"
+
+#include <atomic>
+#include <hip/hip_runtime_api.h>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace rocsparse
+{
+    /********************************************************************************
+     * \brief instrumentation holds the kernel launch callback of a handle and the
+     * kernels launched by the current call of the handle, which are written as a
+     * summary to the trace log once the call is over. It is shared with the threads
+     * whose current call belongs to the handle, such that it outlives the handle.
+     *******************************************************************************/
+    class instrumentation
+    {
+    public:
+        struct kernel_stats
+        {
+            std::string kernel{};
+            int64_t     launches{};
+            double      duration_ms{};
+        };
+
+        // Set once the handle stops reporting, launches of previous calls are dropped
+        std::atomic<bool> retired{};
+
+        // Guards the members below
+        std::mutex mutex{};
+
+        rocsparse_instrumentation_mode   mode{};
+        rocsparse_kernel_launch_callback callback{};
+        void*                            user_data{};
+
+        // Current call
+        std::string               routine{};
+        bool                      capture_safe{};
+        double                    bytes{};
+        double                    flops{};
+        std::vector<kernel_stats> kernels{};
+    };
+
+    // Number of handles with instrumentation, launches are not instrumented if 0
+    extern std::atomic<int> instrumented_handles;
+
+    /********************************************************************************
+     * \brief Instrumentation functions
+     *
+     * instrumentation_enable    Report the kernel launches of handle to callback.
+     * instrumentation_disable   Write the summary of the current call and stop
+     *                           reporting the kernel launches of handle.
+     * instrumentation_begin     Write the summary of the previous call and attribute
+     *                           the kernel launches of the calling thread to routine,
+     *                           or to no routine if handle is not instrumented.
+     * instrumentation_estimate  Attach the bytes and flops estimated for the current
+     *                           call of handle to its kernel launches.
+     *******************************************************************************/
+    rocsparse_status instrumentation_enable(rocsparse_handle                 handle,
+                                            rocsparse_instrumentation_mode   mode,
+                                            rocsparse_kernel_launch_callback callback,
+                                            void*                            user_data);
+    void             instrumentation_disable(rocsparse_handle handle);
+    void             instrumentation_begin(rocsparse_handle handle, const char* routine);
+    void             instrumentation_estimate(rocsparse_handle handle, double bytes, double flops);
+
+    /********************************************************************************
+     * \brief kernel_launch reports the kernel launched in the scope it lives in, if
+     * the handle of the current call on this thread is instrumented. In timed mode,
+     * the scope blocks until the kernel has completed.
+     *******************************************************************************/
+    class kernel_launch
+    {
+    public:
+        kernel_launch(const char* kernel,
+                      dim3        grid,
+                      dim3        block,
+                      size_t      shared_memory,
+                      hipStream_t stream)
+        {
+            if(rocsparse::instrumented_handles.load(std::memory_order_relaxed) > 0)
+            {
+                this->begin(kernel, grid, block, shared_memory, stream);
+            }
+        }
+
+        ~kernel_launch()
+        {
+            if(this->active_)
+            {
+                this->end();
+            }
+        }
+
+        kernel_launch(const kernel_launch&) = delete;
+        kernel_launch& operator=(const kernel_launch&) = delete;
+
+    private:
+        void begin(const char* kernel,
+                   dim3        grid,
+                   dim3        block,
+                   size_t      shared_memory,
+                   hipStream_t stream);
+        void end();
+
+        bool                                        active_{};
+        std::shared_ptr<rocsparse::instrumentation> instrumentation_{};
+        rocsparse_kernel_launch_callback            callback_{};
+        void*                                       user_data_{};
+        std::string                                 routine_{};
+        rocsparse_kernel_launch_info                info_{};
+        hipEvent_t                                  start_{};
+        hipEvent_t                                  stop_{};
+    };
+}
+
+// Split the arguments of hipLaunchKernelGGL into the arguments of kernel_launch
+#define ROCSPARSE_KERNEL_LAUNCH_ARGS_(KERNEL, GRID, BLOCK, SHARED, STREAM, ...) \
+    #KERNEL, GRID, BLOCK, SHARED, STREAM
+#define ROCSPARSE_KERNEL_LAUNCH_ARGS(...) ROCSPARSE_KERNEL_LAUNCH_ARGS_(__VA_ARGS__, )
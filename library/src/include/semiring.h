@@ -0,0 +1,299 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "common.h"
+
+namespace rocsparse
+{
+    //
+    // Semirings replace the conventional (+, *, 0, 1) of the sparse kernels by a
+    // reduction (add), a product (mul), the identity of the reduction (zero) and
+    // the identity of the product (one). The kernels that support semirings take
+    // the semiring as a template parameter, defaulting to plus_times_semiring that
+    // maps onto the regular arithmetic and reduction primitives.
+    //
+    template <typename S>
+    struct semiring_base
+    {
+        template <typename T, typename U, typename V>
+        static __device__ __forceinline__ T fma(U a, V b, T c)
+        {
+            return S::add(static_cast<T>(S::mul(a, b)), c);
+        }
+
+        // Returns true if y = alpha * (A x) + beta * y leaves y unchanged
+        template <typename T>
+        static __device__ __forceinline__ bool is_noop(T alpha, T beta)
+        {
+            return alpha == S::template zero<T>() && beta == S::template one<T>();
+        }
+
+        // Initializes an output entry that is reduced atomically by several
+        // workgroups. The entry is reset to the identity of the reduction and
+        // the contribution of beta * y is returned to the calling thread.
+        template <typename T, typename Y>
+        static __device__ __forceinline__ T atomic_init(T beta, Y* y)
+        {
+            const T out_val = (beta != S::template zero<T>()) ? S::mul(beta, static_cast<T>(*y))
+                                                               : S::template zero<T>();
+            *y              = S::template zero<T>();
+            __threadfence();
+            return out_val;
+        }
+
+        template <unsigned int WFSIZE, typename T>
+        static __device__ __forceinline__ T wfreduce(T sum)
+        {
+            for(int i = WFSIZE >> 1; i > 0; i >>= 1)
+            {
+                sum = S::add(sum, __shfl_xor(sum, i));
+            }
+            return sum;
+        }
+
+        template <unsigned int BLOCKSIZE, typename T>
+        static __device__ __forceinline__ void blockreduce(int i, T* data)
+        {
+#pragma unroll
+            for(unsigned int s = 512; s > 0; s >>= 1)
+            {
+                if(BLOCKSIZE > s)
+                {
+                    if(i < s && i + s < BLOCKSIZE)
+                    {
+                        data[i] = S::add(data[i], data[i + s]);
+                    }
+                    __syncthreads();
+                }
+            }
+        }
+    };
+
+    // Conventional arithmetic, (+, *) with identity 0
+    struct plus_times_semiring
+    {
+        template <typename T>
+        static __device__ __forceinline__ T zero()
+        {
+            return static_cast<T>(0);
+        }
+
+        template <typename T>
+        static __device__ __forceinline__ T one()
+        {
+            return static_cast<T>(1);
+        }
+
+        template <typename T>
+        static __device__ __forceinline__ T add(T a, T b)
+        {
+            return a + b;
+        }
+
+        template <typename T, typename U>
+        static __device__ __forceinline__ auto mul(T a, U b)
+        {
+            return a * b;
+        }
+
+        template <typename T, typename U, typename V>
+        static __device__ __forceinline__ T fma(U a, V b, T c)
+        {
+            return rocsparse::fma<T>(a, b, c);
+        }
+
+        template <typename T>
+        static __device__ __forceinline__ bool is_noop(T alpha, T beta)
+        {
+            return alpha == static_cast<T>(0) && beta == static_cast<T>(1);
+        }
+
+        template <typename T, typename Y>
+        static __device__ __forceinline__ T atomic_init(T beta, Y* y)
+        {
+            // Adding (beta - 1) * y to y gives beta * y without resetting y first
+            return (beta - static_cast<T>(1)) * (*y);
+        }
+
+        template <typename T>
+        static __device__ __forceinline__ void atomic_add(T* ptr, T val)
+        {
+            rocsparse::atomic_add(ptr, val);
+        }
+
+        template <unsigned int WFSIZE, typename T>
+        static __device__ __forceinline__ T wfreduce(T sum)
+        {
+            return rocsparse::wfreduce_sum<WFSIZE>(sum);
+        }
+
+        template <unsigned int BLOCKSIZE, typename T>
+        static __device__ __forceinline__ void blockreduce(int i, T* data)
+        {
+            rocsparse::blockreduce_sum<BLOCKSIZE>(i, data);
+        }
+    };
+
+    // Tropical semiring, (min, +) with identity +inf, e.g. single source shortest path
+    struct min_plus_semiring : semiring_base<min_plus_semiring>
+    {
+        template <typename T>
+        static __device__ __forceinline__ T zero()
+        {
+            return std::numeric_limits<T>::infinity();
+        }
+
+        template <typename T>
+        static __device__ __forceinline__ T one()
+        {
+            return static_cast<T>(0);
+        }
+
+        template <typename T>
+        static __device__ __forceinline__ T add(T a, T b)
+        {
+            return min(a, b);
+        }
+
+        template <typename T>
+        static __device__ __forceinline__ T mul(T a, T b)
+        {
+            return a + b;
+        }
+
+        template <typename T>
+        static __device__ __forceinline__ void atomic_add(T* ptr, T val)
+        {
+            rocsparse::atomic_min(ptr, val);
+        }
+    };
+
+    // (max, *) with identity 0 on non-negative values, e.g. most reliable path
+    struct max_times_semiring : semiring_base<max_times_semiring>
+    {
+        template <typename T>
+        static __device__ __forceinline__ T zero()
+        {
+            return static_cast<T>(0);
+        }
+
+        template <typename T>
+        static __device__ __forceinline__ T one()
+        {
+            return static_cast<T>(1);
+        }
+
+        template <typename T>
+        static __device__ __forceinline__ T add(T a, T b)
+        {
+            return max(a, b);
+        }
+
+        template <typename T>
+        static __device__ __forceinline__ T mul(T a, T b)
+        {
+            return a * b;
+        }
+
+        template <typename T>
+        static __device__ __forceinline__ void atomic_add(T* ptr, T val)
+        {
+            rocsparse::atomic_max(ptr, val);
+        }
+    };
+
+    // (max, min) with identity -inf, e.g. widest path
+    struct max_min_semiring : semiring_base<max_min_semiring>
+    {
+        template <typename T>
+        static __device__ __forceinline__ T zero()
+        {
+            return -std::numeric_limits<T>::infinity();
+        }
+
+        template <typename T>
+        static __device__ __forceinline__ T one()
+        {
+            return std::numeric_limits<T>::infinity();
+        }
+
+        template <typename T>
+        static __device__ __forceinline__ T add(T a, T b)
+        {
+            return max(a, b);
+        }
+
+        template <typename T>
+        static __device__ __forceinline__ T mul(T a, T b)
+        {
+            return min(a, b);
+        }
+
+        template <typename T>
+        static __device__ __forceinline__ void atomic_add(T* ptr, T val)
+        {
+            rocsparse::atomic_max(ptr, val);
+        }
+    };
+
+    // Boolean semiring, (or, and) with identity 0, e.g. breadth first search.
+    // Any non-zero value is true, results are either 0 or 1.
+    struct or_and_semiring : semiring_base<or_and_semiring>
+    {
+        template <typename T>
+        static __device__ __forceinline__ T zero()
+        {
+            return static_cast<T>(0);
+        }
+
+        template <typename T>
+        static __device__ __forceinline__ T one()
+        {
+            return static_cast<T>(1);
+        }
+
+        template <typename T>
+        static __device__ __forceinline__ T add(T a, T b)
+        {
+            return (a != static_cast<T>(0) || b != static_cast<T>(0)) ? static_cast<T>(1)
+                                                                     : static_cast<T>(0);
+        }
+
+        template <typename T>
+        static __device__ __forceinline__ T mul(T a, T b)
+        {
+            return (a != static_cast<T>(0) && b != static_cast<T>(0)) ? static_cast<T>(1)
+                                                                     : static_cast<T>(0);
+        }
+
+        template <typename T>
+        static __device__ __forceinline__ void atomic_add(T* ptr, T val)
+        {
+            // All partial results are 0 or 1, thus the maximum is the logical or
+            rocsparse::atomic_max(ptr, val);
+        }
+    };
+}
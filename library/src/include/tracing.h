@@ -0,0 +1,156 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.h"
+#include "logging.h"
+#include <hip/hip_runtime_api.h>
+#include <stdint.h>
+#include <type_traits>
+
+namespace rocsparse
+{
+    /**
+ *  @brief Binary trace record
+ *
+ *  @details
+ *  trace_record is the fixed-size record stored in the per-thread ring buffers
+ *  when the layer mode rocsparse_layer_mode_log_profile is set. The routine name
+ *  is truncated to fit the record, the arguments are only kept as a digest.
+ */
+    struct trace_record
+    {
+        static constexpr size_t name_size = 64;
+
+        char        name[name_size]; ///< Routine name, null terminated.
+        uint64_t    digest; ///< FNV-1a digest of the arguments.
+        hipStream_t stream; ///< Stream of the handle.
+        int64_t     timestamp_ns; ///< Enqueue timestamp.
+        int64_t     duration_ns; ///< Host duration, negative if unknown.
+        float       gpu_duration_ms; ///< Device duration, negative if unknown.
+        hipEvent_t  gpu_start; ///< Pending start event, resolved at export.
+        hipEvent_t  gpu_stop; ///< Pending stop event, resolved at export.
+    };
+
+    /**
+ *  @brief Functor computing the digest of the arguments
+ *
+ *  @details
+ *  The bytes of trivially copyable arguments (scalars, enums, pointers) are
+ *  hashed, other arguments are skipped.
+ */
+    struct trace_digest
+    {
+        uint64_t* digest;
+
+        static void hash(uint64_t* digest, const void* data, size_t size)
+        {
+            const unsigned char* bytes = static_cast<const unsigned char*>(data);
+            for(size_t i = 0; i < size; ++i)
+            {
+                *digest ^= bytes[i];
+                *digest *= 0x100000001b3ULL;
+            }
+        }
+
+        template <typename T>
+        void apply(const T& x, std::true_type) const
+        {
+            hash(this->digest, &x, sizeof(T));
+        }
+
+        template <typename T>
+        void apply(const T& x, std::false_type) const
+        {
+        }
+
+        template <typename T>
+        void operator()(const T& x) const
+        {
+            this->apply(x, std::is_trivially_copyable<T>{});
+        }
+    };
+
+    /**
+ *  @brief Tracing functions
+ *
+ *  @details
+ *  trace_begin   Begin a timed record, GPU events are recorded on the stream if the
+ *                environment variable ROCSPARSE_LOG_PROFILE_GPU is set to 1.
+ *  trace_end     End a timed record and push it into the ring buffer of the
+ *                calling thread.
+ *  trace_push    Push a record without duration into the ring buffer of the
+ *                calling thread, or complete the timed record in progress on
+ *                this thread.
+ *  trace_attach  Register a handle with profile logging enabled.
+ *  trace_detach  Unregister a handle. Once the last registered handle is gone, all
+ *                records are written in Chrome trace event format, which can be
+ *                opened in chrome://tracing or Perfetto, to the file given by
+ *                ROCSPARSE_LOG_PROFILE_PATH.
+ */
+    void trace_begin(trace_record& record, hipStream_t stream);
+    void trace_end(trace_record& record);
+    void trace_push(const char* name, uint64_t digest, hipStream_t stream);
+    void trace_attach();
+    void trace_detach();
+
+    /**
+ *  @brief Record the duration of a routine
+ *
+ *  @details
+ *  trace_scope times the scope it lives in. Name and digest of the record are
+ *  filled in by the first call to log_trace in that scope.
+ */
+    class trace_scope
+    {
+    public:
+        trace_scope(rocsparse_handle handle);
+        ~trace_scope();
+
+    private:
+        trace_record record_;
+        bool         active_{};
+    };
+
+    inline const char* trace_name(const char* name)
+    {
+        return name;
+    }
+
+    inline const char* trace_name(const std::string& name)
+    {
+        return name.c_str();
+    }
+
+    // log_profile will push a binary record with the digest of the
+    // function arguments into the ring buffer of the calling thread
+    template <typename H, typename... Ts>
+    void log_profile(hipStream_t stream, const H& head, Ts&&... xs)
+    {
+        uint64_t digest = 0xcbf29ce484222325ULL;
+        rocsparse::each_args(trace_digest{&digest}, xs...);
+        rocsparse::trace_push(rocsparse::trace_name(head), digest, stream);
+    }
+}
@@ -27,6 +27,7 @@
 #include "control.h"
 #include "handle.h"
 #include "logging.h"
+#include "tracing.h"
 
 namespace rocsparse
 {
@@ -132,6 +133,17 @@ namespace rocsparse
     // then
     // log_function will call log_arguments to log function
     // arguments with a comma separator
+    //
+    // if profile logging is turned on with
+    // (handle->layer_mode & rocsparse_layer_mode_log_profile) == true
+    // then
+    // a binary record of the function call is stored for trace export
+    //
+    // if kernel launches are instrumented with
+    // handle->instrumentation != nullptr
+    // then
+    // the following kernel launches of this thread are attributed to the function,
+    // otherwise they are not attributed to any function
     template <typename H, typename... Ts>
     void log_trace(rocsparse_handle handle, H head, Ts&&... xs)
     {
@@ -144,6 +156,18 @@ namespace rocsparse
                 std::ostream* os = handle->log_trace_os;
                 rocsparse::log_arguments(*os, comma_separator, head, std::forward<Ts>(xs)...);
             }
+
+            if(handle->layer_mode & rocsparse_layer_mode_log_profile)
+            {
+                rocsparse::log_profile(handle->stream, head, xs...);
+            }
+
+            // A thread that called an instrumented handle before must not attribute the
+            // kernel launches of this call to it
+            if(rocsparse::instrumented_handles.load(std::memory_order_relaxed) > 0)
+            {
+                rocsparse::instrumentation_begin(handle, rocsparse::trace_name(head));
+            }
         }
     }
 
@@ -270,6 +294,38 @@ namespace rocsparse
 
 #define LOG_BENCH_SCALAR_VALUE(handle, name) log_bench_scalar_value(handle, name)
 
+    // rocsparse-bench only takes real scalars, the imaginary part is dropped
+    template <typename T>
+    double log_bench_real_value(const T& value)
+    {
+        return std::real(value);
+    }
+
+    // rocsparse-bench precision option of typename T
+    template <typename T>
+    std::string bench_precision()
+    {
+        return std::is_same<T, float>{}                     ? "s"
+               : std::is_same<T, double>{}                  ? "d"
+               : std::is_same<T, rocsparse_float_complex>{} ? "c"
+                                                            : "z";
+    }
+
+    // rocsparse-bench index type option of typenames I and J
+    template <typename I, typename J>
+    char bench_indextype()
+    {
+        return (sizeof(J) == sizeof(int64_t)) ? 'd' : (sizeof(I) == sizeof(int64_t)) ? 'm' : 's';
+    }
+
+    // rocsparse-bench transpose option of an operation
+    inline char bench_operation(rocsparse_operation trans)
+    {
+        return (trans == rocsparse_operation_none)        ? 'N'
+               : (trans == rocsparse_operation_transpose) ? 'T'
+                                                          : 'C';
+    }
+
     // replaces X in string with s, d, c, z or h depending on typename T
     template <typename T>
     std::string replaceX(std::string input_string)
@@ -424,6 +480,49 @@ namespace rocsparse
         return true;
     };
 
+    template <>
+    inline bool enum_utils::is_invalid(rocsparse_capture_mode value)
+    {
+        switch(value)
+        {
+        case rocsparse_capture_mode_default:
+        case rocsparse_capture_mode_safe:
+        {
+            return false;
+        }
+        }
+        return true;
+    };
+
+    template <>
+    inline bool enum_utils::is_invalid(rocsparse_data_status_mode value)
+    {
+        switch(value)
+        {
+        case rocsparse_data_status_mode_host:
+        case rocsparse_data_status_mode_device:
+        {
+            return false;
+        }
+        }
+        return true;
+    };
+
+    template <>
+    inline bool enum_utils::is_invalid(rocsparse_instrumentation_mode value)
+    {
+        switch(value)
+        {
+        case rocsparse_instrumentation_mode_none:
+        case rocsparse_instrumentation_mode_launch:
+        case rocsparse_instrumentation_mode_timed:
+        {
+            return false;
+        }
+        }
+        return true;
+    };
+
     template <>
     inline bool enum_utils::is_invalid(rocsparse_spmat_attribute value)
     {
@@ -691,6 +790,7 @@ namespace rocsparse
         case rocsparse_spmv_alg_coo_atomic:
         case rocsparse_spmv_alg_bsr:
         case rocsparse_spmv_alg_csr_lrb:
+        case rocsparse_spmv_alg_csr_gather:
         {
             return false;
         }
@@ -894,6 +994,81 @@ namespace rocsparse
         return true;
     };
 
+    template <>
+    inline bool enum_utils::is_invalid(rocsparse_spgemm_mask value_)
+    {
+        switch(value_)
+        {
+        case rocsparse_spgemm_mask_structure:
+        case rocsparse_spgemm_mask_complement:
+        {
+            return false;
+        }
+        }
+        return true;
+    };
+
+    template <>
+    inline bool enum_utils::is_invalid(rocsparse_spgeam_alg value_)
+    {
+        switch(value_)
+        {
+        case rocsparse_spgeam_alg_default:
+        {
+            return false;
+        }
+        }
+        return true;
+    };
+
+    template <>
+    inline bool enum_utils::is_invalid(rocsparse_spgeam_stage value_)
+    {
+        switch(value_)
+        {
+        case rocsparse_spgeam_stage_buffer_size:
+        case rocsparse_spgeam_stage_nnz:
+        case rocsparse_spgeam_stage_compute:
+        case rocsparse_spgeam_stage_symbolic:
+        case rocsparse_spgeam_stage_numeric:
+        {
+            return false;
+        }
+        }
+        return true;
+    };
+
+    template <>
+    inline bool enum_utils::is_invalid(rocsparse_semiring value_)
+    {
+        switch(value_)
+        {
+        case rocsparse_semiring_plus_times:
+        case rocsparse_semiring_min_plus:
+        case rocsparse_semiring_max_times:
+        case rocsparse_semiring_max_min:
+        case rocsparse_semiring_or_and:
+        {
+            return false;
+        }
+        }
+        return true;
+    };
+
+    template <>
+    inline bool enum_utils::is_invalid(rocsparse_spmv_reduction value_)
+    {
+        switch(value_)
+        {
+        case rocsparse_spmv_reduction_dot_xy:
+        case rocsparse_spmv_reduction_dot_yy:
+        {
+            return false;
+        }
+        }
+        return true;
+    };
+
     template <>
     inline bool enum_utils::is_invalid(rocsparse_solve_policy value_)
     {
@@ -1054,14 +1229,22 @@ namespace rocsparse
 
 #include "memstat.h"
 
-    inline rocsparse_status calculate_nnz(
-        int64_t m, rocsparse_indextype indextype, const void* ptr, int64_t* nnz, hipStream_t stream)
+    inline rocsparse_status calculate_nnz(rocsparse_handle    handle,
+                                          int64_t             m,
+                                          rocsparse_indextype indextype,
+                                          const void*         ptr,
+                                          int64_t*            nnz)
     {
         if(m == 0)
         {
             nnz[0] = 0;
             return rocsparse_status_success;
         }
+
+        // The first and last offsets are read back on the host
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
+        hipStream_t stream = handle->stream;
         const char* p
             = reinterpret_cast<const char*>(ptr) + rocsparse::indextype_sizeof(indextype) * m;
         int64_t end, start;
@@ -1098,6 +1281,7 @@ namespace rocsparse
                 &u, ptr, rocsparse::indextype_sizeof(indextype), hipMemcpyDeviceToHost, stream));
             RETURN_IF_HIP_ERROR(hipMemcpyAsync(
                 &v, p, rocsparse::indextype_sizeof(indextype), hipMemcpyDeviceToHost, stream));
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
             start = u;
             end   = v;
             break;
@@ -80,6 +80,12 @@ rocsparse_status rocsparse::dotci_template(rocsparse_handle     handle,
     ROCSPARSE_CHECKARG_POINTER(4, y);
     ROCSPARSE_CHECKARG_POINTER(5, result);
 
+    // The result is only written to host memory in host pointer mode
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+    }
+
     // Stream
     hipStream_t stream = handle->stream;
 
@@ -25,6 +25,7 @@
 #pragma once
 
 #include "common.h"
+#include "semiring.h"
 
 namespace rocsparse
 {
@@ -88,6 +89,229 @@ namespace rocsparse
         }
     }
 
+    // Computes y = alpha * A * x + beta * y and, in the same pass, the block partial
+    // of x^H * y (DOT_YY == false) or y^H * y (DOT_YY == true) of the updated y. Each
+    // y[row] is final once its wavefront has reduced the row, such that the last lane
+    // can accumulate its contribution without re-reading y.
+    template <unsigned int BLOCKSIZE,
+              unsigned int WF_SIZE,
+              bool         DOT_YY,
+              typename I,
+              typename J,
+              typename A,
+              typename X,
+              typename Y,
+              typename T>
+    ROCSPARSE_DEVICE_ILF void csrmvn_general_fused_device(bool                 conj,
+                                                          J                    m,
+                                                          T                    alpha,
+                                                          const I*             csr_row_ptr,
+                                                          const J*             csr_col_ind,
+                                                          const A*             csr_val,
+                                                          const X*             x,
+                                                          T                    beta,
+                                                          Y*                   y,
+                                                          T*                   workspace,
+                                                          rocsparse_index_base idx_base)
+    {
+        const int lid = hipThreadIdx_x & (WF_SIZE - 1);
+
+        const J gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+        const J nwf = hipGridDim_x * (BLOCKSIZE / WF_SIZE);
+
+        T dot = static_cast<T>(0);
+
+        // Loop over rows
+        for(J row = gid / WF_SIZE; row < m; row += nwf)
+        {
+            // Each wavefront processes one row
+            const I row_start = csr_row_ptr[row] - idx_base;
+            const I row_end   = csr_row_ptr[row + 1] - idx_base;
+
+            T sum = static_cast<T>(0);
+
+            // Loop over non-zero elements
+            for(I j = row_start + lid; j < row_end; j += WF_SIZE)
+            {
+                sum = rocsparse::fma<T>(alpha * conj_val(csr_val[j], conj),
+                                        rocsparse::ldg(x + csr_col_ind[j] - idx_base),
+                                        sum);
+            }
+
+            // Obtain row sum using parallel reduction
+            sum = rocsparse::wfreduce_sum<WF_SIZE>(sum);
+
+            // Last thread of each wavefront writes result and accumulates the dot product
+            if(lid == WF_SIZE - 1)
+            {
+                if(beta != static_cast<T>(0))
+                {
+                    sum = rocsparse::fma<T>(beta, y[row], sum);
+                }
+
+                y[row] = sum;
+
+                dot = rocsparse::fma<T>(
+                    DOT_YY ? rocsparse::conj(sum) : rocsparse::conj(static_cast<T>(x[row])),
+                    sum,
+                    dot);
+            }
+        }
+
+        // Reduce the partial dot products of the block
+        __shared__ T sdata[BLOCKSIZE];
+        sdata[hipThreadIdx_x] = dot;
+
+        __syncthreads();
+
+        rocsparse::blockreduce_sum<BLOCKSIZE>(hipThreadIdx_x, sdata);
+
+        if(hipThreadIdx_x == 0)
+        {
+            workspace[hipBlockIdx_x] = sdata[0];
+        }
+    }
+
+    // Computes y = alpha * op(A) * x + beta * y, where op(A) is the transpose of A,
+    // using the cached structure of A^T. The values are gathered from the CSR
+    // matrix A through the permutation, such that A^T is processed row by row.
+    template <unsigned int BLOCKSIZE,
+              unsigned int WF_SIZE,
+              typename I,
+              typename J,
+              typename A,
+              typename X,
+              typename Y,
+              typename T>
+    ROCSPARSE_DEVICE_ILF void csrmvt_transposed_device(bool                 conj,
+                                                       J                    n,
+                                                       T                    alpha,
+                                                       const I*             csrt_row_ptr,
+                                                       const J*             csrt_col_ind,
+                                                       const I*             csrt_perm,
+                                                       const A*             csr_val,
+                                                       const X*             x,
+                                                       T                    beta,
+                                                       Y*                   y,
+                                                       rocsparse_index_base idx_base)
+    {
+        const int lid = hipThreadIdx_x & (WF_SIZE - 1);
+
+        const J gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+        const J nwf = hipGridDim_x * (BLOCKSIZE / WF_SIZE);
+
+        // Loop over rows of A^T
+        for(J row = gid / WF_SIZE; row < n; row += nwf)
+        {
+            // Each wavefront processes one row
+            const I row_start = csrt_row_ptr[row] - idx_base;
+            const I row_end   = csrt_row_ptr[row + 1] - idx_base;
+
+            T sum = static_cast<T>(0);
+
+            // Loop over non-zero elements
+            for(I j = row_start + lid; j < row_end; j += WF_SIZE)
+            {
+                sum = rocsparse::fma<T>(alpha * conj_val(csr_val[csrt_perm[j]], conj),
+                                        rocsparse::ldg(x + csrt_col_ind[j] - idx_base),
+                                        sum);
+            }
+
+            // Obtain row sum using parallel reduction
+            sum = rocsparse::wfreduce_sum<WF_SIZE>(sum);
+
+            // First thread of each wavefront writes result into global memory
+            if(lid == WF_SIZE - 1)
+            {
+                if(beta == static_cast<T>(0))
+                {
+                    y[row] = sum;
+                }
+                else
+                {
+                    y[row] = rocsparse::fma<T>(beta, y[row], sum);
+                }
+            }
+        }
+    }
+
+    template <unsigned int BLOCKSIZE,
+              unsigned int WF_SIZE,
+              typename I,
+              typename J,
+              typename A,
+              typename X,
+              typename Y,
+              typename T>
+    ROCSPARSE_DEVICE_ILF void csrmvn_batch_device(J                    m,
+                                                  int64_t              batch_count,
+                                                  T                    alpha,
+                                                  const I*             csr_row_ptr,
+                                                  const J*             csr_col_ind,
+                                                  const A*             csr_val,
+                                                  int64_t              offsets_batch_stride,
+                                                  int64_t              columns_batch_stride,
+                                                  int64_t              values_batch_stride,
+                                                  const X*             x,
+                                                  int64_t              batch_stride_x,
+                                                  T                    beta,
+                                                  Y*                   y,
+                                                  int64_t              batch_stride_y,
+                                                  rocsparse_index_base idx_base)
+    {
+        const int lid = hipThreadIdx_x & (WF_SIZE - 1);
+
+        const int64_t gid = static_cast<int64_t>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
+        const int64_t nwf = static_cast<int64_t>(hipGridDim_x) * (BLOCKSIZE / WF_SIZE);
+
+        // The rows of all matrices in the batch are enumerated consecutively, such
+        // that the wavefronts of a single block work on several small matrices
+        const int64_t nrow = static_cast<int64_t>(m) * batch_count;
+
+        // Loop over rows
+        for(int64_t idx = gid / WF_SIZE; idx < nrow; idx += nwf)
+        {
+            const int64_t batch = idx / m;
+            const J       row   = static_cast<J>(idx - batch * m);
+
+            const I* row_ptr = csr_row_ptr + offsets_batch_stride * batch;
+            const J* col_ind = csr_col_ind + columns_batch_stride * batch;
+            const A* val     = csr_val + values_batch_stride * batch;
+            const X* xb      = x + batch_stride_x * batch;
+
+            // Each wavefront processes one row
+            const I row_start = row_ptr[row] - idx_base;
+            const I row_end   = row_ptr[row + 1] - idx_base;
+
+            T sum = static_cast<T>(0);
+
+            // Loop over non-zero elements
+            for(I j = row_start + lid; j < row_end; j += WF_SIZE)
+            {
+                sum = rocsparse::fma<T>(
+                    alpha * val[j], rocsparse::ldg(xb + col_ind[j] - idx_base), sum);
+            }
+
+            // Obtain row sum using parallel reduction
+            sum = rocsparse::wfreduce_sum<WF_SIZE>(sum);
+
+            // Last thread of each wavefront writes result into global memory
+            if(lid == WF_SIZE - 1)
+            {
+                Y* yb = y + batch_stride_y * batch;
+
+                if(beta == static_cast<T>(0))
+                {
+                    yb[row] = sum;
+                }
+                else
+                {
+                    yb[row] = rocsparse::fma<T>(beta, yb[row], sum);
+                }
+            }
+        }
+    }
+
     template <typename J, typename Y, typename T>
     ROCSPARSE_DEVICE_ILF void csrmvt_scale_device(J size, T scalar, Y* data)
     {
@@ -141,12 +365,12 @@ namespace rocsparse
         }
     }
 
-    template <typename I, typename T>
+    template <typename S, typename I, typename T>
     ROCSPARSE_DEVICE_ILF T sum2_reduce(T cur_sum, T* partial, int lid, I max_size, int reduc_size)
     {
         if(max_size > reduc_size)
         {
-            cur_sum = cur_sum + partial[lid + reduc_size];
+            cur_sum = S::add(cur_sum, partial[lid + reduc_size]);
             __syncthreads();
             partial[lid] = cur_sum;
         }
@@ -157,6 +381,7 @@ namespace rocsparse
               rocsparse_int BLOCK_MULTIPLIER,
               rocsparse_int ROWS_FOR_VECTOR,
               rocsparse_int WG_SIZE,
+              typename S,
               typename I,
               typename J,
               typename A,
@@ -208,7 +433,7 @@ namespace rocsparse
         // Any workgroup only calculates, at most, BLOCK_MULTIPLIER*BLOCKSIZE items in a row.
         // If there are more items in this row, we assign more workgroups.
 
-        T temp_sum = static_cast<T>(0);
+        T temp_sum = S::template zero<T>();
 
         // If the next row block starts more than 2 rows away, then we choose CSR-Stream.
         // If this is zero (long rows) or one (final workgroup in a long row, or a single
@@ -249,8 +474,8 @@ namespace rocsparse
             {
                 for(J i = 0; i < BLOCKSIZE; i += WG_SIZE)
                 {
-                    partialSums[lid + i] = alpha * conj_val(csr_val[col + i], conj)
-                                           * x[csr_col_ind[col + i] - idx_base];
+                    partialSums[lid + i] = S::mul(S::mul(alpha, conj_val(csr_val[col + i], conj)),
+                                                  x[csr_col_ind[col + i] - idx_base]);
                 }
             }
             else
@@ -264,8 +489,8 @@ namespace rocsparse
                 // to be launched, and this loop can't be unrolled.
                 for(I i = 0; col + i < csr_row_ptr[stop_row] - idx_base; i += WG_SIZE)
                 {
-                    partialSums[lid + i] = alpha * conj_val(csr_val[col + i], conj)
-                                           * x[csr_col_ind[col + i] - idx_base];
+                    partialSums[lid + i] = S::mul(S::mul(alpha, conj_val(csr_val[col + i], conj)),
+                                                  x[csr_col_ind[col + i] - idx_base]);
                 }
             }
             __syncthreads();
@@ -299,7 +524,7 @@ namespace rocsparse
                         local_cur_val < local_last_val;
                         local_cur_val += numThreadsForRed)
                     {
-                        temp_sum = temp_sum + partialSums[local_cur_val];
+                        temp_sum = S::add(temp_sum, partialSums[local_cur_val]);
                     }
                 }
                 __syncthreads();
@@ -314,7 +539,7 @@ namespace rocsparse
                 for(int i = (WG_SIZE >> 1); i > 0; i >>= 1)
                 {
                     __syncthreads();
-                    temp_sum = sum2_reduce(temp_sum, partialSums, lid, numThreadsForRed, i);
+                    temp_sum = sum2_reduce<S>(temp_sum, partialSums, lid, numThreadsForRed, i);
                 }
 
                 if(threadInBlock == 0 && local_row < stop_row)
@@ -322,9 +547,9 @@ namespace rocsparse
                     // All of our write-outs check to see if the output vector should first be zeroed.
                     // If so, just do a write rather than a read-write. Measured to be a slight (~5%)
                     // performance improvement.
-                    if(beta != static_cast<T>(0))
+                    if(beta != S::template zero<T>())
                     {
-                        temp_sum = rocsparse::fma<T>(beta, y[local_row], temp_sum);
+                        temp_sum = S::fma(beta, y[local_row], temp_sum);
                     }
                     y[local_row] = temp_sum;
                 }
@@ -342,18 +567,18 @@ namespace rocsparse
                 {
                     const J local_first_val = (csr_row_ptr[local_row] - csr_row_ptr[row]);
                     const J local_last_val  = csr_row_ptr[local_row + 1] - csr_row_ptr[row];
-                    temp_sum                = static_cast<T>(0);
+                    temp_sum                = S::template zero<T>();
                     for(J local_cur_val = local_first_val; local_cur_val < local_last_val;
                         ++local_cur_val)
                     {
-                        temp_sum = temp_sum + partialSums[local_cur_val];
+                        temp_sum = S::add(temp_sum, partialSums[local_cur_val]);
                     }
 
                     // After you've done the reduction into the temp_sum register,
                     // put that into the output for each row.
-                    if(beta != static_cast<T>(0))
+                    if(beta != S::template zero<T>())
                     {
-                        temp_sum = rocsparse::fma<T>(beta, y[local_row], temp_sum);
+                        temp_sum = S::fma(beta, y[local_row], temp_sum);
                     }
 
                     y[local_row] = temp_sum;
@@ -376,7 +601,7 @@ namespace rocsparse
             {
                 // Any workgroup only calculates, at most, BLOCKSIZE items in this row.
                 // If there are more items in this row, we use CSR-LongRows.
-                temp_sum         = static_cast<T>(0);
+                temp_sum         = S::template zero<T>();
                 const I vecStart = csr_row_ptr[row] - idx_base;
                 const I vecEnd   = csr_row_ptr[row + 1] - idx_base;
 
@@ -387,8 +612,9 @@ namespace rocsparse
                 // things.
                 for(I j = vecStart + lid; j < vecEnd; j += WG_SIZE)
                 {
-                    temp_sum = rocsparse::fma<T>(
-                        alpha * conj_val(csr_val[j], conj), x[csr_col_ind[j] - idx_base], temp_sum);
+                    temp_sum = S::fma(S::mul(alpha, conj_val(csr_val[j], conj)),
+                                      x[csr_col_ind[j] - idx_base],
+                                      temp_sum);
                 }
 
                 partialSums[lid] = temp_sum;
@@ -396,15 +622,15 @@ namespace rocsparse
                 __syncthreads();
 
                 // Reduce partial sums
-                rocsparse::blockreduce_sum<WG_SIZE>(lid, partialSums);
+                S::template blockreduce<WG_SIZE>(lid, partialSums);
 
                 if(lid == 0)
                 {
                     temp_sum = partialSums[0];
 
-                    if(beta != static_cast<T>(0))
+                    if(beta != S::template zero<T>())
                     {
-                        temp_sum = rocsparse::fma<T>(beta, y[row], temp_sum);
+                        temp_sum = S::fma(beta, y[row], temp_sum);
                     }
 
                     y[row] = temp_sum;
@@ -438,8 +664,7 @@ namespace rocsparse
             if(gid == first_wg_in_row && lid == 0)
             {
                 // The first workgroup handles the output initialization.
-                const Y out_val = y[row];
-                temp_sum        = (beta - static_cast<T>(1)) * out_val;
+                temp_sum = S::atomic_init(beta, y + row);
                 atomicXor(&wg_flags[first_wg_in_row], 1U); // Release other workgroups.
             }
             // For every other workgroup, wg_flags[first_wg_in_row] holds the value they wait on.
@@ -462,8 +687,9 @@ namespace rocsparse
             // Then dump the partially reduced answers into the LDS for inter-work-item reduction.
             for(I j = vecStart + lid; j < vecEnd; j += WG_SIZE)
             {
-                temp_sum = rocsparse::fma<T>(
-                    alpha * conj_val(csr_val[j], conj), x[csr_col_ind[j] - idx_base], temp_sum);
+                temp_sum = S::fma(S::mul(alpha, conj_val(csr_val[j], conj)),
+                                  x[csr_col_ind[j] - idx_base],
+                                  temp_sum);
             }
 
             partialSums[lid] = temp_sum;
@@ -471,11 +697,11 @@ namespace rocsparse
             __syncthreads();
 
             // Reduce partial sums
-            rocsparse::blockreduce_sum<WG_SIZE>(lid, partialSums);
+            S::template blockreduce<WG_SIZE>(lid, partialSums);
 
             if(lid == 0)
             {
-                rocsparse::atomic_add(y + row, partialSums[0]);
+                S::atomic_add(y + row, partialSums[0]);
             }
         }
     }
@@ -562,6 +788,7 @@ namespace rocsparse
 
     // "Stream" case a la CSR-Adaptive
     template <unsigned int BLOCKSIZE,
+              typename S,
               typename I,
               typename J,
               typename A,
@@ -614,13 +841,13 @@ namespace rocsparse
                 if(col_idx_in_row < row_len)
                 {
                     const A val = conj_val(csr_val[row_start + col_idx_in_row], conj);
-                    partialSums[lds_idx]
-                        = alpha * val * x[csr_col_ind[row_start + col_idx_in_row] - idx_base];
+                    partialSums[lds_idx] = S::mul(
+                        S::mul(alpha, val), x[csr_col_ind[row_start + col_idx_in_row] - idx_base]);
                 }
                 else
                 {
                     // lds <- 0
-                    partialSums[lds_idx] = 0;
+                    partialSums[lds_idx] = S::template zero<T>();
                 }
             }
         }
@@ -632,16 +859,16 @@ namespace rocsparse
         {
             const unsigned int lds_start_idx = (lid << bin_id);
             const J            row_id        = rows_bins[bin_start + wg_row_start + lid];
-            T                  acc           = 0;
+            T                  acc           = S::template zero<T>();
 
             for(unsigned int idx = 0; idx < (1 << bin_id); idx++)
             {
-                acc += partialSums[lds_start_idx + idx];
+                acc = S::add(acc, partialSums[lds_start_idx + idx]);
             }
 
-            if(beta != 0)
+            if(beta != S::template zero<T>())
             {
-                acc = rocsparse::fma<T>(beta, y[row_id], acc);
+                acc = S::fma(beta, y[row_id], acc);
             }
             y[row_id] = acc;
         }
@@ -652,6 +879,7 @@ namespace rocsparse
     // dynamic LDS allocation approach would blow up size requirements beyond reasonable bounds.
     template <unsigned int BLOCKSIZE,
               unsigned int CSRMV_LRB_SHORT_ROWS_2_LDS_ELEMS,
+              typename S,
               typename I,
               typename J,
               typename A,
@@ -705,13 +933,13 @@ namespace rocsparse
                 if(col_idx_in_row < row_len)
                 {
                     const A val = conj_val(csr_val[row_start + col_idx_in_row], conj);
-                    partialSums[lds_idx]
-                        = alpha * val * x[csr_col_ind[row_start + col_idx_in_row] - idx_base];
+                    partialSums[lds_idx] = S::mul(
+                        S::mul(alpha, val), x[csr_col_ind[row_start + col_idx_in_row] - idx_base]);
                 }
                 else
                 {
                     // lds <- 0
-                    partialSums[lds_idx] = 0;
+                    partialSums[lds_idx] = S::template zero<T>();
                 }
             }
         }
@@ -727,14 +955,14 @@ namespace rocsparse
                 const unsigned int lds_start_idx = (this_row_offset_in_wg << bin_id);
                 const J row_id = rows_bins[bin_start + wg_row_start + this_row_offset_in_wg];
 
-                T acc = 0;
+                T acc = S::template zero<T>();
                 for(unsigned int idx = 0; idx < (1 << bin_id); idx++)
                 {
-                    acc += partialSums[lds_start_idx + idx];
+                    acc = S::add(acc, partialSums[lds_start_idx + idx]);
                 }
 
-                if(beta != 0)
-                    acc = rocsparse::fma<T>(beta, y[row_id], acc);
+                if(beta != S::template zero<T>())
+                    acc = S::fma(beta, y[row_id], acc);
                 y[row_id] = acc;
             }
         }
@@ -743,6 +971,7 @@ namespace rocsparse
     // "Vector" case a la CSR-Adaptive using one warp per row
     template <unsigned int BLOCKSIZE,
               unsigned int WF_SIZE,
+              typename S,
               typename I,
               typename J,
               typename A,
@@ -781,24 +1010,24 @@ namespace rocsparse
         const J bin_start = n_rows_bins[bin_id];
         const J row       = rows_bins[bin_start + gid];
 
-        T       temp_sum = static_cast<T>(0);
+        T       temp_sum = S::template zero<T>();
         const I vecStart = csr_row_ptr[row] - idx_base;
         const I vecEnd   = csr_row_ptr[row + 1] - idx_base;
 
         for(I j = vecStart + lid; j < vecEnd; j += WF_SIZE)
         {
-            temp_sum = rocsparse::fma<T>(
-                alpha * conj_val(csr_val[j], conj), x[csr_col_ind[j] - idx_base], temp_sum);
+            temp_sum = S::fma(
+                S::mul(alpha, conj_val(csr_val[j], conj)), x[csr_col_ind[j] - idx_base], temp_sum);
         }
 
         // Obtain row sum using parallel warp reduction
-        temp_sum = rocsparse::wfreduce_sum<WF_SIZE>(temp_sum);
+        temp_sum = S::template wfreduce<WF_SIZE>(temp_sum);
 
         if(lid == WF_SIZE - 1)
         {
-            if(beta != static_cast<T>(0))
+            if(beta != S::template zero<T>())
             {
-                temp_sum = rocsparse::fma<T>(beta, y[row], temp_sum);
+                temp_sum = S::fma(beta, y[row], temp_sum);
             }
 
             y[row] = temp_sum;
@@ -807,6 +1036,7 @@ namespace rocsparse
 
     // "Vector" case a la CSR-Adaptive using one block per row
     template <unsigned int BLOCKSIZE,
+              typename S,
               typename I,
               typename J,
               typename A,
@@ -851,7 +1081,7 @@ namespace rocsparse
         // This means that we can more easily process everything with Vector that we would otherwise have done
         // with Longrows - which, in turn, means we can guarantee result reproducibility simply by avoiding Longrows
         // use (-> no non-determinstic atomics), just set the bin threshold for Longrows to "infinity" (or "32").
-        T       temp_sum = static_cast<T>(0);
+        T       temp_sum = S::template zero<T>();
         const I vecStart = csr_row_ptr[row] - idx_base;
         const I vecEnd   = csr_row_ptr[row + 1] - idx_base;
 
@@ -859,8 +1089,8 @@ namespace rocsparse
         // Then dump the partially reduced answers into the LDS for inter-work-item reduction.
         for(I j = vecStart + lid; j < vecEnd; j += BLOCKSIZE)
         {
-            temp_sum = rocsparse::fma<T>(
-                alpha * conj_val(csr_val[j], conj), x[csr_col_ind[j] - idx_base], temp_sum);
+            temp_sum = S::fma(
+                S::mul(alpha, conj_val(csr_val[j], conj)), x[csr_col_ind[j] - idx_base], temp_sum);
         }
 
         partialSums[lid] = temp_sum;
@@ -868,15 +1098,15 @@ namespace rocsparse
         __syncthreads();
 
         // Reduce partial sums
-        rocsparse::blockreduce_sum<BLOCKSIZE>(lid, partialSums);
+        S::template blockreduce<BLOCKSIZE>(lid, partialSums);
 
         if(lid == 0)
         {
             temp_sum = partialSums[0];
 
-            if(beta != static_cast<T>(0))
+            if(beta != S::template zero<T>())
             {
-                temp_sum = rocsparse::fma<T>(beta, y[row], temp_sum);
+                temp_sum = S::fma(beta, y[row], temp_sum);
             }
 
             y[row] = temp_sum;
@@ -886,6 +1116,7 @@ namespace rocsparse
     // "LongRows" aka "VectorL" case a la CSR-Adaptive
     template <unsigned int BLOCKSIZE,
               unsigned int BLOCK_MULTIPLIER,
+              typename S,
               typename I,
               typename J,
               typename A,
@@ -932,7 +1163,7 @@ namespace rocsparse
         const I vecEnd
             = min(csr_row_ptr[row + 1] - idx_base, vecStart + BLOCK_MULTIPLIER * BLOCKSIZE);
 
-        T temp_sum = static_cast<T>(0);
+        T temp_sum = S::template zero<T>();
 
         // In CSR-LongRows, we have more than one workgroup calculating this row.
         // The output values for those types of rows are stored using atomic_add, because
@@ -954,8 +1185,7 @@ namespace rocsparse
         if(gid == first_wg_in_row && lid == 0)
         {
             // The first workgroup handles the output initialization.
-            const Y out_val = y[row];
-            temp_sum        = (beta - static_cast<T>(1)) * out_val;
+            temp_sum = S::atomic_init(beta, y + row);
             atomicXor(&wg_flags[first_wg_in_row], 1U); // Release other workgroups.
         }
 
@@ -979,8 +1209,8 @@ namespace rocsparse
         // Then dump the partially reduced answers into the LDS for inter-work-item reduction.
         for(I j = vecStart + lid; j < vecEnd; j += BLOCKSIZE)
         {
-            temp_sum = rocsparse::fma<T>(
-                alpha * conj_val(csr_val[j], conj), x[csr_col_ind[j] - idx_base], temp_sum);
+            temp_sum = S::fma(
+                S::mul(alpha, conj_val(csr_val[j], conj)), x[csr_col_ind[j] - idx_base], temp_sum);
         }
 
         partialSums[lid] = temp_sum;
@@ -988,11 +1218,11 @@ namespace rocsparse
         __syncthreads();
 
         // Reduce partial sums
-        rocsparse::blockreduce_sum<BLOCKSIZE>(lid, partialSums);
+        S::template blockreduce<BLOCKSIZE>(lid, partialSums);
 
         if(lid == 0)
         {
-            rocsparse::atomic_add((y + row), partialSums[0]);
+            S::atomic_add((y + row), partialSums[0]);
         }
     }
 }
@@ -150,6 +150,9 @@ rocsparse_status rocsparse::bsrsv_analysis_template(rocsparse_handle          ha
         // User is explicitly asking to force a re-analysis, or no valid data has been
         // found to be re-used.
 
+        // The analysis reads its meta data back on the host
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
         // Clear bsrsv
         RETURN_IF_ROCSPARSE_ERROR(rocsparse::destroy_trm_info((trans == rocsparse_operation_none)
                                                                   ? info->bsrsv_upper_info
@@ -217,6 +220,9 @@ rocsparse_status rocsparse::bsrsv_analysis_template(rocsparse_handle          ha
         // User is explicitly asking to force a re-analysis, or no valid data has been
         // found to be re-used.
 
+        // The analysis reads its meta data back on the host
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
         // Clear bsrsv
         RETURN_IF_ROCSPARSE_ERROR(rocsparse::destroy_trm_info((trans == rocsparse_operation_none)
                                                                   ? info->bsrsv_lower_info
@@ -216,6 +216,8 @@ rocsparse_status rocsparse::coomv_analysis_template(rocsparse_handle          ha
     {
         if(std::is_same<I, int32_t>() && nnz < std::numeric_limits<int32_t>::max())
         {
+            RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
             I* max_nnz     = nullptr;
             I* csr_row_ptr = nullptr;
             RETURN_IF_HIP_ERROR(
@@ -248,6 +250,8 @@ rocsparse_status rocsparse::coomv_analysis_template(rocsparse_handle          ha
         }
         else
         {
+            RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
             int64_t* max_nnz     = nullptr;
             int64_t* csr_row_ptr = nullptr;
             RETURN_IF_HIP_ERROR(
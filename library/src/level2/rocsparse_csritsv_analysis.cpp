@@ -155,6 +155,14 @@ namespace rocsparse
                                            rocsparse_int**           zero_pivot,
                                            void*                     temp_buffer)
     {
+        // The diagonal counts are read back on the host
+        if(nnz > 0
+           && (descr->diag_type == rocsparse_diag_type_non_unit
+               || descr->type == rocsparse_matrix_type_triangular))
+        {
+            RETURN_IF_CAPTURE_SAFE_MODE(handle);
+        }
+
         // Allocate buffer to hold zero pivot
         if(zero_pivot[0] == nullptr)
         {
@@ -201,6 +201,9 @@ rocsparse_status rocsparse::csritsv_solve_template(rocsparse_handle          han
         return rocsparse_status_success;
     }
 
+    // The zero pivot and the residual norms are read back on the host
+    RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
     rocsparse_csritsv_info        csritsv_info = info->csritsv_info;
     static constexpr unsigned int BLOCKSIZE    = 1024;
     dim3                          blocks((m - 1) / BLOCKSIZE + 1);
@@ -23,12 +23,16 @@
  * ************************************************************************ */
 
 #include "internal/level2/rocsparse_csrmv.h"
+#include "analysis_cache.h"
 #include "common.h"
 #include "control.h"
 #include "utility.h"
 
 #include "rocsparse_csrmv.hpp"
 
+#include "../conversion/rocsparse_csr2csc.hpp"
+#include "../conversion/rocsparse_csr2csc_analysis.hpp"
+
 using namespace rocsparse;
 
 template <>
@@ -39,6 +43,7 @@ inline bool rocsparse::enum_utils::is_invalid(rocsparse_csrmv_alg value_)
     case rocsparse_csrmv_alg_stream:
     case rocsparse_csrmv_alg_adaptive:
     case rocsparse_csrmv_alg_lrb:
+    case rocsparse_csrmv_alg_gather:
     {
         return false;
     }
@@ -46,6 +51,143 @@ inline bool rocsparse::enum_utils::is_invalid(rocsparse_csrmv_alg value_)
     return true;
 };
 
+namespace rocsparse
+{
+    // The gather algorithm only differs from the adaptive algorithm for (conjugate)
+    // transposed products of non-symmetric matrices
+    static bool csrmv_gathers_transposed(rocsparse_csrmv_alg       alg,
+                                         rocsparse_operation       trans,
+                                         const rocsparse_mat_descr descr)
+    {
+        return alg == rocsparse_csrmv_alg_gather && trans != rocsparse_operation_none
+               && (descr->type == rocsparse_matrix_type_general
+                   || descr->type == rocsparse_matrix_type_triangular);
+    }
+
+    template <typename I, typename J>
+    static rocsparse_status csrmv_analysis_transposed(rocsparse_handle          handle,
+                                                      rocsparse_operation       trans,
+                                                      J                         m,
+                                                      J                         n,
+                                                      I                         nnz,
+                                                      const rocsparse_mat_descr descr,
+                                                      const I*                  csr_row_ptr,
+                                                      const J*                  csr_col_ind,
+                                                      rocsparse_mat_info        info)
+    {
+        // Stream
+        hipStream_t stream = handle->stream;
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::destroy_csrmv_info(info->csrmv_info));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::create_csrmv_info(&info->csrmv_info));
+
+        rocsparse_csrmv_info csrmv_info = info->csrmv_info;
+
+        csrmv_info->trans       = trans;
+        csrmv_info->m           = m;
+        csrmv_info->n           = n;
+        csrmv_info->nnz         = nnz;
+        csrmv_info->descr       = descr;
+        csrmv_info->csr_row_ptr = csr_row_ptr;
+        csrmv_info->csr_col_ind = csr_col_ind;
+
+        csrmv_info->index_type_I = rocsparse::get_indextype<I>();
+        csrmv_info->index_type_J = rocsparse::get_indextype<J>();
+
+        // Allocate the structure of A^T, the values are not stored but gathered from A
+        RETURN_IF_HIP_ERROR(
+            rocsparse_hipMallocAsync(&csrmv_info->csrmvt_perm, sizeof(I) * nnz, stream));
+        RETURN_IF_HIP_ERROR(
+            rocsparse_hipMallocAsync(&csrmv_info->csrmvt_row_ptr, sizeof(I) * (n + 1), stream));
+        RETURN_IF_HIP_ERROR(
+            rocsparse_hipMallocAsync(&csrmv_info->csrmvt_col_ind, sizeof(J) * nnz, stream));
+
+        // Temporary storage for the transposition
+        size_t buffer_size;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::csr2csc_buffer_size_core(handle,
+                                                                      m,
+                                                                      n,
+                                                                      nnz,
+                                                                      csr_row_ptr,
+                                                                      csr_row_ptr + 1,
+                                                                      csr_col_ind,
+                                                                      rocsparse_action_numeric,
+                                                                      &buffer_size));
+
+        void* temp_buffer;
+        RETURN_IF_HIP_ERROR(rocsparse_hipMallocAsync(&temp_buffer, buffer_size, stream));
+
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse::csr2csc_permutation_core(handle,
+                                                m,
+                                                n,
+                                                nnz,
+                                                csr_row_ptr,
+                                                csr_col_ind,
+                                                reinterpret_cast<J*>(csrmv_info->csrmvt_col_ind),
+                                                reinterpret_cast<I*>(csrmv_info->csrmvt_row_ptr),
+                                                reinterpret_cast<I*>(csrmv_info->csrmvt_perm),
+                                                descr->base,
+                                                temp_buffer));
+
+        RETURN_IF_HIP_ERROR(rocsparse_hipFreeAsync(temp_buffer, stream));
+
+        return rocsparse_status_success;
+    }
+
+    template <typename I, typename J, typename A>
+    static rocsparse_status csrmv_analysis_dispatch(rocsparse_handle          handle,
+                                                    rocsparse_operation       trans,
+                                                    rocsparse_csrmv_alg       alg,
+                                                    J                         m,
+                                                    J                         n,
+                                                    I                         nnz,
+                                                    const rocsparse_mat_descr descr,
+                                                    const A*                  csr_val,
+                                                    const I*                  csr_row_ptr,
+                                                    const J*                  csr_col_ind,
+                                                    rocsparse_mat_info        info)
+    {
+        switch(alg)
+        {
+        case rocsparse_csrmv_alg_gather:
+        {
+            if(rocsparse::csrmv_gathers_transposed(alg, trans, descr))
+            {
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse::csrmv_analysis_transposed(
+                    handle, trans, m, n, nnz, descr, csr_row_ptr, csr_col_ind, info));
+                return rocsparse_status_success;
+            }
+
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse::csrmv_analysis_adaptive_template_dispatch(
+                handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info));
+            return rocsparse_status_success;
+        }
+
+        case rocsparse_csrmv_alg_adaptive:
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse::csrmv_analysis_adaptive_template_dispatch(
+                handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info));
+            return rocsparse_status_success;
+        }
+
+        case rocsparse_csrmv_alg_lrb:
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse::csrmv_analysis_lrb_template_dispatch(
+                handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info));
+            return rocsparse_status_success;
+        }
+
+        case rocsparse_csrmv_alg_stream:
+        {
+            return rocsparse_status_success;
+        }
+        }
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_invalid_value);
+    }
+}
+
 template <typename I, typename J, typename A>
 rocsparse_status rocsparse::csrmv_analysis_template(rocsparse_handle          handle,
                                                     rocsparse_operation       trans,
@@ -65,29 +207,55 @@ rocsparse_status rocsparse::csrmv_analysis_template(rocsparse_handle          ha
         return rocsparse_status_success;
     }
 
-    switch(alg)
-    {
-    case rocsparse_csrmv_alg_adaptive:
+    if(handle->analysis_cache == nullptr || alg == rocsparse_csrmv_alg_stream)
     {
-        RETURN_IF_ROCSPARSE_ERROR(rocsparse::csrmv_analysis_adaptive_template_dispatch(
-            handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::csrmv_analysis_dispatch(
+            handle, trans, alg, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info));
         return rocsparse_status_success;
     }
 
-    case rocsparse_csrmv_alg_lrb:
-    {
-        RETURN_IF_ROCSPARSE_ERROR(rocsparse::csrmv_analysis_lrb_template_dispatch(
-            handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info));
-        return rocsparse_status_success;
-    }
+    // The fingerprint is read back and the analysis is awaited on the host
+    RETURN_IF_CAPTURE_SAFE_MODE(handle);
 
-    case rocsparse_csrmv_alg_stream:
+    rocsparse::analysis_key key;
+    key.kind         = rocsparse::analysis_kind_csrmv;
+    key.alg          = alg;
+    key.trans        = trans;
+    key.m            = m;
+    key.n            = n;
+    key.nnz          = nnz;
+    key.type         = descr->type;
+    key.fill_mode    = descr->fill_mode;
+    key.diag_type    = descr->diag_type;
+    key.base         = descr->base;
+    key.index_type_I = rocsparse::get_indextype<I>();
+    key.index_type_J = rocsparse::get_indextype<J>();
+
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse::analysis_fingerprint(handle, m, nnz, csr_row_ptr, csr_col_ind, key.hash));
+
+    const rocsparse_csrmv_info cached = handle->analysis_cache->find_csrmv(key);
+    if(cached != nullptr)
     {
+        // Same sparsity pattern, re-use the meta data of a previous analysis
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::destroy_csrmv_info(info->csrmv_info));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::create_csrmv_info(&info->csrmv_info));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::copy_csrmv_info(info->csrmv_info, cached));
+
+        info->csrmv_info->descr       = descr;
+        info->csrmv_info->csr_row_ptr = csr_row_ptr;
+        info->csrmv_info->csr_col_ind = csr_col_ind;
         return rocsparse_status_success;
     }
-    }
 
-    RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_invalid_value);
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::csrmv_analysis_dispatch(
+        handle, trans, alg, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info));
+
+    // Wait for the analysis to finish before copying its meta data
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
+    RETURN_IF_ROCSPARSE_ERROR(handle->analysis_cache->insert_csrmv(key, info->csrmv_info));
+
+    return rocsparse_status_success;
 }
 
 template <typename T, typename I, typename J, typename A, typename X, typename Y>
@@ -151,6 +319,58 @@ rocsparse_status rocsparse::csrmv_template(rocsparse_handle          handle,
         return rocsparse_status_success;
     }
 
+    // Estimate of the product for the kernel instrumentation
+    if(handle->instrumentation != nullptr)
+    {
+        const rocsparse_int xsize = (trans == rocsparse_operation_none) ? n : m;
+        const double        bytes = sizeof(I) * (m + 1.0) + (sizeof(J) + sizeof(A)) * double(nnz)
+                             + sizeof(X) * double(xsize) + sizeof(Y) * 2.0 * ysize;
+        rocsparse::instrumentation_estimate(handle, bytes, 2.0 * nnz + 2.0 * ysize);
+    }
+
+    // If the transposed structure has been gathered during analysis, A^T is processed
+    // row by row, without atomics
+    if(rocsparse::csrmv_gathers_transposed(alg, trans, descr) && info != nullptr
+       && info->csrmv_info != nullptr && info->csrmv_info->csrmvt_perm != nullptr
+       && (csr_row_ptr_begin + 1) == csr_row_ptr_end)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(
+                rocsparse::csrmvt_transposed_template_dispatch<T>(handle,
+                                                                  trans,
+                                                                  m,
+                                                                  n,
+                                                                  nnz,
+                                                                  alpha_device_host,
+                                                                  descr,
+                                                                  csr_val,
+                                                                  info->csrmv_info,
+                                                                  x,
+                                                                  beta_device_host,
+                                                                  y,
+                                                                  force_conj));
+        }
+        else
+        {
+            RETURN_IF_ROCSPARSE_ERROR(
+                rocsparse::csrmvt_transposed_template_dispatch<T>(handle,
+                                                                  trans,
+                                                                  m,
+                                                                  n,
+                                                                  nnz,
+                                                                  *alpha_device_host,
+                                                                  descr,
+                                                                  csr_val,
+                                                                  info->csrmv_info,
+                                                                  x,
+                                                                  *beta_device_host,
+                                                                  y,
+                                                                  force_conj));
+        }
+        return rocsparse_status_success;
+    }
+
     if(info == nullptr || info->csrmv_info == nullptr || trans != rocsparse_operation_none
        || (alg == rocsparse_csrmv_alg_lrb && descr->type == rocsparse_matrix_type_symmetric))
     {
@@ -233,6 +453,7 @@ rocsparse_status rocsparse::csrmv_template(rocsparse_handle          handle,
                 return rocsparse_status_success;
             }
             case rocsparse_csrmv_alg_adaptive:
+            case rocsparse_csrmv_alg_gather:
             {
                 RETURN_IF_ROCSPARSE_ERROR(
                     rocsparse::csrmv_adaptive_template_dispatch<T>(handle,
@@ -279,6 +500,7 @@ rocsparse_status rocsparse::csrmv_template(rocsparse_handle          handle,
             switch(alg)
             {
             case rocsparse_csrmv_alg_adaptive:
+            case rocsparse_csrmv_alg_gather:
             {
                 RETURN_IF_ROCSPARSE_ERROR(
                     rocsparse::csrmv_adaptive_template_dispatch<T>(handle,
@@ -500,6 +722,34 @@ rocsparse_status rocsparse_csrmv_impl(rocsparse_handle          handle,
     ROCSPARSE_CHECKARG_POINTER(12, beta_device_host);
     ROCSPARSE_CHECKARG_ARRAY(13, ysize, y);
 
+    rocsparse::log_bench(
+        handle,
+        "./rocsparse-bench -f csrmv -r",
+        rocsparse::bench_precision<T>(),
+        "--indextype",
+        rocsparse::bench_indextype<I, J>(),
+        "-m",
+        m,
+        "-n",
+        n,
+        "-z",
+        nnz,
+        "--alpha",
+        rocsparse::log_bench_real_value(LOG_BENCH_SCALAR_VALUE(handle, alpha_device_host)),
+        "--beta",
+        rocsparse::log_bench_real_value(LOG_BENCH_SCALAR_VALUE(handle, beta_device_host)),
+        "--transposeA",
+        rocsparse::bench_operation(trans),
+        "--indexbaseA",
+        static_cast<int>(descr->base),
+        "--matrix_type",
+        static_cast<int>(descr->type),
+        "--uplo",
+        (descr->fill_mode == rocsparse_fill_mode_lower) ? 'L' : 'U',
+        "--spmv_alg",
+        static_cast<int>((info != nullptr) ? rocsparse_spmv_alg_csr_adaptive
+                                           : rocsparse_spmv_alg_csr_stream));
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse::csrmv_template(
         handle,
         trans,
@@ -521,6 +771,86 @@ rocsparse_status rocsparse_csrmv_impl(rocsparse_handle          handle,
     return rocsparse_status_success;
 }
 
+template <typename T, typename I, typename J, typename A, typename X, typename Y>
+rocsparse_status rocsparse::csrmv_batch_template(rocsparse_handle          handle,
+                                                 J                         m,
+                                                 J                         n,
+                                                 I                         nnz,
+                                                 int64_t                   batch_count,
+                                                 const T*                  alpha_device_host,
+                                                 const rocsparse_mat_descr descr,
+                                                 const A*                  csr_val,
+                                                 const I*                  csr_row_ptr,
+                                                 const J*                  csr_col_ind,
+                                                 int64_t                   offsets_batch_stride,
+                                                 int64_t                   columns_batch_stride,
+                                                 int64_t                   values_batch_stride,
+                                                 const X*                  x,
+                                                 int64_t                   batch_stride_x,
+                                                 const T*                  beta_device_host,
+                                                 Y*                        y,
+                                                 int64_t                   batch_stride_y)
+{
+    // Quick return. Matrices without non-zero entries are still processed by the
+    // kernel, since y needs to be scaled by beta.
+    if(m == 0 || batch_count == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse::csrmvn_batch_template_dispatch<T>(handle,
+                                                         m,
+                                                         n,
+                                                         nnz,
+                                                         batch_count,
+                                                         alpha_device_host,
+                                                         descr,
+                                                         csr_val,
+                                                         csr_row_ptr,
+                                                         csr_col_ind,
+                                                         offsets_batch_stride,
+                                                         columns_batch_stride,
+                                                         values_batch_stride,
+                                                         x,
+                                                         batch_stride_x,
+                                                         beta_device_host,
+                                                         y,
+                                                         batch_stride_y));
+        return rocsparse_status_success;
+    }
+    else
+    {
+        if(*alpha_device_host == static_cast<T>(0) && *beta_device_host == static_cast<T>(1))
+        {
+            return rocsparse_status_success;
+        }
+
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse::csrmvn_batch_template_dispatch<T>(handle,
+                                                         m,
+                                                         n,
+                                                         nnz,
+                                                         batch_count,
+                                                         *alpha_device_host,
+                                                         descr,
+                                                         csr_val,
+                                                         csr_row_ptr,
+                                                         csr_col_ind,
+                                                         offsets_batch_stride,
+                                                         columns_batch_stride,
+                                                         values_batch_stride,
+                                                         x,
+                                                         batch_stride_x,
+                                                         *beta_device_host,
+                                                         y,
+                                                         batch_stride_y));
+        return rocsparse_status_success;
+    }
+}
+
 #define INSTANTIATE(TTYPE, ITYPE, JTYPE)                                                             \
     template rocsparse_status rocsparse::csrmv_analysis_template(rocsparse_handle          handle,   \
                                                                  rocsparse_operation       trans,    \
@@ -549,7 +879,26 @@ rocsparse_status rocsparse_csrmv_impl(rocsparse_handle          handle,
                                                         const TTYPE*              x,                 \
                                                         const TTYPE*              beta_device_host,  \
                                                         TTYPE*                    y,                 \
-                                                        bool                      force_conj);
+                                                        bool                      force_conj);       \
+    template rocsparse_status rocsparse::csrmv_batch_template(                                       \
+        rocsparse_handle          handle,                                                            \
+        JTYPE                     m,                                                                 \
+        JTYPE                     n,                                                                 \
+        ITYPE                     nnz,                                                               \
+        int64_t                   batch_count,                                                       \
+        const TTYPE*              alpha_device_host,                                                 \
+        const rocsparse_mat_descr descr,                                                             \
+        const TTYPE*              csr_val,                                                           \
+        const ITYPE*              csr_row_ptr,                                                       \
+        const JTYPE*              csr_col_ind,                                                       \
+        int64_t                   offsets_batch_stride,                                              \
+        int64_t                   columns_batch_stride,                                              \
+        int64_t                   values_batch_stride,                                               \
+        const TTYPE*              x,                                                                 \
+        int64_t                   batch_stride_x,                                                    \
+        const TTYPE*              beta_device_host,                                                  \
+        TTYPE*                    y,                                                                 \
+        int64_t                   batch_stride_y);
 
 INSTANTIATE(float, int32_t, int32_t);
 INSTANTIATE(float, int64_t, int32_t);
@@ -600,7 +949,26 @@ INSTANTIATE_MIXED_ANALYSIS(int64_t, int64_t, int8_t);
                                                         const XTYPE*              x,                 \
                                                         const TTYPE*              beta_device_host,  \
                                                         YTYPE*                    y,                 \
-                                                        bool                      force_conj);
+                                                        bool                      force_conj);       \
+    template rocsparse_status rocsparse::csrmv_batch_template(                                       \
+        rocsparse_handle          handle,                                                            \
+        JTYPE                     m,                                                                 \
+        JTYPE                     n,                                                                 \
+        ITYPE                     nnz,                                                               \
+        int64_t                   batch_count,                                                       \
+        const TTYPE*              alpha_device_host,                                                 \
+        const rocsparse_mat_descr descr,                                                             \
+        const ATYPE*              csr_val,                                                           \
+        const ITYPE*              csr_row_ptr,                                                       \
+        const JTYPE*              csr_col_ind,                                                       \
+        int64_t                   offsets_batch_stride,                                              \
+        int64_t                   columns_batch_stride,                                              \
+        int64_t                   values_batch_stride,                                               \
+        const XTYPE*              x,                                                                 \
+        int64_t                   batch_stride_x,                                                    \
+        const TTYPE*              beta_device_host,                                                  \
+        YTYPE*                    y,                                                                 \
+        int64_t                   batch_stride_y);
 
 INSTANTIATE_MIXED(int32_t, int32_t, int32_t, int8_t, int8_t, int32_t);
 INSTANTIATE_MIXED(int32_t, int64_t, int32_t, int8_t, int8_t, int32_t);
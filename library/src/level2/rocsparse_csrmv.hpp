@@ -28,11 +28,14 @@
 
 namespace rocsparse
 {
+    struct plus_times_semiring;
+
     typedef enum rocsparse_csrmv_alg_
     {
         rocsparse_csrmv_alg_stream = 0,
         rocsparse_csrmv_alg_adaptive,
-        rocsparse_csrmv_alg_lrb
+        rocsparse_csrmv_alg_lrb,
+        rocsparse_csrmv_alg_gather
     } rocsparse_csrmv_alg;
 
     template <typename I, typename J, typename A>
@@ -90,6 +93,49 @@ namespace rocsparse
                                                     bool                      force_conj);
 
     template <typename T, typename I, typename J, typename A, typename X, typename Y, typename U>
+    rocsparse_status
+        csrmvt_transposed_template_dispatch(rocsparse_handle          handle,
+                                            rocsparse_operation       trans,
+                                            J                         m,
+                                            J                         n,
+                                            I                         nnz,
+                                            U                         alpha_device_host,
+                                            const rocsparse_mat_descr descr,
+                                            const A*                  csr_val,
+                                            rocsparse_csrmv_info      csrmv_info,
+                                            const X*                  x,
+                                            U                         beta_device_host,
+                                            Y*                        y,
+                                            bool                      force_conj);
+
+    template <typename T, typename I, typename J, typename A, typename X, typename Y, typename U>
+    rocsparse_status csrmvn_batch_template_dispatch(rocsparse_handle          handle,
+                                                    J                         m,
+                                                    J                         n,
+                                                    I                         nnz,
+                                                    int64_t                   batch_count,
+                                                    U                         alpha_device_host,
+                                                    const rocsparse_mat_descr descr,
+                                                    const A*                  csr_val,
+                                                    const I*                  csr_row_ptr,
+                                                    const J*                  csr_col_ind,
+                                                    int64_t                   offsets_batch_stride,
+                                                    int64_t                   columns_batch_stride,
+                                                    int64_t                   values_batch_stride,
+                                                    const X*                  x,
+                                                    int64_t                   batch_stride_x,
+                                                    U                         beta_device_host,
+                                                    Y*                        y,
+                                                    int64_t                   batch_stride_y);
+
+    template <typename T,
+              typename I,
+              typename J,
+              typename A,
+              typename X,
+              typename Y,
+              typename U,
+              typename S = rocsparse::plus_times_semiring>
     rocsparse_status csrmv_adaptive_template_dispatch(rocsparse_handle          handle,
                                                       rocsparse_operation       trans,
                                                       J                         m,
@@ -106,7 +152,14 @@ namespace rocsparse
                                                       Y*                        y,
                                                       bool                      force_conj);
 
-    template <typename T, typename I, typename J, typename A, typename X, typename Y, typename U>
+    template <typename T,
+              typename I,
+              typename J,
+              typename A,
+              typename X,
+              typename Y,
+              typename U,
+              typename S = rocsparse::plus_times_semiring>
     rocsparse_status csrmv_lrb_template_dispatch(rocsparse_handle          handle,
                                                  rocsparse_operation       trans,
                                                  J                         m,
@@ -141,4 +194,24 @@ namespace rocsparse
                                     const T*                  beta,
                                     Y*                        y,
                                     bool                      force_conj);
+
+    template <typename T, typename I, typename J, typename A, typename X, typename Y>
+    rocsparse_status csrmv_batch_template(rocsparse_handle          handle,
+                                          J                         m,
+                                          J                         n,
+                                          I                         nnz,
+                                          int64_t                   batch_count,
+                                          const T*                  alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const A*                  csr_val,
+                                          const I*                  csr_row_ptr,
+                                          const J*                  csr_col_ind,
+                                          int64_t                   offsets_batch_stride,
+                                          int64_t                   columns_batch_stride,
+                                          int64_t                   values_batch_stride,
+                                          const X*                  x,
+                                          int64_t                   batch_stride_x,
+                                          const T*                  beta,
+                                          Y*                        y,
+                                          int64_t                   batch_stride_y);
 }
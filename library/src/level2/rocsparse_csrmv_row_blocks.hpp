@@ -0,0 +1,418 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2018-2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <exception>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+//
+// Host partitioning of the CSR-Adaptive row blocks. This is plain host code, such
+// that the partitioning can be verified without a device.
+//
+namespace rocsparse
+{
+    static constexpr int csrmv_adaptive_block_size         = 1024;
+    static constexpr int csrmv_adaptive_block_multiplier   = 3;
+    static constexpr int csrmv_adaptive_rows_for_vector    = 1;
+    static constexpr int csrmv_adaptive_wg_size            = 256;
+    static constexpr int csrmv_adaptive_min_rows_per_chunk = 1 << 16;
+
+    inline unsigned int flp2(unsigned int x)
+    {
+        x |= (x >> 1);
+        x |= (x >> 2);
+        x |= (x >> 4);
+        x |= (x >> 8);
+        x |= (x >> 16);
+        return x - (x >> 1);
+    }
+
+    // Short rows in CSR-Adaptive are batched together into a single row block.
+    // If there are a relatively small number of these, then we choose to do
+    // a horizontal reduction (groups of threads all reduce the same row).
+    // If there are many threads (e.g. more threads than the maximum size
+    // of our workgroup) then we choose to have each thread serially reduce
+    // the row.
+    // This function calculates the number of threads that could team up
+    // to reduce these groups of rows. For instance, if you have a
+    // workgroup size of 256 and 4 rows, you could have 64 threads
+    // working on each row. If you have 5 rows, only 32 threads could
+    // reliably work on each row because our reduction assumes power-of-2.
+    inline unsigned long long numThreadsForReduction(unsigned long long num_rows)
+    {
+#if defined(__INTEL_COMPILER)
+        return csrmv_adaptive_wg_size >> (_bit_scan_reverse(num_rows - 1) + 1);
+#elif(defined(__clang__) && __has_builtin(__builtin_clz)) \
+    || !defined(__clang) && defined(__GNUG__)             \
+           && ((__GNUC__ * 10000 + __GNUC_MINOR__ * 100 + __GNUC_PATCHLEVEL__) > 30202)
+        return (csrmv_adaptive_wg_size >> (8 * sizeof(int) - __builtin_clz(num_rows - 1)));
+#elif defined(_MSC_VER) && (_MSC_VER >= 1400)
+        unsigned long long bit_returned;
+        _BitScanReverse(&bit_returned, (num_rows - 1));
+        return csrmv_adaptive_wg_size >> (bit_returned + 1);
+#else
+        return flp2(csrmv_adaptive_wg_size / num_rows);
+#endif
+    }
+
+    // State of the row block partitioning after a given row has been visited.
+    // The partitioning is a deterministic function of this state and the row
+    // pointer array, so two runs that reach the same state produce the same
+    // row blocks from that point on.
+    template <typename I>
+    struct row_blocks_state
+    {
+        I i;
+        I last_i;
+        I sum;
+        I consecutive_long_rows;
+
+        bool operator==(const row_blocks_state& other) const
+        {
+            return i == other.i && last_i == other.last_i && sum == other.sum
+                   && consecutive_long_rows == other.consecutive_long_rows;
+        }
+    };
+
+    // A single row block boundary. wg_prev holds the bits that have to be
+    // merged into the workgroup data of the preceding row block.
+    template <typename I, typename J>
+    struct row_blocks_entry
+    {
+        I row_block;
+        J wg_id;
+        J wg_prev;
+    };
+
+    // Row block boundaries computed for a contiguous range of rows, together with
+    // the states reached right after each boundary has been emitted.
+    template <typename I, typename J>
+    struct row_blocks_chunk
+    {
+        I                                   begin;
+        I                                   end;
+        std::vector<row_blocks_entry<I, J>> entries;
+        std::vector<size_t>                 checkpoint_pos;
+        std::vector<row_blocks_state<I>>    checkpoints;
+        row_blocks_state<I>                 final_state;
+    };
+
+    template <typename I, typename J>
+    inline void row_blocks_emit(std::vector<row_blocks_entry<I, J>>& entries,
+                                       I                                    row_block,
+                                       I                                    num_rows)
+    {
+        // If this row fits into CSR-Stream, calculate how many rows
+        // can be used to do a parallel reduction.
+        // Fill in the low-order bits with the numThreadsForRed
+        const J wg_prev = (num_rows > static_cast<I>(csrmv_adaptive_rows_for_vector))
+                              ? static_cast<J>(numThreadsForReduction(num_rows))
+                              : static_cast<J>(0);
+        entries.push_back({row_block, static_cast<J>(0), wg_prev});
+    }
+
+    // Visits row s.i and advances the state. Returns true if at least one row block
+    // boundary has been emitted.
+    template <typename I, typename J>
+    inline bool row_blocks_step(row_blocks_state<I>&                 s,
+                                       std::vector<row_blocks_entry<I, J>>& entries,
+                                       const I*                             rowDelimiters)
+    {
+        const size_t size = entries.size();
+
+        I i          = s.i;
+        I row_length = (rowDelimiters[i] - rowDelimiters[i - 1]);
+        s.sum += row_length;
+
+        // The following section of code calculates whether you're moving between
+        // a series of "short" rows and a series of "long" rows.
+        // This is because the reduction in CSR-Adaptive likes things to be
+        // roughly the same length. Long rows can be reduced horizontally.
+        // Short rows can be reduced one-thread-per-row. Try not to mix them.
+        if(row_length > 128)
+        {
+            ++s.consecutive_long_rows;
+        }
+        else if(s.consecutive_long_rows > 0)
+        {
+            // If it turns out we WERE in a long-row region, cut if off now.
+            if(row_length < 32) // Now we're in a short-row region
+            {
+                s.consecutive_long_rows = -1;
+            }
+            else
+            {
+                s.consecutive_long_rows++;
+            }
+        }
+
+        // If you just entered into a "long" row from a series of short rows,
+        // then we need to make sure we cut off those short rows. Put them in
+        // their own workgroup.
+        if(s.consecutive_long_rows == 1)
+        {
+            // Assuming there *was* a previous workgroup. If not, nothing to do here.
+            if(i - s.last_i > 1)
+            {
+                row_blocks_emit<I, J>(entries, i - 1, (i - 1) - s.last_i);
+
+                s.last_i = i - 1;
+                s.sum    = row_length;
+            }
+        }
+        else if(s.consecutive_long_rows == -1)
+        {
+            // We see the first short row after some long ones that
+            // didn't previously fill up a row block.
+            row_blocks_emit<I, J>(entries, i - 1, (i - 1) - s.last_i);
+
+            s.last_i                = i - 1;
+            s.sum                   = row_length;
+            s.consecutive_long_rows = 0;
+        }
+
+        // Now, what's up with this row? What did it do?
+
+        // exactly one row results in non-zero elements to be greater than blockSize
+        // This is csr-vector case;
+        if((i - s.last_i == 1) && s.sum > static_cast<I>(csrmv_adaptive_block_size))
+        {
+            I numWGReq = static_cast<I>(
+                std::ceil(static_cast<double>(row_length)
+                          / (csrmv_adaptive_block_multiplier * csrmv_adaptive_block_size)));
+
+            // Check to ensure #workgroups can fit in 32 bits, if not
+            // then the last workgroup will do all the remaining work
+            // Note: Maximum number of workgroups is 2^31-1 = 2147483647
+            static constexpr I maxNumberOfWorkgroups = static_cast<I>(INT_MAX);
+            numWGReq = (numWGReq < maxNumberOfWorkgroups) ? numWGReq : maxNumberOfWorkgroups;
+
+            for(I w = 1; w < numWGReq; ++w)
+            {
+                entries.push_back({i - 1, static_cast<J>(w), static_cast<J>(0)});
+            }
+
+            entries.push_back({i, static_cast<J>(0), static_cast<J>(0)});
+
+            s.last_i                = i;
+            s.sum                   = 0;
+            s.consecutive_long_rows = 0;
+        }
+        // more than one row results in non-zero elements to be greater than blockSize
+        // This is csr-stream case; wgIds holds number of parallel reduction threads
+        else if((i - s.last_i > 1) && s.sum > static_cast<I>(csrmv_adaptive_block_size))
+        {
+            // This row won't fit, so back off one.
+            --i;
+
+            row_blocks_emit<I, J>(entries, i, i - s.last_i);
+
+            s.last_i                = i;
+            s.sum                   = 0;
+            s.consecutive_long_rows = 0;
+        }
+        // This is csr-stream case; wgIds holds number of parallel reduction threads
+        else if(s.sum == static_cast<I>(csrmv_adaptive_block_size))
+        {
+            row_blocks_emit<I, J>(entries, i, i - s.last_i);
+
+            s.last_i                = i;
+            s.sum                   = 0;
+            s.consecutive_long_rows = 0;
+        }
+
+        s.i = i + 1;
+
+        return entries.size() != size;
+    }
+
+    // Partitions the rows [chunk.begin, chunk.end] starting from state s. If spec is
+    // given, the partitioning stops as soon as a state recorded by spec is reached and
+    // the remaining row blocks are taken from spec.
+    template <typename I, typename J>
+    inline void row_blocks_run(row_blocks_chunk<I, J>&       chunk,
+                               row_blocks_state<I>           s,
+                               const I*                      rowDelimiters,
+                               const row_blocks_chunk<I, J>* spec)
+    {
+        size_t k = 0;
+
+        while(s.i <= chunk.end)
+        {
+            if(!row_blocks_step<I, J>(s, chunk.entries, rowDelimiters))
+            {
+                continue;
+            }
+
+            if(spec == nullptr)
+            {
+                chunk.checkpoint_pos.push_back(chunk.entries.size());
+                chunk.checkpoints.push_back(s);
+                continue;
+            }
+
+            // Checkpoints are ordered by row, skip the ones we already passed
+            while(k < spec->checkpoints.size() && spec->checkpoints[k].i < s.i)
+            {
+                ++k;
+            }
+
+            for(size_t c = k; c < spec->checkpoints.size() && spec->checkpoints[c].i == s.i; ++c)
+            {
+                if(spec->checkpoints[c] == s)
+                {
+                    // Both runs agree from here on
+                    chunk.entries.insert(chunk.entries.end(),
+                                         spec->entries.begin() + spec->checkpoint_pos[c],
+                                         spec->entries.end());
+                    chunk.final_state = spec->final_state;
+                    return;
+                }
+            }
+        }
+
+        chunk.final_state = s;
+    }
+
+    // Computes the CSR-Adaptive row blocks. The rows are split into chunks that are
+    // partitioned concurrently, each starting from a freshly reset state. Chunks are
+    // then stitched together in order: a chunk is re-partitioned from the true state
+    // of its predecessor until both runs reach the same state, after which the
+    // concurrently computed row blocks are reused. This yields exactly the same row
+    // blocks as a sequential pass over all rows, i.e. with max_chunks equal to 1.
+    template <typename I, typename J>
+    inline void ComputeRowBlocks(std::vector<I>& rowBlocks,
+                                 std::vector<J>& wgIds,
+                                 const I*        rowDelimiters,
+                                 I               nRows,
+                                 I               max_chunks,
+                                 I min_rows_per_chunk = csrmv_adaptive_min_rows_per_chunk)
+    {
+        max_chunks         = std::max(max_chunks, static_cast<I>(1));
+        min_rows_per_chunk = std::max(min_rows_per_chunk, static_cast<I>(1));
+
+        const I nchunks = std::min(max_chunks, (nRows - 1) / min_rows_per_chunk + 1);
+
+        std::vector<row_blocks_chunk<I, J>> spec(nchunks);
+
+        for(I c = 0; c < nchunks; ++c)
+        {
+            spec[c].begin = static_cast<I>(1 + (static_cast<int64_t>(nRows) * c) / nchunks);
+            spec[c].end   = static_cast<I>((static_cast<int64_t>(nRows) * (c + 1)) / nchunks);
+        }
+
+        // Partition all chunks concurrently, the first chunk starts from the true state
+        std::vector<std::exception_ptr> errors(nchunks);
+
+        auto partition = [&](I c) {
+            try
+            {
+                row_blocks_run<I, J>(
+                    spec[c], {spec[c].begin, spec[c].begin - 1, 0, 0}, rowDelimiters, nullptr);
+            }
+            catch(...)
+            {
+                errors[c] = std::current_exception();
+            }
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(nchunks - 1);
+
+        for(I c = 1; c < nchunks; ++c)
+        {
+            try
+            {
+                threads.emplace_back(partition, c);
+            }
+            catch(const std::system_error&)
+            {
+                // Could not spawn another thread, partition this chunk here
+                partition(c);
+            }
+        }
+
+        partition(0);
+
+        for(auto& t : threads)
+        {
+            t.join();
+        }
+
+        for(const auto& e : errors)
+        {
+            if(e != nullptr)
+            {
+                std::rethrow_exception(e);
+            }
+        }
+
+        // Stitch chunks together
+        std::vector<row_blocks_entry<I, J>> entries;
+        entries.push_back({0, 0, 0});
+        entries.insert(entries.end(), spec[0].entries.begin(), spec[0].entries.end());
+
+        row_blocks_state<I> s = spec[0].final_state;
+
+        for(I c = 1; c < nchunks; ++c)
+        {
+            row_blocks_chunk<I, J> chunk;
+            chunk.begin = spec[c].begin;
+            chunk.end   = spec[c].end;
+
+            row_blocks_run<I, J>(chunk, s, rowDelimiters, &spec[c]);
+
+            entries.insert(entries.end(), chunk.entries.begin(), chunk.entries.end());
+            s = chunk.final_state;
+
+            std::vector<row_blocks_entry<I, J>>().swap(spec[c].entries);
+        }
+
+        // If we didn't fill a row block with the last row, make sure we don't lose it.
+        if(entries.back().row_block != nRows)
+        {
+            const J wg_prev = ((nRows - s.last_i) > static_cast<I>(csrmv_adaptive_rows_for_vector))
+                                  ? static_cast<J>(numThreadsForReduction(s.i - s.last_i))
+                                  : static_cast<J>(0);
+            entries.push_back({nRows, 0, wg_prev});
+        }
+
+        const size_t size = entries.size();
+
+        rowBlocks.resize(size);
+        wgIds.resize(size);
+
+        for(size_t k = 0; k < size; ++k)
+        {
+            rowBlocks[k] = entries[k].row_block;
+            wgIds[k]     = entries[k].wg_id | ((k + 1 < size) ? entries[k + 1].wg_prev : 0);
+        }
+    }
+}
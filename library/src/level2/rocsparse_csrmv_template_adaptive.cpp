@@ -29,53 +29,21 @@
 
 #include "csrmv_device.h"
 #include "csrmv_symm_device.h"
-#include <vector>
+#include "rocsparse_csrmv_row_blocks.hpp"
 
 #define BLOCK_SIZE 1024
 #define BLOCK_MULTIPLIER 3
 #define ROWS_FOR_VECTOR 1
 #define WG_SIZE 256
 
+static_assert(BLOCK_SIZE == rocsparse::csrmv_adaptive_block_size
+                  && BLOCK_MULTIPLIER == rocsparse::csrmv_adaptive_block_multiplier
+                  && ROWS_FOR_VECTOR == rocsparse::csrmv_adaptive_rows_for_vector
+                  && WG_SIZE == rocsparse::csrmv_adaptive_wg_size,
+              "row block partitioning does not match the adaptive kernels");
+
 namespace rocsparse
 {
-    __attribute__((unused)) static unsigned int flp2(unsigned int x)
-    {
-        x |= (x >> 1);
-        x |= (x >> 2);
-        x |= (x >> 4);
-        x |= (x >> 8);
-        x |= (x >> 16);
-        return x - (x >> 1);
-    }
-
-    // Short rows in CSR-Adaptive are batched together into a single row block.
-    // If there are a relatively small number of these, then we choose to do
-    // a horizontal reduction (groups of threads all reduce the same row).
-    // If there are many threads (e.g. more threads than the maximum size
-    // of our workgroup) then we choose to have each thread serially reduce
-    // the row.
-    // This function calculates the number of threads that could team up
-    // to reduce these groups of rows. For instance, if you have a
-    // workgroup size of 256 and 4 rows, you could have 64 threads
-    // working on each row. If you have 5 rows, only 32 threads could
-    // reliably work on each row because our reduction assumes power-of-2.
-    static unsigned long long numThreadsForReduction(unsigned long long num_rows)
-    {
-#if defined(__INTEL_COMPILER)
-        return WG_SIZE >> (_bit_scan_reverse(num_rows - 1) + 1);
-#elif(defined(__clang__) && __has_builtin(__builtin_clz)) \
-    || !defined(__clang) && defined(__GNUG__)             \
-           && ((__GNUC__ * 10000 + __GNUC_MINOR__ * 100 + __GNUC_PATCHLEVEL__) > 30202)
-        return (WG_SIZE >> (8 * sizeof(int) - __builtin_clz(num_rows - 1)));
-#elif defined(_MSC_VER) && (_MSC_VER >= 1400)
-        unsigned long long bit_returned;
-        _BitScanReverse(&bit_returned, (num_rows - 1));
-        return WG_SIZE >> (bit_returned + 1);
-#else
-        return flp2(WG_SIZE / num_rows);
-#endif
-    }
-
     template <typename I>
     static inline I maxRowsInABlock(const I* rowBlocks, size_t rowBlockSize)
     {
@@ -90,221 +58,6 @@ namespace rocsparse
         }
         return max;
     }
-
-    template <typename I, typename J>
-    static inline void ComputeRowBlocks(I*       rowBlocks,
-                                        J*       wgIds,
-                                        size_t&  rowBlockSize,
-                                        const I* rowDelimiters,
-                                        I        nRows,
-                                        bool     allocate_row_blocks = true)
-    {
-        I* rowBlocksBase;
-
-        // Start at one because of rowBlock[0]
-        I total_row_blocks = 1;
-
-        if(allocate_row_blocks)
-        {
-            rowBlocksBase = rowBlocks;
-            *rowBlocks    = 0;
-            *wgIds        = 0;
-            ++rowBlocks;
-            ++wgIds;
-        }
-
-        I sum = 0;
-        I i;
-        I last_i = 0;
-
-        I consecutive_long_rows = 0;
-        for(i = 1; i <= nRows; ++i)
-        {
-            I row_length = (rowDelimiters[i] - rowDelimiters[i - 1]);
-            sum += row_length;
-
-            // The following section of code calculates whether you're moving between
-            // a series of "short" rows and a series of "long" rows.
-            // This is because the reduction in CSR-Adaptive likes things to be
-            // roughly the same length. Long rows can be reduced horizontally.
-            // Short rows can be reduced one-thread-per-row. Try not to mix them.
-            if(row_length > 128)
-            {
-                ++consecutive_long_rows;
-            }
-            else if(consecutive_long_rows > 0)
-            {
-                // If it turns out we WERE in a long-row region, cut if off now.
-                if(row_length < 32) // Now we're in a short-row region
-                {
-                    consecutive_long_rows = -1;
-                }
-                else
-                {
-                    consecutive_long_rows++;
-                }
-            }
-
-            // If you just entered into a "long" row from a series of short rows,
-            // then we need to make sure we cut off those short rows. Put them in
-            // their own workgroup.
-            if(consecutive_long_rows == 1)
-            {
-                // Assuming there *was* a previous workgroup. If not, nothing to do here.
-                if(i - last_i > 1)
-                {
-                    if(allocate_row_blocks)
-                    {
-                        *rowBlocks = i - 1;
-
-                        // If this row fits into CSR-Stream, calculate how many rows
-                        // can be used to do a parallel reduction.
-                        // Fill in the low-order bits with the numThreadsForRed
-                        if(((i - 1) - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
-                        {
-                            *(wgIds - 1) |= numThreadsForReduction((i - 1) - last_i);
-                        }
-
-                        ++rowBlocks;
-                        ++wgIds;
-                    }
-
-                    ++total_row_blocks;
-                    last_i = i - 1;
-                    sum    = row_length;
-                }
-            }
-            else if(consecutive_long_rows == -1)
-            {
-                // We see the first short row after some long ones that
-                // didn't previously fill up a row block.
-                if(allocate_row_blocks)
-                {
-                    *rowBlocks = i - 1;
-                    if(((i - 1) - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
-                    {
-                        *(wgIds - 1) |= numThreadsForReduction((i - 1) - last_i);
-                    }
-
-                    ++rowBlocks;
-                    ++wgIds;
-                }
-
-                ++total_row_blocks;
-                last_i                = i - 1;
-                sum                   = row_length;
-                consecutive_long_rows = 0;
-            }
-
-            // Now, what's up with this row? What did it do?
-
-            // exactly one row results in non-zero elements to be greater than blockSize
-            // This is csr-vector case;
-            if((i - last_i == 1) && sum > static_cast<I>(BLOCK_SIZE))
-            {
-                I numWGReq = static_cast<I>(
-                    std::ceil(static_cast<double>(row_length) / (BLOCK_MULTIPLIER * BLOCK_SIZE)));
-
-                // Check to ensure #workgroups can fit in 32 bits, if not
-                // then the last workgroup will do all the remaining work
-                // Note: Maximum number of workgroups is 2^31-1 = 2147483647
-                static constexpr I maxNumberOfWorkgroups = static_cast<I>(INT_MAX);
-                numWGReq = (numWGReq < maxNumberOfWorkgroups) ? numWGReq : maxNumberOfWorkgroups;
-
-                if(allocate_row_blocks)
-                {
-                    for(I w = 1; w < numWGReq; ++w)
-                    {
-                        *rowBlocks = (i - 1);
-                        *wgIds |= static_cast<J>(w);
-
-                        ++rowBlocks;
-                        ++wgIds;
-                    }
-
-                    *rowBlocks = i;
-                    ++rowBlocks;
-                    ++wgIds;
-                }
-
-                total_row_blocks += numWGReq;
-                last_i                = i;
-                sum                   = 0;
-                consecutive_long_rows = 0;
-            }
-            // more than one row results in non-zero elements to be greater than blockSize
-            // This is csr-stream case; wgIds holds number of parallel reduction threads
-            else if((i - last_i > 1) && sum > static_cast<I>(BLOCK_SIZE))
-            {
-                // This row won't fit, so back off one.
-                --i;
-
-                if(allocate_row_blocks)
-                {
-                    *rowBlocks = i;
-                    if((i - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
-                    {
-                        *(wgIds - 1) |= numThreadsForReduction(i - last_i);
-                    }
-
-                    ++rowBlocks;
-                    ++wgIds;
-                }
-
-                ++total_row_blocks;
-                last_i                = i;
-                sum                   = 0;
-                consecutive_long_rows = 0;
-            }
-            // This is csr-stream case; wgIds holds number of parallel reduction threads
-            else if(sum == static_cast<I>(BLOCK_SIZE))
-            {
-                if(allocate_row_blocks)
-                {
-                    *rowBlocks = i;
-                    if((i - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
-                    {
-                        *(wgIds - 1) |= numThreadsForReduction(i - last_i);
-                    }
-
-                    ++rowBlocks;
-                    ++wgIds;
-                }
-
-                ++total_row_blocks;
-                last_i                = i;
-                sum                   = 0;
-                consecutive_long_rows = 0;
-            }
-        }
-
-        // If we didn't fill a row block with the last row, make sure we don't lose it.
-        if(allocate_row_blocks && *(rowBlocks - 1) != nRows)
-        {
-            *rowBlocks = nRows;
-            if((nRows - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
-            {
-                *(wgIds - 1) |= numThreadsForReduction(i - last_i);
-            }
-
-            ++rowBlocks;
-        }
-
-        ++total_row_blocks;
-
-        if(allocate_row_blocks)
-        {
-            size_t dist = std::distance(rowBlocksBase, rowBlocks);
-
-            assert((dist) <= rowBlockSize);
-            // Update the size of rowBlocks to reflect the actual amount of memory used
-            rowBlockSize = dist;
-        }
-        else
-        {
-            rowBlockSize = total_row_blocks;
-        }
-    }
 }
 
 template <typename I, typename J, typename A>
@@ -320,6 +73,9 @@ rocsparse_status
                                                          const J*                  csr_col_ind,
                                                          rocsparse_mat_info        info)
 {
+    // The row pointers are read back on the host to compute the row blocks
+    RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
     // Clear csrmv info
     RETURN_IF_ROCSPARSE_ERROR(rocsparse::destroy_csrmv_info(info->csrmv_info));
 
@@ -340,17 +96,17 @@ rocsparse_status
     // Wait for host transfer to finish
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
-    // Determine row blocks array size
-    ComputeRowBlocks<I, J>(
-        (I*)NULL, (J*)NULL, info->csrmv_info->adaptive.size, hptr.data(), m, false);
+    // Create row blocks and workgroup data structures
+    std::vector<I> row_blocks;
+    std::vector<J> wg_ids;
 
-    // Create row blocks, workgroup flag, and workgroup data structures
-    std::vector<I>            row_blocks(info->csrmv_info->adaptive.size, 0);
-    std::vector<unsigned int> wg_flags(info->csrmv_info->adaptive.size, 0);
-    std::vector<J>            wg_ids(info->csrmv_info->adaptive.size, 0);
+    rocsparse::ComputeRowBlocks<I, J>(
+        row_blocks, wg_ids, hptr.data(), m, static_cast<I>(std::thread::hardware_concurrency()));
 
-    ComputeRowBlocks<I, J>(
-        row_blocks.data(), wg_ids.data(), info->csrmv_info->adaptive.size, hptr.data(), m, true);
+    // Host row pointer copy is not required anymore
+    std::vector<I>().swap(hptr);
+
+    info->csrmv_info->adaptive.size = row_blocks.size();
 
     if(descr->type == rocsparse_matrix_type_symmetric)
     {
@@ -378,10 +134,9 @@ rocsparse_status
                                            sizeof(I) * info->csrmv_info->adaptive.size,
                                            hipMemcpyHostToDevice,
                                            stream));
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->csrmv_info->adaptive.wg_flags,
-                                           wg_flags.data(),
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(info->csrmv_info->adaptive.wg_flags,
+                                           0,
                                            sizeof(unsigned int) * info->csrmv_info->adaptive.size,
-                                           hipMemcpyHostToDevice,
                                            stream));
         RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->csrmv_info->adaptive.wg_ids,
                                            wg_ids.data(),
@@ -410,7 +165,7 @@ rocsparse_status
 
 namespace rocsparse
 {
-    template <typename I, typename J, typename A, typename X, typename Y, typename U>
+    template <typename S, typename I, typename J, typename A, typename X, typename Y, typename U>
     ROCSPARSE_KERNEL(WG_SIZE)
     void csrmvn_adaptive_kernel(bool conj,
                                 I    nnz,
@@ -428,10 +183,10 @@ namespace rocsparse
     {
         auto alpha = rocsparse::load_scalar_device_host(alpha_device_host);
         auto beta  = rocsparse::load_scalar_device_host(beta_device_host);
-        if(alpha != 0 || beta != 1)
+        if(!S::is_noop(alpha, beta))
         {
             rocsparse::
-                csrmvn_adaptive_device<BLOCK_SIZE, BLOCK_MULTIPLIER, ROWS_FOR_VECTOR, WG_SIZE>(
+                csrmvn_adaptive_device<BLOCK_SIZE, BLOCK_MULTIPLIER, ROWS_FOR_VECTOR, WG_SIZE, S>(
                     conj,
                     nnz,
                     row_blocks,
@@ -512,7 +267,14 @@ void csrmvn_symm_large_adaptive_kernel(bool conj,
     }
 }
 
-template <typename T, typename I, typename J, typename A, typename X, typename Y, typename U>
+template <typename T,
+          typename I,
+          typename J,
+          typename A,
+          typename X,
+          typename Y,
+          typename U,
+          typename S>
 rocsparse_status rocsparse::csrmv_adaptive_template_dispatch(rocsparse_handle    handle,
                                                              rocsparse_operation trans,
                                                              J                   m,
@@ -562,7 +324,7 @@ rocsparse_status rocsparse::csrmv_adaptive_template_dispatch(rocsparse_handle
         // Run different csrmv kernels
         dim3 csrmvn_blocks((info->adaptive.size) - 1);
         dim3 csrmvn_threads(WG_SIZE);
-        RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::csrmvn_adaptive_kernel),
+        RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::csrmvn_adaptive_kernel<S>),
                                            csrmvn_blocks,
                                            csrmvn_threads,
                                            0,
@@ -583,6 +345,12 @@ rocsparse_status rocsparse::csrmv_adaptive_template_dispatch(rocsparse_handle
     }
     else if(descr->type == rocsparse_matrix_type_symmetric)
     {
+        // Symmetric storage is only supported with conventional arithmetic
+        if(!std::is_same<S, rocsparse::plus_times_semiring>())
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_not_implemented);
+        }
+
         RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::scale_array<256>),
                                            dim3((m - 1) / 256 + 1),
                                            dim3(256),
@@ -1043,3 +811,51 @@ INSTANTIATE(rocsparse_double_complex,
             const rocsparse_double_complex*);
 
 #undef INSTANTIATE
+
+#define INSTANTIATE(TTYPE, ITYPE, JTYPE, UTYPE, STYPE)                            \
+    template rocsparse_status rocsparse::csrmv_adaptive_template_dispatch<TTYPE,  \
+                                                                          ITYPE,  \
+                                                                          JTYPE,  \
+                                                                          TTYPE,  \
+                                                                          TTYPE,  \
+                                                                          TTYPE,  \
+                                                                          UTYPE,  \
+                                                                          STYPE>( \
+        rocsparse_handle          handle,                                         \
+        rocsparse_operation       trans,                                          \
+        JTYPE                     m,                                              \
+        JTYPE                     n,                                              \
+        ITYPE                     nnz,                                            \
+        UTYPE                     alpha_device_host,                              \
+        const rocsparse_mat_descr descr,                                          \
+        const TTYPE*              csr_val,                                        \
+        const ITYPE*              csr_row_ptr,                                    \
+        const JTYPE*              csr_col_ind,                                    \
+        rocsparse_csrmv_info      info,                                           \
+        const TTYPE*              x,                                              \
+        UTYPE                     beta_device_host,                               \
+        TTYPE*                    y,                                              \
+        bool                      force_conj);
+
+#define INSTANTIATE_SEMIRINGS(TTYPE, ITYPE, JTYPE, UTYPE)                   \
+    INSTANTIATE(TTYPE, ITYPE, JTYPE, UTYPE, rocsparse::min_plus_semiring);  \
+    INSTANTIATE(TTYPE, ITYPE, JTYPE, UTYPE, rocsparse::max_times_semiring); \
+    INSTANTIATE(TTYPE, ITYPE, JTYPE, UTYPE, rocsparse::max_min_semiring);   \
+    INSTANTIATE(TTYPE, ITYPE, JTYPE, UTYPE, rocsparse::or_and_semiring)
+
+// Semirings
+INSTANTIATE_SEMIRINGS(float, int32_t, int32_t, float);
+INSTANTIATE_SEMIRINGS(float, int64_t, int32_t, float);
+INSTANTIATE_SEMIRINGS(float, int64_t, int64_t, float);
+INSTANTIATE_SEMIRINGS(double, int32_t, int32_t, double);
+INSTANTIATE_SEMIRINGS(double, int64_t, int32_t, double);
+INSTANTIATE_SEMIRINGS(double, int64_t, int64_t, double);
+INSTANTIATE_SEMIRINGS(float, int32_t, int32_t, const float*);
+INSTANTIATE_SEMIRINGS(float, int64_t, int32_t, const float*);
+INSTANTIATE_SEMIRINGS(float, int64_t, int64_t, const float*);
+INSTANTIATE_SEMIRINGS(double, int32_t, int32_t, const double*);
+INSTANTIATE_SEMIRINGS(double, int64_t, int32_t, const double*);
+INSTANTIATE_SEMIRINGS(double, int64_t, int64_t, const double*);
+
+#undef INSTANTIATE_SEMIRINGS
+#undef INSTANTIATE
@@ -49,6 +49,9 @@ rocsparse_status rocsparse::csrmv_analysis_lrb_template_dispatch(rocsparse_handl
                                                                  const J*           csr_col_ind,
                                                                  rocsparse_mat_info info)
 {
+    // The bin sizes are read back on the host
+    RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
     // Clear csrmv info
     RETURN_IF_ROCSPARSE_ERROR(rocsparse::destroy_csrmv_info(info->csrmv_info));
 
@@ -223,7 +226,7 @@ rocsparse_status rocsparse::csrmv_analysis_lrb_template_dispatch(rocsparse_handl
 
 namespace rocsparse
 {
-    template <typename I, typename J, typename A, typename X, typename Y, typename U>
+    template <typename S, typename I, typename J, typename A, typename X, typename Y, typename U>
     ROCSPARSE_KERNEL(WG_SIZE)
     void csrmvn_lrb_short_rows_kernel(bool conj,
                                       I    nnz,
@@ -241,25 +244,25 @@ namespace rocsparse
     {
         auto alpha = rocsparse::load_scalar_device_host(alpha_device_host);
         auto beta  = rocsparse::load_scalar_device_host(beta_device_host);
-        if(alpha != 0 || beta != 1)
+        if(!S::is_noop(alpha, beta))
         {
-            rocsparse::csrmvn_lrb_short_rows_device<WG_SIZE>(conj,
-                                                             nnz,
-                                                             rows_bins,
-                                                             n_rows_bins,
-                                                             bin_id,
-                                                             alpha,
-                                                             csr_row_ptr,
-                                                             csr_col_ind,
-                                                             csr_val,
-                                                             x,
-                                                             beta,
-                                                             y,
-                                                             idx_base);
+            rocsparse::csrmvn_lrb_short_rows_device<WG_SIZE, S>(conj,
+                                                                nnz,
+                                                                rows_bins,
+                                                                n_rows_bins,
+                                                                bin_id,
+                                                                alpha,
+                                                                csr_row_ptr,
+                                                                csr_col_ind,
+                                                                csr_val,
+                                                                x,
+                                                                beta,
+                                                                y,
+                                                                idx_base);
         }
     }
 
-    template <typename I, typename J, typename A, typename X, typename Y, typename U>
+    template <typename S, typename I, typename J, typename A, typename X, typename Y, typename U>
     ROCSPARSE_KERNEL(WG_SIZE)
     void csrmvn_lrb_short_rows_2_kernel(bool conj,
                                         I    nnz,
@@ -277,9 +280,9 @@ namespace rocsparse
     {
         auto alpha = rocsparse::load_scalar_device_host(alpha_device_host);
         auto beta  = rocsparse::load_scalar_device_host(beta_device_host);
-        if(alpha != 0 || beta != 1)
+        if(!S::is_noop(alpha, beta))
         {
-            rocsparse::csrmvn_lrb_short_rows_2_device<WG_SIZE, CSRMV_LRB_SHORT_ROWS_2_LDS_ELEMS>(
+            rocsparse::csrmvn_lrb_short_rows_2_device<WG_SIZE, CSRMV_LRB_SHORT_ROWS_2_LDS_ELEMS, S>(
                 conj,
                 nnz,
                 rows_bins,
@@ -298,6 +301,7 @@ namespace rocsparse
 
     template <unsigned int BLOCKSIZE,
               unsigned int WF_SIZE,
+              typename S,
               typename I,
               typename J,
               typename A,
@@ -322,26 +326,27 @@ namespace rocsparse
     {
         auto alpha = rocsparse::load_scalar_device_host(alpha_device_host);
         auto beta  = rocsparse::load_scalar_device_host(beta_device_host);
-        if(alpha != 0 || beta != 1)
+        if(!S::is_noop(alpha, beta))
         {
-            rocsparse::csrmvn_lrb_medium_rows_warp_reduce_device<BLOCKSIZE, WF_SIZE>(conj,
-                                                                                     nnz,
-                                                                                     count,
-                                                                                     rows_bins,
-                                                                                     n_rows_bins,
-                                                                                     bin_id,
-                                                                                     alpha,
-                                                                                     csr_row_ptr,
-                                                                                     csr_col_ind,
-                                                                                     csr_val,
-                                                                                     x,
-                                                                                     beta,
-                                                                                     y,
-                                                                                     idx_base);
+            rocsparse::csrmvn_lrb_medium_rows_warp_reduce_device<BLOCKSIZE, WF_SIZE, S>(conj,
+                                                                                        nnz,
+                                                                                        count,
+                                                                                        rows_bins,
+                                                                                        n_rows_bins,
+                                                                                        bin_id,
+                                                                                        alpha,
+                                                                                        csr_row_ptr,
+                                                                                        csr_col_ind,
+                                                                                        csr_val,
+                                                                                        x,
+                                                                                        beta,
+                                                                                        y,
+                                                                                        idx_base);
         }
     }
 
     template <unsigned int BLOCKSIZE,
+              typename S,
               typename I,
               typename J,
               typename A,
@@ -365,25 +370,25 @@ namespace rocsparse
     {
         auto alpha = rocsparse::load_scalar_device_host(alpha_device_host);
         auto beta  = rocsparse::load_scalar_device_host(beta_device_host);
-        if(alpha != 0 || beta != 1)
+        if(!S::is_noop(alpha, beta))
         {
-            rocsparse::csrmvn_lrb_medium_rows_device<BLOCKSIZE>(conj,
-                                                                nnz,
-                                                                rows_bins,
-                                                                n_rows_bins,
-                                                                bin_id,
-                                                                alpha,
-                                                                csr_row_ptr,
-                                                                csr_col_ind,
-                                                                csr_val,
-                                                                x,
-                                                                beta,
-                                                                y,
-                                                                idx_base);
+            rocsparse::csrmvn_lrb_medium_rows_device<BLOCKSIZE, S>(conj,
+                                                                   nnz,
+                                                                   rows_bins,
+                                                                   n_rows_bins,
+                                                                   bin_id,
+                                                                   alpha,
+                                                                   csr_row_ptr,
+                                                                   csr_col_ind,
+                                                                   csr_val,
+                                                                   x,
+                                                                   beta,
+                                                                   y,
+                                                                   idx_base);
         }
     }
 
-    template <typename I, typename J, typename A, typename X, typename Y, typename U>
+    template <typename S, typename I, typename J, typename A, typename X, typename Y, typename U>
     ROCSPARSE_KERNEL(WG_SIZE)
     void csrmvn_lrb_long_rows_kernel(bool conj,
                                      I    nnz,
@@ -402,27 +407,34 @@ namespace rocsparse
     {
         auto alpha = rocsparse::load_scalar_device_host(alpha_device_host);
         auto beta  = rocsparse::load_scalar_device_host(beta_device_host);
-        if(alpha != 0 || beta != 1)
+        if(!S::is_noop(alpha, beta))
         {
-            rocsparse::csrmvn_lrb_long_rows_device<WG_SIZE, BLOCK_MULTIPLIER>(conj,
-                                                                              nnz,
-                                                                              wg_flags,
-                                                                              rows_bins,
-                                                                              n_rows_bins,
-                                                                              bin_id,
-                                                                              alpha,
-                                                                              csr_row_ptr,
-                                                                              csr_col_ind,
-                                                                              csr_val,
-                                                                              x,
-                                                                              beta,
-                                                                              y,
-                                                                              idx_base);
+            rocsparse::csrmvn_lrb_long_rows_device<WG_SIZE, BLOCK_MULTIPLIER, S>(conj,
+                                                                                 nnz,
+                                                                                 wg_flags,
+                                                                                 rows_bins,
+                                                                                 n_rows_bins,
+                                                                                 bin_id,
+                                                                                 alpha,
+                                                                                 csr_row_ptr,
+                                                                                 csr_col_ind,
+                                                                                 csr_val,
+                                                                                 x,
+                                                                                 beta,
+                                                                                 y,
+                                                                                 idx_base);
         }
     }
 }
 
-template <typename T, typename I, typename J, typename A, typename X, typename Y, typename U>
+template <typename T,
+          typename I,
+          typename J,
+          typename A,
+          typename X,
+          typename Y,
+          typename U,
+          typename S>
 rocsparse_status rocsparse::csrmv_lrb_template_dispatch(rocsparse_handle          handle,
                                                         rocsparse_operation       trans,
                                                         J                         m,
@@ -482,7 +494,7 @@ rocsparse_status rocsparse::csrmv_lrb_template_dispatch(rocsparse_handle
                 {
                     unsigned int grid_size = ceil((float)info->lrb.nRowsBins[j] / block_size);
 
-                    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((csrmvn_lrb_short_rows_kernel),
+                    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((csrmvn_lrb_short_rows_kernel<S>),
                                                        grid_size,
                                                        block_size,
                                                        lds_size,
@@ -507,7 +519,7 @@ rocsparse_status rocsparse::csrmv_lrb_template_dispatch(rocsparse_handle
                     unsigned int rows_per_wg = CSRMV_LRB_SHORT_ROWS_2_LDS_ELEMS >> j;
                     unsigned int grid_size   = ceil((float)info->lrb.nRowsBins[j] / rows_per_wg);
 
-                    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((csrmvn_lrb_short_rows_2_kernel),
+                    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((csrmvn_lrb_short_rows_2_kernel<S>),
                                                        grid_size,
                                                        block_size,
                                                        0,
@@ -546,7 +558,7 @@ rocsparse_status rocsparse::csrmv_lrb_template_dispatch(rocsparse_handle
                     if(handle->wavefront_size == 32)
                     {
                         RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
-                            (csrmvn_lrb_medium_rows_warp_reduce_kernel<256, 32>),
+                            (csrmvn_lrb_medium_rows_warp_reduce_kernel<256, 32, S>),
                             grid_size,
                             256,
                             0,
@@ -569,7 +581,7 @@ rocsparse_status rocsparse::csrmv_lrb_template_dispatch(rocsparse_handle
                     else
                     {
                         RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
-                            (csrmvn_lrb_medium_rows_warp_reduce_kernel<256, 64>),
+                            (csrmvn_lrb_medium_rows_warp_reduce_kernel<256, 64, S>),
                             grid_size,
                             256,
                             0,
@@ -594,7 +606,7 @@ rocsparse_status rocsparse::csrmv_lrb_template_dispatch(rocsparse_handle
                 {
                     unsigned int grid_size = info->lrb.nRowsBins[j]; // One WG per row
 
-                    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((csrmvn_lrb_medium_rows_kernel<WG_SIZE>),
+                    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((csrmvn_lrb_medium_rows_kernel<WG_SIZE, S>),
                                                        grid_size,
                                                        WG_SIZE,
                                                        0,
@@ -630,7 +642,7 @@ rocsparse_status rocsparse::csrmv_lrb_template_dispatch(rocsparse_handle
                     = (bin_max_row_len - 1) / (BLOCK_MULTIPLIER * block_size) + 1;
                 unsigned int grid_size = info->lrb.nRowsBins[j] * num_wgs_per_row;
 
-                RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((csrmvn_lrb_long_rows_kernel),
+                RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((csrmvn_lrb_long_rows_kernel<S>),
                                                    grid_size,
                                                    block_size,
                                                    0,
@@ -959,3 +971,51 @@ INSTANTIATE(rocsparse_double_complex,
             const rocsparse_double_complex*);
 
 #undef INSTANTIATE
+
+#define INSTANTIATE(TTYPE, ITYPE, JTYPE, UTYPE, STYPE)                       \
+    template rocsparse_status rocsparse::csrmv_lrb_template_dispatch<TTYPE,  \
+                                                                     ITYPE,  \
+                                                                     JTYPE,  \
+                                                                     TTYPE,  \
+                                                                     TTYPE,  \
+                                                                     TTYPE,  \
+                                                                     UTYPE,  \
+                                                                     STYPE>( \
+        rocsparse_handle          handle,                                    \
+        rocsparse_operation       trans,                                     \
+        JTYPE                     m,                                         \
+        JTYPE                     n,                                         \
+        ITYPE                     nnz,                                       \
+        UTYPE                     alpha_device_host,                         \
+        const rocsparse_mat_descr descr,                                     \
+        const TTYPE*              csr_val,                                   \
+        const ITYPE*              csr_row_ptr,                               \
+        const JTYPE*              csr_col_ind,                               \
+        rocsparse_csrmv_info      info,                                      \
+        const TTYPE*              x,                                         \
+        UTYPE                     beta_device_host,                          \
+        TTYPE*                    y,                                         \
+        bool                      force_conj);
+
+#define INSTANTIATE_SEMIRINGS(TTYPE, ITYPE, JTYPE, UTYPE)                   \
+    INSTANTIATE(TTYPE, ITYPE, JTYPE, UTYPE, rocsparse::min_plus_semiring);  \
+    INSTANTIATE(TTYPE, ITYPE, JTYPE, UTYPE, rocsparse::max_times_semiring); \
+    INSTANTIATE(TTYPE, ITYPE, JTYPE, UTYPE, rocsparse::max_min_semiring);   \
+    INSTANTIATE(TTYPE, ITYPE, JTYPE, UTYPE, rocsparse::or_and_semiring)
+
+// Semirings
+INSTANTIATE_SEMIRINGS(float, int32_t, int32_t, float);
+INSTANTIATE_SEMIRINGS(float, int64_t, int32_t, float);
+INSTANTIATE_SEMIRINGS(float, int64_t, int64_t, float);
+INSTANTIATE_SEMIRINGS(double, int32_t, int32_t, double);
+INSTANTIATE_SEMIRINGS(double, int64_t, int32_t, double);
+INSTANTIATE_SEMIRINGS(double, int64_t, int64_t, double);
+INSTANTIATE_SEMIRINGS(float, int32_t, int32_t, const float*);
+INSTANTIATE_SEMIRINGS(float, int64_t, int32_t, const float*);
+INSTANTIATE_SEMIRINGS(float, int64_t, int64_t, const float*);
+INSTANTIATE_SEMIRINGS(double, int32_t, int32_t, const double*);
+INSTANTIATE_SEMIRINGS(double, int64_t, int32_t, const double*);
+INSTANTIATE_SEMIRINGS(double, int64_t, int64_t, const double*);
+
+#undef INSTANTIATE_SEMIRINGS
+#undef INSTANTIATE
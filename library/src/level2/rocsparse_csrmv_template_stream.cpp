@@ -50,6 +50,50 @@ namespace rocsparse
                                        y,                                           \
                                        descr->base)
 
+#define LAUNCH_CSRMVT_TRANSPOSED(wfsize)                                                          \
+    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((csrmvt_transposed_kernel<CSRMVT_TRANSPOSED_DIM, wfsize>), \
+                                       dim3(csrmvt_blocks),                                       \
+                                       dim3(csrmvt_threads),                                      \
+                                       0,                                                         \
+                                       stream,                                                    \
+                                       conj,                                                      \
+                                       n,                                                         \
+                                       alpha_device_host,                                         \
+                                       csrt_row_ptr,                                              \
+                                       csrt_col_ind,                                              \
+                                       csrt_perm,                                                 \
+                                       csr_val,                                                   \
+                                       x,                                                         \
+                                       beta_device_host,                                          \
+                                       y,                                                         \
+                                       descr->base)
+
+#define LAUNCH_CSRMVN_BATCH(wfsize)                                                         \
+    {                                                                                       \
+        const int64_t csrmvn_blocks                                                         \
+            = std::min(max_blocks, (nrow * wfsize - 1) / CSRMVN_BATCH_DIM + 1);             \
+        RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((csrmvn_batch_kernel<CSRMVN_BATCH_DIM, wfsize>), \
+                                           dim3(csrmvn_blocks),                             \
+                                           dim3(CSRMVN_BATCH_DIM),                          \
+                                           0,                                               \
+                                           stream,                                          \
+                                           m,                                               \
+                                           batch_count,                                     \
+                                           alpha_device_host,                               \
+                                           csr_row_ptr,                                     \
+                                           csr_col_ind,                                     \
+                                           csr_val,                                         \
+                                           offsets_batch_stride,                            \
+                                           columns_batch_stride,                            \
+                                           values_batch_stride,                             \
+                                           x,                                               \
+                                           batch_stride_x,                                  \
+                                           beta_device_host,                                \
+                                           y,                                               \
+                                           batch_stride_y,                                  \
+                                           descr->base);                                    \
+    }
+
 #define LAUNCH_CSRMVT(wfsize)                                                       \
     RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((csrmvt_general_kernel<CSRMVT_DIM, wfsize>), \
                                        dim3(csrmvt_blocks),                         \
@@ -141,6 +185,92 @@ namespace rocsparse
         }
     }
 
+    template <unsigned int BLOCKSIZE,
+              unsigned int WF_SIZE,
+              typename I,
+              typename J,
+              typename A,
+              typename X,
+              typename Y,
+              typename U>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void csrmvt_transposed_kernel(bool     conj,
+                                  J        n,
+                                  U        alpha_device_host,
+                                  const I* csrt_row_ptr,
+                                  const J* __restrict__ csrt_col_ind,
+                                  const I* __restrict__ csrt_perm,
+                                  const A* __restrict__ csr_val,
+                                  const X* __restrict__ x,
+                                  U beta_device_host,
+                                  Y* __restrict__ y,
+                                  rocsparse_index_base idx_base)
+    {
+        auto alpha = rocsparse::load_scalar_device_host(alpha_device_host);
+        auto beta  = rocsparse::load_scalar_device_host(beta_device_host);
+        if(alpha != 0 || beta != 1)
+        {
+            rocsparse::csrmvt_transposed_device<BLOCKSIZE, WF_SIZE>(conj,
+                                                                    n,
+                                                                    alpha,
+                                                                    csrt_row_ptr,
+                                                                    csrt_col_ind,
+                                                                    csrt_perm,
+                                                                    csr_val,
+                                                                    x,
+                                                                    beta,
+                                                                    y,
+                                                                    idx_base);
+        }
+    }
+
+    template <unsigned int BLOCKSIZE,
+              unsigned int WF_SIZE,
+              typename I,
+              typename J,
+              typename A,
+              typename X,
+              typename Y,
+              typename U>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void csrmvn_batch_kernel(J        m,
+                             int64_t  batch_count,
+                             U        alpha_device_host,
+                             const I* csr_row_ptr,
+                             const J* __restrict__ csr_col_ind,
+                             const A* __restrict__ csr_val,
+                             int64_t  offsets_batch_stride,
+                             int64_t  columns_batch_stride,
+                             int64_t  values_batch_stride,
+                             const X* __restrict__ x,
+                             int64_t batch_stride_x,
+                             U       beta_device_host,
+                             Y* __restrict__ y,
+                             int64_t              batch_stride_y,
+                             rocsparse_index_base idx_base)
+    {
+        auto alpha = rocsparse::load_scalar_device_host(alpha_device_host);
+        auto beta  = rocsparse::load_scalar_device_host(beta_device_host);
+        if(alpha != 0 || beta != 1)
+        {
+            rocsparse::csrmvn_batch_device<BLOCKSIZE, WF_SIZE>(m,
+                                                               batch_count,
+                                                               alpha,
+                                                               csr_row_ptr,
+                                                               csr_col_ind,
+                                                               csr_val,
+                                                               offsets_batch_stride,
+                                                               columns_batch_stride,
+                                                               values_batch_stride,
+                                                               x,
+                                                               batch_stride_x,
+                                                               beta,
+                                                               y,
+                                                               batch_stride_y,
+                                                               idx_base);
+        }
+    }
+
     template <unsigned int BLOCKSIZE, typename J, typename Y, typename U>
     ROCSPARSE_KERNEL(BLOCKSIZE)
     void csrmvt_scale_kernel(J size, U scalar_device_host, Y* __restrict__ data)
@@ -433,23 +563,187 @@ rocsparse_status rocsparse::csrmv_stream_template_dispatch(rocsparse_handle    h
     return rocsparse_status_success;
 }
 
-#define INSTANTIATE(TTYPE, ITYPE, JTYPE, ATYPE, XTYPE, YTYPE, UTYPE)            \
-    template rocsparse_status rocsparse::csrmv_stream_template_dispatch<TTYPE>( \
-        rocsparse_handle          handle,                                       \
-        rocsparse_operation       trans,                                        \
-        JTYPE                     m,                                            \
-        JTYPE                     n,                                            \
-        ITYPE                     nnz,                                          \
-        UTYPE                     alpha_device_host,                            \
-        const rocsparse_mat_descr descr,                                        \
-        const ATYPE*              csr_val,                                      \
-        const ITYPE*              csr_row_ptr_begin,                            \
-        const ITYPE*              csr_row_ptr_end,                              \
-        const JTYPE*              csr_col_ind,                                  \
-        const XTYPE*              x,                                            \
-        UTYPE                     beta_device_host,                             \
-        YTYPE*                    y,                                            \
-        bool                      force_conj);
+template <typename T, typename I, typename J, typename A, typename X, typename Y, typename U>
+rocsparse_status
+    rocsparse::csrmvt_transposed_template_dispatch(rocsparse_handle          handle,
+                                                   rocsparse_operation       trans,
+                                                   J                         m,
+                                                   J                         n,
+                                                   I                         nnz,
+                                                   U                         alpha_device_host,
+                                                   const rocsparse_mat_descr descr,
+                                                   const A*                  csr_val,
+                                                   rocsparse_csrmv_info      csrmv_info,
+                                                   const X*                  x,
+                                                   U                         beta_device_host,
+                                                   Y*                        y,
+                                                   bool                      force_conj)
+{
+    bool conj = (trans == rocsparse_operation_conjugate_transpose || force_conj);
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Transposed structure, gathered during csrmv analysis
+    const I* csrt_row_ptr = reinterpret_cast<const I*>(csrmv_info->csrmvt_row_ptr);
+    const J* csrt_col_ind = reinterpret_cast<const J*>(csrmv_info->csrmvt_col_ind);
+    const I* csrt_perm    = reinterpret_cast<const I*>(csrmv_info->csrmvt_perm);
+
+    // Average nnz per row of A^T
+    J nnz_per_row = nnz / n;
+
+#define CSRMVT_TRANSPOSED_DIM 512
+    dim3 csrmvt_blocks((n - 1) / CSRMVT_TRANSPOSED_DIM + 1);
+    dim3 csrmvt_threads(CSRMVT_TRANSPOSED_DIM);
+
+    if(nnz_per_row < 4)
+    {
+        LAUNCH_CSRMVT_TRANSPOSED(2);
+    }
+    else if(nnz_per_row < 8)
+    {
+        LAUNCH_CSRMVT_TRANSPOSED(4);
+    }
+    else if(nnz_per_row < 16)
+    {
+        LAUNCH_CSRMVT_TRANSPOSED(8);
+    }
+    else if(nnz_per_row < 32)
+    {
+        LAUNCH_CSRMVT_TRANSPOSED(16);
+    }
+    else if(nnz_per_row < 64 || handle->wavefront_size == 32)
+    {
+        LAUNCH_CSRMVT_TRANSPOSED(32);
+    }
+    else
+    {
+        LAUNCH_CSRMVT_TRANSPOSED(64);
+    }
+#undef CSRMVT_TRANSPOSED_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T, typename I, typename J, typename A, typename X, typename Y, typename U>
+rocsparse_status
+    rocsparse::csrmvn_batch_template_dispatch(rocsparse_handle          handle,
+                                              J                         m,
+                                              J                         n,
+                                              I                         nnz,
+                                              int64_t                   batch_count,
+                                              U                         alpha_device_host,
+                                              const rocsparse_mat_descr descr,
+                                              const A*                  csr_val,
+                                              const I*                  csr_row_ptr,
+                                              const J*                  csr_col_ind,
+                                              int64_t                   offsets_batch_stride,
+                                              int64_t                   columns_batch_stride,
+                                              int64_t                   values_batch_stride,
+                                              const X*                  x,
+                                              int64_t                   batch_stride_x,
+                                              U                         beta_device_host,
+                                              Y*                        y,
+                                              int64_t                   batch_stride_y)
+{
+    // Only general (and triangular, which is treated as general) matrices are supported
+    if(descr->type != rocsparse_matrix_type_general
+       && descr->type != rocsparse_matrix_type_triangular)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_not_implemented);
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Average nnz per row
+    const J nnz_per_row = nnz / m;
+
+    // Total number of rows in the batch. Matrices are not mapped to individual blocks,
+    // such that many small matrices can share a single block.
+    const int64_t nrow       = static_cast<int64_t>(m) * batch_count;
+    const int64_t max_blocks = std::numeric_limits<int32_t>::max();
+
+#define CSRMVN_BATCH_DIM 256
+    if(nnz_per_row < 4)
+    {
+        LAUNCH_CSRMVN_BATCH(2);
+    }
+    else if(nnz_per_row < 8)
+    {
+        LAUNCH_CSRMVN_BATCH(4);
+    }
+    else if(nnz_per_row < 16)
+    {
+        LAUNCH_CSRMVN_BATCH(8);
+    }
+    else if(nnz_per_row < 32)
+    {
+        LAUNCH_CSRMVN_BATCH(16);
+    }
+    else if(nnz_per_row < 64 || handle->wavefront_size == 32)
+    {
+        LAUNCH_CSRMVN_BATCH(32);
+    }
+    else
+    {
+        LAUNCH_CSRMVN_BATCH(64);
+    }
+#undef CSRMVN_BATCH_DIM
+
+    return rocsparse_status_success;
+}
+
+#define INSTANTIATE(TTYPE, ITYPE, JTYPE, ATYPE, XTYPE, YTYPE, UTYPE)                 \
+    template rocsparse_status rocsparse::csrmv_stream_template_dispatch<TTYPE>(      \
+        rocsparse_handle          handle,                                            \
+        rocsparse_operation       trans,                                             \
+        JTYPE                     m,                                                 \
+        JTYPE                     n,                                                 \
+        ITYPE                     nnz,                                               \
+        UTYPE                     alpha_device_host,                                 \
+        const rocsparse_mat_descr descr,                                             \
+        const ATYPE*              csr_val,                                           \
+        const ITYPE*              csr_row_ptr_begin,                                 \
+        const ITYPE*              csr_row_ptr_end,                                   \
+        const JTYPE*              csr_col_ind,                                       \
+        const XTYPE*              x,                                                 \
+        UTYPE                     beta_device_host,                                  \
+        YTYPE*                    y,                                                 \
+        bool                      force_conj);                                       \
+    template rocsparse_status rocsparse::csrmvt_transposed_template_dispatch<TTYPE>( \
+        rocsparse_handle          handle,                                            \
+        rocsparse_operation       trans,                                             \
+        JTYPE                     m,                                                 \
+        JTYPE                     n,                                                 \
+        ITYPE                     nnz,                                               \
+        UTYPE                     alpha_device_host,                                 \
+        const rocsparse_mat_descr descr,                                             \
+        const ATYPE*              csr_val,                                           \
+        rocsparse_csrmv_info      csrmv_info,                                        \
+        const XTYPE*              x,                                                 \
+        UTYPE                     beta_device_host,                                  \
+        YTYPE*                    y,                                                 \
+        bool                      force_conj);                                       \
+    template rocsparse_status rocsparse::csrmvn_batch_template_dispatch<TTYPE>(      \
+        rocsparse_handle          handle,                                            \
+        JTYPE                     m,                                                 \
+        JTYPE                     n,                                                 \
+        ITYPE                     nnz,                                               \
+        int64_t                   batch_count,                                       \
+        UTYPE                     alpha_device_host,                                 \
+        const rocsparse_mat_descr descr,                                             \
+        const ATYPE*              csr_val,                                           \
+        const ITYPE*              csr_row_ptr,                                       \
+        const JTYPE*              csr_col_ind,                                       \
+        int64_t                   offsets_batch_stride,                              \
+        int64_t                   columns_batch_stride,                              \
+        int64_t                   values_batch_stride,                               \
+        const XTYPE*              x,                                                 \
+        int64_t                   batch_stride_x,                                    \
+        UTYPE                     beta_device_host,                                  \
+        YTYPE*                    y,                                                 \
+        int64_t                   batch_stride_y);
 
 // Uniform precision
 INSTANTIATE(float, int32_t, int32_t, float, float, float, float);
@@ -28,6 +28,7 @@
 #include "../conversion/rocsparse_csr2coo.hpp"
 #include "../conversion/rocsparse_identity.hpp"
 #include "../level1/rocsparse_gthr.hpp"
+#include "analysis_cache.h"
 #include "control.h"
 #include "csrsv_device.h"
 #include "utility.h"
@@ -46,9 +47,57 @@ rocsparse_status rocsparse::trm_analysis(rocsparse_handle          handle,
                                          J**                       zero_pivot,
                                          void*                     temp_buffer)
 {
+    // The maximum number of non-zeros per row is read back on the host
+    RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
     // Stream
     hipStream_t stream = handle->stream;
 
+    rocsparse::analysis_key key;
+    if(handle->analysis_cache != nullptr)
+    {
+        key.kind         = rocsparse::analysis_kind_trm;
+        key.trans        = trans;
+        key.m            = m;
+        key.n            = m;
+        key.nnz          = nnz;
+        key.type         = descr->type;
+        key.fill_mode    = descr->fill_mode;
+        key.diag_type    = descr->diag_type;
+        key.base         = descr->base;
+        key.index_type_I = rocsparse::get_indextype<I>();
+        key.index_type_J = rocsparse::get_indextype<J>();
+
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse::analysis_fingerprint(handle, m, nnz, csr_row_ptr, csr_col_ind, key.hash));
+
+        int64_t                  cached_zero_pivot;
+        const rocsparse_trm_info cached = handle->analysis_cache->find_trm(key, &cached_zero_pivot);
+
+        if(cached != nullptr)
+        {
+            // Same sparsity pattern, re-use the meta data of a previous analysis
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse::copy_trm_info(info, cached));
+
+            info->descr = descr;
+            info->trm_row_ptr
+                = (trans == rocsparse_operation_none) ? csr_row_ptr : info->trmt_row_ptr;
+            info->trm_col_ind
+                = (trans == rocsparse_operation_none) ? csr_col_ind : info->trmt_col_ind;
+
+            // The zero pivot only depends on the sparsity pattern
+            if(*zero_pivot == nullptr)
+            {
+                RETURN_IF_HIP_ERROR(
+                    rocsparse_hipMallocAsync((void**)zero_pivot, sizeof(J), stream));
+            }
+            RETURN_IF_HIP_ERROR(
+                rocsparse::assign_async(*zero_pivot, static_cast<J>(cached_zero_pivot), stream));
+
+            return rocsparse_status_success;
+        }
+    }
+
     // If analyzing transposed, allocate some info memory to hold the transposed matrix
     if(trans == rocsparse_operation_transpose || trans == rocsparse_operation_conjugate_transpose)
     {
@@ -509,6 +558,17 @@ rocsparse_status rocsparse::trm_analysis(rocsparse_handle          handle,
                              : ((sizeof(J) == sizeof(int32_t)) ? rocsparse_indextype_i32
                                                                : rocsparse_indextype_i64);
 
+    if(handle->analysis_cache != nullptr)
+    {
+        J h_zero_pivot;
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(&h_zero_pivot, *zero_pivot, sizeof(J), hipMemcpyDeviceToHost, stream));
+
+        // Wait for the analysis to finish before copying its meta data
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        RETURN_IF_ROCSPARSE_ERROR(handle->analysis_cache->insert_trm(key, info, h_zero_pivot));
+    }
+
     return rocsparse_status_success;
 }
 
@@ -630,6 +690,9 @@ rocsparse_status rocsparse::csrsv_analysis_template(rocsparse_handle          ha
         // User is explicitly asking to force a re-analysis, or no valid data has been
         // found to be re-used.
 
+        // The analysis reads its meta data back on the host
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
         // Clear csrsv info
         RETURN_IF_ROCSPARSE_ERROR(rocsparse::destroy_trm_info((trans == rocsparse_operation_none)
                                                                   ? info->csrsv_upper_info
@@ -716,6 +779,9 @@ rocsparse_status rocsparse::csrsv_analysis_template(rocsparse_handle          ha
         // User is explicitly asking to force a re-analysis, or no valid data has been
         // found to be re-used.
 
+        // The analysis reads its meta data back on the host
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
         // Clear csrsv info
         RETURN_IF_ROCSPARSE_ERROR(rocsparse::destroy_trm_info((trans == rocsparse_operation_none)
                                                                   ? info->csrsv_lower_info
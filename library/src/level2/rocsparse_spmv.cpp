@@ -51,6 +51,7 @@ namespace rocsparse
             case rocsparse_spmv_alg_csr_stream:
             case rocsparse_spmv_alg_csr_adaptive:
             case rocsparse_spmv_alg_csr_lrb:
+            case rocsparse_spmv_alg_csr_gather:
             {
                 return rocsparse_status_success;
             }
@@ -81,6 +82,7 @@ namespace rocsparse
             case rocsparse_spmv_alg_bsr:
             case rocsparse_spmv_alg_ell:
             case rocsparse_spmv_alg_csr_lrb:
+            case rocsparse_spmv_alg_csr_gather:
             {
                 RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_invalid_value);
             }
@@ -103,6 +105,7 @@ namespace rocsparse
             case rocsparse_spmv_alg_coo:
             case rocsparse_spmv_alg_coo_atomic:
             case rocsparse_spmv_alg_csr_lrb:
+            case rocsparse_spmv_alg_csr_gather:
             {
                 RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_invalid_value);
             }
@@ -122,6 +125,7 @@ namespace rocsparse
             case rocsparse_spmv_alg_bsr:
             case rocsparse_spmv_alg_coo_atomic:
             case rocsparse_spmv_alg_csr_lrb:
+            case rocsparse_spmv_alg_csr_gather:
             {
                 RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_invalid_value);
             }
@@ -145,6 +149,7 @@ namespace rocsparse
             case rocsparse_spmv_alg_coo:
             case rocsparse_spmv_alg_coo_atomic:
             case rocsparse_spmv_alg_csr_lrb:
+            case rocsparse_spmv_alg_csr_gather:
             {
                 RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_invalid_value);
             }
@@ -181,6 +186,12 @@ namespace rocsparse
             return rocsparse_status_success;
         }
 
+        case rocsparse_spmv_alg_csr_gather:
+        {
+            csrmv_alg = rocsparse_csrmv_alg_gather;
+            return rocsparse_status_success;
+        }
+
         case rocsparse_spmv_alg_coo:
         case rocsparse_spmv_alg_coo_atomic:
         case rocsparse_spmv_alg_bsr:
@@ -220,6 +231,7 @@ namespace rocsparse
         case rocsparse_spmv_alg_bsr:
         case rocsparse_spmv_alg_ell:
         case rocsparse_spmv_alg_csr_lrb:
+        case rocsparse_spmv_alg_csr_gather:
         {
             RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_invalid_value);
         }
@@ -255,6 +267,7 @@ namespace rocsparse
         case rocsparse_spmv_alg_bsr:
         case rocsparse_spmv_alg_ell:
         case rocsparse_spmv_alg_csr_lrb:
+        case rocsparse_spmv_alg_csr_gather:
         {
             RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_invalid_value);
         }
@@ -265,6 +278,79 @@ namespace rocsparse
 
 namespace rocsparse
 {
+    template <typename T, typename I, typename J, typename A, typename X, typename Y>
+    static rocsparse_status spmv_csr_batch_template(rocsparse_handle            handle,
+                                                    rocsparse_operation         trans,
+                                                    const void*                 alpha,
+                                                    rocsparse_const_spmat_descr mat,
+                                                    rocsparse_const_dnvec_descr x,
+                                                    const void*                 beta,
+                                                    const rocsparse_dnvec_descr y,
+                                                    rocsparse_spmv_stage        stage,
+                                                    size_t*                     buffer_size)
+    {
+        // Batched computation is only supported for non-transposed matrices
+        if(trans != rocsparse_operation_none)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_not_implemented);
+        }
+
+        const int64_t batch_count_A = mat->batch_count;
+        const int64_t batch_count_x = x->batch_count;
+        const int64_t batch_count_y = y->batch_count;
+
+        // Supported batch modes are y_i = A * x_i, y_i = A_i * x and y_i = A_i * x_i
+        const bool yi_A_xi  = (batch_count_A == 1 && batch_count_x == batch_count_y);
+        const bool yi_Ai_x  = (batch_count_x == 1 && batch_count_A == batch_count_y);
+        const bool yi_Ai_xi = (batch_count_A == batch_count_y && batch_count_x == batch_count_y);
+
+        if(!yi_A_xi && !yi_Ai_x && !yi_Ai_xi)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_invalid_value);
+        }
+
+        switch(stage)
+        {
+        case rocsparse_spmv_stage_buffer_size:
+        {
+            *buffer_size = 0;
+            return rocsparse_status_success;
+        }
+
+        case rocsparse_spmv_stage_preprocess:
+        {
+            // The batched kernel does not require any analysis
+            return rocsparse_status_success;
+        }
+
+        case rocsparse_spmv_stage_compute:
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse::csrmv_batch_template(
+                handle,
+                (J)mat->rows,
+                (J)mat->cols,
+                (I)mat->nnz,
+                batch_count_y,
+                (const T*)alpha,
+                mat->descr,
+                (const A*)mat->const_val_data,
+                (const I*)mat->const_row_data,
+                (const J*)mat->const_col_data,
+                (batch_count_A > 1) ? mat->offsets_batch_stride : 0,
+                (batch_count_A > 1) ? mat->columns_batch_stride : 0,
+                (batch_count_A > 1) ? mat->columns_values_batch_stride : 0,
+                (const X*)x->const_values,
+                (batch_count_x > 1) ? x->batch_stride : 0,
+                (const T*)beta,
+                (Y*)y->values,
+                y->batch_stride));
+            return rocsparse_status_success;
+        }
+        }
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_invalid_value);
+    }
+
     template <typename T, typename I, typename J, typename A, typename X, typename Y>
     rocsparse_status spmv_template(rocsparse_handle            handle,
                                    rocsparse_operation         trans,
@@ -280,6 +366,12 @@ namespace rocsparse
     {
         RETURN_IF_ROCSPARSE_ERROR((rocsparse::check_spmv_alg(mat->format, alg)));
 
+        // Batched dense vectors are only supported for CSR matrices
+        if(mat->format != rocsparse_format_csr && (x->batch_count > 1 || y->batch_count > 1))
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_not_implemented);
+        }
+
         switch(mat->format)
         {
         case rocsparse_format_coo:
@@ -433,6 +525,16 @@ namespace rocsparse
 
         case rocsparse_format_csr:
         {
+            //
+            // Batched matrices and / or vectors are processed by a dedicated kernel
+            //
+            if(mat->batch_count > 1 || x->batch_count > 1 || y->batch_count > 1)
+            {
+                RETURN_IF_ROCSPARSE_ERROR((rocsparse::spmv_csr_batch_template<T, I, J, A, X, Y>(
+                    handle, trans, alpha, mat, x, beta, y, stage, buffer_size)));
+                return rocsparse_status_success;
+            }
+
             rocsparse_csrmv_alg csrmv_alg;
             RETURN_IF_ROCSPARSE_ERROR((rocsparse::spmv_alg2csrmv_alg(alg, csrmv_alg)));
 
@@ -451,7 +553,7 @@ namespace rocsparse
                 // If algorithm 1 or default is selected and analysis step is required
                 //
                 if((alg == rocsparse_spmv_alg_default || alg == rocsparse_spmv_alg_csr_adaptive
-                    || alg == rocsparse_spmv_alg_csr_lrb)
+                    || alg == rocsparse_spmv_alg_csr_lrb || alg == rocsparse_spmv_alg_csr_gather)
                    && mat->analysed == false)
                 {
                     RETURN_IF_ROCSPARSE_ERROR(
@@ -517,7 +619,7 @@ namespace rocsparse
                 // If algorithm 1 or default is selected and analysis step is required
                 //
                 if((alg == rocsparse_spmv_alg_default || alg == rocsparse_spmv_alg_csr_adaptive
-                    || alg == rocsparse_spmv_alg_csr_lrb)
+                    || alg == rocsparse_spmv_alg_csr_lrb || alg == rocsparse_spmv_alg_csr_gather)
                    && mat->analysed == false)
                 {
                     RETURN_IF_ROCSPARSE_ERROR(
@@ -827,6 +929,9 @@ extern "C" rocsparse_status rocsparse_spmv(rocsparse_handle            handle, /
                                            void*                       temp_buffer) //11
 try
 {
+    // Profiling
+    rocsparse::trace_scope trace(handle);
+
     // Logging
     rocsparse::log_trace(handle,
                          "rocsparse_spmv",
@@ -0,0 +1,515 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "control.h"
+#include "handle.h"
+#include "internal/generic/rocsparse_spmv.h"
+#include "utility.h"
+
+#include "csrmv_device.h"
+
+namespace rocsparse
+{
+    template <unsigned int BLOCKSIZE,
+              unsigned int WF_SIZE,
+              bool         DOT_YY,
+              typename I,
+              typename J,
+              typename T,
+              typename U>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void spmv_fused_kernel(J        m,
+                           U        alpha_device_host,
+                           const I* csr_row_ptr,
+                           const J* __restrict__ csr_col_ind,
+                           const T* __restrict__ csr_val,
+                           const T* __restrict__ x,
+                           U beta_device_host,
+                           T* __restrict__ y,
+                           T* __restrict__ workspace,
+                           rocsparse_index_base idx_base)
+    {
+        const auto alpha = rocsparse::load_scalar_device_host(alpha_device_host);
+        const auto beta  = rocsparse::load_scalar_device_host(beta_device_host);
+
+        rocsparse::csrmvn_general_fused_device<BLOCKSIZE, WF_SIZE, DOT_YY>(false,
+                                                                          m,
+                                                                          alpha,
+                                                                          csr_row_ptr,
+                                                                          csr_col_ind,
+                                                                          csr_val,
+                                                                          x,
+                                                                          beta,
+                                                                          y,
+                                                                          workspace,
+                                                                          idx_base);
+    }
+
+    // Reduces the block partials of the fused kernel into result, or into workspace[0]
+    // if result is a host pointer
+    template <unsigned int BLOCKSIZE, typename T>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void spmv_fused_reduce_kernel(int nblocks, T* __restrict__ workspace, T* __restrict__ result)
+    {
+        const int tid = hipThreadIdx_x;
+
+        __shared__ T sdata[BLOCKSIZE];
+
+        sdata[tid] = (tid < nblocks) ? workspace[tid] : static_cast<T>(0);
+        __syncthreads();
+
+        rocsparse::blockreduce_sum<BLOCKSIZE>(tid, sdata);
+
+        if(tid == 0)
+        {
+            if(result)
+            {
+                *result = sdata[0];
+            }
+            else
+            {
+                workspace[0] = sdata[0];
+            }
+        }
+    }
+
+#define SPMV_FUSED_DIM 512
+#define SPMV_FUSED_MAX_BLOCKS 1024
+
+#define LAUNCH_SPMV_FUSED(wfsize)                                           \
+    {                                                                       \
+        nblocks = static_cast<int>(std::min(                                \
+            static_cast<int64_t>(SPMV_FUSED_MAX_BLOCKS),                    \
+            (static_cast<int64_t>(m) * wfsize - 1) / SPMV_FUSED_DIM + 1));  \
+        RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(                                 \
+            (rocsparse::spmv_fused_kernel<SPMV_FUSED_DIM, wfsize, DOT_YY>), \
+            dim3(nblocks),                                                  \
+            dim3(SPMV_FUSED_DIM),                                           \
+            0,                                                              \
+            handle->stream,                                                 \
+            m,                                                              \
+            alpha_device_host,                                              \
+            csr_row_ptr,                                                    \
+            csr_col_ind,                                                    \
+            csr_val,                                                        \
+            x,                                                              \
+            beta_device_host,                                               \
+            y,                                                              \
+            workspace,                                                      \
+            idx_base);                                                      \
+    }
+
+    template <bool DOT_YY, typename I, typename J, typename T, typename U>
+    static rocsparse_status spmv_fused_core(rocsparse_handle     handle,
+                                            J                    m,
+                                            I                    nnz,
+                                            U                    alpha_device_host,
+                                            const I*             csr_row_ptr,
+                                            const J*             csr_col_ind,
+                                            const T*             csr_val,
+                                            const T*             x,
+                                            U                    beta_device_host,
+                                            T*                   y,
+                                            T*                   result,
+                                            rocsparse_index_base idx_base)
+    {
+        // Get workspace from handle device buffer
+        T* workspace = reinterpret_cast<T*>(handle->buffer);
+
+        // Wavefront size per row, as for the csrmv stream algorithm
+        const I nnz_per_row = nnz / m;
+
+        int nblocks;
+        if(nnz_per_row < 4)
+        {
+            LAUNCH_SPMV_FUSED(2);
+        }
+        else if(nnz_per_row < 8)
+        {
+            LAUNCH_SPMV_FUSED(4);
+        }
+        else if(nnz_per_row < 16)
+        {
+            LAUNCH_SPMV_FUSED(8);
+        }
+        else if(nnz_per_row < 32)
+        {
+            LAUNCH_SPMV_FUSED(16);
+        }
+        else if(nnz_per_row < 64 || handle->wavefront_size == 32)
+        {
+            LAUNCH_SPMV_FUSED(32);
+        }
+        else
+        {
+            LAUNCH_SPMV_FUSED(64);
+        }
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+                (rocsparse::spmv_fused_reduce_kernel<SPMV_FUSED_MAX_BLOCKS>),
+                dim3(1),
+                dim3(SPMV_FUSED_MAX_BLOCKS),
+                0,
+                handle->stream,
+                nblocks,
+                workspace,
+                result);
+        }
+        else
+        {
+            RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+                (rocsparse::spmv_fused_reduce_kernel<SPMV_FUSED_MAX_BLOCKS>),
+                dim3(1),
+                dim3(SPMV_FUSED_MAX_BLOCKS),
+                0,
+                handle->stream,
+                nblocks,
+                workspace,
+                (T*)nullptr);
+
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                result, workspace, sizeof(T), hipMemcpyDeviceToHost, handle->stream));
+        }
+
+        return rocsparse_status_success;
+    }
+
+#undef LAUNCH_SPMV_FUSED
+#undef SPMV_FUSED_MAX_BLOCKS
+#undef SPMV_FUSED_DIM
+
+    template <bool DOT_YY, typename I, typename J, typename T>
+    static rocsparse_status spmv_fused_pointer_mode(rocsparse_handle            handle,
+                                                    const void*                 alpha,
+                                                    rocsparse_const_spmat_descr mat,
+                                                    rocsparse_const_dnvec_descr x,
+                                                    const void*                 beta,
+                                                    const rocsparse_dnvec_descr y,
+                                                    void*                       result)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(
+                (rocsparse::spmv_fused_core<DOT_YY>(handle,
+                                                    (J)mat->rows,
+                                                    (I)mat->nnz,
+                                                    (const T*)alpha,
+                                                    (const I*)mat->const_row_data,
+                                                    (const J*)mat->const_col_data,
+                                                    (const T*)mat->const_val_data,
+                                                    (const T*)x->const_values,
+                                                    (const T*)beta,
+                                                    (T*)y->values,
+                                                    (T*)result,
+                                                    mat->idx_base)));
+        }
+        else
+        {
+            RETURN_IF_ROCSPARSE_ERROR(
+                (rocsparse::spmv_fused_core<DOT_YY>(handle,
+                                                    (J)mat->rows,
+                                                    (I)mat->nnz,
+                                                    *(const T*)alpha,
+                                                    (const I*)mat->const_row_data,
+                                                    (const J*)mat->const_col_data,
+                                                    (const T*)mat->const_val_data,
+                                                    (const T*)x->const_values,
+                                                    *(const T*)beta,
+                                                    (T*)y->values,
+                                                    (T*)result,
+                                                    mat->idx_base)));
+        }
+        return rocsparse_status_success;
+    }
+
+    template <typename T, typename I, typename J>
+    static rocsparse_status spmv_fused_template(rocsparse_handle            handle,
+                                                rocsparse_operation         trans,
+                                                const void*                 alpha,
+                                                rocsparse_const_spmat_descr mat,
+                                                rocsparse_const_dnvec_descr x,
+                                                const void*                 beta,
+                                                const rocsparse_dnvec_descr y,
+                                                rocsparse_spmv_alg          alg,
+                                                rocsparse_spmv_reduction    reduction,
+                                                void*                       result)
+    {
+        if(mat->format != rocsparse_format_csr || trans != rocsparse_operation_none
+           || mat->descr->type != rocsparse_matrix_type_general)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_not_implemented);
+        }
+
+        // The adaptive and lrb kernels complete long rows across work groups, such that
+        // y is not final within a single kernel. Only the stream kernel can be fused.
+        switch(alg)
+        {
+        case rocsparse_spmv_alg_default:
+        case rocsparse_spmv_alg_csr_stream:
+        {
+            break;
+        }
+        case rocsparse_spmv_alg_csr_adaptive:
+        case rocsparse_spmv_alg_csr_lrb:
+        case rocsparse_spmv_alg_csr_gather:
+        case rocsparse_spmv_alg_coo:
+        case rocsparse_spmv_alg_coo_atomic:
+        case rocsparse_spmv_alg_bsr:
+        case rocsparse_spmv_alg_ell:
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_not_implemented);
+        }
+        }
+
+        // Quick return, the dot product of empty vectors is zero
+        if(mat->rows == 0)
+        {
+            if(handle->pointer_mode == rocsparse_pointer_mode_device)
+            {
+                RETURN_IF_HIP_ERROR(hipMemsetAsync(result, 0, sizeof(T), handle->stream));
+            }
+            else
+            {
+                *(T*)result = static_cast<T>(0);
+            }
+            return rocsparse_status_success;
+        }
+
+        // The result is only written to host memory in host pointer mode
+        if(handle->pointer_mode == rocsparse_pointer_mode_host)
+        {
+            RETURN_IF_CAPTURE_SAFE_MODE(handle);
+        }
+
+        switch(reduction)
+        {
+        case rocsparse_spmv_reduction_dot_xy:
+        {
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse::spmv_fused_pointer_mode<false, I, J, T>(
+                handle, alpha, mat, x, beta, y, result)));
+            return rocsparse_status_success;
+        }
+        case rocsparse_spmv_reduction_dot_yy:
+        {
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse::spmv_fused_pointer_mode<true, I, J, T>(
+                handle, alpha, mat, x, beta, y, result)));
+            return rocsparse_status_success;
+        }
+        }
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_invalid_value);
+    }
+
+    template <typename... Ts>
+    static rocsparse_status spmv_fused_template_dispatch(rocsparse_indextype itype,
+                                                         rocsparse_indextype jtype,
+                                                         rocsparse_datatype  ctype,
+                                                         Ts&&... params)
+    {
+#define DISPATCH_COMPUTE_TYPE(ITYPE, JTYPE)                                                       \
+    switch(ctype)                                                                                 \
+    {                                                                                             \
+    case rocsparse_datatype_f32_r:                                                                \
+    {                                                                                             \
+        RETURN_IF_ROCSPARSE_ERROR(                                                                \
+            (rocsparse::spmv_fused_template<float, ITYPE, JTYPE>(params...)));                    \
+        return rocsparse_status_success;                                                          \
+    }                                                                                             \
+    case rocsparse_datatype_f64_r:                                                                \
+    {                                                                                             \
+        RETURN_IF_ROCSPARSE_ERROR(                                                                \
+            (rocsparse::spmv_fused_template<double, ITYPE, JTYPE>(params...)));                   \
+        return rocsparse_status_success;                                                          \
+    }                                                                                             \
+    case rocsparse_datatype_f32_c:                                                                \
+    {                                                                                             \
+        RETURN_IF_ROCSPARSE_ERROR(                                                                \
+            (rocsparse::spmv_fused_template<rocsparse_float_complex, ITYPE, JTYPE>(params...)));  \
+        return rocsparse_status_success;                                                          \
+    }                                                                                             \
+    case rocsparse_datatype_f64_c:                                                                \
+    {                                                                                             \
+        RETURN_IF_ROCSPARSE_ERROR(                                                                \
+            (rocsparse::spmv_fused_template<rocsparse_double_complex, ITYPE, JTYPE>(params...))); \
+        return rocsparse_status_success;                                                          \
+    }                                                                                             \
+    case rocsparse_datatype_i8_r:                                                                 \
+    case rocsparse_datatype_u8_r:                                                                 \
+    case rocsparse_datatype_i32_r:                                                                \
+    case rocsparse_datatype_u32_r:                                                                \
+    {                                                                                             \
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_not_implemented);                              \
+    }                                                                                             \
+    }
+
+        switch(itype)
+        {
+        case rocsparse_indextype_u16:
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_not_implemented);
+        }
+        case rocsparse_indextype_i32:
+        {
+            switch(jtype)
+            {
+            case rocsparse_indextype_u16:
+            case rocsparse_indextype_i64:
+            {
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_not_implemented);
+            }
+            case rocsparse_indextype_i32:
+            {
+                DISPATCH_COMPUTE_TYPE(int32_t, int32_t);
+            }
+            }
+        }
+        case rocsparse_indextype_i64:
+        {
+            switch(jtype)
+            {
+            case rocsparse_indextype_u16:
+            {
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_not_implemented);
+            }
+            case rocsparse_indextype_i32:
+            {
+                DISPATCH_COMPUTE_TYPE(int64_t, int32_t);
+            }
+            case rocsparse_indextype_i64:
+            {
+                DISPATCH_COMPUTE_TYPE(int64_t, int64_t);
+            }
+            }
+        }
+        }
+#undef DISPATCH_COMPUTE_TYPE
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_invalid_value);
+    }
+
+    static rocsparse_status spmv_fused_checkarg(rocsparse_handle            handle, //0
+                                                rocsparse_operation         trans, //1
+                                                const void*                 alpha, //2
+                                                rocsparse_const_spmat_descr mat, //3
+                                                rocsparse_const_dnvec_descr x, //4
+                                                const void*                 beta, //5
+                                                const rocsparse_dnvec_descr y, //6
+                                                rocsparse_datatype          compute_type, //7
+                                                rocsparse_spmv_alg          alg, //8
+                                                rocsparse_spmv_reduction    reduction, //9
+                                                void*                       result) //10
+    {
+        ROCSPARSE_CHECKARG_HANDLE(0, handle);
+        ROCSPARSE_CHECKARG_ENUM(1, trans);
+        ROCSPARSE_CHECKARG_POINTER(2, alpha);
+        ROCSPARSE_CHECKARG_POINTER(3, mat);
+        ROCSPARSE_CHECKARG_POINTER(4, x);
+        ROCSPARSE_CHECKARG_POINTER(5, beta);
+        ROCSPARSE_CHECKARG_POINTER(6, y);
+        ROCSPARSE_CHECKARG_ENUM(7, compute_type);
+        ROCSPARSE_CHECKARG_ENUM(8, alg);
+        ROCSPARSE_CHECKARG_ENUM(9, reduction);
+        ROCSPARSE_CHECKARG_POINTER(10, result);
+
+        ROCSPARSE_CHECKARG(3, mat, (mat->init == false), rocsparse_status_not_initialized);
+        ROCSPARSE_CHECKARG(4, x, (x->init == false), rocsparse_status_not_initialized);
+        ROCSPARSE_CHECKARG(6, y, (y->init == false), rocsparse_status_not_initialized);
+
+        ROCSPARSE_CHECKARG(
+            3, mat, (mat->data_type != compute_type), rocsparse_status_not_implemented);
+        ROCSPARSE_CHECKARG(4, x, (x->data_type != compute_type), rocsparse_status_not_implemented);
+        ROCSPARSE_CHECKARG(6, y, (y->data_type != compute_type), rocsparse_status_not_implemented);
+
+        ROCSPARSE_CHECKARG(4, x, (x->size != mat->cols), rocsparse_status_invalid_size);
+        ROCSPARSE_CHECKARG(6, y, (y->size != mat->rows), rocsparse_status_invalid_size);
+
+        // x^H * y is only defined for square matrices
+        ROCSPARSE_CHECKARG(3,
+                           mat,
+                           (reduction == rocsparse_spmv_reduction_dot_xy && mat->rows != mat->cols),
+                           rocsparse_status_invalid_size);
+
+        return rocsparse_status_continue;
+    }
+}
+
+extern "C" rocsparse_status rocsparse_spmv_fused(rocsparse_handle            handle,
+                                                 rocsparse_operation         trans,
+                                                 const void*                 alpha,
+                                                 rocsparse_const_spmat_descr mat,
+                                                 rocsparse_const_dnvec_descr x,
+                                                 const void*                 beta,
+                                                 const rocsparse_dnvec_descr y,
+                                                 rocsparse_datatype          compute_type,
+                                                 rocsparse_spmv_alg          alg,
+                                                 rocsparse_spmv_reduction    reduction,
+                                                 void*                       result)
+try
+{
+    // Profiling
+    rocsparse::trace_scope trace(handle);
+
+    // Logging
+    rocsparse::log_trace(handle,
+                         "rocsparse_spmv_fused",
+                         trans,
+                         (const void*&)alpha,
+                         (const void*&)mat,
+                         (const void*&)x,
+                         (const void*&)beta,
+                         (const void*&)y,
+                         compute_type,
+                         alg,
+                         reduction,
+                         (const void*&)result);
+
+    const rocsparse_status status = rocsparse::spmv_fused_checkarg(
+        handle, trans, alpha, mat, x, beta, y, compute_type, alg, reduction, result);
+    if(status != rocsparse_status_continue)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(status);
+        return rocsparse_status_success;
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::spmv_fused_template_dispatch(mat->row_type,
+                                                                      mat->col_type,
+                                                                      compute_type,
+                                                                      handle,
+                                                                      trans,
+                                                                      alpha,
+                                                                      mat,
+                                                                      x,
+                                                                      beta,
+                                                                      y,
+                                                                      alg,
+                                                                      reduction,
+                                                                      result));
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
@@ -0,0 +1,527 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "control.h"
+#include "handle.h"
+#include "internal/generic/rocsparse_spmv.h"
+#include "utility.h"
+
+#include "rocsparse_csrmv.hpp"
+#include "semiring.h"
+
+namespace rocsparse
+{
+    // y = beta * y over the semiring, for matrices without entries
+    template <unsigned int BLOCKSIZE, typename S, typename I, typename T, typename U>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void spmv_semiring_scale(I m, U beta_device_host, T* __restrict__ y)
+    {
+        const I gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+        if(gid >= m)
+        {
+            return;
+        }
+
+        const T beta = rocsparse::load_scalar_device_host(beta_device_host);
+
+        y[gid] = (beta != S::template zero<T>()) ? S::mul(beta, y[gid]) : S::template zero<T>();
+    }
+
+    template <typename T, typename I, typename J, typename S>
+    static rocsparse_status spmv_semiring_template(rocsparse_handle            handle,
+                                                   rocsparse_operation         trans,
+                                                   const void*                 alpha,
+                                                   rocsparse_const_spmat_descr mat,
+                                                   rocsparse_const_dnvec_descr x,
+                                                   const void*                 beta,
+                                                   const rocsparse_dnvec_descr y,
+                                                   rocsparse_spmv_alg          alg,
+                                                   rocsparse_spmv_stage        stage,
+                                                   size_t*                     buffer_size,
+                                                   void*                       temp_buffer)
+    {
+        if(mat->format != rocsparse_format_csr || trans != rocsparse_operation_none)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_not_implemented);
+        }
+
+        if(mat->descr->type != rocsparse_matrix_type_general
+           && mat->descr->type != rocsparse_matrix_type_triangular)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_not_implemented);
+        }
+
+        // The stream algorithm has no semiring kernels
+        rocsparse_csrmv_alg csrmv_alg;
+        switch(alg)
+        {
+        case rocsparse_spmv_alg_default:
+        case rocsparse_spmv_alg_csr_adaptive:
+        {
+            csrmv_alg = rocsparse_csrmv_alg_adaptive;
+            break;
+        }
+        case rocsparse_spmv_alg_csr_lrb:
+        {
+            csrmv_alg = rocsparse_csrmv_alg_lrb;
+            break;
+        }
+        case rocsparse_spmv_alg_csr_stream:
+        case rocsparse_spmv_alg_csr_gather:
+        case rocsparse_spmv_alg_coo:
+        case rocsparse_spmv_alg_coo_atomic:
+        case rocsparse_spmv_alg_bsr:
+        case rocsparse_spmv_alg_ell:
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_not_implemented);
+        }
+        }
+
+        const J m   = (J)mat->rows;
+        const J n   = (J)mat->cols;
+        const I nnz = (I)mat->nnz;
+
+        switch(stage)
+        {
+        case rocsparse_spmv_stage_buffer_size:
+        {
+            *buffer_size = 0;
+            return rocsparse_status_success;
+        }
+
+        case rocsparse_spmv_stage_preprocess:
+        {
+            if(mat->analysed == false)
+            {
+                RETURN_IF_ROCSPARSE_ERROR(
+                    rocsparse::csrmv_analysis_template(handle,
+                                                       trans,
+                                                       csrmv_alg,
+                                                       m,
+                                                       n,
+                                                       nnz,
+                                                       mat->descr,
+                                                       (const T*)mat->const_val_data,
+                                                       (const I*)mat->const_row_data,
+                                                       (const J*)mat->const_col_data,
+                                                       mat->info));
+
+                mat->analysed = true;
+            }
+            return rocsparse_status_success;
+        }
+
+        case rocsparse_spmv_stage_compute:
+        {
+            if(m == 0)
+            {
+                return rocsparse_status_success;
+            }
+
+            // Without entries in A, only beta * y remains
+            if(n == 0 || nnz == 0)
+            {
+                if(handle->pointer_mode == rocsparse_pointer_mode_device)
+                {
+                    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::spmv_semiring_scale<256, S>),
+                                                       dim3((m - 1) / 256 + 1),
+                                                       dim3(256),
+                                                       0,
+                                                       handle->stream,
+                                                       m,
+                                                       (const T*)beta,
+                                                       (T*)y->values);
+                }
+                else
+                {
+                    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::spmv_semiring_scale<256, S>),
+                                                       dim3((m - 1) / 256 + 1),
+                                                       dim3(256),
+                                                       0,
+                                                       handle->stream,
+                                                       m,
+                                                       *(const T*)beta,
+                                                       (T*)y->values);
+                }
+                return rocsparse_status_success;
+            }
+
+            // The semiring kernels rely on the row partitioning of the analysis
+            if(mat->analysed == false || mat->info == nullptr
+               || mat->info->csrmv_info == nullptr)
+            {
+                RETURN_WITH_MESSAGE_IF_ROCSPARSE_ERROR(
+                    rocsparse_status_invalid_value,
+                    "rocsparse_spmv_stage_preprocess has not been executed");
+            }
+
+            if(handle->pointer_mode == rocsparse_pointer_mode_device)
+            {
+                if(csrmv_alg == rocsparse_csrmv_alg_adaptive)
+                {
+                    RETURN_IF_ROCSPARSE_ERROR((
+                        rocsparse::csrmv_adaptive_template_dispatch<T, I, J, T, T, T, const T*, S>(
+                            handle,
+                            trans,
+                            m,
+                            n,
+                            nnz,
+                            (const T*)alpha,
+                            mat->descr,
+                            (const T*)mat->const_val_data,
+                            (const I*)mat->const_row_data,
+                            (const J*)mat->const_col_data,
+                            mat->info->csrmv_info,
+                            (const T*)x->const_values,
+                            (const T*)beta,
+                            (T*)y->values,
+                            false)));
+                }
+                else
+                {
+                    RETURN_IF_ROCSPARSE_ERROR(
+                        (rocsparse::csrmv_lrb_template_dispatch<T, I, J, T, T, T, const T*, S>(
+                            handle,
+                            trans,
+                            m,
+                            n,
+                            nnz,
+                            (const T*)alpha,
+                            mat->descr,
+                            (const T*)mat->const_val_data,
+                            (const I*)mat->const_row_data,
+                            (const J*)mat->const_col_data,
+                            mat->info->csrmv_info,
+                            (const T*)x->const_values,
+                            (const T*)beta,
+                            (T*)y->values,
+                            false)));
+                }
+            }
+            else
+            {
+                if(csrmv_alg == rocsparse_csrmv_alg_adaptive)
+                {
+                    RETURN_IF_ROCSPARSE_ERROR(
+                        (rocsparse::csrmv_adaptive_template_dispatch<T, I, J, T, T, T, T, S>(
+                            handle,
+                            trans,
+                            m,
+                            n,
+                            nnz,
+                            *(const T*)alpha,
+                            mat->descr,
+                            (const T*)mat->const_val_data,
+                            (const I*)mat->const_row_data,
+                            (const J*)mat->const_col_data,
+                            mat->info->csrmv_info,
+                            (const T*)x->const_values,
+                            *(const T*)beta,
+                            (T*)y->values,
+                            false)));
+                }
+                else
+                {
+                    RETURN_IF_ROCSPARSE_ERROR(
+                        (rocsparse::csrmv_lrb_template_dispatch<T, I, J, T, T, T, T, S>(
+                            handle,
+                            trans,
+                            m,
+                            n,
+                            nnz,
+                            *(const T*)alpha,
+                            mat->descr,
+                            (const T*)mat->const_val_data,
+                            (const I*)mat->const_row_data,
+                            (const J*)mat->const_col_data,
+                            mat->info->csrmv_info,
+                            (const T*)x->const_values,
+                            *(const T*)beta,
+                            (T*)y->values,
+                            false)));
+                }
+            }
+            return rocsparse_status_success;
+        }
+        }
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_invalid_value);
+    }
+
+    template <typename T, typename I, typename J, typename... Ts>
+    static rocsparse_status spmv_semiring_dispatch(rocsparse_semiring semiring, Ts&&... params)
+    {
+        switch(semiring)
+        {
+        case rocsparse_semiring_plus_times:
+        {
+            RETURN_IF_ROCSPARSE_ERROR(
+                (rocsparse::spmv_semiring_template<T, I, J, rocsparse::plus_times_semiring>(
+                    params...)));
+            return rocsparse_status_success;
+        }
+        case rocsparse_semiring_min_plus:
+        {
+            RETURN_IF_ROCSPARSE_ERROR(
+                (rocsparse::spmv_semiring_template<T, I, J, rocsparse::min_plus_semiring>(
+                    params...)));
+            return rocsparse_status_success;
+        }
+        case rocsparse_semiring_max_times:
+        {
+            RETURN_IF_ROCSPARSE_ERROR(
+                (rocsparse::spmv_semiring_template<T, I, J, rocsparse::max_times_semiring>(
+                    params...)));
+            return rocsparse_status_success;
+        }
+        case rocsparse_semiring_max_min:
+        {
+            RETURN_IF_ROCSPARSE_ERROR(
+                (rocsparse::spmv_semiring_template<T, I, J, rocsparse::max_min_semiring>(
+                    params...)));
+            return rocsparse_status_success;
+        }
+        case rocsparse_semiring_or_and:
+        {
+            RETURN_IF_ROCSPARSE_ERROR(
+                (rocsparse::spmv_semiring_template<T, I, J, rocsparse::or_and_semiring>(
+                    params...)));
+            return rocsparse_status_success;
+        }
+        }
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_invalid_value);
+    }
+
+    template <typename... Ts>
+    static rocsparse_status spmv_semiring_template_dispatch(rocsparse_indextype itype,
+                                                            rocsparse_indextype jtype,
+                                                            rocsparse_datatype  ctype,
+                                                            Ts&&... params)
+    {
+#define DISPATCH_COMPUTE_TYPE(ITYPE, JTYPE)                                                   \
+    switch(ctype)                                                                             \
+    {                                                                                         \
+    case rocsparse_datatype_f32_r:                                                            \
+    {                                                                                         \
+        RETURN_IF_ROCSPARSE_ERROR((rocsparse::spmv_semiring_dispatch<float, ITYPE, JTYPE>(    \
+            params...)));                                                                     \
+        return rocsparse_status_success;                                                      \
+    }                                                                                         \
+    case rocsparse_datatype_f64_r:                                                            \
+    {                                                                                         \
+        RETURN_IF_ROCSPARSE_ERROR((rocsparse::spmv_semiring_dispatch<double, ITYPE, JTYPE>(   \
+            params...)));                                                                     \
+        return rocsparse_status_success;                                                      \
+    }                                                                                         \
+    case rocsparse_datatype_f32_c:                                                            \
+    case rocsparse_datatype_f64_c:                                                            \
+    case rocsparse_datatype_i8_r:                                                             \
+    case rocsparse_datatype_u8_r:                                                             \
+    case rocsparse_datatype_i32_r:                                                            \
+    case rocsparse_datatype_u32_r:                                                            \
+    {                                                                                         \
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_not_implemented);                          \
+    }                                                                                         \
+    }
+
+        switch(itype)
+        {
+        case rocsparse_indextype_u16:
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_not_implemented);
+        }
+        case rocsparse_indextype_i32:
+        {
+            switch(jtype)
+            {
+            case rocsparse_indextype_u16:
+            case rocsparse_indextype_i64:
+            {
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_not_implemented);
+            }
+            case rocsparse_indextype_i32:
+            {
+                DISPATCH_COMPUTE_TYPE(int32_t, int32_t);
+            }
+            }
+        }
+        case rocsparse_indextype_i64:
+        {
+            switch(jtype)
+            {
+            case rocsparse_indextype_u16:
+            {
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_not_implemented);
+            }
+            case rocsparse_indextype_i32:
+            {
+                DISPATCH_COMPUTE_TYPE(int64_t, int32_t);
+            }
+            case rocsparse_indextype_i64:
+            {
+                DISPATCH_COMPUTE_TYPE(int64_t, int64_t);
+            }
+            }
+        }
+        }
+#undef DISPATCH_COMPUTE_TYPE
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_invalid_value);
+    }
+
+    static rocsparse_status spmv_semiring_checkarg(rocsparse_handle            handle, //0
+                                                   rocsparse_operation         trans, //1
+                                                   const void*                 alpha, //2
+                                                   rocsparse_const_spmat_descr mat, //3
+                                                   rocsparse_const_dnvec_descr x, //4
+                                                   const void*                 beta, //5
+                                                   const rocsparse_dnvec_descr y, //6
+                                                   rocsparse_datatype          compute_type, //7
+                                                   rocsparse_spmv_alg          alg, //8
+                                                   rocsparse_semiring          semiring, //9
+                                                   rocsparse_spmv_stage        stage, //10
+                                                   size_t*                     buffer_size, //11
+                                                   void*                       temp_buffer) //12
+    {
+        ROCSPARSE_CHECKARG_HANDLE(0, handle);
+        ROCSPARSE_CHECKARG_ENUM(1, trans);
+        ROCSPARSE_CHECKARG_POINTER(3, mat);
+        ROCSPARSE_CHECKARG_POINTER(4, x);
+        ROCSPARSE_CHECKARG_POINTER(6, y);
+        ROCSPARSE_CHECKARG_ENUM(7, compute_type);
+        ROCSPARSE_CHECKARG_ENUM(8, alg);
+        ROCSPARSE_CHECKARG_ENUM(9, semiring);
+        ROCSPARSE_CHECKARG_ENUM(10, stage);
+
+        switch(stage)
+        {
+        case rocsparse_spmv_stage_buffer_size:
+        {
+            ROCSPARSE_CHECKARG_POINTER(11, buffer_size);
+            break;
+        }
+        case rocsparse_spmv_stage_compute:
+        {
+            ROCSPARSE_CHECKARG_POINTER(2, alpha);
+            ROCSPARSE_CHECKARG_POINTER(5, beta);
+            break;
+        }
+        case rocsparse_spmv_stage_preprocess:
+        {
+            break;
+        }
+        }
+
+        ROCSPARSE_CHECKARG(3, mat, (mat->init == false), rocsparse_status_not_initialized);
+        ROCSPARSE_CHECKARG(4, x, (x->init == false), rocsparse_status_not_initialized);
+        ROCSPARSE_CHECKARG(6, y, (y->init == false), rocsparse_status_not_initialized);
+
+        ROCSPARSE_CHECKARG(
+            3, mat, (mat->data_type != compute_type), rocsparse_status_not_implemented);
+        ROCSPARSE_CHECKARG(4, x, (x->data_type != compute_type), rocsparse_status_not_implemented);
+        ROCSPARSE_CHECKARG(6, y, (y->data_type != compute_type), rocsparse_status_not_implemented);
+
+        ROCSPARSE_CHECKARG(4, x, (x->size != mat->cols), rocsparse_status_invalid_size);
+        ROCSPARSE_CHECKARG(6, y, (y->size != mat->rows), rocsparse_status_invalid_size);
+
+        return rocsparse_status_continue;
+    }
+}
+
+extern "C" rocsparse_status rocsparse_spmv_semiring(rocsparse_handle            handle,
+                                                    rocsparse_operation         trans,
+                                                    const void*                 alpha,
+                                                    rocsparse_const_spmat_descr mat,
+                                                    rocsparse_const_dnvec_descr x,
+                                                    const void*                 beta,
+                                                    const rocsparse_dnvec_descr y,
+                                                    rocsparse_datatype          compute_type,
+                                                    rocsparse_spmv_alg          alg,
+                                                    rocsparse_semiring          semiring,
+                                                    rocsparse_spmv_stage        stage,
+                                                    size_t*                     buffer_size,
+                                                    void*                       temp_buffer)
+try
+{
+    // Profiling
+    rocsparse::trace_scope trace(handle);
+
+    // Logging
+    rocsparse::log_trace(handle,
+                         "rocsparse_spmv_semiring",
+                         trans,
+                         (const void*&)alpha,
+                         (const void*&)mat,
+                         (const void*&)x,
+                         (const void*&)beta,
+                         (const void*&)y,
+                         compute_type,
+                         alg,
+                         semiring,
+                         stage,
+                         (const void*&)buffer_size,
+                         (const void*&)temp_buffer);
+
+    const rocsparse_status status = rocsparse::spmv_semiring_checkarg(handle,
+                                                                      trans,
+                                                                      alpha,
+                                                                      mat,
+                                                                      x,
+                                                                      beta,
+                                                                      y,
+                                                                      compute_type,
+                                                                      alg,
+                                                                      semiring,
+                                                                      stage,
+                                                                      buffer_size,
+                                                                      temp_buffer);
+    if(status != rocsparse_status_continue)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(status);
+        return rocsparse_status_success;
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::spmv_semiring_template_dispatch(mat->row_type,
+                                                                         mat->col_type,
+                                                                         compute_type,
+                                                                         semiring,
+                                                                         handle,
+                                                                         trans,
+                                                                         alpha,
+                                                                         mat,
+                                                                         x,
+                                                                         beta,
+                                                                         y,
+                                                                         alg,
+                                                                         stage,
+                                                                         buffer_size,
+                                                                         temp_buffer));
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
@@ -289,6 +289,9 @@ extern "C" rocsparse_status rocsparse_spsv(rocsparse_handle            handle, /
                                            void*                       temp_buffer) // 10
 try
 {
+    // Profiling
+    rocsparse::trace_scope trace(handle);
+
     // Check for invalid handle
     ROCSPARSE_CHECKARG_HANDLE(0, handle);
 
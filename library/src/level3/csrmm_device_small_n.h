@@ -0,0 +1,132 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "common.h"
+
+namespace rocsparse
+{
+    // Computes C = alpha * A * op(B) + beta * C for a small number n <= NCOL of columns of
+    // op(B) and C. Each sub-wavefront processes one row of A and keeps the NCOL partial
+    // sums in registers, such that A is read once for all columns. Entry (j, p) of op(B)
+    // is dense_B[j * ldb_row + p * ldb_col], which covers row and column ordered B.
+    template <unsigned int BLOCKSIZE,
+              unsigned int WF_SIZE,
+              unsigned int NCOL,
+              typename T,
+              typename I,
+              typename J,
+              typename A,
+              typename B,
+              typename C>
+    ROCSPARSE_DEVICE_ILF void csrmmnx_small_n_device(bool conj_A,
+                                                     bool conj_B,
+                                                     J    M,
+                                                     J    N,
+                                                     T    alpha,
+                                                     const I* __restrict__ csr_row_ptr,
+                                                     const J* __restrict__ csr_col_ind,
+                                                     const A* __restrict__ csr_val,
+                                                     const B* __restrict__ dense_B,
+                                                     int64_t ldb_row,
+                                                     int64_t ldb_col,
+                                                     T       beta,
+                                                     C* __restrict__ dense_C,
+                                                     int64_t              ldc,
+                                                     rocsparse_order      order_C,
+                                                     rocsparse_index_base idx_base)
+    {
+        const int tid = hipThreadIdx_x;
+        const J   gid = hipBlockIdx_x * BLOCKSIZE + tid;
+        const int lid = tid & (WF_SIZE - 1);
+        const J   row = gid / WF_SIZE;
+
+        if(row >= M)
+        {
+            return;
+        }
+
+        const I row_start = csr_row_ptr[row] - idx_base;
+        const I row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        T sum[NCOL]{};
+
+        for(I j = row_start + lid; j < row_end; j += WF_SIZE)
+        {
+            const int64_t col = csr_col_ind[j] - idx_base;
+            const T       val = conj_val(csr_val[j], conj_A);
+
+            const B* __restrict__ dense_B_row = dense_B + col * ldb_row;
+
+#pragma unroll
+            for(unsigned int p = 0; p < NCOL; p++)
+            {
+                if(static_cast<J>(p) < N)
+                {
+                    sum[p] = rocsparse::fma<T>(
+                        val, conj_val(rocsparse::ldg(dense_B_row + p * ldb_col), conj_B), sum[p]);
+                }
+            }
+        }
+
+#pragma unroll
+        for(unsigned int p = 0; p < NCOL; p++)
+        {
+            sum[p] = rocsparse::wfreduce_sum<WF_SIZE>(sum[p]);
+        }
+
+        if(lid == WF_SIZE - 1)
+        {
+            const int64_t row_stride = (order_C == rocsparse_order_column) ? 1 : ldc;
+            const int64_t col_stride = (order_C == rocsparse_order_column) ? ldc : 1;
+
+            C* __restrict__ dense_C_row = dense_C + row * row_stride;
+
+            if(beta == static_cast<T>(0))
+            {
+#pragma unroll
+                for(unsigned int p = 0; p < NCOL; p++)
+                {
+                    if(static_cast<J>(p) < N)
+                    {
+                        dense_C_row[p * col_stride] = alpha * sum[p];
+                    }
+                }
+            }
+            else
+            {
+#pragma unroll
+                for(unsigned int p = 0; p < NCOL; p++)
+                {
+                    if(static_cast<J>(p) < N)
+                    {
+                        dense_C_row[p * col_stride] = rocsparse::fma<T>(
+                            beta, dense_C_row[p * col_stride], alpha * sum[p]);
+                    }
+                }
+            }
+        }
+    }
+}
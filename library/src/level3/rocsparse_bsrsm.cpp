@@ -65,6 +65,9 @@ try
         return rocsparse_status_success;
     }
 
+    // Reading the pivot back blocks the host
+    RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
     // Differentiate between pointer modes
     if(handle->pointer_mode == rocsparse_pointer_mode_device)
     {
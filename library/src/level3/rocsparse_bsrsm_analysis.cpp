@@ -186,6 +186,9 @@ rocsparse_status rocsparse::bsrsm_analysis_core(rocsparse_handle          handle
         // User is explicitly asking to force a re-analysis, or no valid data has been
         // found to be re-used
 
+        // The analysis reads its meta data back on the host
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
         // Clear bsrsm info
         RETURN_IF_ROCSPARSE_ERROR(rocsparse::destroy_trm_info((trans_A == rocsparse_operation_none)
                                                                   ? info->bsrsm_upper_info
@@ -262,6 +265,9 @@ rocsparse_status rocsparse::bsrsm_analysis_core(rocsparse_handle          handle
         // User is explicitly asking to force a re-analysis, or no valid data has been
         // found to be re-used
 
+        // The analysis reads its meta data back on the host
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
         // Clear bsrsm info
         RETURN_IF_ROCSPARSE_ERROR(rocsparse::destroy_trm_info((trans_A == rocsparse_operation_none)
                                                                   ? info->bsrsm_lower_info
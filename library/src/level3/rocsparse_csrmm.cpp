@@ -108,6 +108,50 @@ namespace rocsparse
                                           void*                     temp_buffer,
                                           bool                      force_conj_A);
 
+    template <typename T, typename I, typename J, typename A, typename B, typename C, typename U>
+    rocsparse_status csrmm_template_small_n(rocsparse_handle          handle,
+                                            rocsparse_operation       trans_A,
+                                            rocsparse_operation       trans_B,
+                                            J                         m,
+                                            J                         n,
+                                            J                         k,
+                                            I                         nnz,
+                                            U                         alpha,
+                                            const rocsparse_mat_descr descr,
+                                            const A*                  csr_val,
+                                            const I*                  csr_row_ptr,
+                                            const J*                  csr_col_ind,
+                                            const B*                  dense_B,
+                                            int64_t                   ldb,
+                                            rocsparse_order           order_B,
+                                            U                         beta,
+                                            C*                        dense_C,
+                                            int64_t                   ldc,
+                                            rocsparse_order           order_C,
+                                            bool                      force_conj_A);
+
+    // The small n kernels read A once for all columns of C, while the general and row split
+    // kernels read A once per column, or once per eight columns if op(B) is column ordered.
+    // Merge is left untouched, since its analysis has already been paid for.
+    static bool csrmm_use_small_n(rocsparse_csrmm_alg alg,
+                                  rocsparse_operation trans_A,
+                                  rocsparse_operation trans_B,
+                                  rocsparse_order     order_B,
+                                  int64_t             n,
+                                  int64_t             batch_count_C)
+    {
+        if(alg == rocsparse_csrmm_alg_merge || trans_A != rocsparse_operation_none
+           || batch_count_C != 1 || n < 2)
+        {
+            return false;
+        }
+
+        const bool column_B
+            = (order_B == rocsparse_order_column) == (trans_B == rocsparse_operation_none);
+
+        return n <= (column_B ? 8 : 16);
+    }
+
     template <typename T, typename I, typename J, typename A, typename B, typename C, typename U>
     rocsparse_status csrmm_template_dispatch(rocsparse_handle    handle,
                                              rocsparse_operation trans_A,
@@ -139,6 +183,31 @@ namespace rocsparse
                                              void*                     temp_buffer,
                                              bool                      force_conj_A)
     {
+        if(rocsparse::csrmm_use_small_n(alg, trans_A, trans_B, order_B, n, batch_count_C))
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse::csrmm_template_small_n<T>(handle,
+                                                                           trans_A,
+                                                                           trans_B,
+                                                                           m,
+                                                                           n,
+                                                                           k,
+                                                                           nnz,
+                                                                           alpha,
+                                                                           descr,
+                                                                           csr_val,
+                                                                           csr_row_ptr,
+                                                                           csr_col_ind,
+                                                                           dense_B,
+                                                                           ldb,
+                                                                           order_B,
+                                                                           beta,
+                                                                           dense_C,
+                                                                           ldc,
+                                                                           order_C,
+                                                                           force_conj_A));
+            return rocsparse_status_success;
+        }
+
         switch(alg)
         {
         case rocsparse_csrmm_alg_default:
@@ -0,0 +1,329 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "utility.h"
+
+#include "csrmm_device_small_n.h"
+
+namespace rocsparse
+{
+    template <unsigned int BLOCKSIZE,
+              unsigned int WF_SIZE,
+              unsigned int NCOL,
+              typename I,
+              typename J,
+              typename A,
+              typename B,
+              typename C,
+              typename U>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void csrmmnx_small_n_kernel(bool conj_A,
+                                bool conj_B,
+                                J    m,
+                                J    n,
+                                U    alpha_device_host,
+                                const I* __restrict__ csr_row_ptr,
+                                const J* __restrict__ csr_col_ind,
+                                const A* __restrict__ csr_val,
+                                const B* __restrict__ dense_B,
+                                int64_t ldb_row,
+                                int64_t ldb_col,
+                                U       beta_device_host,
+                                C* __restrict__ dense_C,
+                                int64_t              ldc,
+                                rocsparse_order      order_C,
+                                rocsparse_index_base idx_base)
+    {
+        const auto alpha = rocsparse::load_scalar_device_host(alpha_device_host);
+        const auto beta  = rocsparse::load_scalar_device_host(beta_device_host);
+        if(alpha == 0 && beta == 1)
+        {
+            return;
+        }
+
+        rocsparse::csrmmnx_small_n_device<BLOCKSIZE, WF_SIZE, NCOL>(conj_A,
+                                                                    conj_B,
+                                                                    m,
+                                                                    n,
+                                                                    alpha,
+                                                                    csr_row_ptr,
+                                                                    csr_col_ind,
+                                                                    csr_val,
+                                                                    dense_B,
+                                                                    ldb_row,
+                                                                    ldb_col,
+                                                                    beta,
+                                                                    dense_C,
+                                                                    ldc,
+                                                                    order_C,
+                                                                    idx_base);
+    }
+
+#define LAUNCH_CSRMMNX_SMALL_N_KERNEL(CSRMMNX_DIM, WF_SIZE, NCOL)        \
+    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(                                  \
+        (rocsparse::csrmmnx_small_n_kernel<CSRMMNX_DIM, WF_SIZE, NCOL>), \
+        dim3((m - 1) / (CSRMMNX_DIM / WF_SIZE) + 1),                     \
+        dim3(CSRMMNX_DIM),                                               \
+        0,                                                               \
+        handle->stream,                                                  \
+        conj_A,                                                          \
+        conj_B,                                                          \
+        m,                                                               \
+        n,                                                               \
+        alpha_device_host,                                               \
+        csr_row_ptr,                                                     \
+        csr_col_ind,                                                     \
+        csr_val,                                                         \
+        dense_B,                                                         \
+        ldb_row,                                                         \
+        ldb_col,                                                         \
+        beta_device_host,                                                \
+        dense_C,                                                         \
+        ldc,                                                             \
+        order_C,                                                         \
+        descr->base)
+
+#define LAUNCH_CSRMMNX_SMALL_N_NCOL(WF_SIZE)             \
+    if(n <= 2)                                           \
+    {                                                    \
+        LAUNCH_CSRMMNX_SMALL_N_KERNEL(256, WF_SIZE, 2);  \
+    }                                                    \
+    else if(n <= 4)                                      \
+    {                                                    \
+        LAUNCH_CSRMMNX_SMALL_N_KERNEL(256, WF_SIZE, 4);  \
+    }                                                    \
+    else if(n <= 8)                                      \
+    {                                                    \
+        LAUNCH_CSRMMNX_SMALL_N_KERNEL(256, WF_SIZE, 8);  \
+    }                                                    \
+    else                                                 \
+    {                                                    \
+        LAUNCH_CSRMMNX_SMALL_N_KERNEL(256, WF_SIZE, 16); \
+    }
+
+    template <typename T, typename I, typename J, typename A, typename B, typename C, typename U>
+    rocsparse_status csrmm_template_small_n(rocsparse_handle          handle,
+                                            rocsparse_operation       trans_A,
+                                            rocsparse_operation       trans_B,
+                                            J                         m,
+                                            J                         n,
+                                            J                         k,
+                                            I                         nnz,
+                                            U                         alpha_device_host,
+                                            const rocsparse_mat_descr descr,
+                                            const A*                  csr_val,
+                                            const I*                  csr_row_ptr,
+                                            const J*                  csr_col_ind,
+                                            const B*                  dense_B,
+                                            int64_t                   ldb,
+                                            rocsparse_order           order_B,
+                                            U                         beta_device_host,
+                                            C*                        dense_C,
+                                            int64_t                   ldc,
+                                            rocsparse_order           order_C,
+                                            bool                      force_conj_A)
+    {
+        if(trans_A != rocsparse_operation_none || n > 16)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_not_implemented);
+        }
+
+        const bool conj_A = force_conj_A;
+        const bool conj_B = (trans_B == rocsparse_operation_conjugate_transpose);
+
+        // Entry (j, p) of op(B) is dense_B[j * ldb_row + p * ldb_col]
+        const bool column_B
+            = (order_B == rocsparse_order_column) == (trans_B == rocsparse_operation_none);
+        const int64_t ldb_row = column_B ? 1 : ldb;
+        const int64_t ldb_col = column_B ? ldb : 1;
+
+        // Average nnz per row of A
+        const I avg_row_nnz = (nnz - 1) / m + 1;
+
+        // Launch appropriate kernel depending on row nnz of A and number of columns of C
+        if(avg_row_nnz < 16)
+        {
+            LAUNCH_CSRMMNX_SMALL_N_NCOL(8);
+        }
+        else if(avg_row_nnz < 32)
+        {
+            LAUNCH_CSRMMNX_SMALL_N_NCOL(16);
+        }
+        else if(avg_row_nnz < 64 || handle->wavefront_size == 32)
+        {
+            LAUNCH_CSRMMNX_SMALL_N_NCOL(32);
+        }
+        else if(handle->wavefront_size == 64)
+        {
+            LAUNCH_CSRMMNX_SMALL_N_NCOL(64);
+        }
+        else
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_arch_mismatch);
+        }
+
+        return rocsparse_status_success;
+    }
+}
+
+#undef LAUNCH_CSRMMNX_SMALL_N_NCOL
+#undef LAUNCH_CSRMMNX_SMALL_N_KERNEL
+
+#define INSTANTIATE(TTYPE, ITYPE, JTYPE, ATYPE, BTYPE, CTYPE, UTYPE)    \
+    template rocsparse_status rocsparse::csrmm_template_small_n<TTYPE>( \
+        rocsparse_handle          handle,                               \
+        rocsparse_operation       trans_A,                              \
+        rocsparse_operation       trans_B,                              \
+        JTYPE                     m,                                    \
+        JTYPE                     n,                                    \
+        JTYPE                     k,                                    \
+        ITYPE                     nnz,                                  \
+        UTYPE                     alpha_device_host,                    \
+        const rocsparse_mat_descr descr,                                \
+        const ATYPE*              csr_val,                              \
+        const ITYPE*              csr_row_ptr,                          \
+        const JTYPE*              csr_col_ind,                          \
+        const BTYPE*              dense_B,                              \
+        int64_t                   ldb,                                  \
+        rocsparse_order           order_B,                              \
+        UTYPE                     beta_device_host,                     \
+        CTYPE*                    dense_C,                              \
+        int64_t                   ldc,                                  \
+        rocsparse_order           order_C,                              \
+        bool                      force_conj_A)
+
+// Uniform precisions
+INSTANTIATE(float, int32_t, int32_t, float, float, float, float);
+INSTANTIATE(float, int64_t, int32_t, float, float, float, float);
+INSTANTIATE(float, int64_t, int64_t, float, float, float, float);
+INSTANTIATE(double, int32_t, int32_t, double, double, double, double);
+INSTANTIATE(double, int64_t, int32_t, double, double, double, double);
+INSTANTIATE(double, int64_t, int64_t, double, double, double, double);
+INSTANTIATE(rocsparse_float_complex,
+            int32_t,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(rocsparse_float_complex,
+            int64_t,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(rocsparse_float_complex,
+            int64_t,
+            int64_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int32_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int64_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(rocsparse_double_complex,
+            int64_t,
+            int64_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+
+INSTANTIATE(float, int32_t, int32_t, float, float, float, const float*);
+INSTANTIATE(float, int64_t, int32_t, float, float, float, const float*);
+INSTANTIATE(float, int64_t, int64_t, float, float, float, const float*);
+INSTANTIATE(double, int32_t, int32_t, double, double, double, const double*);
+INSTANTIATE(double, int64_t, int32_t, double, double, double, const double*);
+INSTANTIATE(double, int64_t, int64_t, double, double, double, const double*);
+INSTANTIATE(rocsparse_float_complex,
+            int32_t,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            const rocsparse_float_complex*);
+INSTANTIATE(rocsparse_float_complex,
+            int64_t,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            const rocsparse_float_complex*);
+INSTANTIATE(rocsparse_float_complex,
+            int64_t,
+            int64_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            const rocsparse_float_complex*);
+INSTANTIATE(rocsparse_double_complex,
+            int32_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            const rocsparse_double_complex*);
+INSTANTIATE(rocsparse_double_complex,
+            int64_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            const rocsparse_double_complex*);
+INSTANTIATE(rocsparse_double_complex,
+            int64_t,
+            int64_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            const rocsparse_double_complex*);
+
+// Mixed Precisions
+INSTANTIATE(int32_t, int32_t, int32_t, int8_t, int8_t, int32_t, int32_t);
+INSTANTIATE(int32_t, int64_t, int32_t, int8_t, int8_t, int32_t, int32_t);
+INSTANTIATE(int32_t, int64_t, int64_t, int8_t, int8_t, int32_t, int32_t);
+INSTANTIATE(float, int32_t, int32_t, int8_t, int8_t, float, float);
+INSTANTIATE(float, int64_t, int32_t, int8_t, int8_t, float, float);
+INSTANTIATE(float, int64_t, int64_t, int8_t, int8_t, float, float);
+
+INSTANTIATE(int32_t, int32_t, int32_t, int8_t, int8_t, int32_t, const int32_t*);
+INSTANTIATE(int32_t, int64_t, int32_t, int8_t, int8_t, int32_t, const int32_t*);
+INSTANTIATE(int32_t, int64_t, int64_t, int8_t, int8_t, int32_t, const int32_t*);
+INSTANTIATE(float, int32_t, int32_t, int8_t, int8_t, float, const float*);
+INSTANTIATE(float, int64_t, int32_t, int8_t, int8_t, float, const float*);
+INSTANTIATE(float, int64_t, int64_t, int8_t, int8_t, float, const float*);
+#undef INSTANTIATE
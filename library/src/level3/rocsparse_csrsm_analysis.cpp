@@ -122,6 +122,9 @@ rocsparse_status rocsparse::csrsm_analysis_core(rocsparse_handle          handle
         // User is explicitly asking to force a re-analysis, or no valid data has been
         // found to be re-used
 
+        // The analysis reads its meta data back on the host
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
         // Clear csrsm info
         RETURN_IF_ROCSPARSE_ERROR(rocsparse::destroy_trm_info((trans_A == rocsparse_operation_none)
                                                                   ? info->csrsm_upper_info
@@ -211,6 +214,9 @@ rocsparse_status rocsparse::csrsm_analysis_core(rocsparse_handle          handle
         // User is explicitly asking to force a re-analysis, or no valid data has been
         // found to be re-used
 
+        // The analysis reads its meta data back on the host
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
         // Clear csrsm info
         RETURN_IF_ROCSPARSE_ERROR(rocsparse::destroy_trm_info((trans_A == rocsparse_operation_none)
                                                                   ? info->csrsm_lower_info
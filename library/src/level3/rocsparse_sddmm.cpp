@@ -723,6 +723,9 @@ extern "C" rocsparse_status rocsparse_sddmm(rocsparse_handle            handle,
                                             void*                       temp_buffer) //19
 try
 {
+    // Profiling
+    rocsparse::trace_scope trace(handle);
+
 
     // Logging
     rocsparse::log_trace(handle,
@@ -152,6 +152,13 @@ namespace rocsparse
         {
         case rocsparse_format_csr:
         {
+            // Column indices and values with different batch strides are only supported by
+            // rocsparse_spmv
+            if(mat_A->columns_batch_stride != mat_A->columns_values_batch_stride)
+            {
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_not_implemented);
+            }
+
             rocsparse_csrmm_alg csrmm_alg;
             RETURN_IF_ROCSPARSE_ERROR((rocsparse::spmm_alg2csrmm_alg(alg, csrmm_alg)));
 
@@ -842,6 +849,9 @@ extern "C" rocsparse_status rocsparse_spmm(rocsparse_handle            handle, /
                                            void*                       temp_buffer) //12
 try
 {
+    // Profiling
+    rocsparse::trace_scope trace(handle);
+
     rocsparse::log_trace(handle,
                          "rocsparse_spmm",
                          trans_A,
@@ -872,6 +872,9 @@ extern "C" rocsparse_status rocsparse_spsm(rocsparse_handle            handle, /
                                            void*                       temp_buffer) //11
 try
 {
+    // Profiling
+    rocsparse::trace_scope trace(handle);
+
 
     rocsparse::log_trace(handle,
                          "rocsparse_spsm",
@@ -0,0 +1,352 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "common.h"
+
+namespace rocsparse
+{
+    // In-place Gauss-Jordan inversion with partial pivoting of the leading
+    // block_dim x block_dim part of the BSRDIM x BSRDIM shared memory block sM.
+    // Each block is processed by BSRDIM consecutive threads, where thread lid
+    // eliminates row lid and interchanges column lid. The remaining part of sM
+    // has to be the identity. Loop bounds only depend on block_dim, such that all
+    // threads of the thread block reach the same barriers. Returns true if the
+    // block is singular.
+    template <unsigned int BSRDIM, typename T>
+    ROCSPARSE_DEVICE_ILF bool bjac_gauss_jordan_device(rocsparse_int block_dim,
+                                                       rocsparse_int lid,
+                                                       T (*sM)[BSRDIM + 1],
+                                                       rocsparse_int* sperm)
+    {
+        bool singular = false;
+
+        for(rocsparse_int k = 0; k < block_dim; ++k)
+        {
+            // Pivot search in column k, done redundantly by each thread of the group
+            rocsparse_int p    = k;
+            auto          pmax = rocsparse::abs(sM[k][k]);
+
+            for(rocsparse_int i = k + 1; i < block_dim; ++i)
+            {
+                auto val = rocsparse::abs(sM[i][k]);
+
+                if(val > pmax)
+                {
+                    p    = i;
+                    pmax = val;
+                }
+            }
+
+            singular = singular || (pmax == 0);
+
+            T inv = (pmax == 0) ? static_cast<T>(1) : static_cast<T>(1) / sM[p][k];
+
+            __syncthreads();
+
+            // Interchange rows k and p
+            if(lid < block_dim && p != k)
+            {
+                T tmp      = sM[k][lid];
+                sM[k][lid] = sM[p][lid];
+                sM[p][lid] = tmp;
+            }
+
+            if(lid == 0)
+            {
+                sperm[k] = p;
+            }
+
+            __syncthreads();
+
+            // Scale pivot row
+            if(lid < block_dim)
+            {
+                sM[k][lid] = (lid == k) ? inv : sM[k][lid] * inv;
+            }
+
+            __syncthreads();
+
+            // Eliminate column k from all other rows
+            if(lid < block_dim && lid != k)
+            {
+                T f = sM[lid][k];
+
+                for(rocsparse_int j = 0; j < block_dim; ++j)
+                {
+                    if(j != k)
+                    {
+                        sM[lid][j] = rocsparse::fma(-f, sM[k][j], sM[lid][j]);
+                    }
+                }
+
+                sM[lid][k] = -f * inv;
+            }
+
+            __syncthreads();
+        }
+
+        // Undo the row interchanges by interchanging the columns in reverse order
+        if(lid < block_dim)
+        {
+            for(rocsparse_int k = block_dim - 1; k >= 0; --k)
+            {
+                rocsparse_int p = sperm[k];
+
+                if(p != k)
+                {
+                    T tmp      = sM[lid][k];
+                    sM[lid][k] = sM[lid][p];
+                    sM[lid][p] = tmp;
+                }
+            }
+        }
+
+        return singular;
+    }
+
+    // Write the inverted block, flag singular blocks
+    template <unsigned int BSRDIM, typename T>
+    ROCSPARSE_DEVICE_ILF void bjac_store_device(rocsparse_direction  dir,
+                                                rocsparse_int        block,
+                                                rocsparse_int        block_dim,
+                                                rocsparse_int        lid,
+                                                bool                 singular,
+                                                T (*sM)[BSRDIM + 1],
+                                                T*                   inv_diag_val,
+                                                rocsparse_int*       singular_block,
+                                                rocsparse_index_base idx_base)
+    {
+        if(lid < block_dim)
+        {
+            for(rocsparse_int j = 0; j < block_dim; ++j)
+            {
+                inv_diag_val[BSR_IND(int64_t(block), lid, j, dir)] = sM[lid][j];
+            }
+        }
+
+        if(singular && lid == 0)
+        {
+            rocsparse::atomic_min(singular_block, block + idx_base);
+        }
+    }
+
+    template <unsigned int BLOCKSIZE, unsigned int BSRDIM, typename T>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void bsrbjac_setup_kernel(rocsparse_direction dir,
+                              rocsparse_int       mb,
+                              const rocsparse_int* __restrict__ bsr_row_ptr,
+                              const rocsparse_int* __restrict__ bsr_col_ind,
+                              const T* __restrict__ bsr_val,
+                              rocsparse_int block_dim,
+                              T* __restrict__ inv_diag_val,
+                              rocsparse_int* __restrict__ singular_block,
+                              rocsparse_index_base idx_base)
+    {
+        static constexpr unsigned int GROUPS = BLOCKSIZE / BSRDIM;
+
+        rocsparse_int lid   = hipThreadIdx_x & (BSRDIM - 1);
+        rocsparse_int gid   = hipThreadIdx_x / BSRDIM;
+        rocsparse_int block = hipBlockIdx_x * GROUPS + gid;
+
+        __shared__ T             sM[GROUPS][BSRDIM][BSRDIM + 1];
+        __shared__ rocsparse_int sperm[GROUPS][BSRDIM];
+        __shared__ rocsparse_int sdiag[GROUPS];
+
+        // Pad with the identity
+        for(rocsparse_int j = 0; j < BSRDIM; ++j)
+        {
+            sM[gid][lid][j] = (lid == j) ? static_cast<T>(1) : static_cast<T>(0);
+        }
+
+        if(lid == 0)
+        {
+            sdiag[gid] = -1;
+        }
+
+        __syncthreads();
+
+        // Search the diagonal block of this block row
+        if(block < mb)
+        {
+            rocsparse_int row_begin = bsr_row_ptr[block] - idx_base;
+            rocsparse_int row_end   = bsr_row_ptr[block + 1] - idx_base;
+
+            for(rocsparse_int j = row_begin + lid; j < row_end; j += BSRDIM)
+            {
+                if(bsr_col_ind[j] - idx_base == block)
+                {
+                    sdiag[gid] = j;
+                }
+            }
+        }
+
+        __syncthreads();
+
+        rocsparse_int diag = sdiag[gid];
+
+        // Load the diagonal block, a missing diagonal block is zero
+        if(block < mb && lid < block_dim)
+        {
+            for(rocsparse_int j = 0; j < block_dim; ++j)
+            {
+                sM[gid][lid][j] = (diag == -1) ? static_cast<T>(0)
+                                               : bsr_val[BSR_IND(int64_t(diag), lid, j, dir)];
+            }
+        }
+
+        __syncthreads();
+
+        bool singular
+            = rocsparse::bjac_gauss_jordan_device<BSRDIM>(block_dim, lid, sM[gid], sperm[gid]);
+
+        if(block < mb)
+        {
+            rocsparse::bjac_store_device<BSRDIM>(dir,
+                                                 block,
+                                                 block_dim,
+                                                 lid,
+                                                 singular,
+                                                 sM[gid],
+                                                 inv_diag_val,
+                                                 singular_block,
+                                                 idx_base);
+        }
+    }
+
+    template <unsigned int BLOCKSIZE, unsigned int BSRDIM, typename T>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void csrbjac_setup_kernel(rocsparse_direction dir,
+                              rocsparse_int       m,
+                              rocsparse_int       mb,
+                              const rocsparse_int* __restrict__ csr_row_ptr,
+                              const rocsparse_int* __restrict__ csr_col_ind,
+                              const T* __restrict__ csr_val,
+                              rocsparse_int block_dim,
+                              T* __restrict__ inv_diag_val,
+                              rocsparse_int* __restrict__ singular_block,
+                              rocsparse_index_base idx_base)
+    {
+        static constexpr unsigned int GROUPS = BLOCKSIZE / BSRDIM;
+
+        rocsparse_int lid   = hipThreadIdx_x & (BSRDIM - 1);
+        rocsparse_int gid   = hipThreadIdx_x / BSRDIM;
+        rocsparse_int block = hipBlockIdx_x * GROUPS + gid;
+
+        __shared__ T             sM[GROUPS][BSRDIM][BSRDIM + 1];
+        __shared__ rocsparse_int sperm[GROUPS][BSRDIM];
+
+        for(rocsparse_int j = 0; j < BSRDIM; ++j)
+        {
+            sM[gid][lid][j] = static_cast<T>(0);
+        }
+
+        rocsparse_int row       = block * block_dim + lid;
+        rocsparse_int col_begin = block * block_dim;
+
+        if(block < mb && lid < block_dim && row < m)
+        {
+            // Thread lid extracts row lid of the diagonal block
+            rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+            rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+            for(rocsparse_int j = row_begin; j < row_end; ++j)
+            {
+                rocsparse_int col = csr_col_ind[j] - idx_base - col_begin;
+
+                if(col >= 0 && col < block_dim)
+                {
+                    sM[gid][lid][col] = csr_val[j];
+                }
+            }
+        }
+        else
+        {
+            // Pad with the identity, this also covers the rows of a partial last block
+            sM[gid][lid][lid] = static_cast<T>(1);
+        }
+
+        __syncthreads();
+
+        bool singular
+            = rocsparse::bjac_gauss_jordan_device<BSRDIM>(block_dim, lid, sM[gid], sperm[gid]);
+
+        if(block < mb)
+        {
+            rocsparse::bjac_store_device<BSRDIM>(dir,
+                                                 block,
+                                                 block_dim,
+                                                 lid,
+                                                 singular,
+                                                 sM[gid],
+                                                 inv_diag_val,
+                                                 singular_block,
+                                                 idx_base);
+        }
+    }
+
+    // Fused batched block diagonal matrix-vector product, one thread per row
+    template <unsigned int BLOCKSIZE, typename T>
+    ROCSPARSE_DEVICE_ILF void bjac_apply_device(rocsparse_direction dir,
+                                                rocsparse_int       m,
+                                                rocsparse_int       block_dim,
+                                                T                   alpha,
+                                                const T* __restrict__ inv_diag_val,
+                                                const T* __restrict__ x,
+                                                T beta,
+                                                T* __restrict__ y)
+    {
+        rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+        if(row >= m)
+        {
+            return;
+        }
+
+        rocsparse_int block     = row / block_dim;
+        rocsparse_int lid       = row - block * block_dim;
+        rocsparse_int col_begin = block * block_dim;
+        rocsparse_int col_end   = min(col_begin + block_dim, m);
+
+        T sum = static_cast<T>(0);
+
+        for(rocsparse_int col = col_begin; col < col_end; ++col)
+        {
+            sum = rocsparse::fma(
+                rocsparse::ldg(inv_diag_val + BSR_IND(int64_t(block), lid, col - col_begin, dir)),
+                rocsparse::ldg(x + col),
+                sum);
+        }
+
+        if(beta == static_cast<T>(0))
+        {
+            y[row] = alpha * sum;
+        }
+        else
+        {
+            y[row] = rocsparse::fma(beta, y[row], alpha * sum);
+        }
+    }
+}
@@ -40,8 +40,13 @@ namespace rocsparse
                             rocsparse_int* __restrict__ zero_pivot,
                             rocsparse_int* __restrict__ singular_pivot,
                             double               tol,
-                            rocsparse_index_base idx_base)
+                            rocsparse_index_base idx_base,
+                            int64_t              batch_stride)
     {
+        // Offset into the current batch
+        csr_val += batch_stride * hipBlockIdx_y;
+        done += static_cast<int64_t>(m) * hipBlockIdx_y;
+
         int lid = hipThreadIdx_x & (WFSIZE - 1);
         int wid = hipThreadIdx_x / WFSIZE;
 
@@ -246,8 +251,13 @@ namespace rocsparse
                                  rocsparse_int* __restrict__ zero_pivot,
                                  rocsparse_int* __restrict__ singular_pivot,
                                  double               tol,
-                                 rocsparse_index_base idx_base)
+                                 rocsparse_index_base idx_base,
+                                 int64_t              batch_stride)
     {
+        // Offset into the current batch
+        csr_val += batch_stride * hipBlockIdx_y;
+        done += static_cast<int64_t>(m) * hipBlockIdx_y;
+
         int lid = hipThreadIdx_x & (WFSIZE - 1);
         int wid = hipThreadIdx_x / WFSIZE;
 
@@ -0,0 +1,186 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "common.h"
+
+namespace rocsparse
+{
+    // Flag every system of the batch that is not diagonally dominant. Flagged systems are
+    // solved with partial pivoting, all others are handed to the cyclic reduction solver.
+    template <unsigned int BLOCKSIZE, typename T>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void gtsv_strided_batch_detect_kernel(rocsparse_int m,
+                                          rocsparse_int batch_count,
+                                          rocsparse_int batch_stride,
+                                          const T* __restrict__ dl,
+                                          const T* __restrict__ d,
+                                          const T* __restrict__ du,
+                                          rocsparse_int* __restrict__ pivot)
+    {
+        rocsparse_int tid = hipThreadIdx_x;
+        rocsparse_int bid = hipBlockIdx_x;
+
+        __shared__ rocsparse_int sdata[BLOCKSIZE];
+
+        const int64_t offset = static_cast<int64_t>(batch_stride) * bid;
+
+        rocsparse_int flag = 0;
+
+        for(rocsparse_int i = tid; i < m; i += BLOCKSIZE)
+        {
+            const T di  = d[offset + i];
+            const T dli = (i > 0) ? dl[offset + i] : static_cast<T>(0);
+            const T dui = (i < m - 1) ? du[offset + i] : static_cast<T>(0);
+
+            const auto adi = rocsparse::abs(di);
+
+            if(adi == 0 || adi < rocsparse::abs(dli) + rocsparse::abs(dui))
+            {
+                flag = 1;
+            }
+        }
+
+        sdata[tid] = flag;
+        __syncthreads();
+
+        rocsparse::blockreduce_max<BLOCKSIZE>(tid, sdata);
+
+        if(tid == 0)
+        {
+            pivot[bid] = sdata[0];
+        }
+    }
+
+    // LU factorization with partial pivoting of the flagged systems, one thread per system.
+    // The factors and the solution are kept interleaved in the work arrays such that
+    // neighbouring threads access consecutive memory locations.
+    template <unsigned int BLOCKSIZE, typename T>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void gtsv_strided_batch_lu_kernel(rocsparse_int m,
+                                      rocsparse_int batch_count,
+                                      rocsparse_int batch_stride,
+                                      const T* __restrict__ dl,
+                                      const T* __restrict__ d,
+                                      const T* __restrict__ du,
+                                      const T* __restrict__ x,
+                                      const rocsparse_int* __restrict__ pivot,
+                                      T* __restrict__ u0,
+                                      T* __restrict__ u1,
+                                      T* __restrict__ u2,
+                                      T* __restrict__ y)
+    {
+        rocsparse_int gid = hipThreadIdx_x + BLOCKSIZE * hipBlockIdx_x;
+
+        if(gid >= batch_count || pivot[gid] == 0)
+        {
+            return;
+        }
+
+        const int64_t offset = static_cast<int64_t>(batch_stride) * gid;
+
+        // Current row of the partially eliminated system
+        T bk = d[offset];
+        T ck = du[offset];
+        T rk = x[offset];
+
+        for(rocsparse_int k = 0; k < m - 1; k++)
+        {
+            const int64_t index = static_cast<int64_t>(batch_count) * k + gid;
+
+            T ak_1 = dl[offset + k + 1];
+            T bk_1 = d[offset + k + 1];
+            T ck_1 = (k < m - 2) ? du[offset + k + 1] : static_cast<T>(0);
+            T rk_1 = x[offset + k + 1];
+
+            if(rocsparse::abs(bk) >= rocsparse::abs(ak_1))
+            {
+                // No row interchange
+                T lk_1 = ak_1 / bk;
+
+                u0[index] = bk;
+                u1[index] = ck;
+                u2[index] = static_cast<T>(0);
+                y[index]  = rk;
+
+                bk = bk_1 - lk_1 * ck;
+                ck = ck_1;
+                rk = rk_1 - lk_1 * rk;
+            }
+            else
+            {
+                // Interchange rows k and k + 1
+                T lk_1 = bk / ak_1;
+
+                u0[index] = ak_1;
+                u1[index] = bk_1;
+                u2[index] = ck_1;
+                y[index]  = rk_1;
+
+                bk = ck - lk_1 * bk_1;
+                ck = -lk_1 * ck_1;
+                rk = rk - lk_1 * rk_1;
+            }
+        }
+
+        // Backward substitution (U * y = y)
+        const int64_t last = static_cast<int64_t>(batch_count) * (m - 1) + gid;
+        const int64_t prev = last - batch_count;
+
+        y[last] = rk / bk;
+        y[prev] = (y[prev] - u1[prev] * y[last]) / u0[prev];
+
+        for(rocsparse_int k = m - 3; k >= 0; k--)
+        {
+            const int64_t index = static_cast<int64_t>(batch_count) * k + gid;
+
+            y[index] = (y[index] - u1[index] * y[index + batch_count]
+                        - u2[index] * y[index + 2 * batch_count])
+                       / u0[index];
+        }
+    }
+
+    // Copy the solution of the flagged systems back into the strided layout
+    template <unsigned int BLOCKSIZE, typename T>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void gtsv_strided_batch_scatter_kernel(rocsparse_int m,
+                                           rocsparse_int batch_count,
+                                           rocsparse_int batch_stride,
+                                           const rocsparse_int* __restrict__ pivot,
+                                           const T* __restrict__ y,
+                                           T* __restrict__ x)
+    {
+        rocsparse_int gid  = hipThreadIdx_x + BLOCKSIZE * hipBlockIdx_x;
+        rocsparse_int bidy = hipBlockIdx_y;
+
+        if(gid >= m || pivot[bidy] == 0)
+        {
+            return;
+        }
+
+        x[static_cast<int64_t>(batch_stride) * bidy + gid]
+            = y[static_cast<int64_t>(batch_count) * gid + bidy];
+    }
+}
@@ -1267,6 +1267,9 @@ struct rocsparse::csritilu0_driver_t<rocsparse_itilu0_alg_async_inplace>
                                     rocsparse_datatype   datatype_,
                                     size_t* __restrict__ buffer_size_)
         {
+            // The number of non-zeros of the upper part is read back on the host
+            RETURN_IF_CAPTURE_SAFE_MODE(handle_);
+
             const bool use_coo_format = (options_ & rocsparse_itilu0_option_coo_format) > 0;
 
             size_t buffer_size = 0;
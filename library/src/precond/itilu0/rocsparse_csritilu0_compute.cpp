@@ -98,6 +98,9 @@ namespace rocsparse
             RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_zero_pivot);
         }
 
+        // The iteration count and the norms are read back on the host
+        RETURN_IF_CAPTURE_SAFE_MODE(handle_);
+
         RETURN_IF_ROCSPARSE_ERROR((rocsparse::compute_dispatch<T, I, J>(alg_,
                                                                         handle_,
                                                                         alg_,
@@ -109,6 +109,9 @@ rocsparse_status rocsparse::csritilu0x_compute_template(rocsparse_handle     han
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_zero_pivot);
     }
 
+    // The iteration count and the norms are read back on the host
+    RETURN_IF_CAPTURE_SAFE_MODE(handle_);
+
     if(ldir_ != rocsparse_direction_row)
     {
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_not_implemented);
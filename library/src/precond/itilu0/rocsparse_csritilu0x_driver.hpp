@@ -153,6 +153,8 @@ namespace rocsparse
 
         void* init(rocsparse_handle handle_, void* buffer_, J nsweeps_, J options_)
         {
+            // The options are copied from the stack before the host continues
+            THROW_IF_CAPTURE_SAFE_MODE(handle_);
 
             void* buffer = buffer_;
             buffer       = info.init(buffer);
@@ -188,6 +190,9 @@ namespace rocsparse
 
         void* init(rocsparse_handle handle_, void* buffer_)
         {
+            // The options are read back on the host
+            THROW_IF_CAPTURE_SAFE_MODE(handle_);
+
             void* buffer = buffer_;
             buffer       = info.init(buffer);
 
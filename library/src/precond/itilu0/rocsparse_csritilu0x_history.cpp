@@ -74,6 +74,9 @@ rocsparse_status rocsparse::csritilu0x_history_template(rocsparse_handle     han
                                                         size_t buffer_size_,
                                                         void* __restrict__ buffer_)
 {
+    // The iteration count is read back on the host
+    RETURN_IF_CAPTURE_SAFE_MODE(handle_);
+
     RETURN_IF_ROCSPARSE_ERROR(
         (rocsparse::history_dispatch<T, J>(alg_, handle_, niter_, data_, buffer_size_, buffer_)));
     return rocsparse_status_success;
@@ -107,6 +107,9 @@ rocsparse_status rocsparse::csritilu0x_preprocess_template(rocsparse_handle
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_zero_pivot);
     }
 
+    // The preprocessing reads its meta data back on the host
+    RETURN_IF_CAPTURE_SAFE_MODE(handle_);
+
     RETURN_IF_ROCSPARSE_ERROR((rocsparse::preprocess_dispatch<I, J>(alg_,
                                                                     handle_,
                                                                     options_,
@@ -0,0 +1,615 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "internal/precond/rocsparse_bjac.h"
+#include "rocsparse_bjac.hpp"
+
+#include "bjac_device.h"
+
+#define BJAC_SETUP_DIM 64
+#define BJAC_APPLY_DIM 256
+
+namespace rocsparse
+{
+    template <unsigned int BLOCKSIZE>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void bjac_singular_block_kernel(const rocsparse_int* __restrict__ dsingular,
+                                    rocsparse_int* __restrict__ singular_block)
+    {
+        if(hipThreadIdx_x == 0)
+        {
+            rocsparse_int pos = *dsingular;
+            *singular_block   = (pos == std::numeric_limits<rocsparse_int>::max()) ? -1 : pos;
+        }
+    }
+
+    template <unsigned int BLOCKSIZE, typename T, typename U>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void bjac_apply_kernel(rocsparse_direction dir,
+                           rocsparse_int       m,
+                           rocsparse_int       block_dim,
+                           U                   alpha_device_host,
+                           const T* __restrict__ inv_diag_val,
+                           const T* __restrict__ x,
+                           U beta_device_host,
+                           T* __restrict__ y)
+    {
+        auto alpha = rocsparse::load_scalar_device_host(alpha_device_host);
+        auto beta  = rocsparse::load_scalar_device_host(beta_device_host);
+
+        if(alpha == static_cast<T>(0) && beta == static_cast<T>(1))
+        {
+            return;
+        }
+
+        rocsparse::bjac_apply_device<BLOCKSIZE>(dir, m, block_dim, alpha, inv_diag_val, x, beta, y);
+    }
+
+    template <unsigned int BSRDIM, typename T>
+    static rocsparse_status bsrbjac_setup_launcher(rocsparse_handle     handle,
+                                                   rocsparse_direction  dir,
+                                                   rocsparse_int        mb,
+                                                   const rocsparse_int* bsr_row_ptr,
+                                                   const rocsparse_int* bsr_col_ind,
+                                                   const T*             bsr_val,
+                                                   rocsparse_int        block_dim,
+                                                   T*                   inv_diag_val,
+                                                   rocsparse_int*       dsingular,
+                                                   rocsparse_index_base idx_base)
+    {
+        RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+            (rocsparse::bsrbjac_setup_kernel<BJAC_SETUP_DIM, BSRDIM>),
+            dim3((mb - 1) / (BJAC_SETUP_DIM / BSRDIM) + 1),
+            dim3(BJAC_SETUP_DIM),
+            0,
+            handle->stream,
+            dir,
+            mb,
+            bsr_row_ptr,
+            bsr_col_ind,
+            bsr_val,
+            block_dim,
+            inv_diag_val,
+            dsingular,
+            idx_base);
+
+        return rocsparse_status_success;
+    }
+
+    template <unsigned int BSRDIM, typename T>
+    static rocsparse_status csrbjac_setup_launcher(rocsparse_handle     handle,
+                                                   rocsparse_direction  dir,
+                                                   rocsparse_int        m,
+                                                   rocsparse_int        mb,
+                                                   const rocsparse_int* csr_row_ptr,
+                                                   const rocsparse_int* csr_col_ind,
+                                                   const T*             csr_val,
+                                                   rocsparse_int        block_dim,
+                                                   T*                   inv_diag_val,
+                                                   rocsparse_int*       dsingular,
+                                                   rocsparse_index_base idx_base)
+    {
+        RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+            (rocsparse::csrbjac_setup_kernel<BJAC_SETUP_DIM, BSRDIM>),
+            dim3((mb - 1) / (BJAC_SETUP_DIM / BSRDIM) + 1),
+            dim3(BJAC_SETUP_DIM),
+            0,
+            handle->stream,
+            dir,
+            m,
+            mb,
+            csr_row_ptr,
+            csr_col_ind,
+            csr_val,
+            block_dim,
+            inv_diag_val,
+            dsingular,
+            idx_base);
+
+        return rocsparse_status_success;
+    }
+
+    // Initialize the device position of the first singular block. The position is
+    // accumulated in the handle buffer and copied to singular_block afterwards.
+    static rocsparse_status bjac_singular_block_init(rocsparse_handle handle,
+                                                     rocsparse_int*   dsingular)
+    {
+        // The singular block is only read back on the host in host pointer mode
+        if(handle->pointer_mode == rocsparse_pointer_mode_host)
+        {
+            RETURN_IF_CAPTURE_SAFE_MODE(handle);
+        }
+
+        RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::set_array_to_value<256>),
+                                           dim3(1),
+                                           dim3(256),
+                                           0,
+                                           handle->stream,
+                                           1,
+                                           dsingular,
+                                           std::numeric_limits<rocsparse_int>::max());
+
+        return rocsparse_status_success;
+    }
+
+    static rocsparse_status bjac_singular_block_copy(rocsparse_handle     handle,
+                                                     const rocsparse_int* dsingular,
+                                                     rocsparse_int*       singular_block)
+    {
+        hipStream_t stream = handle->stream;
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::bjac_singular_block_kernel<1>),
+                                               dim3(1),
+                                               dim3(1),
+                                               0,
+                                               stream,
+                                               dsingular,
+                                               singular_block);
+        }
+        else
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                singular_block, dsingular, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+            // If no singular block is found, set -1
+            if(*singular_block == std::numeric_limits<rocsparse_int>::max())
+            {
+                *singular_block = -1;
+            }
+        }
+
+        return rocsparse_status_success;
+    }
+
+    static rocsparse_status bjac_singular_block_none(rocsparse_handle handle,
+                                                     rocsparse_int*   singular_block)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(
+                hipMemsetAsync(singular_block, -1, sizeof(rocsparse_int), handle->stream));
+        }
+        else
+        {
+            *singular_block = -1;
+        }
+
+        return rocsparse_status_success;
+    }
+}
+
+#define BJAC_SETUP_DISPATCH(LAUNCHER, ...)                               \
+    if(block_dim <= 2)                                                   \
+    {                                                                    \
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::LAUNCHER<2>(__VA_ARGS__));  \
+    }                                                                    \
+    else if(block_dim <= 4)                                              \
+    {                                                                    \
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::LAUNCHER<4>(__VA_ARGS__));  \
+    }                                                                    \
+    else if(block_dim <= 8)                                              \
+    {                                                                    \
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::LAUNCHER<8>(__VA_ARGS__));  \
+    }                                                                    \
+    else if(block_dim <= 16)                                             \
+    {                                                                    \
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::LAUNCHER<16>(__VA_ARGS__)); \
+    }                                                                    \
+    else                                                                 \
+    {                                                                    \
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::LAUNCHER<32>(__VA_ARGS__)); \
+    }
+
+template <typename T>
+rocsparse_status rocsparse::bsrbjac_setup_template(rocsparse_handle          handle,
+                                                   rocsparse_direction       dir,
+                                                   rocsparse_int             mb,
+                                                   rocsparse_int             nnzb,
+                                                   const rocsparse_mat_descr descr,
+                                                   const T*                  bsr_val,
+                                                   const rocsparse_int*      bsr_row_ptr,
+                                                   const rocsparse_int*      bsr_col_ind,
+                                                   rocsparse_int             block_dim,
+                                                   T*                        inv_diag_val,
+                                                   rocsparse_int*            singular_block)
+{
+    ROCSPARSE_CHECKARG_HANDLE(0, handle);
+
+    rocsparse::log_trace(handle,
+                         rocsparse::replaceX<T>("rocsparse_Xbsrbjac_setup"),
+                         dir,
+                         mb,
+                         nnzb,
+                         (const void*&)descr,
+                         (const void*&)bsr_val,
+                         (const void*&)bsr_row_ptr,
+                         (const void*&)bsr_col_ind,
+                         block_dim,
+                         (const void*&)inv_diag_val,
+                         (const void*&)singular_block);
+
+    ROCSPARSE_CHECKARG_ENUM(1, dir);
+    ROCSPARSE_CHECKARG_SIZE(2, mb);
+    ROCSPARSE_CHECKARG_SIZE(3, nnzb);
+    ROCSPARSE_CHECKARG_POINTER(4, descr);
+    ROCSPARSE_CHECKARG(
+        4, descr, (descr->type != rocsparse_matrix_type_general), rocsparse_status_not_implemented);
+    ROCSPARSE_CHECKARG_ARRAY(5, nnzb, bsr_val);
+    ROCSPARSE_CHECKARG_ARRAY(6, mb, bsr_row_ptr);
+    ROCSPARSE_CHECKARG_ARRAY(7, nnzb, bsr_col_ind);
+    ROCSPARSE_CHECKARG_SIZE(8, block_dim);
+    ROCSPARSE_CHECKARG(8, block_dim, (block_dim == 0), rocsparse_status_invalid_size);
+    ROCSPARSE_CHECKARG(8, block_dim, (block_dim > 32), rocsparse_status_not_implemented);
+    ROCSPARSE_CHECKARG_ARRAY(9, mb, inv_diag_val);
+    ROCSPARSE_CHECKARG_POINTER(10, singular_block);
+
+    // Quick return if possible
+    if(mb == 0)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::bjac_singular_block_none(handle, singular_block));
+        return rocsparse_status_success;
+    }
+
+    rocsparse_int* dsingular = reinterpret_cast<rocsparse_int*>(handle->buffer);
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::bjac_singular_block_init(handle, dsingular));
+
+    BJAC_SETUP_DISPATCH(bsrbjac_setup_launcher,
+                        handle,
+                        dir,
+                        mb,
+                        bsr_row_ptr,
+                        bsr_col_ind,
+                        bsr_val,
+                        block_dim,
+                        inv_diag_val,
+                        dsingular,
+                        descr->base);
+
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse::bjac_singular_block_copy(handle, dsingular, singular_block));
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse::csrbjac_setup_template(rocsparse_handle          handle,
+                                                   rocsparse_direction       dir,
+                                                   rocsparse_int             m,
+                                                   rocsparse_int             nnz,
+                                                   const rocsparse_mat_descr descr,
+                                                   const T*                  csr_val,
+                                                   const rocsparse_int*      csr_row_ptr,
+                                                   const rocsparse_int*      csr_col_ind,
+                                                   rocsparse_int             block_dim,
+                                                   T*                        inv_diag_val,
+                                                   rocsparse_int*            singular_block)
+{
+    ROCSPARSE_CHECKARG_HANDLE(0, handle);
+
+    rocsparse::log_trace(handle,
+                         rocsparse::replaceX<T>("rocsparse_Xcsrbjac_setup"),
+                         dir,
+                         m,
+                         nnz,
+                         (const void*&)descr,
+                         (const void*&)csr_val,
+                         (const void*&)csr_row_ptr,
+                         (const void*&)csr_col_ind,
+                         block_dim,
+                         (const void*&)inv_diag_val,
+                         (const void*&)singular_block);
+
+    ROCSPARSE_CHECKARG_ENUM(1, dir);
+    ROCSPARSE_CHECKARG_SIZE(2, m);
+    ROCSPARSE_CHECKARG_SIZE(3, nnz);
+    ROCSPARSE_CHECKARG_POINTER(4, descr);
+    ROCSPARSE_CHECKARG(
+        4, descr, (descr->type != rocsparse_matrix_type_general), rocsparse_status_not_implemented);
+    ROCSPARSE_CHECKARG_ARRAY(5, nnz, csr_val);
+    ROCSPARSE_CHECKARG_ARRAY(6, m, csr_row_ptr);
+    ROCSPARSE_CHECKARG_ARRAY(7, nnz, csr_col_ind);
+    ROCSPARSE_CHECKARG_SIZE(8, block_dim);
+    ROCSPARSE_CHECKARG(8, block_dim, (block_dim == 0), rocsparse_status_invalid_size);
+    ROCSPARSE_CHECKARG(8, block_dim, (block_dim > 32), rocsparse_status_not_implemented);
+    ROCSPARSE_CHECKARG_ARRAY(9, m, inv_diag_val);
+    ROCSPARSE_CHECKARG_POINTER(10, singular_block);
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::bjac_singular_block_none(handle, singular_block));
+        return rocsparse_status_success;
+    }
+
+    // Number of diagonal blocks, the last one may be partial
+    rocsparse_int mb = (m - 1) / block_dim + 1;
+
+    rocsparse_int* dsingular = reinterpret_cast<rocsparse_int*>(handle->buffer);
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::bjac_singular_block_init(handle, dsingular));
+
+    BJAC_SETUP_DISPATCH(csrbjac_setup_launcher,
+                        handle,
+                        dir,
+                        m,
+                        mb,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        block_dim,
+                        inv_diag_val,
+                        dsingular,
+                        descr->base);
+
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse::bjac_singular_block_copy(handle, dsingular, singular_block));
+
+    return rocsparse_status_success;
+}
+
+#undef BJAC_SETUP_DISPATCH
+
+template <typename T>
+rocsparse_status rocsparse::bjac_apply_template(rocsparse_handle    handle,
+                                                rocsparse_direction dir,
+                                                rocsparse_int       m,
+                                                rocsparse_int       block_dim,
+                                                const T*            alpha,
+                                                const T*            inv_diag_val,
+                                                const T*            x,
+                                                const T*            beta,
+                                                T*                  y)
+{
+    ROCSPARSE_CHECKARG_HANDLE(0, handle);
+
+    rocsparse::log_trace(handle,
+                         rocsparse::replaceX<T>("rocsparse_Xbjac_apply"),
+                         dir,
+                         m,
+                         block_dim,
+                         LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                         (const void*&)inv_diag_val,
+                         (const void*&)x,
+                         LOG_TRACE_SCALAR_VALUE(handle, beta),
+                         (const void*&)y);
+
+    ROCSPARSE_CHECKARG_ENUM(1, dir);
+    ROCSPARSE_CHECKARG_SIZE(2, m);
+    ROCSPARSE_CHECKARG_SIZE(3, block_dim);
+    ROCSPARSE_CHECKARG(3, block_dim, (block_dim == 0), rocsparse_status_invalid_size);
+    ROCSPARSE_CHECKARG(3, block_dim, (block_dim > 32), rocsparse_status_not_implemented);
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    ROCSPARSE_CHECKARG_POINTER(4, alpha);
+    ROCSPARSE_CHECKARG_POINTER(5, inv_diag_val);
+    ROCSPARSE_CHECKARG_POINTER(6, x);
+    ROCSPARSE_CHECKARG_POINTER(7, beta);
+    ROCSPARSE_CHECKARG_POINTER(8, y);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_host
+       && *alpha == static_cast<T>(0) && *beta == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    dim3 bjac_blocks((m - 1) / BJAC_APPLY_DIM + 1);
+    dim3 bjac_threads(BJAC_APPLY_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::bjac_apply_kernel<BJAC_APPLY_DIM>),
+                                           bjac_blocks,
+                                           bjac_threads,
+                                           0,
+                                           handle->stream,
+                                           dir,
+                                           m,
+                                           block_dim,
+                                           alpha,
+                                           inv_diag_val,
+                                           x,
+                                           beta,
+                                           y);
+    }
+    else
+    {
+        RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::bjac_apply_kernel<BJAC_APPLY_DIM>),
+                                           bjac_blocks,
+                                           bjac_threads,
+                                           0,
+                                           handle->stream,
+                                           dir,
+                                           m,
+                                           block_dim,
+                                           *alpha,
+                                           inv_diag_val,
+                                           x,
+                                           *beta,
+                                           y);
+    }
+
+    return rocsparse_status_success;
+}
+
+#define INSTANTIATE(TYPE)                                              \
+    template rocsparse_status rocsparse::bsrbjac_setup_template<TYPE>( \
+        rocsparse_handle          handle,                              \
+        rocsparse_direction       dir,                                 \
+        rocsparse_int             mb,                                  \
+        rocsparse_int             nnzb,                                \
+        const rocsparse_mat_descr descr,                               \
+        const TYPE*               bsr_val,                             \
+        const rocsparse_int*      bsr_row_ptr,                         \
+        const rocsparse_int*      bsr_col_ind,                         \
+        rocsparse_int             block_dim,                           \
+        TYPE*                     inv_diag_val,                        \
+        rocsparse_int*            singular_block);                     \
+    template rocsparse_status rocsparse::csrbjac_setup_template<TYPE>( \
+        rocsparse_handle          handle,                              \
+        rocsparse_direction       dir,                                 \
+        rocsparse_int             m,                                   \
+        rocsparse_int             nnz,                                 \
+        const rocsparse_mat_descr descr,                               \
+        const TYPE*               csr_val,                             \
+        const rocsparse_int*      csr_row_ptr,                         \
+        const rocsparse_int*      csr_col_ind,                         \
+        rocsparse_int             block_dim,                           \
+        TYPE*                     inv_diag_val,                        \
+        rocsparse_int*            singular_block);                     \
+    template rocsparse_status rocsparse::bjac_apply_template<TYPE>(    \
+        rocsparse_handle    handle,                                    \
+        rocsparse_direction dir,                                       \
+        rocsparse_int       m,                                         \
+        rocsparse_int       block_dim,                                 \
+        const TYPE*         alpha,                                     \
+        const TYPE*         inv_diag_val,                              \
+        const TYPE*         x,                                         \
+        const TYPE*         beta,                                      \
+        TYPE*               y);
+
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+#undef INSTANTIATE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+#define C_IMPL(NAME, TYPE)                                                            \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,                \
+                                     rocsparse_direction       dir,                   \
+                                     rocsparse_int             mb,                    \
+                                     rocsparse_int             nnzb,                  \
+                                     const rocsparse_mat_descr descr,                 \
+                                     const TYPE*               bsr_val,               \
+                                     const rocsparse_int*      bsr_row_ptr,           \
+                                     const rocsparse_int*      bsr_col_ind,           \
+                                     rocsparse_int             block_dim,             \
+                                     TYPE*                     inv_diag_val,          \
+                                     rocsparse_int*            singular_block)        \
+    try                                                                               \
+    {                                                                                 \
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::bsrbjac_setup_template(handle,           \
+                                                                    dir,              \
+                                                                    mb,               \
+                                                                    nnzb,             \
+                                                                    descr,            \
+                                                                    bsr_val,          \
+                                                                    bsr_row_ptr,      \
+                                                                    bsr_col_ind,      \
+                                                                    block_dim,        \
+                                                                    inv_diag_val,     \
+                                                                    singular_block)); \
+        return rocsparse_status_success;                                              \
+    }                                                                                 \
+    catch(...)                                                                        \
+    {                                                                                 \
+        RETURN_ROCSPARSE_EXCEPTION();                                                 \
+    }
+
+C_IMPL(rocsparse_sbsrbjac_setup, float);
+C_IMPL(rocsparse_dbsrbjac_setup, double);
+C_IMPL(rocsparse_cbsrbjac_setup, rocsparse_float_complex);
+C_IMPL(rocsparse_zbsrbjac_setup, rocsparse_double_complex);
+
+#undef C_IMPL
+
+#define C_IMPL(NAME, TYPE)                                                            \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,                \
+                                     rocsparse_direction       dir,                   \
+                                     rocsparse_int             m,                     \
+                                     rocsparse_int             nnz,                   \
+                                     const rocsparse_mat_descr descr,                 \
+                                     const TYPE*               csr_val,               \
+                                     const rocsparse_int*      csr_row_ptr,           \
+                                     const rocsparse_int*      csr_col_ind,           \
+                                     rocsparse_int             block_dim,             \
+                                     TYPE*                     inv_diag_val,          \
+                                     rocsparse_int*            singular_block)        \
+    try                                                                               \
+    {                                                                                 \
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::csrbjac_setup_template(handle,           \
+                                                                    dir,              \
+                                                                    m,                \
+                                                                    nnz,              \
+                                                                    descr,            \
+                                                                    csr_val,          \
+                                                                    csr_row_ptr,      \
+                                                                    csr_col_ind,      \
+                                                                    block_dim,        \
+                                                                    inv_diag_val,     \
+                                                                    singular_block)); \
+        return rocsparse_status_success;                                              \
+    }                                                                                 \
+    catch(...)                                                                        \
+    {                                                                                 \
+        RETURN_ROCSPARSE_EXCEPTION();                                                 \
+    }
+
+C_IMPL(rocsparse_scsrbjac_setup, float);
+C_IMPL(rocsparse_dcsrbjac_setup, double);
+C_IMPL(rocsparse_ccsrbjac_setup, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrbjac_setup, rocsparse_double_complex);
+
+#undef C_IMPL
+
+#define C_IMPL(NAME, TYPE)                                                \
+    extern "C" rocsparse_status NAME(rocsparse_handle    handle,          \
+                                     rocsparse_direction dir,             \
+                                     rocsparse_int       m,               \
+                                     rocsparse_int       block_dim,       \
+                                     const TYPE*         alpha,           \
+                                     const TYPE*         inv_diag_val,    \
+                                     const TYPE*         x,               \
+                                     const TYPE*         beta,            \
+                                     TYPE*               y)               \
+    try                                                                   \
+    {                                                                     \
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::bjac_apply_template(         \
+            handle, dir, m, block_dim, alpha, inv_diag_val, x, beta, y)); \
+        return rocsparse_status_success;                                  \
+    }                                                                     \
+    catch(...)                                                            \
+    {                                                                     \
+        RETURN_ROCSPARSE_EXCEPTION();                                     \
+    }
+
+C_IMPL(rocsparse_sbjac_apply, float);
+C_IMPL(rocsparse_dbjac_apply, double);
+C_IMPL(rocsparse_cbjac_apply, rocsparse_float_complex);
+C_IMPL(rocsparse_zbjac_apply, rocsparse_double_complex);
+
+#undef C_IMPL
@@ -0,0 +1,68 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "control.h"
+#include "utility.h"
+
+namespace rocsparse
+{
+    template <typename T>
+    rocsparse_status bsrbjac_setup_template(rocsparse_handle          handle,
+                                            rocsparse_direction       dir,
+                                            rocsparse_int             mb,
+                                            rocsparse_int             nnzb,
+                                            const rocsparse_mat_descr descr,
+                                            const T*                  bsr_val,
+                                            const rocsparse_int*      bsr_row_ptr,
+                                            const rocsparse_int*      bsr_col_ind,
+                                            rocsparse_int             block_dim,
+                                            T*                        inv_diag_val,
+                                            rocsparse_int*            singular_block);
+
+    template <typename T>
+    rocsparse_status csrbjac_setup_template(rocsparse_handle          handle,
+                                            rocsparse_direction       dir,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const T*                  csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_int             block_dim,
+                                            T*                        inv_diag_val,
+                                            rocsparse_int*            singular_block);
+
+    template <typename T>
+    rocsparse_status bjac_apply_template(rocsparse_handle    handle,
+                                         rocsparse_direction dir,
+                                         rocsparse_int       m,
+                                         rocsparse_int       block_dim,
+                                         const T*            alpha,
+                                         const T*            inv_diag_val,
+                                         const T*            x,
+                                         const T*            beta,
+                                         T*                  y);
+}
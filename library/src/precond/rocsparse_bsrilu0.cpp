@@ -243,6 +243,9 @@ rocsparse_status rocsparse::bsrilu0_analysis_template(rocsparse_handle
     // User is explicitly asking to force a re-analysis, or no valid data has been
     // found to be re-used.
 
+    // The analysis reads its meta data back on the host
+    RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
     // Clear bsrilu0 info
     RETURN_IF_ROCSPARSE_ERROR(rocsparse::destroy_trm_info(info->bsrilu0_info));
 
@@ -1082,6 +1085,9 @@ try
         return rocsparse_status_success;
     }
 
+    // Reading the pivot back blocks the host
+    RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
     // Differentiate between pointer modes
     if(handle->pointer_mode == rocsparse_pointer_mode_device)
     {
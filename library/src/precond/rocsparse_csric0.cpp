@@ -174,6 +174,336 @@ rocsparse_status rocsparse::csric0_analysis_template(rocsparse_handle          h
     return rocsparse_status_success;
 }
 
+namespace rocsparse
+{
+    template <typename T>
+    static rocsparse_status csric0_dispatch(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            const rocsparse_mat_descr descr,
+                                            T*                        csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_mat_info        info,
+                                            void*                     temp_buffer,
+                                            rocsparse_int             batch_count,
+                                            int64_t                   batch_stride)
+    {
+        // Stream
+        hipStream_t stream = handle->stream;
+
+        // Buffer
+        char* ptr = reinterpret_cast<char*>(temp_buffer);
+        ptr += 256;
+
+        // done array, one per batch
+        int* d_done_array = reinterpret_cast<int*>(ptr);
+
+        // Initialize buffers
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(
+            d_done_array, 0, sizeof(int) * static_cast<size_t>(m) * batch_count, stream));
+
+        // Max nnz per row
+        rocsparse_int max_nnz = info->csric0_info->max_nnz;
+
+        // Determine gcnArch and ASIC revision
+        const std::string gcn_arch_name = rocsparse::handle_get_arch_name(handle);
+
+#define CSRIC0_DIM 256
+        dim3 csric0_blocks((m * handle->wavefront_size - 1) / CSRIC0_DIM + 1, batch_count);
+        dim3 csric0_threads(CSRIC0_DIM);
+
+        if(gcn_arch_name == rocpsarse_arch_names::gfx908 && handle->asic_rev < 2)
+        {
+            RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+                (rocsparse::csric0_binsearch_kernel<CSRIC0_DIM, 64, true>),
+                csric0_blocks,
+                csric0_threads,
+                0,
+                stream,
+                m,
+                csr_row_ptr,
+                csr_col_ind,
+                csr_val,
+                (rocsparse_int*)info->csric0_info->trm_diag_ind,
+                d_done_array,
+                (rocsparse_int*)info->csric0_info->row_map,
+                (rocsparse_int*)info->zero_pivot,
+                (rocsparse_int*)info->singular_pivot,
+                info->singular_tol,
+                descr->base,
+                batch_stride);
+        }
+        else
+        {
+            if(handle->wavefront_size == 32)
+            {
+                if(max_nnz <= 32)
+                {
+                    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+                        (rocsparse::csric0_hash_kernel<CSRIC0_DIM, 32, 1>),
+                        csric0_blocks,
+                        csric0_threads,
+                        0,
+                        stream,
+                        m,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        (rocsparse_int*)info->csric0_info->trm_diag_ind,
+                        d_done_array,
+                        (rocsparse_int*)info->csric0_info->row_map,
+                        (rocsparse_int*)info->zero_pivot,
+                        (rocsparse_int*)info->singular_pivot,
+                        info->singular_tol,
+                        descr->base,
+                        batch_stride);
+                }
+                else if(max_nnz <= 64)
+                {
+                    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+                        (rocsparse::csric0_hash_kernel<CSRIC0_DIM, 32, 2>),
+                        csric0_blocks,
+                        csric0_threads,
+                        0,
+                        stream,
+                        m,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        (rocsparse_int*)info->csric0_info->trm_diag_ind,
+                        d_done_array,
+                        (rocsparse_int*)info->csric0_info->row_map,
+                        (rocsparse_int*)info->zero_pivot,
+                        (rocsparse_int*)info->singular_pivot,
+                        info->singular_tol,
+                        descr->base,
+                        batch_stride);
+                }
+                else if(max_nnz <= 128)
+                {
+                    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+                        (rocsparse::csric0_hash_kernel<CSRIC0_DIM, 32, 4>),
+                        csric0_blocks,
+                        csric0_threads,
+                        0,
+                        stream,
+                        m,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        (rocsparse_int*)info->csric0_info->trm_diag_ind,
+                        d_done_array,
+                        (rocsparse_int*)info->csric0_info->row_map,
+                        (rocsparse_int*)info->zero_pivot,
+                        (rocsparse_int*)info->singular_pivot,
+                        info->singular_tol,
+                        descr->base,
+                        batch_stride);
+                }
+                else if(max_nnz <= 256)
+                {
+                    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+                        (rocsparse::csric0_hash_kernel<CSRIC0_DIM, 32, 8>),
+                        csric0_blocks,
+                        csric0_threads,
+                        0,
+                        stream,
+                        m,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        (rocsparse_int*)info->csric0_info->trm_diag_ind,
+                        d_done_array,
+                        (rocsparse_int*)info->csric0_info->row_map,
+                        (rocsparse_int*)info->zero_pivot,
+                        (rocsparse_int*)info->singular_pivot,
+                        info->singular_tol,
+                        descr->base,
+                        batch_stride);
+                }
+                else if(max_nnz <= 512)
+                {
+                    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+                        (rocsparse::csric0_hash_kernel<CSRIC0_DIM, 32, 16>),
+                        csric0_blocks,
+                        csric0_threads,
+                        0,
+                        stream,
+                        m,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        (rocsparse_int*)info->csric0_info->trm_diag_ind,
+                        d_done_array,
+                        (rocsparse_int*)info->csric0_info->row_map,
+                        (rocsparse_int*)info->zero_pivot,
+                        (rocsparse_int*)info->singular_pivot,
+                        info->singular_tol,
+                        descr->base,
+                        batch_stride);
+                }
+                else
+                {
+                    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+                        (rocsparse::csric0_binsearch_kernel<CSRIC0_DIM, 32, false>),
+                        csric0_blocks,
+                        csric0_threads,
+                        0,
+                        stream,
+                        m,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        (rocsparse_int*)info->csric0_info->trm_diag_ind,
+                        d_done_array,
+                        (rocsparse_int*)info->csric0_info->row_map,
+                        (rocsparse_int*)info->zero_pivot,
+                        (rocsparse_int*)info->singular_pivot,
+                        info->singular_tol,
+                        descr->base,
+                        batch_stride);
+                }
+            }
+            else if(handle->wavefront_size == 64)
+            {
+                if(max_nnz <= 64)
+                {
+                    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+                        (rocsparse::csric0_hash_kernel<CSRIC0_DIM, 64, 1>),
+                        csric0_blocks,
+                        csric0_threads,
+                        0,
+                        stream,
+                        m,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        (rocsparse_int*)info->csric0_info->trm_diag_ind,
+                        d_done_array,
+                        (rocsparse_int*)info->csric0_info->row_map,
+                        (rocsparse_int*)info->zero_pivot,
+                        (rocsparse_int*)info->singular_pivot,
+                        info->singular_tol,
+                        descr->base,
+                        batch_stride);
+                }
+                else if(max_nnz <= 128)
+                {
+                    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+                        (rocsparse::csric0_hash_kernel<CSRIC0_DIM, 64, 2>),
+                        csric0_blocks,
+                        csric0_threads,
+                        0,
+                        stream,
+                        m,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        (rocsparse_int*)info->csric0_info->trm_diag_ind,
+                        d_done_array,
+                        (rocsparse_int*)info->csric0_info->row_map,
+                        (rocsparse_int*)info->zero_pivot,
+                        (rocsparse_int*)info->singular_pivot,
+                        info->singular_tol,
+                        descr->base,
+                        batch_stride);
+                }
+                else if(max_nnz <= 256)
+                {
+                    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+                        (rocsparse::csric0_hash_kernel<CSRIC0_DIM, 64, 4>),
+                        csric0_blocks,
+                        csric0_threads,
+                        0,
+                        stream,
+                        m,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        (rocsparse_int*)info->csric0_info->trm_diag_ind,
+                        d_done_array,
+                        (rocsparse_int*)info->csric0_info->row_map,
+                        (rocsparse_int*)info->zero_pivot,
+                        (rocsparse_int*)info->singular_pivot,
+                        info->singular_tol,
+                        descr->base,
+                        batch_stride);
+                }
+                else if(max_nnz <= 512)
+                {
+                    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+                        (rocsparse::csric0_hash_kernel<CSRIC0_DIM, 64, 8>),
+                        csric0_blocks,
+                        csric0_threads,
+                        0,
+                        stream,
+                        m,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        (rocsparse_int*)info->csric0_info->trm_diag_ind,
+                        d_done_array,
+                        (rocsparse_int*)info->csric0_info->row_map,
+                        (rocsparse_int*)info->zero_pivot,
+                        (rocsparse_int*)info->singular_pivot,
+                        info->singular_tol,
+                        descr->base,
+                        batch_stride);
+                }
+                else if(max_nnz <= 1024)
+                {
+                    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+                        (rocsparse::csric0_hash_kernel<CSRIC0_DIM, 64, 16>),
+                        csric0_blocks,
+                        csric0_threads,
+                        0,
+                        stream,
+                        m,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        (rocsparse_int*)info->csric0_info->trm_diag_ind,
+                        d_done_array,
+                        (rocsparse_int*)info->csric0_info->row_map,
+                        (rocsparse_int*)info->zero_pivot,
+                        (rocsparse_int*)info->singular_pivot,
+                        info->singular_tol,
+                        descr->base,
+                        batch_stride);
+                }
+                else
+                {
+                    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
+                        (rocsparse::csric0_binsearch_kernel<CSRIC0_DIM, 64, false>),
+                        csric0_blocks,
+                        csric0_threads,
+                        0,
+                        stream,
+                        m,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        (rocsparse_int*)info->csric0_info->trm_diag_ind,
+                        d_done_array,
+                        (rocsparse_int*)info->csric0_info->row_map,
+                        (rocsparse_int*)info->zero_pivot,
+                        (rocsparse_int*)info->singular_pivot,
+                        info->singular_tol,
+                        descr->base,
+                        batch_stride);
+                }
+            }
+            else
+            {
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_arch_mismatch);
+            }
+        }
+#undef CSRIC0_DIM
+
+        return rocsparse_status_success;
+    }
+}
+
 template <typename T>
 rocsparse_status rocsparse::csric0_template(rocsparse_handle          handle, //0
                                             rocsparse_int             m, //1
@@ -226,304 +556,144 @@ rocsparse_status rocsparse::csric0_template(rocsparse_handle          handle, //
         return rocsparse_status_success;
     }
 
-    // Stream
-    hipStream_t stream = handle->stream;
-
-    // Buffer
-    char* ptr = reinterpret_cast<char*>(temp_buffer);
-    ptr += 256;
-
-    // done array
-    int* d_done_array = reinterpret_cast<int*>(ptr);
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::csric0_dispatch(
+        handle, m, descr, csr_val, csr_row_ptr, csr_col_ind, info, temp_buffer, 1, 0));
+    return rocsparse_status_success;
+}
 
-    // Initialize buffers
-    RETURN_IF_HIP_ERROR(hipMemsetAsync(d_done_array, 0, sizeof(int) * m, stream));
+namespace rocsparse
+{
+    static rocsparse_status csric0_refactorize_checkarg(rocsparse_handle          handle, //0
+                                                        const rocsparse_mat_descr descr, //1
+                                                        rocsparse_int             batch_count, //2
+                                                        void*                     csr_val, //3
+                                                        rocsparse_int             batch_stride, //4
+                                                        rocsparse_mat_info        info, //5
+                                                        void*                     temp_buffer) //6
+    {
+        ROCSPARSE_CHECKARG_POINTER(1, descr);
+        ROCSPARSE_CHECKARG(1,
+                           descr,
+                           (descr->type != rocsparse_matrix_type_general),
+                           rocsparse_status_not_implemented);
+        ROCSPARSE_CHECKARG(1,
+                           descr,
+                           (descr->storage_mode != rocsparse_storage_mode_sorted),
+                           rocsparse_status_requires_sorted_storage);
+        ROCSPARSE_CHECKARG_SIZE(2, batch_count);
+
+        // Refactorization requires the symbolic data from a previous analysis
+        ROCSPARSE_CHECKARG_POINTER(5, info);
+        ROCSPARSE_CHECKARG(
+            5, info, (info->csric0_info == nullptr), rocsparse_status_invalid_pointer);
+
+        // Meta data shared with a transposed triangular solve only holds the
+        // transposed sparsity pattern, the untransposed one is unknown
+        const rocsparse_trm_info shared = info->csric0_info;
+        ROCSPARSE_CHECKARG(5,
+                           info,
+                           (shared->trmt_row_ptr != nullptr
+                            && shared->trm_row_ptr == shared->trmt_row_ptr),
+                           rocsparse_status_not_implemented);
 
-    // Max nnz per row
-    rocsparse_int max_nnz = info->csric0_info->max_nnz;
+        const int64_t m   = info->csric0_info->m;
+        const int64_t nnz = info->csric0_info->nnz;
 
-    // Determine gcnArch and ASIC revision
-    const std::string gcn_arch_name = rocsparse::handle_get_arch_name(handle);
+        if(m == 0 || batch_count == 0)
+        {
+            return rocsparse_status_success;
+        }
 
-#define CSRIC0_DIM 256
-    dim3 csric0_blocks((m * handle->wavefront_size - 1) / CSRIC0_DIM + 1);
-    dim3 csric0_threads(CSRIC0_DIM);
+        ROCSPARSE_CHECKARG(4,
+                           batch_stride,
+                           (batch_count > 1 && batch_stride < nnz),
+                           rocsparse_status_invalid_size);
+        ROCSPARSE_CHECKARG_ARRAY(3, nnz, csr_val);
+        ROCSPARSE_CHECKARG_POINTER(6, temp_buffer);
 
-    if(gcn_arch_name == rocpsarse_arch_names::gfx908 && handle->asic_rev < 2)
-    {
-        RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
-            (rocsparse::csric0_binsearch_kernel<CSRIC0_DIM, 64, true>),
-            csric0_blocks,
-            csric0_threads,
-            0,
-            stream,
-            m,
-            csr_row_ptr,
-            csr_col_ind,
-            csr_val,
-            (rocsparse_int*)info->csric0_info->trm_diag_ind,
-            d_done_array,
-            (rocsparse_int*)info->csric0_info->row_map,
-            (rocsparse_int*)info->zero_pivot,
-            (rocsparse_int*)info->singular_pivot,
-            info->singular_tol,
-            descr->base);
+        return rocsparse_status_continue;
     }
-    else
+
+    template <typename T>
+    static rocsparse_status csric0_refactorize_impl(rocsparse_handle          handle,
+                                                    const rocsparse_mat_descr descr,
+                                                    rocsparse_int             batch_count,
+                                                    T*                        csr_val,
+                                                    rocsparse_int             batch_stride,
+                                                    rocsparse_mat_info        info,
+                                                    void*                     temp_buffer)
     {
-        if(handle->wavefront_size == 32)
+        const rocsparse_status status = rocsparse::csric0_refactorize_checkarg(
+            handle, descr, batch_count, csr_val, batch_stride, info, temp_buffer);
+        if(status != rocsparse_status_continue)
         {
-            if(max_nnz <= 32)
-            {
-                RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
-                    (rocsparse::csric0_hash_kernel<CSRIC0_DIM, 32, 1>),
-                    csric0_blocks,
-                    csric0_threads,
-                    0,
-                    stream,
-                    m,
-                    csr_row_ptr,
-                    csr_col_ind,
-                    csr_val,
-                    (rocsparse_int*)info->csric0_info->trm_diag_ind,
-                    d_done_array,
-                    (rocsparse_int*)info->csric0_info->row_map,
-                    (rocsparse_int*)info->zero_pivot,
-                    (rocsparse_int*)info->singular_pivot,
-                    info->singular_tol,
-                    descr->base);
-            }
-            else if(max_nnz <= 64)
-            {
-                RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
-                    (rocsparse::csric0_hash_kernel<CSRIC0_DIM, 32, 2>),
-                    csric0_blocks,
-                    csric0_threads,
-                    0,
-                    stream,
-                    m,
-                    csr_row_ptr,
-                    csr_col_ind,
-                    csr_val,
-                    (rocsparse_int*)info->csric0_info->trm_diag_ind,
-                    d_done_array,
-                    (rocsparse_int*)info->csric0_info->row_map,
-                    (rocsparse_int*)info->zero_pivot,
-                    (rocsparse_int*)info->singular_pivot,
-                    info->singular_tol,
-                    descr->base);
-            }
-            else if(max_nnz <= 128)
-            {
-                RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
-                    (rocsparse::csric0_hash_kernel<CSRIC0_DIM, 32, 4>),
-                    csric0_blocks,
-                    csric0_threads,
-                    0,
-                    stream,
-                    m,
-                    csr_row_ptr,
-                    csr_col_ind,
-                    csr_val,
-                    (rocsparse_int*)info->csric0_info->trm_diag_ind,
-                    d_done_array,
-                    (rocsparse_int*)info->csric0_info->row_map,
-                    (rocsparse_int*)info->zero_pivot,
-                    (rocsparse_int*)info->singular_pivot,
-                    info->singular_tol,
-                    descr->base);
-            }
-            else if(max_nnz <= 256)
-            {
-                RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
-                    (rocsparse::csric0_hash_kernel<CSRIC0_DIM, 32, 8>),
-                    csric0_blocks,
-                    csric0_threads,
-                    0,
-                    stream,
-                    m,
-                    csr_row_ptr,
-                    csr_col_ind,
-                    csr_val,
-                    (rocsparse_int*)info->csric0_info->trm_diag_ind,
-                    d_done_array,
-                    (rocsparse_int*)info->csric0_info->row_map,
-                    (rocsparse_int*)info->zero_pivot,
-                    (rocsparse_int*)info->singular_pivot,
-                    info->singular_tol,
-                    descr->base);
-            }
-            else if(max_nnz <= 512)
-            {
-                RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
-                    (rocsparse::csric0_hash_kernel<CSRIC0_DIM, 32, 16>),
-                    csric0_blocks,
-                    csric0_threads,
-                    0,
-                    stream,
-                    m,
-                    csr_row_ptr,
-                    csr_col_ind,
-                    csr_val,
-                    (rocsparse_int*)info->csric0_info->trm_diag_ind,
-                    d_done_array,
-                    (rocsparse_int*)info->csric0_info->row_map,
-                    (rocsparse_int*)info->zero_pivot,
-                    (rocsparse_int*)info->singular_pivot,
-                    info->singular_tol,
-                    descr->base);
-            }
-            else
-            {
-                RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
-                    (rocsparse::csric0_binsearch_kernel<CSRIC0_DIM, 32, false>),
-                    csric0_blocks,
-                    csric0_threads,
-                    0,
-                    stream,
-                    m,
-                    csr_row_ptr,
-                    csr_col_ind,
-                    csr_val,
-                    (rocsparse_int*)info->csric0_info->trm_diag_ind,
-                    d_done_array,
-                    (rocsparse_int*)info->csric0_info->row_map,
-                    (rocsparse_int*)info->zero_pivot,
-                    (rocsparse_int*)info->singular_pivot,
-                    info->singular_tol,
-                    descr->base);
-            }
-        }
-        else if(handle->wavefront_size == 64)
-        {
-            if(max_nnz <= 64)
-            {
-                RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
-                    (rocsparse::csric0_hash_kernel<CSRIC0_DIM, 64, 1>),
-                    csric0_blocks,
-                    csric0_threads,
-                    0,
-                    stream,
-                    m,
-                    csr_row_ptr,
-                    csr_col_ind,
-                    csr_val,
-                    (rocsparse_int*)info->csric0_info->trm_diag_ind,
-                    d_done_array,
-                    (rocsparse_int*)info->csric0_info->row_map,
-                    (rocsparse_int*)info->zero_pivot,
-                    (rocsparse_int*)info->singular_pivot,
-                    info->singular_tol,
-                    descr->base);
-            }
-            else if(max_nnz <= 128)
-            {
-                RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
-                    (rocsparse::csric0_hash_kernel<CSRIC0_DIM, 64, 2>),
-                    csric0_blocks,
-                    csric0_threads,
-                    0,
-                    stream,
-                    m,
-                    csr_row_ptr,
-                    csr_col_ind,
-                    csr_val,
-                    (rocsparse_int*)info->csric0_info->trm_diag_ind,
-                    d_done_array,
-                    (rocsparse_int*)info->csric0_info->row_map,
-                    (rocsparse_int*)info->zero_pivot,
-                    (rocsparse_int*)info->singular_pivot,
-                    info->singular_tol,
-                    descr->base);
-            }
-            else if(max_nnz <= 256)
-            {
-                RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
-                    (rocsparse::csric0_hash_kernel<CSRIC0_DIM, 64, 4>),
-                    csric0_blocks,
-                    csric0_threads,
-                    0,
-                    stream,
-                    m,
-                    csr_row_ptr,
-                    csr_col_ind,
-                    csr_val,
-                    (rocsparse_int*)info->csric0_info->trm_diag_ind,
-                    d_done_array,
-                    (rocsparse_int*)info->csric0_info->row_map,
-                    (rocsparse_int*)info->zero_pivot,
-                    (rocsparse_int*)info->singular_pivot,
-                    info->singular_tol,
-                    descr->base);
-            }
-            else if(max_nnz <= 512)
-            {
-                RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
-                    (rocsparse::csric0_hash_kernel<CSRIC0_DIM, 64, 8>),
-                    csric0_blocks,
-                    csric0_threads,
-                    0,
-                    stream,
-                    m,
-                    csr_row_ptr,
-                    csr_col_ind,
-                    csr_val,
-                    (rocsparse_int*)info->csric0_info->trm_diag_ind,
-                    d_done_array,
-                    (rocsparse_int*)info->csric0_info->row_map,
-                    (rocsparse_int*)info->zero_pivot,
-                    (rocsparse_int*)info->singular_pivot,
-                    info->singular_tol,
-                    descr->base);
-            }
-            else if(max_nnz <= 1024)
-            {
-                RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
-                    (rocsparse::csric0_hash_kernel<CSRIC0_DIM, 64, 16>),
-                    csric0_blocks,
-                    csric0_threads,
-                    0,
-                    stream,
-                    m,
-                    csr_row_ptr,
-                    csr_col_ind,
-                    csr_val,
-                    (rocsparse_int*)info->csric0_info->trm_diag_ind,
-                    d_done_array,
-                    (rocsparse_int*)info->csric0_info->row_map,
-                    (rocsparse_int*)info->zero_pivot,
-                    (rocsparse_int*)info->singular_pivot,
-                    info->singular_tol,
-                    descr->base);
-            }
-            else
-            {
-                RETURN_IF_HIPLAUNCHKERNELGGL_ERROR(
-                    (rocsparse::csric0_binsearch_kernel<CSRIC0_DIM, 64, false>),
-                    csric0_blocks,
-                    csric0_threads,
-                    0,
-                    stream,
-                    m,
-                    csr_row_ptr,
-                    csr_col_ind,
-                    csr_val,
-                    (rocsparse_int*)info->csric0_info->trm_diag_ind,
-                    d_done_array,
-                    (rocsparse_int*)info->csric0_info->row_map,
-                    (rocsparse_int*)info->zero_pivot,
-                    (rocsparse_int*)info->singular_pivot,
-                    info->singular_tol,
-                    descr->base);
-            }
-        }
-        else
-        {
-            RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_arch_mismatch);
+            RETURN_IF_ROCSPARSE_ERROR(status);
+            return rocsparse_status_success;
         }
+
+        // Everything symbolic, including the sparsity pattern, is taken from the
+        // analysis meta data.
+        const rocsparse_trm_info trm = info->csric0_info;
+
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse::csric0_dispatch(handle,
+                                       static_cast<rocsparse_int>(trm->m),
+                                       descr,
+                                       csr_val,
+                                       reinterpret_cast<const rocsparse_int*>(trm->trm_row_ptr),
+                                       reinterpret_cast<const rocsparse_int*>(trm->trm_col_ind),
+                                       info,
+                                       temp_buffer,
+                                       batch_count,
+                                       batch_stride));
+        return rocsparse_status_success;
     }
-#undef CSRIC0_DIM
+}
+
+template <typename T>
+rocsparse_status rocsparse::csric0_refactorize_template(rocsparse_handle          handle,
+                                                        const rocsparse_mat_descr descr,
+                                                        T*                        csr_val,
+                                                        rocsparse_mat_info        info,
+                                                        void*                     temp_buffer)
+{
+    ROCSPARSE_CHECKARG_HANDLE(0, handle);
 
+    rocsparse::log_trace(handle,
+                         rocsparse::replaceX<T>("rocsparse_Xcsric0_refactorize"),
+                         (const void*&)descr,
+                         (const void*&)csr_val,
+                         (const void*&)info,
+                         (const void*&)temp_buffer);
+
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse::csric0_refactorize_impl(handle, descr, 1, csr_val, 0, info, temp_buffer));
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status
+    rocsparse::csric0_refactorize_batched_template(rocsparse_handle          handle,
+                                                   const rocsparse_mat_descr descr,
+                                                   rocsparse_int             batch_count,
+                                                   T*                        csr_val,
+                                                   rocsparse_int             batch_stride,
+                                                   rocsparse_mat_info        info,
+                                                   void*                     temp_buffer)
+{
+    ROCSPARSE_CHECKARG_HANDLE(0, handle);
+
+    rocsparse::log_trace(handle,
+                         rocsparse::replaceX<T>("rocsparse_Xcsric0_refactorize_batched"),
+                         (const void*&)descr,
+                         batch_count,
+                         (const void*&)csr_val,
+                         batch_stride,
+                         (const void*&)info,
+                         (const void*&)temp_buffer);
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::csric0_refactorize_impl(
+        handle, descr, batch_count, csr_val, batch_stride, info, temp_buffer));
     return rocsparse_status_success;
 }
 
@@ -894,6 +1064,9 @@ try
         return rocsparse_status_success;
     }
 
+    // Reading the pivot back blocks the host
+    RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
     // Differentiate between pointer modes
     if(handle->pointer_mode == rocsparse_pointer_mode_device)
     {
@@ -982,6 +1155,9 @@ try
         return rocsparse_status_success;
     }
 
+    // Reading the pivot back blocks the host
+    RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
     constexpr rocsparse_int max_int        = std::numeric_limits<rocsparse_int>::max();
     rocsparse_int           zero_pivot     = max_int;
     rocsparse_int           singular_pivot = max_int;
@@ -1089,3 +1265,180 @@ catch(...)
 {
     return rocsparse::exception_to_rocsparse_status();
 }
+
+extern "C" rocsparse_status
+    rocsparse_csric0_refactorize_batched_buffer_size(rocsparse_handle   handle,
+                                                     rocsparse_mat_info info,
+                                                     rocsparse_int      batch_count,
+                                                     size_t*            buffer_size)
+try
+{
+    ROCSPARSE_CHECKARG_HANDLE(0, handle);
+
+    // Logging
+    rocsparse::log_trace(handle,
+                         "rocsparse_csric0_refactorize_batched_buffer_size",
+                         (const void*&)info,
+                         batch_count,
+                         (const void*&)buffer_size);
+
+    ROCSPARSE_CHECKARG_POINTER(1, info);
+    ROCSPARSE_CHECKARG(1, info, (info->csric0_info == nullptr), rocsparse_status_invalid_pointer);
+    ROCSPARSE_CHECKARG_SIZE(2, batch_count);
+    ROCSPARSE_CHECKARG_POINTER(3, buffer_size);
+
+    const size_t m = info->csric0_info->m;
+
+    // 256 bytes of scratch followed by one done array per batch
+    *buffer_size = 256;
+    if(m > 0 && batch_count > 0)
+    {
+        *buffer_size += ((sizeof(int) * m * batch_count - 1) / 256 + 1) * 256;
+    }
+
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
+
+extern "C" rocsparse_status rocsparse_scsric0_refactorize(rocsparse_handle          handle,
+                                                          const rocsparse_mat_descr descr,
+                                                          float*                    csr_val,
+                                                          rocsparse_mat_info        info,
+                                                          void*                     temp_buffer)
+try
+{
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse::csric0_refactorize_template(handle, descr, csr_val, info, temp_buffer));
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
+
+extern "C" rocsparse_status rocsparse_dcsric0_refactorize(rocsparse_handle          handle,
+                                                          const rocsparse_mat_descr descr,
+                                                          double*                   csr_val,
+                                                          rocsparse_mat_info        info,
+                                                          void*                     temp_buffer)
+try
+{
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse::csric0_refactorize_template(handle, descr, csr_val, info, temp_buffer));
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
+
+extern "C" rocsparse_status rocsparse_ccsric0_refactorize(rocsparse_handle          handle,
+                                                          const rocsparse_mat_descr descr,
+                                                          rocsparse_float_complex*  csr_val,
+                                                          rocsparse_mat_info        info,
+                                                          void*                     temp_buffer)
+try
+{
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse::csric0_refactorize_template(handle, descr, csr_val, info, temp_buffer));
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
+
+extern "C" rocsparse_status rocsparse_zcsric0_refactorize(rocsparse_handle          handle,
+                                                          const rocsparse_mat_descr descr,
+                                                          rocsparse_double_complex* csr_val,
+                                                          rocsparse_mat_info        info,
+                                                          void*                     temp_buffer)
+try
+{
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse::csric0_refactorize_template(handle, descr, csr_val, info, temp_buffer));
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
+
+extern "C" rocsparse_status
+    rocsparse_scsric0_refactorize_batched(rocsparse_handle          handle,
+                                          const rocsparse_mat_descr descr,
+                                          rocsparse_int             batch_count,
+                                          float*                    csr_val,
+                                          rocsparse_int             batch_stride,
+                                          rocsparse_mat_info        info,
+                                          void*                     temp_buffer)
+try
+{
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::csric0_refactorize_batched_template(
+        handle, descr, batch_count, csr_val, batch_stride, info, temp_buffer));
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
+
+extern "C" rocsparse_status
+    rocsparse_dcsric0_refactorize_batched(rocsparse_handle          handle,
+                                          const rocsparse_mat_descr descr,
+                                          rocsparse_int             batch_count,
+                                          double*                   csr_val,
+                                          rocsparse_int             batch_stride,
+                                          rocsparse_mat_info        info,
+                                          void*                     temp_buffer)
+try
+{
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::csric0_refactorize_batched_template(
+        handle, descr, batch_count, csr_val, batch_stride, info, temp_buffer));
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
+
+extern "C" rocsparse_status
+    rocsparse_ccsric0_refactorize_batched(rocsparse_handle          handle,
+                                          const rocsparse_mat_descr descr,
+                                          rocsparse_int             batch_count,
+                                          rocsparse_float_complex*  csr_val,
+                                          rocsparse_int             batch_stride,
+                                          rocsparse_mat_info        info,
+                                          void*                     temp_buffer)
+try
+{
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::csric0_refactorize_batched_template(
+        handle, descr, batch_count, csr_val, batch_stride, info, temp_buffer));
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
+
+extern "C" rocsparse_status
+    rocsparse_zcsric0_refactorize_batched(rocsparse_handle          handle,
+                                          const rocsparse_mat_descr descr,
+                                          rocsparse_int             batch_count,
+                                          rocsparse_double_complex* csr_val,
+                                          rocsparse_int             batch_stride,
+                                          rocsparse_mat_info        info,
+                                          void*                     temp_buffer)
+try
+{
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::csric0_refactorize_batched_template(
+        handle, descr, batch_count, csr_val, batch_stride, info, temp_buffer));
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
@@ -52,4 +52,20 @@ namespace rocsparse
                                      rocsparse_mat_info        info,
                                      rocsparse_solve_policy    policy,
                                      void*                     temp_buffer);
+
+    template <typename T>
+    rocsparse_status csric0_refactorize_template(rocsparse_handle          handle,
+                                                 const rocsparse_mat_descr descr,
+                                                 T*                        csr_val,
+                                                 rocsparse_mat_info        info,
+                                                 void*                     temp_buffer);
+
+    template <typename T>
+    rocsparse_status csric0_refactorize_batched_template(rocsparse_handle          handle,
+                                                         const rocsparse_mat_descr descr,
+                                                         rocsparse_int             batch_count,
+                                                         T*                        csr_val,
+                                                         rocsparse_int             batch_stride,
+                                                         rocsparse_mat_info        info,
+                                                         void*                     temp_buffer);
 }
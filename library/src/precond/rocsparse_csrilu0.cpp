@@ -91,8 +91,13 @@ namespace rocsparse
                            rocsparse_index_base idx_base,
                            int                  enable_boost,
                            U                    boost_tol_device_host,
-                           V                    boost_val_device_host)
+                           V                    boost_val_device_host,
+                           int64_t              batch_stride)
     {
+        // Offset into the current batch
+        csr_val += batch_stride * hipBlockIdx_y;
+        done += static_cast<int64_t>(m) * hipBlockIdx_y;
+
         auto boost_tol = (enable_boost) ? rocsparse::load_scalar_device_host(boost_tol_device_host)
                                         : rocsparse::zero_scalar_device_host(boost_tol_device_host);
 
@@ -135,8 +140,13 @@ namespace rocsparse
                       rocsparse_index_base idx_base,
                       int                  enable_boost,
                       U                    boost_tol_device_host,
-                      V                    boost_val_device_host)
+                      V                    boost_val_device_host,
+                      int64_t              batch_stride)
     {
+        // Offset into the current batch
+        csr_val += batch_stride * hipBlockIdx_y;
+        done += static_cast<int64_t>(m) * hipBlockIdx_y;
+
         auto boost_tol = (enable_boost) ? rocsparse::load_scalar_device_host(boost_tol_device_host)
                                         : rocsparse::zero_scalar_device_host(boost_tol_device_host);
 
@@ -170,6 +180,8 @@ namespace rocsparse
                                              rocsparse_mat_info        info,
                                              rocsparse_solve_policy    policy,
                                              void*                     temp_buffer,
+                                             rocsparse_int             batch_count,
+                                             int64_t                   batch_stride,
                                              U                         boost_tol_device_host,
                                              V                         boost_val_device_host)
     {
@@ -181,11 +193,12 @@ namespace rocsparse
         char* ptr = reinterpret_cast<char*>(temp_buffer);
         ptr += 256;
 
-        // done array
+        // done array, one per batch
         int* d_done_array = reinterpret_cast<int*>(ptr);
 
         // Initialize buffers
-        RETURN_IF_HIP_ERROR(hipMemsetAsync(d_done_array, 0, sizeof(int) * m, stream));
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(
+            d_done_array, 0, sizeof(int) * static_cast<size_t>(m) * batch_count, stream));
 
         // Max nnz per row
         rocsparse_int max_nnz = info->csrilu0_info->max_nnz;
@@ -194,7 +207,7 @@ namespace rocsparse
         const std::string gcn_arch_name = rocsparse::handle_get_arch_name(handle);
 
 #define CSRILU0_DIM 256
-        dim3 csrilu0_blocks((m * handle->wavefront_size - 1) / CSRILU0_DIM + 1);
+        dim3 csrilu0_blocks((m * handle->wavefront_size - 1) / CSRILU0_DIM + 1, batch_count);
         dim3 csrilu0_threads(CSRILU0_DIM);
 
         if(gcn_arch_name == rocpsarse_arch_names::gfx908 && handle->asic_rev < 2)
@@ -218,7 +231,8 @@ namespace rocsparse
                 descr->base,
                 info->boost_enable,
                 boost_tol_device_host,
-                boost_val_device_host);
+                boost_val_device_host,
+                batch_stride);
         }
         else
         {
@@ -245,7 +259,8 @@ namespace rocsparse
                         descr->base,
                         info->boost_enable,
                         boost_tol_device_host,
-                        boost_val_device_host);
+                        boost_val_device_host,
+                        batch_stride);
                 }
                 else if(max_nnz < 64)
                 {
@@ -268,7 +283,8 @@ namespace rocsparse
                         descr->base,
                         info->boost_enable,
                         boost_tol_device_host,
-                        boost_val_device_host);
+                        boost_val_device_host,
+                        batch_stride);
                 }
                 else if(max_nnz < 128)
                 {
@@ -291,7 +307,8 @@ namespace rocsparse
                         descr->base,
                         info->boost_enable,
                         boost_tol_device_host,
-                        boost_val_device_host);
+                        boost_val_device_host,
+                        batch_stride);
                 }
                 else if(max_nnz < 256)
                 {
@@ -314,7 +331,8 @@ namespace rocsparse
                         descr->base,
                         info->boost_enable,
                         boost_tol_device_host,
-                        boost_val_device_host);
+                        boost_val_device_host,
+                        batch_stride);
                 }
                 else if(max_nnz < 512)
                 {
@@ -337,7 +355,8 @@ namespace rocsparse
                         descr->base,
                         info->boost_enable,
                         boost_tol_device_host,
-                        boost_val_device_host);
+                        boost_val_device_host,
+                        batch_stride);
                 }
                 else
                 {
@@ -360,7 +379,8 @@ namespace rocsparse
                         descr->base,
                         info->boost_enable,
                         boost_tol_device_host,
-                        boost_val_device_host);
+                        boost_val_device_host,
+                        batch_stride);
                 }
             }
             else if(handle->wavefront_size == 64)
@@ -386,7 +406,8 @@ namespace rocsparse
                         descr->base,
                         info->boost_enable,
                         boost_tol_device_host,
-                        boost_val_device_host);
+                        boost_val_device_host,
+                        batch_stride);
                 }
                 else if(max_nnz < 128)
                 {
@@ -409,7 +430,8 @@ namespace rocsparse
                         descr->base,
                         info->boost_enable,
                         boost_tol_device_host,
-                        boost_val_device_host);
+                        boost_val_device_host,
+                        batch_stride);
                 }
                 else if(max_nnz < 256)
                 {
@@ -432,7 +454,8 @@ namespace rocsparse
                         descr->base,
                         info->boost_enable,
                         boost_tol_device_host,
-                        boost_val_device_host);
+                        boost_val_device_host,
+                        batch_stride);
                 }
                 else if(max_nnz < 512)
                 {
@@ -455,7 +478,8 @@ namespace rocsparse
                         descr->base,
                         info->boost_enable,
                         boost_tol_device_host,
-                        boost_val_device_host);
+                        boost_val_device_host,
+                        batch_stride);
                 }
                 else if(max_nnz < 1024)
                 {
@@ -478,7 +502,8 @@ namespace rocsparse
                         descr->base,
                         info->boost_enable,
                         boost_tol_device_host,
-                        boost_val_device_host);
+                        boost_val_device_host,
+                        batch_stride);
                 }
                 else
                 {
@@ -501,7 +526,8 @@ namespace rocsparse
                         descr->base,
                         info->boost_enable,
                         boost_tol_device_host,
-                        boost_val_device_host);
+                        boost_val_device_host,
+                        batch_stride);
                 }
             }
             else
@@ -588,7 +614,9 @@ namespace rocsparse
                                          const rocsparse_int*      csr_col_ind,
                                          rocsparse_mat_info        info,
                                          rocsparse_solve_policy    policy,
-                                         void*                     temp_buffer)
+                                         void*                     temp_buffer,
+                                         rocsparse_int             batch_count,
+                                         int64_t                   batch_stride)
     {
 
         if(handle->pointer_mode == rocsparse_pointer_mode_device)
@@ -604,6 +632,8 @@ namespace rocsparse
                                             info,
                                             policy,
                                             temp_buffer,
+                                            batch_count,
+                                            batch_stride,
                                             reinterpret_cast<const U*>(info->boost_tol),
                                             reinterpret_cast<const T*>(info->boost_val)));
             return rocsparse_status_success;
@@ -621,6 +651,8 @@ namespace rocsparse
                 info,
                 policy,
                 temp_buffer,
+                batch_count,
+                batch_stride,
                 (info->boost_enable != 0) ? *reinterpret_cast<const U*>(info->boost_tol)
                                           : static_cast<U>(0),
                 (info->boost_enable != 0) ? *reinterpret_cast<const T*>(info->boost_val)
@@ -663,8 +695,156 @@ rocsparse_status rocsparse::csrilu0_template(rocsparse_handle          handle,
         return rocsparse_status_success;
     }
 
-    RETURN_IF_ROCSPARSE_ERROR((rocsparse::csrilu0_core<T, U>(
-        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer)));
+    RETURN_IF_ROCSPARSE_ERROR((rocsparse::csrilu0_core<T, U>(handle,
+                                                             m,
+                                                             nnz,
+                                                             descr,
+                                                             csr_val,
+                                                             csr_row_ptr,
+                                                             csr_col_ind,
+                                                             info,
+                                                             policy,
+                                                             temp_buffer,
+                                                             1,
+                                                             0)));
+    return rocsparse_status_success;
+}
+
+namespace rocsparse
+{
+    static rocsparse_status csrilu0_refactorize_checkarg(rocsparse_handle          handle, //0
+                                                         const rocsparse_mat_descr descr, //1
+                                                         rocsparse_int             batch_count, //2
+                                                         void*                     csr_val, //3
+                                                         rocsparse_int             batch_stride, //4
+                                                         rocsparse_mat_info        info, //5
+                                                         void*                     temp_buffer) //6
+    {
+        ROCSPARSE_CHECKARG_POINTER(1, descr);
+        ROCSPARSE_CHECKARG(1,
+                           descr,
+                           (descr->type != rocsparse_matrix_type_general),
+                           rocsparse_status_not_implemented);
+        ROCSPARSE_CHECKARG(1,
+                           descr,
+                           (descr->storage_mode != rocsparse_storage_mode_sorted),
+                           rocsparse_status_requires_sorted_storage);
+        ROCSPARSE_CHECKARG_SIZE(2, batch_count);
+
+        // Refactorization requires the symbolic data from a previous analysis
+        ROCSPARSE_CHECKARG_POINTER(5, info);
+        ROCSPARSE_CHECKARG(
+            5, info, (info->csrilu0_info == nullptr), rocsparse_status_invalid_pointer);
+
+        // Meta data shared with a transposed triangular solve only holds the
+        // transposed sparsity pattern, the untransposed one is unknown
+        const rocsparse_trm_info shared = info->csrilu0_info;
+        ROCSPARSE_CHECKARG(5,
+                           info,
+                           (shared->trmt_row_ptr != nullptr
+                            && shared->trm_row_ptr == shared->trmt_row_ptr),
+                           rocsparse_status_not_implemented);
+
+        const int64_t m   = info->csrilu0_info->m;
+        const int64_t nnz = info->csrilu0_info->nnz;
+
+        if(m == 0 || batch_count == 0)
+        {
+            return rocsparse_status_success;
+        }
+
+        ROCSPARSE_CHECKARG(4,
+                           batch_stride,
+                           (batch_count > 1 && batch_stride < nnz),
+                           rocsparse_status_invalid_size);
+        ROCSPARSE_CHECKARG_ARRAY(3, nnz, csr_val);
+        ROCSPARSE_CHECKARG_POINTER(6, temp_buffer);
+
+        return rocsparse_status_continue;
+    }
+
+    template <typename T, typename U>
+    static rocsparse_status csrilu0_refactorize_impl(rocsparse_handle          handle,
+                                                     const rocsparse_mat_descr descr,
+                                                     rocsparse_int             batch_count,
+                                                     T*                        csr_val,
+                                                     rocsparse_int             batch_stride,
+                                                     rocsparse_mat_info        info,
+                                                     void*                     temp_buffer)
+    {
+        const rocsparse_status status = rocsparse::csrilu0_refactorize_checkarg(
+            handle, descr, batch_count, csr_val, batch_stride, info, temp_buffer);
+        if(status != rocsparse_status_continue)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(status);
+            return rocsparse_status_success;
+        }
+
+        // Everything symbolic, including the sparsity pattern, is taken from the
+        // analysis meta data.
+        const rocsparse_trm_info trm = info->csrilu0_info;
+
+        RETURN_IF_ROCSPARSE_ERROR((rocsparse::csrilu0_core<T, U>(
+            handle,
+            static_cast<rocsparse_int>(trm->m),
+            static_cast<rocsparse_int>(trm->nnz),
+            descr,
+            csr_val,
+            reinterpret_cast<const rocsparse_int*>(trm->trm_row_ptr),
+            reinterpret_cast<const rocsparse_int*>(trm->trm_col_ind),
+            info,
+            rocsparse_solve_policy_auto,
+            temp_buffer,
+            batch_count,
+            batch_stride)));
+        return rocsparse_status_success;
+    }
+}
+
+template <typename T, typename U>
+rocsparse_status rocsparse::csrilu0_refactorize_template(rocsparse_handle          handle,
+                                                         const rocsparse_mat_descr descr,
+                                                         T*                        csr_val,
+                                                         rocsparse_mat_info        info,
+                                                         void*                     temp_buffer)
+{
+    ROCSPARSE_CHECKARG_HANDLE(0, handle);
+
+    rocsparse::log_trace(handle,
+                         rocsparse::replaceX<T>("rocsparse_Xcsrilu0_refactorize"),
+                         (const void*&)descr,
+                         (const void*&)csr_val,
+                         (const void*&)info,
+                         (const void*&)temp_buffer);
+
+    RETURN_IF_ROCSPARSE_ERROR((rocsparse::csrilu0_refactorize_impl<T, U>(
+        handle, descr, 1, csr_val, 0, info, temp_buffer)));
+    return rocsparse_status_success;
+}
+
+template <typename T, typename U>
+rocsparse_status
+    rocsparse::csrilu0_refactorize_batched_template(rocsparse_handle          handle,
+                                                    const rocsparse_mat_descr descr,
+                                                    rocsparse_int             batch_count,
+                                                    T*                        csr_val,
+                                                    rocsparse_int             batch_stride,
+                                                    rocsparse_mat_info        info,
+                                                    void*                     temp_buffer)
+{
+    ROCSPARSE_CHECKARG_HANDLE(0, handle);
+
+    rocsparse::log_trace(handle,
+                         rocsparse::replaceX<T>("rocsparse_Xcsrilu0_refactorize_batched"),
+                         (const void*&)descr,
+                         batch_count,
+                         (const void*&)csr_val,
+                         batch_stride,
+                         (const void*&)info,
+                         (const void*&)temp_buffer);
+
+    RETURN_IF_ROCSPARSE_ERROR((rocsparse::csrilu0_refactorize_impl<T, U>(
+        handle, descr, batch_count, csr_val, batch_stride, info, temp_buffer)));
     return rocsparse_status_success;
 }
 
@@ -933,6 +1113,9 @@ try
         return rocsparse_status_success;
     }
 
+    // Reading the pivot back blocks the host
+    RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
     // Differentiate between pointer modes
     if(handle->pointer_mode == rocsparse_pointer_mode_device)
     {
@@ -1019,6 +1202,9 @@ try
         return rocsparse_status_success;
     }
 
+    // Reading the pivot back blocks the host
+    RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
     constexpr rocsparse_int max_int        = std::numeric_limits<rocsparse_int>::max();
     rocsparse_int           zero_pivot     = max_int;
     rocsparse_int           singular_pivot = max_int;
@@ -1126,3 +1312,227 @@ catch(...)
 {
     return rocsparse::exception_to_rocsparse_status();
 }
+
+extern "C" rocsparse_status
+    rocsparse_csrilu0_refactorize_batched_buffer_size(rocsparse_handle   handle,
+                                                      rocsparse_mat_info info,
+                                                      rocsparse_int      batch_count,
+                                                      size_t*            buffer_size)
+try
+{
+    ROCSPARSE_CHECKARG_HANDLE(0, handle);
+
+    // Logging
+    rocsparse::log_trace(handle,
+                         "rocsparse_csrilu0_refactorize_batched_buffer_size",
+                         (const void*&)info,
+                         batch_count,
+                         (const void*&)buffer_size);
+
+    ROCSPARSE_CHECKARG_POINTER(1, info);
+    ROCSPARSE_CHECKARG(
+        1, info, (info->csrilu0_info == nullptr), rocsparse_status_invalid_pointer);
+    ROCSPARSE_CHECKARG_SIZE(2, batch_count);
+    ROCSPARSE_CHECKARG_POINTER(3, buffer_size);
+
+    const size_t m = info->csrilu0_info->m;
+
+    // 256 bytes of scratch followed by one done array per batch
+    *buffer_size = 256;
+    if(m > 0 && batch_count > 0)
+    {
+        *buffer_size += ((sizeof(int) * m * batch_count - 1) / 256 + 1) * 256;
+    }
+
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
+
+extern "C" rocsparse_status
+    rocsparse_scsrilu0_refactorize(rocsparse_handle          handle,
+                                   const rocsparse_mat_descr descr,
+                                   float*                    csr_val,
+                                   rocsparse_mat_info        info,
+                                   void*                     temp_buffer)
+try
+{
+    if(info != nullptr && info->use_double_prec_tol)
+    {
+        RETURN_IF_ROCSPARSE_ERROR((rocsparse::csrilu0_refactorize_template<float, double>(
+            handle, descr, csr_val, info, temp_buffer)));
+        return rocsparse_status_success;
+    }
+    else
+    {
+        RETURN_IF_ROCSPARSE_ERROR((rocsparse::csrilu0_refactorize_template<float, float>(
+            handle, descr, csr_val, info, temp_buffer)));
+        return rocsparse_status_success;
+    }
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
+
+extern "C" rocsparse_status
+    rocsparse_dcsrilu0_refactorize(rocsparse_handle          handle,
+                                   const rocsparse_mat_descr descr,
+                                   double*                   csr_val,
+                                   rocsparse_mat_info        info,
+                                   void*                     temp_buffer)
+try
+{
+    RETURN_IF_ROCSPARSE_ERROR((rocsparse::csrilu0_refactorize_template<double, double>(
+        handle, descr, csr_val, info, temp_buffer)));
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
+
+extern "C" rocsparse_status
+    rocsparse_ccsrilu0_refactorize(rocsparse_handle          handle,
+                                   const rocsparse_mat_descr descr,
+                                   rocsparse_float_complex*  csr_val,
+                                   rocsparse_mat_info        info,
+                                   void*                     temp_buffer)
+try
+{
+    if(info != nullptr && info->use_double_prec_tol)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            (rocsparse::csrilu0_refactorize_template<rocsparse_float_complex, double>(
+                handle, descr, csr_val, info, temp_buffer)));
+        return rocsparse_status_success;
+    }
+    else
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            (rocsparse::csrilu0_refactorize_template<rocsparse_float_complex, float>(
+                handle, descr, csr_val, info, temp_buffer)));
+        return rocsparse_status_success;
+    }
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
+
+extern "C" rocsparse_status
+    rocsparse_zcsrilu0_refactorize(rocsparse_handle          handle,
+                                   const rocsparse_mat_descr descr,
+                                   rocsparse_double_complex* csr_val,
+                                   rocsparse_mat_info        info,
+                                   void*                     temp_buffer)
+try
+{
+    RETURN_IF_ROCSPARSE_ERROR(
+        (rocsparse::csrilu0_refactorize_template<rocsparse_double_complex, double>(
+            handle, descr, csr_val, info, temp_buffer)));
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
+
+extern "C" rocsparse_status
+    rocsparse_scsrilu0_refactorize_batched(rocsparse_handle          handle,
+                                           const rocsparse_mat_descr descr,
+                                           rocsparse_int             batch_count,
+                                           float*                    csr_val,
+                                           rocsparse_int             batch_stride,
+                                           rocsparse_mat_info        info,
+                                           void*                     temp_buffer)
+try
+{
+    if(info != nullptr && info->use_double_prec_tol)
+    {
+        RETURN_IF_ROCSPARSE_ERROR((rocsparse::csrilu0_refactorize_batched_template<float, double>(
+            handle, descr, batch_count, csr_val, batch_stride, info, temp_buffer)));
+        return rocsparse_status_success;
+    }
+    else
+    {
+        RETURN_IF_ROCSPARSE_ERROR((rocsparse::csrilu0_refactorize_batched_template<float, float>(
+            handle, descr, batch_count, csr_val, batch_stride, info, temp_buffer)));
+        return rocsparse_status_success;
+    }
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
+
+extern "C" rocsparse_status
+    rocsparse_dcsrilu0_refactorize_batched(rocsparse_handle          handle,
+                                           const rocsparse_mat_descr descr,
+                                           rocsparse_int             batch_count,
+                                           double*                   csr_val,
+                                           rocsparse_int             batch_stride,
+                                           rocsparse_mat_info        info,
+                                           void*                     temp_buffer)
+try
+{
+    RETURN_IF_ROCSPARSE_ERROR((rocsparse::csrilu0_refactorize_batched_template<double, double>(
+        handle, descr, batch_count, csr_val, batch_stride, info, temp_buffer)));
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
+
+extern "C" rocsparse_status
+    rocsparse_ccsrilu0_refactorize_batched(rocsparse_handle          handle,
+                                           const rocsparse_mat_descr descr,
+                                           rocsparse_int             batch_count,
+                                           rocsparse_float_complex*  csr_val,
+                                           rocsparse_int             batch_stride,
+                                           rocsparse_mat_info        info,
+                                           void*                     temp_buffer)
+try
+{
+    if(info != nullptr && info->use_double_prec_tol)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            (rocsparse::csrilu0_refactorize_batched_template<rocsparse_float_complex, double>(
+                handle, descr, batch_count, csr_val, batch_stride, info, temp_buffer)));
+        return rocsparse_status_success;
+    }
+    else
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            (rocsparse::csrilu0_refactorize_batched_template<rocsparse_float_complex, float>(
+                handle, descr, batch_count, csr_val, batch_stride, info, temp_buffer)));
+        return rocsparse_status_success;
+    }
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
+
+extern "C" rocsparse_status
+    rocsparse_zcsrilu0_refactorize_batched(rocsparse_handle          handle,
+                                           const rocsparse_mat_descr descr,
+                                           rocsparse_int             batch_count,
+                                           rocsparse_double_complex* csr_val,
+                                           rocsparse_int             batch_stride,
+                                           rocsparse_mat_info        info,
+                                           void*                     temp_buffer)
+try
+{
+    RETURN_IF_ROCSPARSE_ERROR(
+        (rocsparse::csrilu0_refactorize_batched_template<rocsparse_double_complex, double>(
+            handle, descr, batch_count, csr_val, batch_stride, info, temp_buffer)));
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
@@ -92,6 +92,9 @@ namespace rocsparse
         // User is explicitly asking to force a re-analysis, or no valid data has been
         // found to be re-used.
 
+        // The analysis reads its meta data back on the host
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
         // Clear csrilu0 info
         RETURN_IF_ROCSPARSE_ERROR(rocsparse::destroy_trm_info(info->csrilu0_info));
 
@@ -196,6 +196,23 @@ rocsparse_status
     ROCSPARSE_CHECKARG_ARRAY(5, batch_count, x);
     ROCSPARSE_CHECKARG_POINTER(8, buffer_size);
 
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::gtsv_no_pivot_strided_batch_buffer_size_core(
+        handle, m, dl, d, du, x, batch_count, batch_stride, buffer_size));
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status
+    rocsparse::gtsv_no_pivot_strided_batch_buffer_size_core(rocsparse_handle handle,
+                                                            rocsparse_int    m,
+                                                            const T*         dl,
+                                                            const T*         d,
+                                                            const T*         du,
+                                                            const T*         x,
+                                                            rocsparse_int    batch_count,
+                                                            rocsparse_int    batch_stride,
+                                                            size_t*          buffer_size)
+{
     // Quick return if possible
     if(batch_count == 0)
     {
@@ -447,6 +464,22 @@ rocsparse_status rocsparse::gtsv_no_pivot_strided_batch_template(rocsparse_handl
     ROCSPARSE_CHECKARG(
         8, temp_buffer, (m > 512 && temp_buffer == nullptr), rocsparse_status_invalid_pointer);
 
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::gtsv_no_pivot_strided_batch_core(
+        handle, m, dl, d, du, x, batch_count, batch_stride, temp_buffer));
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse::gtsv_no_pivot_strided_batch_core(rocsparse_handle handle,
+                                                             rocsparse_int    m,
+                                                             const T*         dl,
+                                                             const T*         d,
+                                                             const T*         du,
+                                                             T*               x,
+                                                             rocsparse_int    batch_count,
+                                                             rocsparse_int    batch_stride,
+                                                             void*            temp_buffer)
+{
     if(batch_count == 0)
     {
         return rocsparse_status_success;
@@ -465,6 +498,34 @@ rocsparse_status rocsparse::gtsv_no_pivot_strided_batch_template(rocsparse_handl
     return rocsparse_status_success;
 }
 
+#define INSTANTIATE(TYPE)                                                                    \
+    template rocsparse_status rocsparse::gtsv_no_pivot_strided_batch_buffer_size_core<TYPE>( \
+        rocsparse_handle handle,                                                             \
+        rocsparse_int    m,                                                                  \
+        const TYPE*      dl,                                                                 \
+        const TYPE*      d,                                                                  \
+        const TYPE*      du,                                                                 \
+        const TYPE*      x,                                                                  \
+        rocsparse_int    batch_count,                                                        \
+        rocsparse_int    batch_stride,                                                       \
+        size_t*          buffer_size);                                                       \
+    template rocsparse_status rocsparse::gtsv_no_pivot_strided_batch_core<TYPE>(             \
+        rocsparse_handle handle,                                                             \
+        rocsparse_int    m,                                                                  \
+        const TYPE*      dl,                                                                 \
+        const TYPE*      d,                                                                  \
+        const TYPE*      du,                                                                 \
+        TYPE*            x,                                                                  \
+        rocsparse_int    batch_count,                                                        \
+        rocsparse_int    batch_stride,                                                       \
+        void*            temp_buffer)
+
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+#undef INSTANTIATE
+
 /*
  * ===========================================================================
  *    C wrapper
@@ -50,4 +50,26 @@ namespace rocsparse
                                                           rocsparse_int    batch_count,
                                                           rocsparse_int    batch_stride,
                                                           void*            temp_buffer);
+
+    template <typename T>
+    rocsparse_status gtsv_no_pivot_strided_batch_buffer_size_core(rocsparse_handle handle,
+                                                                  rocsparse_int    m,
+                                                                  const T*         dl,
+                                                                  const T*         d,
+                                                                  const T*         du,
+                                                                  const T*         x,
+                                                                  rocsparse_int    batch_count,
+                                                                  rocsparse_int    batch_stride,
+                                                                  size_t*          buffer_size);
+
+    template <typename T>
+    rocsparse_status gtsv_no_pivot_strided_batch_core(rocsparse_handle handle,
+                                                      rocsparse_int    m,
+                                                      const T*         dl,
+                                                      const T*         d,
+                                                      const T*         du,
+                                                      T*               x,
+                                                      rocsparse_int    batch_count,
+                                                      rocsparse_int    batch_stride,
+                                                      void*            temp_buffer);
 }
@@ -0,0 +1,257 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_gtsv_strided_batch.hpp"
+#include "internal/precond/rocsparse_gtsv.h"
+#include "rocsparse_gtsv_no_pivot_strided_batch.hpp"
+
+#include "gtsv_strided_batch_device.h"
+
+template <typename T>
+rocsparse_status rocsparse::gtsv_strided_batch_buffer_size_template(rocsparse_handle handle,
+                                                                    rocsparse_int    m,
+                                                                    const T*         dl,
+                                                                    const T*         d,
+                                                                    const T*         du,
+                                                                    const T*         x,
+                                                                    rocsparse_int    batch_count,
+                                                                    rocsparse_int    batch_stride,
+                                                                    size_t*          buffer_size)
+{
+    rocsparse::log_trace(handle,
+                         rocsparse::replaceX<T>("rocsparse_Xgtsv_strided_batch_buffer_size"),
+                         m,
+                         (const void*&)dl,
+                         (const void*&)d,
+                         (const void*&)du,
+                         (const void*&)x,
+                         batch_count,
+                         batch_stride,
+                         (const void*&)buffer_size);
+
+    ROCSPARSE_CHECKARG_HANDLE(0, handle);
+    ROCSPARSE_CHECKARG_SIZE(1, m);
+    ROCSPARSE_CHECKARG(1, m, (m <= 1), rocsparse_status_invalid_size);
+    ROCSPARSE_CHECKARG(7, batch_stride, (batch_stride < m), rocsparse_status_invalid_size);
+    ROCSPARSE_CHECKARG_SIZE(6, batch_count);
+
+    ROCSPARSE_CHECKARG_ARRAY(2, batch_count, dl);
+    ROCSPARSE_CHECKARG_ARRAY(3, batch_count, d);
+    ROCSPARSE_CHECKARG_ARRAY(4, batch_count, du);
+    ROCSPARSE_CHECKARG_ARRAY(5, batch_count, x);
+    ROCSPARSE_CHECKARG_POINTER(8, buffer_size);
+
+    // Quick return if possible
+    if(batch_count == 0)
+    {
+        *buffer_size = 0;
+        return rocsparse_status_success;
+    }
+
+    // Buffer of the cyclic reduction solver for the diagonally dominant systems
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::gtsv_no_pivot_strided_batch_buffer_size_core(
+        handle, m, dl, d, du, x, batch_count, batch_stride, buffer_size));
+
+    *buffer_size += ((sizeof(rocsparse_int) * batch_count - 1) / 256 + 1) * 256; // pivot
+    *buffer_size += ((sizeof(T) * m * batch_count - 1) / 256 + 1) * 256; // u0
+    *buffer_size += ((sizeof(T) * m * batch_count - 1) / 256 + 1) * 256; // u1
+    *buffer_size += ((sizeof(T) * m * batch_count - 1) / 256 + 1) * 256; // u2
+    *buffer_size += ((sizeof(T) * m * batch_count - 1) / 256 + 1) * 256; // y
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse::gtsv_strided_batch_template(rocsparse_handle handle,
+                                                        rocsparse_int    m,
+                                                        const T*         dl,
+                                                        const T*         d,
+                                                        const T*         du,
+                                                        T*               x,
+                                                        rocsparse_int    batch_count,
+                                                        rocsparse_int    batch_stride,
+                                                        void*            temp_buffer)
+{
+    rocsparse::log_trace(handle,
+                         rocsparse::replaceX<T>("rocsparse_Xgtsv_strided_batch"),
+                         m,
+                         (const void*&)dl,
+                         (const void*&)d,
+                         (const void*&)du,
+                         (const void*&)x,
+                         batch_count,
+                         batch_stride,
+                         (const void*&)temp_buffer);
+
+    ROCSPARSE_CHECKARG_HANDLE(0, handle);
+    ROCSPARSE_CHECKARG_SIZE(1, m);
+    ROCSPARSE_CHECKARG(1, m, (m <= 1), rocsparse_status_invalid_size);
+    ROCSPARSE_CHECKARG(7, batch_stride, (batch_stride < m), rocsparse_status_invalid_size);
+    ROCSPARSE_CHECKARG_SIZE(6, batch_count);
+
+    ROCSPARSE_CHECKARG_ARRAY(2, batch_count, dl);
+    ROCSPARSE_CHECKARG_ARRAY(3, batch_count, d);
+    ROCSPARSE_CHECKARG_ARRAY(4, batch_count, du);
+    ROCSPARSE_CHECKARG_ARRAY(5, batch_count, x);
+    ROCSPARSE_CHECKARG_ARRAY(8, batch_count, temp_buffer);
+
+    if(batch_count == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    size_t nopivot_size;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::gtsv_no_pivot_strided_batch_buffer_size_core(
+        handle, m, dl, d, du, x, batch_count, batch_stride, &nopivot_size));
+
+    char* ptr            = reinterpret_cast<char*>(temp_buffer);
+    void* nopivot_buffer = (nopivot_size > 0) ? ptr : nullptr;
+    ptr += nopivot_size;
+    rocsparse_int* pivot = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += ((sizeof(rocsparse_int) * batch_count - 1) / 256 + 1) * 256;
+    T* u0 = reinterpret_cast<T*>(ptr);
+    ptr += ((sizeof(T) * m * batch_count - 1) / 256 + 1) * 256;
+    T* u1 = reinterpret_cast<T*>(ptr);
+    ptr += ((sizeof(T) * m * batch_count - 1) / 256 + 1) * 256;
+    T* u2 = reinterpret_cast<T*>(ptr);
+    ptr += ((sizeof(T) * m * batch_count - 1) / 256 + 1) * 256;
+    T* y = reinterpret_cast<T*>(ptr);
+    // ptr += ((sizeof(T) * m * batch_count - 1) / 256 + 1) * 256;
+
+    // Stage1: Flag all systems that are not diagonally dominant and therefore require pivoting.
+    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::gtsv_strided_batch_detect_kernel<256>),
+                                       dim3(batch_count),
+                                       dim3(256),
+                                       0,
+                                       handle->stream,
+                                       m,
+                                       batch_count,
+                                       batch_stride,
+                                       dl,
+                                       d,
+                                       du,
+                                       pivot);
+
+    // Stage2: Solve the flagged systems using LU factorization with partial pivoting. The
+    // solution is kept in the work array, as the right-hand side is still required by stage3.
+    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::gtsv_strided_batch_lu_kernel<256>),
+                                       dim3((batch_count - 1) / 256 + 1),
+                                       dim3(256),
+                                       0,
+                                       handle->stream,
+                                       m,
+                                       batch_count,
+                                       batch_stride,
+                                       dl,
+                                       d,
+                                       du,
+                                       x,
+                                       pivot,
+                                       u0,
+                                       u1,
+                                       u2,
+                                       y);
+
+    // Stage3: Solve all systems using hybrid cyclic reduction / parallel cyclic reduction.
+    // The flags are not available on the host, thus the flagged systems are solved as well
+    // and overwritten in stage4. This keeps the routine free of any host synchronization.
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::gtsv_no_pivot_strided_batch_core(
+        handle, m, dl, d, du, x, batch_count, batch_stride, nopivot_buffer));
+
+    // Stage4: Copy the pivoted solutions back into the strided layout.
+    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::gtsv_strided_batch_scatter_kernel<256>),
+                                       dim3((m - 1) / 256 + 1, batch_count),
+                                       dim3(256),
+                                       0,
+                                       handle->stream,
+                                       m,
+                                       batch_count,
+                                       batch_stride,
+                                       pivot,
+                                       y,
+                                       x);
+
+    return rocsparse_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+#define C_IMPL(NAME, TYPE)                                                            \
+    extern "C" rocsparse_status NAME(rocsparse_handle handle,                         \
+                                     rocsparse_int    m,                              \
+                                     const TYPE*      dl,                             \
+                                     const TYPE*      d,                              \
+                                     const TYPE*      du,                             \
+                                     const TYPE*      x,                              \
+                                     rocsparse_int    batch_count,                    \
+                                     rocsparse_int    batch_stride,                   \
+                                     size_t*          buffer_size)                    \
+    try                                                                               \
+    {                                                                                 \
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::gtsv_strided_batch_buffer_size_template( \
+            handle, m, dl, d, du, x, batch_count, batch_stride, buffer_size));        \
+        return rocsparse_status_success;                                              \
+    }                                                                                 \
+    catch(...)                                                                        \
+    {                                                                                 \
+        RETURN_ROCSPARSE_EXCEPTION();                                                 \
+    }
+
+C_IMPL(rocsparse_sgtsv_strided_batch_buffer_size, float);
+C_IMPL(rocsparse_dgtsv_strided_batch_buffer_size, double);
+C_IMPL(rocsparse_cgtsv_strided_batch_buffer_size, rocsparse_float_complex);
+C_IMPL(rocsparse_zgtsv_strided_batch_buffer_size, rocsparse_double_complex);
+
+#undef C_IMPL
+
+#define C_IMPL(NAME, TYPE)                                                     \
+    extern "C" rocsparse_status NAME(rocsparse_handle handle,                  \
+                                     rocsparse_int    m,                       \
+                                     const TYPE*      dl,                      \
+                                     const TYPE*      d,                       \
+                                     const TYPE*      du,                      \
+                                     TYPE*            x,                       \
+                                     rocsparse_int    batch_count,             \
+                                     rocsparse_int    batch_stride,            \
+                                     void*            temp_buffer)             \
+    try                                                                        \
+    {                                                                          \
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::gtsv_strided_batch_template(      \
+            handle, m, dl, d, du, x, batch_count, batch_stride, temp_buffer)); \
+        return rocsparse_status_success;                                       \
+    }                                                                          \
+    catch(...)                                                                 \
+    {                                                                          \
+        RETURN_ROCSPARSE_EXCEPTION();                                          \
+    }
+
+C_IMPL(rocsparse_sgtsv_strided_batch, float);
+C_IMPL(rocsparse_dgtsv_strided_batch, double);
+C_IMPL(rocsparse_cgtsv_strided_batch, rocsparse_float_complex);
+C_IMPL(rocsparse_zgtsv_strided_batch, rocsparse_double_complex);
+
+#undef C_IMPL
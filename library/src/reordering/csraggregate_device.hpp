@@ -0,0 +1,204 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#include "common.h"
+#include "csrcolor_device.hpp"
+
+namespace rocsparse
+{
+    // Each vertex is represented by a 64 bit tuple, where the two most significant bits hold
+    // the state of the vertex, the following 30 bits a random priority and the lower 32 bits
+    // the vertex index. Comparing tuples thus compares state first, then priority and breaks
+    // ties by index.
+    static constexpr uint64_t csraggregate_state_out        = 0;
+    static constexpr uint64_t csraggregate_state_undecided  = 1;
+    static constexpr uint64_t csraggregate_state_aggregated = 2;
+
+    ROCSPARSE_DEVICE_ILF uint64_t csraggregate_state(uint64_t tuple)
+    {
+        return tuple >> 62;
+    }
+
+    ROCSPARSE_DEVICE_ILF uint32_t csraggregate_index(uint64_t tuple)
+    {
+        return static_cast<uint32_t>(tuple & 0xffffffff);
+    }
+
+    // Initialize all vertices as undecided, or assign a new random priority to all vertices
+    // that are still undecided
+    template <unsigned int BLOCKSIZE, typename J>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void csraggregate_kernel_priority(J        m,
+                                      uint32_t iter,
+                                      bool     init,
+                                      uint64_t* __restrict__ tuples)
+    {
+        const J gid = BLOCKSIZE * hipBlockIdx_x + hipThreadIdx_x;
+
+        if(gid >= m)
+        {
+            return;
+        }
+
+        if(init == false && csraggregate_state(tuples[gid]) != csraggregate_state_undecided)
+        {
+            return;
+        }
+
+        const uint64_t hash
+            = rocsparse::murmur3_32(static_cast<uint32_t>(gid) ^ (iter * 0x9e3779b9)) & 0x3fffffff;
+
+        tuples[gid]
+            = (csraggregate_state_undecided << 62) | (hash << 32) | static_cast<uint64_t>(gid);
+    }
+
+    // Compute the maximum tuple of each vertex and its direct neighbours
+    template <unsigned int BLOCKSIZE, typename I, typename J>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void csraggregate_kernel_max(J m,
+                                 const I* __restrict__ csr_row_ptr,
+                                 const J* __restrict__ csr_col_ind,
+                                 rocsparse_index_base csr_base,
+                                 const uint64_t* __restrict__ in,
+                                 uint64_t* __restrict__ out)
+    {
+        const J row = BLOCKSIZE * hipBlockIdx_x + hipThreadIdx_x;
+
+        if(row >= m)
+        {
+            return;
+        }
+
+        uint64_t mx = in[row];
+
+        const I row_begin = csr_row_ptr[row] - csr_base;
+        const I row_end   = csr_row_ptr[row + 1] - csr_base;
+
+        for(I j = row_begin; j < row_end; ++j)
+        {
+            const J col = csr_col_ind[j] - csr_base;
+            mx          = max(mx, in[col]);
+        }
+
+        out[row] = mx;
+    }
+
+    // An undecided vertex that holds the maximum tuple within its distance-2 neighbourhood
+    // becomes the root of a new aggregate. An undecided vertex that has a root within its
+    // distance-2 neighbourhood is removed from the independent set. The number of vertices
+    // that are still undecided is accumulated in undecided.
+    template <unsigned int BLOCKSIZE, typename J>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void csraggregate_kernel_select(J m,
+                                    const uint64_t* __restrict__ max_dist2,
+                                    uint64_t* __restrict__ tuples,
+                                    J* __restrict__ undecided)
+    {
+        const J gid = BLOCKSIZE * hipBlockIdx_x + hipThreadIdx_x;
+
+        __shared__ J sdata[BLOCKSIZE];
+
+        J count = 0;
+
+        if(gid < m)
+        {
+            const uint64_t tuple = tuples[gid];
+
+            if(csraggregate_state(tuple) == csraggregate_state_undecided)
+            {
+                const uint64_t mx = max_dist2[gid];
+
+                if(mx == tuple)
+                {
+                    tuples[gid]
+                        = (csraggregate_state_aggregated << 62) | (tuple & 0x3fffffffffffffff);
+                }
+                else if(csraggregate_state(mx) == csraggregate_state_aggregated)
+                {
+                    tuples[gid] = (csraggregate_state_out << 62) | static_cast<uint64_t>(gid);
+                }
+                else
+                {
+                    count = 1;
+                }
+            }
+        }
+
+        sdata[hipThreadIdx_x] = count;
+
+        __syncthreads();
+        rocsparse::blockreduce_sum<BLOCKSIZE>(hipThreadIdx_x, sdata);
+
+        if(hipThreadIdx_x == 0 && sdata[0] > 0)
+        {
+            rocsparse::atomic_add(undecided, sdata[0]);
+        }
+    }
+
+    // Flag all aggregate roots, the flags are stored at offset one for the subsequent scan
+    template <unsigned int BLOCKSIZE, typename J>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void csraggregate_kernel_flag_roots(J m,
+                                        const uint64_t* __restrict__ tuples,
+                                        J* __restrict__ root_ids)
+    {
+        const J gid = BLOCKSIZE * hipBlockIdx_x + hipThreadIdx_x;
+
+        if(gid >= m)
+        {
+            return;
+        }
+
+        root_ids[gid + 1]
+            = (csraggregate_state(tuples[gid]) == csraggregate_state_aggregated) ? 1 : 0;
+    }
+
+    // Each vertex joins the aggregate of the closest root. Vertices at distance one join the
+    // root with the largest tuple in their direct neighbourhood, vertices at distance two join
+    // through their neighbour with the largest tuple.
+    template <unsigned int BLOCKSIZE, typename J>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void csraggregate_kernel_assign(J m,
+                                    const uint64_t* __restrict__ max_dist1,
+                                    const uint64_t* __restrict__ max_dist2,
+                                    const J* __restrict__ root_ids,
+                                    J* __restrict__ aggregates)
+    {
+        const J gid = BLOCKSIZE * hipBlockIdx_x + hipThreadIdx_x;
+
+        if(gid >= m)
+        {
+            return;
+        }
+
+        const uint64_t mx1 = max_dist1[gid];
+
+        const uint32_t root = (csraggregate_state(mx1) == csraggregate_state_aggregated)
+                                  ? csraggregate_index(mx1)
+                                  : csraggregate_index(max_dist2[gid]);
+
+        aggregates[gid] = root_ids[root];
+    }
+}
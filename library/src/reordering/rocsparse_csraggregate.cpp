@@ -0,0 +1,371 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "internal/reordering/rocsparse_csraggregate.h"
+#include "control.h"
+#include "csraggregate_device.hpp"
+#include "rocsparse_csraggregate.hpp"
+#include "utility.h"
+#include <rocprim/rocprim.hpp>
+
+template <typename I, typename J>
+rocsparse_status rocsparse::csraggregate_core(rocsparse_handle          handle,
+                                              J                         m,
+                                              I                         nnz,
+                                              const rocsparse_mat_descr descr,
+                                              const I*                  csr_row_ptr,
+                                              const J*                  csr_col_ind,
+                                              J*                        naggregates,
+                                              J*                        aggregates)
+{
+    static constexpr unsigned int blocksize = 256;
+
+    // The number of undecided vertices and of aggregates is read back on the host
+    RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
+    hipStream_t stream = handle->stream;
+
+    //
+    // Create workspace.
+    //
+    uint64_t* tuples    = nullptr;
+    uint64_t* max_dist1 = nullptr;
+    uint64_t* max_dist2 = nullptr;
+    J*        root_ids  = nullptr;
+    J*        undecided = nullptr;
+
+    RETURN_IF_HIP_ERROR(rocsparse_hipMallocAsync((void**)&tuples, sizeof(uint64_t) * m, stream));
+    RETURN_IF_HIP_ERROR(
+        rocsparse_hipMallocAsync((void**)&max_dist1, sizeof(uint64_t) * m, stream));
+    RETURN_IF_HIP_ERROR(
+        rocsparse_hipMallocAsync((void**)&max_dist2, sizeof(uint64_t) * m, stream));
+    RETURN_IF_HIP_ERROR(rocsparse_hipMallocAsync((void**)&root_ids, sizeof(J) * (m + 1), stream));
+    RETURN_IF_HIP_ERROR(rocsparse_hipMallocAsync((void**)&undecided, sizeof(J), stream));
+
+    const dim3 blocks((m - 1) / blocksize + 1);
+    const dim3 threads(blocksize);
+
+    //
+    // Initialize all vertices as undecided.
+    //
+    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::csraggregate_kernel_priority<blocksize>),
+                                       blocks,
+                                       threads,
+                                       0,
+                                       stream,
+                                       m,
+                                       0,
+                                       true,
+                                       tuples);
+
+    //
+    // Iterate until all vertices have been either selected as root or removed.
+    //
+    J        num_undecided = m;
+    uint32_t iter          = 0;
+
+    while(num_undecided > 0)
+    {
+        //
+        // Maximum tuple within distance one and two of each vertex.
+        //
+        RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::csraggregate_kernel_max<blocksize>),
+                                           blocks,
+                                           threads,
+                                           0,
+                                           stream,
+                                           m,
+                                           csr_row_ptr,
+                                           csr_col_ind,
+                                           descr->base,
+                                           tuples,
+                                           max_dist1);
+
+        RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::csraggregate_kernel_max<blocksize>),
+                                           blocks,
+                                           threads,
+                                           0,
+                                           stream,
+                                           m,
+                                           csr_row_ptr,
+                                           csr_col_ind,
+                                           descr->base,
+                                           max_dist1,
+                                           max_dist2);
+
+        //
+        // Select new roots and remove their distance-2 neighbourhood.
+        //
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(undecided, 0, sizeof(J), stream));
+        RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::csraggregate_kernel_select<blocksize>),
+                                           blocks,
+                                           threads,
+                                           0,
+                                           stream,
+                                           m,
+                                           max_dist2,
+                                           tuples,
+                                           undecided);
+
+        //
+        // Copy number of undecided vertices for current iteration to host.
+        //
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(&num_undecided, undecided, sizeof(J), hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        //
+        // Re-randomize priorities of the remaining vertices.
+        //
+        if(num_undecided > 0)
+        {
+            RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::csraggregate_kernel_priority<blocksize>),
+                                               blocks,
+                                               threads,
+                                               0,
+                                               stream,
+                                               m,
+                                               ++iter,
+                                               false,
+                                               tuples);
+        }
+    }
+
+    //
+    // Enumerate the aggregate roots.
+    //
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(root_ids, 0, sizeof(J), stream));
+    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::csraggregate_kernel_flag_roots<blocksize>),
+                                       blocks,
+                                       threads,
+                                       0,
+                                       stream,
+                                       m,
+                                       tuples,
+                                       root_ids);
+
+    size_t temp_storage_bytes = 0;
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        nullptr, temp_storage_bytes, root_ids, root_ids, m + 1, rocprim::plus<J>(), stream));
+
+    bool  d_temp_alloc;
+    void* d_temp_storage = nullptr;
+
+    //
+    // Device buffer should be sufficient for rocprim in most cases
+    //
+    if(handle->buffer_size >= temp_storage_bytes)
+    {
+        d_temp_storage = handle->buffer;
+        d_temp_alloc   = false;
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(rocsparse_hipMallocAsync(&d_temp_storage, temp_storage_bytes, stream));
+        d_temp_alloc = true;
+    }
+
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(d_temp_storage,
+                                                temp_storage_bytes,
+                                                root_ids,
+                                                root_ids,
+                                                m + 1,
+                                                rocprim::plus<J>(),
+                                                stream));
+
+    if(d_temp_alloc == true)
+    {
+        RETURN_IF_HIP_ERROR(rocsparse_hipFreeAsync(d_temp_storage, stream));
+    }
+
+    //
+    // Assign each vertex to the aggregate of its closest root.
+    //
+    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::csraggregate_kernel_max<blocksize>),
+                                       blocks,
+                                       threads,
+                                       0,
+                                       stream,
+                                       m,
+                                       csr_row_ptr,
+                                       csr_col_ind,
+                                       descr->base,
+                                       tuples,
+                                       max_dist1);
+
+    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::csraggregate_kernel_max<blocksize>),
+                                       blocks,
+                                       threads,
+                                       0,
+                                       stream,
+                                       m,
+                                       csr_row_ptr,
+                                       csr_col_ind,
+                                       descr->base,
+                                       max_dist1,
+                                       max_dist2);
+
+    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::csraggregate_kernel_assign<blocksize>),
+                                       blocks,
+                                       threads,
+                                       0,
+                                       stream,
+                                       m,
+                                       max_dist1,
+                                       max_dist2,
+                                       root_ids,
+                                       aggregates);
+
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(naggregates, root_ids + m, sizeof(J), hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    //
+    // Free workspace.
+    //
+    RETURN_IF_HIP_ERROR(rocsparse_hipFreeAsync(tuples, stream));
+    RETURN_IF_HIP_ERROR(rocsparse_hipFreeAsync(max_dist1, stream));
+    RETURN_IF_HIP_ERROR(rocsparse_hipFreeAsync(max_dist2, stream));
+    RETURN_IF_HIP_ERROR(rocsparse_hipFreeAsync(root_ids, stream));
+    RETURN_IF_HIP_ERROR(rocsparse_hipFreeAsync(undecided, stream));
+
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse::csraggregate_quickreturn(rocsparse_handle          handle,
+                                                     int64_t                   m,
+                                                     int64_t                   nnz,
+                                                     const rocsparse_mat_descr descr,
+                                                     const void*               csr_row_ptr,
+                                                     const void*               csr_col_ind,
+                                                     void*                     naggregates,
+                                                     void*                     aggregates)
+{
+    if(m == 0)
+    {
+        if(naggregates != nullptr)
+        {
+            *static_cast<rocsparse_int*>(naggregates) = 0;
+        }
+        return rocsparse_status_success;
+    }
+    return rocsparse_status_continue;
+}
+
+namespace rocsparse
+{
+    static rocsparse_status csraggregate_checkarg(rocsparse_handle          handle, //0
+                                                  int64_t                   m, //1
+                                                  int64_t                   nnz, //2
+                                                  const rocsparse_mat_descr descr, //3
+                                                  const void*               csr_row_ptr, //4
+                                                  const void*               csr_col_ind, //5
+                                                  void*                     naggregates, //6
+                                                  void*                     aggregates) //7
+    {
+        ROCSPARSE_CHECKARG_HANDLE(0, handle);
+        ROCSPARSE_CHECKARG_SIZE(1, m);
+        ROCSPARSE_CHECKARG_SIZE(2, nnz);
+        ROCSPARSE_CHECKARG_POINTER(6, naggregates);
+
+        const rocsparse_status status = rocsparse::csraggregate_quickreturn(
+            handle, m, nnz, descr, csr_row_ptr, csr_col_ind, naggregates, aggregates);
+        if(status != rocsparse_status_continue)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(status);
+            return rocsparse_status_success;
+        }
+
+        ROCSPARSE_CHECKARG_POINTER(3, descr);
+        ROCSPARSE_CHECKARG(3,
+                           descr,
+                           (descr->type != rocsparse_matrix_type_general),
+                           rocsparse_status_not_implemented);
+        ROCSPARSE_CHECKARG_ARRAY(4, m, csr_row_ptr);
+        ROCSPARSE_CHECKARG_ARRAY(5, nnz, csr_col_ind);
+        ROCSPARSE_CHECKARG_ARRAY(7, m, aggregates);
+        return rocsparse_status_continue;
+    }
+
+    template <typename I, typename J>
+    static rocsparse_status csraggregate_impl(rocsparse_handle          handle,
+                                              J                         m,
+                                              I                         nnz,
+                                              const rocsparse_mat_descr descr,
+                                              const I*                  csr_row_ptr,
+                                              const J*                  csr_col_ind,
+                                              J*                        naggregates,
+                                              J*                        aggregates)
+    {
+        // Logging
+        rocsparse::log_trace(handle,
+                             "rocsparse_csraggregate",
+                             m,
+                             nnz,
+                             (const void*&)descr,
+                             (const void*&)csr_row_ptr,
+                             (const void*&)csr_col_ind,
+                             (const void*&)naggregates,
+                             (const void*&)aggregates);
+
+        //
+        // Check arguments.
+        //
+        const rocsparse_status status = rocsparse::csraggregate_checkarg(
+            handle, m, nnz, descr, csr_row_ptr, csr_col_ind, naggregates, aggregates);
+        if(status != rocsparse_status_continue)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(status);
+            return rocsparse_status_success;
+        }
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::csraggregate_core(
+            handle, m, nnz, descr, csr_row_ptr, csr_col_ind, naggregates, aggregates));
+        return rocsparse_status_success;
+    }
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+extern "C" rocsparse_status rocsparse_csraggregate(rocsparse_handle          handle,
+                                                   rocsparse_int             m,
+                                                   rocsparse_int             nnz,
+                                                   const rocsparse_mat_descr descr,
+                                                   const rocsparse_int*      csr_row_ptr,
+                                                   const rocsparse_int*      csr_col_ind,
+                                                   rocsparse_int*            naggregates,
+                                                   rocsparse_int*            aggregates)
+try
+{
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::csraggregate_impl(
+        handle, m, nnz, descr, csr_row_ptr, csr_col_ind, naggregates, aggregates));
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
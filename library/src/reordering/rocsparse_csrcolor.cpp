@@ -338,6 +338,9 @@ rocsparse_status rocsparse::csrcolor_core(rocsparse_handle          handle,
 {
     static constexpr rocsparse_int blocksize = 256;
 
+    // The number of uncolored vertices and of colors is read back on the host
+    RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
     hipStream_t stream = handle->stream;
     *ncolors           = -2;
 
@@ -4491,6 +4491,152 @@ module rocsparse
             type(c_ptr), value :: temp_buffer
         end function rocsparse_zgtsv_no_pivot_strided_batch
 
+!       rocsparse_gtsv_strided_batch_buffer_size
+        function rocsparse_sgtsv_strided_batch_buffer_size(handle, m, dl, d, du, &
+                x, batch_count, batch_stride, buffer_size) &
+                bind(c, name = 'rocsparse_sgtsv_strided_batch_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sgtsv_strided_batch_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_sgtsv_strided_batch_buffer_size
+
+        function rocsparse_dgtsv_strided_batch_buffer_size(handle, m, dl, d, du, &
+                x, batch_count, batch_stride, buffer_size) &
+                bind(c, name = 'rocsparse_dgtsv_strided_batch_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dgtsv_strided_batch_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dgtsv_strided_batch_buffer_size
+
+        function rocsparse_cgtsv_strided_batch_buffer_size(handle, m, dl, d, du, &
+                x, batch_count, batch_stride, buffer_size) &
+                bind(c, name = 'rocsparse_cgtsv_strided_batch_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_cgtsv_strided_batch_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_cgtsv_strided_batch_buffer_size
+
+        function rocsparse_zgtsv_strided_batch_buffer_size(handle, m, dl, d, du, &
+                x, batch_count, batch_stride, buffer_size) &
+                bind(c, name = 'rocsparse_zgtsv_strided_batch_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zgtsv_strided_batch_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zgtsv_strided_batch_buffer_size
+
+!       rocsparse_gtsv_strided_batch
+        function rocsparse_sgtsv_strided_batch(handle, m, dl, d, du, &
+                x, batch_count, batch_stride, temp_buffer) &
+                bind(c, name = 'rocsparse_sgtsv_strided_batch')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sgtsv_strided_batch
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_sgtsv_strided_batch
+
+        function rocsparse_dgtsv_strided_batch(handle, m, dl, d, du, &
+                x, batch_count, batch_stride, temp_buffer) &
+                bind(c, name = 'rocsparse_dgtsv_strided_batch')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dgtsv_strided_batch
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dgtsv_strided_batch
+
+        function rocsparse_cgtsv_strided_batch(handle, m, dl, d, du, &
+                x, batch_count, batch_stride, temp_buffer) &
+                bind(c, name = 'rocsparse_cgtsv_strided_batch')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_cgtsv_strided_batch
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_cgtsv_strided_batch
+
+        function rocsparse_zgtsv_strided_batch(handle, m, dl, d, du, &
+                x, batch_count, batch_stride, temp_buffer) &
+                bind(c, name = 'rocsparse_zgtsv_strided_batch')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zgtsv_strided_batch
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zgtsv_strided_batch
+
 ! ===========================================================================
 !   conversion SPARSE
 ! ===========================================================================
@@ -0,0 +1,353 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "analysis_cache.h"
+#include "common.h"
+#include "control.h"
+#include "utility.h"
+
+namespace rocsparse
+{
+    // Finalizer of splitmix64
+    ROCSPARSE_DEVICE_ILF unsigned long long analysis_mix(unsigned long long x)
+    {
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+        return x ^ (x >> 31);
+    }
+
+    template <unsigned int BLOCKSIZE, typename I, typename J>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void analysis_fingerprint_kernel(J m,
+                                     I nnz,
+                                     const I* __restrict__ csr_row_ptr,
+                                     const J* __restrict__ csr_col_ind,
+                                     unsigned long long* __restrict__ hash)
+    {
+        const int tid = hipThreadIdx_x;
+
+        __shared__ unsigned long long sdata0[BLOCKSIZE];
+        __shared__ unsigned long long sdata1[BLOCKSIZE];
+
+        // Row pointers and column indices are hashed as one array of size m + 1 + nnz
+        const int64_t size   = static_cast<int64_t>(m) + 1 + nnz;
+        const int64_t stride = static_cast<int64_t>(hipGridDim_x) * BLOCKSIZE;
+
+        unsigned long long h0 = 0;
+        unsigned long long h1 = 0;
+
+        for(int64_t idx = static_cast<int64_t>(hipBlockIdx_x) * BLOCKSIZE + tid; idx < size;
+            idx += stride)
+        {
+            const unsigned long long val
+                = (idx <= m) ? static_cast<unsigned long long>(csr_row_ptr[idx])
+                             : static_cast<unsigned long long>(csr_col_ind[idx - m - 1]);
+            const unsigned long long pos = static_cast<unsigned long long>(idx);
+
+            // Mixing the position makes the sums sensitive to the order of the entries
+            h0 += analysis_mix(analysis_mix(pos ^ 0x9e3779b97f4a7c15ULL) ^ val);
+            h1 += analysis_mix(analysis_mix(pos + 0x632be59bd9b4e019ULL)
+                               + val * 0xff51afd7ed558ccdULL);
+        }
+
+        sdata0[tid] = h0;
+        sdata1[tid] = h1;
+        __syncthreads();
+
+        rocsparse::blockreduce_sum<BLOCKSIZE>(tid, sdata0);
+        rocsparse::blockreduce_sum<BLOCKSIZE>(tid, sdata1);
+
+        if(tid == 0)
+        {
+            rocsparse::atomic_add(&hash[0], sdata0[0]);
+            rocsparse::atomic_add(&hash[1], sdata1[0]);
+        }
+    }
+
+    static size_t csrmv_info_bytes(const rocsparse_csrmv_info info)
+    {
+        const size_t I_size = rocsparse::indextype_sizeof(info->index_type_I);
+        const size_t J_size = rocsparse::indextype_sizeof(info->index_type_J);
+
+        size_t bytes = sizeof(_rocsparse_csrmv_info);
+
+        bytes += (info->adaptive.row_blocks != nullptr) ? I_size * info->adaptive.size : 0;
+        bytes += (info->adaptive.wg_flags != nullptr) ? sizeof(unsigned int) * info->adaptive.size
+                                                      : 0;
+        bytes += (info->adaptive.wg_ids != nullptr) ? J_size * info->adaptive.size : 0;
+
+        bytes += (info->lrb.wg_flags != nullptr) ? sizeof(unsigned int) * info->lrb.size : 0;
+        bytes += (info->lrb.rows_offsets_scratch != nullptr) ? J_size * info->m : 0;
+        bytes += (info->lrb.rows_bins != nullptr) ? J_size * info->m : 0;
+        bytes += (info->lrb.n_rows_bins != nullptr) ? J_size * 32 : 0;
+
+        bytes += (info->csrmvt_perm != nullptr) ? I_size * info->nnz : 0;
+        bytes += (info->csrmvt_row_ptr != nullptr) ? I_size * (info->n + 1) : 0;
+        bytes += (info->csrmvt_col_ind != nullptr) ? J_size * info->nnz : 0;
+
+        return bytes;
+    }
+
+    static size_t trm_info_bytes(const rocsparse_trm_info info)
+    {
+        const size_t I_size = rocsparse::indextype_sizeof(info->index_type_I);
+        const size_t J_size = rocsparse::indextype_sizeof(info->index_type_J);
+
+        size_t bytes = sizeof(_rocsparse_trm_info);
+
+        bytes += (info->row_map != nullptr) ? J_size * info->m : 0;
+        bytes += (info->trm_diag_ind != nullptr) ? I_size * info->m : 0;
+        bytes += (info->trmt_perm != nullptr) ? I_size * info->nnz : 0;
+        bytes += (info->trmt_row_ptr != nullptr) ? I_size * (info->m + 1) : 0;
+        bytes += (info->trmt_col_ind != nullptr) ? J_size * info->nnz : 0;
+
+        return bytes;
+    }
+}
+
+bool rocsparse::analysis_key::operator==(const analysis_key& that) const
+{
+    return kind == that.kind && alg == that.alg && trans == that.trans && m == that.m
+           && n == that.n && nnz == that.nnz && type == that.type && fill_mode == that.fill_mode
+           && diag_type == that.diag_type && base == that.base
+           && index_type_I == that.index_type_I && index_type_J == that.index_type_J
+           && hash[0] == that.hash[0] && hash[1] == that.hash[1];
+}
+
+rocsparse::analysis_cache::analysis_cache(size_t budget_)
+    : budget(budget_)
+{
+}
+
+rocsparse::analysis_cache::~analysis_cache()
+{
+    const rocsparse_status status = this->clear();
+    if(status != rocsparse_status_success)
+    {
+        ROCSPARSE_ERROR_MESSAGE(status, "analysis cache error");
+    }
+}
+
+size_t rocsparse::analysis_cache::get_budget() const
+{
+    return this->budget;
+}
+
+size_t rocsparse::analysis_cache::get_used() const
+{
+    return this->used;
+}
+
+rocsparse_status rocsparse::analysis_cache::set_budget(size_t budget_)
+{
+    this->budget = budget_;
+    RETURN_IF_ROCSPARSE_ERROR(this->evict(0));
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse::analysis_cache::clear()
+{
+    while(!this->entries.empty())
+    {
+        RETURN_IF_ROCSPARSE_ERROR(this->release(this->entries.back()));
+        this->entries.pop_back();
+    }
+    return rocsparse_status_success;
+}
+
+std::list<rocsparse::analysis_cache::entry>::iterator
+    rocsparse::analysis_cache::find(const analysis_key& key)
+{
+    for(auto it = this->entries.begin(); it != this->entries.end(); ++it)
+    {
+        if(it->key == key)
+        {
+            // Most recently used entries are kept at the front
+            this->entries.splice(this->entries.begin(), this->entries, it);
+            return this->entries.begin();
+        }
+    }
+    return this->entries.end();
+}
+
+rocsparse_status rocsparse::analysis_cache::evict(size_t bytes)
+{
+    // Drop least recently used entries until bytes more fit into the budget
+    while(!this->entries.empty() && this->used + bytes > this->budget)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(this->release(this->entries.back()));
+        this->entries.pop_back();
+    }
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse::analysis_cache::release(entry& e)
+{
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::destroy_csrmv_info(e.csrmv_info));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::destroy_trm_info(e.trm_info));
+    e.csrmv_info = nullptr;
+    e.trm_info   = nullptr;
+    this->used -= e.bytes;
+    return rocsparse_status_success;
+}
+
+rocsparse_csrmv_info rocsparse::analysis_cache::find_csrmv(const analysis_key& key)
+{
+    const auto it = this->find(key);
+    return (it != this->entries.end()) ? it->csrmv_info : nullptr;
+}
+
+rocsparse_trm_info rocsparse::analysis_cache::find_trm(const analysis_key& key,
+                                                       int64_t*            zero_pivot)
+{
+    const auto it = this->find(key);
+    if(it == this->entries.end())
+    {
+        return nullptr;
+    }
+    *zero_pivot = it->zero_pivot;
+    return it->trm_info;
+}
+
+rocsparse_status rocsparse::analysis_cache::insert_csrmv(const analysis_key&        key,
+                                                         const rocsparse_csrmv_info info)
+{
+    const size_t bytes = rocsparse::csrmv_info_bytes(info);
+    if(bytes > this->budget)
+    {
+        return rocsparse_status_success;
+    }
+    RETURN_IF_ROCSPARSE_ERROR(this->evict(bytes));
+
+    entry e;
+    e.key   = key;
+    e.bytes = bytes;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::create_csrmv_info(&e.csrmv_info));
+
+    const rocsparse_status status = rocsparse::copy_csrmv_info(e.csrmv_info, info);
+    if(status != rocsparse_status_success)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::destroy_csrmv_info(e.csrmv_info));
+        RETURN_IF_ROCSPARSE_ERROR(status);
+    }
+
+    // The cached copy must not refer to user data, it is re-attached on every hit
+    e.csrmv_info->descr       = nullptr;
+    e.csrmv_info->csr_row_ptr = nullptr;
+    e.csrmv_info->csr_col_ind = nullptr;
+
+    this->entries.push_front(e);
+    this->used += bytes;
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse::analysis_cache::insert_trm(const analysis_key&      key,
+                                                       const rocsparse_trm_info info,
+                                                       int64_t                  zero_pivot)
+{
+    const size_t bytes = rocsparse::trm_info_bytes(info);
+    if(bytes > this->budget)
+    {
+        return rocsparse_status_success;
+    }
+    RETURN_IF_ROCSPARSE_ERROR(this->evict(bytes));
+
+    entry e;
+    e.key        = key;
+    e.bytes      = bytes;
+    e.zero_pivot = zero_pivot;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::create_trm_info(&e.trm_info));
+
+    const rocsparse_status status = rocsparse::copy_trm_info(e.trm_info, info);
+    if(status != rocsparse_status_success)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::destroy_trm_info(e.trm_info));
+        RETURN_IF_ROCSPARSE_ERROR(status);
+    }
+
+    // The cached copy must not refer to user data, it is re-attached on every hit
+    e.trm_info->descr       = nullptr;
+    e.trm_info->trm_row_ptr = nullptr;
+    e.trm_info->trm_col_ind = nullptr;
+
+    this->entries.push_front(e);
+    this->used += bytes;
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J>
+rocsparse_status rocsparse::analysis_fingerprint(rocsparse_handle    handle,
+                                                 J                   m,
+                                                 I                   nnz,
+                                                 const I*            csr_row_ptr,
+                                                 const J*            csr_col_ind,
+                                                 unsigned long long* hash)
+{
+    // The fingerprint is read back on the host
+    RETURN_IF_CAPTURE_SAFE_MODE(handle);
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // The two sums are accumulated in the handle buffer
+    unsigned long long* d_hash = reinterpret_cast<unsigned long long*>(handle->buffer);
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(d_hash, 0, sizeof(unsigned long long) * 2, stream));
+
+#define FINGERPRINT_DIM 256
+    const int64_t size    = static_cast<int64_t>(m) + 1 + nnz;
+    const int64_t nblocks = std::min((size - 1) / FINGERPRINT_DIM + 1, static_cast<int64_t>(1024));
+
+    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::analysis_fingerprint_kernel<FINGERPRINT_DIM>),
+                                       dim3(nblocks),
+                                       dim3(FINGERPRINT_DIM),
+                                       0,
+                                       stream,
+                                       m,
+                                       nnz,
+                                       csr_row_ptr,
+                                       csr_col_ind,
+                                       d_hash);
+#undef FINGERPRINT_DIM
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        hash, d_hash, sizeof(unsigned long long) * 2, hipMemcpyDeviceToHost, stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    return rocsparse_status_success;
+}
+
+#define INSTANTIATE(ITYPE, JTYPE)                                                              \
+    template rocsparse_status rocsparse::analysis_fingerprint(rocsparse_handle    handle,      \
+                                                              JTYPE               m,           \
+                                                              ITYPE               nnz,         \
+                                                              const ITYPE*        csr_row_ptr, \
+                                                              const JTYPE*        csr_col_ind, \
+                                                              unsigned long long* hash)
+
+INSTANTIATE(int32_t, int32_t);
+INSTANTIATE(int64_t, int32_t);
+INSTANTIATE(int64_t, int64_t);
+#undef INSTANTIATE
@@ -21,6 +21,7 @@
  *
  * ************************************************************************ */
 
+#include "analysis_cache.h"
 #include "control.h"
 #include "handle.h"
 #include "rocsparse.h"
@@ -110,6 +111,8 @@ const char* rocsparse_get_status_name(rocsparse_status status)
         return "rocsparse_status_thrown_exception";
     case rocsparse_status_continue:
         return "rocsparse_status_continue";
+    case rocsparse_status_not_capture_safe:
+        return "rocsparse_status_not_capture_safe";
     }
 
     return "Unrecognized status code";
@@ -152,6 +155,8 @@ const char* rocsparse_get_status_description(rocsparse_status status)
         return "exception being thrown";
     case rocsparse_status_continue:
         return "nothing preventing function to proceed";
+    case rocsparse_status_not_capture_safe:
+        return "function would block the host in capture-safe mode";
     }
 
     return "Unrecognized status code";
@@ -196,6 +201,152 @@ catch(...)
     RETURN_ROCSPARSE_EXCEPTION();
 }
 
+/********************************************************************************
+ * \brief Set capture mode, can be default or safe.
+ *******************************************************************************/
+rocsparse_status rocsparse_set_capture_mode(rocsparse_handle handle, rocsparse_capture_mode mode)
+try
+{
+    ROCSPARSE_CHECKARG_HANDLE(0, handle);
+    ROCSPARSE_CHECKARG_ENUM(1, mode);
+    handle->capture_mode = mode;
+    rocsparse::log_trace(handle, "rocsparse_set_capture_mode", mode);
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
+
+/********************************************************************************
+ * \brief Get capture mode, can be default or safe.
+ *******************************************************************************/
+rocsparse_status rocsparse_get_capture_mode(rocsparse_handle handle, rocsparse_capture_mode* mode)
+try
+{
+    ROCSPARSE_CHECKARG_HANDLE(0, handle);
+    ROCSPARSE_CHECKARG_POINTER(1, mode);
+    *mode = handle->capture_mode;
+    rocsparse::log_trace(handle, "rocsparse_get_capture_mode", *mode);
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
+
+/********************************************************************************
+ * \brief Set data status mode, can be host or device.
+ *******************************************************************************/
+rocsparse_status rocsparse_set_data_status_mode(rocsparse_handle           handle,
+                                                rocsparse_data_status_mode mode)
+try
+{
+    ROCSPARSE_CHECKARG_HANDLE(0, handle);
+    ROCSPARSE_CHECKARG_ENUM(1, mode);
+    handle->data_status_mode = mode;
+    rocsparse::log_trace(handle, "rocsparse_set_data_status_mode", mode);
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
+
+/********************************************************************************
+ * \brief Get data status mode, can be host or device.
+ *******************************************************************************/
+rocsparse_status rocsparse_get_data_status_mode(rocsparse_handle            handle,
+                                                rocsparse_data_status_mode* mode)
+try
+{
+    ROCSPARSE_CHECKARG_HANDLE(0, handle);
+    ROCSPARSE_CHECKARG_POINTER(1, mode);
+    *mode = handle->data_status_mode;
+    rocsparse::log_trace(handle, "rocsparse_get_data_status_mode", *mode);
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
+
+/********************************************************************************
+ * \brief Report kernel launches to callback, or stop reporting them.
+ *******************************************************************************/
+rocsparse_status rocsparse_set_kernel_instrumentation(rocsparse_handle                 handle,
+                                                      rocsparse_instrumentation_mode   mode,
+                                                      rocsparse_kernel_launch_callback callback,
+                                                      void*                            user_data)
+try
+{
+    ROCSPARSE_CHECKARG_HANDLE(0, handle);
+    ROCSPARSE_CHECKARG_ENUM(1, mode);
+    rocsparse::log_trace(handle,
+                         "rocsparse_set_kernel_instrumentation",
+                         mode,
+                         (const void*&)callback,
+                         (const void*&)user_data);
+
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse::instrumentation_enable(handle, mode, callback, user_data));
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
+
+/********************************************************************************
+ * \brief Set the memory budget of the analysis cache, 0 disables the cache.
+ *******************************************************************************/
+rocsparse_status rocsparse_set_analysis_cache(rocsparse_handle handle, size_t budget)
+try
+{
+    ROCSPARSE_CHECKARG_HANDLE(0, handle);
+    rocsparse::log_trace(handle, "rocsparse_set_analysis_cache", budget);
+
+    if(budget == 0)
+    {
+        delete handle->analysis_cache;
+        handle->analysis_cache = nullptr;
+    }
+    else if(handle->analysis_cache == nullptr)
+    {
+        handle->analysis_cache = new rocsparse::analysis_cache(budget);
+    }
+    else
+    {
+        RETURN_IF_ROCSPARSE_ERROR(handle->analysis_cache->set_budget(budget));
+    }
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
+
+/********************************************************************************
+ * \brief Get the memory budget and usage of the analysis cache.
+ *******************************************************************************/
+rocsparse_status
+    rocsparse_get_analysis_cache(rocsparse_handle handle, size_t* budget, size_t* used)
+try
+{
+    ROCSPARSE_CHECKARG_HANDLE(0, handle);
+    ROCSPARSE_CHECKARG_POINTER(1, budget);
+    ROCSPARSE_CHECKARG_POINTER(2, used);
+
+    *budget = (handle->analysis_cache != nullptr) ? handle->analysis_cache->get_budget() : 0;
+    *used   = (handle->analysis_cache != nullptr) ? handle->analysis_cache->get_used() : 0;
+    rocsparse::log_trace(handle, "rocsparse_get_analysis_cache", *budget, *used);
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
+
 /********************************************************************************
  *! \brief Set rocsparse stream used for all subsequent library function calls.
  * If not set, all hip kernels will take the default NULL stream.
@@ -973,6 +1124,26 @@ try
             rocsparse::copy_csritsv_info(dest->csritsv_info, src->csritsv_info));
     }
 
+    if(src->csr2csc_info != nullptr)
+    {
+        if(dest->csr2csc_info == nullptr)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse::create_csr2csc_info(&dest->csr2csc_info));
+        }
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse::copy_csr2csc_info(dest->csr2csc_info, src->csr2csc_info));
+    }
+
+    if(src->gebsr2gebsc_info != nullptr)
+    {
+        if(dest->gebsr2gebsc_info == nullptr)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse::create_csr2csc_info(&dest->gebsr2gebsc_info));
+        }
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse::copy_csr2csc_info(dest->gebsr2gebsc_info, src->gebsr2gebsc_info));
+    }
+
     if(src->zero_pivot != nullptr)
     {
         // zero pivot for csrsv, csrsm, csrilu0, csric0
@@ -1272,6 +1443,18 @@ try
         RETURN_IF_ROCSPARSE_ERROR(rocsparse::destroy_csritsv_info(info->csritsv_info));
     }
 
+    // Clear csr2csc info struct
+    if(info->csr2csc_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::destroy_csr2csc_info(info->csr2csc_info));
+    }
+
+    // Clear gebsr2gebsc info struct
+    if(info->gebsr2gebsc_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::destroy_csr2csc_info(info->gebsr2gebsc_info));
+    }
+
     // Clear zero pivot
     if(info->zero_pivot != nullptr)
     {
@@ -1687,6 +1870,7 @@ try
     (*descr)->batch_stride                = 0;
     (*descr)->offsets_batch_stride        = 0;
     (*descr)->columns_values_batch_stride = 0;
+    (*descr)->columns_batch_stride        = 0;
 
     return rocsparse_status_success;
 }
@@ -1752,6 +1936,7 @@ try
     new_descr->batch_stride                = 0;
     new_descr->offsets_batch_stride        = 0;
     new_descr->columns_values_batch_stride = 0;
+    new_descr->columns_batch_stride        = 0;
 
     *descr = new_descr;
     return rocsparse_status_success;
@@ -1821,6 +2006,7 @@ try
     (*descr)->batch_stride                = 0;
     (*descr)->offsets_batch_stride        = 0;
     (*descr)->columns_values_batch_stride = 0;
+    (*descr)->columns_batch_stride        = 0;
     return rocsparse_status_success;
 }
 catch(...)
@@ -1899,6 +2085,7 @@ try
     (*descr)->batch_stride                = 0;
     (*descr)->offsets_batch_stride        = 0;
     (*descr)->columns_values_batch_stride = 0;
+    (*descr)->columns_batch_stride        = 0;
     return rocsparse_status_success;
 }
 catch(...)
@@ -1972,6 +2159,7 @@ try
     new_descr->batch_stride                = 0;
     new_descr->offsets_batch_stride        = 0;
     new_descr->columns_values_batch_stride = 0;
+    new_descr->columns_batch_stride        = 0;
 
     *descr = new_descr;
     return rocsparse_status_success;
@@ -2045,6 +2233,7 @@ try
     (*descr)->batch_stride                = 0;
     (*descr)->offsets_batch_stride        = 0;
     (*descr)->columns_values_batch_stride = 0;
+    (*descr)->columns_batch_stride        = 0;
     return rocsparse_status_success;
 }
 catch(...)
@@ -2111,6 +2300,7 @@ try
     new_descr->batch_stride                = 0;
     new_descr->offsets_batch_stride        = 0;
     new_descr->columns_values_batch_stride = 0;
+    new_descr->columns_batch_stride        = 0;
 
     *descr = new_descr;
     return rocsparse_status_success;
@@ -2185,6 +2375,7 @@ try
     (*descr)->batch_stride                = 0;
     (*descr)->offsets_batch_stride        = 0;
     (*descr)->columns_values_batch_stride = 0;
+    (*descr)->columns_batch_stride        = 0;
 
     return rocsparse_status_success;
 }
@@ -2262,6 +2453,7 @@ try
     (*descr)->batch_stride                = 0;
     (*descr)->offsets_batch_stride        = 0;
     (*descr)->columns_values_batch_stride = 0;
+    (*descr)->columns_batch_stride        = 0;
     return rocsparse_status_success;
 }
 catch(...)
@@ -2332,6 +2524,7 @@ try
     new_descr->batch_stride                = 0;
     new_descr->offsets_batch_stride        = 0;
     new_descr->columns_values_batch_stride = 0;
+    new_descr->columns_batch_stride        = 0;
 
     *descr = new_descr;
     return rocsparse_status_success;
@@ -2414,6 +2607,7 @@ try
     (*descr)->batch_stride                = 0;
     (*descr)->offsets_batch_stride        = 0;
     (*descr)->columns_values_batch_stride = 0;
+    (*descr)->columns_batch_stride        = 0;
     return rocsparse_status_success;
 }
 catch(...)
@@ -3516,6 +3710,31 @@ try
     descr->batch_count                 = batch_count;
     descr->offsets_batch_stride        = offsets_batch_stride;
     descr->columns_values_batch_stride = columns_values_batch_stride;
+    descr->columns_batch_stride        = columns_values_batch_stride;
+
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
+
+/********************************************************************************
+ * \brief rocsparse_csr_set_columns_batch_stride sets the CSR sparse matrix column
+ * indices batch stride, apart from the values batch stride.
+ *******************************************************************************/
+rocsparse_status rocsparse_csr_set_columns_batch_stride(rocsparse_spmat_descr descr,
+                                                        int64_t               columns_batch_stride)
+try
+{
+    ROCSPARSE_CHECKARG_POINTER(0, descr);
+    ROCSPARSE_CHECKARG(0, descr, (descr->init == false), rocsparse_status_not_initialized);
+    ROCSPARSE_CHECKARG(
+        0, descr, (descr->format != rocsparse_format_csr), rocsparse_status_invalid_value);
+    ROCSPARSE_CHECKARG(
+        1, columns_batch_stride, (columns_batch_stride < 0), rocsparse_status_invalid_value);
+
+    descr->columns_batch_stride = columns_batch_stride;
 
     return rocsparse_status_success;
 }
@@ -3547,6 +3766,7 @@ try
     descr->batch_count                 = batch_count;
     descr->offsets_batch_stride        = offsets_batch_stride;
     descr->columns_values_batch_stride = rows_values_batch_stride;
+    descr->columns_batch_stride        = rows_values_batch_stride;
     return rocsparse_status_success;
 }
 catch(...)
@@ -3703,6 +3923,9 @@ try
     (*descr)->values       = values;
     (*descr)->const_values = values;
     (*descr)->data_type    = data_type;
+
+    (*descr)->batch_count  = 1;
+    (*descr)->batch_stride = 0;
     return rocsparse_status_success;
 }
 catch(...)
@@ -3730,6 +3953,9 @@ try
     new_descr->const_values = values;
     new_descr->data_type    = data_type;
 
+    new_descr->batch_count  = 1;
+    new_descr->batch_stride = 0;
+
     *descr = new_descr;
     return rocsparse_status_success;
 }
@@ -3858,6 +4084,58 @@ catch(...)
     RETURN_ROCSPARSE_EXCEPTION();
 }
 
+/********************************************************************************
+ * \brief rocsparse_dnvec_get_strided_batch gets the dense vector batch count
+ * and batch stride.
+ *******************************************************************************/
+rocsparse_status rocsparse_dnvec_get_strided_batch(rocsparse_const_dnvec_descr descr,
+                                                   int*                        batch_count,
+                                                   int64_t*                    batch_stride)
+try
+{
+    ROCSPARSE_CHECKARG_POINTER(0, descr);
+    ROCSPARSE_CHECKARG(0, descr, (descr->init == false), rocsparse_status_not_initialized);
+    ROCSPARSE_CHECKARG_POINTER(1, batch_count);
+    ROCSPARSE_CHECKARG_POINTER(2, batch_stride);
+
+    *batch_count  = descr->batch_count;
+    *batch_stride = descr->batch_stride;
+
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
+
+/********************************************************************************
+ * \brief rocsparse_dnvec_set_strided_batch sets the dense vector batch count
+ * and batch stride.
+ *******************************************************************************/
+rocsparse_status rocsparse_dnvec_set_strided_batch(rocsparse_dnvec_descr descr,
+                                                   int                   batch_count,
+                                                   int64_t               batch_stride)
+try
+{
+    ROCSPARSE_CHECKARG_POINTER(0, descr);
+    ROCSPARSE_CHECKARG(0, descr, (descr->init == false), rocsparse_status_not_initialized);
+    ROCSPARSE_CHECKARG(1, batch_count, (batch_count <= 0), rocsparse_status_invalid_value);
+    ROCSPARSE_CHECKARG(2, batch_stride, (batch_stride < 0), rocsparse_status_invalid_value);
+    ROCSPARSE_CHECKARG(2,
+                       batch_stride,
+                       (batch_count > 1 && batch_stride < descr->size),
+                       rocsparse_status_invalid_value);
+
+    descr->batch_count  = batch_count;
+    descr->batch_stride = batch_stride;
+
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
+
 /********************************************************************************
  * \brief rocsparse_create_dnmat_descr creates a descriptor holding the dense
  * matrix data, size and properties. It must be called prior to all subsequent
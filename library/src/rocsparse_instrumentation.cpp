@@ -0,0 +1,269 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "instrumentation.h"
+#include "control.h"
+#include "handle.h"
+#include "logging.h"
+
+#include <algorithm>
+
+namespace rocsparse
+{
+    std::atomic<int> instrumented_handles{0};
+
+    //
+    // Instrumentation of the current call of this thread. It is kept alive after its
+    // handle has been destroyed, and is retired such that it no longer collects launches.
+    //
+    static thread_local std::shared_ptr<rocsparse::instrumentation> tls_instrumentation;
+
+    //
+    // Write the kernels of the current call to the trace log and reset them. The lock of
+    // the instrumentation must be held.
+    //
+    static void write_summary(rocsparse_handle handle)
+    {
+        rocsparse::instrumentation* inst = handle->instrumentation.get();
+        if(inst->kernels.empty())
+        {
+            return;
+        }
+
+        if(handle->layer_mode & rocsparse_layer_mode_log_trace)
+        {
+            std::string   comma_separator = ",";
+            std::ostream* os              = handle->log_trace_os;
+
+            int64_t launches    = 0;
+            double  duration_ms = 0.0;
+            for(const auto& k : inst->kernels)
+            {
+                rocsparse::log_arguments(*os,
+                                         comma_separator,
+                                         "kernel_summary",
+                                         inst->routine,
+                                         k.kernel,
+                                         k.launches,
+                                         k.duration_ms);
+                launches += k.launches;
+                duration_ms += k.duration_ms;
+            }
+
+            rocsparse::log_arguments(*os,
+                                     comma_separator,
+                                     "call_summary",
+                                     inst->routine,
+                                     launches,
+                                     duration_ms,
+                                     inst->bytes,
+                                     inst->flops);
+        }
+
+        inst->kernels.clear();
+        inst->bytes = 0.0;
+        inst->flops = 0.0;
+    }
+
+    static void disable(rocsparse_handle handle)
+    {
+        if(handle->instrumentation == nullptr)
+        {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(handle->instrumentation->mutex);
+            rocsparse::write_summary(handle);
+            handle->instrumentation->retired = true;
+        }
+
+        handle->instrumentation.reset();
+        --rocsparse::instrumented_handles;
+    }
+}
+
+rocsparse_status rocsparse::instrumentation_enable(rocsparse_handle                 handle,
+                                                   rocsparse_instrumentation_mode   mode,
+                                                   rocsparse_kernel_launch_callback callback,
+                                                   void*                            user_data)
+{
+    if(mode == rocsparse_instrumentation_mode_none)
+    {
+        rocsparse::disable(handle);
+        return rocsparse_status_success;
+    }
+
+    if(handle->instrumentation == nullptr)
+    {
+        handle->instrumentation = std::make_shared<rocsparse::instrumentation>();
+        ++rocsparse::instrumented_handles;
+    }
+
+    std::lock_guard<std::mutex> lock(handle->instrumentation->mutex);
+    handle->instrumentation->mode      = mode;
+    handle->instrumentation->callback  = callback;
+    handle->instrumentation->user_data = user_data;
+
+    return rocsparse_status_success;
+}
+
+void rocsparse::instrumentation_disable(rocsparse_handle handle)
+{
+    if(rocsparse::tls_instrumentation != nullptr
+       && rocsparse::tls_instrumentation == handle->instrumentation)
+    {
+        rocsparse::tls_instrumentation.reset();
+    }
+
+    rocsparse::disable(handle);
+}
+
+void rocsparse::instrumentation_begin(rocsparse_handle handle, const char* routine)
+{
+    rocsparse::tls_instrumentation = handle->instrumentation;
+    if(handle->instrumentation == nullptr)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(handle->instrumentation->mutex);
+    rocsparse::write_summary(handle);
+    handle->instrumentation->routine = routine;
+
+    // Waiting for the kernels would break stream capture
+    handle->instrumentation->capture_safe = (handle->capture_mode == rocsparse_capture_mode_safe);
+}
+
+void rocsparse::instrumentation_estimate(rocsparse_handle handle, double bytes, double flops)
+{
+    if(handle->instrumentation == nullptr)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(handle->instrumentation->mutex);
+    handle->instrumentation->bytes = bytes;
+    handle->instrumentation->flops = flops;
+}
+
+void rocsparse::kernel_launch::begin(
+    const char* kernel, dim3 grid, dim3 block, size_t shared_memory, hipStream_t stream)
+{
+    // The handle of the current call may have been destroyed by another thread since
+    const std::shared_ptr<rocsparse::instrumentation>& inst = rocsparse::tls_instrumentation;
+    if(inst == nullptr || inst->retired)
+    {
+        return;
+    }
+
+    bool timed;
+    {
+        std::lock_guard<std::mutex> lock(inst->mutex);
+
+        this->callback_   = inst->callback;
+        this->user_data_  = inst->user_data;
+        this->routine_    = inst->routine;
+        this->info_.bytes = inst->bytes;
+        this->info_.flops = inst->flops;
+
+        timed = (inst->mode == rocsparse_instrumentation_mode_timed && !inst->capture_safe);
+    }
+
+    this->info_.kernel        = kernel;
+    this->info_.grid[0]       = grid.x;
+    this->info_.grid[1]       = grid.y;
+    this->info_.grid[2]       = grid.z;
+    this->info_.block[0]      = block.x;
+    this->info_.block[1]      = block.y;
+    this->info_.block[2]      = block.z;
+    this->info_.shared_memory = shared_memory;
+    this->info_.stream        = stream;
+    this->info_.duration_ms   = -1.0f;
+
+    if(timed)
+    {
+        if(hipEventCreate(&this->start_) != hipSuccess)
+        {
+            this->start_ = nullptr;
+        }
+        else if(hipEventCreate(&this->stop_) != hipSuccess)
+        {
+            PRINT_IF_HIP_ERROR(hipEventDestroy(this->start_));
+            this->start_ = nullptr;
+            this->stop_  = nullptr;
+        }
+        else
+        {
+            PRINT_IF_HIP_ERROR(hipEventRecord(this->start_, stream));
+        }
+    }
+
+    this->instrumentation_ = inst;
+    this->active_          = true;
+}
+
+void rocsparse::kernel_launch::end()
+{
+    if(this->start_ != nullptr)
+    {
+        float elapsed;
+        if(hipEventRecord(this->stop_, this->info_.stream) == hipSuccess
+           && hipEventSynchronize(this->stop_) == hipSuccess
+           && hipEventElapsedTime(&elapsed, this->start_, this->stop_) == hipSuccess)
+        {
+            this->info_.duration_ms = elapsed;
+        }
+
+        PRINT_IF_HIP_ERROR(hipEventDestroy(this->start_));
+        PRINT_IF_HIP_ERROR(hipEventDestroy(this->stop_));
+    }
+
+    rocsparse::instrumentation* inst = this->instrumentation_.get();
+    if(inst->retired)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(inst->mutex);
+
+        auto it = std::find_if(inst->kernels.begin(), inst->kernels.end(), [this](const auto& k) {
+            return k.kernel == this->info_.kernel;
+        });
+        if(it == inst->kernels.end())
+        {
+            inst->kernels.push_back({this->info_.kernel, 0, 0.0});
+            it = inst->kernels.end() - 1;
+        }
+
+        ++it->launches;
+        it->duration_ms += std::max(this->info_.duration_ms, 0.0f);
+    }
+
+    if(this->callback_ != nullptr)
+    {
+        this->info_.routine = this->routine_.c_str();
+        this->callback_(&this->info_, this->user_data_);
+    }
+}
@@ -0,0 +1,448 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "control.h"
+#include "envariables.h"
+#include "tracing.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace rocsparse
+{
+    static void release_events(trace_record& record)
+    {
+        if(record.gpu_start != nullptr)
+        {
+            PRINT_IF_HIP_ERROR(hipEventDestroy(record.gpu_start));
+            PRINT_IF_HIP_ERROR(hipEventDestroy(record.gpu_stop));
+            record.gpu_start = nullptr;
+            record.gpu_stop  = nullptr;
+        }
+    }
+
+    // Resolve the pending device timing of a record
+    static void resolve_events(trace_record& record)
+    {
+        if(record.gpu_start != nullptr)
+        {
+            float elapsed;
+            if(hipEventSynchronize(record.gpu_stop) == hipSuccess
+               && hipEventElapsedTime(&elapsed, record.gpu_start, record.gpu_stop) == hipSuccess)
+            {
+                record.gpu_duration_ms = elapsed;
+            }
+
+            rocsparse::release_events(record);
+        }
+    }
+
+    //
+    // Ring buffer of a single thread, the oldest records are overwritten
+    // once the capacity is exceeded.
+    //
+    struct trace_buffer
+    {
+        std::mutex                mutex;
+        std::vector<trace_record> records;
+        uint64_t                  count{};
+        uint64_t                  thread_id{};
+
+        void push(const trace_record& record)
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+
+            trace_record& slot = this->records[this->count % this->records.size()];
+            if(this->count >= this->records.size())
+            {
+                // Release the events of the overwritten record
+                rocsparse::release_events(slot);
+            }
+
+            slot = record;
+            ++this->count;
+        }
+    };
+
+    //
+    // Registry of all ring buffers, such that records of all threads can be exported.
+    //
+    class tracer
+    {
+    public:
+        static tracer& instance()
+        {
+            static tracer self;
+            return self;
+        }
+
+        std::shared_ptr<trace_buffer> create_buffer()
+        {
+            std::shared_ptr<trace_buffer> buffer = std::make_shared<trace_buffer>();
+            buffer->records.resize(this->capacity);
+
+            std::lock_guard<std::mutex> lock(this->mutex);
+            buffer->thread_id = this->next_thread_id++;
+            this->buffers.push_back(buffer);
+            return buffer;
+        }
+
+        void release_buffer(const std::shared_ptr<trace_buffer>& buffer);
+
+        void attach()
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            ++this->handles;
+        }
+
+        void detach();
+
+        const bool   gpu_timing;
+        const size_t capacity;
+
+    private:
+        static size_t get_capacity()
+        {
+            const char* env = getenv("ROCSPARSE_LOG_PROFILE_CAPACITY");
+            const long  val = (env != nullptr) ? atol(env) : 0;
+            return (val > 0) ? val : 16384;
+        }
+
+        tracer()
+            : gpu_timing(ROCSPARSE_ENVARIABLES.get(rocsparse::envariables::LOG_PROFILE_GPU))
+            , capacity(get_capacity())
+            , origin(std::chrono::steady_clock::now())
+        {
+        }
+
+        void retire(uint64_t thread_id, const trace_record& record);
+        void write(std::ostream& os);
+        void reset();
+
+        std::mutex                                    mutex;
+        std::vector<std::shared_ptr<trace_buffer>>    buffers;
+        std::deque<std::pair<uint64_t, trace_record>> retired;
+        uint64_t                                      next_thread_id{};
+        size_t                                        handles{};
+
+    public:
+        const std::chrono::steady_clock::time_point origin;
+    };
+
+    //
+    // Owner of the ring buffer of a thread, hands the records over to the tracer
+    // and unregisters the buffer when the thread exits.
+    //
+    struct trace_buffer_owner
+    {
+        std::shared_ptr<trace_buffer> buffer;
+
+        ~trace_buffer_owner()
+        {
+            if(this->buffer != nullptr)
+            {
+                rocsparse::tracer::instance().release_buffer(this->buffer);
+            }
+        }
+    };
+
+    static thread_local trace_buffer_owner tls_trace_buffer;
+    static thread_local trace_record*      tls_trace_scope = nullptr;
+
+    static trace_buffer& get_trace_buffer()
+    {
+        if(tls_trace_buffer.buffer == nullptr)
+        {
+            tls_trace_buffer.buffer = rocsparse::tracer::instance().create_buffer();
+        }
+        return *tls_trace_buffer.buffer;
+    }
+
+    static int64_t get_time_ns()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now() - rocsparse::tracer::instance().origin)
+            .count();
+    }
+
+    static void
+        write_record(std::ostream& os, const trace_record& record, uint64_t tid, bool& first)
+    {
+        os << (first ? "\n" : ",\n");
+        first = false;
+
+        // Host event, durations are given in microseconds
+        os << "{\"name\":\"" << record.name << "\",\"cat\":\"rocsparse\",\"pid\":0,\"tid\":" << tid
+           << ",\"ts\":" << (record.timestamp_ns / 1000.0);
+        if(record.duration_ns >= 0)
+        {
+            os << ",\"ph\":\"X\",\"dur\":" << (record.duration_ns / 1000.0);
+        }
+        else
+        {
+            os << ",\"ph\":\"i\",\"s\":\"t\"";
+        }
+        os << ",\"args\":{\"stream\":\"" << (const void*)record.stream << "\",\"digest\":\"0x"
+           << std::hex << record.digest << std::dec << "\"}}";
+
+        // Device event, placed on a separate track per stream
+        if(record.gpu_duration_ms >= 0.0f)
+        {
+            os << ",\n{\"name\":\"" << record.name
+               << "\",\"cat\":\"gpu\",\"pid\":1,\"tid\":" << (uintptr_t)record.stream
+               << ",\"ts\":" << (record.timestamp_ns / 1000.0)
+               << ",\"ph\":\"X\",\"dur\":" << (record.gpu_duration_ms * 1000.0) << "}";
+        }
+    }
+
+    // Requires the lock of the tracer, the records of exited threads are kept up to
+    // the capacity of a single ring buffer
+    void tracer::retire(uint64_t thread_id, const trace_record& record)
+    {
+        if(this->retired.size() >= this->capacity)
+        {
+            rocsparse::release_events(this->retired.front().second);
+            this->retired.pop_front();
+        }
+
+        this->retired.emplace_back(thread_id, record);
+    }
+
+    void tracer::release_buffer(const std::shared_ptr<trace_buffer>& buffer)
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+
+        {
+            std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+
+            const uint64_t size  = buffer->records.size();
+            const uint64_t begin = (buffer->count > size) ? buffer->count - size : 0;
+            for(uint64_t i = begin; i < buffer->count; ++i)
+            {
+                this->retire(buffer->thread_id, buffer->records[i % size]);
+            }
+            buffer->count = 0;
+        }
+
+        auto it = std::find(this->buffers.begin(), this->buffers.end(), buffer);
+        if(it != this->buffers.end())
+        {
+            this->buffers.erase(it);
+        }
+    }
+
+    // Requires the lock of the tracer
+    void tracer::write(std::ostream& os)
+    {
+        bool first = true;
+
+        os << "{\"traceEvents\":[";
+        for(auto& entry : this->retired)
+        {
+            rocsparse::resolve_events(entry.second);
+            rocsparse::write_record(os, entry.second, entry.first, first);
+        }
+
+        for(auto& buffer : this->buffers)
+        {
+            std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+
+            const uint64_t size  = buffer->records.size();
+            const uint64_t begin = (buffer->count > size) ? buffer->count - size : 0;
+            for(uint64_t i = begin; i < buffer->count; ++i)
+            {
+                trace_record& record = buffer->records[i % size];
+
+                rocsparse::resolve_events(record);
+                rocsparse::write_record(os, record, buffer->thread_id, first);
+            }
+        }
+        os << "\n],\"displayTimeUnit\":\"ns\"}\n";
+    }
+
+    // Requires the lock of the tracer, drops all records such that the next export
+    // only contains the records of the following profiling session
+    void tracer::reset()
+    {
+        for(auto& entry : this->retired)
+        {
+            rocsparse::release_events(entry.second);
+        }
+        this->retired.clear();
+
+        for(auto& buffer : this->buffers)
+        {
+            std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+
+            const uint64_t size  = buffer->records.size();
+            const uint64_t begin = (buffer->count > size) ? buffer->count - size : 0;
+            for(uint64_t i = begin; i < buffer->count; ++i)
+            {
+                rocsparse::release_events(buffer->records[i % size]);
+            }
+            buffer->count = 0;
+        }
+    }
+
+    void tracer::detach()
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+
+        // Records are only exported once the last profiled handle is destroyed, the
+        // file is opened under the lock such that concurrent exports cannot interleave
+        if(this->handles == 0 || --this->handles != 0)
+        {
+            return;
+        }
+
+        const char* path = getenv("ROCSPARSE_LOG_PROFILE_PATH");
+
+        std::ofstream ofs((path != nullptr) ? path : "rocsparse_trace.json");
+        if(ofs.is_open() == false)
+        {
+            std::cerr << "rocsparse error, cannot open trace file "
+                      << ((path != nullptr) ? path : "rocsparse_trace.json") << std::endl;
+            return;
+        }
+
+        this->write(ofs);
+        this->reset();
+    }
+}
+
+void rocsparse::trace_begin(trace_record& record, hipStream_t stream)
+{
+    record.name[0]         = '\0';
+    record.digest          = 0;
+    record.stream          = stream;
+    record.duration_ns     = -1;
+    record.gpu_duration_ms = -1.0f;
+    record.gpu_start       = nullptr;
+    record.gpu_stop        = nullptr;
+
+    if(rocsparse::tracer::instance().gpu_timing)
+    {
+        if(hipEventCreate(&record.gpu_start) != hipSuccess)
+        {
+            record.gpu_start = nullptr;
+        }
+        else if(hipEventCreate(&record.gpu_stop) != hipSuccess)
+        {
+            PRINT_IF_HIP_ERROR(hipEventDestroy(record.gpu_start));
+            record.gpu_start = nullptr;
+            record.gpu_stop  = nullptr;
+        }
+        else
+        {
+            PRINT_IF_HIP_ERROR(hipEventRecord(record.gpu_start, stream));
+        }
+    }
+
+    record.timestamp_ns = rocsparse::get_time_ns();
+}
+
+void rocsparse::trace_end(trace_record& record)
+{
+    record.duration_ns = rocsparse::get_time_ns() - record.timestamp_ns;
+
+    if(record.gpu_stop != nullptr)
+    {
+        PRINT_IF_HIP_ERROR(hipEventRecord(record.gpu_stop, record.stream));
+    }
+
+    rocsparse::get_trace_buffer().push(record);
+}
+
+void rocsparse::trace_push(const char* name, uint64_t digest, hipStream_t stream)
+{
+    // Complete the timed record in progress, if any
+    trace_record* scope = rocsparse::tls_trace_scope;
+    if(scope != nullptr && scope->name[0] == '\0')
+    {
+        strncpy(scope->name, name, trace_record::name_size - 1);
+        scope->name[trace_record::name_size - 1] = '\0';
+        scope->digest                            = digest;
+        return;
+    }
+
+    trace_record record;
+    record.timestamp_ns = rocsparse::get_time_ns();
+    strncpy(record.name, name, trace_record::name_size - 1);
+    record.name[trace_record::name_size - 1] = '\0';
+    record.digest                            = digest;
+    record.stream                            = stream;
+    record.duration_ns                       = -1;
+    record.gpu_duration_ms                   = -1.0f;
+    record.gpu_start                         = nullptr;
+    record.gpu_stop                          = nullptr;
+
+    rocsparse::get_trace_buffer().push(record);
+}
+
+void rocsparse::trace_attach()
+{
+    rocsparse::tracer::instance().attach();
+}
+
+void rocsparse::trace_detach()
+{
+    rocsparse::tracer::instance().detach();
+}
+
+rocsparse::trace_scope::trace_scope(rocsparse_handle handle)
+{
+    // Only the outermost scope of a thread is timed
+    if(handle != nullptr && (handle->layer_mode & rocsparse_layer_mode_log_profile)
+       && rocsparse::tls_trace_scope == nullptr)
+    {
+        rocsparse::trace_begin(this->record_, handle->stream);
+        rocsparse::tls_trace_scope = &this->record_;
+        this->active_              = true;
+    }
+}
+
+rocsparse::trace_scope::~trace_scope()
+{
+    if(this->active_)
+    {
+        rocsparse::tls_trace_scope = nullptr;
+
+        // Nothing has been logged, e.g. invalid handle
+        if(this->record_.name[0] == '\0')
+        {
+            rocsparse::release_events(this->record_);
+            return;
+        }
+
+        rocsparse::trace_end(this->record_);
+    }
+}
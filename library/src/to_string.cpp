@@ -82,6 +82,8 @@ const char* rocsparse::to_string(rocsparse_status status)
         return "thrown exception";
     case rocsparse_status_continue:
         return "continue";
+    case rocsparse_status_not_capture_safe:
+        return "not capture safe";
     }
     THROW_IF_ROCSPARSE_ERROR(rocsparse_status_invalid_value);
 }
@@ -317,6 +319,7 @@ const char* rocsparse::to_string(rocsparse_spmv_alg value_)
         CASE(rocsparse_spmv_alg_coo_atomic);
         CASE(rocsparse_spmv_alg_bsr);
         CASE(rocsparse_spmv_alg_csr_lrb);
+        CASE(rocsparse_spmv_alg_csr_gather);
     }
     THROW_IF_ROCSPARSE_ERROR(rocsparse_status_invalid_value);
 };
@@ -462,6 +465,61 @@ const char* rocsparse::to_string(rocsparse_spgemm_stage value_)
     THROW_IF_ROCSPARSE_ERROR(rocsparse_status_invalid_value);
 };
 
+const char* rocsparse::to_string(rocsparse_spgemm_mask value_)
+{
+    switch(value_)
+    {
+        CASE(rocsparse_spgemm_mask_structure);
+        CASE(rocsparse_spgemm_mask_complement);
+    }
+    THROW_IF_ROCSPARSE_ERROR(rocsparse_status_invalid_value);
+};
+
+const char* rocsparse::to_string(rocsparse_spgeam_alg value_)
+{
+    switch(value_)
+    {
+        CASE(rocsparse_spgeam_alg_default);
+    }
+    THROW_IF_ROCSPARSE_ERROR(rocsparse_status_invalid_value);
+};
+
+const char* rocsparse::to_string(rocsparse_spgeam_stage value_)
+{
+    switch(value_)
+    {
+        CASE(rocsparse_spgeam_stage_buffer_size);
+        CASE(rocsparse_spgeam_stage_nnz);
+        CASE(rocsparse_spgeam_stage_compute);
+        CASE(rocsparse_spgeam_stage_symbolic);
+        CASE(rocsparse_spgeam_stage_numeric);
+    }
+    THROW_IF_ROCSPARSE_ERROR(rocsparse_status_invalid_value);
+};
+
+const char* rocsparse::to_string(rocsparse_semiring value_)
+{
+    switch(value_)
+    {
+        CASE(rocsparse_semiring_plus_times);
+        CASE(rocsparse_semiring_min_plus);
+        CASE(rocsparse_semiring_max_times);
+        CASE(rocsparse_semiring_max_min);
+        CASE(rocsparse_semiring_or_and);
+    }
+    THROW_IF_ROCSPARSE_ERROR(rocsparse_status_invalid_value);
+};
+
+const char* rocsparse::to_string(rocsparse_spmv_reduction value_)
+{
+    switch(value_)
+    {
+        CASE(rocsparse_spmv_reduction_dot_xy);
+        CASE(rocsparse_spmv_reduction_dot_yy);
+    }
+    THROW_IF_ROCSPARSE_ERROR(rocsparse_status_invalid_value);
+};
+
 const char* rocsparse::to_string(rocsparse_solve_policy value_)
 {
     switch(value_)
@@ -28,55 +28,48 @@
 
 namespace rocsparse
 {
+    // Keeps the first error that has been found. Invalid offsets take precedence over
+    // all other errors, since all other checks are meaningless in this case.
     ROCSPARSE_DEVICE_ILF void record_data_status(rocsparse_data_status* data_status,
                                                  rocsparse_data_status  status)
     {
-        if(status != rocsparse_data_status_success)
+        if(status == rocsparse_data_status_invalid_offset_ptr)
         {
-            *data_status = status;
+            atomicExch(reinterpret_cast<int*>(data_status), static_cast<int>(status));
+        }
+        else if(status != rocsparse_data_status_success)
+        {
+            atomicCAS(reinterpret_cast<int*>(data_status),
+                      static_cast<int>(rocsparse_data_status_success),
+                      static_cast<int>(status));
         }
     }
 
-    // Shift CSR offsets
+    // Shift CSR offsets to zero and clamp them to [0, nnz], such that the segmented
+    // sort stays in bounds even if the row pointer array is invalid
     template <unsigned int BLOCKSIZE, typename I, typename J>
     ROCSPARSE_KERNEL(BLOCKSIZE)
-    void shift_offsets_kernel(J size, const I* __restrict__ in, I* __restrict__ out)
+    void shift_offsets_kernel(J m,
+                              I nnz,
+                              const I* __restrict__ in,
+                              I* __restrict__ begin,
+                              I* __restrict__ end)
     {
         const J gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
 
-        if(gid >= size)
+        if(gid >= m)
         {
             return;
         }
 
-        out[gid] = in[gid] - in[0];
-    }
-
-    template <unsigned int BLOCKSIZE, typename I, typename J>
-    ROCSPARSE_KERNEL(BLOCKSIZE)
-    void check_row_ptr_array(J m,
-                             const I* __restrict__ csr_row_ptr,
-                             rocsparse_data_status* data_status)
-    {
-        const I gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
-
-        if(gid < m)
-        {
-            const I start = csr_row_ptr[gid] - csr_row_ptr[0];
-            const I end   = csr_row_ptr[gid + 1] - csr_row_ptr[0];
+        I b = in[gid] - in[0];
+        I e = in[gid + 1] - in[0];
 
-            if(start < 0 || end < 0)
-            {
-                record_data_status(data_status, rocsparse_data_status_invalid_offset_ptr);
-                return;
-            }
+        b = (b < 0) ? 0 : ((b > nnz) ? nnz : b);
+        e = (e < b) ? b : ((e > nnz) ? nnz : e);
 
-            if(end < start)
-            {
-                record_data_status(data_status, rocsparse_data_status_invalid_offset_ptr);
-                return;
-            }
-        }
+        begin[gid] = b;
+        end[gid]   = e;
     }
 
     template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename T, typename I, typename J>
@@ -100,6 +93,12 @@ namespace rocsparse
 
         const J row = gid / WF_SIZE;
 
+        // Check that nnz matches row pointer array
+        if(gid == 0 && csr_row_ptr[m] - csr_row_ptr[0] != nnz)
+        {
+            record_data_status(data_status, rocsparse_data_status_invalid_offset_ptr);
+        }
+
         if(row >= m)
         {
             return;
@@ -114,7 +113,7 @@ namespace rocsparse
             return;
         }
 
-        if(end < start)
+        if(end < start || end > nnz)
         {
             record_data_status(data_status, rocsparse_data_status_invalid_offset_ptr);
             return;
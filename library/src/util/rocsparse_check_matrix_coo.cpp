@@ -43,16 +43,25 @@ rocsparse_status rocsparse::check_matrix_coo_core(rocsparse_handle       handle,
                                                   rocsparse_data_status* data_status,
                                                   void*                  temp_buffer)
 {
-    *data_status = rocsparse_data_status_success;
+    // In device data status mode, the status is written to data_status on the device and
+    // the host is never blocked
+    const bool status_on_device = (handle->data_status_mode == rocsparse_data_status_mode_device);
+
+    // Otherwise, the status is read back on the host
+    if(status_on_device == false)
+    {
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
+    }
 
     // Temporary buffer entry points
     char* ptr = reinterpret_cast<char*>(temp_buffer);
 
-    rocsparse_data_status* d_data_status = reinterpret_cast<rocsparse_data_status*>(ptr);
+    rocsparse_data_status* d_data_status
+        = status_on_device ? data_status : reinterpret_cast<rocsparse_data_status*>(ptr);
     ptr += ((sizeof(rocsparse_data_status) - 1) / 256 + 1) * 256;
 
-    RETURN_IF_HIP_ERROR(hipMemsetAsync(d_data_status, 0, sizeof(int)));
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
+    RETURN_IF_HIP_ERROR(
+        hipMemsetAsync(d_data_status, 0, sizeof(rocsparse_data_status), handle->stream));
 
     RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::check_matrix_coo_device<256>),
                                        dim3((nnz - 1) / 256 + 1),
@@ -71,6 +80,11 @@ rocsparse_status rocsparse::check_matrix_coo_core(rocsparse_handle       handle,
                                        storage,
                                        d_data_status);
 
+    if(status_on_device)
+    {
+        return rocsparse_status_success;
+    }
+
     RETURN_IF_HIP_ERROR(hipMemcpyAsync(data_status,
                                        d_data_status,
                                        sizeof(rocsparse_data_status),
@@ -105,7 +119,15 @@ namespace rocsparse
     {
         if(nnz == 0)
         {
-            *data_status = rocsparse_data_status_success;
+            if(handle->data_status_mode == rocsparse_data_status_mode_device)
+            {
+                RETURN_IF_HIP_ERROR(hipMemsetAsync(
+                    data_status, 0, sizeof(rocsparse_data_status), handle->stream));
+            }
+            else
+            {
+                *data_status = rocsparse_data_status_success;
+            }
             return rocsparse_status_success;
         }
         return rocsparse_status_continue;
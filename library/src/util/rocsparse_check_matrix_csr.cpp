@@ -64,63 +64,33 @@ rocsparse_status rocsparse::check_matrix_csr_core(rocsparse_handle       handle,
                                                   rocsparse_data_status* data_status,
                                                   void*                  temp_buffer)
 {
+    // In device data status mode, the status is written to data_status on the device and
+    // the host is never blocked. In host data status mode, it is collected in the
+    // temporary buffer and copied back once all checks have been completed.
+    const bool status_on_device = (handle->data_status_mode == rocsparse_data_status_mode_device);
 
-    // Check that nnz matches row pointer array
-    I start = 0;
-    I end   = 0;
-
-    RETURN_IF_HIP_ERROR(
-        hipMemcpyAsync(&end, &csr_row_ptr[m], sizeof(I), hipMemcpyDeviceToHost, handle->stream));
-    RETURN_IF_HIP_ERROR(
-        hipMemcpyAsync(&start, &csr_row_ptr[0], sizeof(I), hipMemcpyDeviceToHost, handle->stream));
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
-
-    if(nnz != (end - start))
+    // Otherwise, the status is read back on the host
+    if(status_on_device == false)
     {
-        rocsparse::log_debug(handle, "CSR row pointer array does not match nnz.");
-        RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_invalid_value);
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
     }
 
-    // clear output status to success
-    *data_status = rocsparse_data_status_success;
-
     // Temporary buffer entry points
     char* ptr = reinterpret_cast<char*>(temp_buffer);
 
-    rocsparse_data_status* d_data_status = reinterpret_cast<rocsparse_data_status*>(ptr);
+    rocsparse_data_status* d_data_status
+        = status_on_device ? data_status : reinterpret_cast<rocsparse_data_status*>(ptr);
     ptr += ((sizeof(rocsparse_data_status) - 1) / 256 + 1) * 256;
 
-    RETURN_IF_HIP_ERROR(hipMemsetAsync(d_data_status, 0, sizeof(rocsparse_data_status)));
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
-
-    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::check_row_ptr_array<256>),
-                                       dim3((m - 1) / 256 + 1),
-                                       dim3(256),
-                                       0,
-                                       handle->stream,
-                                       m,
-                                       csr_row_ptr,
-                                       d_data_status);
-
-    RETURN_IF_HIP_ERROR(hipMemcpyAsync(data_status,
-                                       d_data_status,
-                                       sizeof(rocsparse_data_status),
-                                       hipMemcpyDeviceToHost,
-                                       handle->stream));
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
-
-    if(*data_status != rocsparse_data_status_success)
-    {
-        rocsparse::log_debug(handle, rocsparse::to_string(*data_status));
-
-        return rocsparse_status_success;
-    }
+    RETURN_IF_HIP_ERROR(
+        hipMemsetAsync(d_data_status, 0, sizeof(rocsparse_data_status), handle->stream));
 
     J avg_row_nnz = nnz / m;
 
-    I* tmp_offsets = nullptr;
-    J* tmp_cols1   = nullptr;
-    J* tmp_cols2   = nullptr;
+    I* tmp_begin = nullptr;
+    I* tmp_end   = nullptr;
+    J* tmp_cols1 = nullptr;
+    J* tmp_cols2 = nullptr;
 
     // If columns are unsorted, then sort them in temp buffer
     if(storage == rocsparse_storage_mode_unsorted)
@@ -129,8 +99,11 @@ rocsparse_status rocsparse::check_matrix_csr_core(rocsparse_handle       handle,
         unsigned int endbit   = rocsparse::clz(n);
         size_t       size;
 
-        // offsets buffer
-        tmp_offsets = reinterpret_cast<I*>(ptr);
+        // offsets buffers
+        tmp_begin = reinterpret_cast<I*>(ptr);
+        ptr += ((sizeof(I) * m) / 256 + 1) * 256;
+
+        tmp_end = reinterpret_cast<I*>(ptr);
         ptr += ((sizeof(I) * m) / 256 + 1) * 256;
 
         // columns 1 buffer
@@ -146,13 +119,14 @@ rocsparse_status rocsparse::check_matrix_csr_core(rocsparse_handle       handle,
                                            dim3(512),
                                            0,
                                            handle->stream,
-                                           m + 1,
+                                           m,
+                                           nnz,
                                            csr_row_ptr,
-                                           tmp_offsets);
+                                           tmp_begin,
+                                           tmp_end);
 
-        RETURN_IF_HIP_ERROR(
-            hipMemcpyAsync(tmp_cols1, csr_col_ind, sizeof(J) * nnz, hipMemcpyDeviceToDevice));
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            tmp_cols1, csr_col_ind, sizeof(J) * nnz, hipMemcpyDeviceToDevice, handle->stream));
 
         // rocprim buffer
         void* tmp_rocprim = reinterpret_cast<void*>(ptr);
@@ -164,8 +138,8 @@ rocsparse_status rocsparse::check_matrix_csr_core(rocsparse_handle       handle,
                                                                dummy,
                                                                nnz,
                                                                m,
-                                                               tmp_offsets,
-                                                               tmp_offsets + 1,
+                                                               tmp_begin,
+                                                               tmp_end,
                                                                startbit,
                                                                endbit,
                                                                handle->stream));
@@ -182,8 +156,8 @@ rocsparse_status rocsparse::check_matrix_csr_core(rocsparse_handle       handle,
                                                                            keys,
                                                                            nnz,
                                                                            m,
-                                                                           tmp_offsets,
-                                                                           tmp_offsets + 1,
+                                                                           tmp_begin,
+                                                                           tmp_end,
                                                                            startbit,
                                                                            endbit,
                                                                            handle->stream));
@@ -197,8 +171,8 @@ rocsparse_status rocsparse::check_matrix_csr_core(rocsparse_handle       handle,
                                                                            keys,
                                                                            nnz,
                                                                            m,
-                                                                           tmp_offsets,
-                                                                           tmp_offsets + 1,
+                                                                           tmp_begin,
+                                                                           tmp_end,
                                                                            startbit,
                                                                            endbit,
                                                                            handle->stream));
@@ -212,8 +186,8 @@ rocsparse_status rocsparse::check_matrix_csr_core(rocsparse_handle       handle,
                                                                            keys,
                                                                            nnz,
                                                                            m,
-                                                                           tmp_offsets,
-                                                                           tmp_offsets + 1,
+                                                                           tmp_begin,
+                                                                           tmp_end,
                                                                            startbit,
                                                                            endbit,
                                                                            handle->stream));
@@ -225,8 +199,8 @@ rocsparse_status rocsparse::check_matrix_csr_core(rocsparse_handle       handle,
                                                                    keys,
                                                                    nnz,
                                                                    m,
-                                                                   tmp_offsets,
-                                                                   tmp_offsets + 1,
+                                                                   tmp_begin,
+                                                                   tmp_end,
                                                                    startbit,
                                                                    endbit,
                                                                    handle->stream));
@@ -274,6 +248,19 @@ rocsparse_status rocsparse::check_matrix_csr_core(rocsparse_handle       handle,
         LAUNCH_CHECK_MATRIX_CSR(256, 256);
     }
 
+    if(status_on_device)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check that nnz matches row pointer array
+    I start = 0;
+    I end   = 0;
+
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(&end, &csr_row_ptr[m], sizeof(I), hipMemcpyDeviceToHost, handle->stream));
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(&start, &csr_row_ptr[0], sizeof(I), hipMemcpyDeviceToHost, handle->stream));
     RETURN_IF_HIP_ERROR(hipMemcpyAsync(data_status,
                                        d_data_status,
                                        sizeof(rocsparse_data_status),
@@ -281,6 +268,12 @@ rocsparse_status rocsparse::check_matrix_csr_core(rocsparse_handle       handle,
                                        handle->stream));
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
 
+    if(nnz != (end - start))
+    {
+        rocsparse::log_debug(handle, "CSR row pointer array does not match nnz.");
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_invalid_value);
+    }
+
     if(*data_status != rocsparse_data_status_success)
     {
         rocsparse::log_debug(handle, rocsparse::to_string(*data_status));
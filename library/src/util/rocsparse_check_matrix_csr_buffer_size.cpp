@@ -66,7 +66,8 @@ rocsparse_status rocsparse::check_matrix_csr_buffer_size_core(rocsparse_handle
                                                                 handle->stream));
         *buffer_size += ((rocprim_buffer_size - 1) / 256 + 1) * 256;
 
-        // offset buffer
+        // offsets buffers
+        *buffer_size += ((sizeof(I) * m) / 256 + 1) * 256;
         *buffer_size += ((sizeof(I) * m) / 256 + 1) * 256;
 
         // columns buffer
@@ -48,57 +48,31 @@ rocsparse_status rocsparse::check_matrix_gebsr_core(rocsparse_handle       handl
                                                     rocsparse_data_status* data_status,
                                                     void*                  temp_buffer)
 {
-    *data_status = rocsparse_data_status_success;
+    // In device data status mode, the status is written to data_status on the device and
+    // the host is never blocked. In host data status mode, it is collected in the
+    // temporary buffer and copied back once all checks have been completed.
+    const bool status_on_device = (handle->data_status_mode == rocsparse_data_status_mode_device);
 
-    I start = 0;
-    I end   = 0;
-    RETURN_IF_HIP_ERROR(
-        hipMemcpyAsync(&end, &bsr_row_ptr[mb], sizeof(I), hipMemcpyDeviceToHost, handle->stream));
-    RETURN_IF_HIP_ERROR(
-        hipMemcpyAsync(&start, &bsr_row_ptr[0], sizeof(I), hipMemcpyDeviceToHost, handle->stream));
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
-
-    if(nnzb != (end - start))
+    // Otherwise, the status is read back on the host
+    if(status_on_device == false)
     {
-        rocsparse::log_debug(handle, "GEBSR row pointer array does not match nnzb.");
-        RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_invalid_value);
+        RETURN_IF_CAPTURE_SAFE_MODE(handle);
     }
 
     // Temporary buffer entry points
     char* ptr = reinterpret_cast<char*>(temp_buffer);
 
-    rocsparse_data_status* d_data_status = reinterpret_cast<rocsparse_data_status*>(ptr);
+    rocsparse_data_status* d_data_status
+        = status_on_device ? data_status : reinterpret_cast<rocsparse_data_status*>(ptr);
     ptr += ((sizeof(rocsparse_data_status) - 1) / 256 + 1) * 256;
 
-    RETURN_IF_HIP_ERROR(hipMemsetAsync(d_data_status, 0, sizeof(rocsparse_data_status)));
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
-
-    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::check_row_ptr_array<256>),
-                                       dim3((mb - 1) / 256 + 1),
-                                       dim3(256),
-                                       0,
-                                       handle->stream,
-                                       mb,
-                                       bsr_row_ptr,
-                                       d_data_status);
-
-    RETURN_IF_HIP_ERROR(hipMemcpyAsync(data_status,
-                                       d_data_status,
-                                       sizeof(rocsparse_data_status),
-                                       hipMemcpyDeviceToHost,
-                                       handle->stream));
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
-
-    if(*data_status != rocsparse_data_status_success)
-    {
-        rocsparse::log_debug(handle, rocsparse::to_string(*data_status));
-
-        return rocsparse_status_success;
-    }
+    RETURN_IF_HIP_ERROR(
+        hipMemsetAsync(d_data_status, 0, sizeof(rocsparse_data_status), handle->stream));
 
-    I* tmp_offsets = nullptr;
-    J* tmp_cols1   = nullptr;
-    J* tmp_cols2   = nullptr;
+    I* tmp_begin = nullptr;
+    I* tmp_end   = nullptr;
+    J* tmp_cols1 = nullptr;
+    J* tmp_cols2 = nullptr;
 
     // If columns are unsorted, then sort them in temp buffer
     if(storage == rocsparse_storage_mode_unsorted)
@@ -107,8 +81,11 @@ rocsparse_status rocsparse::check_matrix_gebsr_core(rocsparse_handle       handl
         unsigned int endbit   = rocsparse::clz(nb);
         size_t       size;
 
-        // offsets buffer
-        tmp_offsets = reinterpret_cast<I*>(ptr);
+        // offsets buffers
+        tmp_begin = reinterpret_cast<I*>(ptr);
+        ptr += ((sizeof(I) * mb) / 256 + 1) * 256;
+
+        tmp_end = reinterpret_cast<I*>(ptr);
         ptr += ((sizeof(I) * mb) / 256 + 1) * 256;
 
         // columns 1 buffer
@@ -124,13 +101,14 @@ rocsparse_status rocsparse::check_matrix_gebsr_core(rocsparse_handle       handl
                                            dim3(512),
                                            0,
                                            handle->stream,
-                                           mb + 1,
+                                           mb,
+                                           nnzb,
                                            bsr_row_ptr,
-                                           tmp_offsets);
+                                           tmp_begin,
+                                           tmp_end);
 
-        RETURN_IF_HIP_ERROR(
-            hipMemcpyAsync(tmp_cols1, bsr_col_ind, sizeof(J) * nnzb, hipMemcpyDeviceToDevice));
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            tmp_cols1, bsr_col_ind, sizeof(J) * nnzb, hipMemcpyDeviceToDevice, handle->stream));
 
         // rocprim buffer
         void* tmp_rocprim = reinterpret_cast<void*>(ptr);
@@ -142,8 +120,8 @@ rocsparse_status rocsparse::check_matrix_gebsr_core(rocsparse_handle       handl
                                                                dummy,
                                                                nnzb,
                                                                mb,
-                                                               tmp_offsets,
-                                                               tmp_offsets + 1,
+                                                               tmp_begin,
+                                                               tmp_end,
                                                                startbit,
                                                                endbit,
                                                                handle->stream));
@@ -163,8 +141,8 @@ rocsparse_status rocsparse::check_matrix_gebsr_core(rocsparse_handle       handl
                                                                            keys,
                                                                            nnzb,
                                                                            mb,
-                                                                           tmp_offsets,
-                                                                           tmp_offsets + 1,
+                                                                           tmp_begin,
+                                                                           tmp_end,
                                                                            startbit,
                                                                            endbit,
                                                                            handle->stream));
@@ -178,8 +156,8 @@ rocsparse_status rocsparse::check_matrix_gebsr_core(rocsparse_handle       handl
                                                                            keys,
                                                                            nnzb,
                                                                            mb,
-                                                                           tmp_offsets,
-                                                                           tmp_offsets + 1,
+                                                                           tmp_begin,
+                                                                           tmp_end,
                                                                            startbit,
                                                                            endbit,
                                                                            handle->stream));
@@ -193,8 +171,8 @@ rocsparse_status rocsparse::check_matrix_gebsr_core(rocsparse_handle       handl
                                                                            keys,
                                                                            nnzb,
                                                                            mb,
-                                                                           tmp_offsets,
-                                                                           tmp_offsets + 1,
+                                                                           tmp_begin,
+                                                                           tmp_end,
                                                                            startbit,
                                                                            endbit,
                                                                            handle->stream));
@@ -206,8 +184,8 @@ rocsparse_status rocsparse::check_matrix_gebsr_core(rocsparse_handle       handl
                                                                    keys,
                                                                    nnzb,
                                                                    mb,
-                                                                   tmp_offsets,
-                                                                   tmp_offsets + 1,
+                                                                   tmp_begin,
+                                                                   tmp_end,
                                                                    startbit,
                                                                    endbit,
                                                                    handle->stream));
@@ -247,6 +225,19 @@ rocsparse_status rocsparse::check_matrix_gebsr_core(rocsparse_handle       handl
                                        storage,
                                        d_data_status);
 
+    if(status_on_device)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check that nnzb matches row pointer array
+    I start = 0;
+    I end   = 0;
+
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(&end, &bsr_row_ptr[mb], sizeof(I), hipMemcpyDeviceToHost, handle->stream));
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(&start, &bsr_row_ptr[0], sizeof(I), hipMemcpyDeviceToHost, handle->stream));
     RETURN_IF_HIP_ERROR(hipMemcpyAsync(data_status,
                                        d_data_status,
                                        sizeof(rocsparse_data_status),
@@ -254,6 +245,12 @@ rocsparse_status rocsparse::check_matrix_gebsr_core(rocsparse_handle       handl
                                        handle->stream));
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
 
+    if(nnzb != (end - start))
+    {
+        rocsparse::log_debug(handle, "GEBSR row pointer array does not match nnzb.");
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_status_invalid_value);
+    }
+
     if(*data_status != rocsparse_data_status_success)
     {
         rocsparse::log_debug(handle, rocsparse::to_string(*data_status));
@@ -27,8 +27,22 @@
 #include "rocsparse_check_matrix_ell.hpp"
 #include "utility.h"
 
+#include "common.h"
+
 namespace rocsparse
 {
+    // Keeps the status of the ELL part, unless the ELL part is valid
+    template <unsigned int BLOCKSIZE>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void check_matrix_hyb_merge_status_kernel(rocsparse_data_status* __restrict__ data_status,
+                                              const rocsparse_data_status* __restrict__ coo_status)
+    {
+        if(*data_status == rocsparse_data_status_success)
+        {
+            *data_status = *coo_status;
+        }
+    }
+
     template <typename I>
     static rocsparse_status check_matrix_ell_template_dispatch(rocsparse_datatype     type,
                                                                rocsparse_handle       handle,
@@ -243,6 +257,53 @@ rocsparse_status rocsparse_check_matrix_hyb(rocsparse_handle        handle,
     ROCSPARSE_CHECKARG_POINTER(6, data_status);
     ROCSPARSE_CHECKARG_POINTER(7, temp_buffer);
 
+    if(handle->data_status_mode == rocsparse_data_status_mode_device)
+    {
+        // The COO part reports to the temporary buffer, which is not required by either
+        // part in device data status mode, and both are merged on the device
+        rocsparse_data_status* coo_data_status
+            = reinterpret_cast<rocsparse_data_status*>(temp_buffer);
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::check_matrix_ell_template_dispatch(hyb->data_type_T,
+                                                                                handle,
+                                                                                hyb->m,
+                                                                                hyb->n,
+                                                                                hyb->ell_width,
+                                                                                hyb->ell_val,
+                                                                                hyb->ell_col_ind,
+                                                                                idx_base,
+                                                                                matrix_type,
+                                                                                uplo,
+                                                                                storage,
+                                                                                data_status,
+                                                                                temp_buffer));
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::check_matrix_coo_template_dispatch(hyb->data_type_T,
+                                                                                handle,
+                                                                                hyb->m,
+                                                                                hyb->n,
+                                                                                hyb->coo_nnz,
+                                                                                hyb->coo_val,
+                                                                                hyb->coo_row_ind,
+                                                                                hyb->coo_col_ind,
+                                                                                idx_base,
+                                                                                matrix_type,
+                                                                                uplo,
+                                                                                storage,
+                                                                                coo_data_status,
+                                                                                temp_buffer));
+
+        RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::check_matrix_hyb_merge_status_kernel<1>),
+                                           dim3(1),
+                                           dim3(1),
+                                           0,
+                                           handle->stream,
+                                           data_status,
+                                           coo_data_status);
+
+        return rocsparse_status_success;
+    }
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse::check_matrix_ell_template_dispatch(hyb->data_type_T,
                                                                             handle,
                                                                             hyb->m,
@@ -257,6 +318,12 @@ rocsparse_status rocsparse_check_matrix_hyb(rocsparse_handle        handle,
                                                                             data_status,
                                                                             temp_buffer));
 
+    // The COO part is only checked if the ELL part is valid
+    if(*data_status != rocsparse_data_status_success)
+    {
+        return rocsparse_status_success;
+    }
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse::check_matrix_coo_template_dispatch(hyb->data_type_T,
                                                                             handle,
                                                                             hyb->m,
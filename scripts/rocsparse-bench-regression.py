@@ -39,9 +39,12 @@ def main():
     parser = argparse.ArgumentParser()
     parser.add_argument('-v', '--verbose',         required=False, default = False, action = "store_true")
     parser.add_argument('-t', '--tol',         required=True, default = 2.0,type=float)
+    parser.add_argument('-e', '--efficiency',      required=False, default = False, action = "store_true",
+                        help='compare the attained percentage of the roofline rather than raw time, flops and bandwidth, for results from different devices')
     user_args, unknown_args = parser.parse_known_args()
 
     verbose=user_args.verbose
+    efficiency=user_args.efficiency
     percentage_tol = user_args.tol
     data = []
     num_files = len(unknown_args)
@@ -89,6 +92,14 @@ def main():
             exit(1)
     if verbose:
         print('//rocsparse-bench-regression  -  num samples checked.')
+####
+    if efficiency:
+        for i in range(num_files):
+            if not all('roofline' in sample['timing'] for sample in samples[i]):
+                print('roofline efficiency is missing from file \''+unknown_args[i]+'\', it must be generated with a roofline-aware rocsparse-bench')
+                exit(1)
+        if verbose:
+            print('//rocsparse-bench-regression  -  roofline efficiency checked.')
 ####
     if verbose:
         print('//rocsparse-bench-regression percentage_tol: ' + str(percentage_tol) + '%')
@@ -104,11 +115,29 @@ def main():
             mn_rel_flops=0
             mn_rel_time=0
             mn_rel_bandwidth=0
+            mx_rel_efficiency=0
+            mn_rel_efficiency=0
             regression=False
             for ixarg  in range(len_xargs):
                 isample = iplot * len_xargs + ixarg
                 tg = samples[file_index][isample]["timing"]
                 tg0=samples[0][isample]["timing"]
+                if efficiency:
+                    eff0 = float(tg0["roofline"][0])
+                    rel_efficiency = 100*(float(tg["roofline"][0])-eff0)/eff0 if eff0 > 0 else 0
+                    if ixarg > 0:
+                        mx_rel_efficiency=max(mx_rel_efficiency,rel_efficiency)
+                        mn_rel_efficiency=min(mn_rel_efficiency,rel_efficiency)
+                    else:
+                        mx_rel_efficiency=rel_efficiency
+                        mn_rel_efficiency=rel_efficiency
+
+                    if (rel_efficiency < -percentage_tol):
+                        regression=True
+                        print("")
+                        print("//rocsparse-bench-regression   FAIL roofline efficiency exceeds tolerance of  "  +  str(percentage_tol) + "%, [" +"{:.2f}".format(mn_rel_efficiency) + "," + "{:.2f}".format(mx_rel_efficiency) + "] from '" + xargs[file_index][ixarg] + "'")
+                    continue
+
                 rel_flops = 100*(float(tg["flops"][0])-float(tg0["flops"][0]))/float(tg0["flops"][0])
 
                 rel_time = 100*(float(tg["time"][0])-float(tg0["time"][0]))/float(tg0["time"][0])
@@ -151,7 +180,9 @@ def main():
                 print('//rocsparse-bench-regression plot index ' + str(iplot) + ': \'' + yargs[0][iplot] + '\' FAILED')
             else:
                 print("   PASSED")
-        if verbose:
+        if verbose and efficiency:
+            print("//rocsparse-bench-regression    roofline efficiency [" +"{:.2f}".format(mn_rel_efficiency) + "," + "{:.2f}".format(mx_rel_efficiency) + "]")
+        elif verbose:
             print("//rocsparse-bench-regression    flops [" +"{:.2f}".format(mn_rel_flops) + "," + "{:.2f}".format(mx_rel_flops) + "], " + "time [" +"{:.2f}".format(mn_rel_time) + "," + "{:.2f}".format(mx_rel_time) + "], " + "bandwidth [" +"{:.2f}".format(mn_rel_bandwidth) + "," + "{:.2f}".format(mx_rel_bandwidth) + "]")
     if global_regression:
         exit(1)